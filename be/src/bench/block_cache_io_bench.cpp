@@ -0,0 +1,276 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the read path of the data cache: CacheInputStream over BlockCache, reading the objects of a remote
+// storage simulated by the memory file system with injected latency. The concurrent readers pick the objects by a
+// zipf distribution, and the hit ratio and the eviction pressure are controlled by the size of the working set
+// relative to the memory and disk tiers of the cache. The cache is kept across the runs of the same configuration,
+// so the results are of the steady state.
+//
+// Reported: the throughput as bytes_per_second, the latency percentiles of a read and the bytes hit by each tier.
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <thread>
+
+#include "block_cache/block_cache.h"
+#include "common/logging.h"
+#include "fs/fs_memory.h"
+#include "io/cache_input_stream.h"
+#include "io/io_latency_metrics.h"
+#include "io/shared_buffered_input_stream.h"
+#include "util/stopwatch.hpp"
+
+namespace starrocks {
+
+static constexpr int64_t kMB = 1024 * 1024;
+static constexpr int64_t kBlockSize = 1 * kMB;
+static const std::string kDiskCachePath = "./bench_dir/block_cache_io_bench";
+static const std::string kRemoteDir = "/remote";
+
+// A stream of the remote storage, each read waits for |latency_us| plus the transfer time at |mb_per_second|.
+class LatencyInjectedInputStream final : public io::SeekableInputStreamWrapper {
+public:
+    LatencyInjectedInputStream(std::unique_ptr<io::SeekableInputStream> stream, int64_t latency_us,
+                               int64_t mb_per_second)
+            : io::SeekableInputStreamWrapper(std::move(stream)),
+              _latency_us(latency_us),
+              _mb_per_second(mb_per_second) {}
+
+    StatusOr<int64_t> read(void* data, int64_t count) override {
+        _wait(count);
+        return io::SeekableInputStreamWrapper::read(data, count);
+    }
+
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override {
+        _wait(count);
+        return io::SeekableInputStreamWrapper::read_at(offset, out, count);
+    }
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override {
+        _wait(count);
+        return io::SeekableInputStreamWrapper::read_at_fully(offset, out, count);
+    }
+
+private:
+    void _wait(int64_t count) {
+        int64_t transfer_us = _mb_per_second > 0 ? count * 1000000 / (_mb_per_second * kMB) : 0;
+        std::this_thread::sleep_for(std::chrono::microseconds(_latency_us + transfer_us));
+    }
+
+    const int64_t _latency_us;
+    const int64_t _mb_per_second;
+};
+
+// The memory file system whose files are read with the latency of a remote storage.
+class RemoteMemoryFileSystem final : public MemoryFileSystem {
+public:
+    RemoteMemoryFileSystem(int64_t latency_us, int64_t mb_per_second)
+            : _latency_us(latency_us), _mb_per_second(mb_per_second) {}
+
+    using MemoryFileSystem::new_random_access_file;
+
+    StatusOr<std::unique_ptr<RandomAccessFile>> new_random_access_file(const RandomAccessFileOptions& opts,
+                                                                       const std::string& url) override {
+        ASSIGN_OR_RETURN(auto file, MemoryFileSystem::new_random_access_file(opts, url));
+        auto stream = std::make_shared<LatencyInjectedInputStream>(
+                std::make_unique<RandomAccessFileStreamAdaptor>(std::move(file)), _latency_us, _mb_per_second);
+        return std::make_unique<RandomAccessFile>(std::move(stream), url);
+    }
+
+private:
+    // Owns the RandomAccessFile of the memory file system under the injected latency.
+    class RandomAccessFileStreamAdaptor final : public io::SeekableInputStreamWrapper {
+    public:
+        explicit RandomAccessFileStreamAdaptor(std::unique_ptr<RandomAccessFile> file)
+                : io::SeekableInputStreamWrapper(file.get(), kDontTakeOwnership), _file(std::move(file)) {}
+
+    private:
+        std::unique_ptr<RandomAccessFile> _file;
+    };
+
+    const int64_t _latency_us;
+    const int64_t _mb_per_second;
+};
+
+struct BenchConfig {
+    int64_t mem_cache_mb;
+    int64_t disk_cache_mb;
+    int64_t working_set_mb;
+    int64_t object_kb;
+    // The exponent of the zipf distribution of the objects read, in percent, 0 is uniform.
+    int64_t skew_percent;
+    int64_t remote_latency_us;
+
+    int64_t num_objects() const { return std::max<int64_t>(working_set_mb * 1024 / object_kb, 1); }
+    bool same_cache(const BenchConfig& other) const {
+        return mem_cache_mb == other.mem_cache_mb && disk_cache_mb == other.disk_cache_mb;
+    }
+    bool same_data(const BenchConfig& other) const {
+        return same_cache(other) && working_set_mb == other.working_set_mb && object_kb == other.object_kb &&
+               remote_latency_us == other.remote_latency_us;
+    }
+};
+
+// The state shared by the threads of a benchmark, set up by the thread 0 before the others start.
+struct BenchState {
+    std::unique_ptr<BenchConfig> config;
+    std::unique_ptr<RemoteMemoryFileSystem> remote_fs;
+    std::unique_ptr<LatencyHistogram> latencies;
+    std::atomic<int64_t> read_bytes = 0;
+    std::atomic<int64_t> read_mem_cache_bytes = 0;
+    std::atomic<int64_t> read_disk_cache_bytes = 0;
+};
+
+static BenchState g_state;
+
+static std::string object_path(int64_t index) {
+    return fmt::format("{}/object_{}", kRemoteDir, index);
+}
+
+static Status init_cache(const BenchConfig& config) {
+    RETURN_IF_ERROR(BlockCache::instance()->shutdown());
+    std::filesystem::remove_all(kDiskCachePath);
+    std::filesystem::create_directories(kDiskCachePath);
+
+    CacheOptions options;
+    options.mem_space_size = config.mem_cache_mb * kMB;
+    if (config.disk_cache_mb > 0) {
+        options.disk_spaces.push_back(
+                {.path = kDiskCachePath, .size = static_cast<size_t>(config.disk_cache_mb * kMB)});
+    }
+    options.meta_path = kDiskCachePath;
+    options.block_size = kBlockSize;
+    options.engine = "starcache";
+    options.enable_checksum = false;
+    options.enable_tiered_cache = true;
+    options.max_concurrent_inserts = 1500000;
+    options.max_flying_memory_mb = 256;
+    options.skip_read_factor = 1.0;
+    return BlockCache::instance()->init(options);
+}
+
+static Status init_remote_fs(const BenchConfig& config) {
+    g_state.remote_fs = std::make_unique<RemoteMemoryFileSystem>(config.remote_latency_us, 1000);
+    RETURN_IF_ERROR(g_state.remote_fs->create_dir(kRemoteDir));
+    std::string content(config.object_kb * 1024, 'x');
+    for (int64_t i = 0; i < config.num_objects(); i++) {
+        RETURN_IF_ERROR(g_state.remote_fs->append_file(object_path(i), content));
+    }
+    return Status::OK();
+}
+
+static Status setup(const BenchConfig& config) {
+    if (g_state.config == nullptr || !g_state.config->same_data(config)) {
+        // The objects of another working set have the same paths, so the cache is reset with them.
+        RETURN_IF_ERROR(init_cache(config));
+        RETURN_IF_ERROR(init_remote_fs(config));
+    }
+    g_state.config = std::make_unique<BenchConfig>(config);
+    g_state.latencies = std::make_unique<LatencyHistogram>();
+    g_state.read_bytes = 0;
+    g_state.read_mem_cache_bytes = 0;
+    g_state.read_disk_cache_bytes = 0;
+    return Status::OK();
+}
+
+static Status read_object(int64_t index, std::vector<char>* buffer) {
+    const auto& config = *g_state.config;
+    int64_t size = config.object_kb * 1024;
+    const std::string path = object_path(index);
+    ASSIGN_OR_RETURN(auto file, g_state.remote_fs->new_random_access_file(path));
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(file->stream(), path, size);
+    io::CacheInputStream cache_stream(sb_stream, path, size, 0);
+    cache_stream.set_enable_populate_cache(true);
+    buffer->resize(size);
+    RETURN_IF_ERROR(cache_stream.read_at_fully(0, buffer->data(), size));
+
+    g_state.read_bytes.fetch_add(size, std::memory_order_relaxed);
+    g_state.read_mem_cache_bytes.fetch_add(cache_stream.stats().read_mem_cache_bytes, std::memory_order_relaxed);
+    g_state.read_disk_cache_bytes.fetch_add(cache_stream.stats().read_disk_cache_bytes, std::memory_order_relaxed);
+    return Status::OK();
+}
+
+// Args: mem_cache_mb, disk_cache_mb, working_set_mb, object_kb, skew_percent, remote_latency_us.
+static void BM_cache_input_stream_read(benchmark::State& state) {
+    BenchConfig config{state.range(0), state.range(1), state.range(2),
+                       state.range(3), state.range(4), state.range(5)};
+    if (state.thread_index() == 0) {
+        // The other threads can't wait for a failed setup, so it's fatal.
+        Status st = setup(config);
+        CHECK(st.ok()) << st;
+    }
+
+    // The probability of the i-th object is proportional to 1 / (i + 1)^skew.
+    std::vector<double> weights(config.num_objects());
+    for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] = std::pow(static_cast<double>(i + 1), -config.skew_percent / 100.0);
+    }
+    std::discrete_distribution<int64_t> distribution(weights.begin(), weights.end());
+    std::mt19937_64 rng(state.thread_index());
+    std::vector<char> buffer;
+
+    for (auto _ : state) {
+        int64_t index = distribution(rng);
+        MonotonicStopWatch watch;
+        watch.start();
+        Status st = read_object(index, &buffer);
+        g_state.latencies->record(watch.elapsed_time());
+        if (!st.ok()) {
+            state.SkipWithError(st.to_string().c_str());
+            break;
+        }
+    }
+
+    // The other threads have finished their iterations at the end of the loop.
+    if (state.thread_index() == 0) {
+        LatencyHistogram::Snapshot snapshot;
+        g_state.latencies->snapshot(&snapshot);
+        int64_t read_bytes = std::max<int64_t>(g_state.read_bytes.load(), 1);
+        state.SetBytesProcessed(g_state.read_bytes.load());
+        state.counters["p50_us"] = LatencyHistogram::percentile(snapshot, 50) / 1000.0;
+        state.counters["p99_us"] = LatencyHistogram::percentile(snapshot, 99) / 1000.0;
+        state.counters["p999_us"] = LatencyHistogram::percentile(snapshot, 99.9) / 1000.0;
+        state.counters["mem_hit"] = static_cast<double>(g_state.read_mem_cache_bytes.load()) / read_bytes;
+        state.counters["disk_hit"] = static_cast<double>(g_state.read_disk_cache_bytes.load()) / read_bytes;
+    }
+}
+
+static void cache_sizes(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"mem_mb", "disk_mb", "working_set_mb", "object_kb", "skew", "remote_us"});
+    // The working set fits in the memory tier.
+    b->Args({256, 0, 128, 1024, 0, 2000});
+    // The working set fits in the disk tier, the hot objects in the memory tier.
+    b->Args({64, 512, 256, 1024, 99, 2000});
+    // Evictions from both tiers, the hit ratio depends on the skew.
+    b->Args({32, 128, 512, 1024, 0, 2000});
+    b->Args({32, 128, 512, 1024, 99, 2000});
+    b->Args({32, 128, 512, 1024, 120, 2000});
+    // Small objects, partial blocks.
+    b->Args({32, 128, 256, 64, 99, 2000});
+    // A slower remote storage.
+    b->Args({32, 128, 512, 1024, 99, 20000});
+}
+
+BENCHMARK(BM_cache_input_stream_read)->Apply(cache_sizes)->ThreadRange(1, 32)->UseRealTime();
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -484,6 +484,26 @@ static void BM_topn_limit_mergesort_nullable(benchmark::State& state) {
     params.nullable = true;
     do_bench(state, MergeSort, TYPE_INT, state.range(0), state.range(1), params);
 }
+// Sort partial data by the keys of variable length, to tune sort_heap_sorter_limit against
+// sort_heap_sorter_fixed_key_limit.
+static void BM_topn_limit_heapsort_varchar(benchmark::State& state) {
+    do_bench(state, HeapSort, TYPE_VARCHAR, state.range(0), state.range(1), SortParameters::with_limit(state.range(2)));
+}
+static void BM_topn_limit_mergesort_varchar(benchmark::State& state) {
+    do_bench(state, MergeSort, TYPE_VARCHAR, state.range(0), state.range(1),
+             SortParameters::with_limit(state.range(2)));
+}
+// Sort partial data with many duplicated keys.
+static void BM_topn_limit_heapsort_low_card(benchmark::State& state) {
+    SortParameters params = SortParameters::with_limit(state.range(2));
+    params.low_card = true;
+    do_bench(state, HeapSort, TYPE_INT, state.range(0), state.range(1), params);
+}
+static void BM_topn_limit_mergesort_low_card(benchmark::State& state) {
+    SortParameters params = SortParameters::with_limit(state.range(2));
+    params.low_card = true;
+    do_bench(state, MergeSort, TYPE_INT, state.range(0), state.range(1), params);
+}
 static void BM_topn_buffered_chunks(benchmark::State& state) {
     SortParameters params;
     params.max_buffered_chunks = state.range(0);
@@ -544,6 +564,10 @@ BENCHMARK(BM_fullsort_low_card_nullable)->Apply(CustomArgsFull);
 BENCHMARK(BM_topn_limit_heapsort)->Apply(CustomArgsLimit);
 BENCHMARK(BM_topn_limit_mergesort_notnull)->Apply(CustomArgsLimit);
 BENCHMARK(BM_topn_limit_mergesort_nullable)->Apply(CustomArgsLimit);
+BENCHMARK(BM_topn_limit_heapsort_varchar)->Apply(CustomArgsLimit);
+BENCHMARK(BM_topn_limit_mergesort_varchar)->Apply(CustomArgsLimit);
+BENCHMARK(BM_topn_limit_heapsort_low_card)->Apply(CustomArgsLimit);
+BENCHMARK(BM_topn_limit_mergesort_low_card)->Apply(CustomArgsLimit);
 
 // Tunning the parameter buffered_chunks of TopN
 BENCHMARK(BM_topn_buffered_chunks)->RangeMultiplier(4)->Ranges({{10, 10'000}, {100, 100'000}});
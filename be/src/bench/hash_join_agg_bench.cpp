@@ -0,0 +1,388 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the hash tables of the hash join and the aggregation, driven by the chunks of the synthetic keys of
+// different distributions. Each key schema is chosen to hit a specialization of JoinHashMapType or
+// AggHashMapVariant. Run with --benchmark_format=json to compare the results across commits.
+
+#include <benchmark/benchmark.h>
+#include <testutil/assert.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/object_pool.h"
+#include "exec/aggregate/agg_hash_variant.h"
+#include "exec/join_hash_map.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/mem_pool.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks {
+
+enum class KeyDistribution { UNIFORM, ZIPF, SORTED };
+
+// The schemas of the keys.
+enum class KeyType {
+    INT32,        // join: key32, agg: int32
+    INT64,        // join: key64, agg: int64
+    STRING,       // join: keystring, agg: string, high ndv strings
+    INT32_INT32,  // join: fixed64, agg: slice_fx8
+    INT32_STRING, // join: slice, agg: slice
+};
+
+static constexpr int kChunkSize = 4096;
+// One of this many keys is null for the nullable keys.
+static constexpr int kNullInterval = 100;
+
+// Generates the key ids in [0, ndv) of a distribution.
+class KeyGenerator {
+public:
+    KeyGenerator(KeyDistribution distribution, int64_t ndv)
+            : _distribution(distribution), _ndv(ndv), _rng(ndv), _uniform(0, ndv - 1) {
+        if (_distribution == KeyDistribution::ZIPF) {
+            // The key of rank i appears with the probability proportional to 1 / (i + 1) ^ 1.1.
+            _zipf_cdf.resize(ndv);
+            double sum = 0;
+            for (int64_t i = 0; i < ndv; i++) {
+                sum += 1.0 / std::pow(i + 1, 1.1);
+                _zipf_cdf[i] = sum;
+            }
+            for (auto& p : _zipf_cdf) {
+                p /= sum;
+            }
+        }
+    }
+
+    int64_t next() {
+        switch (_distribution) {
+        case KeyDistribution::UNIFORM:
+            return _uniform(_rng);
+        case KeyDistribution::ZIPF: {
+            double p = std::uniform_real_distribution<double>(0, 1)(_rng);
+            auto it = std::lower_bound(_zipf_cdf.begin(), _zipf_cdf.end(), p);
+            return std::min<int64_t>(it - _zipf_cdf.begin(), _ndv - 1);
+        }
+        case KeyDistribution::SORTED:
+            return _next_sorted++ % _ndv;
+        }
+        return 0;
+    }
+
+private:
+    const KeyDistribution _distribution;
+    const int64_t _ndv;
+    std::mt19937_64 _rng;
+    std::uniform_int_distribution<int64_t> _uniform;
+    std::vector<double> _zipf_cdf;
+    int64_t _next_sorted = 0;
+};
+
+static std::vector<TypeDescriptor> key_types_of(KeyType key_type) {
+    switch (key_type) {
+    case KeyType::INT32:
+        return {TypeDescriptor(TYPE_INT)};
+    case KeyType::INT64:
+        return {TypeDescriptor(TYPE_BIGINT)};
+    case KeyType::STRING:
+        return {TypeDescriptor::create_varchar_type(64)};
+    case KeyType::INT32_INT32:
+        return {TypeDescriptor(TYPE_INT), TypeDescriptor(TYPE_INT)};
+    case KeyType::INT32_STRING:
+        return {TypeDescriptor(TYPE_INT), TypeDescriptor::create_varchar_type(64)};
+    }
+    return {};
+}
+
+// Appends the key of |id| to |columns|, the key columns of |key_type|.
+static void append_key(KeyType key_type, int64_t id, bool is_null, Columns* columns) {
+    if (is_null) {
+        for (auto& column : *columns) {
+            column->append_nulls(1);
+        }
+        return;
+    }
+    // Long enough strings with a common prefix, like the ids or the urls.
+    auto to_string = [](int64_t id) { return fmt::format("starrocks_key_{:016d}", id); };
+    switch (key_type) {
+    case KeyType::INT32:
+        (*columns)[0]->append_datum(Datum(static_cast<int32_t>(id)));
+        break;
+    case KeyType::INT64:
+        (*columns)[0]->append_datum(Datum(id * 1000003));
+        break;
+    case KeyType::STRING: {
+        std::string s = to_string(id);
+        (*columns)[0]->append_datum(Datum(Slice(s)));
+        break;
+    }
+    case KeyType::INT32_INT32:
+        (*columns)[0]->append_datum(Datum(static_cast<int32_t>(id / 1024)));
+        (*columns)[1]->append_datum(Datum(static_cast<int32_t>(id % 1024)));
+        break;
+    case KeyType::INT32_STRING: {
+        std::string s = to_string(id / 16);
+        (*columns)[0]->append_datum(Datum(static_cast<int32_t>(id % 16)));
+        (*columns)[1]->append_datum(Datum(Slice(s)));
+        break;
+    }
+    }
+}
+
+// Generates the key columns of |num_rows| rows, split into chunks.
+static std::vector<Columns> generate_keys(KeyType key_type, bool nullable, int64_t num_rows,
+                                          const std::function<int64_t(int64_t)>& next_id) {
+    auto types = key_types_of(key_type);
+    std::vector<Columns> chunks;
+    for (int64_t start = 0; start < num_rows; start += kChunkSize) {
+        Columns columns;
+        for (const auto& type : types) {
+            columns.emplace_back(ColumnHelper::create_column(type, nullable));
+        }
+        for (int64_t i = start; i < std::min<int64_t>(start + kChunkSize, num_rows); i++) {
+            int64_t id = next_id(i);
+            append_key(key_type, id, nullable && i % kNullInterval == 0, &columns);
+        }
+        chunks.emplace_back(std::move(columns));
+    }
+    return chunks;
+}
+
+// Joins a build side of range(0) distinct keys with a probe side of 1M rows. The probe keys of the distribution are
+// drawn from twice as many keys as the build side, so about half of the probe rows match.
+static void do_join_bench(benchmark::State& state, KeyType key_type, KeyDistribution distribution, bool nullable) {
+    const int64_t num_build_rows = state.range(0);
+    const int64_t num_probe_rows = 1 << 20;
+    auto key_types = key_types_of(key_type);
+    const size_t num_keys = key_types.size();
+
+    TUniqueId fragment_id;
+    TQueryOptions query_options;
+    query_options.batch_size = kChunkSize;
+    TQueryGlobals query_globals;
+    RuntimeState runtime_state(fragment_id, query_options, query_globals, nullptr);
+    runtime_state.init_instance_mem_tracker();
+    ObjectPool pool;
+    RuntimeProfile profile("bench");
+
+    // The probe tuple and the build tuple both have the key columns and an int payload column.
+    TDescriptorTableBuilder desc_tbl_builder;
+    for (int tuple = 0; tuple < 2; tuple++) {
+        TTupleDescriptorBuilder tuple_builder;
+        for (size_t i = 0; i < num_keys; i++) {
+            tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                           .type(key_types[i])
+                                           .column_name("k" + std::to_string(i))
+                                           .column_pos(i)
+                                           .nullable(nullable)
+                                           .build());
+        }
+        tuple_builder.add_slot(
+                TSlotDescriptorBuilder().type(TYPE_INT).column_name("v").column_pos(num_keys).nullable(false).build());
+        tuple_builder.build(&desc_tbl_builder);
+    }
+    DescriptorTbl* desc_tbl = nullptr;
+    ASSERT_OK(DescriptorTbl::create(&runtime_state, &pool, desc_tbl_builder.desc_tbl(), &desc_tbl, kChunkSize));
+    RowDescriptor probe_row_desc(*desc_tbl, std::vector<TTupleId>{0});
+    RowDescriptor build_row_desc(*desc_tbl, std::vector<TTupleId>{1});
+
+    HashTableParam param;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.probe_row_desc = &probe_row_desc;
+    param.build_row_desc = &build_row_desc;
+    const auto& probe_slots = probe_row_desc.tuple_descriptors()[0]->slots();
+    const auto& build_slots = build_row_desc.tuple_descriptors()[0]->slots();
+    for (auto* slot : probe_slots) {
+        param.probe_output_slots.emplace(slot->id());
+    }
+    for (auto* slot : build_slots) {
+        param.build_output_slots.emplace(slot->id());
+    }
+    for (size_t i = 0; i < num_keys; i++) {
+        param.join_keys.emplace_back(JoinKeyDesc{&key_types[i], false, nullptr});
+    }
+    param.search_ht_timer = ADD_TIMER(&profile, "SearchHashTableTime");
+    param.output_build_column_timer = ADD_TIMER(&profile, "OutputBuildColumnTime");
+    param.output_probe_column_timer = ADD_TIMER(&profile, "OutputProbeColumnTime");
+    param.probe_counter = ADD_COUNTER(&profile, "probeCount", TUnit::UNIT);
+
+    auto make_chunks = [&](const std::vector<Columns>& keys, const std::vector<SlotDescriptor*>& slots) {
+        std::vector<ChunkPtr> chunks;
+        for (const auto& key_columns : keys) {
+            auto chunk = std::make_shared<Chunk>();
+            for (size_t i = 0; i < num_keys; i++) {
+                chunk->append_column(key_columns[i], slots[i]->id());
+            }
+            auto payload = Int32Column::create();
+            payload->resize(key_columns[0]->size());
+            chunk->append_column(std::move(payload), slots[num_keys]->id());
+            chunks.emplace_back(std::move(chunk));
+        }
+        return chunks;
+    };
+
+    // The build keys are distinct, sorted or shuffled.
+    std::vector<int64_t> build_ids(num_build_rows);
+    std::iota(build_ids.begin(), build_ids.end(), 0);
+    if (distribution != KeyDistribution::SORTED) {
+        std::shuffle(build_ids.begin(), build_ids.end(), std::mt19937_64(num_build_rows));
+    }
+    auto build_chunks = make_chunks(
+            generate_keys(key_type, nullable, num_build_rows, [&](int64_t i) { return build_ids[i]; }), build_slots);
+    KeyGenerator probe_generator(distribution, num_build_rows * 2);
+    auto probe_chunks = make_chunks(
+            generate_keys(key_type, nullable, num_probe_rows, [&](int64_t) { return probe_generator.next(); }),
+            probe_slots);
+
+    int64_t num_output_rows = 0;
+    for (auto _ : state) {
+        JoinHashTable hash_table;
+        hash_table.create(param);
+        for (const auto& chunk : build_chunks) {
+            Columns key_columns(chunk->columns().begin(), chunk->columns().begin() + num_keys);
+            hash_table.append_chunk(chunk, key_columns);
+        }
+        ASSERT_OK(hash_table.build(&runtime_state));
+
+        for (const auto& chunk : probe_chunks) {
+            Columns key_columns(chunk->columns().begin(), chunk->columns().begin() + num_keys);
+            ChunkPtr probe_chunk = chunk;
+            bool has_remain = true;
+            while (has_remain) {
+                auto result_chunk = std::make_shared<Chunk>();
+                ASSERT_OK(hash_table.probe(&runtime_state, key_columns, &probe_chunk, &result_chunk, &has_remain));
+                num_output_rows += result_chunk->num_rows();
+            }
+        }
+        hash_table.close();
+    }
+    state.SetItemsProcessed(state.iterations() * (num_build_rows + num_probe_rows));
+    state.counters["output_rows"] = benchmark::Counter(num_output_rows, benchmark::Counter::kAvgIterations);
+}
+
+static AggHashMapVariant::Type agg_hash_map_type_of(KeyType key_type, bool nullable) {
+    using Type = AggHashMapVariant::Type;
+    switch (key_type) {
+    case KeyType::INT32:
+        return nullable ? Type::phase1_null_int32 : Type::phase1_int32;
+    case KeyType::INT64:
+        return nullable ? Type::phase1_null_int64 : Type::phase1_int64;
+    case KeyType::STRING:
+        return nullable ? Type::phase1_null_string : Type::phase1_string;
+    case KeyType::INT32_INT32:
+        // Two int32 keys take 8 bytes, plus a byte for the nulls if they are nullable.
+        return nullable ? Type::phase1_slice_fx16 : Type::phase1_slice_fx8;
+    case KeyType::INT32_STRING:
+        return Type::phase1_slice;
+    }
+    return Type::phase1_slice;
+}
+
+// Aggregates 1M rows of the keys of the distribution into range(0) groups at most.
+static void do_agg_bench(benchmark::State& state, KeyType key_type, KeyDistribution distribution, bool nullable,
+                         bool two_level = false) {
+    const int64_t ndv = state.range(0);
+    const int64_t num_rows = 1 << 20;
+
+    KeyGenerator generator(distribution, ndv);
+    auto chunks = generate_keys(key_type, nullable, num_rows, [&](int64_t) { return generator.next(); });
+
+    RuntimeState runtime_state;
+    auto type = agg_hash_map_type_of(key_type, nullable);
+    if (two_level) {
+        type = key_type == KeyType::INT32 ? AggHashMapVariant::Type::phase1_int32_two_level
+                                          : AggHashMapVariant::Type::phase1_slice_two_level;
+    }
+
+    int64_t num_groups = 0;
+    for (auto _ : state) {
+        RuntimeProfile profile("bench");
+        AggStatistics agg_stat(&profile);
+        MemPool mem_pool;
+        AggHashMapVariant variant;
+        variant.init(&runtime_state, type, &agg_stat);
+        variant.visit([&](auto& hash_map_with_key) {
+            if constexpr (is_combined_fixed_size_key<std::decay_t<decltype(*hash_map_with_key)>>) {
+                hash_map_with_key->has_null_column = nullable;
+                hash_map_with_key->fixed_byte_size = nullable ? 0 : 8;
+            }
+        });
+
+        // Each group has a state of a sum and a count.
+        Buffer<AggDataPtr> agg_states(kChunkSize);
+        auto allocate_func = [&mem_pool](auto& key) { return mem_pool.allocate_aligned(16, 16); };
+        for (const auto& key_columns : chunks) {
+            variant.visit([&](auto& hash_map_with_key) {
+                hash_map_with_key->build_hash_map(key_columns[0]->size(), key_columns, &mem_pool, allocate_func,
+                                                  &agg_states);
+            });
+        }
+        num_groups += variant.size();
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+    state.counters["groups"] = benchmark::Counter(num_groups, benchmark::Counter::kAvgIterations);
+}
+
+#define JOIN_BENCH(NAME, KEY_TYPE, DISTRIBUTION, NULLABLE)                                                  \
+    static void BM_join_##NAME(benchmark::State& state) {                                                   \
+        do_join_bench(state, KeyType::KEY_TYPE, KeyDistribution::DISTRIBUTION, NULLABLE);                   \
+    }                                                                                                       \
+    BENCHMARK(BM_join_##NAME)->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMillisecond);
+
+JOIN_BENCH(int32_uniform, INT32, UNIFORM, false)
+JOIN_BENCH(int32_zipf, INT32, ZIPF, false)
+JOIN_BENCH(int32_sorted, INT32, SORTED, false)
+JOIN_BENCH(int32_nullable, INT32, UNIFORM, true)
+JOIN_BENCH(int64_uniform, INT64, UNIFORM, false)
+JOIN_BENCH(int64_zipf, INT64, ZIPF, false)
+JOIN_BENCH(string_uniform, STRING, UNIFORM, false)
+JOIN_BENCH(string_zipf, STRING, ZIPF, false)
+JOIN_BENCH(string_nullable, STRING, UNIFORM, true)
+JOIN_BENCH(int32_int32_uniform, INT32_INT32, UNIFORM, false)
+JOIN_BENCH(int32_int32_nullable, INT32_INT32, UNIFORM, true)
+JOIN_BENCH(int32_string_uniform, INT32_STRING, UNIFORM, false)
+
+#define AGG_BENCH(NAME, KEY_TYPE, DISTRIBUTION, NULLABLE, TWO_LEVEL)                                      \
+    static void BM_agg_##NAME(benchmark::State& state) {                                                  \
+        do_agg_bench(state, KeyType::KEY_TYPE, KeyDistribution::DISTRIBUTION, NULLABLE, TWO_LEVEL);       \
+    }                                                                                                     \
+    BENCHMARK(BM_agg_##NAME)->RangeMultiplier(32)->Range(1 << 5, 1 << 20)->Unit(benchmark::kMillisecond);
+
+AGG_BENCH(int32_uniform, INT32, UNIFORM, false, false)
+AGG_BENCH(int32_zipf, INT32, ZIPF, false, false)
+AGG_BENCH(int32_sorted, INT32, SORTED, false, false)
+AGG_BENCH(int32_nullable, INT32, UNIFORM, true, false)
+AGG_BENCH(int32_two_level, INT32, UNIFORM, false, true)
+AGG_BENCH(int64_uniform, INT64, UNIFORM, false, false)
+AGG_BENCH(int64_zipf, INT64, ZIPF, false, false)
+AGG_BENCH(string_uniform, STRING, UNIFORM, false, false)
+AGG_BENCH(string_zipf, STRING, ZIPF, false, false)
+AGG_BENCH(string_nullable, STRING, UNIFORM, true, false)
+AGG_BENCH(int32_int32_uniform, INT32_INT32, UNIFORM, false, false)
+AGG_BENCH(int32_int32_nullable, INT32_INT32, UNIFORM, true, false)
+AGG_BENCH(int32_string_uniform, INT32_STRING, UNIFORM, false, false)
+AGG_BENCH(int32_string_two_level, INT32_STRING, UNIFORM, false, true)
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -0,0 +1,268 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the read path of the storage: SegmentIterator, the page decoders and the predicate pushdown.
+// The segments are written by SegmentWriter into the memory file system, so the results measure the decompression,
+// the decoding and the filtering without the noise of the disk. The encoding of a column is chosen by ColumnWriter
+// from its data, the low cardinality columns are dict encoded and the high cardinality ones are not.
+
+#include <benchmark/benchmark.h>
+#include <testutil/assert.h>
+
+#include <fmt/format.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <tuple>
+
+#include "column/chunk.h"
+#include "column/datum.h"
+#include "fs/fs_memory.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/chunk_iterator.h"
+#include "storage/column_predicate.h"
+#include "storage/olap_common.h"
+#include "storage/page_cache.h"
+#include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+#include "storage/types.h"
+
+namespace starrocks {
+
+static constexpr int kNumRows = 1 << 20;
+static constexpr int kChunkSize = 4096;
+static const std::string kSegmentDir = "/segment_scan_bench";
+
+// The columns of the benchmark table:
+//   c0 INT key, the row id.
+//   c1 INT, uniform in [0, cardinality).
+//   c2 VARCHAR, the zero padded c1, so its order is the same as c1.
+//   c3 BIGINT, random.
+// The value columns are nullable, null_percent% of the rows of them are null.
+static constexpr ColumnId kIntColumn = 1;
+static constexpr ColumnId kStringColumn = 2;
+
+static ColumnPB create_column_pb(int32_t id, const std::string& type, int32_t length, bool is_key) {
+    ColumnPB col;
+    col.set_unique_id(id);
+    col.set_name(fmt::format("c{}", id));
+    col.set_type(type);
+    col.set_is_key(is_key);
+    col.set_is_nullable(!is_key);
+    col.set_length(length);
+    col.set_index_length(type == "VARCHAR" ? 0 : length);
+    if (!is_key) {
+        col.set_aggregation("NONE");
+    }
+    return col;
+}
+
+static TabletSchemaCSPtr create_tablet_schema() {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+    *schema_pb.add_column() = create_column_pb(0, "INT", 4, true);
+    *schema_pb.add_column() = create_column_pb(1, "INT", 4, false);
+    *schema_pb.add_column() = create_column_pb(2, "VARCHAR", 64, false);
+    *schema_pb.add_column() = create_column_pb(3, "BIGINT", 8, false);
+    return TabletSchema::create(schema_pb);
+}
+
+static std::string string_value(int32_t v) {
+    return fmt::format("{:016d}", v);
+}
+
+class SegmentScanBench {
+public:
+    // Returns the segment of |cardinality| and |null_percent|, written at the first use.
+    static SegmentScanBench* get(int32_t cardinality, int null_percent) {
+        static std::map<std::tuple<int32_t, int>, std::unique_ptr<SegmentScanBench>> benches;
+        auto& bench = benches[{cardinality, null_percent}];
+        if (bench == nullptr) {
+            bench = std::make_unique<SegmentScanBench>();
+            CHECK_OK(bench->_write(cardinality, null_percent));
+        }
+        return bench.get();
+    }
+
+    // Scans |columns| of the segment, filtered by |pred| if not null. Returns the number of the rows read.
+    StatusOr<int64_t> scan(const std::vector<ColumnId>& columns, const ColumnPredicate* pred, bool use_page_cache,
+                           OlapReaderStatistics* stats) {
+        auto schema = ChunkHelper::convert_schema(_tablet_schema, columns);
+        SegmentReadOptions opts;
+        opts.fs = _fs;
+        opts.stats = stats;
+        opts.tablet_schema = _tablet_schema;
+        opts.use_page_cache = use_page_cache;
+        opts.chunk_size = kChunkSize;
+        if (pred != nullptr) {
+            PredicateAndNode pred_root;
+            pred_root.add_child(PredicateColumnNode{pred});
+            opts.pred_tree = PredicateTree::create(std::move(pred_root));
+        }
+        ASSIGN_OR_RETURN(auto iter, _segment->new_iterator(schema, opts));
+        auto chunk = ChunkHelper::new_chunk(schema, kChunkSize);
+        int64_t num_rows = 0;
+        while (true) {
+            chunk->reset();
+            auto st = iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            RETURN_IF_ERROR(st);
+            num_rows += chunk->num_rows();
+        }
+        iter->close();
+        return num_rows;
+    }
+
+private:
+    Status _write(int32_t cardinality, int null_percent) {
+        _fs = std::make_shared<MemoryFileSystem>();
+        RETURN_IF_ERROR(_fs->create_dir(kSegmentDir));
+        _tablet_schema = create_tablet_schema();
+
+        auto file_name = fmt::format("{}/{}_{}.dat", kSegmentDir, cardinality, null_percent);
+        ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(file_name));
+        SegmentWriter writer(std::move(wfile), 0, _tablet_schema, SegmentWriterOptions{});
+        RETURN_IF_ERROR(writer.init());
+
+        std::mt19937 rng(cardinality);
+        std::uniform_int_distribution<int32_t> value_dist(0, cardinality - 1);
+        std::uniform_int_distribution<int> null_dist(0, 99);
+        auto schema = ChunkHelper::convert_schema(_tablet_schema);
+        auto chunk = ChunkHelper::new_chunk(schema, kChunkSize);
+        for (int i = 0; i < kNumRows; i += kChunkSize) {
+            chunk->reset();
+            auto& cols = chunk->columns();
+            for (int j = i; j < i + kChunkSize; j++) {
+                cols[0]->append_datum(Datum(static_cast<int32_t>(j)));
+                if (null_dist(rng) < null_percent) {
+                    cols[1]->append_nulls(1);
+                    cols[2]->append_nulls(1);
+                    cols[3]->append_nulls(1);
+                } else {
+                    int32_t v = value_dist(rng);
+                    std::string s = string_value(v);
+                    cols[1]->append_datum(Datum(v));
+                    cols[2]->append_datum(Datum(Slice(s)));
+                    cols[3]->append_datum(Datum(static_cast<int64_t>(rng())));
+                }
+            }
+            RETURN_IF_ERROR(writer.append_chunk(*chunk));
+        }
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        RETURN_IF_ERROR(writer.finalize(&file_size, &index_size, &footer_position));
+        ASSIGN_OR_RETURN(_segment, Segment::open(_fs, FileInfo{file_name}, 0, _tablet_schema));
+        return Status::OK();
+    }
+
+    std::shared_ptr<MemoryFileSystem> _fs;
+    TabletSchemaCSPtr _tablet_schema;
+    std::shared_ptr<Segment> _segment;
+};
+
+static void init_page_cache() {
+    static MemTracker mem_tracker;
+    StoragePageCache::create_global_cache(&mem_tracker, 4L * 1024 * 1024 * 1024);
+}
+
+static void do_scan_bench(benchmark::State& state, SegmentScanBench* bench, const std::vector<ColumnId>& columns,
+                          const ColumnPredicate* pred, bool use_page_cache) {
+    init_page_cache();
+    if (use_page_cache) {
+        // Warm up the page cache.
+        OlapReaderStatistics stats;
+        CHECK_OK(bench->scan(columns, pred, true, &stats).status());
+    }
+
+    OlapReaderStatistics stats;
+    int64_t num_rows = 0;
+    for (auto _ : state) {
+        ASSIGN_OR_ABORT(num_rows, bench->scan(columns, pred, use_page_cache, &stats));
+    }
+    state.SetItemsProcessed(state.iterations() * kNumRows);
+    state.counters["rows_returned"] = num_rows;
+    state.counters["bytes_decompressed"] =
+            benchmark::Counter(stats.uncompressed_bytes_read, benchmark::Counter::kAvgIterations);
+    state.counters["cached_pages"] =
+            benchmark::Counter(stats.cached_pages_num, benchmark::Counter::kAvgIterations);
+}
+
+// Scans all the columns without predicate.
+// Args: cardinality, null percent, whether to use the page cache.
+static void BM_full_scan(benchmark::State& state) {
+    auto* bench = SegmentScanBench::get(state.range(0), state.range(1));
+    do_scan_bench(state, bench, {0, 1, 2, 3}, nullptr, state.range(2));
+}
+
+// Scans all the columns filtered by c1 < cardinality * selectivity%. The other columns are read after the predicate
+// is evaluated, only for the selected rows.
+// Args: cardinality, selectivity in percent, whether to use the page cache.
+static void BM_int_predicate_scan(benchmark::State& state) {
+    int32_t cardinality = state.range(0);
+    auto* bench = SegmentScanBench::get(cardinality, 10);
+    auto bound = std::to_string(static_cast<int64_t>(cardinality) * state.range(1) / 100);
+    std::unique_ptr<ColumnPredicate> pred(new_column_lt_predicate(get_type_info(TYPE_INT), kIntColumn, bound));
+    do_scan_bench(state, bench, {0, 1, 2, 3}, pred.get(), state.range(2));
+}
+
+// Like BM_int_predicate_scan, but only reads the predicate column, as the baseline of the late materialization.
+static void BM_int_predicate_only_scan(benchmark::State& state) {
+    int32_t cardinality = state.range(0);
+    auto* bench = SegmentScanBench::get(cardinality, 10);
+    auto bound = std::to_string(static_cast<int64_t>(cardinality) * state.range(1) / 100);
+    std::unique_ptr<ColumnPredicate> pred(new_column_lt_predicate(get_type_info(TYPE_INT), kIntColumn, bound));
+    do_scan_bench(state, bench, {kIntColumn}, pred.get(), state.range(2));
+}
+
+// Scans all the columns filtered by c2 < string(cardinality * selectivity%). The predicate of a dict encoded column
+// is evaluated on the dict codes.
+// Args: cardinality, selectivity in percent, whether to use the page cache.
+static void BM_string_predicate_scan(benchmark::State& state) {
+    int32_t cardinality = state.range(0);
+    auto* bench = SegmentScanBench::get(cardinality, 10);
+    auto bound = string_value(static_cast<int64_t>(cardinality) * state.range(1) / 100);
+    std::unique_ptr<ColumnPredicate> pred(
+            new_column_lt_predicate(get_type_info(TYPE_VARCHAR), kStringColumn, Slice(bound)));
+    do_scan_bench(state, bench, {0, 1, 2, 3}, pred.get(), state.range(2));
+}
+
+// 100 is dict encoded, 1M is not.
+#define CARDINALITIES {100, 1 << 20}
+#define SELECTIVITIES {1, 10, 50, 100}
+
+BENCHMARK(BM_full_scan)
+        ->ArgsProduct({CARDINALITIES, {0, 10, 50}, {0, 1}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_int_predicate_scan)
+        ->ArgsProduct({CARDINALITIES, SELECTIVITIES, {0, 1}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_int_predicate_only_scan)
+        ->ArgsProduct({CARDINALITIES, SELECTIVITIES, {0, 1}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_string_predicate_scan)
+        ->ArgsProduct({CARDINALITIES, SELECTIVITIES, {0, 1}})
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -22,6 +22,7 @@
 #include "common/logging.h"
 #include "common/statusor.h"
 #include "gutil/strings/substitute.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks {
 
@@ -31,6 +32,29 @@ namespace fs = std::filesystem;
 // block_size may cause heavy read amplification. So, we also limit it to 2 MB as an empirical value.
 const size_t BlockCache::MAX_BLOCK_SIZE = 2 * 1024 * 1024;
 
+BlockCache::CacheKey BlockCache::file_cache_key(const std::string& filename, int64_t file_size,
+                                                int64_t modification_time) {
+    CacheKey cache_key;
+    cache_key.resize(12);
+
+    char* data = cache_key.data();
+    uint64_t hash_value = HashUtil::hash64(filename.data(), filename.size(), 0);
+    memcpy(data, &hash_value, sizeof(hash_value));
+    // The modification time is more appropriate to indicate the different file versions.
+    // While some data source, such as Hudi, have no modification time because their files
+    // cannot be overwritten. So, if the modification time is unsupported, we use file size instead.
+    // Usually the last modification timestamp has 41 bits, to reduce memory usage, we ignore the tail 9
+    // bytes and choose the high 32 bits to represent the second timestamp.
+    if (modification_time > 0) {
+        uint32_t mtime_s = (modification_time >> 9) & 0x00000000FFFFFFFF;
+        memcpy(data + 8, &mtime_s, sizeof(mtime_s));
+    } else {
+        uint32_t size = file_size;
+        memcpy(data + 8, &size, sizeof(size));
+    }
+    return cache_key;
+}
+
 BlockCache* BlockCache::instance() {
     static BlockCache cache;
     return &cache;
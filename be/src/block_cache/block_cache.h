@@ -32,6 +32,9 @@ public:
 
     ~BlockCache();
 
+    // Build the cache key of a remote file, different versions of the same file get different keys.
+    static CacheKey file_cache_key(const std::string& filename, int64_t file_size, int64_t modification_time);
+
     // Init the block cache instance
     Status init(const CacheOptions& options);
 
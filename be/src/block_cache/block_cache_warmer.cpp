@@ -0,0 +1,318 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/block_cache_warmer.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "block_cache/block_cache.h"
+#include "common/config.h"
+#include "common/logging.h"
+#include "fs/fs.h"
+#include "gutil/strings/substitute.h"
+#include "util/monotime.h"
+#include "util/thread.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+BlockCacheWarmer* BlockCacheWarmer::instance() {
+    static BlockCacheWarmer warmer(BlockCache::instance());
+    return &warmer;
+}
+
+BlockCacheWarmer::~BlockCacheWarmer() {
+    stop_warmup();
+}
+
+const char* BlockCacheWarmer::state_name(State state) {
+    switch (state) {
+    case State::IDLE:
+        return "IDLE";
+    case State::RUNNING:
+        return "RUNNING";
+    case State::FINISHED:
+        return "FINISHED";
+    case State::CANCELLED:
+        return "CANCELLED";
+    }
+    return "UNKNOWN";
+}
+
+void BlockCacheWarmer::record_access(const std::string& filename, int64_t file_size, int64_t modification_time,
+                                     const std::vector<int64_t>& block_offsets) {
+    if (config::datacache_warmup_history_capacity <= 0 || block_offsets.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> l(_history_mutex);
+    for (int64_t offset : block_offsets) {
+        _record_locked(filename, file_size, modification_time, offset, 1);
+    }
+}
+
+void BlockCacheWarmer::_record_locked(const std::string& filename, int64_t file_size, int64_t modification_time,
+                                      int64_t offset, uint32_t hits) {
+    auto& file = _history[filename];
+    if (file.file_size != file_size || file.modification_time != modification_time) {
+        // The file has been rewritten, the history of its old version is useless.
+        _history_blocks -= file.block_hits.size();
+        file.block_hits.clear();
+        file.file_size = file_size;
+        file.modification_time = modification_time;
+    }
+    auto [iter, inserted] = file.block_hits.emplace(offset, 0);
+    iter->second += hits;
+    if (inserted && ++_history_blocks > static_cast<size_t>(config::datacache_warmup_history_capacity)) {
+        _decay_locked();
+    }
+}
+
+void BlockCacheWarmer::_decay_locked() {
+    size_t capacity = std::max<int64_t>(config::datacache_warmup_history_capacity, 1);
+    while (_history_blocks > capacity) {
+        for (auto file_iter = _history.begin(); file_iter != _history.end();) {
+            auto& block_hits = file_iter->second.block_hits;
+            for (auto iter = block_hits.begin(); iter != block_hits.end();) {
+                iter->second >>= 1;
+                if (iter->second == 0) {
+                    iter = block_hits.erase(iter);
+                    --_history_blocks;
+                } else {
+                    ++iter;
+                }
+            }
+            file_iter = block_hits.empty() ? _history.erase(file_iter) : std::next(file_iter);
+        }
+    }
+}
+
+std::vector<BlockCacheWarmer::BlockAccess> BlockCacheWarmer::top_blocks(size_t k) const {
+    std::vector<BlockAccess> blocks;
+    {
+        std::lock_guard<std::mutex> l(_history_mutex);
+        blocks.reserve(_history_blocks);
+        for (const auto& [filename, file] : _history) {
+            for (const auto& [offset, hits] : file.block_hits) {
+                blocks.push_back({filename, file.file_size, file.modification_time, offset, hits});
+            }
+        }
+    }
+    k = std::min(k, blocks.size());
+    std::partial_sort(blocks.begin(), blocks.begin() + k, blocks.end(),
+                      [](const BlockAccess& lhs, const BlockAccess& rhs) { return lhs.hits > rhs.hits; });
+    blocks.resize(k);
+    return blocks;
+}
+
+size_t BlockCacheWarmer::history_size() const {
+    std::lock_guard<std::mutex> l(_history_mutex);
+    return _history_blocks;
+}
+
+void BlockCacheWarmer::clear_history() {
+    std::lock_guard<std::mutex> l(_history_mutex);
+    _history.clear();
+    _history_blocks = 0;
+}
+
+Status BlockCacheWarmer::save_history(const std::string& path) const {
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::trunc);
+        if (!out) {
+            return Status::IOError(strings::Substitute("failed to open datacache access history file $0", tmp_path));
+        }
+        std::lock_guard<std::mutex> l(_history_mutex);
+        for (const auto& [filename, file] : _history) {
+            for (const auto& [offset, hits] : file.block_hits) {
+                out << hits << '\t' << file.file_size << '\t' << file.modification_time << '\t' << offset << '\t'
+                    << filename << '\n';
+            }
+        }
+        if (!out.flush()) {
+            return Status::IOError(strings::Substitute("failed to write datacache access history file $0", tmp_path));
+        }
+    }
+    if (::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        return Status::IOError(strings::Substitute("failed to rename $0 to $1", tmp_path, path));
+    }
+    return Status::OK();
+}
+
+Status BlockCacheWarmer::load_history(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        return Status::NotFound(strings::Substitute("datacache access history file $0 not found", path));
+    }
+    std::string line;
+    size_t lineno = 0;
+    std::lock_guard<std::mutex> l(_history_mutex);
+    while (std::getline(in, line)) {
+        ++lineno;
+        std::istringstream fields(line);
+        uint32_t hits = 0;
+        int64_t file_size = 0;
+        int64_t modification_time = 0;
+        int64_t offset = 0;
+        std::string filename;
+        if (!(fields >> hits >> file_size >> modification_time >> offset) || fields.get() != '\t' ||
+            !std::getline(fields, filename) || filename.empty()) {
+            return Status::Corruption(strings::Substitute("bad datacache access history at $0:$1", path, lineno));
+        }
+        _record_locked(filename, file_size, modification_time, offset, hits);
+    }
+    return Status::OK();
+}
+
+Status BlockCacheWarmer::start_warmup(size_t top_k, int64_t rate_limit_bytes) {
+    std::lock_guard<std::mutex> l(_warmup_mutex);
+    if (_state.load() == State::RUNNING) {
+        return Status::AlreadyExist("datacache warmup is already running");
+    }
+    if (!_cache->available()) {
+        return Status::ServiceUnavailable("datacache is not available");
+    }
+    if (_warmup_thread.joinable()) {
+        _warmup_thread.join();
+    }
+
+    auto blocks = top_blocks(top_k);
+    // Warm the blocks file by file in offset order, so every file is opened only once and read sequentially.
+    std::sort(blocks.begin(), blocks.end(), [](const BlockAccess& lhs, const BlockAccess& rhs) {
+        return lhs.filename != rhs.filename ? lhs.filename < rhs.filename : lhs.offset < rhs.offset;
+    });
+
+    _cancelled.store(false);
+    _total_blocks.store(blocks.size());
+    _finished_blocks.store(0);
+    _skipped_blocks.store(0);
+    _failed_blocks.store(0);
+    _warmed_bytes.store(0);
+    _start_ns.store(MonotonicNanos());
+    _end_ns.store(0);
+    _state.store(State::RUNNING);
+    _warmup_thread = std::thread(&BlockCacheWarmer::_run_warmup, this, std::move(blocks), rate_limit_bytes);
+    Thread::set_thread_name(_warmup_thread, "dcache_warmup");
+    return Status::OK();
+}
+
+void BlockCacheWarmer::stop_warmup() {
+    std::lock_guard<std::mutex> l(_warmup_mutex);
+    _cancelled.store(true);
+    if (_warmup_thread.joinable()) {
+        _warmup_thread.join();
+    }
+}
+
+BlockCacheWarmer::Progress BlockCacheWarmer::progress() const {
+    Progress progress;
+    progress.state = _state.load();
+    progress.total_blocks = _total_blocks.load();
+    progress.finished_blocks = _finished_blocks.load();
+    progress.skipped_blocks = _skipped_blocks.load();
+    progress.failed_blocks = _failed_blocks.load();
+    progress.warmed_bytes = _warmed_bytes.load();
+    if (progress.state != State::IDLE) {
+        int64_t end_ns = progress.state == State::RUNNING ? MonotonicNanos() : _end_ns.load();
+        progress.elapsed_ms = (end_ns - _start_ns.load()) / 1000000;
+    }
+    return progress;
+}
+
+void BlockCacheWarmer::_run_warmup(std::vector<BlockAccess> blocks, int64_t rate_limit_bytes) {
+    const int64_t start_ns = _start_ns.load();
+    size_t begin = 0;
+    while (begin < blocks.size() && !_cancelled.load()) {
+        size_t end = begin + 1;
+        while (end < blocks.size() && blocks[end].filename == blocks[begin].filename) {
+            ++end;
+        }
+        Status st = _warmup_file(blocks, begin, end, rate_limit_bytes, start_ns);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to warm up datacache for " << blocks[begin].filename << ": " << st;
+        }
+        begin = end;
+    }
+    _end_ns.store(MonotonicNanos());
+    _state.store(_cancelled.load() ? State::CANCELLED : State::FINISHED);
+    LOG(INFO) << "datacache warmup " << state_name(_state.load()) << ", total blocks: " << _total_blocks.load()
+              << ", finished: " << _finished_blocks.load() << ", skipped: " << _skipped_blocks.load()
+              << ", failed: " << _failed_blocks.load() << ", bytes: " << _warmed_bytes.load();
+}
+
+Status BlockCacheWarmer::_warmup_file(const std::vector<BlockAccess>& blocks, size_t begin, size_t end,
+                                      int64_t rate_limit_bytes, int64_t start_ns) {
+    const auto& first = blocks[begin];
+    const auto cache_key = BlockCache::file_cache_key(first.filename, first.file_size, first.modification_time);
+    const int64_t block_size = _cache->block_size();
+
+    std::unique_ptr<RandomAccessFile> file;
+    auto open_file = [&]() -> Status {
+        ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(first.filename));
+        ASSIGN_OR_RETURN(file, fs->new_random_access_file(first.filename));
+        return Status::OK();
+    };
+
+    std::string buffer;
+    for (size_t i = begin; i < end && !_cancelled.load(); ++i) {
+        const int64_t offset = blocks[i].offset;
+        const int64_t size = std::min(block_size, first.file_size - offset);
+        if (size <= 0 || _cache->exist(cache_key, offset, size)) {
+            _skipped_blocks.fetch_add(1);
+            _finished_blocks.fetch_add(1);
+            continue;
+        }
+        if (file == nullptr) {
+            Status st = open_file();
+            if (!st.ok()) {
+                _failed_blocks.fetch_add(end - i);
+                _finished_blocks.fetch_add(end - i);
+                return st;
+            }
+        }
+
+        buffer.resize(size);
+        Status st = file->read_at_fully(offset, buffer.data(), size);
+        if (st.ok()) {
+            WriteCacheOptions options;
+            st = _cache->write_buffer(cache_key, offset, size, buffer.data(), &options);
+        }
+        if (st.ok() || st.is_already_exist()) {
+            _warmed_bytes.fetch_add(size);
+        } else {
+            _failed_blocks.fetch_add(1);
+            VLOG(1) << "failed to warm up block " << offset << " of " << first.filename << ": " << st;
+        }
+        _finished_blocks.fetch_add(1);
+
+        if (rate_limit_bytes > 0) {
+            // Sleep until the average rate since the warmup started drops to the limit.
+            int64_t expected_ns = _warmed_bytes.load() * 1000000000 / rate_limit_bytes;
+            while (!_cancelled.load()) {
+                int64_t wait_ns = expected_ns - (MonotonicNanos() - start_ns);
+                if (wait_ns <= 0) {
+                    break;
+                }
+                SleepFor(MonoDelta::FromNanoseconds(std::min<int64_t>(wait_ns, 100000000)));
+            }
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,126 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+class BlockCache;
+
+// BlockCacheWarmer records how often every remote file block is read through the block cache, and replays
+// the hottest blocks into the cache from remote storage. The access history can be saved to a local file
+// on shutdown and loaded on startup, so a restarted or newly added node does not need to serve cold for a
+// long time.
+class BlockCacheWarmer {
+public:
+    enum class State { IDLE, RUNNING, FINISHED, CANCELLED };
+
+    struct BlockAccess {
+        std::string filename;
+        int64_t file_size = 0;
+        int64_t modification_time = 0;
+        int64_t offset = 0;
+        uint32_t hits = 0;
+    };
+
+    struct Progress {
+        State state = State::IDLE;
+        int64_t total_blocks = 0;
+        int64_t finished_blocks = 0;
+        // Blocks already in the cache when the warmup reached them.
+        int64_t skipped_blocks = 0;
+        int64_t failed_blocks = 0;
+        int64_t warmed_bytes = 0;
+        int64_t elapsed_ms = 0;
+    };
+
+    static BlockCacheWarmer* instance();
+
+    explicit BlockCacheWarmer(BlockCache* cache) : _cache(cache) {}
+    ~BlockCacheWarmer();
+
+    // Record the blocks (identified by their aligned offsets) of a file read by one input stream.
+    // It does nothing if `datacache_warmup_history_capacity` is zero.
+    void record_access(const std::string& filename, int64_t file_size, int64_t modification_time,
+                       const std::vector<int64_t>& block_offsets);
+
+    // Return at most `k` blocks ordered by their hits in descending order.
+    std::vector<BlockAccess> top_blocks(size_t k) const;
+
+    size_t history_size() const;
+
+    void clear_history();
+
+    // Persist the access history to `path`, one block per line.
+    Status save_history(const std::string& path) const;
+
+    // Merge the access history persisted by `save_history` into the current one.
+    Status load_history(const std::string& path);
+
+    // Start a background job to load the top `top_k` blocks into the cache with at most
+    // `rate_limit_bytes` bytes per second (0 means unlimited). Returns AlreadyExist if a job is running.
+    Status start_warmup(size_t top_k, int64_t rate_limit_bytes);
+
+    // Cancel the running warmup job and wait for it to quit.
+    void stop_warmup();
+
+    Progress progress() const;
+
+    static const char* state_name(State state);
+
+private:
+    struct FileAccess {
+        int64_t file_size = 0;
+        int64_t modification_time = 0;
+        std::unordered_map<int64_t, uint32_t> block_hits;
+    };
+
+    void _record_locked(const std::string& filename, int64_t file_size, int64_t modification_time, int64_t offset,
+                        uint32_t hits);
+    // Halve all the hits and drop the cold blocks once the history reaches its capacity, which keeps the
+    // history bounded and biased to the recent accesses.
+    void _decay_locked();
+    void _run_warmup(std::vector<BlockAccess> blocks, int64_t rate_limit_bytes);
+    Status _warmup_file(const std::vector<BlockAccess>& blocks, size_t begin, size_t end, int64_t rate_limit_bytes,
+                        int64_t start_ns);
+
+    BlockCache* _cache;
+
+    mutable std::mutex _history_mutex;
+    std::unordered_map<std::string, FileAccess> _history;
+    size_t _history_blocks = 0;
+
+    std::mutex _warmup_mutex;
+    std::thread _warmup_thread;
+    std::atomic<bool> _cancelled{false};
+    std::atomic<State> _state{State::IDLE};
+    std::atomic<int64_t> _total_blocks{0};
+    std::atomic<int64_t> _finished_blocks{0};
+    std::atomic<int64_t> _skipped_blocks{0};
+    std::atomic<int64_t> _failed_blocks{0};
+    std::atomic<int64_t> _warmed_bytes{0};
+    std::atomic<int64_t> _start_ns{0};
+    std::atomic<int64_t> _end_ns{0};
+};
+
+} // namespace starrocks
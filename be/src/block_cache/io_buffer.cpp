@@ -41,4 +41,18 @@ size_t IOBuffer::copy_to(void* data, ssize_t size, size_t pos) const {
     return bytes_copied;
 }
 
+const char* IOBuffer::contiguous_data(size_t pos, size_t size) const {
+    if (pos + size > _buf.size()) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < _buf.backing_block_num(); ++i) {
+        auto sp = _buf.backing_block(i);
+        if (pos < sp.size()) {
+            return pos + size <= sp.size() ? sp.data() + pos : nullptr;
+        }
+        pos -= sp.size();
+    }
+    return nullptr;
+}
+
 } // namespace starrocks
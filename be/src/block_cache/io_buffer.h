@@ -35,6 +35,10 @@ public:
 
     size_t copy_to(void* data, ssize_t size = -1, size_t pos = 0) const;
 
+    // Return the address of range [pos, pos + size) if it is stored in a single backing block, so the caller can
+    // read it without copying. Otherwise return nullptr. The address is valid as long as the buffer is alive.
+    const char* contiguous_data(size_t pos, size_t size) const;
+
     size_t size() const { return _buf.size(); }
 
     bool empty() const { return _buf.empty(); }
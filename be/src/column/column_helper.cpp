@@ -24,6 +24,8 @@
 #include "column/struct_column.h"
 #include "column/vectorized_fwd.h"
 #include "gutil/casts.h"
+#include "gutil/endian.h"
+#include "gutil/strings/fastmem.h"
 #include "simd/simd.h"
 #include "types/logical_type_infra.h"
 #include "util/date_func.h"
@@ -383,6 +385,105 @@ bool ColumnHelper::is_all_const(ColumnsConstIterator const& begin, ColumnsConstI
     return true;
 }
 
+size_t ColumnHelper::num_rows_within_capacity_limit(const Columns& columns, size_t from, size_t count) {
+    for (const auto& column : columns) {
+        if (count <= 1) {
+            break;
+        }
+        if (column->is_constant()) {
+            continue;
+        }
+        const Column* data_column = get_data_column(column.get());
+        if (!data_column->is_large_binary()) {
+            continue;
+        }
+        const auto& offsets = down_cast<const LargeBinaryColumn*>(data_column)->get_offset();
+        const uint64_t limit = offsets[from] + Column::MAX_CAPACITY_LIMIT;
+        if (offsets[from + count] < limit) {
+            continue;
+        }
+        // The first row ending at or beyond the limit, excluded.
+        auto it = std::lower_bound(offsets.begin() + from + 1, offsets.begin() + from + count + 1, limit);
+        count = std::max<size_t>(1, it - (offsets.begin() + from + 1));
+    }
+    return count;
+}
+
+template <typename T>
+static void encode_int_prefixes(const T* values, size_t num_rows, uint64_t* prefixes) {
+    for (size_t i = 0; i < num_rows; i++) {
+        // Flip the sign bit, so that the signed integers are ordered as the unsigned ones.
+        prefixes[i] = static_cast<uint64_t>(static_cast<int64_t>(values[i])) ^ (1ULL << 63);
+    }
+}
+
+template <typename T>
+static void encode_binary_prefixes(const BinaryColumnBase<T>& column, size_t num_rows, uint64_t* prefixes) {
+    for (size_t i = 0; i < num_rows; i++) {
+        // The strings are ordered by memcmp, then the shorter one first, which the zero padding agrees with.
+        Slice slice = column.get_slice(i);
+        uint64_t value = 0;
+        strings::memcpy_inlined(&value, slice.data, std::min<size_t>(slice.size, sizeof(value)));
+        prefixes[i] = BigEndian::ToHost64(value);
+    }
+}
+
+bool ColumnHelper::encode_sort_key_prefixes(const Column& column, bool is_asc, bool null_first,
+                                            std::vector<uint64_t>* prefixes) {
+    if (column.is_constant()) {
+        return false;
+    }
+    const Column* data_column = get_data_column(&column);
+    const size_t num_rows = column.size();
+    prefixes->resize(num_rows);
+    uint64_t* out = prefixes->data();
+    if (const auto* c = dynamic_cast<const Int8Column*>(data_column)) {
+        encode_int_prefixes(c->get_data().data(), num_rows, out);
+    } else if (const auto* c = dynamic_cast<const UInt8Column*>(data_column)) {
+        encode_int_prefixes(c->get_data().data(), num_rows, out);
+    } else if (const auto* c = dynamic_cast<const Int16Column*>(data_column)) {
+        encode_int_prefixes(c->get_data().data(), num_rows, out);
+    } else if (const auto* c = dynamic_cast<const Int32Column*>(data_column)) {
+        encode_int_prefixes(c->get_data().data(), num_rows, out);
+    } else if (const auto* c = dynamic_cast<const Int64Column*>(data_column)) {
+        encode_int_prefixes(c->get_data().data(), num_rows, out);
+    } else if (const auto* c = dynamic_cast<const DateColumn*>(data_column)) {
+        const auto& values = c->get_data();
+        for (size_t i = 0; i < num_rows; i++) {
+            out[i] = static_cast<uint64_t>(static_cast<int64_t>(values[i].julian())) ^ (1ULL << 63);
+        }
+    } else if (const auto* c = dynamic_cast<const TimestampColumn*>(data_column)) {
+        const auto& values = c->get_data();
+        for (size_t i = 0; i < num_rows; i++) {
+            out[i] = static_cast<uint64_t>(values[i].timestamp()) ^ (1ULL << 63);
+        }
+    } else if (const auto* c = dynamic_cast<const BinaryColumn*>(data_column)) {
+        encode_binary_prefixes(*c, num_rows, out);
+    } else if (const auto* c = dynamic_cast<const LargeBinaryColumn*>(data_column)) {
+        encode_binary_prefixes(*c, num_rows, out);
+    } else {
+        prefixes->clear();
+        return false;
+    }
+
+    if (!is_asc) {
+        for (size_t i = 0; i < num_rows; i++) {
+            out[i] = ~out[i];
+        }
+    }
+    if (column.has_null()) {
+        // The prefix of a null may equal the one of a value, which is still in order since they are compared then.
+        const uint64_t null_prefix = null_first ? 0 : std::numeric_limits<uint64_t>::max();
+        const auto& nulls = down_cast<const NullableColumn&>(column).immutable_null_column_data();
+        for (size_t i = 0; i < num_rows; i++) {
+            if (nulls[i]) {
+                out[i] = null_prefix;
+            }
+        }
+    }
+    return true;
+}
+
 size_t ColumnHelper::compute_bytes_size(ColumnsConstIterator const& begin, ColumnsConstIterator const& end) {
     size_t n = 0;
     size_t row_num = (*begin)->size();
@@ -387,6 +387,19 @@ public:
     static bool is_all_const(ColumnsConstIterator const& begin, ColumnsConstIterator const& end);
     static size_t compute_bytes_size(ColumnsConstIterator const& begin, ColumnsConstIterator const& end);
 
+    // The largest number of rows, at most |count| and at least 1, from row |from| of |columns| whose large binary
+    // columns fit in a BinaryColumn, so that the chunk of these rows can be downgraded. Used to split the output
+    // of operators that accumulated more than 4GB of strings into chunks instead of failing the query.
+    static size_t num_rows_within_capacity_limit(const Columns& columns, size_t from, size_t count);
+
+    // Encodes the first 8 bytes of the sort key of each row of |column| into |prefixes|, ordered as the rows by
+    // |is_asc| and |null_first|: a row whose prefix is smaller is before the other one, but the rows of the same
+    // prefix are not necessarily equal and have to be compared then. Comparing the prefixes first saves the virtual
+    // compare_at() of the merges of sorted runs. Returns false if the type of |column| has no such encoding, e.g.
+    // the floats, the decimals and the constant columns.
+    static bool encode_sort_key_prefixes(const Column& column, bool is_asc, bool null_first,
+                                         std::vector<uint64_t>* prefixes);
+
     template <typename T, bool avx512f>
     static size_t t_filter_range(const Filter& filter, T* data, size_t from, size_t to) {
         auto start_offset = from;
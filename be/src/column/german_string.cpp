@@ -0,0 +1,66 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "column/german_string.h"
+
+namespace starrocks {
+
+template <typename T>
+GermanStrings GermanStrings::from_binary_column(const BinaryColumnBase<T>& column) {
+    const auto& offsets = column.get_offset();
+    const auto& bytes = column.get_bytes();
+    const size_t num_rows = column.size();
+
+    // Copy all the long strings with a single allocation.
+    size_t long_bytes = 0;
+    for (size_t i = 0; i < num_rows; i++) {
+        const size_t len = offsets[i + 1] - offsets[i];
+        long_bytes += len > GermanString::kInlineSize ? len : 0;
+    }
+
+    GermanStrings res;
+    res._strings.reserve(num_rows);
+    char* dst = long_bytes > 0 ? reinterpret_cast<char*>(res._pool->allocate(long_bytes)) : nullptr;
+    for (size_t i = 0; i < num_rows; i++) {
+        const auto* src = reinterpret_cast<const char*>(bytes.data() + offsets[i]);
+        const auto len = static_cast<uint32_t>(offsets[i + 1] - offsets[i]);
+        if (len <= GermanString::kInlineSize) {
+            res._strings.emplace_back(src, len);
+        } else {
+            memcpy(dst, src, len);
+            res._strings.emplace_back(dst, len);
+            dst += len;
+        }
+    }
+    return res;
+}
+
+template <typename T>
+void GermanStrings::append_to_binary_column(BinaryColumnBase<T>* dst) const {
+    size_t num_bytes = 0;
+    for (const auto& str : _strings) {
+        num_bytes += str.size();
+    }
+    dst->reserve(dst->size() + _strings.size(), dst->get_bytes().size() + num_bytes);
+    for (const auto& str : _strings) {
+        dst->append(str.to_slice());
+    }
+}
+
+template GermanStrings GermanStrings::from_binary_column<uint32_t>(const BinaryColumnBase<uint32_t>& column);
+template GermanStrings GermanStrings::from_binary_column<uint64_t>(const BinaryColumnBase<uint64_t>& column);
+template void GermanStrings::append_to_binary_column<uint32_t>(BinaryColumnBase<uint32_t>* dst) const;
+template void GermanStrings::append_to_binary_column<uint64_t>(BinaryColumnBase<uint64_t>* dst) const;
+
+} // namespace starrocks
@@ -0,0 +1,146 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "runtime/mem_pool.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// A 16 bytes string view in the "German string" layout:
+//
+//   | size (4 bytes) | prefix (4 bytes) | the rest of the string (8 bytes)    |   if size <= 12
+//   | size (4 bytes) | prefix (4 bytes) | pointer to the whole string (8 bytes) |   otherwise
+//
+// The size and the prefix share the first 8 bytes, so most of the unequal strings are told apart by a single
+// 64-bit comparison, and the strings no longer than 12 bytes are compared without touching any other memory.
+// The unused bytes of the inlined strings are zero, which lets the inlined strings be compared word by word.
+class GermanString {
+public:
+    static constexpr uint32_t kPrefixSize = 4;
+    static constexpr uint32_t kInlineSize = 12;
+
+    GermanString() = default;
+
+    // |data| must outlive this view if |size| > kInlineSize.
+    GermanString(const char* data, uint32_t size) : _size(size) {
+        if (size <= kInlineSize) {
+            memcpy(_data, data, size);
+        } else {
+            memcpy(_data, data, kPrefixSize);
+            memcpy(_data + kPrefixSize, &data, sizeof(data));
+        }
+    }
+
+    explicit GermanString(const Slice& slice) : GermanString(slice.data, static_cast<uint32_t>(slice.size)) {}
+
+    uint32_t size() const { return _size; }
+    bool is_inlined() const { return _size <= kInlineSize; }
+    const char* data() const { return is_inlined() ? _data : _pointer(); }
+    Slice to_slice() const { return {data(), _size}; }
+
+    bool operator==(const GermanString& rhs) const {
+        if (_size_and_prefix() != rhs._size_and_prefix()) {
+            return false;
+        }
+        if (is_inlined()) {
+            return _inlined_rest() == rhs._inlined_rest();
+        }
+        return memcmp(_pointer() + kPrefixSize, rhs._pointer() + kPrefixSize, _size - kPrefixSize) == 0;
+    }
+    bool operator!=(const GermanString& rhs) const { return !(*this == rhs); }
+
+    // Same order as Slice::compare.
+    int compare(const GermanString& rhs) const {
+        const uint32_t min_size = std::min(_size, rhs._size);
+        int res = memcmp(_data, rhs._data, std::min(min_size, kPrefixSize));
+        if (res != 0 || min_size <= kPrefixSize) {
+            return res != 0 ? res : (_size < rhs._size ? -1 : (_size > rhs._size ? 1 : 0));
+        }
+        res = memcmp(data() + kPrefixSize, rhs.data() + kPrefixSize, min_size - kPrefixSize);
+        if (res != 0) {
+            return res;
+        }
+        return _size < rhs._size ? -1 : (_size > rhs._size ? 1 : 0);
+    }
+    bool operator<(const GermanString& rhs) const { return compare(rhs) < 0; }
+
+private:
+    uint64_t _size_and_prefix() const {
+        uint64_t v;
+        memcpy(&v, reinterpret_cast<const char*>(this), sizeof(v));
+        return v;
+    }
+    uint64_t _inlined_rest() const {
+        uint64_t v;
+        memcpy(&v, _data + kPrefixSize, sizeof(v));
+        return v;
+    }
+    const char* _pointer() const {
+        const char* ptr;
+        memcpy(&ptr, _data + kPrefixSize, sizeof(ptr));
+        return ptr;
+    }
+
+    uint32_t _size = 0;
+    // The prefix, followed by either the rest of an inlined string or the pointer to a long string.
+    char _data[kInlineSize] = {};
+};
+
+static_assert(sizeof(GermanString) == 16);
+
+// A string column in the GermanString layout. The strings longer than GermanString::kInlineSize are copied into
+// a memory pool owned by this object, so it does not depend on the lifetime of the column it was converted from.
+class GermanStrings {
+public:
+    GermanStrings() = default;
+    GermanStrings(GermanStrings&&) = default;
+    GermanStrings& operator=(GermanStrings&&) = default;
+
+    template <typename T>
+    static GermanStrings from_binary_column(const BinaryColumnBase<T>& column);
+
+    // Append all the strings to |dst|.
+    template <typename T>
+    void append_to_binary_column(BinaryColumnBase<T>* dst) const;
+
+    void append(const Slice& str) {
+        if (str.size <= GermanString::kInlineSize) {
+            _strings.emplace_back(str);
+        } else {
+            auto* data = reinterpret_cast<char*>(_pool->allocate(str.size));
+            memcpy(data, str.data, str.size);
+            _strings.emplace_back(data, static_cast<uint32_t>(str.size));
+        }
+    }
+
+    size_t size() const { return _strings.size(); }
+    void reserve(size_t n) { _strings.reserve(n); }
+    const GermanString& operator[](size_t idx) const { return _strings[idx]; }
+    const std::vector<GermanString>& get_data() const { return _strings; }
+
+private:
+    std::vector<GermanString> _strings;
+    std::unique_ptr<MemPool> _pool = std::make_unique<MemPool>();
+};
+
+} // namespace starrocks
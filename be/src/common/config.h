@@ -52,6 +52,11 @@ CONF_Int32(brpc_num_threads, "-1");
 // The max number of single connections maintained by the brpc client and each server.
 // Theses connections are created during the first few access and will be used thereafter
 CONF_Int32(brpc_max_connections_per_server, "1");
+// The max number of single connections of the exchanges and the loads maintained by the brpc client and each server.
+// They are separate from the connections of the other rpcs, so the control rpcs, e.g. the runtime filters, don't
+// wait behind the large chunks.
+CONF_Int32(brpc_exchange_max_connections_per_server, "1");
+CONF_Int32(brpc_load_max_connections_per_server, "1");
 
 // Declare a selection strategy for those servers have many ips.
 // Note that there should at most one ip match this list.
@@ -80,6 +85,15 @@ CONF_mInt64(auto_adjust_pagecache_interval_seconds, "10");
 // it will be set to physical memory size.
 CONF_String(mem_limit, "90%");
 
+// The process and query pool mem trackers accumulate consumption in per core deltas and fold them into the shared
+// counter once a delta reaches this many bytes, to avoid contending on the shared counter. 0 disables it.
+CONF_Int64(mem_tracker_core_local_batch_bytes, "8388608");
+// Sample an allocation of each this many bytes allocated by a thread, with its stack, and attribute it to the
+// operator running on the thread. The top allocation sites of each operator are shown in the TopAllocationSites of
+// the profile. It costs a stack unwinding for each sample, 0 to disable it. Only applies to the queries prepared
+// after it's set.
+CONF_mInt64(mem_alloc_sample_interval_bytes, "0");
+
 // Enable the jemalloc tracker, which is responsible for reserving memory
 CONF_Bool(enable_jemalloc_memory_tracker, "true");
 // Consider part of jemalloc memory as fragmentation: ratio * (RSS-allocated-metadata)
@@ -109,6 +123,12 @@ CONF_mInt32(transaction_apply_worker_count, "0");
 CONF_mInt32(get_pindex_worker_count, "0");
 CONF_mInt32(transaction_apply_thread_pool_num_min, "0");
 CONF_Int32(transaction_apply_worker_idle_time_ms, "500");
+// The count of thread to load the primary keys of segments in parallel when applying a rowset
+// 0 means the worker count is equal to cpu core count
+CONF_mInt32(transaction_apply_segment_worker_count, "0");
+// The max number of segments of one rowset whose primary keys are loaded in parallel during apply,
+// it also bounds how many workers a single tablet can occupy. 1 means loading the segments one by one.
+CONF_mInt32(transaction_apply_segment_parallelism, "4");
 
 // The count of thread to clear transaction task.
 CONF_Int32(clear_transaction_task_worker_count, "1");
@@ -211,10 +231,18 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+// When the compress ratio of a chunk sent by OlapTableSink is less than rpc_compress_ratio_threshold, the sink
+// sends the next chunks without compression, 1, 2, 4, ... up to this many chunks, before trying again.
+// 0 means always trying compression.
+CONF_mInt32(load_rpc_compress_max_skip_chunks, "64");
 // Serialize and deserialize each returned row batch.
 CONF_Bool(serialize_batch, "false");
 // Interval between profile reports; in seconds.
 CONF_mInt32(status_report_interval, "5");
+// The periodic exec state reports of the fragment instances to the same FE within this window (in milliseconds)
+// are sent in one batch rpc, only the latest report of a fragment instance is sent. The final reports are
+// always sent at once. A negative value disables the batching.
+CONF_mInt32(exec_state_report_batch_window_ms, "50");
 // Local directory to copy UDF libraries from HDFS into.
 CONF_String(local_library_dir, "${UDF_RUNTIME_DIR}");
 // Number of olap/external scanner thread pool size.
@@ -243,12 +271,33 @@ CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
+// Sort the rows by the leading ORDER BY keys encoded into one order-preserving integer, and fall back to the
+// column-wise sort only for the remaining keys and the ties.
+CONF_mBool(enable_sort_normalized_key, "true");
+// Sort the string keys by their first 8 bytes inlined in the permutation, and compare the whole strings only for
+// the equal prefixes.
+CONF_mBool(enable_sort_string_prefix, "true");
+// ORDER BY ... LIMIT n with n + offset at most this many rows is sorted by a heap instead of the batched topn.
+CONF_mInt64(sort_heap_sorter_limit, "1024");
+// Same as sort_heap_sorter_limit, but for the sort keys all of fixed length, which are cheaper to compare row by
+// row, so the heap stays faster for more rows.
+CONF_mInt64(sort_heap_sorter_fixed_key_limit, "4096");
+// Merge the sorted outputs of the parallel full sort without limit by sample-based range partitioning: every
+// driver merges a disjoint key range of all the sorted outputs in one pass, and the ranges are output in order,
+// instead of the multi-level merge path cascade.
+CONF_mBool(enable_sort_range_partitioned_merge, "false");
+// A ROW_NUMBER topn whose offset + limit is at least this many rows is sorted by the spillable full sort when the
+// sort spill is enabled, since it keeps as many rows in memory as a full sort. -1 means never.
+CONF_mInt64(sort_spill_topn_min_limit, "1048576");
 
 CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
 // The memory_limitation_per_thread_for_schema_change unit GB.
 CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
 CONF_mDouble(memory_ratio_for_sorting_schema_change, "0.8");
+// The max number of rowsets of a tablet converted in parallel by a direct schema change, e.g. adding a column or
+// widening the type of a column. 1 means converting the rowsets one by one.
+CONF_mInt32(schema_change_convert_rowset_parallelism, "4");
 
 CONF_mInt32(update_cache_expire_sec, "360");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
@@ -286,6 +335,9 @@ CONF_Int32(data_page_size, "65536");
 
 // Cache for storage page size
 CONF_mString(storage_page_cache_limit, "20%");
+// Eviction policy of storage page cache, "lru" or "slru". With "slru", the pages visited only once by a large scan
+// are evicted before the pages visited repeatedly.
+CONF_String(page_cache_eviction_policy, "lru");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
 // whether to enable the bitmap index memory cache
@@ -320,6 +372,14 @@ CONF_mInt64(max_compaction_candidate_num, "40960");
 
 // If true, SR will try no to merge delta column back to main segment
 CONF_mBool(enable_lazy_delta_column_compaction, "true");
+// A rowset whose segment has at least this many delta column groups is compacted even if lazy delta column
+// compaction is enabled, because reads have to open and merge all the delta column files. 0 means no limit.
+CONF_mInt32(update_compaction_delta_column_group_threshold, "10");
+// Partial updates in AUTO_MODE on primary key tables with at least this many columns use the column mode if the
+// ratio of the updated value columns is at most `auto_column_mode_partial_update_max_ratio`. 0 means always
+// using the row mode.
+CONF_mInt32(auto_column_mode_partial_update_min_columns, "50");
+CONF_mDouble(auto_column_mode_partial_update_max_ratio, "0.2");
 
 CONF_mInt32(update_compaction_check_interval_seconds, "10");
 CONF_mInt32(update_compaction_num_threads_per_disk, "1");
@@ -355,6 +415,28 @@ CONF_mInt64(min_cumulative_compaction_failure_interval_sec, "30"); // 30s
 // This config can be set to 0, which means to forbid any compaction, for some special cases.
 CONF_mInt32(max_compaction_concurrency, "-1");
 
+// Whether to compact several non-overlapping rowsets of a duplicate key tablet, whose key ranges are disjoint and
+// ascending by version, by linking their segment files to the output rowset instead of merging them. The average
+// segment size of each of the rowsets must be at least compaction_link_rowsets_min_segment_bytes, so that the
+// small segments are still merged.
+CONF_mBool(enable_compaction_link_rowsets, "true");
+CONF_mInt64(compaction_link_rowsets_min_segment_bytes, "134217728");
+// Whether to collect the number of nulls and a HyperLogLog sketch of the distinct values of each column of the rowsets
+// written by compaction and store them in the rowset meta, so that the statistics of a tablet column can be merged
+// from its rowsets without reading the data.
+CONF_mBool(enable_compaction_column_statistics, "true");
+
+// The compaction score of a tablet is scaled by (1 + compaction_read_heat_weight * log2(1 + read heat)), where the
+// read heat is the decayed number of segments read by the queries of the tablet, so that the tablets whose read
+// amplification hurts the queries most are compacted first. 0 means to order the tablets by compaction score only.
+CONF_mDouble(compaction_read_heat_weight, "0.1");
+CONF_mInt64(tablet_read_heat_half_life_sec, "600");
+// The BE is considered busy if the pipeline drivers waiting for a worker thread exceed
+// compaction_throttle_queued_drivers_per_core * num_cores, and then at most
+// max(1, compaction_busy_concurrency_ratio * max task num) compaction tasks run. <= 0 disables the throttling.
+CONF_mDouble(compaction_throttle_queued_drivers_per_core, "4");
+CONF_mDouble(compaction_busy_concurrency_ratio, "0.5");
+
 // Threshold to logging compaction trace, in seconds.
 CONF_mInt32(compaction_trace_threshold, "60");
 
@@ -381,12 +463,25 @@ CONF_Bool(enable_check_string_lengths, "true");
 // Should be smaller than compaction_mem_limit.
 // When the row source mask buffer exceeds this, it will be persisted to a temporary file on the disk.
 CONF_Int64(max_row_source_mask_memory_bytes, "209715200");
+// Merge the sorted rowsets and segments of a tablet by a loser tree instead of a binary heap, which takes fewer
+// comparisons per output run for the reads of many overlapping rowsets, e.g. before the compaction catches up.
+CONF_mBool(enable_loser_tree_merge, "true");
+// The number of threads of a vertical compaction task to read and merge the value column groups, after the key
+// column group produced the row source masks. The column groups are still written in order, and each of the
+// column groups read ahead buffers at most vertical_compaction_column_group_buffer_bytes. 1 means to compact the
+// column groups one by one in the task thread.
+CONF_mInt32(vertical_compaction_column_group_parallelism, "1");
+CONF_mInt64(vertical_compaction_column_group_buffer_bytes, "67108864");
 
 // Port to start debug http server in BE
 CONF_Int32(be_http_port, "8040");
 CONF_Alias(be_http_port, webserver_port);
 // Number of http workers in BE
 CONF_Int32(be_http_num_workers, "48");
+// Port of the Arrow Flight server in BE, which streams the results of the external scans, e.g. the ones opened by
+// open_scanner, as Arrow record batches to the clients. The ticket of a DoGet is the context id of the scan.
+// -1 means the server is disabled.
+CONF_Int32(arrow_flight_port, "-1");
 // Period to update rate counters and sampling counters in ms.
 CONF_mInt32(periodic_counter_update_period_ms, "500");
 
@@ -396,9 +491,23 @@ CONF_Int64(load_data_reserve_hours, "4");
 CONF_mInt64(load_error_log_reserve_hours, "48");
 CONF_mInt32(number_tablet_writer_threads, "16");
 CONF_mInt64(max_queueing_memtable_per_tablet, "2");
+// The memtable tracks the sorted runs of the inserted rows, and merges the runs instead of sorting all the
+// rows if there are at most this many runs, which is much cheaper for loads arriving in key order.
+// 0 means always sorting the rows.
+CONF_mInt32(memtable_max_sorted_runs, "8");
+// The flushed memtable hands its column buffers to the next memtable of the same tablet writer if they take
+// at most this many bytes, which saves reallocating and page faulting them for every memtable. 0 disables it.
+CONF_mInt64(memtable_recycle_chunk_max_bytes, "268435456");
 // when memory limit exceed and memtable last update time exceed this time, memtable will be flushed
 // 0 means disable
 CONF_mInt64(stale_memtable_flush_time_sec, "0");
+// When the memory usage of a load job or of all the loads exceeds this percent of its limit, the load channel
+// flushes its largest memtables to bring the usage back under it, rather than letting the writers hitting the
+// limit flush their memtables whatever their sizes. 0 disables it.
+CONF_mInt32(memtable_flush_schedule_mem_ratio, "80");
+// The load channel doesn't flush memtables smaller than this when the memory usage is high, which avoids
+// writing many small segments.
+CONF_mInt64(memtable_flush_schedule_min_bytes, "16777216");
 
 // delta writer hang after this time, be will exit since storage is in error state
 CONF_Int32(be_exit_after_disk_write_hang_second, "60");
@@ -415,6 +524,13 @@ CONF_Double(dictionary_encoding_ratio, "0.7");
 // performance degradation.
 CONF_Int32(dictionary_page_size, "1048576");
 
+// A char/varchar column whose speculated number of distinct values is not greater than this threshold is treated
+// as a low cardinality column, and its dictionary page may grow up to low_cardinality_dictionary_page_size, so that
+// all the data pages of the segment keep dictionary encoded and the global dict optimization can be applied.
+// Set to 0 to disable it.
+CONF_mInt32(low_cardinality_dictionary_max_values, "256");
+CONF_mInt32(low_cardinality_dictionary_page_size, "8388608");
+
 // Just like dictionary_encoding_ratio, dictionary_encoding_ratio_for_non_string_column is used for
 // no-string column.
 CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
@@ -436,6 +552,9 @@ CONF_mInt64(streaming_load_max_mb, "102400");
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
 CONF_mInt64(streaming_load_max_batch_size_mb, "100");
+// Whether to batch the csv data of small requests in a transaction stream load before it's handed over to the
+// scanner. The data is pushed when the buffer is full or the transaction is committed.
+CONF_mBool(enable_transaction_stream_load_batch_put, "true");
 // The alive time of a TabletsChannel.
 // If the channel does not receive any data till this time,
 // the channel will be removed.
@@ -487,6 +606,12 @@ CONF_Int64(chunk_reserved_bytes_limit, "0");
 
 // for pprof
 CONF_String(pprof_profile_dir, "${STARROCKS_HOME}/log");
+// The times per second of the cpu time of the process to sample the stacks of the threads consuming cpu, tagged
+// with their queries and workgroups, see common/prof/cpu_sampler.h. The samples are exported by
+// /pprof/cpu_samples. 0 disables it, 49 is low-overhead enough to keep it on.
+CONF_mInt32(cpu_sampler_frequency, "0");
+// The number of the latest samples kept by the cpu sampler, each of which takes about 600 bytes.
+CONF_Int64(cpu_sampler_max_samples, "32768");
 
 // to forward compatibility, will be removed later
 CONF_mBool(enable_token_check, "true");
@@ -514,9 +639,19 @@ CONF_String(scratch_dirs, "/tmp");
 // Linux transparent huge page.
 CONF_Bool(madvise_huge_pages, "false");
 
+// The allocations of the join hash table buckets and of the aggregate hash maps not smaller than this many bytes are
+// mmapped from huge pages, see runtime/memory/huge_page_allocator.h. 0 disables it.
+CONF_Int64(huge_page_alloc_threshold_bytes, "0");
+// Take the huge pages above from the hugetlb pool reserved by vm.nr_hugepages instead of transparent huge pages.
+CONF_Bool(huge_page_alloc_use_hugetlb, "false");
+
 // Whether use mmap to allocate memory.
 CONF_Bool(mmap_buffers, "false");
 
+// The bytes of the freed column buffers each pipeline driver caches for its next chunks, see
+// runtime/memory/column_buffer_pool.h. 0 disables it.
+CONF_Int64(pipeline_driver_column_buffer_pool_bytes, "0");
+
 // Sleep time in seconds between memory maintenance iterations
 CONF_mInt64(memory_maintenance_sleep_time_s, "10");
 
@@ -597,6 +732,11 @@ CONF_mInt32(max_pulsar_consumer_num_per_group, "10");
 // kafka request timeout
 CONF_Int32(routine_load_kafka_timeout_second, "10");
 
+// The max number of the kafka messages a consumer hands off to its consumer group at a time, for routine load.
+// The messages already fetched by librdkafka are drained without waiting, so a larger batch reduces the
+// synchronization between the consumers and the consumer group.
+CONF_Int32(routine_load_kafka_consume_batch_size, "64");
+
 // pulsar request timeout
 CONF_Int32(routine_load_pulsar_timeout_second, "10");
 
@@ -665,6 +805,9 @@ CONF_Int64(brpc_max_body_size, "2147483648");
 CONF_Int64(brpc_socket_max_unwritten_bytes, "1073741824");
 // brpc connection types, "single", "pooled", "short".
 CONF_String_enum(brpc_connection_type, "single", "single,pooled,short");
+// Whether to enable the circuit breaker of the brpc channels, which isolates a server whose error rate of the recent
+// rpcs is too high for a while, so the rpcs to it fail fast instead of waiting for the timeout.
+CONF_Bool(brpc_enable_circuit_breaker, "false");
 // If the amount of data to be sent by a single channel of brpc exceeds brpc_socket_max_unwritten_bytes
 // it will cause rpc to report an error. We add configuration to ignore rpc overload.
 // This may cause process memory usage to rise.
@@ -789,14 +932,37 @@ CONF_Int64(pipeline_prepare_thread_pool_queue_size, "102400");
 // The number of threads for executing sink io task in pipeline engine, vCPUs by default.
 CONF_Int64(pipeline_sink_io_thread_pool_thread_num, "0");
 CONF_Int64(pipeline_sink_io_thread_pool_queue_size, "102400");
+// The number of threads encoding the columns of a row group in parallel for the parquet files written by the sinks,
+// vCPUs by default. The orc files written by the sinks encode their columns in the same pool. A negative value
+// disables the parallel encoding, then each sink encodes its columns serially.
+CONF_Int64(parquet_writer_encode_thread_pool_thread_num, "0");
 // The buffer size of SinkBuffer.
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "64");
+// The chunks sent to the same destination are merged into one rpc up to this size while they are waiting for
+// the rpc window of pipeline_sink_brpc_dop. Set to 0 to disable it.
+CONF_mInt64(pipeline_sink_coalesce_bytes, "1048576");
+// The budget of bytes of a chunk produced by the scans and merged by the chunk accumulators. The chunks of wide rows
+// have less than chunk_size rows, estimated from the width of the rows seen by the scan operator, so they stay in
+// the L2 cache. The chunks are never larger than chunk_size rows. Set to 0 to disable it.
+CONF_mInt64(pipeline_chunk_target_bytes, "0");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
 CONF_mBool(pipeline_print_profile, "false");
+// Count the cycles, instructions, LLC misses and branch misses of the operators by the hardware counters of
+// perf_event_open(2), shown in the CommonMetrics of the operators and summed up into the query statistics. It costs
+// two syscalls for each chunk pulled or pushed by an operator, and needs kernel.perf_event_paranoid <= 2 or
+// CAP_PERFMON. Only applies to the queries prepared after it's set.
+CONF_mBool(pipeline_enable_hardware_counters, "false");
+// The number of the driver state transitions kept by each thread for the queries with enable_query_debug_trace,
+// which are exported by /api/pipeline_driver_timeline. The older ones are overwritten.
+CONF_Int32(pipeline_driver_timeline_events_per_thread, "65536");
+// The drivers blocked on the input of an observable source operator, e.g. an exchange source, are only checked by
+// the poller when the source notifies them, or at this interval in case of the changes not notified, e.g. the
+// cancellation of the query. Set to 0 to poll all the blocked drivers each round.
+CONF_mInt64(pipeline_poller_fallback_interval_ms, "10");
 
 // The arguments of multilevel feedback pipeline_driver_queue. It prioritizes small queries over larger ones,
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
@@ -807,7 +973,27 @@ CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_Bool(pipeline_analytic_enable_removable_cumulative_process, "true");
+// Evaluate MAX/MIN over the frames like `ROWS BETWEEN N PRECEDING AND M FOLLOWING` with a monotonic deque.
+CONF_Bool(pipeline_analytic_enable_sliding_extremum, "true");
+// Fan out the partitions of an analytic node fed by a single ordered stream, e.g. a merging exchange, to all the
+// pipeline drivers, so that the partitions are evaluated in parallel. The output is no longer in the global order,
+// so it must only be enabled if the plan does not rely on the order of the output of the analytic nodes.
+CONF_Bool(pipeline_analytic_enable_partition_fanout, "false");
 CONF_Int32(pipline_limit_max_delivery, "4096");
+// Evaluate the outputs of a project node computed by the same deterministic expression only once.
+CONF_Bool(enable_project_dedup_outputs, "true");
+// Evaluate an OR of at least this many LIKE or REGEXP predicates on the same column with constant patterns by one
+// scan of a multi-pattern hyperscan database. <= 0 means disabled.
+CONF_mInt32(like_multi_pattern_min_patterns, "4");
+// A low cardinality string expression whose input column comes decoded is evaluated only on the distinct values of
+// a chunk, if they are at most this ratio of the rows. <= 0 means disabled.
+CONF_mDouble(dict_mapping_distinct_eval_max_ratio, "0.25");
+// A WHEN of CASE WHEN is only evaluated on the rows not matched by the previous WHENs, and a THEN is only evaluated
+// on the rows selected by its WHEN, if they are at most this ratio of the rows. <= 0 means disabled.
+CONF_mDouble(case_when_selective_eval_max_ratio, "0.5");
+// The element-wise lambda exprs of array_map, e.g. x -> x * 2 > a, are evaluated over all the elements of a chunk
+// at once, instead of over the elements copied into the chunks of chunk_size rows.
+CONF_mBool(enable_array_map_one_pass_eval, "true");
 
 CONF_mBool(use_default_dop_when_shared_scan, "true");
 /// For parallel scan on the single tablet.
@@ -881,12 +1067,21 @@ CONF_mBool(s3_use_list_objects_v1, "false");
 
 // Lake
 CONF_mBool(io_coalesce_lake_read_enable, "false");
+// Whether to coalesce the column page reads of local segments, based on the row ranges left after index
+// filtering, into fewer and larger reads. Useful for latency-bound disks such as HDD.
+CONF_mBool(io_coalesce_local_read_enable, "false");
 
 // orc reader
 CONF_Bool(enable_orc_late_materialization, "true");
 CONF_Bool(enable_orc_libdeflate_decompression, "true");
 CONF_Int32(orc_natural_read_size, "8388608");
 CONF_mBool(orc_coalesce_read_enable, "true");
+// Read the streams of the next stripe in the background while the current stripe is decoding.
+// It holds the shared buffers of at most one more stripe in memory. Takes effect when orc_coalesce_read_enable is true.
+CONF_mBool(orc_prefetch_next_stripe_enable, "false");
+// Whether the java scanners of the jni scanner (paimon, hudi, odps, etc.) read the next chunk by a background thread
+// while BE converts the current one.
+CONF_mBool(jni_scanner_prefetch_enable, "true");
 // For orc tiny stripe optimization
 // Default is 8MB for tiny stripe threshold size
 CONF_Int32(orc_tiny_stripe_threshold_size, "8388608");
@@ -909,6 +1104,9 @@ CONF_mBool(parquet_statistics_process_more_filter_enable, "true");
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// Derive the merge distance of coalesced reads from the first-byte latency and the bandwidth observed on
+// each kind of storage, instead of the fixed io_coalesce_read_max_distance_size.
+CONF_mBool(io_coalesce_adaptive_distance_enable, "false");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -916,8 +1114,18 @@ CONF_Int32(connector_io_tasks_adjust_interval_ms, "50");
 CONF_Int32(connector_io_tasks_adjust_step, "1");
 CONF_Int32(connector_io_tasks_adjust_smooth, "4");
 CONF_Int32(connector_io_tasks_slow_io_latency_ms, "50");
+// Whether to adjust the io tasks of the olap scan operators at runtime by the backlog of the morsels and the
+// chunk buffer, from io_tasks_per_scan_operator within [olap_scan_io_tasks_min_size,
+// max(io_tasks_per_scan_operator, olap_scan_io_tasks_max_size)].
+CONF_mBool(enable_olap_scan_adaptive_io_tasks, "false");
+CONF_Int32(olap_scan_io_tasks_min_size, "1");
+CONF_Int32(olap_scan_io_tasks_max_size, "16");
+CONF_mInt32(olap_scan_io_tasks_adjust_interval_ms, "50");
 CONF_mDouble(scan_use_query_mem_ratio, "0.25");
 CONF_Double(connector_scan_use_query_mem_ratio, "0.3");
+// The large uncompressed csv and ndjson files of the file scans are split into byte ranges of this size, which are
+// read by the scan drivers in parallel. 0 disables the split.
+CONF_mInt64(file_scan_split_size, "268435456");
 
 // hdfs hedged read
 CONF_Bool(hdfs_client_enable_hedged_read, "false");
@@ -970,6 +1178,9 @@ CONF_Int64(send_runtime_filter_via_http_rpc_min_size, "67108864");
 
 // -1: ulimited, 0: limit by memory use, >0: limit by queue_size
 CONF_mInt64(runtime_filter_queue_limit, "-1");
+// A scan re-applies an updated runtime filter (e.g. the tightening threshold published by a topn) to the zone maps
+// of the segment being read once it has read this many rows since the last time.
+CONF_mInt64(runtime_filter_range_update_rows, "40960");
 
 CONF_Int64(rpc_connect_timeout_ms, "30000");
 
@@ -1027,6 +1238,14 @@ CONF_mInt32(starlet_delete_files_max_key_in_batch, "1000");
 #endif
 
 CONF_mInt64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
+// Keep tablet metadata and schemas in the metacache until all the segments and delvecs are evicted.
+CONF_mBool(lake_metacache_durable_metadata, "true");
+// Eviction policy of lake metacache, "lru" or "slru".
+CONF_String(lake_metacache_eviction_policy, "lru");
+// When the metacache is full, a segment or delvec is cached only if its key is found in a ghost list of the
+// recently rejected keys, i.e. it is accessed twice in a short time, so that a large scan does not evict the hot
+// entries. The value is the number of keys in the ghost list, 0 to disable the admission control.
+CONF_mInt32(lake_metacache_admission_ghost_list_size, "0");
 CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
@@ -1045,6 +1264,12 @@ CONF_mInt64(lake_vacuum_retry_min_delay_ms, "100");
 CONF_mInt64(lake_max_garbage_version_distance, "100");
 CONF_mBool(enable_primary_key_recover, "false");
 CONF_mBool(lake_enable_compaction_async_write, "false");
+// The number of threads finalizing the segments written by the horizontal lake tablet writers in the background, i.e.
+// writing the indexes and the footers and completing the uploads, so a load or compaction writes its next segment
+// meanwhile. vCPUs by default, a negative value finalizes the segments synchronously.
+CONF_Int32(lake_segment_finalize_thread_num, "0");
+// The maximum number of the segments of a tablet writer being finalized in the background.
+CONF_mInt32(lake_max_in_flight_segments_per_tablet, "4");
 CONF_mInt64(lake_pk_compaction_max_input_rowsets, "500");
 CONF_mInt64(lake_pk_compaction_min_input_segments, "5");
 // Used for control memory usage of update state cache and compaction state cache
@@ -1100,6 +1325,27 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
 // min bytes size of spill read buffer. if the buffer size is less than this value, we will disable buffer read
 CONF_Int64(spill_read_buffer_min_bytes, "1048576");
+// max number of the sorted block groups merged at once by an ordered spill, more ones are compacted level by level
+// while spilling if the block compaction is enabled. <= 0 means only limited by the memory table size.
+CONF_mInt32(spill_max_merge_fan_in, "64");
+// The spilled chunks are compressed by LZ4, ZSTD or not, chosen by compressing the first this many chunks of each
+// spiller by both. <= 0 means disable the compression.
+CONF_mInt32(spill_compression_sample_chunks, "4");
+// The number of multipart upload parts of a block spilled to the remote storage uploaded in the background while
+// the following data is spilled.
+CONF_mInt64(spill_remote_max_inflight_upload_parts, "4");
+// Read ahead this many bytes from a block spilled to the remote storage on restore, so that it's restored by a few
+// large range requests instead of one or two per chunk. <= 0 means disable.
+CONF_mInt64(spill_remote_read_ahead_bytes, "8388608");
+// Ask the queries with spillable operators to spill, the ones of the lowest workgroup cpu weight and the most
+// revocable memory first, once the process memory exceeds this ratio of its limit, so that they release memory
+// before the process memory limit cancels queries. <= 0 means disable.
+CONF_mDouble(spill_arbiter_mem_pressure_ratio, "0.9");
+// min interval between two arbitrations.
+CONF_mInt64(spill_arbiter_interval_ms, "100");
+// A spilled EXCEPT rebuilds its hash set from the spilled keys in hash partitioned passes, each of which restores
+// at most about this many bytes of the build keys.
+CONF_mInt64(except_spill_pass_bytes, "268435456");
 CONF_mInt64(mem_limited_chunk_queue_block_size, "8388608");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
@@ -1132,6 +1378,9 @@ CONF_mString(datacache_disk_path, "");
 CONF_String(datacache_meta_path, "");
 CONF_Int64(datacache_block_size, "262144"); // 256K
 CONF_Bool(datacache_checksum_enable, "false");
+// The capacity in bytes of the BE-wide cache of the parsed footers of the external parquet and orc files, used when
+// the footers are not cached by the datacache. 0 disables the cache.
+CONF_Int64(external_file_footer_cache_capacity, "268435456");
 CONF_Bool(datacache_direct_io_enable, "false");
 // Maximum number of concurrent inserts we allow globally for datacache.
 // 0 means unlimited.
@@ -1146,6 +1395,17 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// Whether to read ahead the following blocks in the background when an external table file is scanned
+// sequentially through the datacache. The blocks read ahead are written to the datacache.
+CONF_mBool(datacache_readahead_enable, "false");
+// The bytes read ahead of a sequential scan, rounded down to the datacache block size.
+CONF_mInt64(datacache_readahead_window_bytes, "4194304");
+// The maximum bytes being read ahead by all the scans of a query, so that large scans can't starve
+// the other reads.
+CONF_mInt64(datacache_readahead_max_inflight_bytes_per_query, "67108864");
+// The maximum bytes of the iceberg delete files cached by a query, so that a delete file referenced by many data
+// files is read only once by the query. The files beyond it are read by each scan as before. 0 disables the cache.
+CONF_mInt64(iceberg_delete_file_cache_max_bytes_per_query, "1073741824");
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1187,6 +1447,16 @@ CONF_mInt64(datacache_disk_idle_seconds_for_expansion, "7200");
 // cache quota will be reset to zero to avoid overly frequent population and eviction.
 // Default: 100G
 CONF_mInt64(datacache_min_disk_quota_for_adjustment, "107374182400");
+// The maximum number of blocks tracked by the datacache access history, which is used to warm up the cache
+// after restart. Once exceeded, all the access counts are halved and the cold blocks are dropped.
+// 0 means disable the access history.
+CONF_mInt64(datacache_warmup_history_capacity, "0");
+// Whether to warm up the datacache with the hottest blocks in the saved access history on startup.
+CONF_Bool(datacache_warmup_on_startup, "false");
+// The maximum number of blocks loaded by one datacache warmup job.
+CONF_mInt64(datacache_warmup_top_k, "100000");
+// The maximum bytes per second read from remote storage by the datacache warmup job, 0 means unlimited.
+CONF_mInt64(datacache_warmup_rate_limit_bytes, "67108864");
 
 // The following configurations will be deprecated, and we use the `datacache` prefix instead.
 // But it is temporarily necessary to keep them for a period of time to be compatible with
@@ -1220,6 +1490,13 @@ CONF_mInt64(max_allow_pindex_l2_num, "5");
 CONF_mInt32(pindex_major_compaction_num_threads, "0");
 // Limit of major compaction per disk.
 CONF_mInt32(pindex_major_compaction_limit_per_disk, "1");
+// Whether to load the persistent primary indexes of all the primary key tablets in the background after
+// restart, instead of loading every one of them on its first apply.
+CONF_Bool(pindex_preload_on_startup, "false");
+// The number of tablets loading their primary indexes concurrently on each disk during preload.
+CONF_mInt32(pindex_preload_limit_per_disk, "2");
+// Stop the preload once the primary index cache uses this percent of its capacity.
+CONF_mInt32(pindex_preload_mem_limit_percent, "50");
 // control the persistent index schedule compaction interval
 CONF_mInt64(pindex_major_compaction_schedule_interval_seconds, "15");
 // control the local persistent index in shared_data gc/evict interval
@@ -1243,6 +1520,8 @@ CONF_mBool(enable_pindex_read_by_page, "true");
 
 // Used by query cache, cache entries are evicted when it exceeds its capacity(500MB in default)
 CONF_Int64(query_cache_capacity, "536870912");
+// Eviction policy of query cache, "lru" or "slru".
+CONF_String(query_cache_eviction_policy, "lru");
 
 // When query cache enabled, the operators in the drivers contains cache operator are multilane
 // operators, if the number of lanes is big, Fragment Instance would spend too much time to prepare
@@ -1250,6 +1529,13 @@ CONF_Int64(query_cache_capacity, "536870912");
 // ranges in [1,16], default value is 4.
 CONF_mInt32(query_cache_num_lanes_per_driver, "4");
 
+// Whether to cache the result set of the fragments that read the local tablets and produce the query result alone,
+// so the identical queries over the unchanged tablets are answered from the cache. The entries share the capacity
+// of the query cache.
+CONF_mBool(enable_fragment_result_cache, "false");
+// The result sets larger than it are not cached, 4MB in default.
+CONF_mInt64(fragment_result_cache_entry_max_bytes, "4194304");
+
 // Used by vector query cache, 500MB in default
 CONF_Int64(vector_query_cache_capacity, "536870912");
 
@@ -1276,12 +1562,45 @@ CONF_String(rocksdb_db_options_string, "create_if_missing=true;create_missing_co
 
 // limit local exchange buffer's memory size per driver
 CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
+// A pipeline exchange receiver keeps accepting chunks beyond its buffer limit, up to this factor of the limit,
+// as long as the query stays below `exchange_recvr_elastic_buffer_mem_ratio` percent of its memory limit.
+// It lets the senders keep streaming behind a temporarily slow consumer. 1 disables the elastic buffer.
+CONF_mDouble(exchange_recvr_elastic_buffer_factor, "4");
+CONF_mInt32(exchange_recvr_elastic_buffer_mem_ratio, "50");
+// Send the broadcast chunks only once to every BE, which fans them out to all the destination fragment instances
+// on it. All the BEs of the cluster must support it before it's enabled.
+CONF_mBool(enable_exchange_broadcast_fanout, "false");
+// Reassign the buckets of a colocate scan to the pipeline drivers by their row counts instead of their number,
+// so that a few large buckets do not make one driver the straggler of a shuffle-free colocate aggregation.
+CONF_mBool(enable_colocate_bucket_rebalance, "true");
 // only used for test. default: 128M
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // mem limit for partition hash join probe side buffer
 CONF_mInt64(partition_hash_join_probe_limit_size, "134217728");
+// how many probe rows ahead hash join prefetches the bucket heads when the hash table doesn't fit in cache.
+// 0 means disable prefetch.
+CONF_mInt32(join_hash_map_probe_prefetch_distance, "16");
+// Pack the CHAR/VARCHAR keys of a multi-column join together with the fixed size keys into one fixed size key,
+// when the longest build key string is short enough for all the keys to fit in 16 bytes.
+CONF_mBool(enable_join_short_string_fixed_key, "true");
+// Probe an inner nested loop join with range predicates between a probe column and the build columns, e.g.
+// `a.ts BETWEEN b.start AND b.end`, by binary searching the build rows sorted by the range bounds.
+CONF_mBool(enable_nljoin_range_join, "true");
+// Push the range comparisons of a nested loop join down to the probe side as runtime filters bounded by the min/max
+// of the build side of many rows, e.g. `fact.ts >= dim.min_ts` as `fact.ts >= min(dim.min_ts)`.
+CONF_mBool(enable_nljoin_range_runtime_filter, "true");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
+// Keep a single CHAR/VARCHAR group by key declared no longer than 15 bytes inline in the aggregate hash table.
+CONF_mBool(enable_agg_short_string_key, "true");
+// Look up a single low cardinality dict code group by key in a table directly indexed by the code.
+CONF_mBool(enable_agg_dense_dict_key, "true");
+// Move the distinct INT/BIGINT values of a COUNT/SUM(DISTINCT) state into a bitmap once there are at least
+// this many of them in a narrow enough range. <= 0 means never.
+CONF_mInt64(distinct_agg_bitmap_min_size, "65536");
+// Allocate the hash sets and vectors inside the aggregate states from a per-aggregator arena, which is freed at
+// once when the hash table is released or spilled.
+CONF_mBool(enable_agg_state_arena, "true");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
 
 // Max size of a binlog file. The default is 512MB.
@@ -1289,6 +1608,12 @@ CONF_Int64(binlog_file_max_size, "536870912");
 // Max size of a binlog page. The default is 1MB.
 CONF_Int32(binlog_page_max_size, "1048576");
 
+// The state tables of the incremental MVs keep the changes of the current epochs in memory, and write them into a
+// sorted run on the spill dirs at the end of an epoch once they are larger than this.
+CONF_mInt64(stream_state_table_write_buffer_bytes, "67108864");
+// The sorted runs of a state table are merged into one once there are more of them than this.
+CONF_mInt32(stream_state_table_max_runs, "8");
+
 CONF_mInt64(txn_info_history_size, "20000");
 CONF_mInt64(file_write_history_size, "10000");
 
@@ -1296,6 +1621,9 @@ CONF_mInt32(update_cache_evict_internal_sec, "11");
 CONF_mBool(enable_auto_evict_update_cache, "true");
 
 CONF_mInt64(load_tablet_timeout_seconds, "60");
+// The number of threads of each data dir to load the tablets from their metas at the startup. The data dirs are
+// loaded in parallel too.
+CONF_Int32(load_tablet_meta_threads_per_data_dir, "4");
 
 CONF_mBool(enable_pk_value_column_zonemap, "true");
 
@@ -1308,6 +1636,13 @@ CONF_Double(default_mv_resource_group_spill_mem_limit_threshold, "0.8");
 
 CONF_Bool(enable_resource_group_bind_cpus, "true");
 CONF_mBool(enable_resource_group_cpu_borrowing, "true");
+// The max runtime a resource group coming back from idle is allowed to run ahead of the busy ones, which is
+// earned by half of its idle time. 0 or less than half of its ideal runtime means the fixed half ideal runtime.
+CONF_mInt64(workgroup_max_burst_credit_ms, "200");
+// The disk io bandwidth of the scan and spill tasks of a resource group per core of its cpu weight, e.g. a group of
+// cpu_weight 4 may read and write 4x this bytes per second. Its io tasks wait in the queue once it is exceeded.
+// 0 means unlimited.
+CONF_mInt64(workgroup_io_bytes_per_second_per_core, "0");
 
 // Max size of key columns size of primary key table, default value is 128 bytes
 CONF_mInt32(primary_key_limit_size, "128");
@@ -1322,6 +1657,10 @@ CONF_mBool(enable_short_key_for_one_column_filter, "false");
 
 CONF_mBool(enable_index_segment_level_zonemap_filter, "true");
 CONF_mBool(enable_index_page_level_zonemap_filter, "true");
+// If greater than 0, the min/max of the page-level zone maps of CHAR/VARCHAR columns are truncated to
+// prefixes of at most this length, to reduce the size of zone maps of long strings such as URLs.
+// The segment-level zone map is always written in full.
+CONF_mInt32(string_page_zone_map_max_prefix_length, "0");
 CONF_mBool(enable_index_bloom_filter, "true");
 CONF_mBool(enable_index_bitmap_filter, "true");
 
@@ -1370,9 +1709,24 @@ CONF_mDouble(json_flat_sparsity_factor, "0.9");
 // the maximum number of extracted JSON sub-field
 CONF_mInt32(json_flat_column_max, "100");
 
+// keep the statistics of the JSON paths of the recent segments of each tablet, and extract the paths that are hot in
+// the tablet from a new segment at json_flat_hot_path_sparsity_factor, to keep the flat schemas of the segments
+// consistent.
+CONF_mBool(enable_json_flat_path_stats, "true");
+
+// extract a hot path of the tablet when row_num * hot_path_sparsity_factor < hit_row_num
+CONF_mDouble(json_flat_hot_path_sparsity_factor, "0.5");
+
+// the maximum number of JSON columns whose path statistics are kept in memory
+CONF_Int64(json_flat_path_stats_capacity, "4096");
+
 // for whitelist on flat json remain data, max set 1kb
 CONF_mInt32(json_flat_remain_filter_max_bytes, "1024");
 
+// get_json_* extract the value of a constant object path, e.g. '$.a.b', from the json string with simdjson
+// directly, instead of parsing the whole string into JsonValue first
+CONF_mBool(enable_json_simd_extract, "true");
+
 // Allowable intervals for continuous generation of pk dumps
 // Disable when pk_dump_interval_seconds <= 0
 CONF_mInt64(pk_dump_interval_seconds, "3600"); // 1 hour
@@ -1454,6 +1808,30 @@ CONF_mInt32(config_vector_index_build_concurrency, "8");
 // default not to build the empty index
 CONF_mInt32(config_vector_index_default_build_threshold, "0");
 
+// If the other filters of a query leave no more than this number of rows in a segment, the vector search computes
+// the exact distances of these rows instead of searching the vector index with them as the allowed ids, which
+// may return less than k rows for a selective filter. 0 means always to search the vector index.
+CONF_mInt64(vector_search_exact_max_rows, "20000");
+
+// Write the segments of the tables with vector indexes without building the indexes, which are built by a background
+// thread of each BE later, to keep the loads as fast as the tables without vector indexes. The segments without the
+// built indexes are searched by computing the exact distances of their rows.
+CONF_mBool(enable_vector_index_deferred_build, "false");
+// The interval in seconds to check the segments whose vector indexes are not built yet.
+CONF_mInt32(vector_index_deferred_build_interval_sec, "10");
+
+// Build a sorted index of (value -> segment, rowid) for each rowset on the bloom filter columns of the non primary
+// key tables in the background, which is maintained by the loads and the compactions as the rowsets are, and use it
+// to skip the segments and rows without the values of the point and range predicates of a query.
+CONF_mBool(enable_rowset_sorted_index, "false");
+// The interval in seconds to check the rowsets whose sorted indexes are not built yet.
+CONF_mInt32(rowset_sorted_index_build_interval_sec, "10");
+// The rowsets with more rows are not indexed, since all the values of a rowset are sorted in memory.
+CONF_mInt64(rowset_sorted_index_max_rows, "20000000");
+// The sorted index is not used for the predicates selecting more than this ratio of the rows of a rowset, which are
+// read faster by the scan.
+CONF_mDouble(rowset_sorted_index_max_filter_ratio, "0.01");
+
 // When upgrade thrift to 0.20.0, the MaxMessageSize member defines the maximum size of a (received) message, in bytes.
 // The default value is represented by a constant named DEFAULT_MAX_MESSAGE_SIZE, whose value is 100 * 1024 * 1024 bytes.
 // This will cause FE to fail during deserialization when the returned result set is larger than 100M. Therefore,
@@ -0,0 +1,211 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/prof/cpu_sampler.h"
+
+#include <sys/time.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "fmt/format.h"
+#include "runtime/current_thread.h"
+
+// import hidden stack trace functions from glog
+namespace google::glog_internal_namespace_ {
+enum class SymbolizeOptions { kNone = 0, kNoLineNumbers = 1 };
+int GetStackTrace(void** result, int max_depth, int skip_count);
+bool Symbolize(void* pc, char* out, unsigned long out_size, SymbolizeOptions options = SymbolizeOptions::kNone);
+} // namespace google::glog_internal_namespace_
+
+namespace starrocks {
+
+static int64_t monotonic_nanos() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+Status CpuSampler::set_frequency(int frequency) {
+    if (frequency < 0 || frequency > 1000) {
+        return Status::InvalidArgument(fmt::format("invalid cpu sampler frequency: {}", frequency));
+    }
+    std::lock_guard l(_mutex);
+    if (frequency > 0 && _samples == nullptr) {
+        // The buffer is never freed, since the signal handler may be running on another thread.
+        _capacity = std::max<int64_t>(config::cpu_sampler_max_samples, 1);
+        _samples.reset(new Sample[_capacity]);
+    }
+    if (!_paused) {
+        RETURN_IF_ERROR(_set_timer(frequency));
+    }
+    _frequency = frequency;
+    LOG(INFO) << "set the cpu sampler frequency to " << frequency;
+    return Status::OK();
+}
+
+void CpuSampler::pause() {
+    std::lock_guard l(_mutex);
+    _paused = true;
+    (void)_set_timer(0);
+}
+
+void CpuSampler::resume() {
+    std::lock_guard l(_mutex);
+    _paused = false;
+    if (_frequency > 0) {
+        auto st = _set_timer(_frequency);
+        LOG_IF(WARNING, !st.ok()) << "failed to resume the cpu sampler: " << st;
+    }
+}
+
+Status CpuSampler::_set_timer(int frequency) {
+    if (frequency > 0) {
+        // Install the handler every time, since it may be replaced by the cpu profiling of gperftools.
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        sigemptyset(&action.sa_mask);
+        action.sa_sigaction = _signal_handler;
+        action.sa_flags = SA_RESTART | SA_SIGINFO;
+        if (sigaction(SIGPROF, &action, nullptr) != 0) {
+            return Status::InternalError(fmt::format("failed to install the SIGPROF handler: {}", strerror(errno)));
+        }
+    }
+    // The handler is kept installed after the timer is stopped, the default action of a pending SIGPROF is to
+    // terminate the process.
+    int64_t interval_us = frequency > 0 ? 1000000 / frequency : 0;
+    itimerval timer;
+    timer.it_interval.tv_sec = interval_us / 1000000;
+    timer.it_interval.tv_usec = interval_us % 1000000;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        return Status::InternalError(fmt::format("failed to set the ITIMER_PROF timer: {}", strerror(errno)));
+    }
+    return Status::OK();
+}
+
+void CpuSampler::_signal_handler(int signum, siginfo_t* info, void* context) {
+    int saved_errno = errno;
+    getInstance()._record();
+    errno = saved_errno;
+}
+
+// Must be async-signal-safe.
+void CpuSampler::_record() {
+    if (_samples == nullptr) {
+        return;
+    }
+    uint64_t idx = _next.fetch_add(1, std::memory_order_relaxed);
+    Sample& sample = _samples[idx % _capacity];
+    sample.seq.store(2 * idx + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    sample.time_ns = monotonic_nanos();
+    // Don't touch the thread local CurrentThread before it's constructed, which allocates memory.
+    if (tls_is_thread_status_init) {
+        auto& current = CurrentThread::current();
+        sample.query_id = current.query_id();
+        sample.fragment_instance_id = current.fragment_instance_id();
+        sample.workgroup_id = current.workgroup_id();
+    } else {
+        sample.query_id = UniqueId();
+        sample.fragment_instance_id = UniqueId();
+        sample.workgroup_id = -1;
+    }
+    // Skip the frames of the signal handler.
+    sample.depth = google::glog_internal_namespace_::GetStackTrace(sample.addrs, kMaxStackDepth, 2);
+
+    sample.seq.store(2 * idx + 2, std::memory_order_release);
+}
+
+std::string CpuSampler::dump_folded(const Filter& filter) {
+    std::lock_guard l(_mutex);
+    if (_samples == nullptr) {
+        return "";
+    }
+
+    int64_t min_time_ns = filter.seconds > 0 ? monotonic_nanos() - filter.seconds * 1000000000L : 0;
+    std::map<std::pair<std::string, std::vector<void*>>, int64_t> stacks;
+    for (size_t i = 0; i < _capacity; i++) {
+        Sample& sample = _samples[i];
+        uint64_t seq = sample.seq.load(std::memory_order_acquire);
+        if (seq == 0 || (seq & 1) != 0) {
+            continue;
+        }
+        int64_t time_ns = sample.time_ns;
+        UniqueId query_id = sample.query_id;
+        UniqueId fragment_instance_id = sample.fragment_instance_id;
+        int64_t workgroup_id = sample.workgroup_id;
+        int depth = std::min(std::max(sample.depth, 0), kMaxStackDepth);
+        std::vector<void*> addrs(sample.addrs, sample.addrs + depth);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sample.seq.load(std::memory_order_relaxed) != seq) {
+            // Overwritten while being copied.
+            continue;
+        }
+
+        if (time_ns < min_time_ns) {
+            continue;
+        }
+        if (filter.query_id.has_value() && query_id != filter.query_id.value()) {
+            continue;
+        }
+        if (filter.workgroup_id.has_value() && workgroup_id != filter.workgroup_id.value()) {
+            continue;
+        }
+
+        std::string tags;
+        if (workgroup_id >= 0) {
+            tags += fmt::format("workgroup={};", workgroup_id);
+        }
+        if (query_id != UniqueId()) {
+            tags += fmt::format("query={};fragment={};", print_id(query_id), print_id(fragment_instance_id));
+        }
+        stacks[{std::move(tags), std::move(addrs)}]++;
+    }
+
+    std::unordered_map<void*, std::string> symbols;
+    std::string result;
+    for (const auto& [key, count] : stacks) {
+        const auto& [tags, addrs] = key;
+        result += tags;
+        // The folded stacks start from the outermost frame.
+        for (auto it = addrs.rbegin(); it != addrs.rend(); ++it) {
+            auto& symbol = symbols[*it];
+            if (symbol.empty()) {
+                char buf[1024];
+                if (google::glog_internal_namespace_::Symbolize(*it, buf, sizeof(buf))) {
+                    symbol = buf;
+                } else {
+                    symbol = fmt::format("{}", *it);
+                }
+            }
+            if (it != addrs.rbegin()) {
+                result += ';';
+            }
+            result += symbol;
+        }
+        result += fmt::format(" {}\n", count);
+    }
+    return result;
+}
+
+} // namespace starrocks
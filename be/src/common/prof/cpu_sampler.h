@@ -0,0 +1,94 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <csignal>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "common/status.h"
+#include "gutil/macros.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+// Samples the stacks of the threads consuming cpu continuously, by a SIGPROF timer of the cpu time of the process.
+// Each sample is tagged with the query, the fragment instance and the workgroup which the thread is working on, so
+// the samples can be attributed to them. The samples are kept in a ring buffer of config::cpu_sampler_max_samples,
+// the oldest ones are overwritten.
+//
+// The sampler is controlled by config::cpu_sampler_frequency. It can't run together with the cpu profiling of
+// gperftools, which uses SIGPROF too, so it's paused during /pprof/profile.
+class CpuSampler {
+public:
+    static CpuSampler& getInstance() {
+        static CpuSampler sampler;
+        return sampler;
+    }
+
+    // Starts sampling |frequency| times per second of the cpu time, or stops sampling if |frequency| is 0.
+    Status set_frequency(int frequency);
+    int frequency() const { return _frequency; }
+
+    // Pauses the sampling until resume(), keeping the frequency.
+    void pause();
+    void resume();
+
+    struct Filter {
+        // Only the samples in the last |seconds| seconds if positive.
+        int64_t seconds = 0;
+        std::optional<UniqueId> query_id;
+        std::optional<int64_t> workgroup_id;
+    };
+
+    // Returns the samples matching |filter| in the folded format of the flame graph tools, one line for each
+    // distinct stack, e.g. "workgroup=1;query=<id>;fragment=<id>;main;foo;bar 10". The tags not set are omitted.
+    std::string dump_folded(const Filter& filter);
+
+    DISALLOW_COPY_AND_MOVE(CpuSampler);
+
+private:
+    static constexpr int kMaxStackDepth = 64;
+
+    struct Sample {
+        // Odd while the sample is being written.
+        std::atomic<uint64_t> seq{0};
+        int64_t time_ns;
+        UniqueId query_id;
+        UniqueId fragment_instance_id;
+        int64_t workgroup_id;
+        int depth;
+        void* addrs[kMaxStackDepth];
+    };
+
+    CpuSampler() = default;
+
+    static void _signal_handler(int signum, siginfo_t* info, void* context);
+    void _record();
+    Status _set_timer(int frequency);
+
+    std::mutex _mutex;
+    std::atomic<int> _frequency = 0;
+    bool _paused = false;
+
+    std::unique_ptr<Sample[]> _samples;
+    size_t _capacity = 0;
+    std::atomic<uint64_t> _next = 0;
+};
+
+} // namespace starrocks
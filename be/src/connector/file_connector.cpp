@@ -14,6 +14,7 @@
 
 #include "connector/file_connector.h"
 
+#include "common/config.h"
 #include "exec/avro_scanner.h"
 #include "exec/csv_scanner.h"
 #include "exec/exec_node.h"
@@ -47,6 +48,72 @@ const TupleDescriptor* FileDataSourceProvider::tuple_descriptor(RuntimeState* st
     return state->desc_tbl().get_tuple_descriptor(_file_scan_node.tuple_id);
 }
 
+static bool is_splittable_range(const TBrokerScanRange& scan_range, const TBrokerRangeDesc& range_desc,
+                                int64_t split_size) {
+    if (range_desc.file_type != TFileType::FILE_BROKER || !range_desc.splittable || !range_desc.__isset.file_size) {
+        return false;
+    }
+    if (range_desc.format_type == TFileFormatType::FORMAT_CSV_PLAIN) {
+        // The records are resynchronized at the row delimiters, which is wrong if a row delimiter may be enclosed
+        // in a field, and the header is only at the start of the file.
+        const auto& params = scan_range.params;
+        if ((params.__isset.enclose && params.enclose != 0) || (params.__isset.skip_header && params.skip_header > 0)) {
+            return false;
+        }
+        int64_t size = range_desc.size > 0 ? range_desc.size : range_desc.file_size - range_desc.start_offset;
+        return size > split_size;
+    }
+    if (range_desc.format_type == TFileFormatType::FORMAT_JSON) {
+        // Only the whole ndjson files are split, and the json reader reads a json array file in the first split.
+        if (range_desc.__isset.strip_outer_array && range_desc.strip_outer_array) {
+            return false;
+        }
+        return range_desc.start_offset == 0 && (range_desc.size < 0 || range_desc.size >= range_desc.file_size) &&
+               range_desc.file_size > split_size;
+    }
+    return false;
+}
+
+StatusOr<pipeline::MorselQueuePtr> FileDataSourceProvider::convert_scan_range_to_morsel_queue(
+        const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+        bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+        size_t num_total_scan_ranges, size_t scan_parallelism) {
+    const int64_t split_size = config::file_scan_split_size;
+    if (split_size <= 0) {
+        return DataSourceProvider::convert_scan_range_to_morsel_queue(
+                scan_ranges, node_id, pipeline_dop, enable_tablet_internal_parallel, tablet_internal_parallel_mode,
+                num_total_scan_ranges, scan_parallelism);
+    }
+
+    std::vector<TScanRangeParams> split_scan_ranges;
+    for (const auto& scan_range_params : scan_ranges) {
+        const TBrokerScanRange& broker_scan_range = scan_range_params.scan_range.broker_scan_range;
+        // The ranges which are not split are kept together in the original scan range.
+        TScanRangeParams rest = scan_range_params;
+        rest.scan_range.broker_scan_range.ranges.clear();
+        for (const auto& range_desc : broker_scan_range.ranges) {
+            if (!is_splittable_range(broker_scan_range, range_desc, split_size)) {
+                rest.scan_range.broker_scan_range.ranges.emplace_back(range_desc);
+                continue;
+            }
+            int64_t end = range_desc.size > 0 ? range_desc.start_offset + range_desc.size : range_desc.file_size;
+            for (int64_t offset = range_desc.start_offset; offset < end; offset += split_size) {
+                TScanRangeParams& split = split_scan_ranges.emplace_back(scan_range_params);
+                TBrokerRangeDesc split_range_desc = range_desc;
+                split_range_desc.__set_start_offset(offset);
+                split_range_desc.__set_size(std::min(split_size, end - offset));
+                split.scan_range.broker_scan_range.ranges = {std::move(split_range_desc)};
+            }
+        }
+        if (!rest.scan_range.broker_scan_range.ranges.empty() || broker_scan_range.ranges.empty()) {
+            split_scan_ranges.emplace_back(std::move(rest));
+        }
+    }
+    return DataSourceProvider::convert_scan_range_to_morsel_queue(
+            split_scan_ranges, node_id, pipeline_dop, enable_tablet_internal_parallel, tablet_internal_parallel_mode,
+            split_scan_ranges.size(), scan_parallelism);
+}
+
 // ================================
 FileDataSource::FileDataSource(const FileDataSourceProvider* provider, const TScanRange& scan_range)
         : _provider(provider), _scan_range(scan_range.broker_scan_range) {
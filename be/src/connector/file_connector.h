@@ -47,6 +47,13 @@ public:
     bool accept_empty_scan_ranges() const override { return false; }
     const TupleDescriptor* tuple_descriptor(RuntimeState* state) const override;
 
+    // Splits the large uncompressed csv and ndjson files into byte ranges of config::file_scan_split_size, each of
+    // them is read as a morsel, so that a file is read by multiple scan drivers in parallel.
+    StatusOr<pipeline::MorselQueuePtr> convert_scan_range_to_morsel_queue(
+            const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+            bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+            size_t num_total_scan_ranges, size_t scan_parallelism = 0) override;
+
 protected:
     ConnectorScanNode* _scan_node;
     const TFileScanNode _file_scan_node;
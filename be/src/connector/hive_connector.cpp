@@ -492,6 +492,12 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferCounter", TUnit::UNIT, prefix);
         _profile.datacache_read_block_buffer_bytes =
                 ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadBlockBufferBytes", TUnit::BYTES, prefix);
+        _profile.datacache_readahead_counter =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadAheadCounter", TUnit::UNIT, prefix);
+        _profile.datacache_readahead_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "DataCacheReadAheadBytes", TUnit::BYTES, prefix);
+        _profile.datacache_readahead_wait_timer =
+                ADD_CHILD_TIMER(_runtime_profile, "DataCacheReadAheadWaitTimer", prefix);
     }
 
     {
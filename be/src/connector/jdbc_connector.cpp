@@ -45,6 +45,29 @@ const TupleDescriptor* JDBCDataSourceProvider::tuple_descriptor(RuntimeState* st
     return state->desc_tbl().get_tuple_descriptor(_jdbc_scan_node.tuple_id);
 }
 
+StatusOr<pipeline::MorselQueuePtr> JDBCDataSourceProvider::convert_scan_range_to_morsel_queue(
+        const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+        bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+        size_t num_total_scan_ranges, size_t scan_parallelism) {
+    if (!_jdbc_scan_node.__isset.split_filters || _jdbc_scan_node.split_filters.empty()) {
+        return DataSourceProvider::convert_scan_range_to_morsel_queue(
+                scan_ranges, node_id, pipeline_dop, enable_tablet_internal_parallel, tablet_internal_parallel_mode,
+                num_total_scan_ranges, scan_parallelism);
+    }
+
+    std::vector<TScanRangeParams> split_scan_ranges;
+    split_scan_ranges.reserve(_jdbc_scan_node.split_filters.size());
+    for (const auto& split_filter : _jdbc_scan_node.split_filters) {
+        TJDBCScanRange jdbc_scan_range;
+        jdbc_scan_range.__set_split_filter(split_filter);
+        TScanRangeParams& params = split_scan_ranges.emplace_back();
+        params.scan_range.__set_jdbc_scan_range(jdbc_scan_range);
+    }
+    return DataSourceProvider::convert_scan_range_to_morsel_queue(
+            split_scan_ranges, node_id, pipeline_dop, enable_tablet_internal_parallel, tablet_internal_parallel_mode,
+            split_scan_ranges.size(), scan_parallelism);
+}
+
 // ================================
 
 static std::string get_jdbc_sql(const Slice jdbc_url, const std::string& table, const std::vector<std::string>& columns,
@@ -78,7 +101,11 @@ static std::string get_jdbc_sql(const Slice jdbc_url, const std::string& table,
 }
 
 JDBCDataSource::JDBCDataSource(const JDBCDataSourceProvider* provider, const TScanRange& scan_range)
-        : _provider(provider) {}
+        : _provider(provider) {
+    if (scan_range.__isset.jdbc_scan_range && scan_range.jdbc_scan_range.__isset.split_filter) {
+        _split_filter = scan_range.jdbc_scan_range.split_filter;
+    }
+}
 
 std::string JDBCDataSource::name() const {
     return "JDBCDataSource";
@@ -150,8 +177,12 @@ Status JDBCDataSource::_create_scanner(RuntimeState* state) {
     scan_ctx.jdbc_url = jdbc_table->jdbc_url();
     scan_ctx.user = jdbc_table->jdbc_user();
     scan_ctx.passwd = jdbc_table->jdbc_passwd();
-    scan_ctx.sql = get_jdbc_sql(scan_ctx.jdbc_url, jdbc_scan_node.table_name, jdbc_scan_node.columns,
-                                jdbc_scan_node.filters, _read_limit);
+    std::vector<std::string> filters = jdbc_scan_node.filters;
+    if (!_split_filter.empty()) {
+        filters.emplace_back(_split_filter);
+    }
+    scan_ctx.sql = get_jdbc_sql(scan_ctx.jdbc_url, jdbc_scan_node.table_name, jdbc_scan_node.columns, filters,
+                                _read_limit);
     _scanner = _pool->add(new JDBCScanner(scan_ctx, _tuple_desc, _runtime_profile));
 
     RETURN_IF_ERROR(_scanner->open(state));
@@ -47,6 +47,13 @@ public:
     bool accept_empty_scan_ranges() const override { return false; }
     const TupleDescriptor* tuple_descriptor(RuntimeState* state) const override;
 
+    // Reads each split of the scan planned by FE as a morsel, so that the splits are read in parallel, each with
+    // its own connection.
+    StatusOr<pipeline::MorselQueuePtr> convert_scan_range_to_morsel_queue(
+            const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
+            bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
+            size_t num_total_scan_ranges, size_t scan_parallelism = 0) override;
+
 protected:
     ConnectorScanNode* _scan_node;
     const TJDBCScanNode _jdbc_scan_node;
@@ -76,6 +83,8 @@ private:
     ObjectPool* _pool = &_obj_pool;
     RuntimeState* _runtime_state = nullptr;
     JDBCScanner* _scanner = nullptr;
+    // The filter of the split read by the data source, empty if the scan is not split.
+    std::string _split_filter;
     int64_t _rows_read = 0;
     int64_t _bytes_read = 0;
 };
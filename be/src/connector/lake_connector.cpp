@@ -22,6 +22,7 @@
 #include "exec/pipeline/fragment_context.h"
 #include "runtime/global_dict/parser.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/lake/rowset.h"
 #include "storage/lake/tablet.h"
 #include "storage/olap_runtime_range_pruner.hpp"
 #include "storage/predicate_parser.h"
@@ -347,8 +348,19 @@ Status LakeDataSource::init_tablet_reader(RuntimeState* runtime_state) {
         _params.plan_node_id = _morsel->get_plan_node_id();
         _params.scan_range = _morsel->get_scan_range();
     }
-    ASSIGN_OR_RETURN(_reader,
-                     _tablet.new_reader(std::move(child_schema), need_split, _provider->could_split_physically()));
+    if (_morsel->has_delta_rowsets()) {
+        // The query cache holds the partial result of the rowsets of the cached version, so only the delta rowsets
+        // appended after it are read.
+        std::vector<lake::RowsetPtr> rowsets;
+        for (const auto& rowset : _morsel->rowsets()) {
+            rowsets.emplace_back(std::static_pointer_cast<lake::Rowset>(rowset));
+        }
+        _reader = std::make_shared<lake::TabletReader>(_tablet.tablet_manager(), _tablet.metadata(),
+                                                       std::move(child_schema), std::move(rowsets), _tablet_schema);
+    } else {
+        ASSIGN_OR_RETURN(_reader,
+                         _tablet.new_reader(std::move(child_schema), need_split, _provider->could_split_physically()));
+    }
     if (reader_columns.size() == scanner_columns.size()) {
         _prj_iter = _reader;
     } else {
@@ -30,6 +30,7 @@
 #include "gutil/casts.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/mem_pool.h"
+#include "runtime/memory/huge_page_allocator.h"
 #include "util/fixed_hash_map.h"
 #include "util/hash_util.hpp"
 #include "util/phmap/phmap.h"
@@ -39,39 +40,50 @@ namespace starrocks {
 
 using AggDataPtr = uint8_t*;
 
+// The buckets of a large one level hash map are probed randomly, so allocate them from huge pages.
+template <typename K, typename Hash, typename Eq = phmap::priv::hash_default_eq<K>>
+using AggFlatHashMap =
+        phmap::flat_hash_map<K, AggDataPtr, Hash, Eq, HugePageAllocator<phmap::priv::Pair<const K, AggDataPtr>>>;
+
 // =====================
 // one level agg hash map
 template <PhmapSeed seed>
 using Int8AggHashMap = SmallFixedSizeHashMap<int8_t, AggDataPtr, seed>;
 template <PhmapSeed seed>
-using Int16AggHashMap = phmap::flat_hash_map<int16_t, AggDataPtr, StdHashWithSeed<int16_t, seed>>;
+using Int16AggHashMap = AggFlatHashMap<int16_t, StdHashWithSeed<int16_t, seed>>;
+template <PhmapSeed seed>
+using Int32AggHashMap = AggFlatHashMap<int32_t, StdHashWithSeed<int32_t, seed>>;
 template <PhmapSeed seed>
-using Int32AggHashMap = phmap::flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int64AggHashMap = AggFlatHashMap<int64_t, StdHashWithSeed<int64_t, seed>>;
 template <PhmapSeed seed>
-using Int64AggHashMap = phmap::flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
+using Int128AggHashMap = AggFlatHashMap<int128_t, Hash128WithSeed<seed>>;
 template <PhmapSeed seed>
-using Int128AggHashMap = phmap::flat_hash_map<int128_t, AggDataPtr, Hash128WithSeed<seed>>;
+using DateAggHashMap = AggFlatHashMap<DateValue, StdHashWithSeed<DateValue, seed>>;
 template <PhmapSeed seed>
-using DateAggHashMap = phmap::flat_hash_map<DateValue, AggDataPtr, StdHashWithSeed<DateValue, seed>>;
+using TimeStampAggHashMap = AggFlatHashMap<TimestampValue, StdHashWithSeed<TimestampValue, seed>>;
 template <PhmapSeed seed>
-using TimeStampAggHashMap = phmap::flat_hash_map<TimestampValue, AggDataPtr, StdHashWithSeed<TimestampValue, seed>>;
+using SliceAggHashMap = AggFlatHashMap<Slice, SliceHashWithSeed<seed>, SliceEqual>;
+
+// ==================
+// one level direct-addressed hash map for keys in a small known range, e.g. low cardinality dict codes
 template <PhmapSeed seed>
-using SliceAggHashMap = phmap::flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual>;
+using DenseInt32AggHashMap = DenseRangeHashMap<int32_t, AggDataPtr, seed>;
 
 // ==================
 // one level fixed size slice hash map
 template <PhmapSeed seed>
-using FixedSize4SliceAggHashMap = phmap::flat_hash_map<SliceKey4, AggDataPtr, FixedSizeSliceKeyHash<SliceKey4, seed>>;
+using FixedSize4SliceAggHashMap = AggFlatHashMap<SliceKey4, FixedSizeSliceKeyHash<SliceKey4, seed>>;
 template <PhmapSeed seed>
-using FixedSize8SliceAggHashMap = phmap::flat_hash_map<SliceKey8, AggDataPtr, FixedSizeSliceKeyHash<SliceKey8, seed>>;
+using FixedSize8SliceAggHashMap = AggFlatHashMap<SliceKey8, FixedSizeSliceKeyHash<SliceKey8, seed>>;
 template <PhmapSeed seed>
-using FixedSize16SliceAggHashMap =
-        phmap::flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
+using FixedSize16SliceAggHashMap = AggFlatHashMap<SliceKey16, FixedSizeSliceKeyHash<SliceKey16, seed>>;
 
 // =====================
 // two level agg hash map
 template <PhmapSeed seed>
 using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+template <PhmapSeed seed>
+using Int64AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int64_t, AggDataPtr, StdHashWithSeed<int64_t, seed>>;
 
 // The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
 // The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
@@ -584,6 +596,131 @@ using AggHashMapWithOneStringKey = AggHashMapWithOneStringKeyWithNullable<HashMa
 template <typename HashMap>
 using AggHashMapWithOneNullableStringKey = AggHashMapWithOneStringKeyWithNullable<HashMap, true>;
 
+// The caller must make sure no key of key_columns is longer than AGG_SHORT_STRING_MAX_SIZE,
+// see AggHashMapVariant::try_convert_short_string_keys.
+template <typename HashMap, bool is_nullable>
+struct AggHashMapWithOneShortStringKeyWithNullable
+        : public AggHashMapWithKey<HashMap, AggHashMapWithOneShortStringKeyWithNullable<HashMap, is_nullable>> {
+    using Self = AggHashMapWithOneShortStringKeyWithNullable<HashMap, is_nullable>;
+    using Base = AggHashMapWithKey<HashMap, Self>;
+    using KeyType = typename HashMap::key_type;
+    using Iterator = typename HashMap::iterator;
+    using ResultVector = Buffer<KeyType>;
+    static_assert(std::is_same_v<KeyType, SliceKey16>);
+    static_assert(sizeof(KeyType) == sizeof(Slice));
+
+    template <class... Args>
+    AggHashMapWithOneShortStringKeyWithNullable(Args&&... args) : Base(std::forward<Args>(args)...) {}
+
+    AggDataPtr get_null_key_data() { return null_key_data; }
+
+    template <typename Func, bool allocate_and_compute_state, bool compute_not_founds>
+    ALWAYS_NOINLINE void compute_agg_states(size_t chunk_size, const Columns& key_columns, MemPool* pool,
+                                            Func&& allocate_func, Buffer<AggDataPtr>* agg_states,
+                                            Filter* not_founds) {
+        // Assign not_founds vector when needs compute not founds.
+        if constexpr (compute_not_founds) {
+            DCHECK(not_founds);
+            (*not_founds).assign(chunk_size, 0);
+        }
+
+        const BinaryColumn* column = nullptr;
+        const uint8_t* null_data = nullptr;
+        if constexpr (is_nullable) {
+            DCHECK(key_columns[0]->is_nullable());
+            if (key_columns[0]->only_null()) {
+                if (null_key_data == nullptr) {
+                    null_key_data = allocate_func(nullptr);
+                }
+                for (size_t i = 0; i < chunk_size; i++) {
+                    (*agg_states)[i] = null_key_data;
+                }
+                return;
+            }
+            auto* nullable_column = down_cast<NullableColumn*>(key_columns[0].get());
+            column = down_cast<BinaryColumn*>(nullable_column->data_column().get());
+            if (nullable_column->has_null()) {
+                null_data = nullable_column->null_column_data().data();
+            }
+        } else {
+            DCHECK(key_columns[0]->is_binary());
+            column = down_cast<BinaryColumn*>(key_columns[0].get());
+        }
+
+        caches.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; i++) {
+            caches[i].key = to_short_string_key(column->get_slice(i));
+            caches[i].hashval = this->hash_map.hash_function()(caches[i].key);
+        }
+
+        const bool need_prefetch = this->hash_map.bucket_count() >= prefetch_threhold;
+        size_t __prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
+        for (size_t i = 0; i < chunk_size; i++) {
+            if (need_prefetch && __prefetch_index < chunk_size) {
+                this->hash_map.prefetch_hash(caches[__prefetch_index++].hashval);
+            }
+            if (null_data != nullptr && null_data[i]) {
+                if (UNLIKELY(null_key_data == nullptr)) {
+                    null_key_data = allocate_func(nullptr);
+                }
+                (*agg_states)[i] = null_key_data;
+                continue;
+            }
+            const KeyType& key = caches[i].key;
+            if constexpr (allocate_and_compute_state) {
+                auto iter = this->hash_map.lazy_emplace_with_hash(key, caches[i].hashval, [&](const auto& ctor) {
+                    if constexpr (compute_not_founds) {
+                        (*not_founds)[i] = 1;
+                    }
+                    ctor(key, allocate_func(key));
+                });
+                (*agg_states)[i] = iter->second;
+            } else if constexpr (compute_not_founds) {
+                if (auto iter = this->hash_map.find(key, caches[i].hashval); iter != this->hash_map.end()) {
+                    (*agg_states)[i] = iter->second;
+                } else {
+                    (*not_founds)[i] = 1;
+                }
+            }
+        }
+    }
+
+    void insert_keys_to_columns(ResultVector& keys, const Columns& key_columns, size_t chunk_size) {
+        tmp_slices.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; i++) {
+            tmp_slices[i] = short_string_key_to_slice(keys[i]);
+        }
+        if constexpr (is_nullable) {
+            DCHECK(key_columns[0]->is_nullable());
+            auto* nullable_column = down_cast<NullableColumn*>(key_columns[0].get());
+            auto* column = down_cast<BinaryColumn*>(nullable_column->mutable_data_column());
+            column->append_strings(tmp_slices.data(), chunk_size);
+            nullable_column->null_column_data().resize(chunk_size);
+        } else {
+            DCHECK(!null_key_data);
+            auto* column = down_cast<BinaryColumn*>(key_columns[0].get());
+            column->append_strings(tmp_slices.data(), chunk_size);
+        }
+    }
+
+    static constexpr bool has_single_null_key = is_nullable;
+
+    struct CacheEntry {
+        KeyType key;
+        size_t hashval;
+    };
+    std::vector<CacheEntry> caches;
+
+    AggDataPtr null_key_data = nullptr;
+    ResultVector results;
+    Buffer<Slice> tmp_slices;
+};
+
+template <typename HashMap>
+using AggHashMapWithOneShortStringKey = AggHashMapWithOneShortStringKeyWithNullable<HashMap, false>;
+template <typename HashMap>
+using AggHashMapWithOneNullableShortStringKey = AggHashMapWithOneShortStringKeyWithNullable<HashMap, true>;
+
 template <typename HashMap>
 struct AggHashMapWithSerializedKey : public AggHashMapWithKey<HashMap, AggHashMapWithSerializedKey<HashMap>> {
     using Base = AggHashMapWithKey<HashMap, AggHashMapWithSerializedKey<HashMap>>;
@@ -68,6 +68,28 @@ template <PhmapSeed seed>
 using SliceAggHashSet =
         phmap::flat_hash_set<TSliceWithHash<seed>, THashOnSliceWithHash<seed>, TEqualOnSliceWithHash<seed>>;
 
+// ==================
+// one level direct-addressed hash set for keys in a small known range, e.g. low cardinality dict codes
+template <PhmapSeed seed>
+using DenseInt32AggHashSet = DenseRangeHashSet<int32_t, seed>;
+
+// Return true if the (nullable) int key column holds a value out of the range of the dense key tables.
+inline bool has_out_of_range_dense_key(const Column* key_column) {
+    if (key_column->only_null()) {
+        return false;
+    }
+    if (key_column->is_nullable()) {
+        key_column = down_cast<const NullableColumn*>(key_column)->data_column().get();
+    }
+    const auto& keys = down_cast<const Int32Column*>(key_column)->get_data();
+    // a negative key is out of range as a large unsigned one
+    uint32_t max_key = 0;
+    for (int32_t key : keys) {
+        max_key = std::max<uint32_t>(max_key, static_cast<uint32_t>(key));
+    }
+    return max_key >= DenseInt32AggHashSet<PhmapSeed1>::max_range;
+}
+
 // ==================
 // one level fixed size slice hash set
 template <PhmapSeed seed>
@@ -77,10 +99,48 @@ using FixedSize8SliceAggHashSet = phmap::flat_hash_set<SliceKey8, FixedSizeSlice
 template <PhmapSeed seed>
 using FixedSize16SliceAggHashSet = phmap::flat_hash_set<SliceKey16, FixedSizeSliceKeyHash<SliceKey16, seed>>;
 
+// =====================
+// short string key
+// A string key of at most AGG_SHORT_STRING_MAX_SIZE bytes is stored inline in a SliceKey16:
+// the bytes zero padded, followed by the length in the last byte. So a compare is a 128-bit compare
+// and no memory is taken from the MemPool for the key.
+static constexpr size_t AGG_SHORT_STRING_MAX_SIZE = sizeof(SliceKey16) - 1;
+
+inline SliceKey16 to_short_string_key(const Slice& slice) {
+    DCHECK_LE(slice.size, AGG_SHORT_STRING_MAX_SIZE);
+    SliceKey16 key;
+    key.u.value = 0;
+    memcpy(key.u.data, slice.data, slice.size);
+    key.u.size = slice.size;
+    return key;
+}
+
+inline Slice short_string_key_to_slice(const SliceKey16& key) {
+    return {key.u.data, key.u.size};
+}
+
+// Return true if the (nullable) binary key column holds a value too long to be a short string key.
+inline bool has_overflow_short_string_key(const Column* key_column) {
+    if (key_column->only_null()) {
+        return false;
+    }
+    if (key_column->is_nullable()) {
+        key_column = down_cast<const NullableColumn*>(key_column)->data_column().get();
+    }
+    const auto& offsets = down_cast<const BinaryColumn*>(key_column)->get_offset();
+    uint32_t max_size = 0;
+    for (size_t i = 1; i < offsets.size(); i++) {
+        max_size = std::max<uint32_t>(max_size, offsets[i] - offsets[i - 1]);
+    }
+    return max_size > AGG_SHORT_STRING_MAX_SIZE;
+}
+
 // =====================
 // two level agg hash set
 template <PhmapSeed seed>
 using Int32AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
+template <PhmapSeed seed>
+using Int64AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int64_t, StdHashWithSeed<int64_t, seed>>;
 
 template <PhmapSeed seed>
 using SliceAggTwoLevelHashSet =
@@ -110,6 +170,8 @@ template <typename T>
 struct no_prefetch_set : std::false_type {};
 template <PhmapSeed seed>
 struct no_prefetch_set<Int8AggHashSet<seed>> : std::true_type {};
+template <PhmapSeed seed>
+struct no_prefetch_set<DenseInt32AggHashSet<seed>> : std::true_type {};
 
 template <class T>
 constexpr bool is_no_prefetch_set = no_prefetch_set<T>::value;
@@ -494,8 +556,99 @@ struct AggHashSetOfOneNullableStringKey : public AggHashSet<HashSet, AggHashSetO
     std::vector<KeyType> cache;
 };
 
+// The caller must make sure no key of key_columns is longer than AGG_SHORT_STRING_MAX_SIZE,
+// see AggHashSetVariant::try_convert_short_string_keys.
+template <typename HashSet, bool is_nullable>
+struct AggHashSetOfOneShortStringKeyWithNullable
+        : public AggHashSet<HashSet, AggHashSetOfOneShortStringKeyWithNullable<HashSet, is_nullable>> {
+    using Iterator = typename HashSet::iterator;
+    using KeyType = typename HashSet::key_type;
+    using ResultVector = Buffer<KeyType>;
+    static_assert(std::is_same_v<KeyType, SliceKey16>);
+
+    AggHashSetOfOneShortStringKeyWithNullable(int32_t chunk_size) {}
+
+    template <bool compute_and_allocate>
+    void build_set(size_t chunk_size, const Columns& key_columns, MemPool* pool, Filter* not_founds) {
+        if constexpr (!compute_and_allocate) {
+            DCHECK(not_founds);
+            not_founds->assign(chunk_size, 0);
+        }
+
+        const BinaryColumn* column = nullptr;
+        const uint8_t* null_data = nullptr;
+        if constexpr (is_nullable) {
+            DCHECK(key_columns[0]->is_nullable());
+            if (key_columns[0]->only_null()) {
+                has_null_key = true;
+                return;
+            }
+            auto* nullable_column = down_cast<NullableColumn*>(key_columns[0].get());
+            column = down_cast<BinaryColumn*>(nullable_column->data_column().get());
+            if (nullable_column->has_null()) {
+                null_data = nullable_column->null_column_data().data();
+            }
+        } else {
+            DCHECK(key_columns[0]->is_binary());
+            column = down_cast<BinaryColumn*>(key_columns[0].get());
+        }
+
+        key_cache.resize(chunk_size);
+        hashes.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            key_cache[i] = to_short_string_key(column->get_slice(i));
+            hashes[i] = this->hash_set.hash_function()(key_cache[i]);
+        }
+
+        const bool need_prefetch = this->hash_set.bucket_count() >= prefetch_threhold;
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (need_prefetch) {
+                AGG_HASH_SET_PREFETCH_HASH_VAL();
+            }
+            if (null_data != nullptr && null_data[i]) {
+                has_null_key = true;
+                continue;
+            }
+            if constexpr (compute_and_allocate) {
+                this->hash_set.emplace_with_hash(hashes[i], key_cache[i]);
+            } else {
+                (*not_founds)[i] = this->hash_set.find(key_cache[i], hashes[i]) == this->hash_set.end();
+            }
+        }
+    }
+
+    void insert_keys_to_columns(ResultVector& keys, const Columns& key_columns, size_t chunk_size) {
+        tmp_slices.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            tmp_slices[i] = short_string_key_to_slice(keys[i]);
+        }
+        if constexpr (is_nullable) {
+            DCHECK(key_columns[0]->is_nullable());
+            auto* nullable_column = down_cast<NullableColumn*>(key_columns[0].get());
+            auto* column = down_cast<BinaryColumn*>(nullable_column->mutable_data_column());
+            column->append_strings(tmp_slices.data(), chunk_size);
+            nullable_column->null_column_data().resize(chunk_size);
+        } else {
+            auto* column = down_cast<BinaryColumn*>(key_columns[0].get());
+            column->append_strings(tmp_slices.data(), chunk_size);
+        }
+    }
+
+    static constexpr bool has_single_null_key = is_nullable;
+    bool has_null_key = false;
+    ResultVector results;
+    std::vector<KeyType> key_cache;
+    std::vector<size_t> hashes;
+    Buffer<Slice> tmp_slices;
+};
+
+template <typename HashSet>
+using AggHashSetOfOneShortStringKey = AggHashSetOfOneShortStringKeyWithNullable<HashSet, false>;
+template <typename HashSet>
+using AggHashSetOfOneNullableShortStringKey = AggHashSetOfOneShortStringKeyWithNullable<HashSet, true>;
+
 template <typename HashSet>
-struct AggHashSetOfSerializedKey : public AggHashSet<HashSet, AggHashSetOfSerializedKey<HashSet>> {
+struct AggHashSetOfSerializedKey: public AggHashSet<HashSet, AggHashSetOfSerializedKey<HashSet>> {
     using Iterator = typename HashSet::iterator;
     // using ResultVector = typename std::vector<Slice>;
     using ResultVector = Buffer<Slice>;
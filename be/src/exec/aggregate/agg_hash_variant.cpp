@@ -58,6 +58,7 @@ DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_null_string, NullOneStringAggHas
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_slice, SerializedKeyAggHashMap<PhmapSeed1>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_slice_two_level, SerializedKeyTwoLevelAggHashMap<PhmapSeed1>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_int32_two_level, Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_int64_two_level, Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_slice_fx4, SerializedKeyFixedSize4AggHashMap<PhmapSeed1>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_slice_fx8, SerializedKeyFixedSize8AggHashMap<PhmapSeed1>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_slice_fx16, SerializedKeyFixedSize16AggHashMap<PhmapSeed1>);
@@ -88,10 +89,21 @@ DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_null_string, NullOneStringAggHas
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice, SerializedKeyAggHashMap<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_two_level, SerializedKeyTwoLevelAggHashMap<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_int32_two_level, Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_int64_two_level, Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx4, SerializedKeyFixedSize4AggHashMap<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx8, SerializedKeyFixedSize8AggHashMap<PhmapSeed2>);
 DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_slice_fx16, SerializedKeyFixedSize16AggHashMap<PhmapSeed2>);
 
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_short_string, OneShortStringAggHashMap<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_short_string, OneShortStringAggHashMap<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_null_short_string, NullOneShortStringAggHashMap<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_null_short_string, NullOneShortStringAggHashMap<PhmapSeed2>);
+
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_dense_int32, DenseInt32AggHashMapWithOneNumberKey<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_dense_int32, DenseInt32AggHashMapWithOneNumberKey<PhmapSeed2>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase1_null_dense_int32, NullDenseInt32AggHashMapWithOneNumberKey<PhmapSeed1>);
+DEFINE_MAP_TYPE(AggHashMapVariant::Type::phase2_null_dense_int32, NullDenseInt32AggHashMapWithOneNumberKey<PhmapSeed2>);
+
 template <AggHashSetVariant::Type>
 struct AggHashSetVariantTypeTraits;
 
@@ -128,6 +140,7 @@ DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_null_string, NullOneStringAggHas
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice, SerializedKeyAggHashSet<PhmapSeed1>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_two_level, SerializedTwoLevelKeyAggHashSet<PhmapSeed1>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_int32_two_level, Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_int64_two_level, Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_uint8, UInt8AggHashSetOfOneNumberKey<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_int8, Int8AggHashSetOfOneNumberKey<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_int16, Int16AggHashSetOfOneNumberKey<PhmapSeed2>);
@@ -155,6 +168,7 @@ DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_null_string, NullOneStringAggHas
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice, SerializedKeyAggHashSet<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_two_level, SerializedTwoLevelKeyAggHashSet<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_int32_two_level, Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_int64_two_level, Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_fx4, SerializedKeyAggHashSetFixedSize4<PhmapSeed1>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_fx8, SerializedKeyAggHashSetFixedSize8<PhmapSeed1>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_slice_fx16, SerializedKeyAggHashSetFixedSize16<PhmapSeed1>);
@@ -162,6 +176,16 @@ DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx4, SerializedKeyAggHashS
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx8, SerializedKeyAggHashSetFixedSize8<PhmapSeed2>);
 DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_slice_fx16, SerializedKeyAggHashSetFixedSize16<PhmapSeed2>);
 
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_short_string, OneShortStringAggHashSet<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_short_string, OneShortStringAggHashSet<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_null_short_string, NullOneShortStringAggHashSet<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_null_short_string, NullOneShortStringAggHashSet<PhmapSeed2>);
+
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_dense_int32, DenseInt32AggHashSetOfOneNumberKey<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_dense_int32, DenseInt32AggHashSetOfOneNumberKey<PhmapSeed2>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase1_null_dense_int32, NullDenseInt32AggHashSetOfOneNumberKey<PhmapSeed1>);
+DEFINE_SET_TYPE(AggHashSetVariant::Type::phase2_null_dense_int32, NullDenseInt32AggHashSetOfOneNumberKey<PhmapSeed2>);
+
 } // namespace detail
 void AggHashMapVariant::init(RuntimeState* state, Type type, AggStatistics* agg_stat) {
     _type = type;
@@ -199,6 +223,98 @@ void AggHashMapVariant::init(RuntimeState* state, Type type, AggStatistics* agg_
 void AggHashMapVariant::convert_to_two_level(RuntimeState* state) {
     CONVERT_TO_TWO_LEVEL_MAP(phase1_slice_two_level, phase1_slice);
     CONVERT_TO_TWO_LEVEL_MAP(phase2_slice_two_level, phase2_slice);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_int32_two_level, phase1_int32);
+    CONVERT_TO_TWO_LEVEL_MAP(phase1_int64_two_level, phase1_int64);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_int32_two_level, phase2_int32);
+    CONVERT_TO_TWO_LEVEL_MAP(phase2_int64_two_level, phase2_int64);
+}
+
+template <typename VariantType>
+static bool is_short_string_type(typename VariantType::Type type) {
+    using Type = typename VariantType::Type;
+    return type == Type::phase1_short_string || type == Type::phase2_short_string ||
+           type == Type::phase1_null_short_string || type == Type::phase2_null_short_string;
+}
+
+#define CONVERT_SHORT_STRING_TO_STRING_MAP(DST, SRC)                                                            \
+    if (_type == AggHashMapVariant::Type::SRC) {                                                                \
+        auto dst = std::make_unique<detail::AggHashMapVariantTypeTraits<Type::DST>::HashMapWithKeyType>(        \
+                state->chunk_size(), _agg_stat);                                                                \
+        using SrcType = detail::AggHashMapVariantTypeTraits<Type::SRC>::HashMapWithKeyType;                     \
+        std::visit(                                                                                             \
+                [&](auto& hash_map_with_key) {                                                                  \
+                    if constexpr (std::is_same_v<std::decay_t<decltype(*hash_map_with_key)>, SrcType>) {        \
+                        dst->hash_map.reserve(hash_map_with_key->hash_map.capacity());                          \
+                        for (const auto& [key, agg_state] : hash_map_with_key->hash_map) {                      \
+                            Slice src_key = short_string_key_to_slice(key);                                     \
+                            uint8_t* pos =                                                                      \
+                                    pool->allocate_with_reserve(src_key.size, SLICE_MEMEQUAL_OVERFLOW_PADDING); \
+                            strings::memcpy_inlined(pos, src_key.data, src_key.size);                           \
+                            Slice dst_key{pos, src_key.size};                                                   \
+                            /* the key is also kept at the head of the agg state */                             \
+                            *reinterpret_cast<Slice*>(agg_state) = dst_key;                                     \
+                            dst->hash_map.emplace(dst_key, agg_state);                                          \
+                        }                                                                                       \
+                        dst->null_key_data = hash_map_with_key->null_key_data;                                  \
+                    }                                                                                           \
+                },                                                                                              \
+                hash_map_with_key);                                                                             \
+                                                                                                                \
+        _type = AggHashMapVariant::Type::DST;                                                                   \
+        hash_map_with_key = std::move(dst);                                                                     \
+        return;                                                                                                 \
+    }
+
+void AggHashMapVariant::try_convert_short_string_keys(RuntimeState* state, const Columns& key_columns,
+                                                      MemPool* pool) {
+    if (!is_short_string_type<AggHashMapVariant>(_type) || !has_overflow_short_string_key(key_columns[0].get())) {
+        return;
+    }
+    CONVERT_SHORT_STRING_TO_STRING_MAP(phase1_string, phase1_short_string);
+    CONVERT_SHORT_STRING_TO_STRING_MAP(phase2_string, phase2_short_string);
+    CONVERT_SHORT_STRING_TO_STRING_MAP(phase1_null_string, phase1_null_short_string);
+    CONVERT_SHORT_STRING_TO_STRING_MAP(phase2_null_string, phase2_null_short_string);
+}
+
+template <typename VariantType>
+static bool is_dense_int32_type(typename VariantType::Type type) {
+    using Type = typename VariantType::Type;
+    return type == Type::phase1_dense_int32 || type == Type::phase2_dense_int32 ||
+           type == Type::phase1_null_dense_int32 || type == Type::phase2_null_dense_int32;
+}
+
+#define CONVERT_DENSE_TO_INT32_MAP(DST, SRC)                                                             \
+    if (_type == AggHashMapVariant::Type::SRC) {                                                         \
+        auto dst = std::make_unique<detail::AggHashMapVariantTypeTraits<Type::DST>::HashMapWithKeyType>( \
+                state->chunk_size(), _agg_stat);                                                         \
+        using SrcType = detail::AggHashMapVariantTypeTraits<Type::SRC>::HashMapWithKeyType;              \
+        std::visit(                                                                                      \
+                [&](auto& hash_map_with_key) {                                                           \
+                    if constexpr (std::is_same_v<std::decay_t<decltype(*hash_map_with_key)>, SrcType>) { \
+                        auto& src_map = hash_map_with_key->hash_map;                                     \
+                        dst->hash_map.reserve(src_map.size());                                           \
+                        /* both key types are int32, the key kept at the head of the agg state stays */  \
+                        for (auto iter = src_map.begin(); iter != src_map.end(); ++iter) {               \
+                            dst->hash_map.emplace(iter->first, iter->second);                            \
+                        }                                                                                \
+                        dst->null_key_data = hash_map_with_key->null_key_data;                           \
+                    }                                                                                    \
+                },                                                                                       \
+                hash_map_with_key);                                                                      \
+                                                                                                         \
+        _type = AggHashMapVariant::Type::DST;                                                            \
+        hash_map_with_key = std::move(dst);                                                              \
+        return;                                                                                          \
+    }
+
+void AggHashMapVariant::try_convert_dense_keys(RuntimeState* state, const Columns& key_columns) {
+    if (!is_dense_int32_type<AggHashMapVariant>(_type) || !has_out_of_range_dense_key(key_columns[0].get())) {
+        return;
+    }
+    CONVERT_DENSE_TO_INT32_MAP(phase1_int32, phase1_dense_int32);
+    CONVERT_DENSE_TO_INT32_MAP(phase2_int32, phase2_dense_int32);
+    CONVERT_DENSE_TO_INT32_MAP(phase1_null_int32, phase1_null_dense_int32);
+    CONVERT_DENSE_TO_INT32_MAP(phase2_null_int32, phase2_null_dense_int32);
 }
 
 void AggHashMapVariant::reset() {
@@ -273,6 +389,82 @@ void AggHashSetVariant::init(RuntimeState* state, Type type, AggStatistics* agg_
 void AggHashSetVariant::convert_to_two_level(RuntimeState* state) {
     CONVERT_TO_TWO_LEVEL_SET(phase1_slice_two_level, phase1_slice);
     CONVERT_TO_TWO_LEVEL_SET(phase2_slice_two_level, phase2_slice);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_int32_two_level, phase1_int32);
+    CONVERT_TO_TWO_LEVEL_SET(phase1_int64_two_level, phase1_int64);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_int32_two_level, phase2_int32);
+    CONVERT_TO_TWO_LEVEL_SET(phase2_int64_two_level, phase2_int64);
+}
+
+#define CONVERT_SHORT_STRING_TO_STRING_SET(DST, SRC)                                                            \
+    if (_type == AggHashSetVariant::Type::SRC) {                                                                \
+        auto dst = std::make_unique<detail::AggHashSetVariantTypeTraits<Type::DST>::HashSetWithKeyType>(        \
+                state->chunk_size());                                                                           \
+        using SrcType = detail::AggHashSetVariantTypeTraits<Type::SRC>::HashSetWithKeyType;                     \
+        using DstKeyType = typename decltype(dst->hash_set)::key_type;                                          \
+        std::visit(                                                                                             \
+                [&](auto& hash_set_with_key) {                                                                  \
+                    if constexpr (std::is_same_v<std::decay_t<decltype(*hash_set_with_key)>, SrcType>) {        \
+                        dst->hash_set.reserve(hash_set_with_key->hash_set.capacity());                          \
+                        for (const auto& key : hash_set_with_key->hash_set) {                                   \
+                            Slice src_key = short_string_key_to_slice(key);                                     \
+                            uint8_t* pos =                                                                      \
+                                    pool->allocate_with_reserve(src_key.size, SLICE_MEMEQUAL_OVERFLOW_PADDING); \
+                            memcpy(pos, src_key.data, src_key.size);                                            \
+                            dst->hash_set.emplace(DstKeyType(Slice{pos, src_key.size}));                        \
+                        }                                                                                       \
+                        if constexpr (std::decay_t<decltype(*dst)>::has_single_null_key) {                      \
+                            dst->has_null_key = hash_set_with_key->has_null_key;                                \
+                        }                                                                                       \
+                    }                                                                                           \
+                },                                                                                              \
+                hash_set_with_key);                                                                             \
+        _type = AggHashSetVariant::Type::DST;                                                                   \
+        hash_set_with_key = std::move(dst);                                                                     \
+        return;                                                                                                 \
+    }
+
+void AggHashSetVariant::try_convert_short_string_keys(RuntimeState* state, const Columns& key_columns,
+                                                      MemPool* pool) {
+    if (!is_short_string_type<AggHashSetVariant>(_type) || !has_overflow_short_string_key(key_columns[0].get())) {
+        return;
+    }
+    CONVERT_SHORT_STRING_TO_STRING_SET(phase1_string, phase1_short_string);
+    CONVERT_SHORT_STRING_TO_STRING_SET(phase2_string, phase2_short_string);
+    CONVERT_SHORT_STRING_TO_STRING_SET(phase1_null_string, phase1_null_short_string);
+    CONVERT_SHORT_STRING_TO_STRING_SET(phase2_null_string, phase2_null_short_string);
+}
+
+#define CONVERT_DENSE_TO_INT32_SET(DST, SRC)                                                             \
+    if (_type == AggHashSetVariant::Type::SRC) {                                                         \
+        auto dst = std::make_unique<detail::AggHashSetVariantTypeTraits<Type::DST>::HashSetWithKeyType>( \
+                state->chunk_size());                                                                    \
+        using SrcType = detail::AggHashSetVariantTypeTraits<Type::SRC>::HashSetWithKeyType;              \
+        std::visit(                                                                                      \
+                [&](auto& hash_set_with_key) {                                                           \
+                    if constexpr (std::is_same_v<std::decay_t<decltype(*hash_set_with_key)>, SrcType>) { \
+                        dst->hash_set.reserve(hash_set_with_key->hash_set.size());                       \
+                        for (auto key : hash_set_with_key->hash_set) {                                   \
+                            dst->hash_set.emplace(key);                                                  \
+                        }                                                                                \
+                        if constexpr (std::decay_t<decltype(*dst)>::has_single_null_key) {              \
+                            dst->has_null_key = hash_set_with_key->has_null_key;                         \
+                        }                                                                                \
+                    }                                                                                    \
+                },                                                                                       \
+                hash_set_with_key);                                                                      \
+        _type = AggHashSetVariant::Type::DST;                                                            \
+        hash_set_with_key = std::move(dst);                                                              \
+        return;                                                                                          \
+    }
+
+void AggHashSetVariant::try_convert_dense_keys(RuntimeState* state, const Columns& key_columns) {
+    if (!is_dense_int32_type<AggHashSetVariant>(_type) || !has_out_of_range_dense_key(key_columns[0].get())) {
+        return;
+    }
+    CONVERT_DENSE_TO_INT32_SET(phase1_int32, phase1_dense_int32);
+    CONVERT_DENSE_TO_INT32_SET(phase2_int32, phase2_dense_int32);
+    CONVERT_DENSE_TO_INT32_SET(phase1_null_int32, phase1_null_dense_int32);
+    CONVERT_DENSE_TO_INT32_SET(phase2_null_int32, phase2_null_dense_int32);
 }
 
 void AggHashSetVariant::reset() {
@@ -57,6 +57,7 @@ namespace starrocks {
     M(phase1_null_string)            \
     M(phase1_slice_two_level)        \
     M(phase1_int32_two_level)        \
+    M(phase1_int64_two_level)        \
     M(phase2_uint8)                  \
     M(phase2_int8)                   \
     M(phase2_int16)                  \
@@ -84,12 +85,21 @@ namespace starrocks {
     M(phase2_null_string)            \
     M(phase2_slice_two_level)        \
     M(phase2_int32_two_level)        \
+    M(phase2_int64_two_level)        \
     M(phase1_slice_fx4)              \
     M(phase1_slice_fx8)              \
     M(phase1_slice_fx16)             \
     M(phase2_slice_fx4)              \
     M(phase2_slice_fx8)              \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)             \
+    M(phase1_short_string)           \
+    M(phase2_short_string)           \
+    M(phase1_null_short_string)      \
+    M(phase2_null_short_string)      \
+    M(phase1_dense_int32)            \
+    M(phase2_dense_int32)            \
+    M(phase1_null_dense_int32)       \
+    M(phase2_null_dense_int32)
 
 // Aggregate Hash maps
 
@@ -156,6 +166,8 @@ template <PhmapSeed seed>
 using SerializedKeyTwoLevelAggHashMap = AggHashMapWithSerializedKey<SliceAggTwoLevelHashMap<seed>>;
 template <PhmapSeed seed>
 using Int32TwoLevelAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, Int32AggTwoLevelHashMap<seed>>;
+template <PhmapSeed seed>
+using Int64TwoLevelAggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_BIGINT, Int64AggTwoLevelHashMap<seed>>;
 
 // fixed slice key type.
 template <PhmapSeed seed>
@@ -165,6 +177,19 @@ using SerializedKeyFixedSize8AggHashMap = AggHashMapWithSerializedKeyFixedSize<F
 template <PhmapSeed seed>
 using SerializedKeyFixedSize16AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize16SliceAggHashMap<seed>>;
 
+// short string key type.
+template <PhmapSeed seed>
+using OneShortStringAggHashMap = AggHashMapWithOneShortStringKey<FixedSize16SliceAggHashMap<seed>>;
+template <PhmapSeed seed>
+using NullOneShortStringAggHashMap = AggHashMapWithOneNullableShortStringKey<FixedSize16SliceAggHashMap<seed>>;
+
+// dense int key type.
+template <PhmapSeed seed>
+using DenseInt32AggHashMapWithOneNumberKey = AggHashMapWithOneNumberKey<TYPE_INT, DenseInt32AggHashMap<seed>>;
+template <PhmapSeed seed>
+using NullDenseInt32AggHashMapWithOneNumberKey =
+        AggHashMapWithOneNullableNumberKey<TYPE_INT, DenseInt32AggHashMap<seed>>;
+
 // Hash sets
 //
 template <PhmapSeed seed>
@@ -228,6 +253,8 @@ template <PhmapSeed seed>
 using SerializedTwoLevelKeyAggHashSet = AggHashSetOfSerializedKey<SliceAggTwoLevelHashSet<seed>>;
 template <PhmapSeed seed>
 using Int32TwoLevelAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, Int32AggTwoLevelHashSet<seed>>;
+template <PhmapSeed seed>
+using Int64TwoLevelAggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_BIGINT, Int64AggTwoLevelHashSet<seed>>;
 
 // For fixed slice type.
 template <PhmapSeed seed>
@@ -239,6 +266,19 @@ using SerializedKeyAggHashSetFixedSize8 = AggHashSetOfSerializedKeyFixedSize<Fix
 template <PhmapSeed seed>
 using SerializedKeyAggHashSetFixedSize16 = AggHashSetOfSerializedKeyFixedSize<FixedSize16SliceAggHashSet<seed>>;
 
+// For short string type.
+template <PhmapSeed seed>
+using OneShortStringAggHashSet = AggHashSetOfOneShortStringKey<FixedSize16SliceAggHashSet<seed>>;
+template <PhmapSeed seed>
+using NullOneShortStringAggHashSet = AggHashSetOfOneNullableShortStringKey<FixedSize16SliceAggHashSet<seed>>;
+
+// For dense int type.
+template <PhmapSeed seed>
+using DenseInt32AggHashSetOfOneNumberKey = AggHashSetOfOneNumberKey<TYPE_INT, DenseInt32AggHashSet<seed>>;
+template <PhmapSeed seed>
+using NullDenseInt32AggHashSetOfOneNumberKey =
+        AggHashSetOfOneNullableNumberKey<TYPE_INT, DenseInt32AggHashSet<seed>>;
+
 // aggregate key
 template <class HashMapWithKey>
 struct CombinedFixedSizeKey {
@@ -260,8 +300,10 @@ inline constexpr bool is_combined_fixed_size_key = CombinedFixedSizeKey<HashMapO
 
 static_assert(is_combined_fixed_size_key<SerializedKeyFixedSize4AggHashMap<PhmapSeed1>>);
 static_assert(!is_combined_fixed_size_key<Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>);
+static_assert(!is_combined_fixed_size_key<Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>);
 static_assert(is_combined_fixed_size_key<SerializedKeyAggHashSetFixedSize4<PhmapSeed1>>);
 static_assert(!is_combined_fixed_size_key<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>);
+static_assert(!is_combined_fixed_size_key<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>);
 
 // 1) For different group by columns type, size, cardinality, volume, we should choose different
 // hash functions and different hashmaps.
@@ -303,6 +345,7 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringAggHashMap<PhmapSeed1>>, std::unique_ptr<SerializedKeyAggHashMap<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyTwoLevelAggHashMap<PhmapSeed1>>,
         std::unique_ptr<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed1>>,
@@ -332,9 +375,17 @@ using AggHashMapWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringAggHashMap<PhmapSeed2>>, std::unique_ptr<SerializedKeyAggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyTwoLevelAggHashMap<PhmapSeed2>>,
         std::unique_ptr<Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>>,
+        std::unique_ptr<OneShortStringAggHashMap<PhmapSeed1>>, std::unique_ptr<OneShortStringAggHashMap<PhmapSeed2>>,
+        std::unique_ptr<NullOneShortStringAggHashMap<PhmapSeed1>>,
+        std::unique_ptr<NullOneShortStringAggHashMap<PhmapSeed2>>,
+        std::unique_ptr<DenseInt32AggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<DenseInt32AggHashMapWithOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullDenseInt32AggHashMapWithOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullDenseInt32AggHashMapWithOneNumberKey<PhmapSeed2>>>;
 
 using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<UInt8AggHashSetOfOneNumberKey<PhmapSeed1>>,
@@ -363,6 +414,7 @@ using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringAggHashSet<PhmapSeed1>>, std::unique_ptr<SerializedKeyAggHashSet<PhmapSeed1>>,
         std::unique_ptr<SerializedTwoLevelKeyAggHashSet<PhmapSeed1>>,
         std::unique_ptr<Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed1>>,
         std::unique_ptr<UInt8AggHashSetOfOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<Int8AggHashSetOfOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<Int16AggHashSetOfOneNumberKey<PhmapSeed2>>,
@@ -389,12 +441,20 @@ using AggHashSetWithKeyPtr = std::variant<
         std::unique_ptr<NullOneStringAggHashSet<PhmapSeed2>>, std::unique_ptr<SerializedKeyAggHashSet<PhmapSeed2>>,
         std::unique_ptr<SerializedTwoLevelKeyAggHashSet<PhmapSeed2>>,
         std::unique_ptr<Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<Int64TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed1>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed2>>,
         std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed2>>,
-        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>>;
+        std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>>,
+        std::unique_ptr<OneShortStringAggHashSet<PhmapSeed1>>, std::unique_ptr<OneShortStringAggHashSet<PhmapSeed2>>,
+        std::unique_ptr<NullOneShortStringAggHashSet<PhmapSeed1>>,
+        std::unique_ptr<NullOneShortStringAggHashSet<PhmapSeed2>>,
+        std::unique_ptr<DenseInt32AggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<DenseInt32AggHashSetOfOneNumberKey<PhmapSeed2>>,
+        std::unique_ptr<NullDenseInt32AggHashSetOfOneNumberKey<PhmapSeed1>>,
+        std::unique_ptr<NullDenseInt32AggHashSetOfOneNumberKey<PhmapSeed2>>>;
 } // namespace detail
 struct AggHashMapVariant {
     enum class Type {
@@ -425,6 +485,7 @@ struct AggHashMapVariant {
         phase1_slice,
         phase1_slice_two_level,
         phase1_int32_two_level,
+        phase1_int64_two_level,
 
         phase1_slice_fx4,
         phase1_slice_fx8,
@@ -457,10 +518,21 @@ struct AggHashMapVariant {
         phase2_slice,
         phase2_slice_two_level,
         phase2_int32_two_level,
+        phase2_int64_two_level,
 
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        phase1_short_string,
+        phase2_short_string,
+        phase1_null_short_string,
+        phase2_null_short_string,
+
+        phase1_dense_int32,
+        phase2_dense_int32,
+        phase1_null_dense_int32,
+        phase2_null_dense_int32,
     };
 
     detail::AggHashMapWithKeyPtr hash_map_with_key;
@@ -475,6 +547,14 @@ struct AggHashMapVariant {
 
     void convert_to_two_level(RuntimeState* state);
 
+    // Short string key maps only hold keys up to AGG_SHORT_STRING_MAX_SIZE bytes,
+    // switch to the general string key map before building with a chunk that has a longer key.
+    void try_convert_short_string_keys(RuntimeState* state, const Columns& key_columns, MemPool* pool);
+
+    // Dense int key maps only hold keys in [0, DenseRangeHashMap::max_range),
+    // switch to the int32 key map before building with a chunk that has a key out of range.
+    void try_convert_dense_keys(RuntimeState* state, const Columns& key_columns);
+
     // release the hash table
     void reset();
 
@@ -530,6 +610,7 @@ struct AggHashSetVariant {
         phase1_slice,
         phase1_slice_two_level,
         phase1_int32_two_level,
+        phase1_int64_two_level,
         phase2_uint8,
         phase2_int8,
         phase2_int16,
@@ -557,6 +638,7 @@ struct AggHashSetVariant {
         phase2_slice,
         phase2_slice_two_level,
         phase2_int32_two_level,
+        phase2_int64_two_level,
 
         phase1_slice_fx4,
         phase1_slice_fx8,
@@ -564,6 +646,16 @@ struct AggHashSetVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+
+        phase1_short_string,
+        phase2_short_string,
+        phase1_null_short_string,
+        phase2_null_short_string,
+
+        phase1_dense_int32,
+        phase2_dense_int32,
+        phase1_null_dense_int32,
+        phase2_null_dense_int32,
     };
 
     detail::AggHashSetWithKeyPtr hash_set_with_key;
@@ -578,6 +670,14 @@ struct AggHashSetVariant {
 
     void convert_to_two_level(RuntimeState* state);
 
+    // Short string key sets only hold keys up to AGG_SHORT_STRING_MAX_SIZE bytes,
+    // switch to the general string key set before building with a chunk that has a longer key.
+    void try_convert_short_string_keys(RuntimeState* state, const Columns& key_columns, MemPool* pool);
+
+    // Dense int key sets only hold keys in [0, DenseRangeHashSet::max_range),
+    // switch to the int32 key set before building with a chunk that has a key out of range.
+    void try_convert_dense_keys(RuntimeState* state, const Columns& key_columns);
+
     void reset();
 
     size_t capacity() const;
@@ -33,9 +33,11 @@
 #include "exprs/agg/agg_state_union.h"
 #include "exprs/agg/aggregate_state_allocator.h"
 #include "exprs/anyval_util.h"
+#include "exprs/column_ref.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/global_dict/config.h"
 #include "runtime/memory/roaring_hook.h"
 #include "types/logical_type.h"
 #include "udf/java/utils.h"
@@ -115,6 +117,19 @@ bool AggrAutoContext::is_low_reduction(const size_t agg_count, const size_t chun
     return agg_count <= LowReduction * chunk_size;
 }
 
+size_t AggrAutoContext::update_reduction_estimate(const size_t hit_count, const size_t chunk_size) {
+    if (chunk_size == 0) {
+        return 0;
+    }
+    double hit_ratio = hit_count * 1.0 / chunk_size;
+    if (reduction_estimate < 0) {
+        reduction_estimate = hit_ratio;
+    } else {
+        reduction_estimate += ReductionEstimateWeight * (hit_ratio - reduction_estimate);
+    }
+    return static_cast<size_t>(reduction_estimate * chunk_size);
+}
+
 Status init_udaf_context(int64_t fid, const std::string& url, const std::string& checksum, const std::string& symbol,
                          FunctionContext* context);
 
@@ -212,6 +227,9 @@ void AggregatorParams::init() {
 
 Aggregator::Aggregator(AggregatorParamsPtr params) : _params(std::move(params)) {
     _allocator = std::make_unique<CountingAllocatorWithHook>();
+    if (config::enable_agg_state_arena) {
+        _arena_allocator = std::make_unique<ArenaAllocator>(_allocator.get());
+    }
 }
 
 Status Aggregator::open(RuntimeState* state) {
@@ -592,7 +610,7 @@ Status Aggregator::reset_state(starrocks::RuntimeState* state, const std::vector
 }
 
 Status Aggregator::_reset_state(RuntimeState* state, bool reset_sink_complete) {
-    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
     _is_ht_eos = false;
     _num_input_rows = 0;
     _is_prepared = false;
@@ -627,6 +645,9 @@ Status Aggregator::_reset_state(RuntimeState* state, bool reset_sink_complete) {
     }
 
     _mem_pool->free_all();
+    if (_arena_allocator != nullptr) {
+        _arena_allocator->release_all();
+    }
     _agg_state_mem_usage = 0;
 
     if (_group_by_expr_ctxs.empty()) {
@@ -687,7 +708,7 @@ void Aggregator::close(RuntimeState* state) {
         if (_mem_pool != nullptr) {
             // Note: we must free agg_states object before _mem_pool free_all;
             if (_single_agg_state != nullptr) {
-                SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+                SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
                 for (int i = 0; i < _agg_functions.size(); i++) {
                     _agg_functions[i]->destroy(_agg_fn_ctxs[i], _single_agg_state + _agg_states_offsets[i]);
                 }
@@ -696,6 +717,9 @@ void Aggregator::close(RuntimeState* state) {
             }
 
             _mem_pool->free_all();
+            if (_arena_allocator != nullptr) {
+                _arena_allocator->release_all();
+            }
         }
 
         for (int i = 0; i < _agg_functions.size(); i++) {
@@ -812,7 +836,7 @@ Status Aggregator::compute_single_agg_state(Chunk* chunk, size_t chunk_size) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         // evaluate arguments at i-th agg function
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
-        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
         // batch call update or merge for singe stage
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch_single_state(_agg_fn_ctxs[i], chunk_size, _agg_input_raw_columns[i].data(),
@@ -835,7 +859,7 @@ Status Aggregator::compute_batch_agg_states(Chunk* chunk, size_t chunk_size) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         // evaluate arguments at i-th agg function
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
-        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
         // batch call update or merge
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
@@ -857,7 +881,7 @@ Status Aggregator::compute_batch_agg_states_with_selection(Chunk* chunk, size_t
 
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
-        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch_selectively(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
                                                         _agg_input_raw_columns[i].data(), _tmp_agg_states.data(),
@@ -890,7 +914,7 @@ Status Aggregator::convert_to_chunk_no_groupby(ChunkPtr* chunk) {
     // TODO(kks): we should approve memory allocate here
     auto use_intermediate = _use_intermediate_as_output();
     Columns agg_result_column = _create_agg_result_columns(1, use_intermediate);
-    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
     if (!use_intermediate) {
         TRY_CATCH_BAD_ALLOC(_finalize_to_chunk(_single_agg_state, agg_result_column));
     } else {
@@ -975,7 +999,7 @@ Status Aggregator::output_chunk_by_streaming(Chunk* input_chunk, ChunkPtr* chunk
                 result_chunk->append_column(std::move(_agg_input_columns[i][0]), slot_id);
             } else {
                 {
-                    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+                    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
                     _agg_functions[i]->convert_to_serialize_format(_agg_fn_ctxs[i], _agg_input_columns[i],
                                                                    result_chunk->num_rows(), &agg_result_column[i]);
                 }
@@ -1145,7 +1169,7 @@ void Aggregator::_finalize_to_chunk(ConstAggDataPtr __restrict state, const Colu
 }
 
 void Aggregator::_destroy_state(AggDataPtr __restrict state) {
-    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         _agg_functions[i]->destroy(_agg_fn_ctxs[i], state + _agg_states_offsets[i]);
     }
@@ -1337,6 +1361,49 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
         }
     }
 
+    // A single string key declared short enough is stored inline. The declared length is only a hint,
+    // the hash table falls back to the general string key once a longer value shows up,
+    // see try_convert_short_string_keys.
+    if (config::enable_agg_short_string_key && _group_by_expr_ctxs.size() == 1) {
+        const auto& key_type = _group_by_expr_ctxs[0]->root()->type();
+        if ((key_type.type == TYPE_CHAR || key_type.type == TYPE_VARCHAR) && key_type.len > 0 &&
+            static_cast<size_t>(key_type.len) <= AGG_SHORT_STRING_MAX_SIZE) {
+            if (type == HashVariantType::Type::phase1_string) {
+                type = HashVariantType::Type::phase1_short_string;
+            } else if (type == HashVariantType::Type::phase2_string) {
+                type = HashVariantType::Type::phase2_short_string;
+            } else if (type == HashVariantType::Type::phase1_null_string) {
+                type = HashVariantType::Type::phase1_null_short_string;
+            } else if (type == HashVariantType::Type::phase2_null_string) {
+                type = HashVariantType::Type::phase2_null_short_string;
+            }
+        }
+    }
+
+    // A single key of low cardinality dict codes is looked up in a table directly indexed by the code.
+    // The dict only hints the range, the table falls back to the int32 key table once a code out of
+    // the range shows up, see try_convert_dense_keys.
+    if (config::enable_agg_dense_dict_key && _group_by_expr_ctxs.size() == 1) {
+        const Expr* key_expr = _group_by_expr_ctxs[0]->root();
+        const auto& global_dicts = _state->get_query_global_dict_map();
+        if (key_expr->type().type == LowCardDictType && key_expr->is_slotref()) {
+            auto iter = global_dicts.find(down_cast<const ColumnRef*>(key_expr)->slot_id());
+            // iter->second.second maps the codes to the strings
+            if (iter != global_dicts.end() &&
+                iter->second.second.size() < DenseInt32AggHashSet<PhmapSeed1>::max_range) {
+                if (type == HashVariantType::Type::phase1_int32) {
+                    type = HashVariantType::Type::phase1_dense_int32;
+                } else if (type == HashVariantType::Type::phase2_int32) {
+                    type = HashVariantType::Type::phase2_dense_int32;
+                } else if (type == HashVariantType::Type::phase1_null_int32) {
+                    type = HashVariantType::Type::phase1_null_dense_int32;
+                } else if (type == HashVariantType::Type::phase2_null_int32) {
+                    type = HashVariantType::Type::phase2_null_dense_int32;
+                }
+            }
+        }
+    }
+
     bool has_null_column = false;
     int fixed_byte_size = 0;
     // this optimization don't need to be limited to multi-column group by.
@@ -1382,6 +1449,8 @@ void Aggregator::build_hash_map(size_t chunk_size, bool agg_group_by_with_limit)
         }
     }
 
+    _hash_map_variant.try_convert_short_string_keys(_state, _group_by_columns, _mem_pool.get());
+    _hash_map_variant.try_convert_dense_keys(_state, _group_by_columns);
     _hash_map_variant.visit([&](auto& hash_map_with_key) {
         using MapType = std::remove_reference_t<decltype(*hash_map_with_key)>;
         hash_map_with_key->build_hash_map(chunk_size, _group_by_columns, _mem_pool.get(), AllocateState<MapType>(this),
@@ -1406,6 +1475,8 @@ void Aggregator::_build_hash_map_with_shared_limit(size_t chunk_size, std::atomi
     } else {
         _streaming_selection.assign(chunk_size, 0);
     }
+    _hash_map_variant.try_convert_short_string_keys(_state, _group_by_columns, _mem_pool.get());
+    _hash_map_variant.try_convert_dense_keys(_state, _group_by_columns);
     _hash_map_variant.visit([&](auto& hash_map_with_key) {
         using MapType = std::remove_reference_t<decltype(*hash_map_with_key)>;
         hash_map_with_key->build_hash_map(chunk_size, _group_by_columns, _mem_pool.get(), AllocateState<MapType>(this),
@@ -1415,6 +1486,8 @@ void Aggregator::_build_hash_map_with_shared_limit(size_t chunk_size, std::atomi
 }
 
 void Aggregator::build_hash_map_with_selection(size_t chunk_size) {
+    _hash_map_variant.try_convert_short_string_keys(_state, _group_by_columns, _mem_pool.get());
+    _hash_map_variant.try_convert_dense_keys(_state, _group_by_columns);
     _hash_map_variant.visit([&](auto& hash_map_with_key) {
         using MapType = std::remove_reference_t<decltype(*hash_map_with_key)>;
         hash_map_with_key->build_hash_map_with_selection(chunk_size, _group_by_columns, _mem_pool.get(),
@@ -1427,6 +1500,8 @@ void Aggregator::build_hash_map_with_selection(size_t chunk_size) {
 // so the following group keys(same as the first not found group keys) are not marked as non-founded.
 // This can be used for stream mv so no need to find multi times for the same non-found group keys.
 void Aggregator::build_hash_map_with_selection_and_allocation(size_t chunk_size, bool agg_group_by_with_limit) {
+    _hash_map_variant.try_convert_short_string_keys(_state, _group_by_columns, _mem_pool.get());
+    _hash_map_variant.try_convert_dense_keys(_state, _group_by_columns);
     _hash_map_variant.visit([&](auto& hash_map_with_key) {
         using MapType = std::remove_reference_t<decltype(*hash_map_with_key)>;
         hash_map_with_key->build_hash_map_with_selection_and_allocation(chunk_size, _group_by_columns, _mem_pool.get(),
@@ -1474,7 +1549,7 @@ Status Aggregator::convert_hash_map_to_chunk(int32_t chunk_size, ChunkPtr* chunk
 
             {
                 SCOPED_TIMER(_agg_stat->agg_append_timer);
-                SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+                SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
                 if (!use_intermediate) {
                     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
                         TRY_CATCH_BAD_ALLOC(_agg_functions[i]->batch_finalize(_agg_fn_ctxs[i], read_index,
@@ -1503,7 +1578,7 @@ Status Aggregator::convert_hash_map_to_chunk(int32_t chunk_size, ChunkPtr* chunk
                     DCHECK(group_by_columns.size() == 1);
                     DCHECK(group_by_columns[0]->is_nullable());
                     group_by_columns[0]->append_default();
-                    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+                    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
                     if (!use_intermediate) {
                         TRY_CATCH_BAD_ALLOC(_finalize_to_chunk(hash_map_with_key.null_key_data, agg_result_columns));
                     } else {
@@ -1531,11 +1606,15 @@ Status Aggregator::convert_hash_map_to_chunk(int32_t chunk_size, ChunkPtr* chunk
 }
 
 void Aggregator::build_hash_set(size_t chunk_size) {
+    _hash_set_variant.try_convert_short_string_keys(_state, _group_by_columns, _mem_pool.get());
+    _hash_set_variant.try_convert_dense_keys(_state, _group_by_columns);
     _hash_set_variant.visit(
             [&](auto& hash_set) { hash_set->build_hash_set(chunk_size, _group_by_columns, _mem_pool.get()); });
 }
 
 void Aggregator::build_hash_set_with_selection(size_t chunk_size) {
+    _hash_set_variant.try_convert_short_string_keys(_state, _group_by_columns, _mem_pool.get());
+    _hash_set_variant.try_convert_dense_keys(_state, _group_by_columns);
     _hash_set_variant.visit([&](auto& hash_set) {
         hash_set->build_hash_set_with_selection(chunk_size, _group_by_columns, _mem_pool.get(), &_streaming_selection);
     });
@@ -1612,7 +1691,7 @@ void Aggregator::_release_agg_memory() {
     // If all function states are of POD type,
     // then we don't have to traverse the hash table to call destroy method.
     //
-    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_agg_state_allocator(), _allocator.get());
     _hash_map_variant.visit([&](auto& hash_map_with_key) {
         bool skip_destroy = std::all_of(_agg_functions.begin(), _agg_functions.end(),
                                         [](auto* func) { return func->is_pod_state(); });
@@ -42,6 +42,7 @@
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "runtime/mem_pool.h"
+#include "runtime/memory/arena_allocator.h"
 #include "runtime/memory/counting_allocator.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
@@ -176,11 +177,18 @@ struct AggrAutoContext {
     static constexpr double HighReduction = 0.9;
     static constexpr size_t MaxHtSize = 64 * 1024 * 1024; // 64 MB
     static constexpr int StableLimit = 5;
+    // weight of the newest chunk in the hit ratio estimate, which averages about StableLimit chunks
+    static constexpr double ReductionEstimateWeight = 2.0 / (StableLimit + 1);
     std::string get_auto_state_string(const AggrAutoState& state);
     size_t get_continuous_limit();
     void update_continuous_limit();
     bool is_high_reduction(const size_t agg_count, const size_t chunk_size);
     bool is_low_reduction(const size_t agg_count, const size_t chunk_size);
+    // Fold the hit ratio of a probed chunk into reduction_estimate and return the estimated hit count
+    // of the chunk. Deciding on the estimate rather than on a single chunk keeps skewed inputs from
+    // flip-flopping between pass through and preaggregation.
+    size_t update_reduction_estimate(const size_t hit_count, const size_t chunk_size);
+    double reduction_estimate = -1;
     size_t init_preagg_count = 0;
     size_t adjust_count = 0;
     size_t pass_through_count = 0;
@@ -227,7 +235,7 @@ struct AggregatorParams {
     std::vector<TExpr> intermediate_aggr_exprs;
 
     // Incremental MV
-    // Whether it's testing, use MemStateTable in testing, instead use IMTStateTable.
+    // Whether it's testing, use MemStateTable in testing, instead use LocalStateTable.
     bool is_testing;
     // Whether input is only append-only or with retract messages.
     bool is_append_only;
@@ -320,6 +328,7 @@ public:
     RuntimeProfile::Counter* rows_returned_counter() { return _agg_stat->rows_returned_counter; }
     RuntimeProfile::Counter* hash_table_size() { return _agg_stat->hash_table_size; }
     RuntimeProfile::Counter* pass_through_row_count() { return _agg_stat->pass_through_row_count; }
+    RuntimeProfile::Counter* preagg_reduction_estimate() { return _agg_stat->preagg_reduction_estimate; }
 
     void sink_complete() { _is_sink_complete.store(true, std::memory_order_release); }
 
@@ -412,6 +421,9 @@ protected:
     std::unique_ptr<MemPool> _mem_pool;
     // used to count heap memory usage of agg states
     std::unique_ptr<CountingAllocatorWithHook> _allocator;
+    // Serves the memory of the hash sets and vectors inside the agg states from _allocator, and frees it at once
+    // when the states are released, instead of one free per object. Null if enable_agg_state_arena is false.
+    std::unique_ptr<ArenaAllocator> _arena_allocator;
     // The open phase still relies on the TFunction object for some initialization operations
     std::vector<TFunction> _fns;
 
@@ -574,6 +586,10 @@ protected:
     void _init_agg_hash_variant(HashVariantType& hash_variant);
 
     void _release_agg_memory();
+    // The allocator of the memory inside the agg states.
+    Allocator* _agg_state_allocator() const {
+        return _arena_allocator != nullptr ? static_cast<Allocator*>(_arena_allocator.get()) : _allocator.get();
+    }
 
     bool _is_agg_result_nullable(const TExpr& desc, const AggFunctionTypes& agg_func_type);
 
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/analysis/analytic_sink_operator.h"
 #include "exec/pipeline/analysis/analytic_source_operator.h"
 #include "exec/pipeline/hash_partition_context.h"
@@ -124,6 +125,11 @@ pipeline::OpFactories AnalyticNode::decompose_to_pipeline(pipeline::PipelineBuil
         // The former sort will use passthrough exchange, so we need to add ordered partition local exchange here.
         ops_with_sink = context->maybe_interpolate_local_ordered_partition_exchange(runtime_state(), id(),
                                                                                     ops_with_sink, _partition_exprs);
+    } else if (config::pipeline_analytic_enable_partition_fanout && upstream_source_op->degree_of_parallelism() == 1) {
+        // The single input stream is ordered by the partition columns, so whole partitions can be dispatched to
+        // the drivers, each of which evaluates its partitions independently.
+        ops_with_sink = context->maybe_interpolate_local_ordered_partition_exchange(runtime_state(), id(),
+                                                                                    ops_with_sink, _partition_exprs);
     }
 
     upstream_source_op = context->source_operator(ops_with_sink);
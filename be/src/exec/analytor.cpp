@@ -52,6 +52,35 @@ namespace starrocks {
 Status window_init_jvm_context(int64_t fid, const std::string& url, const std::string& checksum,
                                const std::string& symbol, FunctionContext* context);
 
+void SlidingExtremum::reset(int64_t partition_start) {
+    _positions.clear();
+    _pushed_end = partition_start;
+}
+
+int64_t SlidingExtremum::slide(const Column* column, int64_t base, int64_t frame_start, int64_t frame_end) {
+    const Column* data_column = ColumnHelper::get_data_column(column);
+    // The rows before the frame start are never needed, since the frame start only moves forward.
+    for (int64_t pos = std::max(_pushed_end, frame_start); pos < frame_end; ++pos) {
+        const size_t row = pos - base;
+        if (column->is_null(row)) {
+            continue;
+        }
+        while (!_positions.empty()) {
+            int cmp = data_column->compare_at(_positions.back() - base, row, *data_column, 1);
+            if ((_is_max && cmp > 0) || (!_is_max && cmp < 0)) {
+                break;
+            }
+            _positions.pop_back();
+        }
+        _positions.push_back(pos);
+    }
+    _pushed_end = std::max(_pushed_end, frame_end);
+    while (!_positions.empty() && _positions.front() < frame_start) {
+        _positions.pop_front();
+    }
+    return _positions.empty() ? -1 : _positions.front();
+}
+
 Analytor::Analytor(const TPlanNode& tnode, const RowDescriptor& child_row_desc,
                    const TupleDescriptor* result_tuple_desc, bool use_hash_based_partition)
         : _tnode(tnode),
@@ -135,6 +164,7 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
     _agg_expr_ctxs.resize(agg_size);
     _agg_intput_columns.resize(agg_size);
     _agg_fn_types.resize(agg_size);
+    _sliding_extremums.resize(agg_size);
     _agg_states_offsets.resize(agg_size);
     _partition_size_required_function_index.resize(0);
 
@@ -247,6 +277,14 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
 
         DCHECK(_agg_functions[i] != nullptr);
         _is_lead_lag_functions[i] = (_agg_functions[i]->get_name() == "lead-lag");
+
+        // Both bounds of the frame move forward row by row only if the frame starts with N PRECEDING,
+        // CURRENT ROW or N FOLLOWING, where MAX/MIN, having no inverse, can be slid by a monotonic deque.
+        if (config::pipeline_analytic_enable_sliding_extremum && analytic_node.__isset.window &&
+            analytic_node.window.type == TAnalyticWindowType::ROWS && analytic_node.window.__isset.window_start &&
+            (fn.name.function_name == "max" || fn.name.function_name == "min")) {
+            _sliding_extremums[i] = std::make_unique<SlidingExtremum>(fn.name.function_name == "max");
+        }
     }
 
     // Compute agg state total size and offsets.
@@ -951,12 +989,39 @@ void Analytor::_update_window_batch(int64_t partition_start, int64_t partition_e
             // instead of _partition.end to refer to the current right boundary.
             frame_end = std::min<int64_t>(frame_end, _partition.end);
         }
+        if (_sliding_extremums[i] != nullptr) {
+            _update_sliding_extremum(i, data_columns, frame_start, frame_end);
+            continue;
+        }
         _agg_functions[i]->update_batch_single_state_with_frame(
                 _agg_fn_ctxs[i], _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i], data_columns,
                 partition_start, partition_end, frame_start, frame_end);
     }
 }
 
+void Analytor::_update_sliding_extremum(size_t i, const Column** data_columns, int64_t frame_start,
+                                        int64_t frame_end) {
+    auto& extremum = _sliding_extremums[i];
+    const int64_t partition_start = _get_global_position(_partition.start);
+    if (partition_start != _sliding_extremum_partition_start) {
+        for (auto& e : _sliding_extremums) {
+            if (e != nullptr) {
+                e->reset(partition_start);
+            }
+        }
+        _sliding_extremum_partition_start = partition_start;
+    }
+    // The state has been reset for the current row, so only the extremum row is needed to update it.
+    const int64_t pos = extremum->slide(data_columns[0], _removed_from_buffer_rows, _get_global_position(frame_start),
+                                        _get_global_position(frame_end));
+    if (pos >= 0) {
+        const int64_t row = pos - _removed_from_buffer_rows;
+        _agg_functions[i]->update_batch_single_state_with_frame(
+                _agg_fn_ctxs[i], _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i], data_columns,
+                _partition.start, _partition.end, row, row + 1);
+    }
+}
+
 void Analytor::_update_window_batch_removable_cumulatively() {
     SCOPED_THREAD_LOCAL_AGG_STATE_ALLOCATOR_SETTER(_allocator.get());
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
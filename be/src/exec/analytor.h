@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <deque>
 #include <queue>
 #include <string>
 
@@ -38,6 +39,31 @@ struct FunctionTypes {
     bool is_nullable; // window function result whether is nullable
 };
 
+// SlidingExtremum evaluates MAX or MIN over a frame whose both bounds only move forward, i.e. the frames of
+// `ROWS BETWEEN N PRECEDING AND M FOLLOWING` and alike, with a monotonic deque. Every row is pushed and popped
+// at most once, so it costs O(1) amortized per row instead of the frame size of evaluating by definition.
+class SlidingExtremum {
+public:
+    explicit SlidingExtremum(bool is_max) : _is_max(is_max) {}
+
+    // Start a new partition of which the first global position is `partition_start`.
+    void reset(int64_t partition_start);
+
+    // Slide the frame to the global positions [frame_start, frame_end), where the global position p is the row
+    // `p - base` of `column`. Return the global position of the extremum, or -1 if all the rows are null.
+    int64_t slide(const Column* column, int64_t base, int64_t frame_start, int64_t frame_end);
+
+    bool is_max() const { return _is_max; }
+
+private:
+    const bool _is_max;
+    // The global positions of the rows that may be the extremum of the current or a later frame, whose values are
+    // strictly monotonic from the front to the back, so the front one is the extremum of the current frame.
+    std::deque<int64_t> _positions;
+    // The rows before it have been pushed.
+    int64_t _pushed_end = 0;
+};
+
 class Analytor;
 using AnalytorPtr = std::shared_ptr<Analytor>;
 using Analytors = std::vector<AnalytorPtr>;
@@ -194,6 +220,8 @@ private:
 
     void _update_window_batch(int64_t partition_start, int64_t partition_end, int64_t frame_start, int64_t frame_end);
     void _update_window_batch_removable_cumulatively();
+    // Only used for the sliding frames, whose both bounds move forward by one row in every call.
+    void _update_sliding_extremum(size_t i, const Column** data_columns, int64_t frame_start, int64_t frame_end);
 
     Status _output_result_chunk(ChunkPtr* chunk);
 
@@ -272,6 +300,10 @@ private:
     std::vector<std::vector<ExprContext*>> _agg_expr_ctxs;
     std::vector<std::vector<ColumnPtr>> _agg_intput_columns;
     std::vector<FunctionTypes> _agg_fn_types;
+    // MAX/MIN over a sliding frame are evaluated by SlidingExtremum, nullptr for the others.
+    std::vector<std::unique_ptr<SlidingExtremum>> _sliding_extremums;
+    // The global position of the partition the sliding extremums are built for.
+    int64_t _sliding_extremum_partition_start = -1;
 
     std::vector<ExprContext*> _partition_ctxs;
     Columns _partition_columns;
@@ -14,10 +14,12 @@
 
 #include "exec/chunks_sorter.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "column/column_helper.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "exec/sorting/sort_permute.h"
 #include "exprs/expr.h"
 #include "gutil/casts.h"
@@ -153,6 +155,18 @@ ChunksSorter::ChunksSorter(RuntimeState* state, const std::vector<ExprContext*>*
 
 ChunksSorter::~ChunksSorter() = default;
 
+bool ChunksSorter::use_heap_sorter(const std::vector<ExprContext*>& sort_exprs, size_t rows_to_sort) {
+    // The heap compares every input row against its top one key by key, while ChunksSorterTopn sorts a batch
+    // column by column, so the heap only wins while it is small. The keys of fixed length are compared without
+    // chasing the pointers of the strings or the nested columns, which allows a larger heap.
+    bool fixed_length_keys = std::all_of(sort_exprs.begin(), sort_exprs.end(), [](const ExprContext* ctx) {
+        const TypeDescriptor& type = ctx->root()->type();
+        return !type.is_string_type() && !type.is_complex_type() && !type.is_huge_type();
+    });
+    int64_t limit = fixed_length_keys ? config::sort_heap_sorter_fixed_key_limit : config::sort_heap_sorter_limit;
+    return limit > 0 && rows_to_sort <= static_cast<size_t>(limit);
+}
+
 void ChunksSorter::setup_runtime(RuntimeState* state, RuntimeProfile* profile, MemTracker* parent_mem_tracker) {
     _build_timer = ADD_TIMER(profile, "BuildingTime");
     _sort_timer = ADD_TIMER(profile, "SortingTime");
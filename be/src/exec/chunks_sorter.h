@@ -93,7 +93,9 @@ using ChunksSorters = std::vector<ChunksSorterPtr>;
 // Sort Chunks in memory with specified order by rules.
 class ChunksSorter {
 public:
-    static constexpr int USE_HEAP_SORTER_LIMIT_SZ = 1024;
+    // Return true if ChunksSorterHeapSort is expected to be faster than ChunksSorterTopn for keeping the first
+    // `rows_to_sort` rows ordered by `sort_exprs`.
+    static bool use_heap_sorter(const std::vector<ExprContext*>& sort_exprs, size_t rows_to_sort);
 
     /**
      * Constructor.
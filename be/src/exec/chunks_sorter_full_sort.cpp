@@ -14,6 +14,7 @@
 
 #include "chunks_sorter_full_sort.h"
 
+#include "column/column_helper.h"
 #include "exec/sorting/merge.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
@@ -41,6 +42,7 @@ ChunksSorterFullSort::~ChunksSorterFullSort() = default;
 void ChunksSorterFullSort::setup_runtime(RuntimeState* state, RuntimeProfile* profile, MemTracker* parent_mem_tracker) {
     ChunksSorter::setup_runtime(state, profile, parent_mem_tracker);
     _runtime_profile = profile;
+    _runtime_profile->add_info_string("SortAlgorithm", "FullSort");
     _parent_mem_tracker = parent_mem_tracker;
     _object_pool = std::make_unique<ObjectPool>();
     _runtime_profile->add_info_string("MaxBufferedRows", strings::Substitute("$0", max_buffered_rows));
@@ -269,8 +271,10 @@ Status ChunksSorterFullSort::get_next(ChunkPtr* chunk, bool* eos) {
         *eos = true;
         return Status::OK();
     }
-    size_t chunk_size = _state->chunk_size();
     SortedRun& run = _merged_runs.front();
+    size_t chunk_size = std::min<size_t>(_state->chunk_size(), run.num_rows());
+    // Output fewer rows if they have more than 4GB of strings, as they can't be downgraded.
+    chunk_size = ColumnHelper::num_rows_within_capacity_limit(run.chunk->columns(), run.start_index(), chunk_size);
     *chunk = run.steal_chunk(chunk_size);
     if (*chunk != nullptr) {
         if (!_early_materialized_slots.empty()) {
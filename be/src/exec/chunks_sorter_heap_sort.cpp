@@ -297,6 +297,7 @@ int ChunksSorterHeapSort::_filter_data(detail::ChunkHolder* chunk_holder, int ro
 
 void ChunksSorterHeapSort::setup_runtime(RuntimeState* state, RuntimeProfile* profile, MemTracker* parent_mem_tracker) {
     ChunksSorter::setup_runtime(state, profile, parent_mem_tracker);
+    profile->add_info_string("SortAlgorithm", "HeapSort");
     _sort_filter_costs = ADD_TIMER(profile, "SortFilterCost");
     _sort_filter_rows = ADD_COUNTER(profile, "SortFilterRows", TUnit::UNIT);
 }
@@ -49,6 +49,7 @@ ChunksSorterTopn::~ChunksSorterTopn() = default;
 
 void ChunksSorterTopn::setup_runtime(RuntimeState* state, RuntimeProfile* profile, MemTracker* parent_mem_tracker) {
     ChunksSorter::setup_runtime(state, profile, parent_mem_tracker);
+    profile->add_info_string("SortAlgorithm", "TopN");
     _sort_filter_timer = ADD_TIMER(profile, "SortFilterTime");
     _sort_filter_rows = ADD_COUNTER(profile, "SortFilterRows", TUnit::UNIT);
 }
@@ -151,6 +152,8 @@ Status ChunksSorterTopn::get_next(ChunkPtr* chunk, bool* eos) {
     }
     *eos = false;
     size_t count = std::min(size_t(_state->chunk_size()), _merged_segment.chunk->num_rows() - _next_output_row);
+    // Output fewer rows if they have more than 4GB of strings, as they can't be downgraded.
+    count = ColumnHelper::num_rows_within_capacity_limit(_merged_segment.chunk->columns(), _next_output_row, count);
     chunk->reset(_merged_segment.chunk->clone_empty(count).release());
     (*chunk)->append_safe(*_merged_segment.chunk, _next_output_row, count);
     RETURN_IF_ERROR((*chunk)->downgrade());
@@ -19,6 +19,7 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "common/statusor.h"
 #include "exec/pipeline/limit_operator.h"
@@ -540,6 +541,22 @@ StatusOr<std::list<ExprContext*>> CrossJoinNode::rewrite_runtime_filter(
     return filters;
 }
 
+StatusOr<std::list<ExprContext*>> CrossJoinNode::rewrite_range_runtime_filter(
+        ObjectPool* pool, const std::vector<RuntimeFilterBuildDescriptor*>& rf_descs,
+        const std::vector<ChunkPtr>& chunks, const std::vector<ExprContext*>& ctxs) {
+    std::list<ExprContext*> filters;
+
+    for (auto rf_desc : rf_descs) {
+        DCHECK_LT(rf_desc->build_expr_order(), ctxs.size());
+        ASSIGN_OR_RETURN(auto expr, RuntimeFilterHelper::rewrite_range_runtime_filter_in_cross_join_node(
+                                            pool, ctxs[rf_desc->build_expr_order()], chunks))
+        if (expr != nullptr) {
+            filters.push_back(expr);
+        }
+    }
+    return filters;
+}
+
 void CrossJoinNode::_init_chunk(ChunkPtr* chunk) {
     ChunkPtr new_chunk = std::make_shared<Chunk>();
 
@@ -578,11 +595,17 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory>> CrossJoinNode::_decompos
     // step 1: construct pipeline end with cross join left operator(cross join left maybe not sink operator).
     NLJoinContextParams context_params;
     context_params.plan_node_id = _id;
+    context_params.join_op = _join_op;
     context_params.rf_hub = context->fragment_context()->runtime_filter_hub();
     context_params.rf_descs = std::move(_build_runtime_filters);
     // The order or filters should keep same with NestLoopJoinNode::buildRuntimeFilters
     context_params.filters = _join_conjuncts;
     std::copy(conjunct_ctxs().begin(), conjunct_ctxs().end(), std::back_inserter(context_params.filters));
+    // Both the join conjuncts and the other conjuncts filter the cross product of an inner join.
+    if (_join_op == TJoinOp::INNER_JOIN && config::enable_nljoin_range_join) {
+        context_params.range_key =
+                NLJoinRangeKey::extract(context_params.filters, child(0)->row_desc(), child(1)->row_desc());
+    }
 
     size_t num_right_partitions = context->source_operator(right_ops)->degree_of_parallelism();
     auto workgroup = context->fragment_context()->workgroup();
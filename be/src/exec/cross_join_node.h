@@ -56,6 +56,15 @@ public:
             ObjectPool* pool, const std::vector<RuntimeFilterBuildDescriptor*>& rf_descs, Chunk* chunk,
             const std::vector<ExprContext*>& ctxs);
 
+    // rewrite the range comparisons of conjuncts as RuntimeFilter with the min/max of the build side of many rows,
+    // the other conjuncts are skipped.
+    //
+    // eg: if input chunks are [col3: 1, 5, 3]
+    // slot1 > col3 will be rewrited as slot1 > 1 and slot1 <= col3 will be rewrited as slot1 <= 5
+    static StatusOr<std::list<ExprContext*>> rewrite_range_runtime_filter(
+            ObjectPool* pool, const std::vector<RuntimeFilterBuildDescriptor*>& rf_descs,
+            const std::vector<ChunkPtr>& chunks, const std::vector<ExprContext*>& ctxs);
+
 private:
     Status _build(RuntimeState* state);
     Status _get_next_probe_chunk(RuntimeState* state);
@@ -80,18 +80,23 @@ public:
 
     void build_set(RuntimeState* state, const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs, MemPool* pool,
                    BufferState* buffer_state);
+    // Same as above, but with the evaluated key columns of at most *state->chunk_size()* rows.
+    void build_set(RuntimeState* state, const Columns& key_columns, size_t chunk_size, MemPool* pool,
+                   BufferState* buffer_state);
 
     Status erase_duplicate_row(RuntimeState* state, const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs,
                                BufferState* buffer_state);
+    Status erase_duplicate_row(RuntimeState* state, const Columns& key_columns, size_t chunk_size,
+                               BufferState* buffer_state);
 
     void deserialize_to_columns(KeyVector& keys, const Columns& key_columns, size_t chunk_size);
 
     int64_t mem_usage(BufferState* buffer_state);
 
 private:
-    size_t _get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs);
-    void _serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs, size_t chunk_size,
-                            BufferState* buffer_state);
+    static Columns _evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs);
+    size_t _get_max_serialize_size(const Columns& key_columns);
+    void _serialize_columns(const Columns& key_columns, size_t chunk_size, BufferState* buffer_state);
 
 private:
     std::unique_ptr<HashSet> _hash_set;
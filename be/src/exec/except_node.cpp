@@ -242,8 +242,11 @@ pipeline::OpFactories ExceptNode::decompose_to_pipeline(pipeline::PipelineBuilde
     const auto num_operators_generated = _children.size() + 1;
     auto&& rc_rf_probe_collector =
             std::make_shared<RcRfProbeCollector>(num_operators_generated, std::move(this->runtime_filter_collector()));
+    // Only spill in the force mode for now, like the spillable nested loop join.
+    const bool enable_spill = runtime_state()->enable_spill() && runtime_state()->enable_set_operator_spill() &&
+                              runtime_state()->spill_mode() == TSpillMode::FORCE;
     ExceptPartitionContextFactoryPtr except_partition_ctx_factory =
-            std::make_shared<ExceptPartitionContextFactory>(_tuple_id, _children.size() - 1);
+            std::make_shared<ExceptPartitionContextFactory>(_tuple_id, _children.size() - 1, enable_spill);
 
     // Use the first child to build the hast table by ExceptBuildSinkOperator.
     OpFactories ops_with_except_build_sink = child(0)->decompose_to_pipeline(context);
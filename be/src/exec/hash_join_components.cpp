@@ -443,6 +443,8 @@ private:
 
     void _init_partition_nums(const HashTableParam& param);
     Status _convert_to_single_partition();
+    Status _shrink_partitions();
+    void _update_partition_profile();
     Status _append_chunk_to_partitions(const ChunkPtr& chunk);
 
 private:
@@ -486,6 +488,12 @@ size_t AdaptivePartitionHashJoinBuilder::_estimated_row_size(const HashTablePara
         }
     }
 
+    // for the keys materialized in the hash table (fixed size keys or serialized keys)
+    for (const auto& key_desc : param.join_keys) {
+        estimated_each_row += get_size_of_fixed_length_type(key_desc.type->type);
+        estimated_each_row += type_estimated_overhead_bytes(key_desc.type->type);
+    }
+
     // for hash table bucket
     estimated_each_row += 4;
 
@@ -635,6 +643,40 @@ Status AdaptivePartitionHashJoinBuilder::_convert_to_single_partition() {
     return Status::OK();
 }
 
+// Rows are routed by `hash & (partition_num - 1)`, so partition i and i + partition_num / 2 always fall into
+// the same partition after halving. Halve the partitions as long as each merged partition still fits in the
+// L2 cache, so that small build sides don't pay the probe-side partitioning overhead for nothing.
+Status AdaptivePartitionHashJoinBuilder::_shrink_partitions() {
+    size_t row_count = hash_table_row_count();
+    while (_partition_num > 1 && row_count / (_partition_num / 2) <= _fit_L2_cache_max_rows) {
+        size_t half = _partition_num / 2;
+        for (size_t i = 0; i < half; ++i) {
+            _builders[i]->hash_table().merge_ht(_builders[i + half]->hash_table());
+        }
+        _builders.resize(half);
+        _partition_num = half;
+    }
+    return Status::OK();
+}
+
+void AdaptivePartitionHashJoinBuilder::_update_partition_profile() {
+    auto& metrics = _hash_joiner.build_metrics();
+    COUNTER_SET(metrics.partition_nums, (int64_t)_partition_num);
+
+    size_t max_rows = 0;
+    size_t total_rows = 0;
+    for (const auto& builder : _builders) {
+        size_t rows = builder->hash_table().get_row_count();
+        max_rows = std::max(max_rows, rows);
+        total_rows += rows;
+    }
+    COUNTER_SET(metrics.partition_max_rows, (int64_t)max_rows);
+    // skew = max partition rows / average partition rows, 100 means no skew.
+    if (total_rows > 0) {
+        COUNTER_SET(metrics.partition_skew, (int64_t)(100 * max_rows * _partition_num / total_rows));
+    }
+}
+
 Status AdaptivePartitionHashJoinBuilder::_append_chunk_to_partitions(const ChunkPtr& chunk) {
     const std::vector<ExprContext*>& build_partition_keys = _hash_joiner.build_expr_ctxs();
 
@@ -727,6 +769,12 @@ Status AdaptivePartitionHashJoinBuilder::build(RuntimeState* state) {
         RETURN_IF_ERROR(_convert_to_single_partition());
     }
 
+    if (_partition_num > 1) {
+        RETURN_IF_ERROR(_shrink_partitions());
+    }
+
+    _update_partition_profile();
+
     for (auto& builder : _builders) {
         RETURN_IF_ERROR(builder->build(state));
     }
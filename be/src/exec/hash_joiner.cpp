@@ -58,6 +58,8 @@ void HashJoinBuildMetrics::prepare(RuntimeProfile* runtime_profile) {
     hash_table_memory_usage = ADD_COUNTER(runtime_profile, "HashTableMemoryUsage", TUnit::BYTES);
     partial_runtime_bloom_filter_bytes = ADD_COUNTER(runtime_profile, "PartialRuntimeBloomFilterBytes", TUnit::BYTES);
     partition_nums = ADD_COUNTER(runtime_profile, "PartitionNums", TUnit::UNIT);
+    partition_max_rows = ADD_COUNTER(runtime_profile, "PartitionMaxRows", TUnit::UNIT);
+    partition_skew = ADD_COUNTER(runtime_profile, "PartitionSkew%", TUnit::UNIT);
 }
 
 HashJoiner::HashJoiner(const HashJoinerParam& param)
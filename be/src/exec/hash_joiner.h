@@ -161,6 +161,8 @@ struct HashJoinBuildMetrics {
     RuntimeProfile::Counter* hash_table_memory_usage = nullptr;
     RuntimeProfile::Counter* partial_runtime_bloom_filter_bytes = nullptr;
     RuntimeProfile::Counter* partition_nums = nullptr;
+    RuntimeProfile::Counter* partition_max_rows = nullptr;
+    RuntimeProfile::Counter* partition_skew = nullptr;
 
     void prepare(RuntimeProfile* runtime_profile);
 };
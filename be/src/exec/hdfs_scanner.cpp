@@ -17,10 +17,12 @@
 #include "block_cache/block_cache_hit_rate_counter.hpp"
 #include "column/column_helper.h"
 #include "exec/exec_node.h"
+#include "exec/pipeline/query_context.h"
 #include "fs/hdfs/fs_hdfs.h"
 #include "io/cache_select_input_stream.hpp"
 #include "io/compressed_input_stream.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/exec_env.h"
 #include "util/compression/compression_utils.h"
 #include "util/compression/stream_compression.h"
 
@@ -217,6 +219,12 @@ void HdfsScanner::close() noexcept {
     _mor_processor->close(_runtime_state);
 }
 
+// One cost model for each kind of storage, shared by all the scanners.
+static io::IOCostModel* io_cost_model(FileSystem::Type type) {
+    static io::IOCostModel models[FileSystem::STARLET + 1];
+    return &models[type];
+}
+
 StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_file(
         std::shared_ptr<io::SharedBufferedInputStream>& shared_buffered_input_stream,
         std::shared_ptr<io::CacheInputStream>& cache_input_stream, const OpenFileOptions& options) {
@@ -234,6 +242,9 @@ StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_fi
             .max_dist_size = config::io_coalesce_read_max_distance_size,
             .max_buffer_size = config::io_coalesce_read_max_buffer_size};
     shared_buffered_input_stream->set_coalesce_options(shared_options);
+    if (config::io_coalesce_adaptive_distance_enable) {
+        shared_buffered_input_stream->set_cost_model(io_cost_model(options.fs->type()));
+    }
     input_stream = shared_buffered_input_stream;
 
     // input_stream = CacheInputStream(input_stream)
@@ -287,6 +298,12 @@ Status HdfsScanner::open_random_access_file() {
                             .compression_type = _compression_type};
 
     ASSIGN_OR_RETURN(_file, create_random_access_file(_shared_buffered_input_stream, _cache_input_stream, options));
+    if (config::datacache_readahead_enable && _cache_input_stream != nullptr &&
+        !_scanner_params.datacache_options.enable_cache_select && _runtime_state->query_ctx() != nullptr) {
+        _cache_input_stream->set_readahead(ExecEnv::GetInstance()->thread_pool(),
+                                           _runtime_state->query_ctx()->datacache_readahead_inflight_bytes(),
+                                           config::datacache_readahead_max_inflight_bytes_per_query);
+    }
     return Status::OK();
 }
 
@@ -394,6 +411,9 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->datacache_write_fail_bytes, stats.write_cache_fail_bytes);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_counter, stats.read_block_buffer_count);
         COUNTER_UPDATE(profile->datacache_read_block_buffer_bytes, stats.read_block_buffer_bytes);
+        COUNTER_UPDATE(profile->datacache_readahead_counter, stats.readahead_count);
+        COUNTER_UPDATE(profile->datacache_readahead_bytes, stats.readahead_bytes);
+        COUNTER_UPDATE(profile->datacache_readahead_wait_timer, stats.readahead_wait_ns);
 
         if (_scanner_params.datacache_options.enable_cache_select) {
             // For cache select, we will update load datacache metrics
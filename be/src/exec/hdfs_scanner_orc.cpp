@@ -19,12 +19,15 @@
 #include "exec/exec_node.h"
 #include "exec/iceberg/iceberg_delete_builder.h"
 #include "exec/paimon/paimon_delete_file_builder.h"
+#include "exec/pipeline/query_context.h"
+#include "formats/file_footer_cache.h"
 #include "formats/orc/orc_chunk_reader.h"
 #include "formats/orc/orc_input_stream.h"
 #include "formats/orc/orc_memory_pool.h"
 #include "formats/orc/orc_min_max_decoder.h"
 #include "formats/orc/utils.h"
 #include "gen_cpp/orc_proto.pb.h"
+#include "runtime/exec_env.h"
 #include "simd/simd.h"
 #include "storage/chunk_helper.h"
 #include "util/runtime_profile.h"
@@ -322,8 +325,11 @@ bool OrcRowReaderFilter::filterOnPickStringDictionary(
 Status HdfsOrcScanner::build_iceberg_delete_builder() {
     if (_scanner_params.deletes.empty()) return Status::OK();
     SCOPED_RAW_TIMER(&_app_stats.iceberg_delete_file_build_ns);
+    IcebergDeleteFileCache* delete_file_cache = _runtime_state->query_ctx() != nullptr
+                                                        ? _runtime_state->query_ctx()->iceberg_delete_file_cache()
+                                                        : nullptr;
     const IcebergDeleteBuilder iceberg_delete_builder(_scanner_params.fs, _scanner_params.path, &_need_skip_rowids,
-                                                      _scanner_params.datacache_options);
+                                                      _scanner_params.datacache_options, delete_file_cache);
 
     for (const auto& tdelete_file : _scanner_params.deletes) {
         RETURN_IF_ERROR(iceberg_delete_builder.build_orc(_runtime_state->timezone(), *tdelete_file,
@@ -339,7 +345,7 @@ Status HdfsOrcScanner::build_paimon_delete_file_builder() {
         return Status::OK();
     }
     std::unique_ptr<PaimonDeleteFileBuilder> paimon_delete_file_builder(
-            new PaimonDeleteFileBuilder(_scanner_params.fs, &_need_skip_rowids));
+            new PaimonDeleteFileBuilder(_scanner_params.fs, &_deletion_vector));
     RETURN_IF_ERROR(paimon_delete_file_builder->build(_scanner_params.paimon_deletion_file.get()));
     return Status::OK();
 }
@@ -468,12 +474,30 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
                                                             _shared_buffered_input_stream.get());
         _input_stream->set_lazy_column_coalesce_counter(_scanner_ctx.lazy_column_coalesce_counter);
         _input_stream->set_app_stats(&_app_stats);
+        if (config::orc_prefetch_next_stripe_enable && _shared_buffered_input_stream != nullptr) {
+            _shared_buffered_input_stream->set_prefetch_executor(ExecEnv::GetInstance()->thread_pool());
+            _input_stream->set_prefetch_range(_scanner_ctx.scan_range->offset, _scanner_ctx.scan_range->length);
+        }
     }
     ORCHdfsFileStream* orc_hdfs_file_stream = _input_stream.get();
 
     // create orc reader on this input stream.
     SCOPED_RAW_TIMER(&_app_stats.reader_init_ns);
     std::unique_ptr<orc::Reader> reader;
+    // The serialized file tail is cached by the BE-wide footer cache, so that the scans of the file don't read and
+    // parse it again.
+    FileFooterCache* footer_cache = nullptr;
+    std::string footer_cache_key;
+    std::shared_ptr<std::string> cached_file_tail;
+    if (_scanner_ctx.split_context == nullptr && _scanner_ctx.use_file_metacache &&
+        FileFooterCache::instance()->enabled()) {
+        footer_cache = FileFooterCache::instance();
+        footer_cache_key = FileFooterCache::make_key("orc", _file->filename(),
+                                                     _scanner_params.datacache_options.modification_time,
+                                                     orc_hdfs_file_stream->getLength());
+        SCOPED_RAW_TIMER(&_app_stats.footer_cache_read_ns);
+        cached_file_tail = footer_cache->lookup<std::string>(footer_cache_key);
+    }
     try {
         errno = 0;
         orc::ReaderOptions options;
@@ -481,8 +505,18 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
         if (_scanner_ctx.split_context != nullptr) {
             auto* split_context = down_cast<const SplitContext*>(_scanner_ctx.split_context);
             options.setSerializedFileTail(*(split_context->footer.get()));
+        } else if (cached_file_tail != nullptr) {
+            options.setSerializedFileTail(*cached_file_tail);
+            _app_stats.footer_cache_read_count += 1;
         }
         reader = orc::createReader(std::move(_input_stream), options);
+        if (footer_cache != nullptr && cached_file_tail == nullptr) {
+            auto file_tail = std::make_shared<std::string>(reader->getSerializedFileTail());
+            size_t charge = file_tail->size();
+            footer_cache->insert(footer_cache_key, std::move(file_tail), charge);
+            _app_stats.footer_cache_write_count += 1;
+            _app_stats.footer_cache_write_bytes += charge;
+        }
     } catch (std::exception& e) {
         bool is_not_found = (errno == ENOENT);
         auto s = strings::Substitute("HdfsOrcScanner::do_open failed. reason = $0", e.what());
@@ -589,6 +623,8 @@ StatusOr<size_t> HdfsOrcScanner::_do_get_next_count(ChunkPtr* chunk) {
         read_num_values += _orc_reader->get_cvb_size();
         if (!_need_skip_rowids.empty()) {
             read_num_values -= _orc_reader->get_row_delete_number(_need_skip_rowids);
+        } else if (!_deletion_vector.isEmpty()) {
+            read_num_values -= _orc_reader->get_row_delete_number(_deletion_vector);
         }
     }
 
@@ -611,7 +647,9 @@ StatusOr<size_t> HdfsOrcScanner::_do_get_next(ChunkPtr* chunk) {
             RETURN_IF_ERROR(_orc_reader->read_next(&position));
             {
                 SCOPED_RAW_TIMER(&_app_stats.iceberg_delete_file_build_filter_ns);
-                row_delete_filter = _orc_reader->get_row_delete_filter(_need_skip_rowids);
+                row_delete_filter = _deletion_vector.isEmpty()
+                                            ? _orc_reader->get_row_delete_filter(_need_skip_rowids)
+                                            : _orc_reader->get_row_delete_filter(_deletion_vector);
             }
             // read num values is how many rows actually read before doing dict filtering.
             read_num_values = position.num_values;
@@ -748,6 +786,15 @@ void HdfsOrcScanner::do_update_counter(HdfsScanProfile* profile) {
 
     COUNTER_UPDATE(total_tiny_stripe_size_counter, _app_stats.orc_total_tiny_stripe_size);
 
+    RuntimeProfile::Counter* footer_cache_read_counter = root_profile->add_child_counter(
+            "FooterCacheReadCount", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TCounterAggregateType::SUM),
+            orcProfileSectionPrefix);
+    RuntimeProfile::Counter* footer_cache_write_counter = root_profile->add_child_counter(
+            "FooterCacheWriteCount", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TCounterAggregateType::SUM),
+            orcProfileSectionPrefix);
+    COUNTER_UPDATE(footer_cache_read_counter, _app_stats.footer_cache_read_count);
+    COUNTER_UPDATE(footer_cache_write_counter, _app_stats.footer_cache_write_count);
+
     RuntimeProfile::Counter* stripe_active_lazy_coalesce_together_counter = root_profile->add_child_counter(
             "StripeActiveLazyColumnIOCoalesceTogether", TUnit::UNIT,
             RuntimeProfile::Counter::create_strategy(TCounterAggregateType::SUM), orcProfileSectionPrefix);
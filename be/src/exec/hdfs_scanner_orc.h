@@ -15,6 +15,7 @@
 #pragma once
 
 #include <orc/OrcFile.hh>
+#include <roaring/roaring.hh>
 
 #include "exec/hdfs_scanner.h"
 #include "formats/disk_range.hpp"
@@ -68,6 +69,8 @@ private:
     Filter _dict_filter;
     Filter _chunk_filter;
     std::set<int64_t> _need_skip_rowids;
+    // The deletion vector of paimon.
+    roaring::Roaring _deletion_vector;
     std::unique_ptr<ORCHdfsFileStream> _input_stream;
 };
 
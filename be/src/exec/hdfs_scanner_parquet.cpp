@@ -17,6 +17,7 @@
 #include "exec/hdfs_scanner.h"
 #include "exec/iceberg/iceberg_delete_builder.h"
 #include "exec/paimon/paimon_delete_file_builder.h"
+#include "exec/pipeline/query_context.h"
 #include "formats/parquet/file_reader.h"
 #include "util/runtime_profile.h"
 
@@ -27,8 +28,12 @@ static const std::string kParquetProfileSectionPrefix = "Parquet";
 Status HdfsParquetScanner::do_init(RuntimeState* runtime_state, const HdfsScannerParams& scanner_params) {
     if (!scanner_params.deletes.empty()) {
         SCOPED_RAW_TIMER(&_app_stats.iceberg_delete_file_build_ns);
-        std::unique_ptr<IcebergDeleteBuilder> iceberg_delete_builder(new IcebergDeleteBuilder(
-                scanner_params.fs, scanner_params.path, &_need_skip_rowids, scanner_params.datacache_options));
+        IcebergDeleteFileCache* delete_file_cache = runtime_state->query_ctx() != nullptr
+                                                            ? runtime_state->query_ctx()->iceberg_delete_file_cache()
+                                                            : nullptr;
+        std::unique_ptr<IcebergDeleteBuilder> iceberg_delete_builder(
+                new IcebergDeleteBuilder(scanner_params.fs, scanner_params.path, &_need_skip_rowids,
+                                         scanner_params.datacache_options, delete_file_cache));
         for (const auto& tdelete_file : scanner_params.deletes) {
             RETURN_IF_ERROR(iceberg_delete_builder->build_parquet(
                     runtime_state->timezone(), *tdelete_file, scanner_params.mor_params.equality_slots,
@@ -38,7 +43,7 @@ Status HdfsParquetScanner::do_init(RuntimeState* runtime_state, const HdfsScanne
         _app_stats.iceberg_delete_files_per_scan += scanner_params.deletes.size();
     } else if (scanner_params.paimon_deletion_file != nullptr) {
         std::unique_ptr<PaimonDeleteFileBuilder> paimon_delete_file_builder(
-                new PaimonDeleteFileBuilder(scanner_params.fs, &_need_skip_rowids));
+                new PaimonDeleteFileBuilder(scanner_params.fs, &_deletion_vector));
         RETURN_IF_ERROR(paimon_delete_file_builder->build(scanner_params.paimon_deletion_file.get()));
     }
     return Status::OK();
@@ -156,7 +161,8 @@ Status HdfsParquetScanner::do_open(RuntimeState* runtime_state) {
     // create file reader
     _reader = std::make_shared<parquet::FileReader>(runtime_state->chunk_size(), _file.get(), _file->get_size().value(),
                                                     _scanner_params.datacache_options,
-                                                    _shared_buffered_input_stream.get(), &_need_skip_rowids);
+                                                    _shared_buffered_input_stream.get(), &_need_skip_rowids,
+                                                    &_deletion_vector);
     SCOPED_RAW_TIMER(&_app_stats.reader_init_ns);
     RETURN_IF_ERROR(_reader->init(&_scanner_ctx));
     return Status::OK();
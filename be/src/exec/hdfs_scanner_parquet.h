@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <roaring/roaring.hh>
+
 #include "exec/hdfs_scanner.h"
 
 namespace starrocks {
@@ -35,6 +37,8 @@ public:
 private:
     std::shared_ptr<parquet::FileReader> _reader = nullptr;
     std::set<int64_t> _need_skip_rowids;
+    // The deletion vector of paimon.
+    roaring::Roaring _deletion_vector;
 };
 
 } // namespace starrocks
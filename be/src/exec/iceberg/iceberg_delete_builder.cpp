@@ -14,6 +14,9 @@
 
 #include "exec/iceberg/iceberg_delete_builder.h"
 
+#include <limits>
+#include <string_view>
+
 #include "column/vectorized_fwd.h"
 #include "exec/hdfs_scanner.h"
 #include "exec/iceberg/iceberg_delete_file_iterator.h"
@@ -38,12 +41,15 @@ static const IcebergColumnMeta k_delete_file_path{
 static const IcebergColumnMeta k_delete_file_pos{
         .id = INT32_MAX - 102, .col_name = "pos", .type = TPrimitiveType::BIGINT};
 
-Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
-                                           int64_t file_length, std::set<int64_t>* need_skip_rowids) {
+// Calls |consumer| with the data file path and the position of each row of the parquet position delete file.
+template <typename Consumer>
+static Status read_parquet_position_deletes(FileSystem* fs, const std::string& timezone,
+                                            const std::string& delete_file_path, int64_t file_length,
+                                            Consumer&& consumer) {
     std::vector<SlotDescriptor*> slot_descriptors{&(IcebergDeleteFileMeta::get_delete_file_path_slot()),
                                                   &(IcebergDeleteFileMeta::get_delete_file_pos_slot())};
     auto iter = std::make_unique<IcebergDeleteFileIterator>();
-    RETURN_IF_ERROR(iter->init(_fs, timezone, delete_file_path, file_length, slot_descriptors, true));
+    RETURN_IF_ERROR(iter->init(fs, timezone, delete_file_path, file_length, slot_descriptors, true));
     std::shared_ptr<::arrow::RecordBatch> batch;
 
     Status status;
@@ -57,9 +63,7 @@ Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const st
         ::arrow::StringArray* file_path_array = static_cast<arrow::StringArray*>(batch->column(0).get());
         ::arrow::Int64Array* pos_array = static_cast<arrow::Int64Array*>(batch->column(1).get());
         for (size_t row = 0; row < batch->num_rows(); row++) {
-            if (file_path_array->Value(row) == _datafile_path) {
-                need_skip_rowids->emplace(pos_array->Value(row));
-            }
+            RETURN_IF_ERROR(consumer(file_path_array->Value(row), pos_array->Value(row)));
         }
     }
 
@@ -71,13 +75,16 @@ Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const st
     return Status::OK();
 }
 
-Status ORCPositionDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
-                                       int64_t file_length, std::set<int64_t>* need_skip_rowids) {
+// Calls |consumer| with the data file path and the position of each row of the orc position delete file.
+template <typename Consumer>
+static Status read_orc_position_deletes(FileSystem* fs, const std::string& timezone,
+                                        const std::string& delete_file_path, int64_t file_length,
+                                        Consumer&& consumer) {
     std::vector<SlotDescriptor*> slot_descriptors{&(IcebergDeleteFileMeta::get_delete_file_path_slot()),
                                                   &(IcebergDeleteFileMeta::get_delete_file_pos_slot())};
 
     std::unique_ptr<RandomAccessFile> file;
-    ASSIGN_OR_RETURN(file, _fs->new_random_access_file(delete_file_path));
+    ASSIGN_OR_RETURN(file, fs->new_random_access_file(delete_file_path));
 
     auto input_stream = std::make_unique<ORCHdfsFileStream>(file.get(), file_length, nullptr);
     std::unique_ptr<orc::Reader> reader;
@@ -125,12 +132,78 @@ Status ORCPositionDeleteBuilder::build(const std::string& timezone, const std::s
         auto* file_path_col = static_cast<BinaryColumn*>(chunk->get_column_by_slot_id(k_delete_file_path.id).get());
         auto* position_col = static_cast<Int64Column*>(chunk->get_column_by_slot_id(k_delete_file_pos.id).get());
         for (auto row = 0; row < chunk_size; row++) {
-            if (file_path_col->get_slice(row) != _datafile_path) {
-                continue;
-            }
-            need_skip_rowids->emplace(position_col->get_data()[row]);
+            RETURN_IF_ERROR(consumer(std::string_view(file_path_col->get_slice(row)), position_col->get_data()[row]));
+        }
+    }
+}
+
+// Groups the positions by the data file path. The rows of a position delete file are sorted by the path, so the
+// bitmap of the previous row is reused until the path changes.
+class PositionDeletesCollector {
+public:
+    explicit PositionDeletesCollector(IcebergDeleteFileCache::PositionDeletes* deletes) : _deletes(deletes) {}
+
+    Status operator()(std::string_view path, int64_t pos) {
+        if (pos < 0 || pos > std::numeric_limits<uint32_t>::max()) {
+            return Status::NotSupported(fmt::format("position {} of {} exceeds the bitmap", pos, path));
+        }
+        if (_positions == nullptr || path != _path) {
+            _path = path;
+            _positions = &(*_deletes)[_path];
+        }
+        _positions->add(static_cast<uint32_t>(pos));
+        return Status::OK();
+    }
+
+    void finish() {
+        for (auto& [path, positions] : *_deletes) {
+            positions.runOptimize();
+            positions.shrinkToFit();
         }
     }
+
+private:
+    IcebergDeleteFileCache::PositionDeletes* _deletes;
+    std::string _path;
+    roaring::Roaring* _positions = nullptr;
+};
+
+Status ParquetPositionDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
+                                           int64_t file_length, std::set<int64_t>* need_skip_rowids) {
+    return read_parquet_position_deletes(_fs, timezone, delete_file_path, file_length,
+                                         [&](std::string_view path, int64_t pos) {
+                                             if (path == _datafile_path) {
+                                                 need_skip_rowids->emplace(pos);
+                                             }
+                                             return Status::OK();
+                                         });
+}
+
+Status ParquetPositionDeleteBuilder::build_all(const std::string& timezone, const std::string& delete_file_path,
+                                               int64_t file_length, IcebergDeleteFileCache::PositionDeletes* deletes) {
+    PositionDeletesCollector collector(deletes);
+    RETURN_IF_ERROR(read_parquet_position_deletes(_fs, timezone, delete_file_path, file_length, collector));
+    collector.finish();
+    return Status::OK();
+}
+
+Status ORCPositionDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
+                                       int64_t file_length, std::set<int64_t>* need_skip_rowids) {
+    return read_orc_position_deletes(_fs, timezone, delete_file_path, file_length,
+                                     [&](std::string_view path, int64_t pos) {
+                                         if (path == _datafile_path) {
+                                             need_skip_rowids->emplace(pos);
+                                         }
+                                         return Status::OK();
+                                     });
+}
+
+Status ORCPositionDeleteBuilder::build_all(const std::string& timezone, const std::string& delete_file_path,
+                                           int64_t file_length, IcebergDeleteFileCache::PositionDeletes* deletes) {
+    PositionDeletesCollector collector(deletes);
+    RETURN_IF_ERROR(read_orc_position_deletes(_fs, timezone, delete_file_path, file_length, collector));
+    collector.finish();
+    return Status::OK();
 }
 
 Status ORCEqualityDeleteBuilder::build(const std::string& timezone, const std::string& delete_file_path,
@@ -237,6 +310,76 @@ Status ParquetEqualityDeleteBuilder::build(const std::string& timezone, const st
     return Status::OK();
 }
 
+// Collects the chunks of an equality delete file for the cache instead of building the hash table.
+class EqualityDeletesCollector final : public DefaultMORProcessor {
+public:
+    explicit EqualityDeletesCollector(IcebergDeleteFileCache::EqualityDeletes* deletes) : _deletes(deletes) {}
+
+    Status append_chunk_to_hashtable(ChunkPtr& chunk) override {
+        if (!chunk->is_empty()) {
+            _deletes->emplace_back(chunk);
+        }
+        return Status::OK();
+    }
+
+private:
+    IcebergDeleteFileCache::EqualityDeletes* _deletes;
+};
+
+Status IcebergDeleteBuilder::_build_position_deletes(PositionDeleteBuilder* builder, const std::string& timezone,
+                                                     const TIcebergDeleteFile& delete_file) const {
+    if (_cache != nullptr) {
+        ASSIGN_OR_RETURN(auto deletes, _cache->get_or_load_position_deletes(
+                                               delete_file.full_path, [&](IcebergDeleteFileCache::PositionDeletes* d) {
+                                                   return builder->build_all(timezone, delete_file.full_path,
+                                                                             delete_file.length, d);
+                                               }));
+        if (deletes != nullptr) {
+            auto iter = deletes->find(_datafile_path);
+            if (iter != deletes->end()) {
+                // The positions are ascending, so each of them is inserted at the end of the set.
+                for (uint32_t pos : iter->second) {
+                    _need_skip_rowids->emplace_hint(_need_skip_rowids->end(), pos);
+                }
+            }
+            return Status::OK();
+        }
+    }
+    return builder->build(timezone, delete_file.full_path, delete_file.length, _need_skip_rowids);
+}
+
+Status IcebergDeleteBuilder::_build_equality_deletes(EqualityDeleteBuilder* builder, const std::string& timezone,
+                                                     const TIcebergDeleteFile& delete_file,
+                                                     std::shared_ptr<DefaultMORProcessor> mor_processor,
+                                                     const std::vector<SlotDescriptor*>& slots,
+                                                     TupleDescriptor* delete_column_tuple_desc,
+                                                     const TIcebergSchema* iceberg_equal_delete_schema,
+                                                     RuntimeState* state) const {
+    if (_cache != nullptr) {
+        // The chunks are keyed by the slots too, since the same file may be read by the different scans of a query.
+        std::string key = delete_file.full_path;
+        for (const auto* slot : slots) {
+            key.append(fmt::format(":{}", slot->id()));
+        }
+        ASSIGN_OR_RETURN(auto deletes,
+                         _cache->get_or_load_equality_deletes(key, [&](IcebergDeleteFileCache::EqualityDeletes* d) {
+                             return builder->build(timezone, delete_file.full_path, delete_file.length,
+                                                   std::make_shared<EqualityDeletesCollector>(d), slots,
+                                                   delete_column_tuple_desc, iceberg_equal_delete_schema, state);
+                         }));
+        if (deletes != nullptr) {
+            for (const auto& chunk : *deletes) {
+                // The hash table copies the rows of the chunk, so the cached chunk is left unchanged.
+                ChunkPtr shared_chunk = chunk;
+                RETURN_IF_ERROR(mor_processor->append_chunk_to_hashtable(shared_chunk));
+            }
+            return Status::OK();
+        }
+    }
+    return builder->build(timezone, delete_file.full_path, delete_file.length, std::move(mor_processor), slots,
+                          delete_column_tuple_desc, iceberg_equal_delete_schema, state);
+}
+
 SlotDescriptor IcebergDeleteFileMeta::gen_slot_helper(const IcebergColumnMeta& meta) {
     TSlotDescriptor desc;
     desc.__set_id(meta.id);
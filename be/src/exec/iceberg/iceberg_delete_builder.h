@@ -18,6 +18,7 @@
 
 #include "block_cache/cache_options.h"
 #include "common/status.h"
+#include "exec/iceberg/iceberg_delete_file_cache.h"
 #include "exec/mor_processor.h"
 #include "exec/parquet_scanner.h"
 #include "fs/fs.h"
@@ -46,6 +47,11 @@ public:
 
     virtual Status build(const std::string& timezone, const std::string& file_path, int64_t file_length,
                          std::set<int64_t>* need_skip_rowids) = 0;
+
+    // Reads the positions of all the data files referenced by the delete file, not only of the data file of the
+    // builder, so that they can be shared by the scans of the other data files.
+    virtual Status build_all(const std::string& timezone, const std::string& file_path, int64_t file_length,
+                             IcebergDeleteFileCache::PositionDeletes* deletes) = 0;
 };
 
 class EqualityDeleteBuilder : public DeleteBuilder {
@@ -99,6 +105,8 @@ public:
 
     Status build(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
                  std::set<int64_t>* need_skip_rowids) override;
+    Status build_all(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
+                     IcebergDeleteFileCache::PositionDeletes* deletes) override;
 
 private:
     std::string _datafile_path;
@@ -112,31 +120,37 @@ public:
 
     Status build(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
                  std::set<int64_t>* need_skip_rowids) override;
+    Status build_all(const std::string& timezone, const std::string& delete_file_path, int64_t file_length,
+                     IcebergDeleteFileCache::PositionDeletes* deletes) override;
 
 private:
     std::string _datafile_path;
 };
 
+// Builds the deletes of a data file from its delete files. If |cache| is set, the delete files are read through the
+// per-query cache, so a delete file referenced by many data files is read only once by the query.
 class IcebergDeleteBuilder {
 public:
     IcebergDeleteBuilder(FileSystem* fs, std::string datafile_path, std::set<int64_t>* need_skip_rowids,
-                         const DataCacheOptions& datacache_options = DataCacheOptions())
+                         const DataCacheOptions& datacache_options = DataCacheOptions(),
+                         IcebergDeleteFileCache* cache = nullptr)
             : _fs(fs),
               _datafile_path(std::move(datafile_path)),
               _need_skip_rowids(need_skip_rowids),
-              _datacache_options(datacache_options) {}
+              _datacache_options(datacache_options),
+              _cache(cache) {}
     ~IcebergDeleteBuilder() = default;
 
     Status build_orc(const std::string& timezone, const TIcebergDeleteFile& delete_file,
                      const std::vector<SlotDescriptor*>& slots, RuntimeState* state,
                      std::shared_ptr<DefaultMORProcessor> mor_processor) const {
         if (delete_file.file_content == TIcebergFileContent::POSITION_DELETES) {
-            return ORCPositionDeleteBuilder(_fs, _datacache_options, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, _need_skip_rowids);
+            ORCPositionDeleteBuilder builder(_fs, _datacache_options, _datafile_path);
+            return _build_position_deletes(&builder, timezone, delete_file);
         } else if (delete_file.file_content == TIcebergFileContent::EQUALITY_DELETES) {
-            return ORCEqualityDeleteBuilder(_fs, _datacache_options, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, std::move(mor_processor),
-                           std::move(slots), nullptr, nullptr, state);
+            ORCEqualityDeleteBuilder builder(_fs, _datacache_options, _datafile_path);
+            return _build_equality_deletes(&builder, timezone, delete_file, std::move(mor_processor), slots, nullptr,
+                                           nullptr, state);
         } else {
             const auto s = strings::Substitute("Unsupported iceberg file content: $0", delete_file.file_content);
             LOG(WARNING) << s;
@@ -149,12 +163,12 @@ public:
                          const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state,
                          std::shared_ptr<DefaultMORProcessor> mor_processor) const {
         if (delete_file.file_content == TIcebergFileContent::POSITION_DELETES) {
-            return ParquetPositionDeleteBuilder(_fs, _datacache_options, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, _need_skip_rowids);
+            ParquetPositionDeleteBuilder builder(_fs, _datacache_options, _datafile_path);
+            return _build_position_deletes(&builder, timezone, delete_file);
         } else if (delete_file.file_content == TIcebergFileContent::EQUALITY_DELETES) {
-            return ParquetEqualityDeleteBuilder(_fs, _datacache_options, _datafile_path)
-                    .build(timezone, delete_file.full_path, delete_file.length, std::move(mor_processor),
-                           std::move(slots), delete_column_tuple_desc, iceberg_equal_delete_schema, state);
+            ParquetEqualityDeleteBuilder builder(_fs, _datacache_options, _datafile_path);
+            return _build_equality_deletes(&builder, timezone, delete_file, std::move(mor_processor), slots,
+                                           delete_column_tuple_desc, iceberg_equal_delete_schema, state);
         } else {
             auto s = strings::Substitute("Unsupported iceberg file content: $0", delete_file.file_content);
             LOG(WARNING) << s;
@@ -163,10 +177,19 @@ public:
     }
 
 private:
+    Status _build_position_deletes(PositionDeleteBuilder* builder, const std::string& timezone,
+                                   const TIcebergDeleteFile& delete_file) const;
+    Status _build_equality_deletes(EqualityDeleteBuilder* builder, const std::string& timezone,
+                                   const TIcebergDeleteFile& delete_file,
+                                   std::shared_ptr<DefaultMORProcessor> mor_processor,
+                                   const std::vector<SlotDescriptor*>& slots, TupleDescriptor* delete_column_tuple_desc,
+                                   const TIcebergSchema* iceberg_equal_delete_schema, RuntimeState* state) const;
+
     FileSystem* _fs;
     std::string _datafile_path;
     std::set<int64_t>* _need_skip_rowids;
     const DataCacheOptions _datacache_options;
+    IcebergDeleteFileCache* _cache;
 };
 
 class IcebergDeleteFileMeta {
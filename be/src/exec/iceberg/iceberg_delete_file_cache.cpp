@@ -0,0 +1,89 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/iceberg/iceberg_delete_file_cache.h"
+
+#include "column/chunk.h"
+
+namespace starrocks {
+
+StatusOr<std::shared_ptr<const IcebergDeleteFileCache::PositionDeletes>>
+IcebergDeleteFileCache::get_or_load_position_deletes(const std::string& key, const Loader<PositionDeletes>& loader) {
+    return _get_or_load(&_position_deletes, key, loader);
+}
+
+StatusOr<std::shared_ptr<const IcebergDeleteFileCache::EqualityDeletes>>
+IcebergDeleteFileCache::get_or_load_equality_deletes(const std::string& key, const Loader<EqualityDeletes>& loader) {
+    return _get_or_load(&_equality_deletes, key, loader);
+}
+
+template <typename T>
+StatusOr<std::shared_ptr<const T>> IcebergDeleteFileCache::_get_or_load(EntryMap<T>* entries, const std::string& key,
+                                                                        const Loader<T>& loader) {
+    std::shared_ptr<Entry<T>> entry;
+    {
+        std::lock_guard l(_mutex);
+        auto& e = (*entries)[key];
+        if (e == nullptr) {
+            e = std::make_shared<Entry<T>>();
+        }
+        entry = e;
+    }
+
+    // Hold the lock of the entry while loading, so that the other scans of the file wait for the result
+    // instead of reading the file again.
+    std::lock_guard l(entry->mutex);
+    if (entry->value != nullptr) {
+        _num_hits++;
+        return entry->value;
+    }
+    if (!entry->cacheable) {
+        return std::shared_ptr<const T>();
+    }
+    auto value = std::make_shared<T>();
+    Status st = loader(value.get());
+    if (st.is_not_supported()) {
+        entry->cacheable = false;
+        return std::shared_ptr<const T>();
+    }
+    RETURN_IF_ERROR(st);
+
+    int64_t bytes = _memory_usage_of(*value);
+    if (_memory_usage.fetch_add(bytes) + bytes > _capacity) {
+        // The file is loaded anyway, let the current scan use it.
+        _memory_usage.fetch_sub(bytes);
+        entry->cacheable = false;
+        return std::shared_ptr<const T>(std::move(value));
+    }
+    entry->value = std::move(value);
+    return entry->value;
+}
+
+int64_t IcebergDeleteFileCache::_memory_usage_of(const PositionDeletes& deletes) {
+    int64_t bytes = 0;
+    for (const auto& [path, positions] : deletes) {
+        bytes += path.size() + positions.getSizeInBytes(false);
+    }
+    return bytes;
+}
+
+int64_t IcebergDeleteFileCache::_memory_usage_of(const EqualityDeletes& deletes) {
+    int64_t bytes = 0;
+    for (const auto& chunk : deletes) {
+        bytes += chunk->memory_usage();
+    }
+    return bytes;
+}
+
+} // namespace starrocks
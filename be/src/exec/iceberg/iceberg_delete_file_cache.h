@@ -0,0 +1,85 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <roaring/roaring.hh>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+
+namespace starrocks {
+
+// Caches the contents of the iceberg delete files read by the scans of a query. A delete file is usually referenced
+// by many data files, and without the cache it is read again by the scan of each of them.
+//
+// A file is loaded once by the first scan which needs it, the other scans wait for the loading and share the result.
+// The files which don't fit into the capacity are not cached, their scans read them as before.
+class IcebergDeleteFileCache {
+public:
+    // The positions of the deleted rows of each data file referenced by a position delete file.
+    using PositionDeletes = std::unordered_map<std::string, roaring::Roaring>;
+    // The rows of an equality delete file.
+    using EqualityDeletes = std::vector<ChunkPtr>;
+
+    template <typename T>
+    using Loader = std::function<Status(T*)>;
+
+    explicit IcebergDeleteFileCache(int64_t capacity) : _capacity(capacity) {}
+
+    // Returns the cached deletes of |key|, or loads them by |loader| if they are not cached yet. Returns nullptr if
+    // the deletes of |key| can't be cached, in which case the caller reads the file itself. |loader| returns
+    // NotSupported if the file can't be represented in the cache.
+    StatusOr<std::shared_ptr<const PositionDeletes>> get_or_load_position_deletes(
+            const std::string& key, const Loader<PositionDeletes>& loader);
+    StatusOr<std::shared_ptr<const EqualityDeletes>> get_or_load_equality_deletes(
+            const std::string& key, const Loader<EqualityDeletes>& loader);
+
+    int64_t memory_usage() const { return _memory_usage; }
+    int64_t num_hits() const { return _num_hits; }
+
+private:
+    template <typename T>
+    struct Entry {
+        std::mutex mutex;
+        std::shared_ptr<const T> value;
+        bool cacheable = true;
+    };
+    template <typename T>
+    using EntryMap = std::unordered_map<std::string, std::shared_ptr<Entry<T>>>;
+
+    template <typename T>
+    StatusOr<std::shared_ptr<const T>> _get_or_load(EntryMap<T>* entries, const std::string& key,
+                                                    const Loader<T>& loader);
+
+    static int64_t _memory_usage_of(const PositionDeletes& deletes);
+    static int64_t _memory_usage_of(const EqualityDeletes& deletes);
+
+    const int64_t _capacity;
+    std::atomic<int64_t> _memory_usage = 0;
+    std::atomic<int64_t> _num_hits = 0;
+
+    std::mutex _mutex;
+    EntryMap<PositionDeletes> _position_deletes;
+    EntryMap<EqualityDeletes> _equality_deletes;
+};
+
+} // namespace starrocks
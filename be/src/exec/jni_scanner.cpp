@@ -20,6 +20,7 @@
 #include "column/map_column.h"
 #include "column/struct_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "fmt/core.h"
 #include "udf/java/java_udf.h"
 #include "util/defer_op.h"
@@ -53,12 +54,22 @@ Status JniScanner::do_open(RuntimeState* state) {
     RETURN_IF_ERROR(_init_jni_method(env));
     env->CallVoidMethod(_jni_scanner_obj, _jni_scanner_open);
     RETURN_IF_ERROR(_check_jni_exception(env, "Failed to open the off-heap table scanner."));
+    if (config::jni_scanner_prefetch_enable) {
+        // Let the java scanner read the next chunk while the current one is converted.
+        env->CallVoidMethod(_jni_scanner_obj, _jni_scanner_enable_prefetch);
+        RETURN_IF_ERROR(_check_jni_exception(env, "Failed to enable the prefetch of off-heap table scanner."));
+        _prefetch_enabled = true;
+    }
     return Status::OK();
 }
 
 void JniScanner::do_close(RuntimeState* runtime_state) noexcept {
     JNIEnv* env = JVMFunctionHelper::getInstance().getEnv();
     if (_jni_scanner_obj != nullptr) {
+        if (_prefetch_enabled) {
+            env->CallVoidMethod(_jni_scanner_obj, _jni_scanner_stop_prefetch);
+            _prefetch_enabled = false;
+        }
         if (_jni_scanner_close != nullptr) {
             env->CallVoidMethod(_jni_scanner_obj, _jni_scanner_close);
         }
@@ -87,6 +98,12 @@ Status JniScanner::_init_jni_method(JNIEnv* env) {
 
     _jni_scanner_release_table = env->GetMethodID(_jni_scanner_cls, "releaseOffHeapTable", "()V");
     RETURN_IF_ERROR(_check_jni_exception(env, "Failed to get `releaseOffHeapTable` jni method"));
+
+    _jni_scanner_enable_prefetch = env->GetMethodID(_jni_scanner_cls, "enablePrefetch", "()V");
+    RETURN_IF_ERROR(_check_jni_exception(env, "Failed to get `enablePrefetch` jni method"));
+
+    _jni_scanner_stop_prefetch = env->GetMethodID(_jni_scanner_cls, "stopPrefetch", "()V");
+    RETURN_IF_ERROR(_check_jni_exception(env, "Failed to get `stopPrefetch` jni method"));
     return Status::OK();
 }
 
@@ -97,6 +97,9 @@ private:
     jmethodID _jni_scanner_close = nullptr;
     jmethodID _jni_scanner_release_column = nullptr;
     jmethodID _jni_scanner_release_table = nullptr;
+    jmethodID _jni_scanner_enable_prefetch = nullptr;
+    jmethodID _jni_scanner_stop_prefetch = nullptr;
+    bool _prefetch_enabled = false;
 
     std::map<std::string, std::string> _jni_scanner_params;
     std::string _jni_scanner_factory_class;
@@ -669,6 +669,20 @@ void JoinHashTable::merge_ht(const JoinHashTable& ht) {
         }
         columns[i]->append(*other_columns[i], 1, other_columns[i]->size() - 1);
     }
+
+    // key columns which are not column refs are kept apart from the build chunk
+    auto& key_columns = _table_items->key_columns;
+    const auto& other_key_columns = ht._table_items->key_columns;
+    for (size_t i = 0; i < key_columns.size(); i++) {
+        if (_table_items->join_keys[i].col_ref == nullptr) {
+            if (!key_columns[i]->is_nullable() && other_key_columns[i]->is_nullable()) {
+                // upgrade to nullable column
+                size_t row_count = key_columns[i]->size();
+                key_columns[i] = NullableColumn::create(key_columns[i], NullColumn::create(row_count, 0));
+            }
+            key_columns[i]->append(*other_key_columns[i], 1, other_key_columns[i]->size() - 1);
+        }
+    }
 }
 
 ChunkPtr JoinHashTable::convert_to_spill_schema(const ChunkPtr& chunk) const {
@@ -804,15 +818,26 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
     }
 
     size_t total_size_in_byte = 0;
+    auto& string_sizes = _table_items->fixed_key_string_sizes;
+    string_sizes.clear();
 
-    for (auto& join_key : _table_items->join_keys) {
+    for (size_t i = 0; i < size; i++) {
+        const auto& join_key = _table_items->join_keys[i];
         if (join_key.is_null_safe_equal) {
             total_size_in_byte += 1;
         }
         size_t s = _get_size_of_fixed_and_contiguous_type(join_key.type->type);
+        if (s == 0 && total_size_in_byte < sizeof(int128_t)) {
+            s = _get_size_of_short_string_key(i, sizeof(int128_t) - 1 - total_size_in_byte);
+            if (s > 0) {
+                string_sizes.resize(size, 0);
+                string_sizes[i] = s - 1;
+            }
+        }
         if (s > 0) {
             total_size_in_byte += s;
         } else {
+            string_sizes.clear();
             return JoinHashMapType::slice;
         }
     }
@@ -827,9 +852,30 @@ JoinHashMapType JoinHashTable::_choose_join_hash_map() {
         return JoinHashMapType::fixed128;
     }
 
+    string_sizes.clear();
     return JoinHashMapType::slice;
 }
 
+// The bytes of the string key packed into the fixed size key, i.e. one length byte and the longest build key,
+// or 0 if the key isn't a string or has a build key longer than |max_string_size|.
+size_t JoinHashTable::_get_size_of_short_string_key(size_t key_index, size_t max_string_size) const {
+    const auto& join_key = _table_items->join_keys[key_index];
+    if (!config::enable_join_short_string_fixed_key || join_key.is_null_safe_equal ||
+        (join_key.type->type != TYPE_CHAR && join_key.type->type != TYPE_VARCHAR)) {
+        return 0;
+    }
+    const Column* data_column = ColumnHelper::get_data_column(_table_items->key_columns[key_index].get());
+    if (!data_column->is_binary()) {
+        return 0;
+    }
+    const auto& offsets = down_cast<const BinaryColumn*>(data_column)->get_offset();
+    size_t max_size = 0;
+    for (size_t i = 1; i < offsets.size(); i++) {
+        max_size = std::max<size_t>(max_size, offsets[i] - offsets[i - 1]);
+    }
+    return max_size <= max_string_size ? 1 + max_size : 0;
+}
+
 size_t JoinHashTable::_get_size_of_fixed_and_contiguous_type(LogicalType data_type) {
     switch (data_type) {
     case LogicalType::TYPE_BOOLEAN:
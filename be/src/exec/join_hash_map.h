@@ -29,6 +29,9 @@
 #include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
+#include "gutil/strings/fastmem.h"
+#include "runtime/memory/huge_page_allocator.h"
 #include "simd/simd.h"
 #include "util/phmap/phmap.h"
 
@@ -111,8 +114,9 @@ struct JoinHashTableItems {
     // the list of keys in a bucket.
     // A paper (https://dare.uva.nl/search?identifier=5ccbb60a-38b8-4eeb-858a-e7735dd37487) talks
     // about the bucket-chained hash table of this kind.
-    Buffer<uint32_t> first;
-    Buffer<uint32_t> next;
+    // Both are probed randomly, so the large ones are allocated from huge pages to reduce the TLB misses.
+    HugePageBuffer<uint32_t> first;
+    HugePageBuffer<uint32_t> next;
     Buffer<Slice> build_slice;
     ColumnPtr build_key_column = nullptr;
     uint32_t bucket_size = 0;
@@ -130,8 +134,13 @@ struct JoinHashTableItems {
     float keys_per_bucket = 0;
     size_t used_buckets = 0;
     bool cache_miss_serious = false;
+    // how many probe rows ahead the bucket heads are prefetched, 0 means prefetch is disabled.
+    uint32_t probe_prefetch_distance = 0;
     bool mor_reader_mode = false;
     bool enable_late_materialization = false;
+    // The max bytes of each string key packed into the fixed size key, 0 for the other keys, empty if
+    // no string key is packed. See JoinHashMapHelper::serialize_fixed_size_key_column.
+    std::vector<uint8_t> fixed_key_string_sizes;
 
     float get_keys_per_bucket() const { return keys_per_bucket; }
     bool ht_cache_miss_serious() const { return cache_miss_serious; }
@@ -147,6 +156,8 @@ struct JoinHashTableItems {
             cache_miss_serious = row_count > (1UL << 18) &&
                                  ((probe_bytes > (1UL << 25) && keys_per_bucket > 2) ||
                                   (probe_bytes > (1UL << 26) && keys_per_bucket > 1.5) || probe_bytes > (1UL << 27));
+            probe_prefetch_distance =
+                    cache_miss_serious ? std::max<int32_t>(config::join_hash_map_probe_prefetch_distance, 0) : 0;
             VLOG_QUERY << "ht cache miss serious = " << cache_miss_serious << " row# = " << row_count
                        << " , bytes = " << probe_bytes << " , depth = " << keys_per_bucket;
         }
@@ -359,6 +370,38 @@ public:
         }
     }
 
+    // Fetch the bucket heads of the probe keys. The buckets are visited in random order, so when the hash table
+    // doesn't fit in cache, prefetch the bucket heads `prefetch_distance` rows ahead to overlap the cache misses.
+    static void lookup_bucket_heads(const HugePageBuffer<uint32_t>& first, const Buffer<uint32_t>& buckets,
+                                    Buffer<uint32_t>* next, uint32_t count, uint32_t prefetch_distance) {
+        uint32_t i = 0;
+        if (prefetch_distance > 0) {
+            for (; i + prefetch_distance < count; i++) {
+                __builtin_prefetch(first.data() + buckets[i + prefetch_distance]);
+                (*next)[i] = first[buckets[i]];
+            }
+        }
+        for (; i < count; i++) {
+            (*next)[i] = first[buckets[i]];
+        }
+    }
+
+    // Same as above, rows whose is_nulls[i] is not 0 never match.
+    static void lookup_nullable_bucket_heads(const HugePageBuffer<uint32_t>& first, const Buffer<uint32_t>& buckets,
+                                             const uint8_t* is_nulls, Buffer<uint32_t>* next, uint32_t count,
+                                             uint32_t prefetch_distance) {
+        uint32_t i = 0;
+        if (prefetch_distance > 0) {
+            for (; i + prefetch_distance < count; i++) {
+                __builtin_prefetch(first.data() + buckets[i + prefetch_distance]);
+                (*next)[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+            }
+        }
+        for (; i < count; i++) {
+            (*next)[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+        }
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -367,10 +410,15 @@ public:
         return {buffer, byte_size};
     }
 
+    // A length that no packed string key has, see serialize_short_string_at_interval.
+    static constexpr uint8_t OVERFLOW_SHORT_STRING_SIZE = 0xFF;
+
     // combine keys into fixed size key by column.
+    // string_sizes[i] > 0 means key_columns[i] is a string column packed in 1 + string_sizes[i] bytes.
     template <LogicalType LT>
     static void serialize_fixed_size_key_column(const Columns& key_columns, Column* fixed_size_key_column,
-                                                uint32_t start, uint32_t count) {
+                                                uint32_t start, uint32_t count,
+                                                const std::vector<uint8_t>& string_sizes) {
         using CppType = typename RunTimeTypeTraits<LT>::CppType;
         using ColumnType = typename RunTimeTypeTraits<LT>::ColumnType;
 
@@ -379,11 +427,46 @@ public:
 
         const size_t byte_interval = sizeof(CppType);
         size_t byte_offset = 0;
-        for (const auto& key_col : key_columns) {
+        for (size_t i = 0; i < key_columns.size(); i++) {
+            const auto& key_col = key_columns[i];
+            if (!string_sizes.empty() && string_sizes[i] > 0) {
+                if (key_col->is_large_binary()) {
+                    serialize_short_string_at_interval(*down_cast<const LargeBinaryColumn*>(key_col.get()),
+                                                       buf + byte_offset, byte_interval, start, count,
+                                                       string_sizes[i]);
+                } else {
+                    serialize_short_string_at_interval(*down_cast<const BinaryColumn*>(key_col.get()),
+                                                       buf + byte_offset, byte_interval, start, count,
+                                                       string_sizes[i]);
+                }
+                byte_offset += 1 + string_sizes[i];
+                continue;
+            }
             size_t offset = key_col->serialize_batch_at_interval(buf, byte_offset, byte_interval, start, count);
             byte_offset += offset;
         }
     }
+
+    // Pack each string of at most |max_size| bytes as a length byte followed by the bytes padded with zeros.
+    // The build keys are never longer, so a longer probe key is given OVERFLOW_SHORT_STRING_SIZE as its length
+    // and never matches.
+    template <typename T>
+    static void serialize_short_string_at_interval(const BinaryColumnBase<T>& column, uint8_t* dst,
+                                                   size_t byte_interval, size_t start, size_t count,
+                                                   uint8_t max_size) {
+        const auto& offsets = column.get_offset();
+        const uint8_t* bytes = column.get_bytes().data();
+        for (size_t i = start; i < start + count; i++, dst += byte_interval) {
+            const size_t size = offsets[i + 1] - offsets[i];
+            memset(dst, 0, 1 + max_size);
+            if (size <= max_size) {
+                dst[0] = static_cast<uint8_t>(size);
+                strings::memcpy_inlined(dst + 1, bytes + offsets[i], size);
+            } else {
+                dst[0] = OVERFLOW_SHORT_STRING_SIZE;
+            }
+        }
+    }
 };
 
 template <LogicalType LT>
@@ -861,6 +944,7 @@ private:
 
     JoinHashMapType _choose_join_hash_map();
     static size_t _get_size_of_fixed_and_contiguous_type(LogicalType data_type);
+    size_t _get_size_of_short_string_key(size_t key_index, size_t max_string_size) const;
 
     Status _upgrade_key_columns_if_overflow();
 
@@ -175,7 +175,7 @@ template <LogicalType LT>
 void FixedSizeJoinBuildFunc<LT>::_build_columns(JoinHashTableItems* table_items, HashTableProbeState* probe_state,
                                                 const Columns& data_columns, uint32_t start, uint32_t count) {
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), start,
-                                                           count);
+                                                           count, table_items->fixed_key_string_sizes);
 
     const auto& data = get_key_data(*table_items);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
@@ -201,7 +201,7 @@ void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* tab
     }
 
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, table_items->build_key_column.get(), start,
-                                                           count);
+                                                           count, table_items->fixed_key_string_sizes);
     const auto& data = get_key_data(*table_items);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
 
@@ -271,27 +271,21 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
 
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
-            for (size_t i = 0; i < probe_row_count; i++) {
-                if (null_array[i] == 0) {
-                    probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-                } else {
-                    probe_state->next[i] = 0;
-                }
-            }
+            JoinHashMapHelper::lookup_nullable_bucket_heads(table_items.first, probe_state->buckets,
+                                                            null_array.data(), &probe_state->next, probe_row_count,
+                                                            table_items.probe_prefetch_distance);
             probe_state->null_array = &nullable_column->null_column()->get_data();
         } else {
-            for (size_t i = 0; i < probe_row_count; i++) {
-                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-            }
+            JoinHashMapHelper::lookup_bucket_heads(table_items.first, probe_state->buckets, &probe_state->next,
+                                                   probe_row_count, table_items.probe_prefetch_distance);
             probe_state->null_array = nullptr;
         }
         probe_state->consider_probe_time_locality();
         return;
     }
 
-    for (size_t i = 0; i < probe_row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items.first, probe_state->buckets, &probe_state->next,
+                                           probe_row_count, table_items.probe_prefetch_distance);
     probe_state->consider_probe_time_locality();
     probe_state->null_array = nullptr;
 }
@@ -348,13 +342,11 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
     uint32_t row_count = probe_state->probe_row_count;
 
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, probe_state->probe_key_column.get(), 0,
-                                                           row_count);
+                                                           row_count, table_items.fixed_key_string_sizes);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_bucket_heads(table_items.first, probe_state->buckets, &probe_state->next, row_count,
+                                           table_items.probe_prefetch_distance);
 }
 
 template <LogicalType LT>
@@ -374,17 +366,12 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
     probe_state->null_array = &null_columns[0]->get_data();
 
     JoinHashMapHelper::serialize_fixed_size_key_column<LT>(data_columns, probe_state->probe_key_column.get(), 0,
-                                                           row_count);
+                                                           row_count, table_items.fixed_key_string_sizes);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
-        }
-    }
+    JoinHashMapHelper::lookup_nullable_bucket_heads(table_items.first, probe_state->buckets,
+                                                    probe_state->is_nulls.data(), &probe_state->next, row_count,
+                                                    table_items.probe_prefetch_distance);
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -1031,11 +1018,18 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht(RuntimeState* state,
 
     [[maybe_unused]] size_t probe_cont = 0;
 
+    const size_t prefetch_distance = _table_items->probe_prefetch_distance;
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
         if constexpr (first_probe) {
             _probe_state->probe_match_filter[i] = 0;
         }
+        // prefetch the head of the chain which will be walked `prefetch_distance` rows later.
+        if (prefetch_distance > 0 && i + prefetch_distance < probe_row_count) {
+            size_t ahead_index = _probe_state->next[i + prefetch_distance];
+            XXH_PREFETCH(build_data.data() + ahead_index);
+            XXH_PREFETCH(_table_items->next.data() + ahead_index);
+        }
         size_t build_index = _probe_state->next[i];
         if (build_index != 0) {
             do {
@@ -716,6 +716,10 @@ Status JsonReader::_read_file_broker() {
         return Status::EndOfFile("EOF of reading file");
     }
 
+    if (_range_desc.start_offset > 0 || (_range_desc.size > 0 && _range_desc.start_offset + _range_desc.size < sz)) {
+        return _read_file_split(sz);
+    }
+
     if (sz >= _scanner->_params.json_file_size_limit) {
         return Status::MemoryLimitExceeded(
                 fmt::format("The file size {} exceeds the limit {}, adjust the FE configuration json_file_size_limit "
@@ -752,6 +756,87 @@ Status JsonReader::_read_file_broker() {
     return Status::OK();
 }
 
+// Reads the records of the split [start_offset, start_offset + size) of a ndjson file split by
+// FileDataSourceProvider. A record which starts in the split is read completely even if it ends after the split,
+// and a record which starts before the split is left to the previous split.
+Status JsonReader::_read_file_split(int64_t file_size) {
+    auto* stream = down_cast<io::SeekableInputStream*>(_file->stream().get());
+
+    // Reads [offset, offset + count) of the file to the end of the buffer.
+    auto append = [&](int64_t offset, int64_t count) -> Status {
+        size_t required = _file_broker_buffer_size + static_cast<size_t>(count) + simdjson::SIMDJSON_PADDING;
+        if (required > _file_broker_buffer_capacity) {
+            size_t capacity = std::max(required, _file_broker_buffer_capacity * 2);
+            std::unique_ptr<char[]> buffer(new char[capacity]);
+            memcpy(buffer.get(), _file_broker_buffer.get(), _file_broker_buffer_size);
+            _file_broker_buffer = std::move(buffer);
+            _file_broker_buffer_capacity = capacity;
+        }
+        RETURN_IF_ERROR(stream->read_at_fully(offset, _file_broker_buffer.get() + _file_broker_buffer_size, count));
+        _file_broker_buffer_size += count;
+        _state->update_num_bytes_scan_from_source(count);
+        return Status::OK();
+    };
+
+    _file_broker_buffer_size = 0;
+    int64_t begin = _range_desc.start_offset;
+    int64_t end = std::min(begin + _range_desc.size, file_size);
+    {
+        // A json array file can't be split at the records, it's read by the first split.
+        RETURN_IF_ERROR(append(0, std::min<int64_t>(file_size, 4096)));
+        const char* head_end = _file_broker_buffer.get() + _file_broker_buffer_size;
+        const char* it = std::find_if(_file_broker_buffer.get(), head_end,
+                                      [](char c) { return c != ' ' && c != '\t' && c != '\r' && c != '\n'; });
+        _file_broker_buffer_size = 0;
+        if (it != head_end && *it == '[') {
+            if (begin > 0) {
+                return Status::EndOfFile("EOF of reading file");
+            }
+            end = file_size;
+        }
+    }
+    if (end - begin >= _scanner->_params.json_file_size_limit) {
+        return Status::MemoryLimitExceeded(
+                fmt::format("The split size {} exceeds the limit {}, adjust the FE configuration json_file_size_limit "
+                            "if you are sure you want to perform the operation",
+                            end - begin, _scanner->_params.json_file_size_limit));
+    }
+
+    // Read from the byte before the split to know whether the split starts at a record.
+    int64_t read_begin = begin > 0 ? begin - 1 : 0;
+    RETURN_IF_ERROR(append(read_begin, end - read_begin));
+    size_t skipped = 0;
+    if (begin > 0) {
+        const char* newline =
+                static_cast<const char*>(memchr(_file_broker_buffer.get(), '\n', _file_broker_buffer_size));
+        if (newline == nullptr) {
+            // No record starts in the split.
+            return Status::EndOfFile("EOF of reading file");
+        }
+        skipped = newline - _file_broker_buffer.get() + 1;
+    }
+    // Read the rest of the last record.
+    while (end < file_size && _file_broker_buffer[_file_broker_buffer_size - 1] != '\n') {
+        int64_t count = std::min<int64_t>(file_size - end, 64 * 1024);
+        size_t old_size = _file_broker_buffer_size;
+        RETURN_IF_ERROR(append(end, count));
+        end += count;
+        const char* newline = static_cast<const char*>(memchr(_file_broker_buffer.get() + old_size, '\n', count));
+        if (newline != nullptr) {
+            _file_broker_buffer_size = newline - _file_broker_buffer.get() + 1;
+            break;
+        }
+    }
+    if (skipped >= _file_broker_buffer_size) {
+        return Status::EndOfFile("EOF of reading file");
+    }
+
+    _payload = _file_broker_buffer.get() + skipped;
+    _payload_size = _file_broker_buffer_size - skipped;
+    _payload_capacity = _file_broker_buffer_capacity - skipped;
+    return Status::OK();
+}
+
 Status JsonReader::_check_ndjson() {
     // Check the content format according to the first non-space character.
     // Treat json string started with '{' as ndjson.
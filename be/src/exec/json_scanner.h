@@ -111,6 +111,7 @@ private:
     Status _read_and_parse_json();
     Status _read_file_stream();
     Status _read_file_broker();
+    Status _read_file_split(int64_t file_size);
     Status _parse_payload();
 
     Status _construct_row(simdjson::ondemand::object* row, Chunk* chunk);
@@ -823,6 +823,15 @@ void OlapScanNode::_estimate_scan_and_output_row_bytes() {
     }
 }
 
+int OlapScanNode::max_io_tasks_per_scan_operator() const {
+    const int io_tasks = io_tasks_per_scan_operator();
+    if (!config::enable_olap_scan_adaptive_io_tasks || _sorted_by_keys_per_tablet ||
+        (_olap_scan_node.__isset.max_parallel_scan_instance_num && _olap_scan_node.max_parallel_scan_instance_num >= 1)) {
+        return io_tasks;
+    }
+    return std::max(io_tasks, config::olap_scan_io_tasks_max_size);
+}
+
 size_t OlapScanNode::_scanner_concurrency() const {
     // The max scan parallel num for pipeline engine is io_tasks_per_scan_operator()
     // But the max scan parallel num of non-pipeline engine is kMaxConcurrency.
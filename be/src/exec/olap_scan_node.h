@@ -98,6 +98,7 @@ public:
         }
         return starrocks::ScanNode::io_tasks_per_scan_operator();
     }
+    int max_io_tasks_per_scan_operator() const override;
 
     bool output_chunk_by_bucket() const override { return _output_chunk_by_bucket; }
     bool is_asc_hint() const override { return _output_asc_hint; }
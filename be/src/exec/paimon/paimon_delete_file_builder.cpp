@@ -14,9 +14,7 @@
 
 #include "paimon_delete_file_builder.h"
 
-#include <roaring/roaring.h>
-
-#include <bitset>
+#include <fmt/format.h>
 
 #include "util/raw_container.h"
 
@@ -26,44 +24,48 @@ Status PaimonDeleteFileBuilder::build(const TPaimonDeletionFile* paimon_deletion
     auto& path = paimon_deletion_file->path;
     auto& length = paimon_deletion_file->length;
     auto& offset = paimon_deletion_file->offset;
+    if (length <= MAGIC_NUMBER_LENGTH) {
+        return Status::Corruption(fmt::format("invalid length {} of deletion vector in {}", length, path));
+    }
     auto serialized_bitmap_length = length - MAGIC_NUMBER_LENGTH;
 
     std::shared_ptr<RandomAccessFile> raw_deletion_vector;
     ASSIGN_OR_RETURN(raw_deletion_vector, _fs->new_random_access_file(path));
 
+    // Read the bitmap size, the magic number and the bitmap at once.
+    std::string buffer;
+    raw::stl_string_resize_uninitialized(&buffer, BITMAP_SIZE_LENGTH + length);
+    RETURN_IF_ERROR(raw_deletion_vector->read_at_fully(offset, buffer.data(), buffer.size()));
+
     // Check whether the bitmap size stored in deletion file is equals to the size from paimon api
     uint32_t size_from_deletion_vector_file;
-    RETURN_IF_ERROR(raw_deletion_vector->read_at_fully(offset, &size_from_deletion_vector_file, BITMAP_SIZE_LENGTH));
+    memcpy(&size_from_deletion_vector_file, buffer.data(), BITMAP_SIZE_LENGTH);
 #ifdef IS_LITTLE_ENDIAN
     size_from_deletion_vector_file = swap_endian32(size_from_deletion_vector_file);
 #endif
-
-    DCHECK(size_from_deletion_vector_file == length);
+    if (size_from_deletion_vector_file != length) {
+        return Status::Corruption(fmt::format("deletion vector size {} in {} mismatches the expected {}",
+                                              size_from_deletion_vector_file, path, length));
+    }
 
     // Check the correctness of magic number
     uint32_t magic_number_from_deletion_vector_file;
-    RETURN_IF_ERROR(raw_deletion_vector->read_at_fully(offset + BITMAP_SIZE_LENGTH,
-                                                       &magic_number_from_deletion_vector_file, MAGIC_NUMBER_LENGTH));
+    memcpy(&magic_number_from_deletion_vector_file, buffer.data() + BITMAP_SIZE_LENGTH, MAGIC_NUMBER_LENGTH);
 #ifdef IS_LITTLE_ENDIAN
     magic_number_from_deletion_vector_file = swap_endian32(magic_number_from_deletion_vector_file);
 #endif
-    DCHECK(magic_number_from_deletion_vector_file == MAGIC_NUMBER);
-
-    std::unique_ptr<char[]> deletion_vector(new char[serialized_bitmap_length]);
-    RETURN_IF_ERROR(raw_deletion_vector->read_at_fully(offset + BITMAP_SIZE_LENGTH + MAGIC_NUMBER_LENGTH,
-                                                       deletion_vector.get(), serialized_bitmap_length));
+    if (magic_number_from_deletion_vector_file != MAGIC_NUMBER) {
+        return Status::Corruption(fmt::format("invalid magic number {} of deletion vector in {}",
+                                              magic_number_from_deletion_vector_file, path));
+    }
 
     // Construct the roaring bitmap of corresponding deletion vector
-    roaring_bitmap_t* bitmap =
-            roaring_bitmap_portable_deserialize_safe(deletion_vector.get(), serialized_bitmap_length);
-    // Construct _need_skip_rowids from bitmap
-    uint32_t bitmap_cardinality = roaring_bitmap_get_cardinality(bitmap);
-    std::unique_ptr<uint32_t[]> bitmap_array(new uint32_t[bitmap_cardinality]);
-    roaring_bitmap_to_uint32_array(bitmap, bitmap_array.get());
-    _need_skip_rowids->insert(bitmap_array.get(), bitmap_array.get() + bitmap_cardinality);
-
-    roaring_bitmap_free(bitmap);
-
+    try {
+        *_deletion_vector |= roaring::Roaring::readSafe(buffer.data() + BITMAP_SIZE_LENGTH + MAGIC_NUMBER_LENGTH,
+                                                        serialized_bitmap_length);
+    } catch (const std::exception& e) {
+        return Status::Corruption(fmt::format("failed to deserialize deletion vector in {}: {}", path, e.what()));
+    }
     return Status::OK();
 }
 
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <roaring/roaring.hh>
+
 #include "fs/fs.h"
 #include "gen_cpp/PlanNodes_types.h"
 
@@ -21,8 +23,10 @@ namespace starrocks {
 
 class PaimonDeleteFileBuilder {
 public:
-    PaimonDeleteFileBuilder(FileSystem* fs, std::set<int64_t>* need_skip_rowids)
-            : _fs(fs), _need_skip_rowids(need_skip_rowids) {}
+    // The deletion vector is kept as the roaring bitmap read from the deletion file, which is applied by the readers
+    // directly, instead of being expanded into a set of row ids.
+    PaimonDeleteFileBuilder(FileSystem* fs, roaring::Roaring* deletion_vector)
+            : _fs(fs), _deletion_vector(deletion_vector) {}
     ~PaimonDeleteFileBuilder() = default;
     Status build(const TPaimonDeletionFile* paimon_deletion_file);
 
@@ -33,7 +37,7 @@ private:
     }
 
     FileSystem* _fs;
-    std::set<int64_t>* _need_skip_rowids;
+    roaring::Roaring* _deletion_vector;
 
     // Structure of a deletion file is: 1 byte version num + n * {4 bytes deletion vector length + 4 bytes magic num
     // + (length - 4) bytes bitmap + 4 bytes CRC num}, n is equal to num of data files
@@ -205,7 +205,9 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const ChunkPtr& chunk
             TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection(chunk_size));
         }
 
-        size_t hit_count = SIMD::count_zero(_aggregator->streaming_selection());
+        size_t hit_count = _auto_context.update_reduction_estimate(
+                SIMD::count_zero(_aggregator->streaming_selection()), chunk_size);
+        COUNTER_SET(_aggregator->preagg_reduction_estimate(), _auto_context.reduction_estimate);
         if (_auto_context.adjust_count < continuous_limit && _auto_context.is_low_reduction(hit_count, chunk_size)) {
             RETURN_IF_ERROR(_push_chunk_by_force_streaming(chunk));
             _auto_context.pass_through_count++;
@@ -326,6 +326,8 @@ Status SpillableAggregateBlockingSinkOperatorFactory::prepare(RuntimeState* stat
     _spill_options->wg = state->fragment_ctx()->workgroup();
     _spill_options->enable_buffer_read = state->enable_spill_buffer_read();
     _spill_options->max_read_buffer_bytes = state->max_spill_read_buffer_bytes_per_driver();
+    // the final hash table is merged from memory by the restore instead of being spilled
+    _spill_options->retain_final_mem_table = true;
 
     return Status::OK();
 }
@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/chunk_accumulate_operator.h"
 
+#include "common/config.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
@@ -21,6 +22,7 @@ namespace starrocks::pipeline {
 Status ChunkAccumulateOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     _acc.set_max_size(state->chunk_size());
+    _acc.set_max_bytes(config::pipeline_chunk_target_bytes);
     return Status::OK();
 }
 
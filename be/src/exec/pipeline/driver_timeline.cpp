@@ -0,0 +1,204 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/driver_timeline.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+
+#include "common/config.h"
+#include "exec/pipeline/pipeline_driver.h"
+#include "exec/pipeline/query_context.h"
+#include "fmt/format.h"
+#include "util/spinlock.h"
+#include "util/thread.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+struct DriverTimeline::ThreadBuffer {
+    SpinLock lock;
+    std::vector<Event> events;
+    size_t next = 0;
+    int64_t thread_id;
+    // Set when the thread exits, the buffer is released at the next registration of a thread.
+    std::atomic<bool> retired = false;
+};
+
+DriverTimeline* DriverTimeline::instance() {
+    static DriverTimeline timeline;
+    return &timeline;
+}
+
+DriverTimeline::ThreadBuffer* DriverTimeline::_thread_buffer() {
+    struct Holder {
+        std::shared_ptr<ThreadBuffer> buffer;
+        ~Holder() {
+            if (buffer != nullptr) {
+                buffer->retired = true;
+            }
+        }
+    };
+    static thread_local Holder holder;
+    if (holder.buffer != nullptr) {
+        return holder.buffer.get();
+    }
+    auto buffer = std::make_shared<ThreadBuffer>();
+    buffer->events.resize(std::max(config::pipeline_driver_timeline_events_per_thread, 1));
+    buffer->thread_id = Thread::current_thread_id();
+    std::lock_guard l(_mutex);
+    _buffers.erase(std::remove_if(_buffers.begin(), _buffers.end(), [](const auto& b) { return b->retired.load(); }),
+                   _buffers.end());
+    _buffers.push_back(buffer);
+    holder.buffer = std::move(buffer);
+    return holder.buffer.get();
+}
+
+void DriverTimeline::record(PipelineDriver* driver, uint32_t state) {
+    record(driver->query_ctx()->query_id(), driver->fragment_ctx()->fragment_instance_id(), driver->driver_id(),
+           state);
+}
+
+void DriverTimeline::record(const TUniqueId& query_id, const TUniqueId& fragment_instance_id, int32_t driver_id,
+                            uint32_t state) {
+    Event event{MonotonicNanos(), query_id.hi, query_id.lo, fragment_instance_id.lo, driver_id, state};
+    auto* buffer = _thread_buffer();
+    std::lock_guard l(buffer->lock);
+    buffer->events[buffer->next++ % buffer->events.size()] = event;
+}
+
+static std::string state_name(uint32_t state) {
+    if (state == DriverTimeline::kPreempted) {
+        return "PREEMPTED";
+    }
+    return ds_to_string(static_cast<DriverState>(state));
+}
+
+std::string DriverTimeline::to_chrome_trace(const TUniqueId& query_id) {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard l(_mutex);
+        buffers = _buffers;
+    }
+    // The events of the query and the threads recording them.
+    std::vector<std::pair<Event, int64_t>> events;
+    for (auto& buffer : buffers) {
+        std::lock_guard l(buffer->lock);
+        size_t num_events = std::min(buffer->next, buffer->events.size());
+        for (size_t i = 0; i < num_events; i++) {
+            const auto& event = buffer->events[i];
+            if (event.query_id_hi == query_id.hi && event.query_id_lo == query_id.lo) {
+                events.emplace_back(event, buffer->thread_id);
+            }
+        }
+    }
+    std::stable_sort(events.begin(), events.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first.time_ns < rhs.first.time_ns; });
+
+    rapidjson::StringBuffer buf;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buf);
+    writer.StartObject();
+    writer.Key("displayTimeUnit");
+    writer.String("ns");
+    writer.Key("traceEvents");
+    writer.StartArray();
+
+    const int64_t base_ns = events.empty() ? 0 : events.front().first.time_ns;
+    auto write_event = [&](const std::string& name, char phase, int64_t start_ns, int64_t end_ns, int64_t pid,
+                           int64_t tid) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name.c_str());
+        writer.Key("ph");
+        writer.String(std::string(1, phase).c_str());
+        writer.Key("ts");
+        writer.Double((start_ns - base_ns) / 1000.0);
+        if (phase == 'X') {
+            writer.Key("dur");
+            writer.Double((end_ns - start_ns) / 1000.0);
+        } else {
+            writer.Key("s");
+            writer.String("t");
+        }
+        writer.Key("pid");
+        writer.Int64(pid);
+        writer.Key("tid");
+        writer.Int64(tid);
+        writer.EndObject();
+    };
+    auto write_name = [&](const char* kind, const std::string& name, int64_t pid, int64_t tid) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(kind);
+        writer.Key("ph");
+        writer.String("M");
+        writer.Key("pid");
+        writer.Int64(pid);
+        writer.Key("tid");
+        writer.Int64(tid);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name.c_str());
+        writer.EndObject();
+        writer.EndObject();
+    };
+
+    // The executor threads are the process 0, the fragment instances are the processes from 1.
+    constexpr int64_t kThreadsPid = 0;
+    write_name("process_name", "threads", kThreadsPid, 0);
+    std::map<int64_t, int64_t> fragment_pids;
+    // (fragment instance, driver) => the last state transition.
+    std::map<std::pair<int64_t, int32_t>, std::pair<Event, int64_t>> last_events;
+    for (const auto& [event, thread_id] : events) {
+        auto [pid_it, new_fragment] = fragment_pids.emplace(event.fragment_instance_id_lo, fragment_pids.size() + 1);
+        int64_t pid = pid_it->second;
+        if (new_fragment) {
+            write_name("process_name", fmt::format("fragment {:x}", event.fragment_instance_id_lo), pid, 0);
+        }
+        if (event.state == kPreempted) {
+            write_event(state_name(event.state), 'i', event.time_ns, event.time_ns, pid, event.driver_id);
+            continue;
+        }
+        auto [last_it, new_driver] = last_events.try_emplace(
+                std::make_pair(event.fragment_instance_id_lo, event.driver_id), event, thread_id);
+        if (new_driver) {
+            write_name("thread_name", fmt::format("driver {}", event.driver_id), pid, event.driver_id);
+            continue;
+        }
+        const auto& [last_event, last_thread_id] = last_it->second;
+        write_event(state_name(last_event.state), 'X', last_event.time_ns, event.time_ns, pid, event.driver_id);
+        if (last_event.state == DriverState::RUNNING) {
+            write_event(fmt::format("fragment {:x} driver {}", event.fragment_instance_id_lo, event.driver_id), 'X',
+                        last_event.time_ns, event.time_ns, kThreadsPid, last_thread_id);
+        }
+        last_it->second = {event, thread_id};
+    }
+    // The last states of the drivers, which are still in them or finished.
+    for (const auto& [key, value] : last_events) {
+        const auto& event = value.first;
+        write_event(state_name(event.state), 'i', event.time_ns, event.time_ns,
+                    fragment_pids[event.fragment_instance_id_lo], event.driver_id);
+    }
+
+    writer.EndArray();
+    writer.EndObject();
+    return buf.GetString();
+}
+
+} // namespace starrocks::pipeline
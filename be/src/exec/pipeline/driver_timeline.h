@@ -0,0 +1,76 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "gen_cpp/Types_types.h"
+#include "gutil/macros.h"
+
+namespace starrocks::pipeline {
+
+class PipelineDriver;
+
+// The timeline of the state transitions of the drivers of the queries with enable_query_debug_trace: when a driver
+// runs on which thread, waits in the ready queue, is blocked in the poller or is preempted by another workgroup.
+// Unlike the profile, which only keeps the total time of each state, it shows the scheduling of the drivers over
+// time, e.g. the starvation of the scan drivers or the latency of the poller.
+//
+// Each thread records the transitions into its own ring buffer of config::pipeline_driver_timeline_events_per_thread
+// events, so recording costs an uncontended spin lock. The transitions of a query are kept until overwritten, also
+// after the query finishes, and exported in the Chrome trace format by /api/pipeline_driver_timeline, which can be
+// opened by chrome://tracing or https://ui.perfetto.dev.
+class DriverTimeline {
+public:
+    // Not a DriverState, the driver yields to the drivers of another workgroup.
+    static constexpr uint32_t kPreempted = 1000;
+
+    static DriverTimeline* instance();
+
+    // Records that |driver| turns to |state| at now.
+    void record(PipelineDriver* driver, uint32_t state);
+    void record(const TUniqueId& query_id, const TUniqueId& fragment_instance_id, int32_t driver_id, uint32_t state);
+
+    // Returns the transitions of |query_id| in the JSON object format of the Chrome trace. Each fragment instance is
+    // a process whose threads are its drivers, and the RUNNING slices are also shown on the threads of the
+    // executors.
+    std::string to_chrome_trace(const TUniqueId& query_id);
+
+    DISALLOW_COPY_AND_MOVE(DriverTimeline);
+
+private:
+    struct Event {
+        int64_t time_ns;
+        int64_t query_id_hi;
+        int64_t query_id_lo;
+        int64_t fragment_instance_id_lo;
+        int32_t driver_id;
+        uint32_t state;
+    };
+
+    struct ThreadBuffer;
+
+    DriverTimeline() = default;
+
+    ThreadBuffer* _thread_buffer();
+
+    std::mutex _mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> _buffers;
+};
+
+} // namespace starrocks::pipeline
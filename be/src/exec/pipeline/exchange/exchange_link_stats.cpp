@@ -0,0 +1,99 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/exchange_link_stats.h"
+
+#include <algorithm>
+
+#include "fmt/format.h"
+
+namespace starrocks::pipeline {
+
+ExchangeLinkStats* ExchangeLinkStats::instance() {
+    static ExchangeLinkStats stats;
+    return &stats;
+}
+
+ExchangeLinkStats::Link* ExchangeLinkStats::get_or_create_link(const std::string& hostname, int32_t port) {
+    std::string address = fmt::format("{}:{}", hostname, port);
+    std::lock_guard<std::mutex> l(_mutex);
+    auto& link = _links[address];
+    if (link == nullptr) {
+        link = std::make_unique<Link>();
+    }
+    return link.get();
+}
+
+size_t ExchangeLinkStats::rtt_bucket(int64_t rtt_ns) {
+    int64_t rtt_ms = rtt_ns / 1000000;
+    if (rtt_ms <= 0) {
+        return 0;
+    }
+    size_t bucket = 64 - __builtin_clzll(static_cast<uint64_t>(rtt_ms));
+    return std::min(bucket, kNumRttBuckets - 1);
+}
+
+void ExchangeLinkStats::record_rpc(Link* link, int64_t rtt_ns, int64_t bytes_sent, int64_t raw_bytes_sent) {
+    link->rpc_count++;
+    link->bytes_sent += bytes_sent;
+    link->raw_bytes_sent += raw_bytes_sent;
+    link->rtt_ns += rtt_ns;
+    int64_t max_rtt_ns = link->max_rtt_ns;
+    while (rtt_ns > max_rtt_ns && !link->max_rtt_ns.compare_exchange_weak(max_rtt_ns, rtt_ns)) {
+    }
+    link->rtt_histogram[rtt_bucket(rtt_ns)]++;
+}
+
+std::vector<ExchangeLinkStats::LinkSnapshot> ExchangeLinkStats::snapshot() const {
+    std::vector<LinkSnapshot> snapshots;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        snapshots.reserve(_links.size());
+        for (const auto& [address, link] : _links) {
+            auto& snapshot = snapshots.emplace_back();
+            snapshot.address = address;
+            snapshot.rpc_count = link->rpc_count;
+            snapshot.failed_rpc_count = link->failed_rpc_count;
+            snapshot.bytes_sent = link->bytes_sent;
+            snapshot.raw_bytes_sent = link->raw_bytes_sent;
+            snapshot.rtt_ns = link->rtt_ns;
+            snapshot.max_rtt_ns = link->max_rtt_ns;
+            snapshot.queue_wait_ns = link->queue_wait_ns;
+            for (size_t i = 0; i < kNumRttBuckets; ++i) {
+                snapshot.rtt_histogram[i] = link->rtt_histogram[i];
+            }
+        }
+    }
+    std::sort(snapshots.begin(), snapshots.end(),
+              [](const LinkSnapshot& lhs, const LinkSnapshot& rhs) { return lhs.address < rhs.address; });
+    return snapshots;
+}
+
+void ExchangeLinkStats::reset() {
+    std::lock_guard<std::mutex> l(_mutex);
+    for (auto& [_, link] : _links) {
+        link->rpc_count = 0;
+        link->failed_rpc_count = 0;
+        link->bytes_sent = 0;
+        link->raw_bytes_sent = 0;
+        link->rtt_ns = 0;
+        link->max_rtt_ns = 0;
+        link->queue_wait_ns = 0;
+        for (auto& bucket : link->rtt_histogram) {
+            bucket = 0;
+        }
+    }
+}
+
+} // namespace starrocks::pipeline
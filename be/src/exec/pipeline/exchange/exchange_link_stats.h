@@ -0,0 +1,85 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+// ExchangeLinkStats aggregates the transmit chunk rpcs sent by all the SinkBuffers of this BE per destination
+// (host:port), so a slow link or a slow receiver can be found no matter which queries are running over it.
+// The links are never removed, their number is bounded by the number of the backends in the cluster.
+class ExchangeLinkStats {
+public:
+    // The i-th bucket counts the rpcs whose round trip time is in [2^(i-1), 2^i) ms,
+    // the first one counts those less than 1ms and the last one counts all the slower ones.
+    static constexpr size_t kNumRttBuckets = 16;
+
+    struct Link {
+        std::atomic<int64_t> rpc_count{0};
+        std::atomic<int64_t> failed_rpc_count{0};
+        // Bytes of the attachments, which may be compressed.
+        std::atomic<int64_t> bytes_sent{0};
+        // Bytes of the serialized chunks before compression.
+        std::atomic<int64_t> raw_bytes_sent{0};
+        std::atomic<int64_t> rtt_ns{0};
+        std::atomic<int64_t> max_rtt_ns{0};
+        // Time the requests wait in the SinkBuffer for the rpc window of the destination.
+        std::atomic<int64_t> queue_wait_ns{0};
+        std::array<std::atomic<int64_t>, kNumRttBuckets> rtt_histogram{};
+    };
+
+    struct LinkSnapshot {
+        std::string address;
+        int64_t rpc_count = 0;
+        int64_t failed_rpc_count = 0;
+        int64_t bytes_sent = 0;
+        int64_t raw_bytes_sent = 0;
+        int64_t rtt_ns = 0;
+        int64_t max_rtt_ns = 0;
+        int64_t queue_wait_ns = 0;
+        std::array<int64_t, kNumRttBuckets> rtt_histogram{};
+    };
+
+    static ExchangeLinkStats* instance();
+
+    // The returned link is valid for the lifetime of this object.
+    Link* get_or_create_link(const std::string& hostname, int32_t port);
+
+    static void record_rpc(Link* link, int64_t rtt_ns, int64_t bytes_sent, int64_t raw_bytes_sent);
+    static void record_queue_wait(Link* link, int64_t queue_wait_ns) { link->queue_wait_ns += queue_wait_ns; }
+    static void record_failure(Link* link) { link->failed_rpc_count++; }
+
+    static size_t rtt_bucket(int64_t rtt_ns);
+
+    // Links ordered by the address.
+    std::vector<LinkSnapshot> snapshot() const;
+
+    // Zero the counters of all the links.
+    void reset();
+
+private:
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<Link>> _links;
+};
+
+} // namespace starrocks::pipeline
@@ -20,6 +20,8 @@
 #include <iostream>
 #include <memory>
 #include <random>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "common/config.h"
@@ -39,6 +41,13 @@
 
 namespace starrocks::pipeline {
 
+// Copying a small chunk into the blocks of iobuf is cheaper than managing a standalone user data block for it.
+static constexpr size_t kZeroCopyAttachmentMinBytes = 64 * 1024;
+// Sample one of every kHotKeySampleInterval rows into a sketch of kHotKeySketchCapacity counters, any partition key
+// in more than 1/kHotKeySketchCapacity of the samples is found.
+static constexpr size_t kHotKeySampleInterval = 8;
+static constexpr size_t kHotKeySketchCapacity = 32;
+
 class ExchangeSinkOperator::Channel {
 public:
     // Create channel to send data to particular ipaddress/port/query/node
@@ -100,11 +109,23 @@ public:
 
     bool is_local();
 
+    const TNetworkAddress& brpc_dest_addr() const { return _brpc_dest_addr; }
+
+    // For broadcast, the receiver BE fans out the chunks sent to this channel to the fragment instance
+    // of `follower`, which sends nothing itself.
+    void add_fanout_follower(Channel* follower) {
+        _fanout_finst_ids.emplace_back(follower->_fragment_instance_id);
+        follower->_is_fanout_follower = true;
+    }
+
+    bool is_fanout_follower() const { return _is_fanout_follower; }
+
 private:
     Status _close_internal(RuntimeState* state, FragmentContext* fragment_ctx);
 
     bool _check_use_pass_through();
     void _prepare_pass_through();
+    void _set_fanout_finst_ids(PTransmitChunkParams* chunk_request) const;
 
     ExchangeSinkOperator* _parent;
 
@@ -133,8 +154,20 @@ private:
     bool _use_pass_through = false;
     // local data is shuffled without really remote network, so it cannot be considered in computing exchange speed.
     bool _ignore_local_data = false;
+
+    std::vector<TUniqueId> _fanout_finst_ids;
+    bool _is_fanout_follower = false;
 };
 
+void ExchangeSinkOperator::Channel::_set_fanout_finst_ids(PTransmitChunkParams* chunk_request) const {
+    chunk_request->clear_fanout_finst_ids();
+    for (const auto& finst_id : _fanout_finst_ids) {
+        auto* pfinst_id = chunk_request->add_fanout_finst_ids();
+        pfinst_id->set_hi(finst_id.hi);
+        pfinst_id->set_lo(finst_id.lo);
+    }
+}
+
 bool ExchangeSinkOperator::Channel::is_local() {
     if (BackendOptions::get_localhost() != _brpc_dest_addr.hostname) {
         return false;
@@ -174,7 +207,7 @@ Status ExchangeSinkOperator::Channel::init(RuntimeState* state) {
         _is_inited = true;
         return Status::OK();
     }
-    _brpc_stub = state->exec_env()->brpc_stub_cache()->get_stub(_brpc_dest_addr);
+    _brpc_stub = state->exec_env()->brpc_stub_cache()->get_stub(_brpc_dest_addr, BrpcTrafficClass::EXCHANGE);
 
     if (_brpc_stub == nullptr) {
         auto msg = fmt::format("The brpc stub of {}:{} is null.", _brpc_dest_addr.hostname, _brpc_dest_addr.port);
@@ -231,6 +264,7 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
         if (_parent->_is_pipeline_level_shuffle) {
             _chunk_request->set_is_pipeline_level_shuffle(true);
         }
+        _set_fanout_finst_ids(_chunk_request.get());
     }
 
     // If chunk is not null, append it to request
@@ -275,7 +309,7 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
 Status ExchangeSinkOperator::Channel::send_chunk_request(RuntimeState* state, PTransmitChunkParamsPtr chunk_request,
                                                          const butil::IOBuf& attachment,
                                                          int64_t attachment_physical_bytes) {
-    if (_ignore_local_data) {
+    if (_ignore_local_data || _is_fanout_follower) {
         return Status::OK();
     }
     chunk_request->set_node_id(_dest_node_id);
@@ -283,6 +317,7 @@ Status ExchangeSinkOperator::Channel::send_chunk_request(RuntimeState* state, PT
     chunk_request->set_be_number(_parent->_be_number);
     chunk_request->set_eos(false);
     chunk_request->set_use_pass_through(_use_pass_through);
+    _set_fanout_finst_ids(chunk_request.get());
     TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub,     std::move(chunk_request), attachment,
                               attachment_physical_bytes,   _brpc_dest_addr};
     RETURN_IF_ERROR(_parent->_buffer->add_request(info));
@@ -295,6 +330,11 @@ Status ExchangeSinkOperator::Channel::_close_internal(RuntimeState* state, Fragm
     if (this->_fragment_instance_id.lo == -1) {
         return Status::OK();
     }
+    // The EOS of a fanout follower is carried by the EOS of its leader.
+    if (_is_fanout_follower) {
+        _parent->_buffer->skip_eos(_fragment_instance_id);
+        return Status::OK();
+    }
     Status res = Status::OK();
 
     DeferOp op([&res, &fragment_ctx]() {
@@ -425,6 +465,9 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
         _unique_metrics->add_info_string("ShuffleNumPerChannel", std::to_string(_num_shuffles_per_channel));
         _unique_metrics->add_info_string("TotalShuffleNum", std::to_string(_num_shuffles));
         _unique_metrics->add_info_string("PipelineLevelShuffle", _is_pipeline_level_shuffle ? "Yes" : "No");
+        _hot_key_sketch = std::make_unique<HeavyHitterSketch<uint32_t>>(kHotKeySketchCapacity);
+        _hot_key_rows_counter = ADD_COUNTER(_unique_metrics, "HotKeyRows", TUnit::UNIT);
+        _hot_key_rows_percent_counter = ADD_COUNTER(_unique_metrics, "HotKeyRowsPercent", TUnit::UNIT);
     }
 
     // Randomize the order we open/transmit to channels to avoid thundering herd problems.
@@ -452,6 +495,9 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     for (auto& [_, channel] : _instance_id2channel) {
         RETURN_IF_ERROR(channel->init(state));
     }
+    if (config::enable_exchange_broadcast_fanout && _part_type == TPartitionType::UNPARTITIONED) {
+        _init_broadcast_fanout();
+    }
 
     _shuffle_channel_ids.resize(state->chunk_size());
     _row_indexes.resize(state->chunk_size());
@@ -459,6 +505,27 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
+void ExchangeSinkOperator::_init_broadcast_fanout() {
+    // Group the channels by the destination BE in the order of the destinations, so all the drivers sharing
+    // the sink buffer choose the same leader for every BE.
+    std::unordered_map<std::string, Channel*> leaders;
+    std::unordered_set<int64_t> visited;
+    int num_followers = 0;
+    for (auto* channel : _channels) {
+        const auto& finst_id = channel->get_fragment_instance_id();
+        if (finst_id.lo == -1 || channel->use_pass_through() || !visited.insert(finst_id.lo).second) {
+            continue;
+        }
+        const auto& addr = channel->brpc_dest_addr();
+        auto [it, inserted] = leaders.emplace(fmt::format("{}:{}", addr.hostname, addr.port), channel);
+        if (!inserted) {
+            it->second->add_fanout_follower(channel);
+            num_followers++;
+        }
+    }
+    _unique_metrics->add_info_string("BroadcastFanoutChannels", std::to_string(num_followers));
+}
+
 bool ExchangeSinkOperator::is_finished() const {
     return _is_finished;
 }
@@ -582,6 +649,12 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
                 }
             }
 
+            size_t sample_idx = _hot_key_sample_offset;
+            for (; sample_idx < num_rows; sample_idx += kHotKeySampleInterval) {
+                _hot_key_sketch->add(_hash_values[sample_idx]);
+            }
+            _hot_key_sample_offset = sample_idx - num_rows;
+
             // Compute row indexes for each channel's each shuffle
             _channel_row_idx_start_points.assign(_num_shuffles + 1, 0);
             _shuffler->exchange_shuffle(_shuffle_channel_ids, _hash_values, num_rows);
@@ -646,10 +719,17 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
         _chunk_request.reset();
     }
     Status status = Status::OK();
-    for (auto& [_, channel] : _instance_id2channel) {
-        auto tmp_status = channel->close(state, _fragment_ctx);
-        if (!tmp_status.ok()) {
-            status = tmp_status;
+    // The fanout followers are closed before their leaders, so the last EOS counted by the sink buffer
+    // is always a real one, which finishes the receivers of the followers as well.
+    for (bool closing_followers : {true, false}) {
+        for (auto& [_, channel] : _instance_id2channel) {
+            if (channel->is_fanout_follower() != closing_followers) {
+                continue;
+            }
+            auto tmp_status = channel->close(state, _fragment_ctx);
+            if (!tmp_status.ok()) {
+                status = tmp_status;
+            }
         }
     }
 
@@ -661,6 +741,13 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     if (_driver_sequence == 0) {
         _buffer->update_profile(_unique_metrics.get());
     }
+    if (_hot_key_sketch != nullptr && !_hot_key_sketch->empty()) {
+        // A lower bound of the rows of the hottest key, the keys evenly distributed report almost nothing.
+        const auto& top = _hot_key_sketch->top();
+        int64_t sampled_rows = top.count - top.error;
+        COUNTER_SET(_hot_key_rows_counter, static_cast<int64_t>(sampled_rows * kHotKeySampleInterval));
+        COUNTER_SET(_hot_key_rows_percent_counter, static_cast<int64_t>(sampled_rows * 100 / _hot_key_sketch->total()));
+    }
     Operator::close(state);
 }
 
@@ -739,6 +826,20 @@ int64_t ExchangeSinkOperator::construct_brpc_attachment(const PTransmitChunkPara
         auto chunk = chunk_request->mutable_chunks(i);
         chunk->set_data_size(chunk->data().size());
 
+        if (chunk->data_size() >= kZeroCopyAttachmentMinBytes) {
+            // Hand the serialized data over to the attachment rather than copying it into the blocks of iobuf,
+            // it's released once the rpc is done with it.
+            auto* data = new std::string(std::move(*chunk->mutable_data()));
+            chunk->clear_data();
+            if (attachment.append_user_data(data->data(), data->size(), [data](void*) { delete data; }) == 0) {
+                attachment_physical_bytes += data->capacity();
+                continue;
+            }
+            // The deleter is not taken over on failure, fall back to copying.
+            chunk->mutable_data()->swap(*data);
+            delete data;
+        }
+
         int64_t before_bytes = CurrentThread::current().get_consumed_bytes();
         attachment.append(chunk->data());
         attachment_physical_bytes += CurrentThread::current().get_consumed_bytes() - before_bytes;
@@ -29,6 +29,7 @@
 #include "gen_cpp/data.pb.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "serde/protobuf_serde.h"
+#include "util/heavy_hitter_sketch.h"
 #include "util/raw_container.h"
 #include "util/runtime_profile.h"
 
@@ -90,6 +91,9 @@ private:
         return sz > runtime_state()->chunk_size() * 512;
     }
 
+    // For broadcast, let the first channel to every destination BE carry the chunks of the other channels to it.
+    void _init_broadcast_fanout();
+
 private:
     class Channel;
 
@@ -182,6 +186,8 @@ private:
     RuntimeProfile::Counter* _serialized_bytes_counter = nullptr;
     RuntimeProfile::Counter* _compressed_bytes_counter = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _pass_through_buffer_peak_mem_usage = nullptr;
+    RuntimeProfile::Counter* _hot_key_rows_counter = nullptr;
+    RuntimeProfile::Counter* _hot_key_rows_percent_counter = nullptr;
 
     std::atomic<bool> _is_finished = false;
     std::atomic<bool> _is_cancelled = false;
@@ -202,6 +208,9 @@ private:
     // channel 0's row first, then channel 1's row indexes, then put channel 2's row indexes in
     // the last.
     std::vector<uint32_t> _row_indexes;
+    // Sampled partition hash values to find the hottest partition key, which makes its destination the slowest one.
+    std::unique_ptr<HeavyHitterSketch<uint32_t>> _hot_key_sketch;
+    size_t _hot_key_sample_offset = 0;
 
     FragmentContext* const _fragment_ctx;
 
@@ -33,6 +33,10 @@ bool ExchangeSourceOperator::has_output() const {
     return _stream_recvr->has_output_for_pipeline(_driver_sequence);
 }
 
+PipelineObservable* ExchangeSourceOperator::observable() {
+    return _stream_recvr->observable();
+}
+
 bool ExchangeSourceOperator::is_finished() const {
     return _stream_recvr->is_finished();
 }
@@ -55,6 +55,8 @@ Status Partitioner::partition_chunk(const ChunkPtr& chunk, int32_t num_partition
 
 Status Partitioner::send_chunk(const ChunkPtr& chunk,
                                const std::shared_ptr<std::vector<uint32_t>>& partition_row_indexes) {
+    // unpack chunk's const column once for all the partitions, since Chunk#append_selective cannot be const column
+    chunk->unpack_and_duplicate_const_columns();
     size_t num_partitions = _source->get_sources().size();
     for (size_t i = 0; i < num_partitions; ++i) {
         size_t from = partition_begin_offset(i);
@@ -22,40 +22,47 @@ namespace starrocks::pipeline {
 // Used for PassthroughExchanger.
 // The input chunk is most likely full, so we don't merge it to avoid copying chunk data.
 void LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return;
     }
     size_t memory_usage = chunk->memory_usage();
     size_t num_rows = chunk->num_rows();
-    _local_memory_usage += memory_usage;
-    _full_chunk_queue.emplace(std::move(chunk));
+    // Account before enqueue, so the counters never drop below zero when the chunk is pulled at once.
+    _num_full_chunks++;
+    _full_chunk_memory_usage += memory_usage;
     _memory_manager->update_memory_usage(memory_usage, num_rows);
+    _full_chunk_queue.enqueue(std::move(chunk));
+    // Double check, set_finished() may have cleared the queue before the chunk is enqueued.
+    if (_is_finished) {
+        _clear_full_chunk_queue();
+    }
+    _observable.notify_observers();
 }
 
 // Used for PartitionExchanger.
 // Only enqueue the partition chunk information here, and merge chunk in pull_chunk().
 Status LocalExchangeSourceOperator::add_chunk(ChunkPtr chunk, const std::shared_ptr<std::vector<uint32_t>>& indexes,
                                               uint32_t from, uint32_t size, size_t memory_usage) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
-    if (_is_finished) {
-        return Status::OK();
-    }
-
-    // unpack chunk's const column, since Chunk#append_selective cannot be const column
-    chunk->unpack_and_duplicate_const_columns();
+    // The const columns of the chunk have been unpacked by Partitioner::send_chunk, since
+    // Chunk#append_selective cannot be const column.
+    {
+        std::lock_guard<std::mutex> l(_chunk_lock);
+        if (_is_finished) {
+            return Status::OK();
+        }
 
-    _partition_chunk_queue.emplace(std::move(chunk), std::move(indexes), from, size, memory_usage);
-    _partition_rows_num += size;
-    _local_memory_usage += memory_usage;
-    _memory_manager->update_memory_usage(memory_usage, size);
+        _partition_chunk_queue.emplace(std::move(chunk), std::move(indexes), from, size, memory_usage);
+        _partition_rows_num += size;
+        _local_memory_usage += memory_usage;
+        _memory_manager->update_memory_usage(memory_usage, size);
+    }
+    _observable.notify_observers();
 
     return Status::OK();
 }
 
 Status LocalExchangeSourceOperator::add_chunk(const std::vector<std::string>& partition_key,
                                               std::unique_ptr<Chunk> chunk) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
     if (_is_finished) {
         return Status::OK();
     }
@@ -65,51 +72,65 @@ Status LocalExchangeSourceOperator::add_chunk(const std::vector<std::string>& pa
     auto memory_usage = chunk->memory_usage();
     auto num_rows = chunk->num_rows();
 
-    _partition_key2partial_chunks[partition_key].queue.push(std::move(chunk));
-    _partition_key2partial_chunks[partition_key].num_rows += num_rows;
-    _partition_key2partial_chunks[partition_key].memory_usage += memory_usage;
+    {
+        std::lock_guard<std::mutex> l(_chunk_lock);
+        if (_is_finished) {
+            return Status::OK();
+        }
 
-    _local_memory_usage += memory_usage;
-    _memory_manager->update_memory_usage(memory_usage, num_rows);
+        _partition_key2partial_chunks[partition_key].queue.push(std::move(chunk));
+        _partition_key2partial_chunks[partition_key].num_rows += num_rows;
+        _partition_key2partial_chunks[partition_key].memory_usage += memory_usage;
+
+        _local_memory_usage += memory_usage;
+        _memory_manager->update_memory_usage(memory_usage, num_rows);
+    }
+    _observable.notify_observers();
     return Status::OK();
 }
 
 bool LocalExchangeSourceOperator::is_finished() const {
     std::lock_guard<std::mutex> l(_chunk_lock);
-    if (_full_chunk_queue.empty() && !_partition_rows_num && _key_partition_pending_chunk_empty()) {
+    if (!_partition_rows_num && _key_partition_pending_chunk_empty()) {
         if (UNLIKELY(_local_memory_usage != 0)) {
             throw std::runtime_error("_local_memory_usage should be 0 as there is no rows left.");
         }
     }
 
-    return _is_finished && _full_chunk_queue.empty() && !_partition_rows_num && _key_partition_pending_chunk_empty();
+    return _is_finished && _num_full_chunks == 0 && !_partition_rows_num && _key_partition_pending_chunk_empty();
 }
 
 bool LocalExchangeSourceOperator::has_output() const {
     std::lock_guard<std::mutex> l(_chunk_lock);
 
-    return !_full_chunk_queue.empty() || _partition_rows_num >= _factory->runtime_state()->chunk_size() ||
+    return _num_full_chunks > 0 || _partition_rows_num >= _factory->runtime_state()->chunk_size() ||
            _key_partition_max_rows() > 0 || (_is_finished && _partition_rows_num > 0) || _local_buffer_almost_full();
 }
 
 Status LocalExchangeSourceOperator::set_finished(RuntimeState* state) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
-    _is_finished = true;
-    // clear _full_chunk_queue
-    { [[maybe_unused]] typeof(_full_chunk_queue) tmp = std::move(_full_chunk_queue); }
-    // clear _partition_chunk_queue
-    { [[maybe_unused]] typeof(_partition_chunk_queue) tmp = std::move(_partition_chunk_queue); }
-    // clear _key_partition_pending_chunks
-    { [[maybe_unused]] typeof(_partition_key2partial_chunks) tmp = std::move(_partition_key2partial_chunks); }
-    // Subtract the number of rows of buffered chunks from row_count of _memory_manager and make it unblocked.
-    _memory_manager->update_memory_usage(-_local_memory_usage, -_partition_rows_num);
-    _partition_rows_num = 0;
-    _local_memory_usage = 0;
+    {
+        std::lock_guard<std::mutex> l(_chunk_lock);
+        _is_finished = true;
+        _clear_full_chunk_queue();
+        // clear _partition_chunk_queue
+        { [[maybe_unused]] typeof(_partition_chunk_queue) tmp = std::move(_partition_chunk_queue); }
+        // clear _key_partition_pending_chunks
+        { [[maybe_unused]] typeof(_partition_key2partial_chunks) tmp = std::move(_partition_key2partial_chunks); }
+        // Subtract the number of rows of buffered chunks from row_count of _memory_manager and make it unblocked.
+        _memory_manager->update_memory_usage(-_local_memory_usage, -_partition_rows_num);
+        _partition_rows_num = 0;
+        _local_memory_usage = 0;
+    }
+    _observable.notify_observers();
     return Status::OK();
 }
 
 StatusOr<ChunkPtr> LocalExchangeSourceOperator::pull_chunk(RuntimeState* state) {
     ChunkPtr chunk = _pull_passthrough_chunk(state);
+    if (chunk == nullptr && _num_full_chunks > 0) {
+        // A passthrough chunk is being enqueued, pull it next time.
+        return std::move(chunk);
+    }
     if (chunk == nullptr && _key_partition_pending_chunk_empty()) {
         chunk = _pull_shuffle_chunk(state);
     } else if (chunk == nullptr && !_key_partition_pending_chunk_empty()) {
@@ -132,19 +153,26 @@ void LocalExchangeSourceOperator::set_execute_mode(int performance_level) {
 }
 
 ChunkPtr LocalExchangeSourceOperator::_pull_passthrough_chunk(RuntimeState* state) {
-    std::lock_guard<std::mutex> l(_chunk_lock);
+    ChunkPtr chunk;
+    if (_num_full_chunks == 0 || !_full_chunk_queue.try_dequeue(chunk)) {
+        return nullptr;
+    }
+    size_t memory_usage = chunk->memory_usage();
+    size_t num_rows = chunk->num_rows();
+    _memory_manager->update_memory_usage(-memory_usage, -num_rows);
+    _full_chunk_memory_usage -= memory_usage;
+    _num_full_chunks--;
+    return chunk;
+}
 
-    if (!_full_chunk_queue.empty()) {
-        ChunkPtr chunk = std::move(_full_chunk_queue.front());
-        _full_chunk_queue.pop();
+void LocalExchangeSourceOperator::_clear_full_chunk_queue() {
+    ChunkPtr chunk;
+    while (_full_chunk_queue.try_dequeue(chunk)) {
         size_t memory_usage = chunk->memory_usage();
-        size_t num_rows = chunk->num_rows();
-        _memory_manager->update_memory_usage(-memory_usage, -num_rows);
-        _local_memory_usage -= memory_usage;
-        return chunk;
+        _memory_manager->update_memory_usage(-memory_usage, -chunk->num_rows());
+        _full_chunk_memory_usage -= memory_usage;
+        _num_full_chunks--;
     }
-
-    return nullptr;
 }
 
 ChunkPtr LocalExchangeSourceOperator::_pull_shuffle_chunk(RuntimeState* state) {
@@ -171,6 +199,12 @@ ChunkPtr LocalExchangeSourceOperator::_pull_shuffle_chunk(RuntimeState* state) {
     if (selected_partition_chunks.empty()) {
         throw std::runtime_error("local exchange gets empty shuffled chunk.");
     }
+    // All the rows of the source chunk are shuffled to this partition in their original order, so the source
+    // chunk, which is referenced by no other partition, is handed over without copying any column.
+    if (selected_partition_chunks.size() == 1 &&
+        selected_partition_chunks[0].size == selected_partition_chunks[0].chunk->num_rows()) {
+        return std::move(selected_partition_chunks[0].chunk);
+    }
     // Unlock during merging partition chunks into a full chunk.
     ChunkPtr chunk = selected_partition_chunks[0].chunk->clone_empty_with_slot();
     chunk->reserve(num_rows);
@@ -208,6 +242,9 @@ ChunkPtr LocalExchangeSourceOperator::_pull_key_partition_chunk(RuntimeState* st
         _memory_manager->update_memory_usage(-memory_usage, -num_rows);
     }
 
+    if (selected_partition_chunks.size() == 1) {
+        return std::move(selected_partition_chunks[0]);
+    }
     // Unlock during merging partition chunks into a full chunk.
     ChunkPtr chunk = selected_partition_chunks[0]->clone_empty_with_slot();
     chunk->reserve(num_rows);
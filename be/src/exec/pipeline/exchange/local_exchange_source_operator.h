@@ -14,12 +14,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <queue>
 #include <utility>
 
 #include "exec/chunk_buffer_memory_manager.h"
+#include "exec/pipeline/pipeline_observable.h"
 #include "exec/pipeline/source_operator.h"
+#include "util/moodycamel/concurrentqueue.h"
 
 namespace starrocks::pipeline {
 
@@ -70,20 +73,29 @@ public:
 
     bool is_finished() const override;
 
+    // Notified when chunks are added and when it's finished or epoch finished.
+    PipelineObservable* observable() override { return &_observable; }
+
     Status set_finished(RuntimeState* state) override;
     Status set_finishing(RuntimeState* state) override {
-        std::lock_guard<std::mutex> l(_chunk_lock);
-        _is_finished = true;
+        {
+            std::lock_guard<std::mutex> l(_chunk_lock);
+            _is_finished = true;
+        }
+        _observable.notify_observers();
         return Status::OK();
     }
 
     bool is_epoch_finished() const override {
         std::lock_guard<std::mutex> l(_chunk_lock);
-        return _is_epoch_finished && _full_chunk_queue.empty() && !_partition_rows_num;
+        return _is_epoch_finished && _num_full_chunks == 0 && !_partition_rows_num;
     }
     Status set_epoch_finishing(RuntimeState* state) override {
-        std::lock_guard<std::mutex> l(_chunk_lock);
-        _is_epoch_finished = true;
+        {
+            std::lock_guard<std::mutex> l(_chunk_lock);
+            _is_epoch_finished = true;
+        }
+        _observable.notify_observers();
         return Status::OK();
     }
     Status reset_epoch(RuntimeState* state) override {
@@ -102,6 +114,9 @@ public:
 private:
     ChunkPtr _pull_passthrough_chunk(RuntimeState* state);
 
+    // Dequeue all the passthrough chunks and release their memory, used when the operator is finished.
+    void _clear_full_chunk_queue();
+
     ChunkPtr _pull_shuffle_chunk(RuntimeState* state);
 
     ChunkPtr _pull_key_partition_chunk(RuntimeState* state);
@@ -110,7 +125,9 @@ private:
 
     PartialChunks& _max_row_partition_chunks();
 
-    bool _local_buffer_almost_full() const { return _local_memory_usage >= _local_memory_limit; }
+    bool _local_buffer_almost_full() const {
+        return _local_memory_usage + _full_chunk_memory_usage >= _local_memory_limit;
+    }
 
     bool _key_partition_pending_chunk_empty() const {
         for (const auto& pending_chunks : _partition_key2partial_chunks) {
@@ -121,20 +138,27 @@ private:
         return true;
     }
 
-    bool _is_finished = false;
-    std::queue<ChunkPtr> _full_chunk_queue;
+    std::atomic<bool> _is_finished{false};
+    // The passthrough chunks are added by all the sink drivers, so they go through a lock-free queue
+    // and are accounted by atomics, instead of contending on `_chunk_lock` at a high DOP.
+    moodycamel::ConcurrentQueue<ChunkPtr> _full_chunk_queue;
+    std::atomic<size_t> _num_full_chunks{0};
+    std::atomic<size_t> _full_chunk_memory_usage{0};
     std::queue<PartitionChunk> _partition_chunk_queue;
     size_t _partition_rows_num = 0;
+    // The memory usage of the partition chunks, protected by `_chunk_lock`.
     size_t _local_memory_usage = 0;
     size_t _local_memory_limit = 0;
 
-    // TODO(KKS): make it lock free
+    // Protects the partition chunks.
     mutable std::mutex _chunk_lock;
     const std::shared_ptr<ChunkBufferMemoryManager>& _memory_manager;
     std::unordered_map<std::vector<std::string>, PartialChunks> _partition_key2partial_chunks;
 
     // STREAM MV
     bool _is_epoch_finished = false;
+
+    PipelineObservable _observable;
 };
 
 class LocalExchangeSourceOperatorFactory final : public SourceOperatorFactory {
@@ -54,6 +54,8 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _network_times[instance_id.lo] = TimeTrace{};
             _mutexes[instance_id.lo] = std::make_unique<Mutex>();
             _dest_addrs[instance_id.lo] = dest.brpc_server;
+            _dest_links[instance_id.lo] = ExchangeLinkStats::instance()->get_or_create_link(
+                    dest.brpc_server.hostname, dest.brpc_server.port);
 
             PUniqueId finst_id;
             finst_id.set_hi(instance_id.hi);
@@ -81,6 +83,14 @@ void SinkBuffer::incr_sinker(RuntimeState* state) {
     _num_remaining_eos += _num_sinkers.size();
 }
 
+void SinkBuffer::skip_eos(const TUniqueId& instance_id) {
+    std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
+    --_num_sinkers[instance_id.lo];
+    if (--_num_remaining_eos == 0) {
+        _is_finishing = true;
+    }
+}
+
 Status SinkBuffer::add_request(TransmitChunkInfo& request) {
     DCHECK(_num_remaining_eos > 0);
     if (_is_finishing) {
@@ -105,7 +115,13 @@ Status SinkBuffer::add_request(TransmitChunkInfo& request) {
         }
 
         auto& instance_id = request.fragment_instance_id;
-        RETURN_IF_ERROR(_try_to_send_rpc(instance_id, [&]() { _buffers[instance_id.lo].push(request); }));
+        request.enqueue_timestamp = MonotonicNanos();
+        RETURN_IF_ERROR(_try_to_send_rpc(instance_id, [&]() {
+            auto& buffer = _buffers[instance_id.lo];
+            if (!_try_to_coalesce(buffer, request)) {
+                buffer.push(request);
+            }
+        }));
     }
 
     return Status::OK();
@@ -120,6 +136,7 @@ bool SinkBuffer::is_full() const {
     for (auto& [_, buffer] : _buffers) {
         buffer_size += buffer.size();
     }
+    buffer_size += _num_buffered_coalesced;
     const bool is_full = buffer_size > max_buffer_size;
 
     int64_t last_full_timestamp = _last_full_timestamp;
@@ -173,6 +190,12 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* request_sent_counter = ADD_COUNTER(profile, "RequestSent", TUnit::UNIT);
     COUNTER_SET(bytes_sent_counter, _bytes_sent);
     COUNTER_SET(request_sent_counter, _request_sent);
+    auto* request_coalesced_counter = ADD_COUNTER(profile, "RequestCoalesced", TUnit::UNIT);
+    COUNTER_SET(request_coalesced_counter, _request_coalesced);
+    auto* raw_bytes_sent_counter = ADD_COUNTER(profile, "RawBytesSent", TUnit::BYTES);
+    COUNTER_SET(raw_bytes_sent_counter, _raw_bytes_sent);
+    auto* queue_wait_timer = ADD_TIMER(profile, "RequestQueueTime");
+    COUNTER_SET(queue_wait_timer, _queue_wait_time);
 
     auto* bytes_unsent_counter = ADD_COUNTER(profile, "BytesUnsent", TUnit::BYTES);
     auto* request_unsent_counter = ADD_COUNTER(profile, "RequestUnsent", TUnit::UNIT);
@@ -191,6 +214,23 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
                 return RuntimeProfile::units_per_second(bytes_sent_counter, overall_timer);
             },
             "");
+
+    // The destination with the largest network time is the most likely one to slow down the whole exchange.
+    int64_t slowest_instance = -1;
+    int64_t slowest_network_time = -1;
+    for (auto& [instance, time_trace] : _network_times) {
+        int64_t network_time = time_trace.accumulated_time / std::max(1, time_trace.times);
+        if (network_time > slowest_network_time) {
+            slowest_network_time = network_time;
+            slowest_instance = instance;
+        }
+    }
+    if (slowest_instance != -1 && slowest_network_time > 0) {
+        const auto& dest_addr = _dest_addrs[slowest_instance];
+        profile->add_info_string("SlowestDestination",
+                                 fmt::format("{}:{} (AvgNetworkTime: {}ms)", dest_addr.hostname, dest_addr.port,
+                                             slowest_network_time / 1000000));
+    }
 }
 
 int64_t SinkBuffer::_network_time() {
@@ -273,6 +313,43 @@ void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_
     }
 }
 
+bool SinkBuffer::_try_to_coalesce(std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>>& buffer,
+                                  TransmitChunkInfo& request) {
+    if (config::pipeline_sink_coalesce_bytes <= 0 || buffer.empty()) {
+        return false;
+    }
+    auto& tail = buffer.back();
+    const auto& tail_params = *tail.params;
+    const auto& params = *request.params;
+    // The eos request has to be sent alone, the chunks of pass through requests are not in the attachment,
+    // and the query statistics of both requests can not be kept in one request.
+    if (tail_params.eos() || params.eos() || tail_params.use_pass_through() || params.use_pass_through() ||
+        params.has_query_statistics() || params.chunks_size() == 0) {
+        return false;
+    }
+    if (tail_params.node_id() != params.node_id() || tail_params.sender_id() != params.sender_id() ||
+        tail_params.be_number() != params.be_number() ||
+        tail_params.is_pipeline_level_shuffle() != params.is_pipeline_level_shuffle()) {
+        return false;
+    }
+    auto coalesced_bytes = static_cast<int64_t>(tail.attachment.size() + request.attachment.size());
+    if (coalesced_bytes > config::pipeline_sink_coalesce_bytes) {
+        return false;
+    }
+
+    // The receiver cuts the data of every chunk from the attachment in order.
+    for (int i = 0; i < params.chunks_size(); ++i) {
+        tail.params->add_chunks()->Swap(request.params->mutable_chunks(i));
+    }
+    tail.params->mutable_driver_sequences()->MergeFrom(params.driver_sequences());
+    tail.attachment.append(request.attachment);
+    tail.attachment_physical_bytes += request.attachment_physical_bytes;
+    tail.num_coalesced += 1 + request.num_coalesced;
+    _num_buffered_coalesced += 1 + request.num_coalesced;
+    _request_coalesced++;
+    return true;
+}
+
 Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works) {
     std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
     pre_works();
@@ -304,7 +381,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
 
         TransmitChunkInfo& request = buffer.front();
         bool need_wait = false;
-        DeferOp pop_defer([&need_wait, &buffer, mem_tracker = _mem_tracker]() {
+        DeferOp pop_defer([this, &need_wait, &buffer, mem_tracker = _mem_tracker]() {
             if (need_wait) {
                 return;
             }
@@ -313,6 +390,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             // so use the instance_mem_tracker passed from ExchangeSinkOperator to release memory.
             // This must be invoked before decrease_defer desctructed to avoid sink_buffer and fragment_ctx released.
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            _num_buffered_coalesced -= buffer.front().num_coalesced;
             buffer.pop();
         });
 
@@ -360,13 +438,25 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
         *request.params->mutable_finst_id() = _instance_id2finst_id[instance_id.lo];
         request.params->set_sequence(++_request_seqs[instance_id.lo]);
 
+        int64_t raw_bytes_sent = 0;
+        for (const auto& chunk : request.params->chunks()) {
+            raw_bytes_sent += chunk.uncompressed_size();
+        }
         if (!request.attachment.empty()) {
             _bytes_sent += request.attachment.size();
-            _request_sent++;
+            _request_sent += 1 + request.num_coalesced;
         }
+        _raw_bytes_sent += raw_bytes_sent;
 
+        const int64_t send_timestamp = MonotonicNanos();
+        if (request.enqueue_timestamp != -1) {
+            _queue_wait_time += send_timestamp - request.enqueue_timestamp;
+            ExchangeLinkStats::record_queue_wait(_dest_links[instance_id.lo],
+                                                 send_timestamp - request.enqueue_timestamp);
+        }
         auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
-                {instance_id, request.params->sequence(), MonotonicNanos()});
+                {instance_id, request.params->sequence(), send_timestamp,
+                 static_cast<int64_t>(request.attachment.size()), raw_bytes_sent});
         if (_first_send_time == -1) {
             _first_send_time = MonotonicNanos();
         }
@@ -385,6 +475,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                     fmt::format("transmit chunk rpc failed [dest_instance_id={}] [dest={}:{}] detail:{}",
                                 print_id(ctx.instance_id), dest_addr.hostname, dest_addr.port, rpc_error_msg);
 
+            ExchangeLinkStats::record_failure(_dest_links[ctx.instance_id.lo]);
             _fragment_ctx->cancel(Status::ThriftRpcError(err_msg));
             LOG(WARNING) << err_msg;
         });
@@ -402,10 +493,13 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
                 _fragment_ctx->cancel(status);
 
                 const auto& dest_addr = _dest_addrs[ctx.instance_id.lo];
+                ExchangeLinkStats::record_failure(_dest_links[ctx.instance_id.lo]);
                 LOG(WARNING) << fmt::format("transmit chunk rpc failed [dest_instance_id={}] [dest={}:{}] [msg={}]",
                                             print_id(ctx.instance_id), dest_addr.hostname, dest_addr.port,
                                             status.message());
             } else {
+                ExchangeLinkStats::record_rpc(_dest_links[ctx.instance_id.lo], MonotonicNanos() - ctx.send_timestamp,
+                                              ctx.bytes_sent, ctx.raw_bytes_sent);
                 static_cast<void>(_try_to_send_rpc(ctx.instance_id, [&]() {
                     _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receiver_post_process_time());
                     _process_send_window(ctx.instance_id, ctx.sequence);
@@ -25,6 +25,7 @@
 
 #include "column/chunk.h"
 #include "common/compiler_util.h"
+#include "exec/pipeline/exchange/exchange_link_stats.h"
 #include "exec/pipeline/fragment_context.h"
 #include "gen_cpp/BackendService.h"
 #include "runtime/current_thread.h"
@@ -43,6 +44,8 @@ struct ClosureContext {
     TUniqueId instance_id;
     int64_t sequence;
     int64_t send_timestamp;
+    int64_t bytes_sent = 0;
+    int64_t raw_bytes_sent = 0;
 };
 
 struct TransmitChunkInfo {
@@ -55,6 +58,10 @@ struct TransmitChunkInfo {
     butil::IOBuf attachment;
     int64_t attachment_physical_bytes;
     const TNetworkAddress brpc_addr;
+    // The number of the requests merged into this one while it's waiting in the buffer.
+    int32_t num_coalesced = 0;
+    // Time in nano when the request enters the buffer.
+    int64_t enqueue_timestamp = -1;
 };
 
 // TimeTrace is introduced to estimate time more accurately.
@@ -99,6 +106,10 @@ public:
 
     void incr_sinker(RuntimeState* state);
 
+    // Count the EOS of one sinker to `instance_id` without sending it, the receiver is finished by the EOS
+    // sent to another instance on the same BE, see ExchangeSinkOperator::_init_broadcast_fanout.
+    void skip_eos(const TUniqueId& instance_id);
+
 private:
     using Mutex = bthread::Mutex;
 
@@ -110,6 +121,12 @@ private:
     // _discontinuous_acked_seqs[x] stored the received discontinuous acks
     void _process_send_window(const TUniqueId& instance_id, const int64_t sequence);
 
+    // Merge the chunks of `request` into the last request waiting in `buffer` if they are compatible and the merged
+    // attachment does not exceed `pipeline_sink_coalesce_bytes`. Requests only wait in the buffer when the rpc window
+    // of the destination is full, so the slower the destination is, the fewer and larger rpcs are sent to it.
+    bool _try_to_coalesce(std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>>& buffer,
+                          TransmitChunkInfo& request);
+
     // Try to send rpc if buffer is not empty and channel is not busy
     // And we need to put this function and other extra works(pre_works) together as an atomic operation
     Status _try_to_send_rpc(const TUniqueId& instance_id, const std::function<void()>& pre_works);
@@ -158,6 +175,7 @@ private:
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
     phmap::flat_hash_map<int64_t, TNetworkAddress> _dest_addrs;
+    phmap::flat_hash_map<int64_t, ExchangeLinkStats::Link*> _dest_links;
 
     // True means that SinkBuffer needn't input chunk and send chunk anymore,
     // but there may be still in-flight RPC running.
@@ -180,6 +198,12 @@ private:
     std::atomic<int64_t> _request_enqueued = 0;
     std::atomic<int64_t> _bytes_sent = 0;
     std::atomic<int64_t> _request_sent = 0;
+    std::atomic<int64_t> _request_coalesced = 0;
+    std::atomic<int64_t> _raw_bytes_sent = 0;
+    std::atomic<int64_t> _queue_wait_time = 0;
+    // The number of the coalesced requests still in the buffers, they are counted by `is_full` as
+    // if they were not merged, so coalescing does not buffer more data.
+    std::atomic<int64_t> _num_buffered_coalesced = 0;
 
     int64_t _pending_timestamp = -1;
     mutable std::atomic<int64_t> _last_full_timestamp = -1;
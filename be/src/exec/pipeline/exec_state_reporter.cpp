@@ -17,7 +17,9 @@
 #include <thrift/Thrift.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <chrono>
 #include <memory>
+#include <thread>
 
 #include "agent/master_info.h"
 #include "runtime/client_cache.h"
@@ -199,6 +201,43 @@ Status ExecStateReporter::report_exec_status(const TReportExecStatusParams& para
     return rpc_status;
 }
 
+Status ExecStateReporter::batch_report_exec_status(const TBatchReportExecStatusParams& params, ExecEnv* exec_env,
+                                                   const TNetworkAddress& fe_addr, TBatchReportExecStatusResult* res) {
+    Status fe_status;
+    FrontendServiceConnection coord(exec_env->frontend_client_cache(), fe_addr, config::thrift_rpc_timeout_ms,
+                                    &fe_status);
+    if (!fe_status.ok()) {
+        LOG(WARNING) << "Couldn't get a client for " << fe_addr;
+        return fe_status;
+    }
+
+    try {
+        try {
+            coord->batchReportExecStatus(*res, params);
+        } catch (TTransportException& e) {
+            TTransportException::TTransportExceptionType type = e.getType();
+            if (type != TTransportException::TTransportExceptionType::TIMED_OUT) {
+                // if not TIMED_OUT, retry
+                RETURN_IF_ERROR(coord.reopen(config::thrift_rpc_timeout_ms));
+                coord->batchReportExecStatus(*res, params);
+            } else {
+                (void)coord.reopen(config::thrift_rpc_timeout_ms);
+                std::stringstream msg;
+                msg << "batchReportExecStatus() to " << fe_addr << " failed:\n" << e.what();
+                LOG(WARNING) << msg.str();
+                return Status::InternalError(msg.str());
+            }
+        }
+    } catch (TException& e) {
+        (void)coord.reopen(config::thrift_rpc_timeout_ms);
+        std::stringstream msg;
+        msg << "batchReportExecStatus() to " << fe_addr << " failed:\n" << e.what();
+        LOG(WARNING) << msg.str();
+        return Status::InternalError(msg.str());
+    }
+    return Status::OK();
+}
+
 TMVMaintenanceTasks ExecStateReporter::create_report_epoch_params(const QueryContext* query_ctx,
                                                                   const std::vector<FragmentContext*>& fragment_ctxs) {
     TMVMaintenanceTasks params;
@@ -343,6 +382,67 @@ void ExecStateReporter::submit(std::function<void()>&& report_task, bool priorit
     }
 }
 
+void ExecStateReporter::submit_batched(ExecEnv* exec_env, const TNetworkAddress& fe_addr,
+                                       std::shared_ptr<TReportExecStatusParams> params) {
+    std::string fe_key = get_host_port(fe_addr.hostname, fe_addr.port);
+    std::lock_guard<std::mutex> l(_pending_lock);
+    auto [iter, inserted] = _pending_reports.try_emplace(fe_key);
+    // a newer report of the same fragment instance replaces the pending one
+    iter->second.reports[UniqueId(params->fragment_instance_id)] = std::move(params);
+    if (inserted) {
+        iter->second.fe_addr = fe_addr;
+        auto st = _thread_pool->submit_func([this, exec_env, fe_key]() { _report_batch(exec_env, fe_key); });
+        if (!st.ok()) {
+            LOG(WARNING) << "[Driver] Fail to submit exec state report batch to " << fe_addr << ", " << st.to_string();
+            _pending_reports.erase(iter);
+        }
+    }
+}
+
+void ExecStateReporter::_report_batch(ExecEnv* exec_env, const std::string& fe_key) {
+    int32_t window_ms = config::exec_state_report_batch_window_ms;
+    if (window_ms > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(window_ms));
+    }
+
+    PendingReports pending;
+    {
+        std::lock_guard<std::mutex> l(_pending_lock);
+        auto iter = _pending_reports.find(fe_key);
+        DCHECK(iter != _pending_reports.end());
+        pending = std::move(iter->second);
+        _pending_reports.erase(iter);
+    }
+
+    TBatchReportExecStatusParams batch;
+    batch.params_list.reserve(pending.reports.size());
+    for (auto& [fragment_id, params] : pending.reports) {
+        batch.params_list.emplace_back(std::move(*params));
+    }
+    pending.reports.clear();
+
+    TBatchReportExecStatusResult res;
+    auto status = batch_report_exec_status(batch, exec_env, pending.fe_addr, &res);
+    if (!status.ok()) {
+        LOG(WARNING) << "[Driver] Fail to report exec state of " << batch.params_list.size()
+                     << " fragment instances to " << pending.fe_addr << ", status: " << status.to_string();
+        return;
+    }
+    for (size_t i = 0; i < res.status_list.size() && i < batch.params_list.size(); i++) {
+        Status fragment_status(res.status_list[i]);
+        if (fragment_status.is_not_found()) {
+            LOG(INFO) << "[Driver] Fail to report exec state due to query not found: fragment_instance_id="
+                      << print_id(batch.params_list[i].fragment_instance_id);
+        } else if (!fragment_status.ok()) {
+            LOG(WARNING) << "[Driver] Fail to report exec state: fragment_instance_id="
+                         << print_id(batch.params_list[i].fragment_instance_id)
+                         << ", status: " << fragment_status.to_string();
+        }
+    }
+    VLOG(1) << "[Driver] Succeed to report exec state of " << batch.params_list.size() << " fragment instances to "
+            << pending.fe_addr;
+}
+
 void ExecStateReporter::bind_cpus(const CpuUtil::CpuIds& cpuids) const {
     _thread_pool->bind_cpus(cpuids, {});
     _priority_thread_pool->bind_cpus(cpuids, {});
@@ -14,7 +14,11 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_fwd.h"
@@ -25,6 +29,7 @@
 #include "runtime/runtime_state.h"
 #include "service/backend_options.h"
 #include "util/threadpool.h"
+#include "util/uid_util.h"
 
 namespace starrocks::pipeline {
 class ExecStateReporter {
@@ -38,8 +43,16 @@ public:
     static Status report_exec_status(const TReportExecStatusParams& params, ExecEnv* exec_env,
                                      const TNetworkAddress& fe_addr);
 
+    static Status batch_report_exec_status(const TBatchReportExecStatusParams& params, ExecEnv* exec_env,
+                                           const TNetworkAddress& fe_addr, TBatchReportExecStatusResult* res);
+
     void submit(std::function<void()>&& report_task, bool priority = false);
 
+    // Submits a periodic report, which is batched with the other periodic reports to the same FE,
+    // see config::exec_state_report_batch_window_ms.
+    void submit_batched(ExecEnv* exec_env, const TNetworkAddress& fe_addr,
+                        std::shared_ptr<TReportExecStatusParams> params);
+
     void bind_cpus(const CpuUtil::CpuIds& cpuids) const;
 
     // STREAM MV
@@ -49,6 +62,19 @@ public:
     static Status report_epoch(const TMVMaintenanceTasks& params, ExecEnv* exec_env, const TNetworkAddress& fe_addr);
 
 private:
+    // The periodic reports to be sent to a FE, keyed by the fragment instance id.
+    struct PendingReports {
+        TNetworkAddress fe_addr;
+        std::map<UniqueId, std::shared_ptr<TReportExecStatusParams>> reports;
+    };
+
+    void _report_batch(ExecEnv* exec_env, const std::string& fe_key);
+
+    // declared before the thread pools, which run the tasks accessing them, so destroyed after the pools
+    std::mutex _pending_lock;
+    // keyed by the FE address, a FE is in it iff a task to send its batch has been submitted
+    std::unordered_map<std::string, PendingReports> _pending_reports;
+
     std::unique_ptr<ThreadPool> _thread_pool;
     std::unique_ptr<ThreadPool> _priority_thread_pool;
 };
@@ -26,6 +26,7 @@
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/pipeline/scan/morsel.h"
 #include "exec/query_cache/cache_param.h"
+#include "exec/query_cache/result_cache.h"
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/HeartbeatService.h"
 #include "gen_cpp/InternalService_types.h"
@@ -125,6 +126,11 @@ public:
 
     bool enable_cache() const { return _enable_cache; }
 
+    void set_result_cache_populator(query_cache::ResultCachePopulatorPtr populator) {
+        _result_cache_populator = std::move(populator);
+    }
+    const query_cache::ResultCachePopulatorPtr& result_cache_populator() const { return _result_cache_populator; }
+
     void set_stream_load_contexts(const std::vector<StreamLoadContext*>& contexts);
 
     void set_enable_adaptive_dop(bool val) { _enable_adaptive_dop = val; }
@@ -208,6 +214,7 @@ private:
 
     query_cache::CacheParam _cache_param;
     bool _enable_cache = false;
+    query_cache::ResultCachePopulatorPtr _result_cache_populator;
     std::vector<StreamLoadContext*> _stream_load_contexts;
     bool _channel_stream_load = false;
 
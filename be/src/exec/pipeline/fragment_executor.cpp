@@ -34,6 +34,8 @@
 #include "exec/pipeline/scan/morsel.h"
 #include "exec/pipeline/scan/scan_operator.h"
 #include "exec/pipeline/stream_pipeline_driver.h"
+#include "exec/query_cache/result_cache.h"
+#include "exec/query_cache/result_cache_source_operator.h"
 #include "exec/scan_node.h"
 #include "exec/tablet_sink.h"
 #include "exec/workgroup/work_group.h"
@@ -115,6 +117,9 @@ Status FragmentExecutor::_prepare_query_ctx(ExecEnv* exec_env, const UnifiedExec
 
     _query_ctx->set_delivery_expire_seconds(_calc_delivery_expired_seconds(request));
     _query_ctx->set_query_expire_seconds(_calc_query_expired_seconds(request));
+    if (query_options.__isset.query_latency_target_ms) {
+        _query_ctx->init_latency_target(query_options.query_latency_target_ms * 1000'000L);
+    }
     // initialize query's deadline
     _query_ctx->extend_delivery_lifetime();
     _query_ctx->extend_query_lifetime();
@@ -141,6 +146,7 @@ Status FragmentExecutor::_prepare_query_ctx(ExecEnv* exec_env, const UnifiedExec
         enable_query_trace = true;
     }
     _query_ctx->set_query_trace(std::make_shared<starrocks::debug::QueryTrace>(query_id, enable_query_trace));
+    _query_ctx->set_enable_driver_timeline(enable_query_trace);
 
     if (request.common().__isset.exec_stats_node_ids) {
         _query_ctx->init_node_exec_stats(request.common().exec_stats_node_ids);
@@ -292,6 +298,8 @@ Status FragmentExecutor::_prepare_runtime_state(ExecEnv* exec_env, const Unified
     runtime_state->set_desc_tbl(desc_tbl);
     if (query_options.__isset.enable_spill && query_options.enable_spill) {
         RETURN_IF_ERROR(_query_ctx->init_spill_manager(query_options));
+        // the queries of the workgroups with less cpu weight are asked to spill first under memory pressure
+        _query_ctx->spill_manager()->set_spill_priority(wg != nullptr ? wg->cpu_weight() : 0);
     }
     _fragment_ctx->init_jit_profile();
     return Status::OK();
@@ -441,6 +449,9 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
         }
         cache_param.can_use_multiversion = tcache_param.can_use_multiversion;
         cache_param.keys_type = tcache_param.keys_type;
+        cache_param.is_lake = std::any_of(scan_nodes.begin(), scan_nodes.end(), [](const ExecNode* node) {
+            return node->type() == TPlanNodeType::LAKE_SCAN_NODE;
+        });
         if (tcache_param.__isset.cached_plan_node_ids) {
             cache_param.cached_plan_node_ids.insert(tcache_param.cached_plan_node_ids.begin(),
                                                     tcache_param.cached_plan_node_ids.end());
@@ -451,19 +462,31 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
     for (auto& i : scan_nodes) {
         auto* scan_node = down_cast<ScanNode*>(i);
         const std::vector<TScanRangeParams>& scan_ranges = request.scan_ranges_of_node(scan_node->id());
-        const auto& scan_ranges_per_driver_seq = request.per_driver_seq_scan_ranges_of_node(scan_node->id());
+        const auto* scan_ranges_per_driver_seq = &request.per_driver_seq_scan_ranges_of_node(scan_node->id());
+
+        // The FE assigns the buckets of a colocate scan to the drivers by their number only, rebalance them by their
+        // row counts if the whole fragment is fed by this scan, so moving a bucket to another driver is harmless.
+        PerDriverScanRangesMap balanced_scan_ranges_per_driver_seq;
+        if (config::enable_colocate_bucket_rebalance && scan_nodes.size() == 1 && exch_nodes.empty() &&
+            !scan_ranges_per_driver_seq->empty() && !_is_in_colocate_exec_group(scan_node->id()) &&
+            !scan_node->output_chunk_by_bucket() && !_fragment_ctx->enable_cache()) {
+            balanced_scan_ranges_per_driver_seq = *scan_ranges_per_driver_seq;
+            if (ScanNode::balance_colocate_buckets(&balanced_scan_ranges_per_driver_seq)) {
+                scan_ranges_per_driver_seq = &balanced_scan_ranges_per_driver_seq;
+            }
+        }
 
         // num_lanes ranges in [1,16] in default 4.
         _fragment_ctx->cache_param().num_lanes = std::min(16, std::max(1, config::query_cache_num_lanes_per_driver));
 
-        if (scan_ranges_per_driver_seq.empty()) {
+        if (scan_ranges_per_driver_seq->empty()) {
             _fragment_ctx->set_enable_cache(false);
         }
 
         bool should_compute_cache_key_prefix = _fragment_ctx->enable_cache() &&
                                                _fragment_ctx->cache_param().cached_plan_node_ids.count(scan_node->id());
         if (should_compute_cache_key_prefix) {
-            for (auto& [driver_seq, scan_ranges] : scan_ranges_per_driver_seq) {
+            for (auto& [driver_seq, scan_ranges] : *scan_ranges_per_driver_seq) {
                 for (auto& scan_range : scan_ranges) {
                     if (!scan_range.scan_range.__isset.internal_scan_range) {
                         continue;
@@ -496,7 +519,7 @@ Status FragmentExecutor::_prepare_exec_plan(ExecEnv* exec_env, const UnifiedExec
 
         ASSIGN_OR_RETURN(auto morsel_queue_factory,
                          scan_node->convert_scan_range_to_morsel_queue_factory(
-                                 scan_ranges, scan_ranges_per_driver_seq, scan_node->id(), group_execution_scan_dop,
+                                 scan_ranges, *scan_ranges_per_driver_seq, scan_node->id(), group_execution_scan_dop,
                                  _is_in_colocate_exec_group(scan_node->id()), enable_tablet_internal_parallel,
                                  tablet_internal_parallel_mode, enable_shared_scan));
         scan_node->enable_shared_scan(enable_shared_scan && morsel_queue_factory->is_shared());
@@ -625,6 +648,26 @@ static void create_adaptive_group_initialize_events(RuntimeState* state, WorkGro
     }
 }
 
+Status FragmentExecutor::_prepare_result_cache(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request) {
+    if (!config::enable_fragment_result_cache || request.is_stream_pipeline() || exec_env->cache_mgr() == nullptr) {
+        return Status::OK();
+    }
+    auto key = query_cache::ResultCache::cache_key(request.common(), request.unique());
+    if (key.empty()) {
+        return Status::OK();
+    }
+    auto status_or_value = exec_env->cache_mgr()->probe(key);
+    if (status_or_value.ok()) {
+        _hit_result_cache = true;
+        _cached_result = std::move(status_or_value.value().result);
+        VLOG_QUERY << "fragment " << print_id(request.fragment_instance_id()) << " hits result cache";
+        return Status::OK();
+    }
+    _fragment_ctx->set_result_cache_populator(std::make_shared<query_cache::ResultCachePopulator>(
+            std::move(key), config::fragment_result_cache_entry_max_bytes));
+    return Status::OK();
+}
+
 Status FragmentExecutor::_prepare_pipeline_driver(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request) {
     const auto degree_of_parallelism = _calc_dop(exec_env, request);
     const auto& fragment = request.common().fragment;
@@ -641,7 +684,13 @@ Status FragmentExecutor::_prepare_pipeline_driver(ExecEnv* exec_env, const Unifi
     PipelineBuilderContext context(_fragment_ctx.get(), degree_of_parallelism, sink_dop, is_stream_pipeline);
     context.init_colocate_groups(std::move(_colocate_exec_groups));
     PipelineBuilder builder(context);
-    auto exec_ops = builder.decompose_exec_node_to_pipeline(*_fragment_ctx, plan);
+    OpFactories exec_ops;
+    if (_hit_result_cache) {
+        exec_ops.emplace_back(std::make_shared<query_cache::ResultCacheSourceOperatorFactory>(
+                context.next_operator_id(), plan->id(), std::move(_cached_result)));
+    } else {
+        exec_ops = builder.decompose_exec_node_to_pipeline(*_fragment_ctx, plan);
+    }
     // Set up sink if required
     std::unique_ptr<DataSink> datasink;
     if (request.isset_output_sink()) {
@@ -799,6 +848,7 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
 
         RETURN_IF_ERROR(_prepare_global_dict(request));
         RETURN_IF_ERROR(_prepare_exec_plan(exec_env, request));
+        RETURN_IF_ERROR(_prepare_result_cache(exec_env, request));
     }
     {
         SCOPED_RAW_TIMER(&profiler.prepare_pipeline_driver_time);
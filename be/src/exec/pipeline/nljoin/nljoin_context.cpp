@@ -18,6 +18,7 @@
 #include <memory>
 #include <numeric>
 
+#include "common/config.h"
 #include "exec/cross_join_node.h"
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/spill/executor.h"
@@ -138,6 +139,7 @@ std::unique_ptr<SpillableNLJoinChunkStream> NLJoinBuildChunkStreamBuilder::build
 
 void NLJoinContext::close(RuntimeState* state) {
     _build_chunks.clear();
+    _range_index.reset();
     _build_stream_builder.close();
 }
 
@@ -175,6 +177,13 @@ Status NLJoinContext::_init_runtime_filter(RuntimeState* state) {
                                                                          _rf_conjuncts_ctx));
         _rf_hub->set_collector(_plan_node_id,
                                std::make_unique<RuntimeFilterCollector>(std::move(rfs), RuntimeBloomFilterList{}));
+    } else if (num_rows > 1 && _can_build_range_runtime_filter()) {
+        // build the range runtime filters from the min/max of the build side
+        auto* pool = state->obj_pool();
+        ASSIGN_OR_RETURN(auto rfs, CrossJoinNode::rewrite_range_runtime_filter(pool, _rf_descs, _build_chunks,
+                                                                               _rf_conjuncts_ctx));
+        _rf_hub->set_collector(_plan_node_id,
+                               std::make_unique<RuntimeFilterCollector>(std::move(rfs), RuntimeBloomFilterList{}));
     } else {
         // notify cross join left child
         _rf_hub->set_collector(_plan_node_id, std::make_unique<RuntimeFilterCollector>(RuntimeInFilterList{},
@@ -183,6 +192,16 @@ Status NLJoinContext::_init_runtime_filter(RuntimeState* state) {
     return Status::OK();
 }
 
+bool NLJoinContext::_can_build_range_runtime_filter() const {
+    if (!config::enable_nljoin_range_runtime_filter || _rf_descs.empty()) {
+        return false;
+    }
+    // The unmatched probe rows are output by the outer and anti joins, and they may turn the unmatched build rows
+    // of a right outer join into the matched ones.
+    return _join_op == TJoinOp::INNER_JOIN || _join_op == TJoinOp::CROSS_JOIN ||
+           _join_op == TJoinOp::LEFT_SEMI_JOIN || _join_op == TJoinOp::RIGHT_SEMI_JOIN;
+}
+
 void NLJoinContext::_notify_runtime_filter_collector(RuntimeState* state) {
     _rf_hub->set_collector(_plan_node_id,
                            std::make_unique<RuntimeFilterCollector>(RuntimeInFilterList{}, RuntimeBloomFilterList{}));
@@ -237,6 +256,17 @@ Status NLJoinContext::finish_one_right_sinker(int32_t sinker_id, RuntimeState* s
 
         if (!_build_stream_builder.has_spilled()) {
             _build_chunks = _build_stream_builder.build();
+            if (_range_key.valid()) {
+                auto range_index = NLJoinRangeIndex::build(_range_key, &_build_chunks, _build_chunk_desired_size);
+                if (range_index.ok()) {
+                    _range_index = std::move(range_index).value();
+                    // The build chunks have been rewritten in the sorted order, release the unsorted ones.
+                    _build_stream_builder.close();
+                } else {
+                    LOG(WARNING) << "failed to build the range index of nestloop join " << _plan_node_id
+                                 << ", probe it by the cross product: " << range_index.status();
+                }
+            }
             RETURN_IF_ERROR(_init_runtime_filter(state));
         } else {
             _notify_runtime_filter_collector(state);
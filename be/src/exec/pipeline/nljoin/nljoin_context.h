@@ -23,12 +23,14 @@
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
 #include "exec/pipeline/spill_process_channel.h"
 #include "exec/spill/executor.h"
 #include "exec/spill/serde.h"
 #include "exec/spill/spill_components.h"
 #include "exec/spill/spiller.h"
 #include "exprs/expr_context.h"
+#include "gen_cpp/PlanNodes_types.h"
 #include "runtime/chunk_cursor.h"
 #include "runtime/runtime_state.h"
 #include "storage/chunk_helper.h"
@@ -43,10 +45,13 @@ class RuntimeFilterHub;
 
 struct NLJoinContextParams {
     int32_t plan_node_id;
+    TJoinOp::type join_op;
     std::vector<ExprContext*> filters;
     RuntimeFilterHub* rf_hub;
     std::vector<RuntimeFilterBuildDescriptor*> rf_descs;
     SpillProcessChannelFactoryPtr spill_process_factory_ptr;
+    // Valid if the build rows are indexed by the range predicates of an inner join.
+    NLJoinRangeKey range_key;
 };
 
 // Each nest loop join build corresponds to a build channel.
@@ -146,10 +151,12 @@ class NLJoinContext final : public ContextWithDependency {
 public:
     explicit NLJoinContext(NLJoinContextParams params)
             : _plan_node_id(params.plan_node_id),
+              _join_op(params.join_op),
               _rf_conjuncts_ctx(std::move(params.filters)),
               _rf_hub(params.rf_hub),
               _rf_descs(std::move(params.rf_descs)),
-              _spill_process_factory_ptr(std::move(params.spill_process_factory_ptr)) {}
+              _spill_process_factory_ptr(std::move(params.spill_process_factory_ptr)),
+              _range_key(params.range_key) {}
     ~NLJoinContext() override = default;
 
     void close(RuntimeState* state) override;
@@ -181,17 +188,23 @@ public:
 
     const Filter get_shared_build_match_flag() const;
 
+    // Not null if the build chunks are sorted and indexed by the range key, only available once the right is finished.
+    const NLJoinRangeIndex* range_index() const { return _range_index.get(); }
+
     const SpillProcessChannelFactoryPtr& spill_channel_factory() { return _spill_process_factory_ptr; }
     NLJoinBuildChunkStreamBuilder& builder() { return _build_stream_builder; }
 
 private:
     Status _init_runtime_filter(RuntimeState* state);
+    // Whether the probe rows beyond the min/max of the build side can be filtered out before the join.
+    bool _can_build_range_runtime_filter() const;
     // publish 'always true' filter to notify left child
     void _notify_runtime_filter_collector(RuntimeState* state);
 
     int32_t _num_left_probers = 0;
     int32_t _num_right_sinkers = 0;
     const int32_t _plan_node_id;
+    const TJoinOp::type _join_op;
 
     std::atomic<int32_t> _num_finished_right_sinkers = 0;
     std::atomic<int32_t> _num_finished_left_probers = 0;
@@ -213,6 +226,9 @@ private:
     RuntimeFilterHub* _rf_hub;
     std::vector<RuntimeFilterBuildDescriptor*> _rf_descs;
     SpillProcessChannelFactoryPtr _spill_process_factory_ptr;
+
+    NLJoinRangeKey _range_key;
+    std::unique_ptr<NLJoinRangeIndex> _range_index;
 };
 
 } // namespace starrocks::pipeline
@@ -434,6 +434,52 @@ ChunkPtr NLJoinProbeOperator::_permute_chunk_for_inner_join(size_t chunk_size) {
     return result_chunk;
 }
 
+// Permute each probe row with its candidates of the range index instead of all the build rows
+ChunkPtr NLJoinProbeOperator::_permute_chunk_for_range_join(size_t chunk_size) {
+    const NLJoinRangeIndex* range_index = _cross_join_context->range_index();
+    const ColumnPtr& probe_key = _probe_chunk->get_column_by_slot_id(range_index->probe_slot());
+    ChunkPtr chunk = _init_output_chunk(chunk_size);
+    while (_probe_row_current < _probe_chunk->num_rows() && chunk->num_rows() < chunk_size) {
+        if (!_range_candidates_found) {
+            range_index->candidates(*probe_key, _probe_row_current, &_range_build_current, &_range_build_end);
+            _range_candidates_found = true;
+        }
+        size_t count = std::min(_range_build_end - _range_build_current, chunk_size - chunk->num_rows());
+        if (count > 0) {
+            _permute_range_candidates(chunk, count);
+            _range_build_current += count;
+        }
+        if (_range_build_current >= _range_build_end) {
+            _probe_row_current++;
+            _range_candidates_found = false;
+        }
+    }
+    return chunk;
+}
+
+void NLJoinProbeOperator::_permute_range_candidates(const ChunkPtr& chunk, size_t count) {
+    COUNTER_UPDATE(_permute_rows_counter, count);
+    for (size_t i = 0; i < _probe_column_count; i++) {
+        SlotId slot_id = _col_types[i]->id();
+        ColumnPtr& dst_col = chunk->get_column_by_slot_id(slot_id);
+        const ColumnPtr& src_col = _probe_chunk->get_column_by_slot_id(slot_id);
+        dst_col->append_value_multiple_times(*src_col, _probe_row_current, count);
+    }
+    // The sorted build chunks are full except the last one, so a candidate may span several chunks.
+    size_t build_chunk_size = _cross_join_context->range_index()->chunk_size();
+    for (size_t pos = _range_build_current, end = _range_build_current + count; pos < end;) {
+        Chunk* build_chunk = _cross_join_context->get_build_chunk(pos / build_chunk_size);
+        size_t offset = pos % build_chunk_size;
+        size_t rows = std::min(end - pos, build_chunk_size - offset);
+        for (size_t i = _probe_column_count; i < _col_types.size(); i++) {
+            SlotId slot_id = _col_types[i]->id();
+            ColumnPtr& dst_col = chunk->get_column_by_slot_id(slot_id);
+            dst_col->append(*build_chunk->get_column_by_slot_id(slot_id), offset, rows);
+        }
+        pos += rows;
+    }
+}
+
 void NLJoinProbeOperator::_permute_chunk_base_left(ChunkPtr* chunk) {
     for (size_t i = 0; i < _probe_column_count; i++) {
         SlotId slot_id = _col_types[i]->id();
@@ -603,6 +649,9 @@ StatusOr<ChunkPtr> NLJoinProbeOperator::pull_chunk(RuntimeState* state) {
     size_t chunk_size = state->chunk_size();
 
     if (_join_op == TJoinOp::INNER_JOIN) {
+        if (_cross_join_context->range_index() != nullptr) {
+            return _pull_chunk_for_range_join(chunk_size);
+        }
         return _pull_chunk_for_inner_join(chunk_size);
     } else {
         return _pull_chunk_for_other_join(chunk_size);
@@ -679,6 +728,34 @@ StatusOr<ChunkPtr> NLJoinProbeOperator::_pull_chunk_for_inner_join(size_t chunk_
     return _output_accumulator.pull();
 }
 
+StatusOr<ChunkPtr> NLJoinProbeOperator::_pull_chunk_for_range_join(size_t chunk_size) {
+    if (_join_stage == Finished) {
+        return nullptr;
+    }
+    if (ChunkPtr chunk = _output_accumulator.pull()) {
+        return chunk;
+    }
+
+    while (!_is_curr_probe_chunk_finished()) {
+        ChunkPtr chunk = _permute_chunk_for_range_join(chunk_size);
+        RETURN_IF_ERROR(_probe_for_inner_join(chunk));
+        RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
+
+        RETURN_IF_ERROR(_output_accumulator.push(std::move(chunk)));
+        if (ChunkPtr res = _output_accumulator.pull()) {
+            return res;
+        }
+
+        if (_output_accumulator.reach_limit()) {
+            _output_accumulator.finalize();
+            return _output_accumulator.pull();
+        }
+    }
+    _output_accumulator.finalize();
+
+    return _output_accumulator.pull();
+}
+
 void NLJoinProbeOperator::_init_build_match() const {
     if (_is_right_join() && _self_build_match_flag.size() < _cross_join_context->num_build_rows()) {
         VLOG(3) << "init build_match_flags " << _cross_join_context->num_build_rows();
@@ -692,6 +769,7 @@ Status NLJoinProbeOperator::push_chunk(RuntimeState* state, const ChunkPtr& chun
     _probe_row_current = 0;
     _probe_row_matched = false;
     _probe_row_finished = false;
+    _range_candidates_found = false;
     _reset_build_chunk_index();
 
     return Status::OK();
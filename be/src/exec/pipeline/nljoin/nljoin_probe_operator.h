@@ -71,6 +71,7 @@ private:
 
     StatusOr<ChunkPtr> _pull_chunk_for_inner_join(size_t chunk_size);
     StatusOr<ChunkPtr> _pull_chunk_for_other_join(size_t chunk_size);
+    StatusOr<ChunkPtr> _pull_chunk_for_range_join(size_t chunk_size);
 
     bool _is_build_side_empty() const;
     int _num_build_chunks() const;
@@ -90,6 +91,8 @@ private:
     void _permute_probe_row(const ChunkPtr& chunk);
     ChunkPtr _permute_chunk_for_other_join(size_t chunk_size);
     ChunkPtr _permute_chunk_for_inner_join(size_t chunk_size);
+    ChunkPtr _permute_chunk_for_range_join(size_t chunk_size);
+    void _permute_range_candidates(const ChunkPtr& chunk, size_t count);
     void _permute_chunk_base_left(ChunkPtr* chunk);
     void _permute_chunk_base_right(ChunkPtr* chunk);
     Status _permute_right_join(size_t chunk_size);
@@ -133,6 +136,12 @@ private:
     size_t _probe_row_start = 0;      // Start index of current chunk
     size_t _probe_row_current = 0;    // End index of current chunk
 
+    // Range join states, the candidates of the current probe row are the sorted build rows
+    // [_range_build_current, _range_build_end)
+    bool _range_candidates_found = false;
+    size_t _range_build_current = 0;
+    size_t _range_build_end = 0;
+
     // Counters
     RuntimeProfile::Counter* _permute_rows_counter = nullptr;
     RuntimeProfile::Counter* _permute_left_rows_counter = nullptr;
@@ -0,0 +1,269 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "gutil/casts.h"
+#include "runtime/descriptors.h"
+
+namespace starrocks::pipeline {
+
+namespace {
+
+using SlotMap = std::unordered_map<SlotId, const SlotDescriptor*>;
+
+SlotMap collect_slots(const RowDescriptor& row_desc) {
+    SlotMap slots;
+    for (const auto* tuple_desc : row_desc.tuple_descriptors()) {
+        for (const auto* slot : tuple_desc->slots()) {
+            slots.emplace(slot->id(), slot);
+        }
+    }
+    return slots;
+}
+
+const SlotDescriptor* find_slot(const Expr* expr, const SlotMap& slots) {
+    const auto* column_ref = dynamic_cast<const ColumnRef*>(expr);
+    if (column_ref == nullptr) {
+        return nullptr;
+    }
+    auto iter = slots.find(column_ref->slot_id());
+    return iter == slots.end() ? nullptr : iter->second;
+}
+
+void collect_comparisons(Expr* expr, std::vector<Expr*>* comparisons) {
+    if (expr->node_type() == TExprNodeType::COMPOUND_PRED && expr->op() == TExprOpcode::COMPOUND_AND) {
+        for (Expr* child : expr->children()) {
+            collect_comparisons(child, comparisons);
+        }
+    } else if (expr->node_type() == TExprNodeType::BINARY_PRED && expr->get_num_children() == 2 &&
+               (expr->op() == TExprOpcode::LT || expr->op() == TExprOpcode::LE || expr->op() == TExprOpcode::GT ||
+                expr->op() == TExprOpcode::GE)) {
+        comparisons->emplace_back(expr);
+    }
+}
+
+// Concatenates the column `slot_id` of the chunks into a nullable column.
+ColumnPtr concat_column(const std::vector<ChunkPtr>& chunks, SlotId slot_id) {
+    ColumnPtr result;
+    for (const auto& chunk : chunks) {
+        const ColumnPtr& column = chunk->get_column_by_slot_id(slot_id);
+        if (result == nullptr) {
+            result = NullableColumn::wrap_if_necessary(ColumnHelper::get_data_column(column.get())->clone_empty());
+        }
+        result->append(*column);
+    }
+    return result;
+}
+
+// The first position in [begin, end) for which the monotone `pred` holds, or `end` if none.
+template <class Pred>
+size_t first_of(size_t begin, size_t end, Pred&& pred) {
+    while (begin < end) {
+        size_t mid = begin + (end - begin) / 2;
+        if (pred(mid)) {
+            end = mid;
+        } else {
+            begin = mid + 1;
+        }
+    }
+    return begin;
+}
+
+} // namespace
+
+NLJoinRangeKey NLJoinRangeKey::extract(const std::vector<ExprContext*>& join_conjuncts,
+                                       const RowDescriptor& probe_row_desc, const RowDescriptor& build_row_desc) {
+    SlotMap probe_slots = collect_slots(probe_row_desc);
+    SlotMap build_slots = collect_slots(build_row_desc);
+
+    std::vector<Expr*> comparisons;
+    for (ExprContext* ctx : join_conjuncts) {
+        collect_comparisons(ctx->root(), &comparisons);
+    }
+
+    NLJoinRangeKey key;
+    for (Expr* comparison : comparisons) {
+        TExprOpcode::type op = comparison->op();
+        const SlotDescriptor* probe_slot = find_slot(comparison->get_child(0), probe_slots);
+        const SlotDescriptor* build_slot = find_slot(comparison->get_child(1), build_slots);
+        if (probe_slot == nullptr || build_slot == nullptr) {
+            // build_col OP probe_col is the same as probe_col reversed(OP) build_col
+            probe_slot = find_slot(comparison->get_child(1), probe_slots);
+            build_slot = find_slot(comparison->get_child(0), build_slots);
+            if (probe_slot == nullptr || build_slot == nullptr) {
+                continue;
+            }
+            op = op == TExprOpcode::LT ? TExprOpcode::GT
+                 : op == TExprOpcode::LE ? TExprOpcode::GE
+                 : op == TExprOpcode::GT ? TExprOpcode::LT
+                                         : TExprOpcode::LE;
+        }
+        if (!(probe_slot->type() == build_slot->type())) {
+            continue;
+        }
+        if (key.probe_slot >= 0 && key.probe_slot != probe_slot->id()) {
+            continue;
+        }
+
+        bool build_is_lower = op == TExprOpcode::GT || op == TExprOpcode::GE;
+        SlotId& bound = build_is_lower ? key.build_lower_slot : key.build_upper_slot;
+        if (bound < 0) {
+            key.probe_slot = probe_slot->id();
+            bound = build_slot->id();
+        }
+    }
+    return key;
+}
+
+StatusOr<std::unique_ptr<NLJoinRangeIndex>> NLJoinRangeIndex::build(const NLJoinRangeKey& key,
+                                                                    std::vector<ChunkPtr>* build_chunks,
+                                                                    size_t chunk_size) {
+    DCHECK(key.valid());
+    std::unique_ptr<NLJoinRangeIndex> index(new NLJoinRangeIndex(key, chunk_size));
+    std::vector<ChunkPtr>& chunks = *build_chunks;
+    if (chunks.empty()) {
+        return index;
+    }
+
+    std::vector<size_t> chunk_offsets;
+    size_t num_rows = 0;
+    for (auto& chunk : chunks) {
+        for (size_t i = 0; i < chunk->num_columns(); i++) {
+            const ColumnPtr& column = chunk->get_column_by_index(i);
+            if (column->is_constant()) {
+                chunk->update_column_by_index(
+                        ColumnHelper::unpack_and_duplicate_const_column(chunk->num_rows(), column), i);
+            }
+        }
+        chunk_offsets.emplace_back(num_rows);
+        num_rows += chunk->num_rows();
+    }
+    if (num_rows > UINT32_MAX) {
+        return Status::NotSupported("too many build rows for the range join");
+    }
+
+    bool sort_by_lower = key.build_lower_slot >= 0;
+    ColumnPtr sort_keys = concat_column(chunks, sort_by_lower ? key.build_lower_slot : key.build_upper_slot);
+    ColumnPtr upper_keys;
+    if (sort_by_lower && key.build_upper_slot >= 0) {
+        upper_keys = concat_column(chunks, key.build_upper_slot);
+    }
+
+    // The rows with a non-NULL sort key in order, followed by the others.
+    const auto& sort_nulls = down_cast<NullableColumn*>(sort_keys.get())->immutable_null_column_data();
+    const Column& sort_data = *down_cast<NullableColumn*>(sort_keys.get())->data_column();
+    std::vector<uint32_t> permutation(num_rows);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    auto nulls_begin = std::stable_partition(permutation.begin(), permutation.end(),
+                                             [&](uint32_t row) { return sort_nulls[row] == 0; });
+    std::stable_sort(permutation.begin(), nulls_begin, [&](uint32_t lhs, uint32_t rhs) {
+        return sort_data.compare_at(lhs, rhs, sort_data, 1) < 0;
+    });
+    index->_num_keys = nulls_begin - permutation.begin();
+
+    index->_sort_keys = sort_data.clone_empty();
+    index->_sort_keys->append_selective(sort_data, permutation.data(), 0, index->_num_keys);
+    if (upper_keys != nullptr) {
+        index->_upper_keys = upper_keys->clone_empty();
+        index->_upper_keys->append_selective(*upper_keys, permutation.data(), 0, index->_num_keys);
+        const auto* upper = down_cast<NullableColumn*>(index->_upper_keys.get());
+        const auto& upper_nulls = upper->immutable_null_column_data();
+        const Column& upper_data = *upper->data_column();
+        index->_upper_prefix_max.resize(index->_num_keys);
+        uint32_t max_row = kNoUpperBound;
+        for (uint32_t i = 0; i < index->_num_keys; i++) {
+            if (!upper_nulls[i] && (max_row == kNoUpperBound || upper_data.compare_at(i, max_row, upper_data, 1) > 0)) {
+                max_row = i;
+            }
+            index->_upper_prefix_max[i] = max_row;
+        }
+    }
+
+    // Rewrite the build chunks in the sorted order, a column is nullable if it's nullable in any chunk.
+    ChunkPtr sample = chunks[0]->clone_empty_with_slot(0);
+    for (size_t i = 0; i < sample->num_columns(); i++) {
+        for (const auto& chunk : chunks) {
+            if (chunk->get_column_by_index(i)->is_nullable()) {
+                sample->update_column_by_index(NullableColumn::wrap_if_necessary(sample->get_column_by_index(i)), i);
+                break;
+            }
+        }
+    }
+    std::vector<ChunkPtr> sorted_chunks;
+    for (size_t begin = 0; begin < num_rows; begin += chunk_size) {
+        size_t end = std::min(num_rows, begin + chunk_size);
+        ChunkPtr sorted_chunk = sample->clone_empty_with_slot(end - begin);
+        for (size_t pos = begin; pos < end;) {
+            // Append the runs of the rows consecutive in the same chunk at once.
+            uint32_t row = permutation[pos];
+            size_t chunk_index = std::upper_bound(chunk_offsets.begin(), chunk_offsets.end(), row) -
+                                 chunk_offsets.begin() - 1;
+            const Chunk& chunk = *chunks[chunk_index];
+            size_t offset = row - chunk_offsets[chunk_index];
+            size_t count = 1;
+            while (pos + count < end && permutation[pos + count] == row + count && offset + count < chunk.num_rows()) {
+                count++;
+            }
+            for (size_t i = 0; i < sorted_chunk->num_columns(); i++) {
+                sorted_chunk->get_column_by_index(i)->append(*chunk.get_column_by_index(i), offset, count);
+            }
+            pos += count;
+        }
+        sorted_chunks.emplace_back(std::move(sorted_chunk));
+    }
+    chunks = std::move(sorted_chunks);
+    return index;
+}
+
+void NLJoinRangeIndex::candidates(const Column& probe_key, size_t row, size_t* begin, size_t* end) const {
+    *begin = 0;
+    *end = 0;
+    if (_num_keys == 0 || probe_key.is_null(row)) {
+        return;
+    }
+    const Column& probe_data = *ColumnHelper::get_data_column(&probe_key);
+    size_t probe_row = probe_key.is_constant() ? 0 : row;
+
+    if (_key.build_lower_slot < 0) {
+        // Sorted by the upper bound, the candidates are the rows whose upper bound >= the probe key.
+        *begin = first_of(0, _num_keys,
+                          [&](size_t i) { return _sort_keys->compare_at(i, probe_row, probe_data, 1) >= 0; });
+        *end = _num_keys;
+        return;
+    }
+
+    // The rows whose lower bound <= the probe key.
+    *end = first_of(0, _num_keys, [&](size_t i) { return _sort_keys->compare_at(i, probe_row, probe_data, 1) > 0; });
+    if (_upper_prefix_max.empty()) {
+        return;
+    }
+    // Skip the rows before the first one whose prefix maximal upper bound >= the probe key.
+    const Column& upper_data = *down_cast<const NullableColumn*>(_upper_keys.get())->data_column();
+    *begin = first_of(0, *end, [&](size_t i) {
+        uint32_t max_row = _upper_prefix_max[i];
+        return max_row != kNoUpperBound && upper_data.compare_at(max_row, probe_row, probe_data, 1) >= 0;
+    });
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,85 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/global_types.h"
+#include "common/statusor.h"
+
+namespace starrocks {
+class ExprContext;
+class RowDescriptor;
+} // namespace starrocks
+
+namespace starrocks::pipeline {
+
+// The range predicates of a nested loop join between a probe column and the build columns, i.e.
+//   build_lower <= probe_key AND probe_key <= build_upper
+// where either bound may be missing and the comparisons may be strict, e.g. `a.ts BETWEEN b.start AND b.end`.
+struct NLJoinRangeKey {
+    SlotId probe_slot = -1;
+    SlotId build_lower_slot = -1;
+    SlotId build_upper_slot = -1;
+
+    bool valid() const { return probe_slot >= 0 && (build_lower_slot >= 0 || build_upper_slot >= 0); }
+
+    // Extracts the range predicates of the first probe column compared with a build column of the same type from
+    // the join conjuncts, including the children of the AND predicates. The extracted predicates are kept in the
+    // conjuncts, the range key only narrows the build rows they are evaluated on.
+    static NLJoinRangeKey extract(const std::vector<ExprContext*>& join_conjuncts, const RowDescriptor& probe_row_desc,
+                                  const RowDescriptor& build_row_desc);
+};
+
+// Replaces the cross product of an inner nested loop join with range predicates by binary searches: the build
+// rows are sorted by the lower bound, so the rows whose lower bound is not greater than a probe key are a prefix of
+// them, and the prefix maxima of the upper bound are non-decreasing, so the rows before the first prefix maximum not
+// less than the probe key can't match either. For the disjoint ranges, e.g. the IP ranges of a geolocation table,
+// the candidates of a probe key are exactly the matched rows. Without a lower bound, the build rows are sorted by the
+// upper bound and the candidates are the suffix whose upper bound is not less than the probe key.
+//
+// The candidates are a superset of the matched rows, the join conjuncts are still evaluated on them. The build rows
+// with a NULL sort key never match so they are placed after all the candidates.
+class NLJoinRangeIndex {
+public:
+    // Sorts the rows of `build_chunks` by the range key in place, into chunks of `chunk_size` rows except the last.
+    static StatusOr<std::unique_ptr<NLJoinRangeIndex>> build(const NLJoinRangeKey& key,
+                                                             std::vector<ChunkPtr>* build_chunks, size_t chunk_size);
+
+    SlotId probe_slot() const { return _key.probe_slot; }
+    size_t chunk_size() const { return _chunk_size; }
+
+    // The candidates of the row `row` of the probe key column `probe_key` are the sorted build rows [*begin, *end).
+    void candidates(const Column& probe_key, size_t row, size_t* begin, size_t* end) const;
+
+private:
+    NLJoinRangeIndex(const NLJoinRangeKey& key, size_t chunk_size) : _key(key), _chunk_size(chunk_size) {}
+
+    static constexpr uint32_t kNoUpperBound = UINT32_MAX;
+
+    NLJoinRangeKey _key;
+    size_t _chunk_size;
+    // The number of the sorted build rows whose sort key is not NULL.
+    size_t _num_keys = 0;
+    // The data columns of the sort key and the other bound of the sorted build rows.
+    ColumnPtr _sort_keys;
+    ColumnPtr _upper_keys;
+    // The row of the maximal non-NULL upper bound of the sorted build rows [0, i], only if sorted by the lower bound.
+    std::vector<uint32_t> _upper_prefix_max;
+};
+
+} // namespace starrocks::pipeline
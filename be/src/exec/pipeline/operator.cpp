@@ -17,14 +17,17 @@
 #include <algorithm>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/query_context.h"
 #include "exprs/expr_context.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/allocation_samples.h"
 #include "runtime/runtime_filter_cache.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 #include "util/failpoint/fail_point.h"
 #include "util/runtime_profile.h"
 
@@ -81,6 +84,12 @@ Status Operator::prepare(RuntimeState* state) {
     _push_row_num_counter = ADD_COUNTER(_common_metrics, "PushRowNum", TUnit::UNIT);
     _pull_chunk_num_counter = ADD_COUNTER(_common_metrics, "PullChunkNum", TUnit::UNIT);
     _pull_row_num_counter = ADD_COUNTER(_common_metrics, "PullRowNum", TUnit::UNIT);
+    if (config::pipeline_enable_hardware_counters) {
+        _hw_cycles_counter = ADD_COUNTER(_common_metrics, "HardwareCycles", TUnit::UNIT);
+        _hw_instructions_counter = ADD_COUNTER(_common_metrics, "HardwareInstructions", TUnit::UNIT);
+        _hw_llc_misses_counter = ADD_COUNTER(_common_metrics, "HardwareLLCMisses", TUnit::UNIT);
+        _hw_branch_misses_counter = ADD_COUNTER(_common_metrics, "HardwareBranchMisses", TUnit::UNIT);
+    }
     if (state->query_ctx() && state->query_ctx()->spill_manager()) {
         _mem_resource_manager.prepare(this, state->query_ctx()->spill_manager());
     }
@@ -91,6 +100,13 @@ Status Operator::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
+void Operator::update_hardware_counters(const PerfEventValues& values) {
+    COUNTER_UPDATE(_hw_cycles_counter, values.cycles);
+    COUNTER_UPDATE(_hw_instructions_counter, values.instructions);
+    COUNTER_UPDATE(_hw_llc_misses_counter, values.llc_misses);
+    COUNTER_UPDATE(_hw_branch_misses_counter, values.branch_misses);
+}
+
 void Operator::set_prepare_time(int64_t cost_ns) {
     _prepare_timer->set(cost_ns);
 }
@@ -138,6 +154,9 @@ void Operator::close(RuntimeState* state) {
                               RuntimeProfile::Counter::create_strategy(TCounterAggregateType::SUM,
                                                                        TCounterMergeType::SKIP_FIRST_MERGE))
                 ->set(_mem_tracker->deallocation());
+        if (auto* samples = _mem_tracker->allocation_samples(); samples != nullptr && samples->num_samples() > 0) {
+            _common_metrics->add_info_string("TopAllocationSites", samples->top_sites(10));
+        }
     }
 
     // Pipeline do not need the built in total time counter
@@ -194,7 +213,10 @@ Status Operator::eval_conjuncts_and_in_filters(const std::vector<ExprContext*>&
         _conjuncts_input_counter->update(before);
         RETURN_IF_ERROR(
                 starrocks::ExecNode::eval_conjuncts(_cached_conjuncts_and_in_filters, chunk, filter, apply_filter));
-        auto after = chunk->num_rows();
+        size_t after = chunk->num_rows();
+        if (!apply_filter && filter != nullptr && *filter != nullptr) {
+            after = SIMD::count_nonzero(**filter);
+        }
         _conjuncts_output_counter->update(after);
     }
 
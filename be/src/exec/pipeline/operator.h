@@ -23,6 +23,7 @@
 #include "exprs/runtime_filter_bank.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
+#include "util/perf_event_counters.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -35,6 +36,7 @@ using RuntimeFilterProbeCollector = starrocks::RuntimeFilterProbeCollector;
 namespace pipeline {
 class Operator;
 class OperatorFactory;
+class PipelineObservable;
 using OperatorPtr = std::shared_ptr<Operator>;
 using Operators = std::vector<OperatorPtr>;
 using LocalRFWaitingSet = std::set<TPlanNodeId>;
@@ -103,6 +105,11 @@ public:
     // output chunks will be produced
     virtual bool is_finished() const = 0;
 
+    // The source of the events which change has_output() and is_finished() of this source operator, if all of
+    // the changes are notified by it. The driver blocked on the input of this operator is only checked by the
+    // poller when notified, or at the interval of config::pipeline_poller_fallback_interval_ms.
+    virtual PipelineObservable* observable() { return nullptr; }
+
     // pending_finish returns whether this operator still has reference to the object owned by the operator or FragmentContext.
     // It can ONLY be called after calling set_finished().
     // When a driver's sink operator is finished, the driver should wait for pending i/o task completion.
@@ -201,6 +208,10 @@ public:
 
     void set_prepare_time(int64_t cost_ns);
 
+    // Whether the hardware counters of this operator are collected, see config::pipeline_enable_hardware_counters.
+    bool has_hardware_counters() const { return _hw_cycles_counter != nullptr; }
+    void update_hardware_counters(const PerfEventValues& values);
+
     // INCREMENTAL MV Methods
     //
     // The operator will run periodically which is triggered by FE from PREPARED to EPOCH_FINISHED in one Epoch,
@@ -314,6 +325,10 @@ protected:
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
     RuntimeProfile::Counter* _conjuncts_input_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_output_counter = nullptr;
+    RuntimeProfile::Counter* _hw_cycles_counter = nullptr;
+    RuntimeProfile::Counter* _hw_instructions_counter = nullptr;
+    RuntimeProfile::Counter* _hw_llc_misses_counter = nullptr;
+    RuntimeProfile::Counter* _hw_branch_misses_counter = nullptr;
 
     // only used in spillable operator to record peak revocable memory bytes,
     // each operator should initialize it before use
@@ -22,6 +22,8 @@
 #include "exec/pipeline/adaptive/event.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
+#include "exec/pipeline/pipeline_driver_poller.h"
+#include "exec/pipeline/pipeline_observable.h"
 #include "exec/pipeline/scan/olap_scan_operator.h"
 #include "exec/pipeline/scan/scan_operator.h"
 #include "exec/pipeline/source_operator.h"
@@ -29,6 +31,7 @@
 #include "exec/query_cache/lane_arbiter.h"
 #include "exec/query_cache/multilane_operator.h"
 #include "exec/query_cache/ticket_checker.h"
+#include "exec/spill/global_spill_arbiter.h"
 #include "exec/workgroup/work_group.h"
 #include "gen_cpp/InternalService_types.h"
 #include "gutil/casts.h"
@@ -37,11 +40,43 @@
 #include "runtime/runtime_state.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
+#include "util/perf_event_counters.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks::pipeline {
 
+// Adds the hardware counters of the calling thread in its scope to the operator and to |total|.
+class ScopedOperatorHardwareCounters {
+public:
+    ScopedOperatorHardwareCounters(Operator* op, PerfEventValues* total) : _op(op), _total(total) {
+        if (_op->has_hardware_counters()) {
+            _counters = PerfEventCounters::thread_local_instance();
+            if (!_counters->read(&_start)) {
+                _counters = nullptr;
+            }
+        }
+    }
+
+    ~ScopedOperatorHardwareCounters() {
+        PerfEventValues end;
+        if (_counters != nullptr && _counters->read(&end)) {
+            auto values = end - _start;
+            _op->update_hardware_counters(values);
+            *_total += values;
+        }
+    }
+
+private:
+    Operator* _op;
+    PerfEventValues* _total;
+    PerfEventCounters* _counters = nullptr;
+    PerfEventValues _start;
+};
+
 PipelineDriver::~PipelineDriver() noexcept {
+    if (_source_observable != nullptr) {
+        _source_observable->remove_observer(this);
+    }
     if (_workgroup != nullptr) {
         _workgroup->decr_num_running_drivers();
     }
@@ -106,6 +141,11 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _peak_driver_queue_size_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakDriverQueueSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
 
+    if (config::pipeline_driver_column_buffer_pool_bytes > 0) {
+        _column_buffer_pool = std::make_unique<ColumnBufferPool>(config::pipeline_driver_column_buffer_pool_bytes);
+        _column_buffer_pool_hit_counter = ADD_COUNTER(_runtime_profile, "ColumnBufferPoolHitCount", TUnit::UNIT);
+    }
+
     DCHECK(_state == DriverState::NOT_READY);
 
     auto* source_op = source_operator();
@@ -205,6 +245,13 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
         _operator_stages[op->get_id()] = OperatorStage::PREPARED;
     }
 
+    if (config::pipeline_poller_fallback_interval_ms > 0) {
+        _source_observable = source_operator()->observable();
+        if (_source_observable != nullptr) {
+            _source_observable->add_observer(this);
+        }
+    }
+
     // Driver has no dependencies always sets _all_dependencies_ready to true;
     _all_dependencies_ready = _dependencies.empty() && !_pipeline->pipeline_event()->need_wait_dependencies_finished();
     // Driver has no local rf to wait for completion always sets _all_local_rf_ready to true;
@@ -212,6 +259,7 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     // Driver has no global rf to wait for completion always sets _all_global_rf_ready_or_timeout to true;
     _all_global_rf_ready_or_timeout = _global_rf_descriptors.empty();
     set_driver_state(DriverState::READY);
+    _query_ctx->incr_num_drivers();
 
     _total_timer_sw = runtime_state->obj_pool()->add(new MonotonicStopWatch());
     _pending_timer_sw = runtime_state->obj_pool()->add(new MonotonicStopWatch());
@@ -223,6 +271,14 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     return Status::OK();
 }
 
+void PipelineDriver::notify() {
+    _notified.store(true, std::memory_order_release);
+    auto* poller = _blocked_poller.load(std::memory_order_acquire);
+    if (poller != nullptr) {
+        poller->wakeup();
+    }
+}
+
 void PipelineDriver::update_peak_driver_queue_size_counter(size_t new_value) {
     if (_peak_driver_queue_size_counter != nullptr) {
         _peak_driver_queue_size_counter->set(new_value);
@@ -237,13 +293,22 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
     size_t total_chunks_moved = 0;
     size_t total_rows_moved = 0;
     int64_t time_spent = 0;
+    PerfEventValues hw_values;
     Status return_status = Status::OK();
+    // The column buffers freed by the operators are reused by the next chunks of this driver.
+    ThreadLocalColumnBufferPoolSetter column_buffer_pool_setter(_column_buffer_pool.get());
     DeferOp defer([&]() {
         if (ScanOperator* scan = source_scan_operator()) {
             scan->end_driver_process(this);
         }
 
         _update_statistics(runtime_state, total_chunks_moved, total_rows_moved, time_spent);
+        if (hw_values.cycles > 0) {
+            _query_ctx->incr_hardware_counters(hw_values);
+        }
+        if (_column_buffer_pool != nullptr) {
+            COUNTER_SET(_column_buffer_pool_hit_counter, static_cast<int64_t>(_column_buffer_pool->num_hits()));
+        }
     });
 
     if (ScanOperator* scan = source_scan_operator()) {
@@ -309,6 +374,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 {
                     SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(curr_op);
                     SCOPED_TIMER(curr_op->_pull_timer);
+                    ScopedOperatorHardwareCounters hw_counters(curr_op.get(), &hw_values);
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
@@ -342,6 +408,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                         {
                             SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(next_op);
                             SCOPED_TIMER(next_op->_push_timer);
+                            ScopedOperatorHardwareCounters hw_counters(next_op.get(), &hw_values);
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
                             _adjust_memory_usage(runtime_state, query_mem_tracker.get(), next_op, maybe_chunk.value());
                             RELEASE_RESERVED_GUARD();
@@ -402,6 +469,9 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 _workgroup->driver_sched_entity()->in_queue()->should_yield(this, time_spent)) {
                 should_yield = true;
                 COUNTER_UPDATE(_yield_by_preempt_counter, 1);
+                if (_query_ctx->enable_driver_timeline()) {
+                    DriverTimeline::instance()->record(this, DriverTimeline::kPreempted);
+                }
                 break;
             }
         }
@@ -596,6 +666,8 @@ void PipelineDriver::_adjust_memory_usage(RuntimeState* state, MemTracker* track
         return;
     }
 
+    mem_resource_mgr.update_revocable_bytes(op->revocable_mem_bytes());
+
     // try to release buffer if memusage > mid level threhold
     _try_to_release_buffer(state, op);
 
@@ -641,6 +713,15 @@ void PipelineDriver::_try_to_release_buffer(RuntimeState* state, OperatorPtr& op
         if (mem_resource_mgr.is_releasing()) {
             return;
         }
+        // release memory if the global arbiter asks this query to, under process memory pressure
+        if (auto* query_spill_manager = _query_ctx->spill_manager(); query_spill_manager != nullptr) {
+            spill::GlobalSpillArbiter::instance()->maybe_arbitrate();
+            if (query_spill_manager->spill_requested()) {
+                TRACE_SPILL_LOG << "release operator due to process mem pressure: " << op->get_name();
+                mem_resource_mgr.to_low_memory_mode();
+                return;
+            }
+        }
         auto query_mem_tracker = _query_ctx->mem_tracker();
         auto query_consumption = query_mem_tracker->consumption();
         auto query_mem_limit = query_mem_tracker->lowest_limit();
@@ -680,6 +761,7 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state, in
     DCHECK(state == DriverState::FINISH || state == DriverState::CANCELED || state == DriverState::INTERNAL_ERROR);
     QUERY_TRACE_BEGIN("finalize", _driver_name);
     _close_operators(runtime_state);
+    _column_buffer_pool.reset();
 
     set_driver_state(state);
 
@@ -688,6 +770,7 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state, in
     // Acquire the pointer to avoid be released when removing query
     auto query_trace = _query_ctx->shared_query_trace();
     const std::string driver_name = _driver_name;
+    _query_ctx->incr_num_finished_drivers();
     _pipeline->count_down_driver(runtime_state);
     QUERY_TRACE_END("finalize", driver_name);
 }
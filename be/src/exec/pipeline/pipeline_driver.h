@@ -21,6 +21,7 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
+#include "exec/pipeline/driver_timeline.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/operator_with_dependency.h"
@@ -33,6 +34,7 @@
 #include "exec/workgroup/work_group_fwd.h"
 #include "fmt/printf.h"
 #include "runtime/mem_tracker.h"
+#include "runtime/memory/column_buffer_pool.h"
 #include "util/phmap/phmap.h"
 
 namespace starrocks {
@@ -51,6 +53,8 @@ using Drivers = std::vector<DriverPtr>;
 using ConstDriverConsumer = std::function<void(DriverConstRawPtr)>;
 using ConstDriverPredicator = std::function<bool(DriverConstRawPtr)>;
 class DriverQueue;
+class PipelineDriverPoller;
+class PipelineObservable;
 
 enum DriverState : uint32_t {
     NOT_READY = 0,
@@ -280,6 +284,9 @@ public:
         }
 
         _state = state;
+        if (_query_ctx != nullptr && _query_ctx->enable_driver_timeline()) {
+            DriverTimeline::instance()->record(this, state);
+        }
     }
 
     Operators& operators() { return _operators; }
@@ -441,6 +448,10 @@ public:
     inline bool is_in_ready_queue() const { return _in_ready_queue.load(std::memory_order_acquire); }
     void set_in_ready_queue(bool v) { _in_ready_queue.store(v, std::memory_order_release); }
 
+    // Called by the observable of the source operator when the input of this driver may be ready, which wakes up
+    // the poller if the driver is blocked.
+    void notify();
+
     inline std::string get_name() const { return strings::Substitute("PipelineDriver (id=$0)", _driver_id); }
 
     // Whether the query can be expirable or not.
@@ -522,10 +533,22 @@ protected:
 
     workgroup::WorkGroupPtr _workgroup = nullptr;
     DriverQueue* _in_queue = nullptr;
+    // Caches the column buffers freed while this driver is running, see ColumnBufferPool.
+    std::unique_ptr<ColumnBufferPool> _column_buffer_pool;
+    RuntimeProfile::Counter* _column_buffer_pool_hit_counter = nullptr;
     // The index of QuerySharedDriverQueue._queues which this driver belongs to.
     size_t _driver_queue_level = 0;
     std::atomic<bool> _in_ready_queue{false};
 
+    // The observable of the source operator, see Operator::observable().
+    PipelineObservable* _source_observable = nullptr;
+    // Whether the driver is notified since the poller checked it last time.
+    std::atomic<bool> _notified{true};
+    // The poller which the driver is blocked in.
+    std::atomic<PipelineDriverPoller*> _blocked_poller{nullptr};
+    // Only accessed by the poller, the time to check the observable blocked driver even if it's not notified.
+    int64_t _fallback_poll_time_ns = 0;
+
     std::atomic<bool> _has_log_cancelled{false};
 
     // metrics
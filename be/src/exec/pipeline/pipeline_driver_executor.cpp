@@ -20,6 +20,7 @@
 #include "exec/pipeline/stream_pipeline_driver.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "io/io_latency_metrics.h"
 #include "runtime/current_thread.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
@@ -112,6 +113,9 @@ void GlobalDriverExecutor::_worker_thread() {
         _schedule_count++;
 
         SCOPED_SET_TRACE_INFO(driver->driver_id(), query_ctx->query_id(), fragment_ctx->fragment_instance_id());
+        SCOPED_SET_WORKGROUP_ID(driver->workgroup() != nullptr ? driver->workgroup()->id() : -1);
+        ScopedIOLatencyContext io_latency_context(query_ctx->io_latency_histograms(),
+                                                  driver->workgroup() != nullptr ? driver->workgroup()->id() : -1);
 
         SET_THREAD_LOCAL_QUERY_TRACE_CONTEXT(query_ctx->query_trace(), fragment_ctx->fragment_instance_id(), driver);
 
@@ -289,6 +293,30 @@ void GlobalDriverExecutor::cancel(DriverRawPtr driver) {
     }
 }
 
+void GlobalDriverExecutor::_add_io_latency_counters(QueryContext* query_ctx, RuntimeProfile* profile) {
+    static const char* source_names[] = {"LocalDisk", "PageCacheMiss", "BlockCacheMemory", "BlockCacheDisk",
+                                         "RemoteStorage"};
+    static_assert(std::size(source_names) == static_cast<size_t>(IOSource::NUM_SOURCES));
+    auto add_counter = [profile](const std::string& name, TUnit::type unit, int64_t value) {
+        auto* counter = profile->add_counter(
+                name, unit, RuntimeProfile::Counter::create_strategy(unit, TCounterMergeType::SKIP_FIRST_MERGE));
+        counter->set(value);
+    };
+    LatencyHistogram::Snapshot snapshot;
+    for (int i = 0; i < static_cast<int>(IOSource::NUM_SOURCES); i++) {
+        query_ctx->io_latency_histograms()->get(static_cast<IOSource>(i)).snapshot(&snapshot);
+        int64_t count = LatencyHistogram::count(snapshot);
+        if (count == 0) {
+            continue;
+        }
+        std::string prefix = std::string("QueryIO") + source_names[i];
+        add_counter(prefix + "Count", TUnit::UNIT, count);
+        add_counter(prefix + "LatencyP50", TUnit::TIME_NS, LatencyHistogram::percentile(snapshot, 50));
+        add_counter(prefix + "LatencyP99", TUnit::TIME_NS, LatencyHistogram::percentile(snapshot, 99));
+        add_counter(prefix + "LatencyMax", TUnit::TIME_NS, LatencyHistogram::percentile(snapshot, 100));
+    }
+}
+
 void GlobalDriverExecutor::report_exec_state(QueryContext* query_ctx, FragmentContext* fragment_ctx,
                                              const Status& status, bool done, bool attach_profile) {
     auto* profile = fragment_ctx->runtime_state()->runtime_profile();
@@ -314,6 +342,7 @@ void GlobalDriverExecutor::report_exec_state(QueryContext* query_ctx, FragmentCo
                 "QueryExecutionWallTime", TUnit::TIME_NS,
                 RuntimeProfile::Counter::create_strategy(TUnit::TIME_NS, TCounterMergeType::SKIP_FIRST_MERGE));
         query_exec_wall_time->set(query_ctx->lifetime());
+        _add_io_latency_counters(query_ctx, profile);
     }
 
     const auto& fe_addr = fragment_ctx->fe_addr();
@@ -340,6 +369,13 @@ void GlobalDriverExecutor::report_exec_state(QueryContext* query_ctx, FragmentCo
     auto exec_env = fragment_ctx->runtime_state()->exec_env();
     auto fragment_id = fragment_ctx->fragment_instance_id();
 
+    if (!done && config::exec_state_report_batch_window_ms >= 0) {
+        // the periodic reports are batched per FE, the final one is sent at once
+        this->_exec_state_reporter->submit_batched(exec_env, fe_addr, std::move(params));
+        VLOG(1) << "[Driver] Submit batched exec state report: fragment_instance_id=" << print_id(fragment_id);
+        return;
+    }
+
     auto report_task = [params, exec_env, fe_addr, fragment_id]() {
         int retry_times = 0;
         while (retry_times++ < 3) {
@@ -65,6 +65,9 @@ public:
 
     virtual void bind_cpus(const CpuUtil::CpuIds& cpuids, const std::vector<CpuUtil::CpuIds>& borrowed_cpuids) = 0;
 
+    // The number of the ready drivers waiting for a worker thread.
+    virtual size_t num_queued_drivers() const = 0;
+
 protected:
     std::string _name;
 };
@@ -92,6 +95,8 @@ public:
 
     void bind_cpus(const CpuUtil::CpuIds& cpuids, const std::vector<CpuUtil::CpuIds>& borrowed_cpuids) override;
 
+    size_t num_queued_drivers() const override { return _driver_queue->size(); }
+
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
     void _worker_thread();
@@ -99,6 +104,8 @@ private:
     void _finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
     RuntimeProfile* _build_merged_instance_profile(QueryContext* query_ctx, FragmentContext* fragment_ctx,
                                                    ObjectPool* obj_pool);
+    // Adds the count and the percentiles of the latencies of the reads of the query by the source of the reads.
+    static void _add_io_latency_counters(QueryContext* query_ctx, RuntimeProfile* profile);
 
     void _finalize_epoch(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
 
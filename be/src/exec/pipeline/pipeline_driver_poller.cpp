@@ -15,6 +15,10 @@
 #include "pipeline_driver_poller.h"
 
 #include <chrono>
+
+#include "common/config.h"
+#include "util/time.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -49,6 +53,14 @@ void PipelineDriverPoller::run_internal() {
     int spin_count = 0;
     std::vector<DriverRawPtr> ready_drivers;
     while (!_is_shutdown.load(std::memory_order_acquire)) {
+        // The notifications after it are handled by the next round.
+        _pending_wakeup.store(false, std::memory_order_release);
+        const int64_t fallback_interval_ns = config::pipeline_poller_fallback_interval_ms * 1000000;
+        const int64_t now_ns = MonotonicNanos();
+        // The earliest time to check the observable blocked drivers skipped in this round, if no other driver
+        // is checked.
+        int64_t next_poll_time_ns = INT64_MAX;
+        bool checked_any = false;
         {
             std::unique_lock<std::mutex> lock(_global_mutex);
             tmp_blocked_drivers.splice(tmp_blocked_drivers.end(), _blocked_drivers);
@@ -78,6 +90,20 @@ void PipelineDriverPoller::run_internal() {
             while (driver_it != _local_blocked_drivers.end()) {
                 auto* driver = *driver_it;
 
+                if (fallback_interval_ns > 0 && driver->_source_observable != nullptr &&
+                    driver->driver_state() == DriverState::INPUT_EMPTY) {
+                    // Consume the notification before checking the driver, so a notification during the check
+                    // is not lost.
+                    if (!driver->_notified.exchange(false, std::memory_order_acq_rel) &&
+                        now_ns < driver->_fallback_poll_time_ns) {
+                        next_poll_time_ns = std::min(next_poll_time_ns, driver->_fallback_poll_time_ns);
+                        ++driver_it;
+                        continue;
+                    }
+                    driver->_fallback_poll_time_ns = now_ns + fallback_interval_ns;
+                }
+                checked_any = true;
+
                 if (!driver->is_query_never_expired() && driver->query_ctx()->is_query_expired()) {
                     // there are not any drivers belonging to a query context can make progress for an expiration period
                     // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
@@ -149,6 +175,17 @@ void PipelineDriverPoller::run_internal() {
             }
         }
 
+        if (!checked_any && next_poll_time_ns != INT64_MAX) {
+            // All the blocked drivers wait for the notifications, sleep until notified or the earliest fallback.
+            std::unique_lock<std::mutex> lock(_global_mutex);
+            _cond.wait_for(lock, std::chrono::nanoseconds(next_poll_time_ns - now_ns), [this] {
+                return _pending_wakeup.load(std::memory_order_acquire) || !_blocked_drivers.empty() ||
+                       _is_shutdown.load(std::memory_order_acquire);
+            });
+            spin_count = 0;
+            continue;
+        }
+
         if (ready_drivers.empty()) {
             spin_count += 1;
         } else {
@@ -185,11 +222,22 @@ void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
     std::unique_lock<std::mutex> lock(_global_mutex);
     _blocked_drivers.push_back(driver);
     _num_drivers++;
+    // Check the driver at least once, the notifications before it's blocked are not counted.
+    driver->_notified.store(true, std::memory_order_release);
+    driver->_blocked_poller.store(this, std::memory_order_release);
     driver->_pending_timer_sw->reset();
     driver->driver_acct().clean_local_queue_infos();
     _cond.notify_one();
 }
 
+void PipelineDriverPoller::wakeup() {
+    if (!_pending_wakeup.exchange(true, std::memory_order_acq_rel)) {
+        // Notify under the lock, so the polling thread can't miss it between checking the flag and waiting.
+        std::lock_guard<std::mutex> lock(_global_mutex);
+        _cond.notify_one();
+    }
+}
+
 void PipelineDriverPoller::park_driver(const DriverRawPtr driver) {
     std::unique_lock<std::mutex> lock(_global_parked_mutex);
     VLOG_ROW << "Add to parked driver:" << driver->to_readable_string();
@@ -234,6 +282,7 @@ size_t PipelineDriverPoller::calculate_parked_driver(const ConstDriverPredicator
 
 void PipelineDriverPoller::remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it) {
     auto& driver = *driver_it;
+    driver->_blocked_poller.store(nullptr, std::memory_order_release);
     driver->_pending_timer->update(driver->_pending_timer_sw->elapsed_time());
     local_blocked_drivers.erase(driver_it++);
     _num_drivers--;
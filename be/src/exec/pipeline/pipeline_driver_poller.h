@@ -50,6 +50,8 @@ public:
     void shutdown();
 
     void add_blocked_driver(const DriverRawPtr driver);
+    // Wakes up the polling thread waiting for the notifications of the observable blocked drivers.
+    void wakeup();
     void remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it);
 
     void park_driver(const DriverRawPtr driver);
@@ -82,6 +84,8 @@ private:
     scoped_refptr<Thread> _polling_thread;
     std::atomic<bool> _is_polling_thread_initialized;
     std::atomic<bool> _is_shutdown;
+    // Whether any blocked driver is notified since the last round of polling.
+    std::atomic<bool> _pending_wakeup{false};
 
     // NOTE: The `driver` can be stored in the parked drivers when it will never not be called to run.
     // The parked driver needs to be actived when it needs to be triggered again.
@@ -14,9 +14,13 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include <algorithm>
+
+#include "exec/pipeline/query_context.h"
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -53,9 +57,10 @@ void QuerySharedDriverQueue::put_back(const DriverRawPtr driver) {
         driver->set_in_ready_queue(true);
         driver->set_in_queue(this);
         driver->update_peak_driver_queue_size_counter(_num_drivers);
-        _cv.notify_one();
         ++_num_drivers;
     }
+    // Notify out of the lock, so that the woken thread doesn't block on _global_mutex immediately.
+    _cv.notify_one();
 }
 
 void QuerySharedDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
@@ -64,15 +69,19 @@ void QuerySharedDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers)
         levels[i] = _compute_driver_level(drivers[i]);
         drivers[i]->set_driver_queue_level(levels[i]);
     }
-    std::lock_guard<std::mutex> lock(_global_mutex);
+    {
+        std::lock_guard<std::mutex> lock(_global_mutex);
+        for (int i = 0; i < drivers.size(); i++) {
+            _queues[levels[i]].put(drivers[i]);
+            drivers[i]->set_in_ready_queue(true);
+            drivers[i]->set_in_queue(this);
+            drivers[i]->update_peak_driver_queue_size_counter(_num_drivers);
+        }
+        _num_drivers += drivers.size();
+    }
     for (int i = 0; i < drivers.size(); i++) {
-        _queues[levels[i]].put(drivers[i]);
-        drivers[i]->set_in_ready_queue(true);
-        drivers[i]->set_in_queue(this);
-        drivers[i]->update_peak_driver_queue_size_counter(_num_drivers);
         _cv.notify_one();
     }
-    _num_drivers += drivers.size();
 }
 
 void QuerySharedDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
@@ -141,26 +150,41 @@ void QuerySharedDriverQueue::cancel(DriverRawPtr driver) {
 }
 
 size_t QuerySharedDriverQueue::size() const {
-    std::lock_guard<std::mutex> lock(_global_mutex);
-
-    return _num_drivers;
+    return _num_drivers.load(std::memory_order_relaxed);
 }
 
 void QuerySharedDriverQueue::update_statistics(const DriverRawPtr driver) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
-
+    // The accumulated time of each level is atomic, so there is no need to hold _global_mutex,
+    // which is contended by all the executor threads in take() and put_back().
     _queues[driver->get_driver_queue_level()].update_accu_time(driver);
 }
 
 int QuerySharedDriverQueue::_compute_driver_level(const DriverRawPtr driver) const {
     int time_spent = driver->driver_acct().get_accumulated_time_spent();
+    int level = QUEUE_SIZE - 1;
     for (int i = driver->get_driver_queue_level(); i < QUEUE_SIZE; ++i) {
         if (time_spent < _level_time_slices[i]) {
-            return i;
+            level = i;
+            break;
         }
     }
 
-    return QUEUE_SIZE - 1;
+    return std::max(0, level - _deadline_boost_levels(driver));
+}
+
+int QuerySharedDriverQueue::_deadline_boost_levels(const DriverRawPtr driver) {
+    const auto* query_ctx = driver->query_ctx();
+    if (query_ctx == nullptr) {
+        return 0;
+    }
+    const int64_t latency_target_ns = query_ctx->latency_target_ns();
+    if (latency_target_ns <= 0) {
+        return 0;
+    }
+    const int64_t remaining_ns = query_ctx->latency_deadline_ns() - MonotonicNanos();
+    const double elapsed_ratio = 1.0 - std::clamp(remaining_ns * 1.0 / latency_target_ns, 0.0, 1.0);
+    const double urgency = std::max(elapsed_ratio, query_ctx->finished_drivers_ratio());
+    return static_cast<int>(urgency * (QUEUE_SIZE - 1));
 }
 
 void SubQuerySharedDriverQueue::put(const DriverRawPtr driver) {
@@ -223,20 +247,31 @@ void WorkGroupDriverQueue::close() {
 }
 
 void WorkGroupDriverQueue::put_back(const DriverRawPtr driver) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
-    _put_back<false>(driver);
+    {
+        std::lock_guard<std::mutex> lock(_global_mutex);
+        _put_back<false>(driver);
+    }
+    _cv.notify_one();
 }
 
 void WorkGroupDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
-    for (const auto driver : drivers) {
-        _put_back<false>(driver);
+    {
+        std::lock_guard<std::mutex> lock(_global_mutex);
+        for (const auto driver : drivers) {
+            _put_back<false>(driver);
+        }
+    }
+    for (size_t i = 0; i < drivers.size(); i++) {
+        _cv.notify_one();
     }
 }
 
 void WorkGroupDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
-    std::lock_guard<std::mutex> lock(_global_mutex);
-    _put_back<true>(driver);
+    {
+        std::lock_guard<std::mutex> lock(_global_mutex);
+        _put_back<true>(driver);
+    }
+    _cv.notify_one();
 }
 
 StatusOr<DriverRawPtr> WorkGroupDriverQueue::take(const bool block) {
@@ -321,9 +356,7 @@ void WorkGroupDriverQueue::update_statistics(const DriverRawPtr driver) {
 }
 
 size_t WorkGroupDriverQueue::size() const {
-    // TODO: reduce the lock scope
-    std::lock_guard<std::mutex> lock(_global_mutex);
-    return _num_drivers;
+    return _num_drivers.load(std::memory_order_relaxed);
 }
 
 bool WorkGroupDriverQueue::should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const {
@@ -351,8 +384,6 @@ void WorkGroupDriverQueue::_put_back(const DriverRawPtr driver) {
     }
 
     ++_num_drivers;
-
-    _cv.notify_one();
 }
 
 void WorkGroupDriverQueue::_update_min_wg() {
@@ -381,8 +412,10 @@ void WorkGroupDriverQueue::_enqueue_workgroup(workgroup::WorkGroupDriverSchedEnt
             // The workgroup maybe leaves for a long time, which results in that the runtime of it
             // may be much smaller than the other workgroups. If the runtime isn't adjusted, the others
             // will starve. Therefore, the runtime is adjusted according the minimum vruntime in _ready_wgs,
-            // and give it half of ideal runtime in a schedule period as compensation.
-            int64_t new_vruntime_ns = std::min(min_wg_entity->vruntime_ns() - _ideal_runtime_ns(wg_entity) / 2,
+            // and give it a burst credit growing with its idle time as compensation. The busy workgroups
+            // are preempted by should_yield() until the credit is used up.
+            const int64_t credit_ns = wg_entity->burst_credit_ns(_ideal_runtime_ns(wg_entity), MonotonicNanos());
+            int64_t new_vruntime_ns = std::min(min_wg_entity->vruntime_ns() - credit_ns,
                                                min_wg_entity->runtime_ns() / int64_t(wg_entity->cpu_weight()));
             int64_t diff_vruntime_ns = new_vruntime_ns - wg_entity->vruntime_ns();
             if (diff_vruntime_ns > 0) {
@@ -399,6 +432,7 @@ void WorkGroupDriverQueue::_enqueue_workgroup(workgroup::WorkGroupDriverSchedEnt
 void WorkGroupDriverQueue::_dequeue_workgroup(workgroup::WorkGroupDriverSchedEntity* wg_entity) {
     _sum_cpu_weight -= wg_entity->cpu_weight();
     _wg_entities.erase(wg_entity);
+    wg_entity->mark_idle(MonotonicNanos());
     _update_min_wg();
 }
 
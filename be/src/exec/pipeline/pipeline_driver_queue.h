@@ -123,7 +123,12 @@ public:
 private:
     // When the driver at the i-th level costs _level_time_slices[i],
     // it will move to (i+1)-th level.
+    // The drivers of a query with a latency target are moved up by _deadline_boost_levels().
     int _compute_driver_level(const DriverRawPtr driver) const;
+    // Up to QUEUE_SIZE-1 levels in proportion to the larger of the elapsed fraction of the latency target
+    // and the ratio of the finished drivers of the query, so the queries close to their deadline and the nearly
+    // finished ones, i.e. with the shortest remaining time, are taken first.
+    static int _deadline_boost_levels(const DriverRawPtr driver);
 
 private:
     // The time slice of the i-th level is (i+1)*LEVEL_TIME_SLICE_BASE ns,
@@ -136,7 +141,8 @@ private:
     // The time slice of the i-th level is (i+1)*LEVEL_TIME_SLICE_BASE ns.
     int64_t _level_time_slices[QUEUE_SIZE];
 
-    size_t _num_drivers = 0;
+    // Only modified under _global_mutex, but read without lock by size().
+    std::atomic<size_t> _num_drivers = 0;
 
     mutable std::mutex _global_mutex;
     std::condition_variable _cv;
@@ -209,7 +215,8 @@ private:
 
     size_t _sum_cpu_weight = 0;
 
-    size_t _num_drivers = 0;
+    // Only modified under _global_mutex, but read without lock by size().
+    std::atomic<size_t> _num_drivers = 0;
 
     // Cache the minimum entity, used to check should_yield() without lock.
     std::atomic<workgroup::WorkGroupDriverSchedEntity*> _min_wg_entity = nullptr;
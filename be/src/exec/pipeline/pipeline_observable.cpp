@@ -0,0 +1,42 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/pipeline_observable.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "exec/pipeline/pipeline_driver.h"
+
+namespace starrocks::pipeline {
+
+void PipelineObservable::add_observer(PipelineDriver* driver) {
+    std::unique_lock l(_mutex);
+    _observers.push_back(driver);
+}
+
+void PipelineObservable::remove_observer(PipelineDriver* driver) {
+    std::unique_lock l(_mutex);
+    _observers.erase(std::remove(_observers.begin(), _observers.end(), driver), _observers.end());
+}
+
+void PipelineObservable::notify_observers() {
+    // The shared lock keeps the drivers alive while they are notified.
+    std::shared_lock l(_mutex);
+    for (auto* driver : _observers) {
+        driver->notify();
+    }
+}
+
+} // namespace starrocks::pipeline
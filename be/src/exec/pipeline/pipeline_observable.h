@@ -0,0 +1,49 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <shared_mutex>
+#include <vector>
+
+#include "gutil/macros.h"
+
+namespace starrocks::pipeline {
+
+class PipelineDriver;
+
+// A source of the events which may unblock the drivers reading from it, e.g. the arrival of chunks at an exchange
+// receiver. The drivers blocked on it are woken up by notify_observers() instead of being polled by
+// PipelineDriverPoller each round, see Operator::observable().
+//
+// The observers are removed when the drivers are destructed, so it must outlive the drivers observing it.
+class PipelineObservable {
+public:
+    PipelineObservable() = default;
+    ~PipelineObservable() = default;
+
+    void add_observer(PipelineDriver* driver);
+    void remove_observer(PipelineDriver* driver);
+
+    // Called after the change of the state is visible to the observers.
+    void notify_observers();
+
+    DISALLOW_COPY_AND_MOVE(PipelineObservable);
+
+private:
+    std::shared_mutex _mutex;
+    std::vector<PipelineDriver*> _observers;
+};
+
+} // namespace starrocks::pipeline
@@ -18,6 +18,8 @@
 #include <vector>
 
 #include "agent/master_info.h"
+#include "common/config.h"
+#include "exec/iceberg/iceberg_delete_file_cache.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/pipeline/scan/connector_scan_operator.h"
@@ -27,6 +29,7 @@
 #include "runtime/current_thread.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/allocation_samples.h"
 #include "runtime/query_statistics.h"
 #include "runtime/runtime_filter_cache.h"
 #include "util/thread.h"
@@ -45,6 +48,10 @@ QueryContext::QueryContext()
           _wg_running_query_token_ptr(nullptr) {
     _sub_plan_query_statistics_recvr = std::make_shared<QueryStatisticsRecvr>();
     _stream_epoch_manager = std::make_shared<StreamEpochManager>();
+    if (config::iceberg_delete_file_cache_max_bytes_per_query > 0) {
+        _iceberg_delete_file_cache =
+                std::make_unique<IcebergDeleteFileCache>(config::iceberg_delete_file_cache_max_bytes_per_query);
+    }
     _lifetime_sw.start();
 }
 
@@ -59,6 +66,7 @@ QueryContext::~QueryContext() noexcept {
     {
         SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker.get());
         _fragment_mgr.reset();
+        _iceberg_delete_file_cache.reset();
     }
 
     // Accounting memory usage during QueryContext's destruction should not use query-level MemTracker, but its released
@@ -163,6 +171,9 @@ MemTracker* QueryContext::operator_mem_tracker(int32_t plan_node_id) {
         return it->second.get();
     }
     auto mem_tracker = std::make_shared<MemTracker>();
+    if (config::mem_alloc_sample_interval_bytes > 0) {
+        mem_tracker->set_allocation_samples(std::make_shared<AllocationSamples>());
+    }
     _operator_mem_trackers[plan_node_id] = mem_tracker;
     return mem_tracker.get();
 }
@@ -217,6 +228,11 @@ std::shared_ptr<QueryStatistics> QueryContext::intermediate_query_statistic() {
     }
 
     query_statistic->add_cpu_costs(_delta_cpu_cost_ns.exchange(0));
+    {
+        std::lock_guard l(_hardware_counters_lock);
+        query_statistic->add_hardware_counters(_delta_hardware_counters);
+        _delta_hardware_counters = {};
+    }
     query_statistic->add_mem_costs(mem_cost_bytes());
     {
         std::lock_guard l(_scan_stats_lock);
@@ -242,6 +258,7 @@ std::shared_ptr<QueryStatistics> QueryContext::final_query_statistic() {
     DCHECK(_is_final_sink) << "must be final sink";
     auto res = std::make_shared<QueryStatistics>();
     res->add_cpu_costs(cpu_cost());
+    res->add_hardware_counters(hardware_counters());
     res->add_mem_costs(mem_cost_bytes());
     res->add_spill_bytes(get_spill_bytes());
 
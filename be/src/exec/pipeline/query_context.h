@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <mutex>
@@ -27,6 +28,7 @@
 #include "gen_cpp/InternalService_types.h" // for TQueryOptions
 #include "gen_cpp/Types_types.h"           // for TUniqueId
 #include "gen_cpp/internal_service.pb.h"
+#include "io/io_latency_metrics.h"
 #include "runtime/profile_report_worker.h"
 #include "runtime/query_statistics.h"
 #include "runtime/runtime_state.h"
@@ -37,6 +39,7 @@
 
 namespace starrocks {
 
+class IcebergDeleteFileCache;
 class StreamEpochManager;
 
 namespace pipeline {
@@ -183,6 +186,11 @@ public:
         _total_cpu_cost_ns += cost;
         _delta_cpu_cost_ns += cost;
     }
+    void incr_hardware_counters(const PerfEventValues& values) {
+        std::lock_guard l(_hardware_counters_lock);
+        _total_hardware_counters += values;
+        _delta_hardware_counters += values;
+    }
     void incr_cur_scan_rows_num(int64_t rows_num) {
         _total_scan_rows_num += rows_num;
         _delta_scan_rows_num += rows_num;
@@ -246,12 +254,42 @@ public:
     int64_t get_scan_bytes() const { return _total_scan_bytes; }
     std::atomic_int64_t* mutable_total_spill_bytes() { return &_total_spill_bytes; }
     int64_t get_spill_bytes() { return _total_spill_bytes; }
+    PerfEventValues hardware_counters() const {
+        std::lock_guard l(_hardware_counters_lock);
+        return _total_hardware_counters;
+    }
+    // The latencies of the reads of the query, by the source of the reads.
+    IOLatencyHistograms* io_latency_histograms() { return &_io_latency_histograms; }
 
     // Query start time, used to check how long the query has been running
     // To ensure that the minimum run time of the query will not be killed by the big query checking mechanism
     int64_t query_begin_time() const { return _query_begin_time; }
     void init_query_begin_time() { _query_begin_time = MonotonicNanos(); }
 
+    // The latency target of the query from the FE, which starts counting down when the first fragment instance
+    // of the query arrives at this BE. The drivers of the query are scheduled first as it approaches the deadline
+    // or finishes most of its drivers, see QuerySharedDriverQueue::_compute_driver_level.
+    void init_latency_target(int64_t latency_target_ns) {
+        int64_t expected = 0;
+        if (latency_target_ns > 0 &&
+            _latency_deadline_ns.compare_exchange_strong(expected, MonotonicNanos() + latency_target_ns)) {
+            _latency_target_ns = latency_target_ns;
+        }
+    }
+    int64_t latency_target_ns() const { return _latency_target_ns; }
+    int64_t latency_deadline_ns() const { return _latency_deadline_ns; }
+
+    void incr_num_drivers() { _num_drivers.fetch_add(1, std::memory_order_relaxed); }
+    void incr_num_finished_drivers() { _num_finished_drivers.fetch_add(1, std::memory_order_relaxed); }
+    // The ratio of the finished drivers, as an estimate of the progress of the query.
+    double finished_drivers_ratio() const {
+        const size_t num_drivers = _num_drivers.load(std::memory_order_relaxed);
+        if (num_drivers == 0) {
+            return 0;
+        }
+        return std::min(1.0, _num_finished_drivers.load(std::memory_order_relaxed) * 1.0 / num_drivers);
+    }
+
     void set_scan_limit(int64_t scan_limit) { _scan_limit = scan_limit; }
     int64_t get_scan_limit() const { return _scan_limit; }
     void set_query_trace(std::shared_ptr<starrocks::debug::QueryTrace> query_trace);
@@ -260,6 +298,10 @@ public:
 
     std::shared_ptr<starrocks::debug::QueryTrace> shared_query_trace() { return _query_trace; }
 
+    // Records the state transitions of the drivers into DriverTimeline.
+    void set_enable_driver_timeline(bool enable) { _enable_driver_timeline = enable; }
+    bool enable_driver_timeline() const { return _enable_driver_timeline; }
+
     // Delta statistic since last retrieve
     std::shared_ptr<QueryStatistics> intermediate_query_statistic();
     // Merged statistic from all executor nodes
@@ -275,6 +317,12 @@ public:
 
     spill::QuerySpillManager* spill_manager() { return _spill_manager.get(); }
 
+    // The bytes being read ahead through the datacache by all the scans of this query.
+    std::atomic<int64_t>* datacache_readahead_inflight_bytes() { return &_datacache_readahead_inflight_bytes; }
+
+    // The iceberg delete files read by all the scans of this query, null if the cache is disabled.
+    IcebergDeleteFileCache* iceberg_delete_file_cache() { return _iceberg_delete_file_cache.get(); }
+
     void mark_prepared() { _is_prepared = true; }
     bool is_prepared() { return _is_prepared; }
 
@@ -314,11 +362,16 @@ private:
     DescriptorTbl* _desc_tbl = nullptr;
     std::once_flag _query_trace_init_flag;
     std::shared_ptr<starrocks::debug::QueryTrace> _query_trace;
+    std::atomic<bool> _enable_driver_timeline = false;
     std::atomic_bool _is_prepared = false;
     std::atomic_bool _is_cancelled = false;
 
     std::once_flag _init_query_once;
     int64_t _query_begin_time = 0;
+    std::atomic<int64_t> _latency_target_ns = 0;
+    std::atomic<int64_t> _latency_deadline_ns = 0;
+    std::atomic<size_t> _num_drivers = 0;
+    std::atomic<size_t> _num_finished_drivers = 0;
     std::once_flag _init_spill_manager_once;
     std::atomic<int64_t> _total_cpu_cost_ns = 0;
     std::atomic<int64_t> _total_scan_rows_num = 0;
@@ -327,6 +380,11 @@ private:
     std::atomic<int64_t> _delta_cpu_cost_ns = 0;
     std::atomic<int64_t> _delta_scan_rows_num = 0;
     std::atomic<int64_t> _delta_scan_bytes = 0;
+    mutable SpinLock _hardware_counters_lock;
+    PerfEventValues _total_hardware_counters;
+    PerfEventValues _delta_hardware_counters;
+    IOLatencyHistograms _io_latency_histograms;
+    std::atomic<int64_t> _datacache_readahead_inflight_bytes = 0;
 
     struct ScanStats {
         std::atomic<int64_t> total_scan_rows_num = 0;
@@ -365,6 +423,8 @@ private:
 
     std::unique_ptr<spill::QuerySpillManager> _spill_manager;
 
+    std::unique_ptr<IcebergDeleteFileCache> _iceberg_delete_file_cache;
+
     int64_t _static_query_mem_limit = 0;
     ConnectorScanOperatorMemShareArbitrator* _connector_scan_operator_mem_share_arbitrator = nullptr;
 };
@@ -74,6 +74,10 @@ void ResultSinkOperator::close(RuntimeState* state) {
         st = _writer->close();
         _num_written_rows.fetch_add(_writer->get_written_rows(), std::memory_order_relaxed);
     }
+    const auto& result_cache_populator = _fragment_ctx->result_cache_populator();
+    if (result_cache_populator != nullptr && (!_is_finished || !st.ok() || state->is_cancelled())) {
+        result_cache_populator->abandon();
+    }
 
     // Close the shared sender when the last result sink operator is closing.
     if (_num_sinkers.fetch_sub(1, std::memory_order_acq_rel) == 1) {
@@ -92,6 +96,11 @@ void ResultSinkOperator::close(RuntimeState* state) {
                 final_status = st;
             }
             WARN_IF_ERROR(_sender->close(final_status), "close sender failed");
+
+            // All the result sinks have consumed their whole input.
+            if (result_cache_populator != nullptr && final_status.ok()) {
+                result_cache_populator->populate(state->exec_env()->cache_mgr());
+            }
         }
 
         (void)state->exec_env()->result_mgr()->cancel_at_time(
@@ -109,6 +118,9 @@ Status ResultSinkOperator::set_cancelled(RuntimeState* state) {
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
 
     _fetch_data_result.clear();
+    if (_fragment_ctx->result_cache_populator() != nullptr) {
+        _fragment_ctx->result_cache_populator()->abandon();
+    }
     return Status::OK();
 }
 
@@ -146,6 +158,10 @@ Status ResultSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk
     }
     DCHECK(_fetch_data_result.empty());
 
+    if (_fragment_ctx->result_cache_populator() != nullptr) {
+        _fragment_ctx->result_cache_populator()->add_chunk(chunk);
+    }
+
     auto status = _writer->process_chunk(chunk.get());
     if (status.ok()) {
         _fetch_data_result = std::move(status.value());
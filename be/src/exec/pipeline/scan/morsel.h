@@ -88,6 +88,7 @@ public:
     void set_delta_rowsets(std::vector<BaseRowsetSharedPtr>&& delta_rowsets) {
         _delta_rowsets = std::move(delta_rowsets);
     }
+    bool has_delta_rowsets() const { return _delta_rowsets.has_value(); }
     const std::vector<BaseRowsetSharedPtr>& rowsets() const {
         if (_delta_rowsets.has_value()) {
             return _delta_rowsets.value();
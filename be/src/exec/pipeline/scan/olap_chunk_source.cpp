@@ -21,6 +21,7 @@
 #include "column/column.h"
 #include "column/column_access_path.h"
 #include "column/field.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/olap_scan_node.h"
 #include "exec/olap_scan_prepare.h"
@@ -63,6 +64,9 @@ OlapChunkSource::~OlapChunkSource() {
 void OlapChunkSource::close(RuntimeState* state) {
     if (_reader) {
         _update_counter();
+        if (_tablet != nullptr) {
+            _tablet->add_read_heat(_reader->stats().segments_read_count);
+        }
     }
     if (_prj_iter) {
         _prj_iter->close();
@@ -169,6 +173,8 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
             ADD_CHILD_COUNTER(_runtime_profile, "ZoneMapIndexFilterRows", TUnit::UNIT, segment_init_name);
     _vector_index_filtered_counter =
             ADD_CHILD_COUNTER(_runtime_profile, "VectorIndexFilterRows", TUnit::UNIT, segment_init_name);
+    _vector_exact_searched_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "VectorExactSearchRows", TUnit::UNIT, segment_init_name);
     _sk_filtered_counter =
             ADD_CHILD_COUNTER_SKIP_MIN_MAX(_runtime_profile, "ShortKeyFilterRows", TUnit::UNIT,
                                            _get_counter_min_max_type("ShortKeyFilterRows"), segment_init_name);
@@ -219,7 +225,8 @@ void OlapChunkSource::_decide_chunk_size(bool has_predicate) {
         // Improve for select * from table limit x, x is small
         _params.chunk_size = _limit;
     } else {
-        _params.chunk_size = _runtime_state->chunk_size();
+        _params.chunk_size = _scan_op->row_width_estimator().rows_within(_runtime_state->chunk_size(),
+                                                                         config::pipeline_chunk_target_bytes);
     }
 }
 
@@ -541,7 +548,7 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
 }
 
 Status OlapChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
-    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _runtime_state->chunk_size()));
+    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _params.chunk_size));
     auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _tablet->tablet_id());
     return _read_chunk_from_storage(_runtime_state, (*chunk).get());
 }
@@ -630,6 +637,10 @@ void OlapChunkSource::_update_realtime_counter(Chunk* chunk) {
         _runtime_state->update_num_bytes_load_from_source(bytes_usage);
     }
 
+    if (config::pipeline_chunk_target_bytes > 0) {
+        _scan_op->row_width_estimator().update(num_rows, chunk->bytes_usage());
+    }
+
     _chunk_buffer.update_limiter(chunk);
 }
 
@@ -676,6 +687,7 @@ void OlapChunkSource::_update_counter() {
     COUNTER_UPDATE(_seg_rt_filtered_counter, _reader->stats().runtime_stats_filtered);
     COUNTER_UPDATE(_zm_filtered_counter, _reader->stats().rows_stats_filtered);
     COUNTER_UPDATE(_vector_index_filtered_counter, _reader->stats().rows_vector_index_filtered);
+    COUNTER_UPDATE(_vector_exact_searched_counter, _reader->stats().rows_vector_exact_searched);
     COUNTER_UPDATE(_bf_filtered_counter, _reader->stats().rows_bf_filtered);
     COUNTER_UPDATE(_sk_filtered_counter, _reader->stats().rows_key_range_filtered);
     COUNTER_UPDATE(_rows_after_sk_filtered_counter, _reader->stats().rows_after_key_range);
@@ -15,13 +15,16 @@
 #include "exec/pipeline/scan/olap_scan_operator.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/olap_scan_node.h"
+#include "exec/pipeline/pipeline_driver.h"
 #include "exec/pipeline/scan/olap_chunk_source.h"
 #include "exec/pipeline/scan/olap_scan_context.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "storage/storage_engine.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -56,7 +59,10 @@ const std::vector<ExprContext*>& OlapScanOperatorFactory::partition_exprs() cons
 
 OlapScanOperator::OlapScanOperator(OperatorFactory* factory, int32_t id, int32_t driver_sequence, int32_t dop,
                                    ScanNode* scan_node, OlapScanContextPtr ctx)
-        : ScanOperator(factory, id, driver_sequence, dop, scan_node), _ctx(std::move(ctx)) {
+        : ScanOperator(factory, id, driver_sequence, dop, scan_node),
+          _ctx(std::move(ctx)),
+          _adaptive_io_tasks(config::enable_olap_scan_adaptive_io_tasks),
+          _expected_io_tasks(std::min(scan_node->io_tasks_per_scan_operator(), _io_tasks_per_scan_operator)) {
     _ctx->ref();
 }
 
@@ -95,6 +101,12 @@ bool OlapScanOperator::is_finished() const {
 Status OlapScanOperator::do_prepare(RuntimeState*) {
     bool shared_scan = _ctx->is_shared_scan();
     _unique_metrics->add_info_string("SharedScan", shared_scan ? "True" : "False");
+    _unique_metrics->add_info_string("AdaptiveIOTasks", _adaptive_io_tasks ? "True" : "False");
+    if (_adaptive_io_tasks) {
+        _peak_expected_io_tasks_counter = _unique_metrics->AddHighWaterMarkCounter(
+                "PeakExpectedIOTasks", TUnit::UNIT,
+                RuntimeProfile::Counter::create_strategy(TCounterAggregateType::AVG));
+    }
     return Status::OK();
 }
 
@@ -106,6 +118,45 @@ ChunkSourcePtr OlapScanOperator::create_chunk_source(MorselPtr morsel, int32_t c
                                              olap_scan_node, _ctx.get());
 }
 
+// Additive increase and multiplicative decrease of the io tasks, once per olap_scan_io_tasks_adjust_interval_ms:
+// - the chunk buffer is full or the driver is blocked by the downstream, the chunks are produced faster than
+//   consumed, so halve the io tasks;
+// - the chunk buffer is empty while all the io tasks are running and there are still morsels to scan, the
+//   downstream is starved by the scan, so add an io task.
+int OlapScanOperator::available_pickup_morsel_count() {
+    if (!_adaptive_io_tasks) {
+        return _io_tasks_per_scan_operator;
+    }
+    const int64_t now = MonotonicNanos();
+    if (now - _last_adjust_io_tasks_ns < config::olap_scan_io_tasks_adjust_interval_ms * 1000'000L) {
+        return _expected_io_tasks;
+    }
+    _last_adjust_io_tasks_ns = now;
+
+    const int min_io_tasks = std::max(1, std::min(config::olap_scan_io_tasks_min_size, _io_tasks_per_scan_operator));
+    if (is_buffer_full() || _output_full) {
+        _expected_io_tasks = std::max(min_io_tasks, _expected_io_tasks / 2);
+    } else if (num_buffered_chunks() == 0 && _num_running_io_tasks >= _expected_io_tasks && !_morsel_queue->empty()) {
+        _expected_io_tasks = std::min(_io_tasks_per_scan_operator, _expected_io_tasks + 1);
+    }
+    _output_full = false;
+    _peak_expected_io_tasks_counter->set(_expected_io_tasks);
+    return _expected_io_tasks;
+}
+
+bool OlapScanOperator::is_running_all_io_tasks() const {
+    if (!_adaptive_io_tasks) {
+        return ScanOperator::is_running_all_io_tasks();
+    }
+    return _num_running_io_tasks >= _expected_io_tasks;
+}
+
+void OlapScanOperator::end_driver_process(PipelineDriver* driver) {
+    if (_adaptive_io_tasks && driver->driver_state() == DriverState::OUTPUT_FULL) {
+        _output_full = true;
+    }
+}
+
 int64_t OlapScanOperator::get_scan_table_id() const {
     return _ctx->get_scan_table_id();
 }
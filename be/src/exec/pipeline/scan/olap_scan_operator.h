@@ -63,6 +63,10 @@ public:
 
     int64_t get_scan_table_id() const override;
 
+    int available_pickup_morsel_count() override;
+    bool is_running_all_io_tasks() const override;
+    void end_driver_process(PipelineDriver* driver) override;
+
 protected:
     void attach_chunk_source(int32_t source_index) override;
     void detach_chunk_source(int32_t source_index) override;
@@ -79,6 +83,14 @@ protected:
 
 private:
     OlapScanContextPtr _ctx;
+
+    // The io tasks are adjusted at runtime between olap_scan_io_tasks_min_size and _io_tasks_per_scan_operator,
+    // see available_pickup_morsel_count().
+    const bool _adaptive_io_tasks;
+    int _expected_io_tasks;
+    int64_t _last_adjust_io_tasks_ns = 0;
+    bool _output_full = false;
+    RuntimeProfile::HighWaterMarkCounter* _peak_expected_io_tasks_counter = nullptr;
 };
 
 } // namespace pipeline
@@ -25,6 +25,7 @@
 #include "exec/pipeline/scan/connector_scan_operator.h"
 #include "exec/workgroup/scan_executor.h"
 #include "exec/workgroup/work_group.h"
+#include "io/io_latency_metrics.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "util/debug/query_trace.h"
@@ -41,7 +42,7 @@ ScanOperator::ScanOperator(OperatorFactory* factory, int32_t id, int32_t driver_
           _scan_node(scan_node),
           _dop(dop),
           _output_chunk_by_bucket(scan_node->output_chunk_by_bucket()),
-          _io_tasks_per_scan_operator(scan_node->io_tasks_per_scan_operator()),
+          _io_tasks_per_scan_operator(scan_node->max_io_tasks_per_scan_operator()),
           _is_asc(scan_node->is_asc_hint()),
           _chunk_source_profiles(_io_tasks_per_scan_operator),
           _is_io_task_running(_io_tasks_per_scan_operator),
@@ -418,6 +419,9 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
             // set driver_id/query_id/fragment_instance_id to thread local
             // driver_id will be used in some Expr such as regex_replace
             SCOPED_SET_TRACE_INFO(driver_id, state->query_id(), state->fragment_instance_id());
+            SCOPED_SET_WORKGROUP_ID(_workgroup != nullptr ? _workgroup->id() : -1);
+            ScopedIOLatencyContext io_latency_context(sp->io_latency_histograms(),
+                                                      _workgroup != nullptr ? _workgroup->id() : -1);
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
             SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(this);
 
@@ -529,12 +533,7 @@ Status ScanOperator::_pickup_morsel(RuntimeState* state, int chunk_source_index)
                     // We must reset rowsets of Morsel to captured delta rowsets, because TabletReader now
                     // created from rowsets passed in to itself instead of capturing it from TabletManager again.
                     morsel->set_from_version(delta_version);
-
-                    std::vector<BaseRowsetSharedPtr> drs;
-                    for (auto& rs : delta_rowsets) {
-                        drs.emplace_back(rs);
-                    }
-                    morsel->set_delta_rowsets(std::move(drs));
+                    morsel->set_delta_rowsets(std::move(delta_rowsets));
                     break;
                 } else {
                     ASSIGN_OR_RETURN(morsel, _morsel_queue->try_get());
@@ -548,11 +547,7 @@ Status ScanOperator::_pickup_morsel(RuntimeState* state, int chunk_source_index)
                 auto [delta_verrsion, delta_rowsets] = _cache_operator->delta_version_and_rowsets(lane_owner);
                 if (!delta_rowsets.empty()) {
                     morsel->set_from_version(delta_verrsion);
-                    std::vector<BaseRowsetSharedPtr> drs;
-                    for (auto& rs : delta_rowsets) {
-                        drs.emplace_back(rs);
-                    }
-                    morsel->set_delta_rowsets(std::move(drs));
+                    morsel->set_delta_rowsets(std::move(delta_rowsets));
                 }
                 break;
             }
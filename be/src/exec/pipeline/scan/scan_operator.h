@@ -19,6 +19,7 @@
 #include "exec/query_cache/cache_operator.h"
 #include "exec/query_cache/lane_arbiter.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "storage/chunk_helper.h"
 #include "util/spinlock.h"
 
 namespace starrocks {
@@ -72,6 +73,10 @@ public:
     virtual void do_close(RuntimeState* state) = 0;
     virtual ChunkSourcePtr create_chunk_source(MorselPtr morsel, int32_t chunk_source_index) = 0;
 
+    // The width of the rows read by the chunk sources, which decides the chunk size of the next chunk sources under
+    // config::pipeline_chunk_target_bytes.
+    ChunkRowWidthEstimator& row_width_estimator() { return _row_width_estimator; }
+
     int64_t get_last_scan_rows_num() { return _last_scan_rows_num.exchange(0); }
     int64_t get_last_scan_bytes() { return _last_scan_bytes.exchange(0); }
 
@@ -167,6 +172,7 @@ protected:
 
     std::atomic_int64_t _last_scan_rows_num = 0;
     std::atomic_int64_t _last_scan_bytes = 0;
+    ChunkRowWidthEstimator _row_width_estimator;
 
     // The number of morsels picked up by this scan operator.
     // A tablet may be divided into multiple morsels.
@@ -17,6 +17,7 @@
 #include "column/chunk.h"
 #include "exprs/expr.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 
 namespace starrocks::pipeline {
 Status SelectOperator::prepare(RuntimeState* state) {
@@ -25,6 +26,7 @@ Status SelectOperator::prepare(RuntimeState* state) {
 
 void SelectOperator::close(RuntimeState* state) {
     _curr_chunk.reset();
+    _curr_filter.reset();
     _pre_output_chunk.reset();
     Operator::close(state);
 }
@@ -40,7 +42,8 @@ StatusOr<ChunkPtr> SelectOperator::pull_chunk(RuntimeState* state) {
      *      merge it into _pre_output_chunk.
      */
     if (!_pre_output_chunk) {
-        auto cur_size = _curr_chunk->num_rows();
+        auto cur_size = _curr_num_rows();
+        _materialize_curr_chunk();
         if (cur_size >= chunk_size / 2) {
             return std::move(_curr_chunk);
         } else {
@@ -58,11 +61,23 @@ StatusOr<ChunkPtr> SelectOperator::pull_chunk(RuntimeState* state) {
              *  else
              *      merge input chunk into _pre_output_chunk.
              */
-            auto cur_size = _curr_chunk->num_rows();
+            auto cur_size = _curr_num_rows();
             if (cur_size + _pre_output_chunk->num_rows() > chunk_size) {
                 auto output_chunk = _pre_output_chunk;
+                _materialize_curr_chunk();
                 _pre_output_chunk = std::move(_curr_chunk);
                 return output_chunk;
+            } else if (_curr_filter != nullptr) {
+                // copy the selected rows of the new read chunk to the reserved, without compacting it first
+                _selection.clear();
+                for (uint32_t i = 0; i < _curr_filter->size(); i++) {
+                    if ((*_curr_filter)[i]) {
+                        _selection.push_back(i);
+                    }
+                }
+                _pre_output_chunk->append_selective(*_curr_chunk, _selection.data(), 0, _selection.size());
+                _curr_chunk = nullptr;
+                _curr_filter.reset();
             } else {
                 Columns& dest_columns = _pre_output_chunk->columns();
                 Columns& src_columns = _curr_chunk->columns();
@@ -85,13 +100,40 @@ bool SelectOperator::need_input() const {
 }
 
 Status SelectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
-    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+    // The chunks with few columns are pruned eagerly between the conjuncts.
+    if (chunk->num_columns() <= kEagerFilterMaxColumns) {
+        RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+        _curr_chunk = chunk;
+        return Status::OK();
+    }
+
+    // Otherwise the filter is kept aside and applied lazily: a chunk which is going to be merged into
+    // _pre_output_chunk has its selected rows copied there directly, instead of being compacted first.
+    FilterPtr filter;
+    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get(), &filter, false));
     _curr_chunk = chunk;
+    _curr_filter.reset();
+    if (filter != nullptr) {
+        _curr_selected_rows = SIMD::count_nonzero(*filter);
+        if (_curr_selected_rows == 0) {
+            _curr_chunk->set_num_rows(0);
+        } else if (_curr_selected_rows < filter->size()) {
+            _curr_filter = std::move(filter);
+        }
+    }
     return Status::OK();
 }
 
+void SelectOperator::_materialize_curr_chunk() {
+    if (_curr_filter != nullptr) {
+        _curr_chunk->filter(*_curr_filter);
+        _curr_filter.reset();
+    }
+}
+
 Status SelectOperator::reset_state(starrocks::RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) {
     _curr_chunk.reset();
+    _curr_filter.reset();
     _pre_output_chunk.reset();
     _is_finished = false;
     return Status::OK();
@@ -47,8 +47,19 @@ public:
     Status reset_state(starrocks::RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) override;
 
 private:
+    // Same threshold as the eager prune of ExecNode::eval_conjuncts.
+    static constexpr size_t kEagerFilterMaxColumns = 5;
+
+    size_t _curr_num_rows() const { return _curr_filter != nullptr ? _curr_selected_rows : _curr_chunk->num_rows(); }
+    // Apply _curr_filter to _curr_chunk.
+    void _materialize_curr_chunk();
+
     // _curr_chunk used to receive input chunks, and apply predicate filtering.
     ChunkPtr _curr_chunk = nullptr;
+    // The filter of _curr_chunk which has not been applied yet, null if all the rows of _curr_chunk are selected.
+    FilterPtr _curr_filter = nullptr;
+    size_t _curr_selected_rows = 0;
+    Buffer<uint32_t> _selection;
     // _pre_output_chunk used to merge small _curr_chunk until it's big enough, then return as output.
     ChunkPtr _pre_output_chunk = nullptr;
 
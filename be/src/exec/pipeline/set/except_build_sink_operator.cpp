@@ -14,6 +14,8 @@
 
 #include "exec/pipeline/set/except_build_sink_operator.h"
 
+#include "exec/spill/spiller.hpp"
+
 namespace starrocks::pipeline {
 
 StatusOr<ChunkPtr> ExceptBuildSinkOperator::pull_chunk(RuntimeState* state) {
@@ -21,14 +23,40 @@ StatusOr<ChunkPtr> ExceptBuildSinkOperator::pull_chunk(RuntimeState* state) {
 }
 
 Status ExceptBuildSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_spiller != nullptr) {
+        return _except_ctx->spill_chunk(state, _spiller, chunk, _dst_exprs);
+    }
     return _except_ctx->append_chunk_to_ht(state, chunk, _dst_exprs, _buffer_state.get());
 }
 
+Status ExceptBuildSinkOperator::set_finishing(RuntimeState* state) {
+    ONCE_DETECT(_set_finishing_once);
+    if (_spiller == nullptr || !_spiller->spilled()) {
+        _is_finished = true;
+        _except_ctx->finish_build_ht();
+        return Status::OK();
+    }
+
+    RETURN_IF_ERROR(_spiller->flush(state, TRACKER_WITH_SPILLER_GUARD(state, _spiller)));
+    return _spiller->set_flush_all_call_back(
+            [this]() {
+                _except_ctx->finish_build_ht();
+                _is_finished = true;
+                return Status::OK();
+            },
+            state, TRACKER_WITH_SPILLER_GUARD(state, _spiller));
+}
+
 Status ExceptBuildSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
 
     RETURN_IF_ERROR(_except_ctx->prepare(state, _dst_exprs));
     RETURN_IF_ERROR(_buffer_state->init(state));
+    if (_spiller != nullptr) {
+        _spiller->set_metrics(spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes()));
+        RETURN_IF_ERROR(_spiller->prepare(state));
+        _except_ctx->set_build_spiller(_spiller);
+    }
 
     return Status::OK();
 }
@@ -44,6 +72,9 @@ Status ExceptBuildSinkOperatorFactory::prepare(RuntimeState* state) {
 
     RETURN_IF_ERROR(Expr::prepare(_dst_exprs, state));
     RETURN_IF_ERROR(Expr::open(_dst_exprs, state));
+    if (_except_partition_ctx_factory->enable_spill()) {
+        _spill_options = ExceptContext::create_spill_options(state, _plan_node_id, "except-build");
+    }
 
     return Status::OK();
 }
@@ -16,6 +16,7 @@
 
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/set/except_context.h"
+#include "exec/spill/spiller_factory.h"
 #include "util/race_detect.h"
 
 namespace starrocks::pipeline {
@@ -36,29 +37,29 @@ namespace starrocks::pipeline {
 // The rows are shuffled to degree of parallelism (DOP) partitions by local shuffle exchange.
 // For each partition, there are a ExceptBuildSinkOperator driver, a ExceptProbeSinkOperator driver
 // for each child, and a ExceptOutputSourceOperator.
+//
+// With the spill enabled, ExceptBuildSinkOperator and ExceptProbeSinkOperator spill the keys of their input rows
+// by `spiller`, and the build or probe is finished once all the keys have been flushed.
 class ExceptBuildSinkOperator final : public Operator {
 public:
     ExceptBuildSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, int32_t driver_sequence,
-                            std::shared_ptr<ExceptContext> except_ctx, const std::vector<ExprContext*>& dst_exprs)
+                            std::shared_ptr<ExceptContext> except_ctx, const std::vector<ExprContext*>& dst_exprs,
+                            std::shared_ptr<spill::Spiller> spiller)
             : Operator(factory, id, "except_build_sink", plan_node_id, false, driver_sequence),
               _except_ctx(std::move(except_ctx)),
               _buffer_state(std::make_unique<ExceptBufferState>()),
-              _dst_exprs(dst_exprs) {
+              _dst_exprs(dst_exprs),
+              _spiller(std::move(spiller)) {
         _except_ctx->ref();
     }
 
-    bool need_input() const override { return !is_finished(); }
+    bool need_input() const override { return !is_finished() && !(_spiller != nullptr && _spiller->is_full()); }
 
     bool has_output() const override { return false; }
 
     bool is_finished() const override { return _is_finished || _except_ctx->is_finished(); }
 
-    Status set_finishing(RuntimeState* state) override {
-        ONCE_DETECT(_set_finishing_once);
-        _is_finished = true;
-        _except_ctx->finish_build_ht();
-        return Status::OK();
-    }
+    Status set_finishing(RuntimeState* state) override;
 
     Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
@@ -73,7 +74,11 @@ private:
 
     const std::vector<ExprContext*>& _dst_exprs;
 
-    bool _is_finished = false;
+    // Set if the spill is enabled.
+    std::shared_ptr<spill::Spiller> _spiller;
+
+    // Set by the flush callback of the spiller in an IO thread if any key is spilled.
+    std::atomic<bool> _is_finished{false};
     DECLARE_ONCE_DETECTOR(_set_finishing_once);
 };
 
@@ -87,9 +92,13 @@ public:
               _dst_exprs(dst_exprs) {}
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        std::shared_ptr<spill::Spiller> spiller;
+        if (_except_partition_ctx_factory->enable_spill()) {
+            spiller = _spill_factory->create(*_spill_options);
+        }
         return std::make_shared<ExceptBuildSinkOperator>(this, _id, _plan_node_id, driver_sequence,
                                                          _except_partition_ctx_factory->get_or_create(driver_sequence),
-                                                         _dst_exprs);
+                                                         _dst_exprs, std::move(spiller));
     }
 
     Status prepare(RuntimeState* state) override;
@@ -100,6 +109,9 @@ private:
     ExceptPartitionContextFactoryPtr _except_partition_ctx_factory;
 
     const std::vector<ExprContext*>& _dst_exprs;
+
+    std::shared_ptr<spill::SpilledOptions> _spill_options;
+    std::shared_ptr<spill::SpillerFactory> _spill_factory = std::make_shared<spill::SpillerFactory>();
 };
 
 } // namespace starrocks::pipeline
@@ -14,7 +14,19 @@
 
 #include "exec/pipeline/set/except_context.h"
 
+#include <algorithm>
+#include <iterator>
+
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/spill/executor.h"
+#include "exec/spill/input_stream.h"
+#include "exec/spill/query_spill_manager.h"
+#include "exec/spill/spiller.hpp"
 #include "runtime/current_thread.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks::pipeline {
 
@@ -38,6 +50,11 @@ void ExceptContext::close(RuntimeState* state) {
     if (_build_pool != nullptr) {
         _build_pool->free_all();
     }
+    _spill_reader.reset();
+    _spill_buffer_state.reset();
+    _build_spiller.reset();
+    _probe_spillers.clear();
+    _restore_spiller.reset();
 }
 
 void ExceptContext::incr_prober(size_t factory_idx) {
@@ -70,7 +87,196 @@ Status ExceptContext::erase_chunk_from_ht(RuntimeState* state, const ChunkPtr& c
     return _hash_set->erase_duplicate_row(state, chunk, dst_exprs, buffer_state);
 }
 
+bool ExceptContext::has_output() const {
+    if (!_enable_spill) {
+        return !is_output_finished();
+    }
+    if (_is_spill_output_finished) {
+        return false;
+    }
+    if (!_is_spill_output_started || _spill_phase == SpillPhase::OUTPUT) {
+        return true;
+    }
+    RETURN_TRUE_IF_SPILL_TASK_ERROR(_restore_spiller);
+    return _spill_reader->has_output_data();
+}
+
+std::shared_ptr<spill::SpilledOptions> ExceptContext::create_spill_options(RuntimeState* state, int32_t plan_node_id,
+                                                                           const std::string& name) {
+    auto spill_options = std::make_shared<spill::SpilledOptions>();
+    spill_options->spill_mem_table_bytes_size = state->spill_mem_table_size();
+    spill_options->mem_table_pool_size = state->spill_mem_table_num();
+    spill_options->spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+    spill_options->min_spilled_size = state->spill_operator_min_bytes();
+    spill_options->block_manager = state->query_ctx()->spill_manager()->block_manager();
+    spill_options->name = name;
+    spill_options->plan_node_id = plan_node_id;
+    // The spilled keys are restored once for each pass.
+    spill_options->read_shared = true;
+    spill_options->encode_level = state->spill_encode_level();
+    spill_options->wg = state->fragment_ctx()->workgroup();
+    spill_options->enable_buffer_read = state->enable_spill_buffer_read();
+    spill_options->max_read_buffer_bytes = state->max_spill_read_buffer_bytes_per_driver();
+    return spill_options;
+}
+
+void ExceptContext::add_probe_spiller(std::shared_ptr<spill::Spiller> spiller) {
+    std::lock_guard guard(_probe_spillers_mutex);
+    _probe_spillers.emplace_back(std::move(spiller));
+}
+
+Status ExceptContext::spill_chunk(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller,
+                                  const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs) {
+    if (chunk == nullptr || chunk->is_empty()) {
+        return Status::OK();
+    }
+
+    // The key columns are always nullable and non-constant, so that all the spilled chunks have the same schema,
+    // which doesn't change the serialized keys since they are always nullable.
+    const size_t num_rows = chunk->num_rows();
+    auto key_chunk = std::make_shared<Chunk>();
+    for (size_t i = 0; i < exprs.size(); i++) {
+        ASSIGN_OR_RETURN(ColumnPtr key_column, exprs[i]->evaluate(chunk.get()));
+        key_column = ColumnHelper::unpack_and_duplicate_const_column(num_rows, key_column);
+        key_chunk->append_column(NullableColumn::wrap_if_necessary(key_column), static_cast<SlotId>(i));
+    }
+
+    if (spiller == _build_spiller) {
+        _spilled_build_bytes += key_chunk->memory_usage();
+    }
+    return spiller->spill(state, key_chunk, TRACKER_WITH_SPILLER_GUARD(state, spiller));
+}
+
 StatusOr<ChunkPtr> ExceptContext::pull_chunk(RuntimeState* state) {
+    if (_enable_spill) {
+        return _pull_spilled_chunk(state);
+    }
+    return _pull_hash_set_chunk(state);
+}
+
+StatusOr<ChunkPtr> ExceptContext::_pull_spilled_chunk(RuntimeState* state) {
+    if (!_is_spill_output_started) {
+        _is_spill_output_started = true;
+        _spill_buffer_state = std::make_unique<ExceptBufferState>();
+        RETURN_IF_ERROR(_spill_buffer_state->init(state));
+        const auto pass_bytes = static_cast<size_t>(std::max<int64_t>(1, config::except_spill_pass_bytes));
+        _num_spill_passes = std::max<size_t>(1, (_spilled_build_bytes + pass_bytes - 1) / pass_bytes);
+        _spill_pass = 0;
+        RETURN_IF_ERROR(_start_spill_pass(state));
+        return nullptr;
+    }
+    RETURN_IF_ERROR(_restore_spiller->task_status());
+
+    if (_spill_phase != SpillPhase::OUTPUT) {
+        auto chunk_st = _spill_reader->restore(state, RESOURCE_TLS_MEMTRACER_GUARD(state, std::weak_ptr(_spill_reader)));
+        if (chunk_st.ok()) {
+            RETURN_IF_ERROR(_process_spilled_keys(state, chunk_st.value()));
+            return nullptr;
+        }
+        if (!chunk_st.status().is_end_of_file()) {
+            return chunk_st.status();
+        }
+
+        // The probe phase is skipped if no key is built or probed in this pass.
+        std::vector<std::shared_ptr<spill::Spiller>> probe_spillers;
+        if (_spill_phase == SpillPhase::BUILD && !_hash_set->empty()) {
+            std::lock_guard guard(_probe_spillers_mutex);
+            std::copy_if(_probe_spillers.begin(), _probe_spillers.end(), std::back_inserter(probe_spillers),
+                         [](const auto& spiller) { return spiller->spilled(); });
+        }
+        if (!probe_spillers.empty()) {
+            _spill_phase = SpillPhase::PROBE;
+            RETURN_IF_ERROR(_restore_spilled_keys(state, probe_spillers));
+        } else {
+            _spill_phase = SpillPhase::OUTPUT;
+            _spill_reader.reset();
+            _next_processed_iter = _hash_set->begin();
+            _hash_set_end_iter = _hash_set->end();
+        }
+        return nullptr;
+    }
+
+    if (_next_processed_iter != _hash_set_end_iter) {
+        return _pull_hash_set_chunk(state);
+    }
+    // The pass is finished, release its hash set before the next one.
+    _hash_set = std::make_unique<ExceptHashSerializeSet>();
+    RETURN_IF_ERROR(_hash_set->init(state));
+    _build_pool->free_all();
+    if (++_spill_pass == _num_spill_passes) {
+        _is_spill_output_finished = true;
+        return nullptr;
+    }
+    RETURN_IF_ERROR(_start_spill_pass(state));
+    return nullptr;
+}
+
+Status ExceptContext::_start_spill_pass(RuntimeState* state) {
+    _spill_phase = SpillPhase::BUILD;
+    return _restore_spilled_keys(state, {_build_spiller});
+}
+
+Status ExceptContext::_restore_spilled_keys(RuntimeState* state,
+                                            const std::vector<std::shared_ptr<spill::Spiller>>& spillers) {
+    std::vector<spill::InputStreamPtr> streams;
+    for (const auto& spiller : spillers) {
+        spill::InputStreamPtr stream;
+        RETURN_IF_ERROR(spiller->writer()->acquire_stream(&stream));
+        streams.emplace_back(std::move(stream));
+    }
+    _spill_reader = std::make_shared<spill::SpillerReader>(_restore_spiller.get());
+    _spill_reader->set_stream(spill::SpillInputStream::union_all(streams));
+    return _spill_reader->trigger_restore(state, RESOURCE_TLS_MEMTRACER_GUARD(state, std::weak_ptr(_spill_reader)));
+}
+
+Status ExceptContext::_process_spilled_keys(RuntimeState* state, const ChunkPtr& chunk) {
+    if (chunk == nullptr || chunk->is_empty()) {
+        return Status::OK();
+    }
+
+    ChunkPtr keys = chunk;
+    if (_num_spill_passes > 1) {
+        // The rows are shuffled to the drivers by the FNV hash of the same keys, so the passes are assigned by the
+        // mixed hash to be independent of the shuffle.
+        const size_t num_rows = keys->num_rows();
+        std::vector<uint32_t> hash_values(num_rows, HashUtil::FNV_SEED);
+        for (const auto& column : keys->columns()) {
+            column->fnv_hash(hash_values.data(), 0, num_rows);
+        }
+        Filter selection(num_rows);
+        for (size_t i = 0; i < num_rows; i++) {
+            selection[i] = HashUtil::fmix32(hash_values[i]) % _num_spill_passes == _spill_pass;
+        }
+        keys = keys->clone_unique();
+        keys->filter(selection);
+    }
+
+    // The hash set serializes at most *state->chunk_size()* keys at a time.
+    const size_t chunk_size = state->chunk_size();
+    for (size_t offset = 0; offset < keys->num_rows(); offset += chunk_size) {
+        const size_t count = std::min(chunk_size, keys->num_rows() - offset);
+        Columns key_columns;
+        if (offset == 0 && count == keys->num_rows()) {
+            key_columns = keys->columns();
+        } else {
+            for (const auto& column : keys->columns()) {
+                auto key_column = column->clone_empty();
+                key_column->append(*column, offset, count);
+                key_columns.emplace_back(std::move(key_column));
+            }
+        }
+
+        if (_spill_phase == SpillPhase::BUILD) {
+            TRY_CATCH_BAD_ALLOC(_hash_set->build_set(state, key_columns, count, _build_pool.get(),
+                                                     _spill_buffer_state.get()));
+        } else {
+            RETURN_IF_ERROR(_hash_set->erase_duplicate_row(state, key_columns, count, _spill_buffer_state.get()));
+        }
+    }
+    return Status::OK();
+}
+
+StatusOr<ChunkPtr> ExceptContext::_pull_hash_set_chunk(RuntimeState* state) {
     // 1. Get at most *state->chunk_size()* remained keys from ht.
     size_t num_remained_keys = 0;
     _remained_keys.resize(state->chunk_size());
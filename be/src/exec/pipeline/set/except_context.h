@@ -22,6 +22,8 @@
 #include "exec/except_hash_set.h"
 #include "exec/olap_common.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/spill/options.h"
+#include "exec/spill/spiller.h"
 #include "exprs/expr_context.h"
 #include "gutil/casts.h"
 #include "runtime/mem_pool.h"
@@ -38,18 +40,28 @@ class ExceptPartitionContextFactory;
 using ExceptPartitionContextFactoryPtr = std::shared_ptr<ExceptPartitionContextFactory>;
 
 // Used as the shared context for ExceptBuildSinkOperator, ExceptProbeSinkOperator, and ExceptOutputSourceOperator.
+//
+// With the spill enabled, the BUILD and PROBE operators spill the evaluated keys of all their input rows instead, and
+// the OUTPUT operator rebuilds the hash set from the spilled build keys and erases the spilled probe keys from it in
+// passes, each of which restores the keys of one hash partition of the spilled keys.
 class ExceptContext final : public ContextWithDependency {
 public:
-    explicit ExceptContext(const int dst_tuple_id, const size_t num_probe_factories)
+    explicit ExceptContext(const int dst_tuple_id, const size_t num_probe_factories, const bool enable_spill)
             : _dst_tuple_id(dst_tuple_id),
               _num_probers_per_factory(num_probe_factories),
-              _num_finished_probers_per_factory(num_probe_factories) {}
+              _num_finished_probers_per_factory(num_probe_factories),
+              _enable_spill(enable_spill) {}
     ~ExceptContext() override = default;
 
     bool is_ht_empty() const { return _is_hash_set_empty; }
 
     void finish_build_ht() {
-        _is_hash_set_empty = _hash_set->empty();
+        if (_enable_spill) {
+            _is_hash_set_empty = _build_spiller == nullptr || !_build_spiller->spilled();
+            _is_spill_output_finished = _is_hash_set_empty;
+        } else {
+            _is_hash_set_empty = _hash_set->empty();
+        }
         _next_processed_iter = _hash_set->begin();
         _hash_set_end_iter = _hash_set->end();
         _is_build_finished = true;
@@ -59,7 +71,24 @@ public:
 
     bool is_build_finished() const;
     bool is_probe_finished() const;
-    bool is_output_finished() const { return _next_processed_iter == _hash_set_end_iter; }
+    bool is_output_finished() const {
+        return _enable_spill ? _is_spill_output_finished.load() : _next_processed_iter == _hash_set_end_iter;
+    }
+    // Whether the OUTPUT operator can pull a chunk after the probe phase is finished.
+    bool has_output() const;
+
+    bool enable_spill() const { return _enable_spill; }
+    // The options of the spillers of the BUILD and PROBE operators.
+    static std::shared_ptr<spill::SpilledOptions> create_spill_options(RuntimeState* state, int32_t plan_node_id,
+                                                                       const std::string& name);
+    // Called in the preparation phase of the BUILD, PROBE, and OUTPUT operators respectively. The spiller of the
+    // OUTPUT operator only reads the spilled keys.
+    void set_build_spiller(std::shared_ptr<spill::Spiller> spiller) { _build_spiller = std::move(spiller); }
+    void add_probe_spiller(std::shared_ptr<spill::Spiller> spiller);
+    void set_restore_spiller(std::shared_ptr<spill::Spiller> spiller) { _restore_spiller = std::move(spiller); }
+    // Spills the keys of the chunk evaluated by `exprs` to `spiller`, which is either the build spiller or a probe one.
+    Status spill_chunk(RuntimeState* state, const std::shared_ptr<spill::Spiller>& spiller, const ChunkPtr& chunk,
+                       const std::vector<ExprContext*>& exprs);
 
     // Called in the preparation phase of ExceptBuildSinkOperator.
     Status prepare(RuntimeState* state, const std::vector<ExprContext*>& build_exprs);
@@ -74,6 +103,17 @@ public:
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state);
 
 private:
+    enum class SpillPhase { BUILD, PROBE, OUTPUT };
+
+    StatusOr<ChunkPtr> _pull_hash_set_chunk(RuntimeState* state);
+
+    StatusOr<ChunkPtr> _pull_spilled_chunk(RuntimeState* state);
+    Status _start_spill_pass(RuntimeState* state);
+    // Restores the keys spilled by `spillers`, which have all spilled some keys, from the beginning.
+    Status _restore_spilled_keys(RuntimeState* state, const std::vector<std::shared_ptr<spill::Spiller>>& spillers);
+    // Adds the keys of the restored chunk of the current pass to the hash set, or erases them from it.
+    Status _process_spilled_keys(RuntimeState* state, const ChunkPtr& chunk);
+
     std::unique_ptr<ExceptHashSerializeSet> _hash_set = std::make_unique<ExceptHashSerializeSet>();
 
     const int _dst_tuple_id;
@@ -103,6 +143,21 @@ private:
     std::vector<int64_t> _num_probers_per_factory;
     std::vector<std::atomic<int64_t>> _num_finished_probers_per_factory;
     std::atomic<bool> _is_build_finished{false};
+
+    const bool _enable_spill;
+    std::shared_ptr<spill::Spiller> _build_spiller;
+    // The bytes of the keys spilled by _build_spiller.
+    size_t _spilled_build_bytes = 0;
+    std::mutex _probe_spillers_mutex;
+    std::vector<std::shared_ptr<spill::Spiller>> _probe_spillers;
+    std::shared_ptr<spill::Spiller> _restore_spiller;
+    std::shared_ptr<spill::SpillerReader> _spill_reader;
+    std::unique_ptr<ExceptBufferState> _spill_buffer_state;
+    bool _is_spill_output_started = false;
+    std::atomic<bool> _is_spill_output_finished{false};
+    SpillPhase _spill_phase = SpillPhase::BUILD;
+    size_t _num_spill_passes = 1;
+    size_t _spill_pass = 0;
 };
 
 // The input chunks of BUILD and PROBE are shuffled by the local shuffle operator.
@@ -111,8 +166,9 @@ private:
 // are both DOP. And each pair of BUILD/PROBE/OUTPUT drivers shares a same except partition context.
 class ExceptPartitionContextFactory {
 public:
-    explicit ExceptPartitionContextFactory(const size_t dst_tuple_id, const size_t num_probe_factories)
-            : _dst_tuple_id(dst_tuple_id), _num_probe_factories(num_probe_factories) {}
+    explicit ExceptPartitionContextFactory(const size_t dst_tuple_id, const size_t num_probe_factories,
+                                           const bool enable_spill)
+            : _dst_tuple_id(dst_tuple_id), _num_probe_factories(num_probe_factories), _enable_spill(enable_spill) {}
 
     ExceptContextPtr get_or_create(const int partition_id) {
         auto it = _partition_id2ctx.find(partition_id);
@@ -120,16 +176,19 @@ public:
             return it->second;
         }
 
-        auto ctx = std::make_shared<ExceptContext>(_dst_tuple_id, _num_probe_factories);
+        auto ctx = std::make_shared<ExceptContext>(_dst_tuple_id, _num_probe_factories, _enable_spill);
         _partition_id2ctx[partition_id] = ctx;
         return ctx;
     }
 
     ExceptContextPtr get(const int partition_id);
 
+    bool enable_spill() const { return _enable_spill; }
+
 private:
     const size_t _dst_tuple_id;
     const size_t _num_probe_factories;
+    const bool _enable_spill;
     std::unordered_map<size_t, ExceptContextPtr> _partition_id2ctx;
 };
 
@@ -14,8 +14,24 @@
 
 #include "exec/pipeline/set/except_output_source_operator.h"
 
+#include "exec/pipeline/fragment_context.h"
+#include "exec/spill/options.h"
+
 namespace starrocks::pipeline {
 
+Status ExceptOutputSourceOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(SourceOperator::prepare(state));
+    if (_except_ctx->enable_spill()) {
+        _spill_factory = std::make_shared<spill::SpillerFactory>();
+        spill::SpilledOptions opts;
+        opts.wg = state->fragment_ctx()->workgroup();
+        auto spiller = _spill_factory->create(opts);
+        spiller->set_metrics(spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes()));
+        _except_ctx->set_restore_spiller(std::move(spiller));
+    }
+    return Status::OK();
+}
+
 StatusOr<ChunkPtr> ExceptOutputSourceOperator::pull_chunk(RuntimeState* state) {
     return _except_ctx->pull_chunk(state);
 }
@@ -17,6 +17,7 @@
 #include "exec/pipeline/operator.h"
 #include "exec/pipeline/set/except_context.h"
 #include "exec/pipeline/source_operator.h"
+#include "exec/spill/spiller_factory.h"
 
 namespace starrocks::pipeline {
 
@@ -31,18 +32,23 @@ public:
         _except_ctx->ref();
     }
 
-    bool has_output() const override { return _except_ctx->is_probe_finished() && !_except_ctx->is_output_finished(); }
+    bool has_output() const override { return _except_ctx->is_probe_finished() && _except_ctx->has_output(); }
 
     bool is_finished() const override { return _except_ctx->is_probe_finished() && _except_ctx->is_output_finished(); }
 
     Status set_finished(RuntimeState* state) override { return _except_ctx->set_finished(); }
 
+    Status prepare(RuntimeState* state) override;
+
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
 
     void close(RuntimeState* state) override;
 
 private:
     std::shared_ptr<ExceptContext> _except_ctx;
+
+    // Used to restore the spilled keys if the spill is enabled.
+    std::shared_ptr<spill::SpillerFactory> _spill_factory;
 };
 
 class ExceptOutputSourceOperatorFactory final : public SourceOperatorFactory {
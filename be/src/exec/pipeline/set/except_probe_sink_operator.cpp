@@ -14,15 +14,39 @@
 
 #include "exec/pipeline/set/except_probe_sink_operator.h"
 
+#include "exec/spill/spiller.hpp"
+
 namespace starrocks::pipeline {
 
 Status ExceptProbeSinkOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     _except_ctx->incr_prober(_dependency_index);
     RETURN_IF_ERROR(_buffer_state->init(state));
+    if (_spiller != nullptr) {
+        _spiller->set_metrics(spill::SpillProcessMetrics(_unique_metrics.get(), state->mutable_total_spill_bytes()));
+        RETURN_IF_ERROR(_spiller->prepare(state));
+        _except_ctx->add_probe_spiller(_spiller);
+    }
     return Status::OK();
 }
 
+Status ExceptProbeSinkOperator::set_finishing(RuntimeState* state) {
+    if (_spiller == nullptr || !_spiller->spilled()) {
+        _is_finished = true;
+        _except_ctx->finish_probe_ht(_dependency_index);
+        return Status::OK();
+    }
+
+    RETURN_IF_ERROR(_spiller->flush(state, TRACKER_WITH_SPILLER_GUARD(state, _spiller)));
+    return _spiller->set_flush_all_call_back(
+            [this]() {
+                _except_ctx->finish_probe_ht(_dependency_index);
+                _is_finished = true;
+                return Status::OK();
+            },
+            state, TRACKER_WITH_SPILLER_GUARD(state, _spiller));
+}
+
 void ExceptProbeSinkOperator::close(RuntimeState* state) {
     _buffer_state.reset();
     _except_ctx->unref(state);
@@ -34,6 +58,9 @@ StatusOr<ChunkPtr> ExceptProbeSinkOperator::pull_chunk(RuntimeState* state) {
 }
 
 Status ExceptProbeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
+    if (_spiller != nullptr) {
+        return _except_ctx->spill_chunk(state, _spiller, chunk, _dst_exprs);
+    }
     return _except_ctx->erase_chunk_from_ht(state, chunk, _dst_exprs, _buffer_state.get());
 }
 
@@ -42,6 +69,9 @@ Status ExceptProbeSinkOperatorFactory::prepare(RuntimeState* state) {
 
     RETURN_IF_ERROR(Expr::prepare(_dst_exprs, state));
     RETURN_IF_ERROR(Expr::open(_dst_exprs, state));
+    if (_except_partition_ctx_factory->enable_spill()) {
+        _spill_options = ExceptContext::create_spill_options(state, _plan_node_id, "except-probe");
+    }
 
     return Status::OK();
 }
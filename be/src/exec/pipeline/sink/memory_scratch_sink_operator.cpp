@@ -126,6 +126,7 @@ Status MemoryScratchSinkOperatorFactory::prepare(RuntimeState* state) {
 
     TUniqueId fragment_instance_id = state->fragment_instance_id();
     state->exec_env()->result_queue_mgr()->create_queue(fragment_instance_id, &_queue);
+    _queue->set_schema(_arrow_schema);
     return Status::OK();
 }
 
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <sstream>
 
+#include "common/config.h"
 #include "exprs/expr.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
@@ -70,6 +71,39 @@ Status LocalParallelMergeSortSourceOperator::set_finished(RuntimeState* state) {
     return _sort_context->set_finished();
 }
 
+Status LocalRangeMergeSortSourceOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(Operator::prepare(state));
+    _sort_context->ref();
+    _merger->bind_profile(_driver_sequence, _unique_metrics.get());
+    return Status::OK();
+}
+
+void LocalRangeMergeSortSourceOperator::close(RuntimeState* state) {
+    _sort_context->unref(state);
+    Operator::close(state);
+}
+
+bool LocalRangeMergeSortSourceOperator::has_output() const {
+    if (!_sort_context->is_partition_sort_finished() || is_finished()) {
+        return false;
+    }
+    return _merger->has_output(_driver_sequence);
+}
+
+bool LocalRangeMergeSortSourceOperator::is_finished() const {
+    return _is_finished || _merger->is_finished(_driver_sequence);
+}
+
+StatusOr<ChunkPtr> LocalRangeMergeSortSourceOperator::pull_chunk(RuntimeState* state) {
+    return _merger->try_get_next(_driver_sequence);
+}
+
+Status LocalRangeMergeSortSourceOperator::set_finished(RuntimeState* state) {
+    _is_finished = true;
+    _sort_context->cancel();
+    return _sort_context->set_finished();
+}
+
 Status LocalParallelMergeSortSourceOperatorFactory::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(SourceOperatorFactory::prepare(state));
     _state = state;
@@ -92,7 +126,24 @@ OperatorPtr LocalParallelMergeSortSourceOperatorFactory::create(int32_t degree_o
         });
     };
 
-    if (_is_gathered) {
+    // The range partitioned merge outputs all the rows in one pass, so it doesn't support offset or limit.
+    const bool use_range_merge = _is_gathered && config::enable_sort_range_partitioned_merge &&
+                                 degree_of_parallelism > 1 && sort_context->limit() < 0 && sort_context->offset() == 0;
+    if (use_range_merge) {
+        if (_range_merger == nullptr) {
+            std::vector<RangePartitionedMerger::SinkChunkProvider> chunk_providers;
+            for (int i = 0; i < degree_of_parallelism; i++) {
+                auto* chunks_sorter = sort_context->get_chunks_sorter(i);
+                DCHECK(chunks_sorter != nullptr);
+                chunk_providers.emplace_back(chunk_provider_factory(chunks_sorter));
+            }
+            _range_merger = std::make_unique<RangePartitionedMerger>(
+                    _state->chunk_size(), degree_of_parallelism, sort_context->sort_exprs(),
+                    sort_context->sort_descs(), std::move(chunk_providers));
+        }
+        return std::make_shared<LocalRangeMergeSortSourceOperator>(this, _id, _plan_node_id, driver_sequence,
+                                                                   sort_context.get(), _range_merger.get());
+    } else if (_is_gathered) {
         if (_mergers.empty()) {
             std::vector<merge_path::MergePathChunkProvider> chunk_providers;
             for (int i = 0; i < degree_of_parallelism; i++) {
@@ -22,6 +22,7 @@
 #include "exec/pipeline/source_operator.h"
 #include "exec/sort_exec_exprs.h"
 #include "exec/sorting/merge_path.h"
+#include "exec/sorting/range_merge.h"
 
 namespace starrocks::pipeline {
 class SortContext;
@@ -79,6 +80,40 @@ private:
     bool _is_finished = false;
 };
 
+// LocalRangeMergeSortSourceOperator takes the place of LocalParallelMergeSortSourceOperator for the gathered
+// full sort without limit if `enable_sort_range_partitioned_merge` is true. All the operators merge disjoint key
+// ranges of the sorted streams in parallel through RangePartitionedMerger, and only the operator with
+// driver_sequence = 0 outputs data.
+class LocalRangeMergeSortSourceOperator final : public SourceOperator {
+public:
+    LocalRangeMergeSortSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                                      int32_t driver_sequence, SortContext* sort_context,
+                                      RangePartitionedMerger* range_merger)
+            : SourceOperator(factory, id, "local_range_merge_source", plan_node_id, false, driver_sequence),
+              _sort_context(sort_context),
+              _merger(range_merger) {}
+
+    ~LocalRangeMergeSortSourceOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+    bool has_output() const override;
+
+    bool is_mutable() const override { return true; }
+
+    bool is_finished() const override;
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+    Status set_finished(RuntimeState* state) override;
+
+private:
+    SortContext* const _sort_context;
+    RangePartitionedMerger* const _merger;
+    bool _is_finished = false;
+};
+
 class LocalParallelMergeSortSourceOperatorFactory final : public SourceOperatorFactory {
 public:
     LocalParallelMergeSortSourceOperatorFactory(int32_t id, int32_t plan_node_id,
@@ -102,6 +137,7 @@ private:
     // share data with multiple partition sort sink opeartor through _sort_context.
     std::shared_ptr<SortContextFactory> _sort_context_factory;
     std::vector<std::unique_ptr<merge_path::MergePathCascadeMerger>> _mergers;
+    std::unique_ptr<RangePartitionedMerger> _range_merger;
 };
 
 } // namespace starrocks::pipeline
@@ -71,6 +71,18 @@ Status PartitionSortSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr
             return Status::OK();
         }
         DCHECK_EQ(runtime_filter->size(), build_runtime_filters.size());
+        // The filter of the sorter only gets tighter, skip publishing it if the threshold has not moved
+        // since the last chunk, so the scans do not re-evaluate the same filter.
+        _published_rf_versions.resize(runtime_filter->size(), -1);
+        bool updated = false;
+        for (size_t i = 0; i < runtime_filter->size(); ++i) {
+            auto version = static_cast<int64_t>((*runtime_filter)[i]->rf_version());
+            updated |= version != _published_rf_versions[i];
+            _published_rf_versions[i] = version;
+        }
+        if (!updated) {
+            return Status::OK();
+        }
         std::list<RuntimeFilterBuildDescriptor*> build_descs(build_runtime_filters.begin(),
                                                              build_runtime_filters.end());
         for (size_t i = 0; i < build_runtime_filters.size(); ++i) {
@@ -116,7 +128,8 @@ Status PartitionSortSinkOperatorFactory::prepare(RuntimeState* state) {
 OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver_sequence) {
     std::shared_ptr<ChunksSorter> chunks_sorter;
     if (_limit >= 0) {
-        if (_topn_type == TTopNType::ROW_NUMBER && _limit <= ChunksSorter::USE_HEAP_SORTER_LIMIT_SZ) {
+        if (_topn_type == TTopNType::ROW_NUMBER &&
+            ChunksSorter::use_heap_sorter(_sort_exec_exprs.lhs_ordering_expr_ctxs(), _limit + _offset)) {
             chunks_sorter = std::make_unique<ChunksSorterHeapSort>(
                     runtime_state(), &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order, &_is_null_first,
                     _sort_keys, 0, _limit + _offset);
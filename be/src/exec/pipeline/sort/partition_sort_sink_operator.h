@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "column/vectorized_fwd.h"
 #include "common/statusor.h"
@@ -90,6 +91,8 @@ protected:
 
     SortContext* _sort_context;
     RuntimeFilterHub* _hub;
+    // The version of every runtime filter of the sorter when it was published last time, -1 if never published.
+    std::vector<int64_t> _published_rf_versions;
     DECLARE_ONCE_DETECTOR(_set_finishing_once);
 };
 
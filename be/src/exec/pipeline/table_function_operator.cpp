@@ -191,12 +191,14 @@ Status TableFunctionOperator::reset_state(RuntimeState* state, const std::vector
     return Status::OK();
 }
 
-void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns, uint32_t max_output_size) {
+void TableFunctionOperator::_copy_result(std::vector<ColumnPtr>& columns, uint32_t max_output_size) {
     DCHECK_LE(_next_output_row, _table_function_result.first[0]->size());
     DCHECK_LT(_next_output_row_offset, _table_function_result.second->size());
     uint32_t curr_output_size = columns[0]->size();
     const auto& fn_result_cols = _table_function_result.first;
     const auto& offsets_col = _table_function_result.second;
+    const size_t first_output_row = _next_output_row;
+    _outer_row_indexes.clear();
     while (curr_output_size < max_output_size && _next_output_row < fn_result_cols[0]->size()) {
         uint32_t start = _next_output_row;
         uint32_t end = offsets_col->get_data()[_next_output_row_offset + 1];
@@ -208,24 +210,9 @@ void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns,
                 << " _next_output_row_offset=" << _next_output_row_offset
                 << " _input_index_of_first_result=" << _input_index_of_first_result;
 
-        if (copy_rows > 0) {
-            // Build outer data, repeat multiple times
-            for (size_t i = 0; i < _outer_slots.size(); ++i) {
-                ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-                Datum value = input_column_ptr->get(_input_index_of_first_result + _next_output_row_offset);
-                if (value.is_null()) {
-                    DCHECK(columns[i]->is_nullable());
-                    down_cast<NullableColumn*>(columns[i].get())->append_nulls(copy_rows);
-                } else {
-                    columns[i]->append_value_multiple_times(&value, copy_rows);
-                }
-            }
-
-            // Build table function result
-            for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
-                columns[_outer_slots.size() + i]->append(*(fn_result_cols[i]), start, copy_rows);
-            }
-        }
+        // the outer data of the input row is repeated copy_rows times
+        _outer_row_indexes.insert(_outer_row_indexes.end(), copy_rows,
+                                  _input_index_of_first_result + _next_output_row_offset);
 
         curr_output_size += copy_rows;
         _next_output_row += copy_rows;
@@ -234,6 +221,32 @@ void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns,
             _next_output_row_offset++;
         }
     }
+
+    // The output rows of the table function result are consecutive, so the outer columns are replicated and the
+    // result columns are copied at once instead of per input row.
+    const size_t num_rows = _next_output_row - first_output_row;
+    if (num_rows == 0) {
+        return;
+    }
+    DCHECK_EQ(num_rows, _outer_row_indexes.size());
+    for (size_t i = 0; i < _outer_slots.size(); ++i) {
+        const ColumnPtr& input_column = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
+        columns[i]->append_selective(*input_column, _outer_row_indexes.data(), 0, num_rows);
+    }
+
+    // The whole result of the last input rows is output at once, e.g. unnest the small arrays, so the result
+    // columns are output without copying, nothing will be appended to them any more.
+    const bool output_whole_result = columns.size() > _outer_slots.size() &&
+                                     columns[_outer_slots.size()]->empty() && first_output_row == 0 &&
+                                     num_rows == fn_result_cols[0]->size() &&
+                                     _table_function_state->processed_rows() >= _input_chunk->num_rows();
+    for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
+        if (output_whole_result) {
+            columns[_outer_slots.size() + i] = fn_result_cols[i];
+        } else {
+            columns[_outer_slots.size() + i]->append(*(fn_result_cols[i]), first_output_row, num_rows);
+        }
+    }
 }
 
 } // namespace starrocks::pipeline
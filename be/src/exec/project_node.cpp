@@ -14,9 +14,11 @@
 
 #include "exec/project_node.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "column/binary_column.h"
@@ -25,6 +27,7 @@
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/global_types.h"
 #include "common/status.h"
 #include "exec/pipeline/limit_operator.h"
@@ -51,6 +54,40 @@ ProjectNode::~ProjectNode() {
     }
 }
 
+static bool is_deterministic(const TExpr& texpr) {
+    static const std::set<std::string> nondeterministic_fns = {"rand", "random", "uuid", "uuid_numeric", "sleep"};
+    return std::none_of(texpr.nodes.begin(), texpr.nodes.end(), [](const TExprNode& node) {
+        return node.__isset.fn && nondeterministic_fns.count(node.fn.name.function_name) > 0;
+    });
+}
+
+// Return the index of the first output computed by the same expression for every output of `slot_map`, or -1 if
+// there is none. A column ref or a literal costs nothing to be evaluated again, so only the expressions with children
+// are taken.
+static std::vector<int> find_duplicated_outputs(const std::map<TSlotId, TExpr>& slot_map) {
+    std::vector<const TExpr*> texprs;
+    texprs.reserve(slot_map.size());
+    for (const auto& [_, texpr] : slot_map) {
+        texprs.emplace_back(&texpr);
+    }
+    std::vector<int> duplicated_of(texprs.size(), -1);
+    if (!config::enable_project_dedup_outputs) {
+        return duplicated_of;
+    }
+    for (size_t i = 1; i < texprs.size(); ++i) {
+        if (texprs[i]->nodes.size() <= 1 || !is_deterministic(*texprs[i])) {
+            continue;
+        }
+        for (size_t j = 0; j < i; ++j) {
+            if (duplicated_of[j] < 0 && *texprs[j] == *texprs[i]) {
+                duplicated_of[i] = j;
+                break;
+            }
+        }
+    }
+    return duplicated_of;
+}
+
 Status ProjectNode::init(const TPlanNode& tnode, RuntimeState* state) {
     RETURN_IF_ERROR(ExecNode::init(tnode, state));
     size_t column_size = tnode.project_node.slot_map.size();
@@ -63,10 +100,13 @@ Status ProjectNode::init(const TPlanNode& tnode, RuntimeState* state) {
         slot_null_mapping[slot->id()] = slot->is_nullable();
     }
 
+    std::vector<int> duplicated_of = find_duplicated_outputs(tnode.project_node.slot_map);
     for (auto const& [key, val] : tnode.project_node.slot_map) {
         _slot_ids.emplace_back(key);
-        ExprContext* context;
-        RETURN_IF_ERROR(Expr::create_expr_tree(_pool, val, &context, state, true));
+        ExprContext* context = nullptr;
+        if (duplicated_of[_expr_ctxs.size()] < 0) {
+            RETURN_IF_ERROR(Expr::create_expr_tree(_pool, val, &context, state, true));
+        }
         _expr_ctxs.emplace_back(context);
         _type_is_nullable.emplace_back(slot_null_mapping[key]);
     }
@@ -82,6 +122,25 @@ Status ProjectNode::init(const TPlanNode& tnode, RuntimeState* state) {
         _common_sub_expr_ctxs.emplace_back(context);
     }
 
+    // The first one of the duplicated outputs is evaluated as a common sub expression after all the others it may
+    // depend on, and all of them refer to its column.
+    std::vector<bool> shared(_expr_ctxs.size(), false);
+    for (size_t i = 0; i < duplicated_of.size(); ++i) {
+        if (duplicated_of[i] < 0) {
+            continue;
+        }
+        const size_t first = duplicated_of[i];
+        const SlotId first_slot_id = _slot_ids[first];
+        const TypeDescriptor& type = _expr_ctxs[first]->root()->type();
+        if (!shared[first]) {
+            shared[first] = true;
+            _common_sub_slot_ids.emplace_back(first_slot_id);
+            _common_sub_expr_ctxs.emplace_back(_expr_ctxs[first]);
+            _expr_ctxs[first] = _pool->add(new ExprContext(_pool->add(new ColumnRef(type, first_slot_id))));
+        }
+        _expr_ctxs[i] = _pool->add(new ExprContext(_pool->add(new ColumnRef(type, first_slot_id))));
+    }
+
     return Status::OK();
 }
 
@@ -14,10 +14,13 @@
 
 #include "exec/query_cache/cache_manager.h"
 
+#include "common/config.h"
 #include "util/defer_op.h"
 namespace starrocks::query_cache {
 
-CacheManager::CacheManager(size_t capacity) : _cache(capacity) {}
+CacheManager::CacheManager(size_t capacity)
+        : _cache(capacity, ChargeMode::VALUESIZE,
+                 cache_eviction_policy_from_string(config::query_cache_eviction_policy)) {}
 static void delete_cache_entry(const CacheKey& key, void* value) {
     auto* cache_value = (CacheValue*)value;
     delete cache_value;
@@ -16,11 +16,15 @@
 
 #include <glog/logging.h>
 
+#include <unordered_set>
 #include <vector>
 
 #include "column/vectorized_fwd.h"
 #include "common/compiler_util.h"
 #include "exec/pipeline/pipeline_driver.h"
+#include "runtime/exec_env.h"
+#include "storage/lake/rowset.h"
+#include "storage/lake/tablet_manager.h"
 #include "storage/rowset/rowset.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
@@ -41,7 +45,8 @@ struct PerLaneBuffer {
     int lane;
     PerLaneBufferState state;
     TabletSharedPtr tablet;
-    std::vector<RowsetSharedPtr> rowsets;
+    // The delta rowsets to be read and merged with the cached partial result, of either local or lake tablets.
+    std::vector<BaseRowsetSharedPtr> rowsets;
     RowsetsAcqRelPtr rowsets_acq_rel;
     int64_t required_version;
     int64_t cached_version;
@@ -222,7 +227,9 @@ void CacheOperator::_handle_stale_cache_value(int64_t tablet_id, CacheValue& cac
     }
 #endif
 
-    if (_cache_param.keys_type != TKeysType::PRIMARY_KEYS) {
+    if (_cache_param.is_lake) {
+        _handle_stale_cache_value_for_lake(tablet_id, cache_value, buffer, version);
+    } else if (_cache_param.keys_type != TKeysType::PRIMARY_KEYS) {
         _handle_stale_cache_value_for_non_pk(tablet_id, cache_value, buffer, version);
     } else {
         _handle_stale_cache_value_for_pk(tablet_id, cache_value, buffer, version);
@@ -264,6 +271,60 @@ void CacheOperator::_handle_stale_cache_value_for_non_pk(int64_t tablet_id, Cach
         return;
     }
 
+    if (!all_rs_empty) {
+        buffer->rowsets.assign(rowsets.begin(), rowsets.end());
+        buffer->rowsets_acq_rel = std::move(rowsets_acq_rel);
+    }
+    _reuse_stale_cache_value(tablet_id, cache_value, buffer, all_rs_empty);
+}
+
+void CacheOperator::_handle_stale_cache_value_for_lake(int64_t tablet_id, CacheValue& cache_value,
+                                                       PerLaneBufferPtr& buffer, int64_t version) {
+    // The rowsets of a lake tablet aren't versioned by ranges, so the delta rowsets are the ones of the required
+    // version absent from the cached version. Cache MISS if the metadata of the cached version has been vacuumed.
+    auto* tablet_mgr = ExecEnv::GetInstance()->lake_tablet_manager();
+    auto cached_tablet = tablet_mgr->get_tablet(tablet_id, cache_value.version);
+    auto tablet = tablet_mgr->get_tablet(tablet_id, version);
+    if (!cached_tablet.ok() || !tablet.ok()) {
+        buffer->state = PLBS_MISS;
+        buffer->cached_version = 0;
+        return;
+    }
+
+    std::unordered_set<uint32_t> cached_rowset_ids;
+    for (const auto& rowset : cached_tablet->metadata()->rowsets()) {
+        cached_rowset_ids.insert(rowset.id());
+    }
+    std::vector<BaseRowsetSharedPtr> delta_rowsets;
+    auto all_rs_empty = true;
+    for (auto& rowset : tablet->get_rowsets()) {
+        if (cached_rowset_ids.erase(rowset->id()) > 0) {
+            continue;
+        }
+        all_rs_empty &= rowset->num_rows() == 0 && !rowset->metadata().has_delete_predicate();
+        delta_rowsets.emplace_back(std::move(rowset));
+    }
+    // Cache MISS if
+    // - some cached rowsets have been compacted, whose rows are in the delta rowsets again.
+    // - the tablet has delete predicates, which may be applied to the rowsets of any version.
+    // - the data model or the primary keys, whose delta rowsets may delete the cached rows, can not support
+    //   multiversion cache and the tablet has non-empty delta rowsets.
+    const bool can_use_multiversion =
+            _cache_param.can_use_multiversion && _cache_param.keys_type != TKeysType::PRIMARY_KEYS;
+    if (!cached_rowset_ids.empty() || tablet->has_delete_predicates() || (!can_use_multiversion && !all_rs_empty)) {
+        buffer->state = PLBS_MISS;
+        buffer->cached_version = 0;
+        return;
+    }
+
+    if (!all_rs_empty) {
+        buffer->rowsets = std::move(delta_rowsets);
+    }
+    _reuse_stale_cache_value(tablet_id, cache_value, buffer, all_rs_empty);
+}
+
+void CacheOperator::_reuse_stale_cache_value(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
+                                             bool all_rs_empty) {
     buffer->cached_version = cache_value.version;
     auto chunks = remap_chunks(cache_value.result, _cache_param.reverse_slot_remapping);
     _update_probe_metrics(tablet_id, chunks);
@@ -278,8 +339,6 @@ void CacheOperator::_handle_stale_cache_value_for_non_pk(int64_t tablet_id, Cach
     // case 3: otherwise, the cache result is partial result of per-tablet computation, so delta versions must
     //  be scanned and merged with cache result to generate total result.
     buffer->state = PLBS_HIT_PARTIAL;
-    buffer->rowsets = std::move(rowsets);
-    buffer->rowsets_acq_rel = std::move(rowsets_acq_rel);
     buffer->num_rows = 0;
     buffer->num_bytes = 0;
     for (const auto& chunk : buffer->chunks) {
@@ -428,10 +487,10 @@ int64_t CacheOperator::cached_version(int64_t tablet_id) {
     }
 }
 
-std::tuple<int64_t, vector<RowsetSharedPtr>> CacheOperator::delta_version_and_rowsets(int64_t tablet_id) {
+std::tuple<int64_t, vector<BaseRowsetSharedPtr>> CacheOperator::delta_version_and_rowsets(int64_t tablet_id) {
     auto lane_it = _owner_to_lanes.find(tablet_id);
     if (lane_it == _owner_to_lanes.end()) {
-        return make_tuple(0, vector<RowsetSharedPtr>{});
+        return make_tuple(0, vector<BaseRowsetSharedPtr>{});
     } else {
         auto& buffer = _per_lane_buffers[lane_it->second];
         return make_tuple(buffer->cached_version + 1, buffer->rowsets);
@@ -24,6 +24,9 @@
 #include "exec/query_cache/multilane_operator.h"
 #include "storage/rowset/rowset.h"
 namespace starrocks {
+class BaseRowset;
+using BaseRowsetSharedPtr = std::shared_ptr<BaseRowset>;
+
 namespace pipeline {
 class PipelineDriver;
 using DriverRawPtr = PipelineDriver*;
@@ -51,7 +54,7 @@ public:
     Status reset_lane(RuntimeState* state, LaneOwnerType lane_owner);
     void populate_cache(int64_t tablet_id);
     int64_t cached_version(int64_t tablet_id);
-    std::tuple<int64_t, std::vector<RowsetSharedPtr>> delta_version_and_rowsets(int64_t tablet_id);
+    std::tuple<int64_t, std::vector<BaseRowsetSharedPtr>> delta_version_and_rowsets(int64_t tablet_id);
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
     bool has_output() const override;
@@ -74,6 +77,12 @@ private:
                                               int64_t version);
     void _handle_stale_cache_value_for_pk(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
                                           int64_t version);
+    void _handle_stale_cache_value_for_lake(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
+                                            int64_t version);
+    // Reuse the stale cache value, as a total hit if all the delta rowsets are empty, or otherwise a partial hit
+    // to be merged with the result of the delta rowsets.
+    void _reuse_stale_cache_value(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
+                                  bool all_rs_empty);
     bool _should_passthrough(size_t num_rows, size_t num_bytes);
     ChunkPtr _pull_chunk_from_per_lane_buffer(PerLaneBufferPtr& buffer);
     CacheManagerRawPtr _cache_mgr;
@@ -35,6 +35,8 @@ struct CacheParam {
     size_t entry_max_rows;
     bool can_use_multiversion;
     TKeysType::type keys_type;
+    // Whether the cached scan reads lake tablets.
+    bool is_lake = false;
     std::unordered_set<int32_t> cached_plan_node_ids;
 };
 } // namespace starrocks::query_cache
@@ -0,0 +1,178 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exec/query_cache/result_cache.h"
+
+#include <arpa/inet.h>
+
+#include "gen_cpp/PlanNodes_types.h"
+#include "util/md5.h"
+#include "util/thrift_util.h"
+#include "util/time.h"
+
+namespace starrocks::query_cache {
+
+// The functions whose result differs between two executions of the same plan.
+static const char* const kNonDeterministicFunctions[] = {
+        "rand",           "random",        "uuid",           "uuid_numeric",      "now",
+        "curtime",        "current_time",  "curdate",        "current_date",      "current_timestamp",
+        "sysdate",        "utc_time",      "utc_timestamp",  "unix_timestamp",    "localtime",
+        "localtimestamp", "sleep",         "connection_id",  "current_user",      "session_user",
+        "user",           "last_query_id", "get_query_profile"};
+
+// The strings are serialized as a 4-byte big-endian length followed by the bytes in the binary protocol.
+static bool contains_thrift_string(const std::string& serialized, const std::string& str) {
+    uint32_t len = htonl(static_cast<uint32_t>(str.size()));
+    std::string pattern(reinterpret_cast<const char*>(&len), sizeof(len));
+    pattern.append(str);
+    return serialized.find(pattern) != std::string::npos;
+}
+
+template <typename T>
+static bool serialize(ThriftSerializer* serializer, const T& obj, std::string* result) {
+    return serializer->serialize(&obj, result).ok();
+}
+
+bool ResultCache::_is_cacheable(const TExecPlanFragmentParams& common_request,
+                                const TExecPlanFragmentParams& unique_request) {
+    const auto& fragment = common_request.fragment;
+    if (!fragment.__isset.output_sink && !unique_request.fragment.__isset.output_sink) {
+        return false;
+    }
+    const auto& sink =
+            unique_request.fragment.__isset.output_sink ? unique_request.fragment.output_sink : fragment.output_sink;
+    if (sink.type != TDataSinkType::RESULT_SINK || !sink.__isset.result_sink ||
+        sink.result_sink.__isset.file_options) {
+        return false;
+    }
+    if (sink.result_sink.__isset.type && sink.result_sink.type != TResultSinkType::MYSQL_PROTOCAL) {
+        return false;
+    }
+    // Only the fragments that read the local tablets by themselves, the leaves can't be exchanges or the scans
+    // of the external tables.
+    if (!fragment.__isset.plan || fragment.plan.nodes.empty()) {
+        return false;
+    }
+    for (const auto& node : fragment.plan.nodes) {
+        if (node.num_children > 0) {
+            continue;
+        }
+        if (node.node_type != TPlanNodeType::OLAP_SCAN_NODE && node.node_type != TPlanNodeType::EMPTY_SET_NODE &&
+            node.node_type != TPlanNodeType::UNION_NODE) {
+            return false;
+        }
+    }
+    for (const auto& [_, scan_ranges] : unique_request.params.per_node_scan_ranges) {
+        for (const auto& scan_range : scan_ranges) {
+            if (scan_range.__isset.has_more && scan_range.has_more) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::string ResultCache::cache_key(const TExecPlanFragmentParams& common_request,
+                                   const TExecPlanFragmentParams& unique_request) {
+    if (!_is_cacheable(common_request, unique_request)) {
+        return {};
+    }
+
+    ThriftSerializer serializer(false, 4096);
+    std::string serialized;
+    if (!serialize(&serializer, common_request.fragment, &serialized)) {
+        return {};
+    }
+    for (const char* name : kNonDeterministicFunctions) {
+        if (contains_thrift_string(serialized, name)) {
+            return {};
+        }
+    }
+
+    Md5Digest digest;
+    digest.update(serialized.data(), serialized.size());
+    if (unique_request.fragment.__isset.output_sink) {
+        if (!serialize(&serializer, unique_request.fragment.output_sink, &serialized)) {
+            return {};
+        }
+        digest.update(serialized.data(), serialized.size());
+    }
+    if (!serialize(&serializer, common_request.desc_tbl, &serialized)) {
+        return {};
+    }
+    digest.update(serialized.data(), serialized.size());
+    if (!serialize(&serializer, common_request.query_options, &serialized)) {
+        return {};
+    }
+    digest.update(serialized.data(), serialized.size());
+    // The scan ranges carry the versions of the tablets. The other exec params, e.g. the ids of the query and the
+    // instance, differ between the executions of the same plan.
+    TPlanFragmentExecParams scan_params;
+    scan_params.__set_per_node_scan_ranges(unique_request.params.per_node_scan_ranges);
+    if (unique_request.params.__isset.node_to_per_driver_seq_scan_ranges) {
+        scan_params.__set_node_to_per_driver_seq_scan_ranges(unique_request.params.node_to_per_driver_seq_scan_ranges);
+    }
+    if (!serialize(&serializer, scan_params, &serialized)) {
+        return {};
+    }
+    digest.update(serialized.data(), serialized.size());
+    if (common_request.query_globals.__isset.time_zone) {
+        const auto& time_zone = common_request.query_globals.time_zone;
+        digest.update(time_zone.data(), time_zone.size());
+    }
+    digest.digest();
+    return "result:" + digest.hex();
+}
+
+void ResultCachePopulator::add_chunk(const ChunkPtr& chunk) {
+    if (chunk == nullptr || chunk->is_empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_abandoned) {
+        return;
+    }
+    _bytes += chunk->memory_usage();
+    if (_bytes > _entry_max_bytes) {
+        _abandoned = true;
+        _chunks.clear();
+        return;
+    }
+    // The result writers may rewrite the columns of the chunk in place.
+    _chunks.emplace_back(chunk->clone_unique());
+}
+
+void ResultCachePopulator::abandon() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _abandoned = true;
+    _chunks.clear();
+}
+
+bool ResultCachePopulator::is_abandoned() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _abandoned;
+}
+
+void ResultCachePopulator::populate(CacheManagerRawPtr cache_mgr) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_abandoned || cache_mgr == nullptr) {
+        return;
+    }
+    cache_mgr->populate(_key, CacheValue(MonotonicMillis(), 0, std::move(_chunks)));
+    _chunks.clear();
+    _abandoned = true;
+}
+
+} // namespace starrocks::query_cache
@@ -0,0 +1,69 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <mutex>
+#include <string>
+
+#include "exec/query_cache/cache_manager.h"
+#include "gen_cpp/InternalService_types.h"
+
+namespace starrocks::query_cache {
+
+// Result cache keeps the final result of a fragment instance that produces the result set of a query alone, i.e.
+// a result sink over a plan of olap scans without any exchange, so the identical fragment sent again is served
+// from the cached chunks instead of re-executing the plan. The key is a fingerprint of the plan, the output
+// exprs, the scan ranges and the query options, and the versions of the tablets are part of the scan ranges, so
+// a load or a compaction that changes the version makes the old entry unreachable and it ages out of the LRU.
+class ResultCache {
+public:
+    // Returns an empty key if the fragment is not cacheable.
+    static std::string cache_key(const TExecPlanFragmentParams& common_request,
+                                 const TExecPlanFragmentParams& unique_request);
+
+private:
+    static bool _is_cacheable(const TExecPlanFragmentParams& common_request,
+                              const TExecPlanFragmentParams& unique_request);
+};
+
+// Collects the chunks pushed to the result sinks of a fragment instance, and populates them into the cache when
+// all the sinks finish. Shared by all the ResultSinkOperators of the fragment instance.
+class ResultCachePopulator {
+public:
+    ResultCachePopulator(std::string key, size_t entry_max_bytes)
+            : _key(std::move(key)), _entry_max_bytes(entry_max_bytes) {}
+
+    void add_chunk(const ChunkPtr& chunk);
+    // A result sink finished without consuming all its input, e.g. it was cancelled.
+    void abandon();
+    void populate(CacheManagerRawPtr cache_mgr);
+
+    bool is_abandoned() const;
+    const std::string& key() const { return _key; }
+
+private:
+    const std::string _key;
+    const size_t _entry_max_bytes;
+
+    mutable std::mutex _mutex;
+    bool _abandoned = false;
+    size_t _bytes = 0;
+    CacheResult _chunks;
+};
+
+using ResultCachePopulatorPtr = std::shared_ptr<ResultCachePopulator>;
+
+} // namespace starrocks::query_cache
@@ -0,0 +1,70 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "exec/pipeline/source_operator.h"
+#include "exec/query_cache/cache_manager.h"
+
+namespace starrocks::query_cache {
+
+// ResultCacheSourceOperator replaces the whole plan of a fragment instance that hits the result cache, and emits
+// the cached chunks to the result sink.
+class ResultCacheSourceOperator final : public pipeline::SourceOperator {
+public:
+    ResultCacheSourceOperator(pipeline::OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                              int32_t driver_sequence, const CacheResult& chunks)
+            : SourceOperator(factory, id, "result_cache_source", plan_node_id, false, driver_sequence),
+              _chunks(chunks) {}
+
+    ~ResultCacheSourceOperator() override = default;
+
+    bool has_output() const override { return _next_chunk < _chunks.size(); }
+
+    bool is_finished() const override { return _next_chunk >= _chunks.size(); }
+
+    Status set_finishing(RuntimeState* state) override {
+        _next_chunk = _chunks.size();
+        return Status::OK();
+    }
+
+    StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override {
+        // The cached chunks are shared by the concurrent hits, and the result writers may rewrite them in place.
+        return _chunks[_next_chunk++]->clone_unique();
+    }
+
+private:
+    const CacheResult& _chunks;
+    size_t _next_chunk = 0;
+};
+
+class ResultCacheSourceOperatorFactory final : public pipeline::SourceOperatorFactory {
+public:
+    ResultCacheSourceOperatorFactory(int32_t id, int32_t plan_node_id, CacheResult chunks)
+            : SourceOperatorFactory(id, "result_cache_source", plan_node_id), _chunks(std::move(chunks)) {}
+
+    ~ResultCacheSourceOperatorFactory() override = default;
+
+    pipeline::OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<ResultCacheSourceOperator>(this, _id, _plan_node_id, driver_sequence, _chunks);
+    }
+
+    SourceOperatorFactory::AdaptiveState adaptive_initial_state() const override { return AdaptiveState::ACTIVE; }
+
+private:
+    CacheResult _chunks;
+};
+
+} // namespace starrocks::query_cache
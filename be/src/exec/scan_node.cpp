@@ -34,6 +34,9 @@
 
 #include "exec/scan_node.h"
 
+#include <algorithm>
+#include <queue>
+
 #include "exec/pipeline/query_context.h"
 #include "exec/pipeline/scan/morsel.h"
 
@@ -124,6 +127,70 @@ static std::map<int, pipeline::MorselQueuePtr> uniform_distribute_morsels(pipeli
     return queue_per_driver;
 }
 
+bool ScanNode::balance_colocate_buckets(std::map<int32_t, std::vector<TScanRangeParams>>* scan_ranges_per_driver_seq) {
+    if (scan_ranges_per_driver_seq->empty()) {
+        return false;
+    }
+    const int32_t num_drivers = scan_ranges_per_driver_seq->rbegin()->first + 1;
+
+    struct Bucket {
+        int32_t bucket_sequence;
+        int64_t num_rows = 0;
+        std::vector<TScanRangeParams> scan_ranges;
+    };
+    std::map<int32_t, Bucket> buckets;
+    int64_t max_driver_rows = 0;
+    for (const auto& [_, scan_ranges] : *scan_ranges_per_driver_seq) {
+        int64_t driver_rows = 0;
+        for (const auto& scan_range : scan_ranges) {
+            if (!scan_range.scan_range.__isset.internal_scan_range) {
+                return false;
+            }
+            const auto& internal_scan_range = scan_range.scan_range.internal_scan_range;
+            if (!internal_scan_range.__isset.bucket_sequence || !internal_scan_range.__isset.row_count) {
+                return false;
+            }
+            auto& bucket = buckets[internal_scan_range.bucket_sequence];
+            bucket.bucket_sequence = internal_scan_range.bucket_sequence;
+            bucket.num_rows += internal_scan_range.row_count;
+            bucket.scan_ranges.emplace_back(scan_range);
+            driver_rows += internal_scan_range.row_count;
+        }
+        max_driver_rows = std::max(max_driver_rows, driver_rows);
+    }
+
+    std::vector<Bucket*> sorted_buckets;
+    sorted_buckets.reserve(buckets.size());
+    for (auto& [_, bucket] : buckets) {
+        sorted_buckets.emplace_back(&bucket);
+    }
+    std::stable_sort(sorted_buckets.begin(), sorted_buckets.end(),
+                     [](const Bucket* lhs, const Bucket* rhs) { return lhs->num_rows > rhs->num_rows; });
+
+    // Min-heap of (rows, driver_seq), every bucket goes to the least loaded driver.
+    using DriverLoad = std::pair<int64_t, int32_t>;
+    std::priority_queue<DriverLoad, std::vector<DriverLoad>, std::greater<>> driver_loads;
+    for (int32_t driver_seq = 0; driver_seq < num_drivers; ++driver_seq) {
+        driver_loads.emplace(0, driver_seq);
+    }
+    std::map<int32_t, std::vector<TScanRangeParams>> balanced;
+    int64_t balanced_max_driver_rows = 0;
+    for (auto* bucket : sorted_buckets) {
+        auto [rows, driver_seq] = driver_loads.top();
+        driver_loads.pop();
+        rows += bucket->num_rows;
+        balanced_max_driver_rows = std::max(balanced_max_driver_rows, rows);
+        auto& scan_ranges = balanced[driver_seq];
+        scan_ranges.insert(scan_ranges.end(), bucket->scan_ranges.begin(), bucket->scan_ranges.end());
+        driver_loads.emplace(rows, driver_seq);
+    }
+    if (balanced_max_driver_rows >= max_driver_rows) {
+        return false;
+    }
+    *scan_ranges_per_driver_seq = std::move(balanced);
+    return true;
+}
+
 StatusOr<pipeline::MorselQueueFactoryPtr> ScanNode::convert_scan_range_to_morsel_queue_factory(
         const std::vector<TScanRangeParams>& global_scan_ranges,
         const std::map<int32_t, std::vector<TScanRangeParams>>& scan_ranges_per_driver_seq, int node_id,
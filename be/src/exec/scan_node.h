@@ -93,6 +93,13 @@ public:
             bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
             size_t num_total_scan_ranges);
 
+    // Reassign the whole buckets of a colocate scan to the drivers by their row counts with the greedy
+    // largest-first heuristic, so that no driver gets much more rows than the others. The scan ranges of one
+    // bucket (the same bucket sequence in different partitions) are always kept together.
+    // Returns false and keeps `scan_ranges_per_driver_seq` unchanged if some scan range misses its bucket
+    // sequence or row count, or the reassignment does not reduce the rows of the most loaded driver.
+    static bool balance_colocate_buckets(std::map<int32_t, std::vector<TScanRangeParams>>* scan_ranges_per_driver_seq);
+
     // If this scan node accept empty scan ranges.
     virtual bool accept_empty_scan_ranges() const { return true; }
 
@@ -120,6 +127,8 @@ public:
     const std::string& name() const { return _name; }
 
     virtual int io_tasks_per_scan_operator() const { return _io_tasks_per_scan_operator; }
+    // The ceiling of the io tasks of a scan operator when they are adjusted at runtime.
+    virtual int max_io_tasks_per_scan_operator() const { return io_tasks_per_scan_operator(); }
     virtual bool always_shared_scan() const { return false; }
     virtual bool output_chunk_by_bucket() const { return false; }
     virtual bool is_asc_hint() const { return true; }
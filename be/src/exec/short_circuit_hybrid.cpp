@@ -25,8 +25,10 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory_scratch_sink.h"
 #include "storage/chunk_helper.h"
+#include "storage/local_tablet_reader.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
+#include "util/defer_op.h"
 #include "util/thrift_util.h"
 
 namespace starrocks {
@@ -52,6 +54,14 @@ Status ShortCircuitHybridScanNode::open(RuntimeState* state) {
         }
         _tablets.emplace_back(std::move(tablet));
     }
+    if (_tablets.empty()) {
+        return Status::InvalidArgument("short circuit without tablets");
+    }
+    if (_versions.size() != _tablets.size()) {
+        return Status::InvalidArgument(
+                fmt::format("short circuit with {} tablets but {} versions", _tablets.size(), _versions.size()));
+    }
+    _tablet_schema = _tablets[0]->tablet_schema();
 
     SCOPED_TIMER(_runtime_profile->total_time_counter());
 
@@ -59,11 +69,29 @@ Status ShortCircuitHybridScanNode::open(RuntimeState* state) {
     //init tuple
     _tuple_desc = state->desc_tbl().get_tuple_descriptor(_tuple_id);
     DCHECK(_tuple_desc != nullptr);
+    RETURN_IF_ERROR(_init_slot_columns());
 
     RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
     return Status::OK();
 }
 
+Status ShortCircuitHybridScanNode::_init_slot_columns() {
+    for (auto slot_desc : _tuple_desc->slots()) {
+        int32_t cid = _tablet_schema->field_index(slot_desc->col_name());
+        if (UNLIKELY(cid < 0)) {
+            return Status::InternalError(fmt::format("short circuit column {} not found", slot_desc->col_name()));
+        }
+        if (static_cast<size_t>(cid) < _tablet_schema->num_key_columns()) {
+            _key_slots.emplace_back(slot_desc->id(), cid);
+        } else {
+            _value_slots.emplace_back(slot_desc->id(), _value_column_ids.size());
+            _value_column_ids.emplace_back(cid);
+        }
+    }
+    _value_schema = std::make_unique<Schema>(_tablet_schema->schema(), _value_column_ids);
+    return Status::OK();
+}
+
 Status ShortCircuitHybridScanNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     if (*eos) {
         return Status::OK();
@@ -84,28 +112,15 @@ Status ShortCircuitHybridScanNode::get_next(RuntimeState* state, ChunkPtr* chunk
         }
     }
 
-    auto tablet_schema = _tablets[0]->tablet_schema()->schema();
-    auto column_ids = tablet_schema->field_column_ids();
-    auto tablet_schema_without_rowstore = std::make_unique<Schema>(tablet_schema, column_ids);
     auto result_chunk = ChunkHelper::new_chunk(*_tuple_desc, result_size);
 
-    //idx is column id, value is slot id
     if (result_size > 0) {
         _key_chunk->filter(selections);
-        for (auto slot_desc : _tuple_desc->slots()) {
-            auto field = tablet_schema_without_rowstore->get_field_by_name(slot_desc->col_name());
-            if (field->is_key()) {
-                result_chunk->get_column_by_slot_id(slot_desc->id())
-                        ->append(*(_key_chunk->get_column_by_name(field->name().data()).get()));
-            }
+        for (const auto& [slot_id, key_idx] : _key_slots) {
+            result_chunk->get_column_by_slot_id(slot_id)->append(*_key_chunk->get_column_by_index(key_idx));
         }
-
-        for (auto slot_desc : _tuple_desc->slots()) {
-            auto field = tablet_schema_without_rowstore->get_field_by_name(slot_desc->col_name());
-            if (!field->is_key()) {
-                result_chunk->get_column_by_slot_id(slot_desc->id())
-                        ->append(*(_value_chunk->get_column_by_name(field->name().data()).get()));
-            }
+        for (const auto& [slot_id, value_idx] : _value_slots) {
+            result_chunk->get_column_by_slot_id(slot_id)->append(*_value_chunk->get_column_by_index(value_idx));
         }
         RETURN_IF_ERROR(ExecNode::eval_conjuncts(_conjunct_ctxs, result_chunk.get()));
         if (result_chunk->num_rows() == 0) {
@@ -121,10 +136,9 @@ Status ShortCircuitHybridScanNode::get_next(RuntimeState* state, ChunkPtr* chunk
 }
 
 Status ShortCircuitHybridScanNode::_process_key_chunk() {
-    DCHECK(_tablets.size() > 0);
-    _tablet_schema = _tablets[0]->tablet_schema();
+    const size_t num_key_columns = _tablet_schema->num_key_columns();
     vector<uint32_t> pk_columns;
-    for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+    for (size_t i = 0; i < num_key_columns; i++) {
         pk_columns.push_back((uint32_t)i);
     }
     auto key_schema = ChunkHelper::convert_schema(_tablet_schema, pk_columns);
@@ -132,35 +146,37 @@ Status ShortCircuitHybridScanNode::_process_key_chunk() {
     _key_chunk = ChunkHelper::new_chunk(key_schema, _num_rows);
     _key_chunk->reset();
 
+    // TODO (jkj) if expr is k1=1 and k2 in (3, 4), we need bind tablet with expr,
+    // tablet 1  <---> k1 =1, k2 =3
+    // tablet 2  <---> k1 =1, k2 =4
+    // this prune need happen in fe
+    std::vector<TExpr> key_literal_exprs;
+    key_literal_exprs.reserve(_num_rows * num_key_columns);
     for (int i = 0; i < _num_rows; ++i) {
-        // TODO (jkj) if expr is k1=1 and k2 in (3, 4), we need bind tablet with expr,
-        // tablet 1  <---> k1 =1, k2 =3
-        // tablet 2  <---> k1 =1, k2 =4
-        // this prune need happen in fe
-        auto keys_literal_expr = (*_key_literal_exprs)[i].literal_exprs;
-        size_t num_pk_filters = keys_literal_expr.size();
+        const auto& keys_literal_expr = (*_key_literal_exprs)[i].literal_exprs;
         // must all columns
-        if (UNLIKELY(num_pk_filters != _tablet_schema->num_key_columns())) {
+        if (UNLIKELY(keys_literal_expr.size() != num_key_columns)) {
             return Status::Corruption("short circuit only support all key predicate");
         }
-        for (int j = 0; j < num_pk_filters; ++j) {
-            // init expr context
-            std::vector<ExprContext*> expr_ctxs;
-            std::vector<TExpr> key_literal_expr{keys_literal_expr[j]};
-            // prepare
-            RETURN_IF_ERROR(Expr::create_expr_trees(runtime_state()->obj_pool(), key_literal_expr, &expr_ctxs,
-                                                    runtime_state()));
-            RETURN_IF_ERROR(Expr::prepare(expr_ctxs, runtime_state()));
-            RETURN_IF_ERROR(Expr::open(expr_ctxs, runtime_state()));
-            auto& iteral_expr_ctx = expr_ctxs[0];
-            ASSIGN_OR_RETURN(ColumnPtr value, iteral_expr_ctx->root()->evaluate_const(iteral_expr_ctx));
-            if (UNLIKELY(value == nullptr || value->only_null() || value->is_null(0))) {
-                return Status::EndOfFile("iteral_expr_ctx evaluated to null, won’t execute here");
-            }
-            // add const column to chunk
-            auto const_column = ColumnHelper::get_data_column(value.get());
-            _key_chunk->get_column_by_index(j)->append(*const_column);
+        key_literal_exprs.insert(key_literal_exprs.end(), keys_literal_expr.begin(), keys_literal_expr.end());
+    }
+
+    // create and prepare the literals of all the keys together instead of one by one
+    std::vector<ExprContext*> expr_ctxs;
+    RETURN_IF_ERROR(
+            Expr::create_expr_trees(runtime_state()->obj_pool(), key_literal_exprs, &expr_ctxs, runtime_state()));
+    DeferOp close_exprs([&] { Expr::close(expr_ctxs, runtime_state()); });
+    RETURN_IF_ERROR(Expr::prepare(expr_ctxs, runtime_state()));
+    RETURN_IF_ERROR(Expr::open(expr_ctxs, runtime_state()));
+    for (size_t i = 0; i < expr_ctxs.size(); ++i) {
+        auto* iteral_expr_ctx = expr_ctxs[i];
+        ASSIGN_OR_RETURN(ColumnPtr value, iteral_expr_ctx->root()->evaluate_const(iteral_expr_ctx));
+        if (UNLIKELY(value == nullptr || value->only_null() || value->is_null(0))) {
+            return Status::EndOfFile("iteral_expr_ctx evaluated to null, won’t execute here");
         }
+        // add const column to chunk
+        auto const_column = ColumnHelper::get_data_column(value.get());
+        _key_chunk->get_column_by_index(i % num_key_columns)->append(*const_column);
     }
 
     return Status::OK();
@@ -169,37 +185,41 @@ Status ShortCircuitHybridScanNode::_process_key_chunk() {
 // params: std::vector<int>& found
 // found vector value
 Status ShortCircuitHybridScanNode::_process_value_chunk(std::vector<bool>& found) {
-    std::vector<string> value_field_names;
-    vector<starrocks::ColumnId> value_column_ids;
-    for (auto slot_desc : _tuple_desc->slots()) {
-        auto field = _tablet_schema->schema()->get_field_by_name(slot_desc->col_name());
-        if (field != nullptr && !field->is_key()) {
-            value_field_names.emplace_back(field->name());
-            value_column_ids.emplace_back(field->id());
+    // final value_chunk, order match key_chunk
+    _value_chunk = ChunkHelper::new_chunk(*_value_schema, _num_rows);
+
+    // the keys of a point lookup are usually in a single tablet, whose values are already in the order of the keys
+    if (_tablets.size() == 1) {
+        LocalTabletReader reader;
+        RETURN_IF_ERROR(reader.init(_tablets[0], std::stoll(_versions[0])));
+        std::vector<bool> current_found;
+        Status status = reader.multi_get(*_key_chunk, _value_column_ids, current_found, *_value_chunk);
+        if (!status.ok()) {
+            // todo retry
+            LOG(WARNING) << "fail to execute multi get: " << status.detailed_message();
+            _value_chunk->reset();
+            return Status::OK();
         }
+        found.swap(current_found);
+        return Status::OK();
     }
-    auto value_schema = std::make_unique<Schema>(_tablet_schema->schema(), value_column_ids);
+
     // tmp value_chunk, order not match key_chunk
-    ChunkPtr value_chunk = ChunkHelper::new_chunk(*(value_schema), _num_rows);
-    // final value_chunk, order match key_chunk
-    _value_chunk = ChunkHelper::new_chunk(*(value_schema), _num_rows);
+    ChunkPtr value_chunk = ChunkHelper::new_chunk(*_value_schema, _num_rows);
 
     std::vector<int> key_idx_to_value_idx(_num_rows, -1);
     int value_chunk_idx = 0;
 
     for (int i = 0; i < _tablets.size(); ++i) {
-        LocalTableReaderParams params;
-        params.version = std::stoi(_versions[i]);
-        params.tablet_id = _tablets[i]->get_tablet_info().tablet_id;
-        _table_reader = std::make_shared<TableReader>();
-        RETURN_IF_ERROR(_table_reader->init(params));
+        LocalTabletReader reader;
+        int64_t tablet_id = _tablets[i]->tablet_id();
+        RETURN_IF_ERROR(reader.init(_tablets[i], std::stoll(_versions[i])));
 
-        auto current_chunk = ChunkHelper::new_chunk(*(value_schema), _num_rows);
+        auto current_chunk = ChunkHelper::new_chunk(*_value_schema, _num_rows);
         // current tablet will return all key_chunk mapping whether has value
         // true , means vector idx of key_chunk have value
         std::vector<bool> curent_found;
-        Status status =
-                _table_reader->multi_get(*(_key_chunk.get()), value_field_names, curent_found, *(current_chunk.get()));
+        Status status = reader.multi_get(*_key_chunk, _value_column_ids, curent_found, *current_chunk);
         if (!status.ok()) {
             // todo retry
             LOG(WARNING) << "fail to execute multi get: " << status.detailed_message();
@@ -216,7 +236,7 @@ Status ShortCircuitHybridScanNode::_process_value_chunk(std::vector<bool>& found
                 if (UNLIKELY(found[key_idx])) {
                     return Status::Corruption(
                             fmt::format("one key can't be found twice in short circuit, tablet_id: {}, key_idx: {}",
-                                        params.tablet_id, key_idx));
+                                        tablet_id, key_idx));
                 }
                 found[key_idx] = true;
                 has_found_value = true;
@@ -228,11 +248,14 @@ Status ShortCircuitHybridScanNode::_process_value_chunk(std::vector<bool>& found
     }
 
     // transform  value
+    std::vector<uint32_t> value_indexes;
+    value_indexes.reserve(value_chunk_idx);
     for (int key_idx = 0; key_idx < key_idx_to_value_idx.size(); ++key_idx) {
         if (key_idx_to_value_idx[key_idx] != -1) {
-            _value_chunk->append(*(value_chunk.get()), key_idx_to_value_idx[key_idx], 1);
+            value_indexes.push_back(key_idx_to_value_idx[key_idx]);
         }
     }
+    _value_chunk->append_selective(*value_chunk, value_indexes.data(), 0, value_indexes.size());
 
     return Status::OK();
 }
@@ -51,7 +51,9 @@ public:
     Status _process_value_chunk(std::vector<bool>& found);
 
 private:
-    TableReaderPtr _table_reader;
+    // Resolves the columns of the slots once, rather than by their names for each chunk.
+    Status _init_slot_columns();
+
     TExecShortCircuitParams& _common_request;
     TDescriptorTable* _t_desc_tbl;
     ChunkPtr _key_chunk;
@@ -63,5 +65,12 @@ private:
     TupleId _tuple_id;
     std::vector<string> _versions;
     int64_t _num_rows;
+
+    // (slot id, index of the key column) of the key slots
+    std::vector<std::pair<SlotId, size_t>> _key_slots;
+    // (slot id, index in _value_column_ids) of the value slots
+    std::vector<std::pair<SlotId, size_t>> _value_slots;
+    std::vector<uint32_t> _value_column_ids;
+    std::unique_ptr<Schema> _value_schema;
 };
 } // namespace starrocks
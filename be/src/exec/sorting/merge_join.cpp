@@ -0,0 +1,139 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/sorting/merge_join.h"
+
+#include "column/column.h"
+#include "column/nullable_column.h"
+#include "gutil/casts.h"
+#include "gutil/strings/substitute.h"
+
+namespace starrocks {
+
+namespace {
+
+class SortedKeys {
+public:
+    explicit SortedKeys(const Columns& keys) : _keys(keys) {
+        _num_rows = keys.empty() ? 0 : keys[0]->size();
+        for (const auto& key : keys) {
+            if (key->has_null()) {
+                _null_columns.emplace_back(down_cast<const NullableColumn*>(key.get())->immutable_null_column_data().data());
+            }
+        }
+    }
+
+    size_t num_rows() const { return _num_rows; }
+
+    bool has_null(size_t row) const {
+        for (const uint8_t* nulls : _null_columns) {
+            if (nulls[row]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int compare(size_t row, const SortedKeys& rhs, size_t rhs_row) const {
+        for (size_t i = 0; i < _keys.size(); ++i) {
+            int c = _keys[i]->compare_at(row, rhs_row, *rhs._keys[i], -1);
+            if (c != 0) {
+                return c;
+            }
+        }
+        return 0;
+    }
+
+    // the end of the run of rows which are equal to `row`
+    size_t run_end(size_t row) const {
+        size_t end = row + 1;
+        while (end < _num_rows && compare(row, *this, end) == 0) {
+            ++end;
+        }
+        return end;
+    }
+
+private:
+    const Columns& _keys;
+    std::vector<const uint8_t*> _null_columns;
+    size_t _num_rows = 0;
+};
+
+} // namespace
+
+Status merge_join_sorted_columns(TJoinOp::type join_type, const Columns& left_keys, const Columns& right_keys,
+                                 MergeJoinResult* result) {
+    if (left_keys.size() != right_keys.size() || left_keys.empty()) {
+        return Status::InvalidArgument(strings::Substitute("merge join keys mismatch, left: $0, right: $1",
+                                                           left_keys.size(), right_keys.size()));
+    }
+    const bool emit_unmatched = join_type == TJoinOp::LEFT_OUTER_JOIN || join_type == TJoinOp::LEFT_ANTI_JOIN;
+    const bool emit_matched = join_type != TJoinOp::LEFT_ANTI_JOIN;
+    const bool emit_once = join_type == TJoinOp::LEFT_SEMI_JOIN;
+    if (join_type != TJoinOp::INNER_JOIN && !emit_unmatched && !emit_once) {
+        return Status::NotSupported(strings::Substitute("merge join doesn't support join type $0", join_type));
+    }
+
+    SortedKeys left(left_keys);
+    SortedKeys right(right_keys);
+
+    auto append_unmatched = [&](size_t l) {
+        if (emit_unmatched) {
+            result->left_index.push_back(l);
+            result->right_index.push_back(0);
+            result->right_is_null.push_back(1);
+        }
+    };
+
+    size_t l = 0;
+    size_t r = 0;
+    while (l < left.num_rows()) {
+        if (left.has_null(l)) {
+            append_unmatched(l++);
+            continue;
+        }
+        while (r < right.num_rows() && right.has_null(r)) {
+            ++r;
+        }
+        if (r >= right.num_rows()) {
+            append_unmatched(l++);
+            continue;
+        }
+
+        int c = left.compare(l, right, r);
+        if (c < 0) {
+            append_unmatched(l++);
+        } else if (c > 0) {
+            ++r;
+        } else {
+            size_t l_end = left.run_end(l);
+            size_t r_end = right.run_end(r);
+            if (emit_matched) {
+                size_t match_rows = emit_once ? 1 : r_end - r;
+                for (size_t i = l; i < l_end; ++i) {
+                    for (size_t j = r; j < r + match_rows; ++j) {
+                        result->left_index.push_back(i);
+                        result->right_index.push_back(j);
+                        result->right_is_null.push_back(0);
+                    }
+                }
+            }
+            l = l_end;
+            r = r_end;
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "gen_cpp/PlanNodes_types.h"
+
+namespace starrocks {
+
+// Output of merge join, the i-th output row is composed of left row `left_index[i]` and right row `right_index[i]`.
+// `right_is_null[i]` is set to 1 when left row `left_index[i]` has no matched right rows (outer join).
+struct MergeJoinResult {
+    Buffer<uint32_t> left_index;
+    Buffer<uint32_t> right_index;
+    Filter right_is_null;
+
+    size_t size() const { return left_index.size(); }
+
+    void clear() {
+        left_index.clear();
+        right_index.clear();
+        right_is_null.clear();
+    }
+};
+
+// Equi-join two inputs which are both sorted by the join keys in ascending order. Different from hash join,
+// the memory consumed is only the output indexes, and cost grows linearly with the input size even if
+// a single key is heavily skewed, which makes it a good fit to join sorted (or spilled and sorted) runs.
+//
+// Rows with NULL in any join key never match.
+// Only INNER_JOIN, LEFT_OUTER_JOIN, LEFT_SEMI_JOIN and LEFT_ANTI_JOIN are supported.
+//
+// @param left_keys join key columns of left input
+// @param right_keys join key columns of right input, must have the same types of `left_keys`
+// @param result matched (and unmatched for outer/anti join) row pairs are appended to it
+Status merge_join_sorted_columns(TJoinOp::type join_type, const Columns& left_keys, const Columns& right_keys,
+                                 MergeJoinResult* result);
+
+} // namespace starrocks
@@ -0,0 +1,280 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/sorting/range_merge.h"
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "runtime/chunk_cursor.h"
+
+namespace starrocks {
+
+std::pair<size_t, size_t> RangePartitionedMerger::SortedStream::locate(size_t row) const {
+    DCHECK_LT(row, num_rows());
+    const size_t run_idx = std::upper_bound(offsets.begin(), offsets.end(), row) - offsets.begin() - 1;
+    return {run_idx, runs.get_run(run_idx).start_index() + row - offsets[run_idx]};
+}
+
+RangePartitionedMerger::RangePartitionedMerger(size_t chunk_size, int32_t degree_of_parallelism,
+                                               std::vector<ExprContext*> sort_exprs, const SortDescs& sort_descs,
+                                               std::vector<SinkChunkProvider> chunk_providers)
+        : _chunk_size(chunk_size),
+          _degree_of_parallelism(degree_of_parallelism),
+          _sort_exprs(std::move(sort_exprs)),
+          _sort_descs(sort_descs) {
+    DCHECK_EQ(degree_of_parallelism, chunk_providers.size());
+    _partitions.reserve(degree_of_parallelism);
+    for (auto& provider : chunk_providers) {
+        auto partition = std::make_unique<Partition>();
+        partition->provider = std::move(provider);
+        _partitions.emplace_back(std::move(partition));
+    }
+}
+
+void RangePartitionedMerger::bind_profile(int32_t parallel_idx, RuntimeProfile* profile) {
+    auto& partition = *_partitions[parallel_idx];
+    partition.fetch_timer = ADD_TIMER(profile, "RangeMergeFetchTime");
+    partition.split_timer = ADD_TIMER(profile, "RangeMergeSplitTime");
+    partition.merge_timer = ADD_TIMER(profile, "RangeMergeTime");
+    partition.merged_rows = ADD_COUNTER(profile, "RangeMergeRows", TUnit::UNIT);
+}
+
+bool RangePartitionedMerger::has_output(int32_t parallel_idx) {
+    auto& partition = *_partitions[parallel_idx];
+    if (!partition.fetched) {
+        return partition.provider(true, nullptr, nullptr);
+    }
+    if (!_split_done.load(std::memory_order_acquire)) {
+        return false;
+    }
+    if (!partition.merged.load(std::memory_order_acquire)) {
+        return true;
+    }
+    return parallel_idx == 0 && !_output_finished && _has_output_chunk();
+}
+
+bool RangePartitionedMerger::is_finished(int32_t parallel_idx) const {
+    if (parallel_idx == 0) {
+        return _output_finished;
+    }
+    return _partitions[parallel_idx]->merged.load(std::memory_order_acquire);
+}
+
+StatusOr<ChunkPtr> RangePartitionedMerger::try_get_next(int32_t parallel_idx) {
+    auto& partition = *_partitions[parallel_idx];
+    if (!partition.fetched) {
+        RETURN_IF_ERROR(_fetch(parallel_idx));
+        return nullptr;
+    }
+    if (!_split_done.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    if (!partition.merged.load(std::memory_order_acquire)) {
+        RETURN_IF_ERROR(_merge(parallel_idx));
+    }
+    if (parallel_idx != 0) {
+        return nullptr;
+    }
+    return _pop_output();
+}
+
+Status RangePartitionedMerger::_fetch(int32_t parallel_idx) {
+    auto& partition = *_partitions[parallel_idx];
+    {
+        SCOPED_TIMER(partition.fetch_timer);
+        for (size_t i = 0; i < kMaxChunksPerCall && !partition.fetched; i++) {
+            ChunkPtr chunk;
+            bool eos = false;
+            if (!partition.provider(false, &chunk, &eos)) {
+                break;
+            }
+            if (chunk != nullptr && !chunk->is_empty()) {
+                SortedRun run(chunk, &_sort_exprs);
+                if (std::any_of(run.orderby.begin(), run.orderby.end(), [](const auto& c) { return c == nullptr; })) {
+                    return Status::InternalError("failed to evaluate the order by columns");
+                }
+                auto& stream = partition.stream;
+                stream.offsets.push_back(stream.num_rows() + run.num_rows());
+                stream.runs.chunks.emplace_back(std::move(run));
+            }
+            partition.fetched = eos;
+        }
+    }
+    // The last parallelism finishing fetching splits the key ranges for all.
+    if (partition.fetched && _num_fetched.fetch_add(1, std::memory_order_acq_rel) + 1 == _degree_of_parallelism) {
+        _split(parallel_idx);
+        _split_done.store(true, std::memory_order_release);
+    }
+    return Status::OK();
+}
+
+int RangePartitionedMerger::_compare_row(const SortedStream& lhs, size_t lhs_row, const SortedStream& rhs,
+                                         size_t rhs_row) const {
+    auto [lhs_run, lhs_index] = lhs.locate(lhs_row);
+    auto [rhs_run, rhs_index] = rhs.locate(rhs_row);
+    return lhs.runs.get_run(lhs_run).compare_row(_sort_descs, rhs.runs.get_run(rhs_run), lhs_index, rhs_index);
+}
+
+size_t RangePartitionedMerger::_lower_bound(const SortedStream& stream, const SortedStream& key_stream,
+                                            size_t key_row) const {
+    size_t first = 0;
+    size_t last = stream.num_rows();
+    while (first < last) {
+        const size_t mid = first + (last - first) / 2;
+        if (_compare_row(stream, mid, key_stream, key_row) < 0) {
+            first = mid + 1;
+        } else {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+void RangePartitionedMerger::_split(int32_t parallel_idx) {
+    SCOPED_TIMER(_partitions[parallel_idx]->split_timer);
+    const size_t num_ranges = _degree_of_parallelism;
+    size_t total_rows = 0;
+    for (const auto& partition : _partitions) {
+        total_rows += partition->stream.num_rows();
+    }
+
+    // Sample every stream with the same step, so every sample stands for the same number of rows.
+    const size_t step = std::max<size_t>(1, total_rows / (kSamplesPerSplitter * num_ranges));
+    std::vector<std::pair<size_t, size_t>> samples;
+    for (size_t s = 0; s < _partitions.size(); s++) {
+        const size_t num_rows = _partitions[s]->stream.num_rows();
+        for (size_t row = step / 2; row < num_rows; row += step) {
+            samples.emplace_back(s, row);
+        }
+    }
+    std::sort(samples.begin(), samples.end(), [this](const auto& lhs, const auto& rhs) {
+        return _compare_row(_partitions[lhs.first]->stream, lhs.second, _partitions[rhs.first]->stream,
+                            rhs.second) < 0;
+    });
+
+    _boundaries.assign(_partitions.size(), std::vector<size_t>(num_ranges - 1));
+    for (size_t s = 0; s < _partitions.size(); s++) {
+        const auto& stream = _partitions[s]->stream;
+        for (size_t range = 1; range < num_ranges; range++) {
+            if (samples.empty()) {
+                _boundaries[s][range - 1] = stream.num_rows();
+                continue;
+            }
+            const auto& [key_stream, key_row] = samples[range * samples.size() / num_ranges];
+            _boundaries[s][range - 1] = _lower_bound(stream, _partitions[key_stream]->stream, key_row);
+        }
+    }
+}
+
+Status RangePartitionedMerger::_init_merge(int32_t parallel_idx) {
+    std::vector<std::unique_ptr<SimpleChunkSortCursor>> cursors;
+    for (size_t s = 0; s < _partitions.size(); s++) {
+        const auto& stream = _partitions[s]->stream;
+        const size_t begin = parallel_idx == 0 ? 0 : _boundaries[s][parallel_idx - 1];
+        const size_t end =
+                parallel_idx == _degree_of_parallelism - 1 ? stream.num_rows() : _boundaries[s][parallel_idx];
+        if (begin >= end) {
+            continue;
+        }
+        // Provide the rows [begin, end) of the stream chunk by chunk.
+        ChunkProvider provider = [&stream, pos = begin, end](ChunkUniquePtr* out_chunk, bool* eos) mutable {
+            // The data is always ready
+            if (out_chunk == nullptr || eos == nullptr) {
+                return true;
+            }
+            if (pos >= end) {
+                *eos = true;
+                return false;
+            }
+            auto [run_idx, row] = stream.locate(pos);
+            const auto& run = stream.runs.get_run(run_idx);
+            const size_t num_rows = std::min(run.end_index() - row, end - pos);
+            *out_chunk = SortedRun(run, row, row + num_rows).clone_slice();
+            pos += num_rows;
+            return true;
+        };
+        cursors.emplace_back(std::make_unique<SimpleChunkSortCursor>(std::move(provider), &_sort_exprs));
+    }
+
+    auto& partition = *_partitions[parallel_idx];
+    if (cursors.empty()) {
+        std::lock_guard<std::mutex> l(partition.output_mutex);
+        partition.merged.store(true, std::memory_order_release);
+        return Status::OK();
+    }
+    partition.merger = std::make_unique<MergeCursorsCascade>();
+    RETURN_IF_ERROR(partition.merger->init(_sort_descs, std::move(cursors)));
+    CHECK(partition.merger->is_data_ready()) << "data must be ready";
+    return Status::OK();
+}
+
+Status RangePartitionedMerger::_merge(int32_t parallel_idx) {
+    auto& partition = *_partitions[parallel_idx];
+    SCOPED_TIMER(partition.merge_timer);
+    if (partition.merger == nullptr) {
+        RETURN_IF_ERROR(_init_merge(parallel_idx));
+        if (partition.merged.load(std::memory_order_acquire)) {
+            return Status::OK();
+        }
+    }
+
+    for (size_t i = 0; i < kMaxChunksPerCall && !partition.merger->is_eos();) {
+        ChunkUniquePtr chunk = partition.merger->try_get_next();
+        if (chunk == nullptr || chunk->is_empty()) {
+            continue;
+        }
+        COUNTER_UPDATE(partition.merged_rows, chunk->num_rows());
+        std::lock_guard<std::mutex> l(partition.output_mutex);
+        partition.output_chunks.emplace_back(std::move(chunk));
+        i++;
+    }
+    if (partition.merger->is_eos()) {
+        std::lock_guard<std::mutex> l(partition.output_mutex);
+        partition.merged.store(true, std::memory_order_release);
+        partition.merger.reset();
+    }
+    return Status::OK();
+}
+
+bool RangePartitionedMerger::_has_output_chunk() {
+    if (!_current_chunk.empty() || _output_partition >= _partitions.size()) {
+        return true;
+    }
+    auto& partition = *_partitions[_output_partition];
+    std::lock_guard<std::mutex> l(partition.output_mutex);
+    return !partition.output_chunks.empty() || partition.merged.load(std::memory_order_relaxed);
+}
+
+ChunkPtr RangePartitionedMerger::_pop_output() {
+    while (_output_partition < _partitions.size()) {
+        if (!_current_chunk.empty()) {
+            return _current_chunk.cutoff(_chunk_size);
+        }
+        auto& partition = *_partitions[_output_partition];
+        std::lock_guard<std::mutex> l(partition.output_mutex);
+        if (!partition.output_chunks.empty()) {
+            _current_chunk.reset(std::move(partition.output_chunks.front()));
+            partition.output_chunks.pop_front();
+        } else if (partition.merged.load(std::memory_order_relaxed)) {
+            _output_partition++;
+        } else {
+            return nullptr;
+        }
+    }
+    _output_finished = true;
+    return nullptr;
+}
+
+} // namespace starrocks
@@ -0,0 +1,129 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "column/column_helper.h"
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "exec/sorting/merge.h"
+#include "exec/sorting/sorting.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// RangePartitionedMerger merges the sorted streams of all the parallel sort sinks with sample sort,
+// instead of the multi-level cascade merge of merge_path::MergePathCascadeMerger.
+//
+// 1. FETCH: every parallelism collects the whole sorted output of its own sink.
+// 2. SPLIT: the last one finishing FETCH samples all the sorted streams evenly, picks the
+//    (degree_of_parallelism - 1) splitters from the samples, and binary searches them in every stream.
+// 3. MERGE: the i-th parallelism merges the i-th key range of all the streams in one level, so all the
+//    parallelisms merge disjoint ranges concurrently.
+// 4. OUTPUT: the parallelism 0 outputs the merged ranges one after another, which is the total order.
+//
+// The rows equal to a splitter always go to the range after it, so a range may be larger than the others
+// if there are many duplicated keys.
+class RangePartitionedMerger {
+public:
+    // Same as merge_path::MergePathChunkProvider.
+    using SinkChunkProvider = std::function<bool(bool only_check_if_has_data, ChunkPtr* chunk, bool* eos)>;
+
+    // Number of the samples taken for every splitter.
+    static constexpr size_t kSamplesPerSplitter = 64;
+    // Max number of the chunks a parallelism fetches or merges in one try_get_next call.
+    static constexpr size_t kMaxChunksPerCall = 16;
+
+    RangePartitionedMerger(size_t chunk_size, int32_t degree_of_parallelism, std::vector<ExprContext*> sort_exprs,
+                           const SortDescs& sort_descs, std::vector<SinkChunkProvider> chunk_providers);
+
+    // Return true if try_get_next of `parallel_idx` can make progress.
+    bool has_output(int32_t parallel_idx);
+
+    // Return true if `parallel_idx` has done all its work.
+    bool is_finished(int32_t parallel_idx) const;
+
+    // Do the work of `parallel_idx`, only the parallel_idx 0 returns chunks.
+    StatusOr<ChunkPtr> try_get_next(int32_t parallel_idx);
+
+    void bind_profile(int32_t parallel_idx, RuntimeProfile* profile);
+
+    // The first row of key range i (i > 0) in every stream, for tests.
+    const std::vector<std::vector<size_t>>& range_boundaries() const { return _boundaries; }
+
+private:
+    // The whole sorted output of one sink, with random access to its rows.
+    struct SortedStream {
+        SortedRuns runs;
+        // offsets[i] is the first row of runs[i], offsets.back() is the number of the rows.
+        std::vector<size_t> offsets{0};
+
+        size_t num_rows() const { return offsets.back(); }
+        // Return the run index and the row index in the run of the `row`-th row.
+        std::pair<size_t, size_t> locate(size_t row) const;
+    };
+
+    struct Partition {
+        SinkChunkProvider provider;
+        SortedStream stream;
+        bool fetched = false;
+
+        // Merges the slices of all the streams in this key range.
+        std::unique_ptr<MergeCursorsCascade> merger;
+
+        std::mutex output_mutex;
+        std::deque<ChunkUniquePtr> output_chunks;
+        std::atomic<bool> merged{false};
+
+        RuntimeProfile::Counter* fetch_timer = nullptr;
+        RuntimeProfile::Counter* split_timer = nullptr;
+        RuntimeProfile::Counter* merge_timer = nullptr;
+        RuntimeProfile::Counter* merged_rows = nullptr;
+    };
+
+    Status _fetch(int32_t parallel_idx);
+    void _split(int32_t parallel_idx);
+    // Return the first row of `stream` not less than the `key_row`-th row of `key_stream`.
+    size_t _lower_bound(const SortedStream& stream, const SortedStream& key_stream, size_t key_row) const;
+    int _compare_row(const SortedStream& lhs, size_t lhs_row, const SortedStream& rhs, size_t rhs_row) const;
+    Status _merge(int32_t parallel_idx);
+    Status _init_merge(int32_t parallel_idx);
+    ChunkPtr _pop_output();
+    bool _has_output_chunk();
+
+    const size_t _chunk_size;
+    const int32_t _degree_of_parallelism;
+    const std::vector<ExprContext*> _sort_exprs;
+    const SortDescs _sort_descs;
+    std::vector<std::unique_ptr<Partition>> _partitions;
+
+    std::atomic<int32_t> _num_fetched{0};
+    std::atomic<bool> _split_done{false};
+    // _boundaries[s][i] is the first row of key range i + 1 in stream s.
+    std::vector<std::vector<size_t>> _boundaries;
+
+    // Only accessed by the parallelism 0.
+    size_t _output_partition = 0;
+    ChunkSlice _current_chunk;
+    bool _output_finished = false;
+};
+
+} // namespace starrocks
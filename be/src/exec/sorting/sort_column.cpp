@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cstring>
 #include <utility>
 
 #include "column/array_column.h"
@@ -27,9 +28,11 @@
 #include "column/map_column.h"
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
+#include "gutil/endian.h"
 #include "util/orlp/pdqsort.h"
 
 namespace starrocks {
@@ -65,6 +68,14 @@ private:
     size_t _next_index = 0;
 };
 
+// The first 8 bytes of the string in big endian padded with zeros, so that comparing the prefixes of two strings as
+// integers gives the same order as memcmp, except that the equal prefixes need a full comparison.
+static inline uint64_t string_sort_prefix(const Slice& slice) {
+    uint64_t prefix = 0;
+    memcpy(&prefix, slice.data, std::min<size_t>(slice.size, sizeof(prefix)));
+    return BigEndian::FromHost64(prefix);
+}
+
 template <typename T>
 concept RangeOrRanges = std::is_same_v<T, std::pair<int, int>> || std::is_same_v<T, Ranges>;
 
@@ -170,6 +181,10 @@ public:
             DCHECK_GE(column.size(), _permutation.size());
         }
 
+        if (config::enable_sort_string_prefix) {
+            return _sort_by_string_prefix(column, column.get_proxy_data());
+        }
+
         using ItemType = InlinePermuteItem<Slice>;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
             return lhs.inline_value.compare(rhs.inline_value);
@@ -219,6 +234,35 @@ public:
     }
 
 private:
+    // Inline the first 8 bytes of every string as a big-endian integer instead of the slice, so that most of the
+    // comparisons are resolved by the integers in the permutation, and only the equal prefixes read the strings.
+    template <class Container>
+    Status _sort_by_string_prefix(const Column& column, const Container& slices) {
+        using ItemType = InlinePermuteItem<uint64_t>;
+        auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
+            if (lhs.inline_value != rhs.inline_value) {
+                return lhs.inline_value < rhs.inline_value ? -1 : 1;
+            }
+            return slices[lhs.index_in_chunk].compare(slices[rhs.index_in_chunk]);
+        };
+
+        InlinePermutation<uint64_t> inlined(_permutation.size());
+        for (size_t i = 0; i < _permutation.size(); i++) {
+            const uint32_t index = _permutation[i].index_in_chunk;
+            inlined[i].index_in_chunk = index;
+            if constexpr (IS_RANGES) {
+                if (index >= slices.size()) {
+                    continue;
+                }
+            }
+            inlined[i].inline_value = string_sort_prefix(slices[index]);
+        }
+        RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp,
+                                            _range_or_ranges, _build_tie));
+        restore_inline_permutation(inlined, _permutation);
+        return Status::OK();
+    }
+
     const std::atomic<bool>& _cancel;
     const SortDesc& _sort_desc;
     SmallPermutation& _permutation;
@@ -468,6 +512,192 @@ private:
     size_t _pruned_limit; // The pruned limit during partial sorting
 };
 
+// Encode the leading sort keys of every row into an unsigned integer with the same order, so that these keys can be
+// sorted together by integer comparison instead of column by column.
+// A key takes a null bit if it has nulls, followed by the order-preserving bits of its value, which are inverted for
+// the descending order. Only a prefix of a string is encoded, so a string key is always the last encoded one and
+// its ties must be broken by the column-wise sort.
+class NormalizedKeyEncoder final : public ColumnVisitorAdapter<NormalizedKeyEncoder> {
+public:
+    static constexpr int kMaxBits = sizeof(uint128_t) * 8;
+    static constexpr int kMaxStringPrefix = 8;
+
+    explicit NormalizedKeyEncoder(size_t num_rows) : ColumnVisitorAdapter(this), _keys(num_rows, 0) {}
+
+    // Append the key of the column to the encoded keys.
+    // Returns false if the type of the column is not supported or the remaining bits are not enough for it.
+    bool append(const Column* column, const SortDesc& sort_desc) {
+        _sort_desc = sort_desc;
+        _null_data = nullptr;
+        _appended = false;
+        if (column->is_nullable()) {
+            const auto* nullable = down_cast<const NullableColumn*>(column);
+            if (nullable->has_null()) {
+                _null_data = &nullable->immutable_null_column_data();
+            }
+            column = nullable->data_column().get();
+        }
+        return column->accept(this).ok() && _appended;
+    }
+
+    // Whether the order of the encoded keys is the same as the order of the columns, including the equality.
+    bool exact() const { return _exact; }
+    int used_bits() const { return _used_bits; }
+    const std::vector<uint128_t>& keys() const { return _keys; }
+
+    template <typename T>
+    Status do_visit(const FixedLengthColumnBase<T>& column) {
+        const auto& data = column.get_data();
+        if constexpr (std::is_same_v<T, DateValue>) {
+            _append(32, [&](size_t i) { return uint128_t(static_cast<uint32_t>(data[i].julian()) ^ (1u << 31)); });
+        } else if constexpr (std::is_same_v<T, TimestampValue>) {
+            _append(64, [&](size_t i) {
+                return uint128_t(static_cast<uint64_t>(data[i].timestamp()) ^ (uint64_t(1) << 63));
+            });
+        } else if constexpr (std::is_same_v<T, int128_t>) {
+            _append(128, [&](size_t i) { return static_cast<uint128_t>(data[i]) ^ (uint128_t(1) << 127); });
+        } else if constexpr (std::is_integral_v<T>) {
+            using U = std::make_unsigned_t<T>;
+            constexpr int bits = sizeof(T) * 8;
+            _append(bits, [&](size_t i) {
+                auto value = static_cast<U>(data[i]);
+                if constexpr (std::is_signed_v<T>) {
+                    value = static_cast<U>(value ^ (U(1) << (bits - 1)));
+                }
+                return uint128_t(value);
+            });
+        }
+        // Floating points are not encoded, since NaN is sorted as zero.
+        return Status::OK();
+    }
+
+    template <typename T>
+    Status do_visit(const BinaryColumnBase<T>& column) {
+        const int null_bits = _null_data != nullptr ? 1 : 0;
+        const int prefix = std::min(kMaxStringPrefix, (kMaxBits - _used_bits - null_bits) / 8);
+        if (prefix <= 0) {
+            return Status::OK();
+        }
+        const auto& slices = column.get_proxy_data();
+        _append(prefix * 8, [&](size_t i) {
+            const Slice& slice = slices[i];
+            const size_t n = std::min<size_t>(prefix, slice.size);
+            uint128_t value = 0;
+            for (size_t j = 0; j < n; j++) {
+                value = (value << 8) | static_cast<uint8_t>(slice.data[j]);
+            }
+            return value << (8 * (prefix - n));
+        });
+        _exact = false;
+        return Status::OK();
+    }
+
+    Status do_visit(const NullableColumn& column) { return Status::OK(); }
+    Status do_visit(const ConstColumn& column) { return Status::OK(); }
+    Status do_visit(const ArrayColumn& column) { return Status::OK(); }
+    Status do_visit(const MapColumn& column) { return Status::OK(); }
+    Status do_visit(const StructColumn& column) { return Status::OK(); }
+    template <typename T>
+    Status do_visit(const ObjectColumn<T>& column) {
+        return Status::OK();
+    }
+    Status do_visit(const JsonColumn& column) { return Status::OK(); }
+
+private:
+    template <class ValueOf>
+    void _append(int value_bits, ValueOf&& value_of) {
+        const int width = value_bits + (_null_data != nullptr ? 1 : 0);
+        if (width > kMaxBits - _used_bits) {
+            return;
+        }
+        const uint128_t value_mask = value_bits == kMaxBits ? ~uint128_t(0) : (uint128_t(1) << value_bits) - 1;
+        const bool is_desc = !_sort_desc.asc_order();
+        // All the nulls have the same key, which is placed before or after all the non-null values.
+        const uint128_t null_key = uint128_t(_sort_desc.is_null_first() ? 0 : 1) << value_bits;
+        const uint128_t not_null_key = _null_data != nullptr ? uint128_t(_sort_desc.is_null_first() ? 1 : 0)
+                                                                       << value_bits
+                                                             : 0;
+        for (size_t i = 0; i < _keys.size(); i++) {
+            uint128_t key;
+            if (_null_data != nullptr && (*_null_data)[i]) {
+                key = null_key;
+            } else {
+                uint128_t value = value_of(i);
+                key = not_null_key | (is_desc ? ~value & value_mask : value);
+            }
+            _keys[i] = width == kMaxBits ? key : (_keys[i] << width) | key;
+        }
+        _used_bits += width;
+        _appended = true;
+    }
+
+    std::vector<uint128_t> _keys;
+    SortDesc _sort_desc;
+    const NullData* _null_data = nullptr;
+    int _used_bits = 0;
+    bool _exact = true;
+    bool _appended = false;
+};
+
+template <class KeyType>
+static Status sort_and_tie_normalized_keys(const std::atomic<bool>& cancel, const std::vector<uint128_t>& keys,
+                                           SmallPermutation& permutation, Tie& tie) {
+    if (UNLIKELY(cancel.load(std::memory_order_acquire))) {
+        return Status::Cancelled("Sort cancelled");
+    }
+    InlinePermutation<KeyType> inlined(permutation.size());
+    for (size_t i = 0; i < permutation.size(); i++) {
+        const uint32_t index = permutation[i].index_in_chunk;
+        inlined[i].index_in_chunk = index;
+        inlined[i].inline_value = static_cast<KeyType>(keys[index]);
+    }
+    ::pdqsort_branchless(inlined.begin(), inlined.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.inline_value < rhs.inline_value; });
+    for (size_t i = 1; i < inlined.size(); i++) {
+        tie[i] = inlined[i - 1].inline_value == inlined[i].inline_value;
+    }
+    if (!tie.empty()) {
+        tie[0] = 0;
+    }
+    restore_inline_permutation(inlined, permutation);
+    return Status::OK();
+}
+
+// Sort the rows by the normalized keys of the leading columns, see NormalizedKeyEncoder.
+// Returns the number of the leading columns whose order has been resolved, and builds the tie of them,
+// or returns 0 if there are not at least two columns could be encoded.
+static StatusOr<size_t> sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns,
+                                                const SortDescs& sort_desc, SmallPermutation& permutation, Tie& tie) {
+    if (!config::enable_sort_normalized_key || columns.size() < 2) {
+        return 0;
+    }
+    NormalizedKeyEncoder encoder(columns[0]->size());
+    size_t num_resolved = 0;
+    size_t num_encoded = 0;
+    for (; num_resolved < columns.size(); num_resolved++) {
+        const auto& column = columns[num_resolved];
+        if (column->is_constant()) {
+            continue;
+        }
+        if (!encoder.append(column.get(), sort_desc.get_column_desc(num_resolved))) {
+            break;
+        }
+        num_encoded++;
+        if (!encoder.exact()) {
+            break;
+        }
+    }
+    if (num_encoded < 2) {
+        return 0;
+    }
+    if (encoder.used_bits() <= 64) {
+        RETURN_IF_ERROR(sort_and_tie_normalized_keys<uint64_t>(cancel, encoder.keys(), permutation, tie));
+    } else {
+        RETURN_IF_ERROR(sort_and_tie_normalized_keys<uint128_t>(cancel, encoder.keys(), permutation, tie));
+    }
+    return num_resolved;
+}
+
 Status sort_and_tie_column(const std::atomic<bool>& cancel, const ColumnPtr& column, const SortDesc& sort_desc,
                            SmallPermutation& permutation, Tie& tie, std::pair<int, int> range, bool build_tie) {
     ColumnSorter column_sorter(cancel, sort_desc, permutation, tie, range, build_tie);
@@ -506,7 +736,8 @@ Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& colu
     std::pair<int, int> range{0, num_rows};
     SmallPermutation small_perm = create_small_permutation(num_rows);
 
-    for (int col_index = 0; col_index < columns.size(); col_index++) {
+    ASSIGN_OR_RETURN(const size_t num_sorted, sort_by_normalized_keys(cancel, columns, sort_desc, small_perm, tie));
+    for (int col_index = num_sorted; col_index < columns.size(); col_index++) {
         ColumnPtr column = columns[col_index];
         bool build_tie = col_index != columns.size() - 1;
         RETURN_IF_ERROR(sort_and_tie_column(cancel, column, sort_desc.get_column_desc(col_index), small_perm, tie,
@@ -588,7 +819,8 @@ Status stable_sort_and_tie_columns(const std::atomic<bool>& cancel, const Column
     Tie tie(num_rows, 1);
     std::pair<int, int> range{0, num_rows};
 
-    for (int col_index = 0; col_index < columns.size(); col_index++) {
+    ASSIGN_OR_RETURN(const size_t num_sorted, sort_by_normalized_keys(cancel, columns, sort_desc, *small_perm, tie));
+    for (int col_index = num_sorted; col_index < columns.size(); col_index++) {
         ColumnPtr column = columns[col_index];
         RETURN_IF_ERROR(sort_and_tie_column(cancel, column, sort_desc.get_column_desc(col_index), *small_perm, tie,
                                             range, true));
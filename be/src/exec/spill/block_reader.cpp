@@ -12,11 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/spill/block_manager.h"
 #include "fmt/format.h"
 #include "io/input_stream.h"
 #include "util/slice.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks::spill {
 
@@ -43,6 +45,14 @@ Status BlockReader::read_fully(void* data, int64_t count) {
     if (_readable == nullptr) {
         ASSIGN_OR_RETURN(_readable, _block->get_readable());
         _length = _block->size();
+        if (_block->is_remote() && config::spill_remote_read_ahead_bytes > 0) {
+            // every read of a remote block is a range request
+            auto read_ahead_bytes = static_cast<size_t>(config::spill_remote_read_ahead_bytes);
+            _options.max_buffer_bytes = _options.enable_buffer_read
+                                                ? std::max(_options.max_buffer_bytes, read_ahead_bytes)
+                                                : read_ahead_bytes;
+            _options.enable_buffer_read = true;
+        }
         // init buffer
         if (_options.enable_buffer_read) {
             _options.max_buffer_bytes = std::min(_options.max_buffer_bytes, _length);
@@ -76,6 +86,7 @@ Status BlockReader::read_fully(void* data, int64_t count) {
                 ASSIGN_OR_RETURN(auto read_len, try_to_read_from_file(_readable.get(), offset, length_need_read));
                 _slice.clear();
                 COUNTER_UPDATE(_options.read_io_bytes, read_len);
+                StarRocksMetrics::instance()->spill_read_bytes_total.increment(read_len);
             } else {
                 // refill buffer, then read res data from buffer
                 SCOPED_TIMER(_options.read_io_timer);
@@ -86,6 +97,7 @@ Status BlockReader::read_fully(void* data, int64_t count) {
                 std::memcpy(offset, _slice.data, length_need_read);
                 _slice.remove_prefix(length_need_read);
                 COUNTER_UPDATE(_options.read_io_bytes, read_len);
+                StarRocksMetrics::instance()->spill_read_bytes_total.increment(read_len);
             }
         }
     } else {
@@ -93,6 +105,7 @@ Status BlockReader::read_fully(void* data, int64_t count) {
         COUNTER_UPDATE(_options.read_io_count, 1);
         ASSIGN_OR_RETURN(auto read_len, try_to_read_from_file(_readable.get(), data, count));
         COUNTER_UPDATE(_options.read_io_bytes, read_len);
+        StarRocksMetrics::instance()->spill_read_bytes_total.increment(read_len);
     }
     _offset += count;
     return Status::OK();
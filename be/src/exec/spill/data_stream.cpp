@@ -21,6 +21,7 @@
 #include "exec/spill/serde.h"
 #include "exec/spill/spiller.h"
 #include "runtime/runtime_state.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks::spill {
 // spill output stream. output serialized chunk data to BlockManager and add handle to block group.
@@ -89,6 +90,7 @@ Status BlockSpillOutputDataStream::append(RuntimeState* state, const std::vector
         _cur_block->inc_num_rows(write_num_rows);
         auto flush_bytes = GET_METRICS(_cur_block->is_remote(), _spiller->metrics(), flush_bytes);
         COUNTER_UPDATE(flush_bytes, total_write_size);
+        StarRocksMetrics::instance()->spill_write_bytes_total.increment(total_write_size);
         (*_spiller->metrics().total_spill_bytes) += total_write_size;
     }
     return Status::OK();
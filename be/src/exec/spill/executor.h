@@ -96,6 +96,12 @@ struct SpillIOTaskContext {
 };
 using SpillIOTaskContextPtr = std::shared_ptr<SpillIOTaskContext>;
 
+// The priorities of the spill io tasks in the scan task queue of their workgroup, where the scan tasks are of
+// [0, 20] and the waiting tasks age up. A restore blocks the driver reading it, while a flush only blocks its
+// driver once all the mem tables are full, so the restores go first.
+constexpr int SPILL_RESTORE_TASK_PRIORITY = 20;
+constexpr int SPILL_FLUSH_TASK_PRIORITY = 0;
+
 struct IOTaskExecutor {
     static Status submit(workgroup::ScanTask task) {
         const auto& task_ctx = task.get_work_context();
@@ -16,6 +16,7 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "exec/spill/block_manager.h"
 #include "exec/spill/common.h"
 #include "fmt/format.h"
@@ -105,6 +106,9 @@ Status FileBlockContainer::open() {
     std::string file_path = path();
     WritableFileOptions opt;
     opt.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE;
+    if (_dir->is_remote()) {
+        opt.max_inflight_upload_parts = std::max<int64_t>(1, config::spill_remote_max_inflight_upload_parts);
+    }
     ASSIGN_OR_RETURN(_writable_file, _dir->fs()->new_writable_file(opt, file_path));
     TRACE_SPILL_LOG << "create new container file: " << file_path;
     _has_open = true;
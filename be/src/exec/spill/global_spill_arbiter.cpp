@@ -0,0 +1,104 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exec/spill/global_spill_arbiter.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "exec/spill/query_spill_manager.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
+#include "util/starrocks_metrics.h"
+#include "util/time.h"
+
+namespace starrocks::spill {
+
+GlobalSpillArbiter* GlobalSpillArbiter::instance() {
+    static GlobalSpillArbiter arbiter;
+    return &arbiter;
+}
+
+void GlobalSpillArbiter::register_query(QuerySpillManager* query) {
+    std::lock_guard<std::mutex> l(_mutex);
+    _queries.insert(query);
+}
+
+void GlobalSpillArbiter::unregister_query(QuerySpillManager* query) {
+    std::lock_guard<std::mutex> l(_mutex);
+    _queries.erase(query);
+}
+
+void GlobalSpillArbiter::maybe_arbitrate() {
+    if (config::spill_arbiter_mem_pressure_ratio <= 0) {
+        return;
+    }
+    int64_t now = MonotonicMillis();
+    int64_t last = _last_arbitrate_ms.load(std::memory_order_relaxed);
+    if (now - last < config::spill_arbiter_interval_ms || !_last_arbitrate_ms.compare_exchange_strong(last, now)) {
+        return;
+    }
+    arbitrate(GlobalEnv::GetInstance()->process_mem_tracker());
+}
+
+size_t GlobalSpillArbiter::arbitrate(MemTracker* process_mem_tracker) {
+    if (process_mem_tracker == nullptr || !process_mem_tracker->has_limit() ||
+        config::spill_arbiter_mem_pressure_ratio <= 0) {
+        return 0;
+    }
+    const auto threshold =
+            static_cast<int64_t>(process_mem_tracker->limit() * config::spill_arbiter_mem_pressure_ratio);
+    const int64_t excess_bytes = process_mem_tracker->consumption() - threshold;
+    if (excess_bytes <= 0) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> l(_mutex);
+    std::vector<QuerySpillManager*> candidates;
+    for (auto* query : _queries) {
+        if (!query->spill_requested() && query->revocable_bytes() > 0) {
+            candidates.emplace_back(query);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const QuerySpillManager* lhs, const QuerySpillManager* rhs) {
+        if (lhs->spill_priority() != rhs->spill_priority()) {
+            return lhs->spill_priority() < rhs->spill_priority();
+        }
+        return lhs->revocable_bytes() > rhs->revocable_bytes();
+    });
+
+    size_t num_requested = 0;
+    int64_t requested_bytes = 0;
+    for (auto* query : candidates) {
+        if (requested_bytes >= excess_bytes) {
+            break;
+        }
+        query->request_spill();
+        num_requested++;
+        requested_bytes += query->revocable_bytes();
+    }
+    if (num_requested > 0) {
+        StarRocksMetrics::instance()->spill_arbiter_requested_queries_total.increment(num_requested);
+        StarRocksMetrics::instance()->spill_arbiter_requested_bytes_total.increment(requested_bytes);
+        LOG(INFO) << "process memory " << process_mem_tracker->consumption() << " exceeds the spill threshold "
+                  << threshold << ", asked " << num_requested << " of " << _queries.size()
+                  << " queries to spill, revocable bytes: " << requested_bytes;
+    }
+    return num_requested;
+}
+
+} // namespace starrocks::spill
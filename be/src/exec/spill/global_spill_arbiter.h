@@ -0,0 +1,57 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+
+namespace starrocks {
+class MemTracker;
+}
+
+namespace starrocks::spill {
+class QuerySpillManager;
+
+// Arbitrates the process memory among the queries that enable spill. Under process memory pressure, i.e. the
+// process memory exceeds config::spill_arbiter_mem_pressure_ratio of its limit, it asks the queries to spill in
+// order of their workgroup priority and revocable memory until the requested ones could release the excess,
+// rather than leaving the process memory limit to cancel whichever query allocates next.
+//
+// The arbitration is cooperative, a query is only marked by QuerySpillManager::request_spill and its operators
+// turn to the low memory mode on their own driver threads, see PipelineDriver::_try_to_release_buffer.
+class GlobalSpillArbiter {
+public:
+    static GlobalSpillArbiter* instance();
+
+    void register_query(QuerySpillManager* query);
+    void unregister_query(QuerySpillManager* query);
+
+    // Arbitrate against the process mem tracker at most once per config::spill_arbiter_interval_ms.
+    // Cheap enough to call on each memory check of the drivers.
+    void maybe_arbitrate();
+
+    // Returns the number of the queries newly asked to spill.
+    size_t arbitrate(MemTracker* process_mem_tracker);
+
+private:
+    std::mutex _mutex;
+    std::unordered_set<QuerySpillManager*> _queries;
+    std::atomic<int64_t> _last_arbitrate_ms = 0;
+};
+
+} // namespace starrocks::spill
@@ -477,15 +477,16 @@ StatusOr<InputStreamPtr> BlockGroupSet::as_unordered_stream(const SerdePtr& serd
 }
 
 StatusOr<InputStreamPtr> BlockGroupSet::as_ordered_stream(RuntimeState* state, const SerdePtr& serde, Spiller* spiller,
-                                                          const SortExecExprs* sort_exprs,
-                                                          const SortDescs* sort_descs) {
-    return build_ordered_stream(_groups, state, serde, spiller, sort_exprs, sort_descs);
+                                                          const SortExecExprs* sort_exprs, const SortDescs* sort_descs,
+                                                          std::vector<InputStreamPtr> resident_streams) {
+    return build_ordered_stream(_groups, state, serde, spiller, sort_exprs, sort_descs, std::move(resident_streams));
 }
 
 StatusOr<InputStreamPtr> BlockGroupSet::build_ordered_stream(std::vector<BlockGroupPtr>& block_groups,
                                                              RuntimeState* state, const SerdePtr& serde,
                                                              Spiller* spiller, const SortExecExprs* sort_exprs,
-                                                             const SortDescs* sort_descs) {
+                                                             const SortDescs* sort_descs,
+                                                             std::vector<InputStreamPtr> resident_streams) {
     BlockReaderOptions read_options;
     if (spiller->options().enable_buffer_read && block_groups.size() > 0) {
         size_t max_buffer_bytes = spiller->options().max_read_buffer_bytes / block_groups.size();
@@ -499,6 +500,9 @@ StatusOr<InputStreamPtr> BlockGroupSet::build_ordered_stream(std::vector<BlockGr
         auto stream = std::make_shared<SequenceInputStream>(group->blocks(), serde, read_options);
         streams.emplace_back(std::make_shared<BufferedInputStream>(chunk_buffer_max_size, stream, spiller));
     }
+    for (auto& stream : resident_streams) {
+        streams.emplace_back(std::move(stream));
+    }
 
     InputStreamPtr res;
     if (streams.empty() || state->is_cancelled()) {
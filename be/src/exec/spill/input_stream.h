@@ -142,12 +142,15 @@ public:
 
     StatusOr<InputStreamPtr> as_unordered_stream(const SerdePtr& serde, Spiller* spiller);
 
+    // |resident_streams| are the sorted runs still in memory, merged along with the block groups.
     StatusOr<InputStreamPtr> as_ordered_stream(RuntimeState* state, const SerdePtr& serde, Spiller* spiller,
-                                               const SortExecExprs* sort_exprs, const SortDescs* sort_descs);
+                                               const SortExecExprs* sort_exprs, const SortDescs* sort_descs,
+                                               std::vector<InputStreamPtr> resident_streams = {});
 
     static StatusOr<InputStreamPtr> build_ordered_stream(std::vector<BlockGroupPtr>& block_groups, RuntimeState* state,
                                                          const SerdePtr& serde, Spiller* spiller,
-                                                         const SortExecExprs* sort_exprs, const SortDescs* sort_descs);
+                                                         const SortExecExprs* sort_exprs, const SortDescs* sort_descs,
+                                                         std::vector<InputStreamPtr> resident_streams = {});
 
 private:
     mutable std::mutex _mutex;
@@ -189,6 +189,21 @@ void OrderedMemTable::reset() {
     _chunk.reset();
 }
 
+StatusOr<std::shared_ptr<SpillInputStream>> OrderedMemTable::as_input_stream(bool shared) {
+    DCHECK(_is_done);
+    std::vector<ChunkPtr> chunks;
+    while (!_chunk_slice.empty()) {
+        chunks.emplace_back(_chunk_slice.cutoff(_runtime_state->chunk_size()));
+    }
+    if (shared) {
+        _chunk_slice.reset(_chunk);
+    } else {
+        // the rows are owned by the stream now
+        reset();
+    }
+    return SpillInputStream::as_stream(std::move(chunks), _spiller);
+}
+
 StatusOr<ChunkPtr> OrderedMemTable::_do_sort(const ChunkPtr& chunk) {
     RETURN_IF_ERROR(chunk->upgrade_if_overflow());
     DataSegment segment(_sort_exprs, chunk);
@@ -136,6 +136,9 @@ public:
     Status finalize(workgroup::YieldContext& yield_ctx, const SpillOutputDataStreamPtr& output) override;
     void reset() override;
 
+    // the sorted rows, must be called after `done`
+    StatusOr<std::shared_ptr<SpillInputStream>> as_input_stream(bool shared) override;
+
 private:
     StatusOr<ChunkPtr> _do_sort(const ChunkPtr& chunk);
 
@@ -50,7 +50,15 @@ size_t OperatorMemoryResourceManager::operator_avaliable_memory_bytes() {
     return avaliable;
 }
 
+void OperatorMemoryResourceManager::update_revocable_bytes(int64_t bytes) {
+    if (_spillable && _query_spill_manager != nullptr && bytes != _revocable_bytes) {
+        _query_spill_manager->update_revocable_bytes(bytes - _revocable_bytes);
+        _revocable_bytes = bytes;
+    }
+}
+
 void OperatorMemoryResourceManager::close() {
+    update_revocable_bytes(0);
     if (_performance_level == MEM_RESOURCE_LOW_MEMORY && _query_spill_manager != nullptr) {
         _query_spill_manager->decrease_spilling_operators();
         _query_spill_manager->decrease_spillable_operators();
@@ -47,6 +47,9 @@ public:
 
     QuerySpillManager* query_spill_manager() const { return _query_spill_manager; }
 
+    // Report the current revocable memory of a spillable operator to its query, see GlobalSpillArbiter.
+    void update_revocable_bytes(int64_t bytes);
+
 private:
     // performance level. Determine the execution mode and whether memory can be freed early
     // A higher performance level will allow the operator to execute with less memory, which will reduce performance
@@ -56,5 +59,6 @@ private:
     OP* _op = nullptr;
     QuerySpillManager* _query_spill_manager = nullptr;
     bool _is_releasing = false;
+    int64_t _revocable_bytes = 0;
 };
 } // namespace starrocks::spill
\ No newline at end of file
@@ -107,6 +107,10 @@ struct SpilledOptions {
 
     bool enable_buffer_read = false;
     size_t max_read_buffer_bytes = UINT64_MAX;
+
+    // only for the ordered spill: on the final flush, keep the last mem table in memory and merge it with the
+    // spilled blocks on restore instead of writing it out and reading it back.
+    bool retain_final_mem_table = false;
 };
 
 // spill strategy
@@ -19,6 +19,7 @@
 
 #include "exec/spill/dir_manager.h"
 #include "exec/spill/file_block_manager.h"
+#include "exec/spill/global_spill_arbiter.h"
 #include "exec/spill/hybird_block_manager.h"
 #include "exec/spill/log_block_manager.h"
 #include "gen_cpp/InternalService_types.h"
@@ -26,6 +27,14 @@
 
 namespace starrocks::spill {
 
+QuerySpillManager::QuerySpillManager(const TUniqueId& uid) : _uid(uid) {
+    GlobalSpillArbiter::instance()->register_query(this);
+}
+
+QuerySpillManager::~QuerySpillManager() {
+    GlobalSpillArbiter::instance()->unregister_query(this);
+}
+
 Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options) {
     const TSpillOptions& spill_options = query_options.spill_options;
     bool enable_spill_to_remote_storage =
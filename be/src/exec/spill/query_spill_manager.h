@@ -27,7 +27,8 @@
 namespace starrocks::spill {
 class QuerySpillManager {
 public:
-    QuerySpillManager(const TUniqueId& uid) : _uid(uid) {}
+    QuerySpillManager(const TUniqueId& uid);
+    ~QuerySpillManager();
 
     Status init_block_manager(const TQueryOptions& query_options);
 
@@ -41,11 +42,27 @@ public:
 
     BlockManager* block_manager() const { return _block_manager.get(); }
 
+    // Set by GlobalSpillArbiter under process memory pressure, the releaseable operators of the query turn to
+    // the low memory mode on their next memory check.
+    void request_spill() { _spill_requested = true; }
+    bool spill_requested() const { return _spill_requested.load(std::memory_order_relaxed); }
+
+    // The memory the spillable operators of the query could release by spilling.
+    void update_revocable_bytes(int64_t delta) { _revocable_bytes.fetch_add(delta, std::memory_order_relaxed); }
+    int64_t revocable_bytes() const { return _revocable_bytes.load(std::memory_order_relaxed); }
+
+    // The queries of a lower priority are asked to spill first.
+    void set_spill_priority(int64_t priority) { _spill_priority = priority; }
+    int64_t spill_priority() const { return _spill_priority.load(std::memory_order_relaxed); }
+
 private:
     TUniqueId _uid;
     std::unique_ptr<BlockManager> _block_manager;
     std::unique_ptr<DirManager> _remote_dir_manager;
     std::atomic_size_t _spilling_operators = 0;
     size_t _spillable_operators = 0;
+    std::atomic<bool> _spill_requested = false;
+    std::atomic<int64_t> _revocable_bytes = 0;
+    std::atomic<int64_t> _spill_priority = 0;
 };
 } // namespace starrocks::spill
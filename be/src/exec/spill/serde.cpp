@@ -16,6 +16,7 @@
 
 #include <cstring>
 
+#include "common/config.h"
 #include "exec/spill/options.h"
 #include "exec/spill/spiller.h"
 #include "gen_cpp/types.pb.h"
@@ -23,6 +24,8 @@
 #include "runtime/runtime_state.h"
 #include "serde/column_array_serde.h"
 #include "serde/encode_context.h"
+#include "util/compression/block_compression.h"
+#include "util/crc32c.h"
 #include "util/raw_container.h"
 
 namespace starrocks::spill {
@@ -49,13 +52,30 @@ public:
 
 private:
     // data format
-    // header|encode levels|attachment...
+    // header|payload
     // header:
-    // i32 sequence_id|i64 attachment size
+    // i32 sequence_id|i64 attachment size|u32 checksum|i32 compression type|i64 stored payload size|i64 payload size
+    // payload, compressed as a whole unless the compression type is NO_COMPRESSION:
+    // encode levels|column data...
+    // the attachment is the stored payload padded to the alignment, and the checksum is the crc32c of the stored
+    // payload.
     static constexpr int32_t SEQUENCE_OFFSET = 0;
     static constexpr int32_t ATTACHMENT_SIZE_OFFSET = SEQUENCE_OFFSET + sizeof(int32_t);
-    static constexpr int32_t HEADER_SIZE = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
-    static constexpr int32_t SEQUENCE_MAGIC_ID = 0xface;
+    static constexpr int32_t CHECKSUM_OFFSET = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t COMPRESSION_OFFSET = CHECKSUM_OFFSET + sizeof(uint32_t);
+    static constexpr int32_t STORED_SIZE_OFFSET = COMPRESSION_OFFSET + sizeof(int32_t);
+    static constexpr int32_t PAYLOAD_SIZE_OFFSET = STORED_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t HEADER_SIZE = PAYLOAD_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t SEQUENCE_MAGIC_ID = 0xfacf;
+
+    // the compression is chosen by sampling: the payloads of the first config::spill_compression_sample_chunks
+    // chunks are compressed by both LZ4 and ZSTD, then the rest are compressed by ZSTD if it's notably smaller,
+    // by LZ4 if it saves enough, or not compressed.
+    static constexpr double ZSTD_RATIO_LIMIT = 0.8;
+
+    // compress |payload| into ctx.compress_buffer after the header, returns NO_COMPRESSION if it's not compressed.
+    StatusOr<CompressionTypePB> _compress(SerdeContext& ctx, const Slice& payload, size_t* stored_size);
+    StatusOr<size_t> _compress_by(CompressionTypePB type, SerdeContext& ctx, const Slice& payload);
 
     size_t _max_serialized_size(const ChunkPtr& chunk) const;
 
@@ -80,6 +100,13 @@ private:
     // here a std::shared_mutex is used to ensure concurrency safety.
     std::shared_mutex _mutex;
     std::shared_ptr<serde::EncodeContext> _encode_context;
+
+    std::atomic<int32_t> _num_sampled_chunks = 0;
+    int64_t _sampled_bytes = 0;
+    int64_t _sampled_lz4_bytes = 0;
+    int64_t _sampled_zstd_bytes = 0;
+    // UNKNOWN_COMPRESSION while sampling
+    std::atomic<CompressionTypePB> _compression = CompressionTypePB::UNKNOWN_COMPRESSION;
     DECLARE_RACE_DETECTOR(detect_prepare)
 };
 
@@ -99,26 +126,84 @@ size_t ColumnarSerde::_max_serialized_size(const ChunkPtr& chunk) const {
     return total_size;
 }
 
+StatusOr<size_t> ColumnarSerde::_compress_by(CompressionTypePB type, SerdeContext& ctx, const Slice& payload) {
+    const BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(type, &codec));
+    if (codec->exceed_max_input_size(payload.size)) {
+        return payload.size;
+    }
+    ctx.compress_buffer.resize(HEADER_SIZE + codec->max_compressed_len(payload.size));
+    Slice compressed(ctx.compress_buffer.data() + HEADER_SIZE, ctx.compress_buffer.size() - HEADER_SIZE);
+    RETURN_IF_ERROR(codec->compress(payload, &compressed));
+    return compressed.size;
+}
+
+StatusOr<CompressionTypePB> ColumnarSerde::_compress(SerdeContext& ctx, const Slice& payload, size_t* stored_size) {
+    *stored_size = payload.size;
+    const int32_t sample_chunks = config::spill_compression_sample_chunks;
+    if (sample_chunks <= 0) {
+        return CompressionTypePB::NO_COMPRESSION;
+    }
+    CompressionTypePB type = _compression.load(std::memory_order_relaxed);
+    if (type == CompressionTypePB::UNKNOWN_COMPRESSION) {
+        ASSIGN_OR_RETURN(size_t lz4_size, _compress_by(CompressionTypePB::LZ4, ctx, payload));
+        ASSIGN_OR_RETURN(size_t zstd_size, _compress_by(CompressionTypePB::ZSTD, ctx, payload));
+        {
+            std::unique_lock l(_mutex);
+            _sampled_bytes += payload.size;
+            _sampled_lz4_bytes += lz4_size;
+            _sampled_zstd_bytes += zstd_size;
+            if (++_num_sampled_chunks >= sample_chunks && _compression == CompressionTypePB::UNKNOWN_COMPRESSION) {
+                double lz4_ratio = 1.0 * _sampled_lz4_bytes / std::max<int64_t>(_sampled_bytes, 1);
+                double zstd_ratio = 1.0 * _sampled_zstd_bytes / std::max<int64_t>(_sampled_bytes, 1);
+                if (zstd_ratio < serde::EncodeRatioLimit && zstd_ratio < lz4_ratio * ZSTD_RATIO_LIMIT) {
+                    type = CompressionTypePB::ZSTD;
+                } else if (lz4_ratio < serde::EncodeRatioLimit) {
+                    type = CompressionTypePB::LZ4;
+                } else {
+                    type = CompressionTypePB::NO_COMPRESSION;
+                }
+                _compression = type;
+                TRACE_SPILL_LOG << "spill compression: " << CompressionTypePB_Name(type)
+                                << ", lz4 ratio: " << lz4_ratio << ", zstd ratio: " << zstd_ratio;
+            }
+        }
+        // the ZSTD one is left in the buffer
+        if (zstd_size >= payload.size) {
+            return CompressionTypePB::NO_COMPRESSION;
+        }
+        *stored_size = zstd_size;
+        return CompressionTypePB::ZSTD;
+    }
+    if (type == CompressionTypePB::NO_COMPRESSION) {
+        return type;
+    }
+    ASSIGN_OR_RETURN(size_t compressed_size, _compress_by(type, ctx, payload));
+    if (compressed_size >= payload.size) {
+        return CompressionTypePB::NO_COMPRESSION;
+    }
+    *stored_size = compressed_size;
+    return type;
+}
+
 Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const ChunkPtr& chunk,
                                 const SpillOutputDataStreamPtr& output, bool aligned) {
-    raw::RawString& serialize_buffer = ctx.serialize_buffer;
+    raw::RawString* serialize_buffer = &ctx.serialize_buffer;
     {
         SCOPED_TIMER(_parent->metrics().serialize_timer);
         size_t ALIGNED_SIZE = 1;
         if (aligned) {
             ALIGNED_SIZE = AlignedBuffer::PAGE_SIZE;
         }
-        ctx.serialize_buffer.clear();
+        serialize_buffer->clear();
         const auto& columns = chunk->columns();
-        // header|attachment...
-        // i32 sequence_id|i64 chunk size|encode level|attachment(column data)...
         char header_buffer[HEADER_SIZE];
         UNALIGNED_STORE32(header_buffer + SEQUENCE_OFFSET, SEQUENCE_MAGIC_ID);
 
         size_t encode_level_sizes = columns.size() * sizeof(int32_t);
         size_t max_serialized_size = _max_serialized_size(chunk);
-        ctx.serialize_buffer.resize(ALIGN_UP(HEADER_SIZE + encode_level_sizes + max_serialized_size, ALIGNED_SIZE));
-        uint8_t* buf = reinterpret_cast<uint8_t*>(serialize_buffer.data());
+        serialize_buffer->resize(ALIGN_UP(HEADER_SIZE + encode_level_sizes + max_serialized_size, ALIGNED_SIZE));
+        uint8_t* buf = reinterpret_cast<uint8_t*>(serialize_buffer->data());
         const uint8_t* head = buf;
 
         // acquire encode level
@@ -148,16 +233,29 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
             }
         }
         _update_encode_stats(column_stats);
-        // total serialized size
-        size_t content_length = buf - head;
-        auto align_size = ALIGN_UP(content_length + padding_size, ALIGNED_SIZE);
-        serialize_buffer.resize(align_size);
+
+        const size_t payload_size = buf - head - HEADER_SIZE;
+        size_t stored_size = 0;
+        ASSIGN_OR_RETURN(auto compression, _compress(ctx, Slice(head + HEADER_SIZE, payload_size), &stored_size));
+        if (compression != CompressionTypePB::NO_COMPRESSION) {
+            // the decompressed payload is padded on deserialization
+            serialize_buffer = &ctx.compress_buffer;
+            padding_size = 0;
+        }
+        const auto* stored = reinterpret_cast<const char*>(serialize_buffer->data()) + HEADER_SIZE;
+        UNALIGNED_STORE32(header_buffer + CHECKSUM_OFFSET, crc32c::Value(stored, stored_size));
+        UNALIGNED_STORE32(header_buffer + COMPRESSION_OFFSET, compression);
+        UNALIGNED_STORE64(header_buffer + STORED_SIZE_OFFSET, stored_size);
+        UNALIGNED_STORE64(header_buffer + PAYLOAD_SIZE_OFFSET, payload_size);
+
+        auto align_size = ALIGN_UP(HEADER_SIZE + stored_size + padding_size, ALIGNED_SIZE);
+        serialize_buffer->resize(align_size);
         UNALIGNED_STORE64(header_buffer + ATTACHMENT_SIZE_OFFSET, align_size - HEADER_SIZE);
-        memcpy(serialize_buffer.data(), header_buffer, HEADER_SIZE);
+        memcpy(serialize_buffer->data(), header_buffer, HEADER_SIZE);
     }
-    size_t written_bytes = serialize_buffer.size();
-    RETURN_IF_ERROR(
-            output->append(state, {Slice(serialize_buffer.data(), written_bytes)}, written_bytes, chunk->num_rows()));
+    size_t written_bytes = serialize_buffer->size();
+    RETURN_IF_ERROR(output->append(state, {Slice(serialize_buffer->data(), written_bytes)}, written_bytes,
+                                   chunk->num_rows()));
     return Status::OK();
 }
 
@@ -167,7 +265,11 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
     RETURN_IF_ERROR(reader->read_fully(header_buffer, HEADER_SIZE));
 
     int32_t sequence_id = UNALIGNED_LOAD32(header_buffer + SEQUENCE_OFFSET);
-    int32_t attachment_size = UNALIGNED_LOAD32(header_buffer + ATTACHMENT_SIZE_OFFSET);
+    int64_t attachment_size = UNALIGNED_LOAD64(header_buffer + ATTACHMENT_SIZE_OFFSET);
+    uint32_t checksum = UNALIGNED_LOAD32(header_buffer + CHECKSUM_OFFSET);
+    auto compression = static_cast<CompressionTypePB>(UNALIGNED_LOAD32(header_buffer + COMPRESSION_OFFSET));
+    int64_t stored_size = UNALIGNED_LOAD64(header_buffer + STORED_SIZE_OFFSET);
+    int64_t payload_size = UNALIGNED_LOAD64(header_buffer + PAYLOAD_SIZE_OFFSET);
     if (sequence_id != SEQUENCE_MAGIC_ID) {
         return Status::InternalError(fmt::format("sequence id mismatch {} vs {}", sequence_id, SEQUENCE_MAGIC_ID));
     }
@@ -184,13 +286,22 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
         RETURN_IF(st.is_end_of_file(), Status::InternalError("not found enough data in block"));
         RETURN_IF_ERROR(st);
     }
+    if (UNLIKELY(stored_size > attachment_size || crc32c::Value(serialize_buffer.data(), stored_size) != checksum)) {
+        return Status::Corruption(fmt::format("spilled data checksum mismatch, block: {}", reader->debug_string()));
+    }
 
-    const uint32_t* encode_levels = nullptr;
-    const uint8_t* read_cursor = buf;
-    encode_levels = reinterpret_cast<uint32_t*>(serialize_buffer.data());
-
-    read_cursor += columns.size() * sizeof(uint32_t);
     SCOPED_TIMER(_parent->metrics().deserialize_timer);
+    if (compression != CompressionTypePB::NO_COMPRESSION) {
+        const BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(compression, &codec));
+        ctx.compress_buffer.resize(payload_size + serde::EncodeContext::STREAMVBYTE_PADDING_SIZE);
+        Slice payload(ctx.compress_buffer.data(), payload_size);
+        RETURN_IF_ERROR(codec->decompress(Slice(buf, stored_size), &payload));
+        buf = reinterpret_cast<uint8_t*>(ctx.compress_buffer.data());
+    }
+
+    const auto* encode_levels = reinterpret_cast<const uint32_t*>(buf);
+    const uint8_t* read_cursor = buf + columns.size() * sizeof(uint32_t);
     for (size_t i = 0; i < columns.size(); i++) {
         read_cursor = serde::ColumnArraySerde::deserialize(read_cursor, columns[i].get(), false, encode_levels[i]);
     }
@@ -85,6 +85,8 @@ private:
 
 struct SerdeContext {
     raw::RawString serialize_buffer;
+    // the compressed payload on serialization, and the decompressed one on deserialization
+    raw::RawString compress_buffer;
 };
 // Serde is used to serialize and deserialize spilled data.
 class Serde;
@@ -198,19 +198,25 @@ Status RawSpillerWriter::acquire_stream(std::shared_ptr<SpillInputStream>* strea
 
     if (opts.is_unordered) {
         ASSIGN_OR_RETURN(input_stream, _block_group_set.as_unordered_stream(serde, _spiller));
+        if (_mem_table != nullptr && !_mem_table->is_empty()) {
+            ASSIGN_OR_RETURN(auto mem_table_stream, _mem_table->as_input_stream(opts.read_shared));
+            input_stream = SpillInputStream::union_all(mem_table_stream, input_stream);
+        }
     } else {
-        ASSIGN_OR_RETURN(input_stream, _block_group_set.as_ordered_stream(_runtime_state, serde, _spiller,
-                                                                          opts.sort_exprs, opts.sort_desc));
+        // the final mem table retained by flush
+        std::vector<InputStreamPtr> resident_streams;
+        if (_mem_table != nullptr && _mem_table->is_done() && !_mem_table->is_empty()) {
+            DCHECK(opts.retain_final_mem_table);
+            ASSIGN_OR_RETURN(auto mem_table_stream, _mem_table->as_input_stream(opts.read_shared));
+            resident_streams.emplace_back(std::move(mem_table_stream));
+        }
+        ASSIGN_OR_RETURN(input_stream,
+                         _block_group_set.as_ordered_stream(_runtime_state, serde, _spiller, opts.sort_exprs,
+                                                            opts.sort_desc, std::move(resident_streams)));
     }
 
     *stream = input_stream;
 
-    if (_mem_table != nullptr && !_mem_table->is_empty()) {
-        DCHECK(opts.is_unordered);
-        ASSIGN_OR_RETURN(auto mem_table_stream, _mem_table->as_input_stream(opts.read_shared));
-        *stream = SpillInputStream::union_all(mem_table_stream, *stream);
-    }
-
     return Status::OK();
 }
 
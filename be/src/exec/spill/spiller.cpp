@@ -188,7 +188,17 @@ Status Spiller::_acquire_input_stream(RuntimeState* state) {
 void Spiller::_init_max_block_nums() {
     size_t chunk_avg_mem_size = _chunk_builder.chunk_schema()->chunk_avg_mem_size();
     chunk_avg_mem_size = std::max<size_t>(1, chunk_avg_mem_size);
-    _max_sorted_block_cnt = std::max<size_t>(16, _opts.spill_mem_table_bytes_size / chunk_avg_mem_size);
+    size_t max_block_cnt = _opts.spill_mem_table_bytes_size / chunk_avg_mem_size;
+    if (config::spill_max_merge_fan_in > 0) {
+        max_block_cnt = std::min<size_t>(max_block_cnt, config::spill_max_merge_fan_in);
+    }
+    // The final merge splits the read buffer among all the block groups, and falls back to reading block by
+    // block once a share goes below spill_read_buffer_min_bytes. Compact earlier to keep every read buffered.
+    if (_opts.enable_buffer_read && config::spill_read_buffer_min_bytes > 0) {
+        size_t max_buffered_groups = _opts.max_read_buffer_bytes / config::spill_read_buffer_min_bytes;
+        max_block_cnt = std::min(max_block_cnt, max_buffered_groups);
+    }
+    _max_sorted_block_cnt = std::max<size_t>(16, max_block_cnt);
     TRACE_SPILL_LOG << "spill max block cnt:" << _max_sorted_block_cnt << ",avg size " << chunk_avg_mem_size;
 }
 
@@ -92,7 +92,7 @@ Status Spiller::flush(RuntimeState* state, MemGuard&& guard) {
     if (_opts.init_partition_nums > 0) {
         return _writer->as<PartitionedSpillerWriter*>()->flush<TaskExecutor>(state, true, guard);
     } else {
-        return _writer->as<RawSpillerWriter*>()->flush<TaskExecutor>(state, guard);
+        return _writer->as<RawSpillerWriter*>()->flush<TaskExecutor>(state, true, guard);
     }
 }
 
@@ -123,17 +123,22 @@ Status RawSpillerWriter::spill(RuntimeState* state, const ChunkPtr& chunk, MemGu
     RETURN_IF_ERROR(_mem_table->append(chunk));
 
     if (_mem_table->is_full()) {
-        return flush<TaskExecutor>(state, std::forward<MemGuard>(guard));
+        return flush<TaskExecutor>(state, false, std::forward<MemGuard>(guard));
     }
 
     return Status::OK();
 }
 
 template <class TaskExecutor, class MemGuard>
-Status RawSpillerWriter::flush(RuntimeState* state, MemGuard&& guard) {
+Status RawSpillerWriter::flush(RuntimeState* state, bool is_final_flush, MemGuard&& guard) {
     MemTablePtr captured_mem_table;
     {
         std::lock_guard l(_mutex);
+        if (is_final_flush && options().retain_final_mem_table && !options().is_unordered && _mem_table != nullptr &&
+            !_mem_table->is_empty()) {
+            // sorted here, and merged by acquire_stream
+            return _mem_table->done();
+        }
         captured_mem_table = std::move(_mem_table);
     }
     auto defer = DeferOp([&]() {
@@ -188,6 +193,7 @@ Status RawSpillerWriter::flush(RuntimeState* state, MemGuard&& guard) {
 
     auto yield_func = [&](workgroup::ScanTask&& task) { TaskExecutor::force_submit(std::move(task)); };
     auto io_task = workgroup::ScanTask(_spiller->options().wg, std::move(task), std::move(yield_func));
+    io_task.priority = SPILL_FLUSH_TASK_PRIORITY;
     RETURN_IF_ERROR(TaskExecutor::submit(std::move(io_task)));
     COUNTER_UPDATE(_spiller->metrics().flush_io_task_count, 1);
     COUNTER_SET(_spiller->metrics().peak_flush_io_task_count, _running_flush_tasks);
@@ -256,6 +262,7 @@ Status SpillerReader::trigger_restore(RuntimeState* state, MemGuard&& guard) {
             TaskExecutor::force_submit(std::move(task));
         };
         auto io_task = workgroup::ScanTask(_spiller->options().wg, std::move(restore_task), std::move(yield_func));
+        io_task.priority = SPILL_RESTORE_TASK_PRIORITY;
         RETURN_IF_ERROR(TaskExecutor::submit(std::move(io_task)));
         COUNTER_UPDATE(_spiller->metrics().restore_io_task_count, 1);
         COUNTER_SET(_spiller->metrics().peak_restore_io_task_count, _running_restore_tasks);
@@ -347,6 +354,7 @@ Status PartitionedSpillerWriter::flush(RuntimeState* state, bool is_final_flush,
     };
     auto yield_func = [&](workgroup::ScanTask&& task) { TaskExecutor::force_submit(std::move(task)); };
     auto io_task = workgroup::ScanTask(_spiller->options().wg, std::move(task), std::move(yield_func));
+    io_task.priority = SPILL_FLUSH_TASK_PRIORITY;
     RETURN_IF_ERROR(TaskExecutor::submit(std::move(io_task)));
     COUNTER_UPDATE(_spiller->metrics().flush_io_task_count, 1);
     COUNTER_SET(_spiller->metrics().peak_flush_io_task_count, _running_flush_tasks);
@@ -17,8 +17,11 @@
 
 #include "exec/stream/aggregate/agg_group_state.h"
 
+#include "exec/spill/dir_manager.h"
 #include "exprs/agg/stream/stream_detail_state.h"
 #include "fmt/format.h"
+#include "runtime/exec_env.h"
+#include "util/uid_util.h"
 
 namespace starrocks::stream {
 
@@ -56,22 +59,39 @@ Status AggGroupState::prepare(RuntimeState* state) {
         }
     }
 
+    StateTableFactory factory;
     if (_params->is_testing) {
-        RETURN_IF_ERROR(_prepare_mem_state_tables(state, intermediate_agg_states, detail_agg_states));
+        factory = [](std::vector<SlotDescriptor*> slots, size_t k_num) -> std::unique_ptr<StateTable> {
+            return std::make_unique<MemStateTable>(std::move(slots), k_num);
+        };
     } else {
-        RETURN_IF_ERROR(_prepare_imt_state_tables(state, intermediate_agg_states, detail_agg_states));
+        ASSIGN_OR_RETURN(auto dir, ExecEnv::GetInstance()->spill_dir_mgr()->acquire_writable_dir(
+                                           spill::AcquireDirOptions()));
+        factory = [dir](std::vector<SlotDescriptor*> slots, size_t k_num) -> std::unique_ptr<StateTable> {
+            auto table_dir = fmt::format("{}/stream_state/{}", dir->dir(), generate_uuid_string());
+            return std::make_unique<LocalStateTable>(std::move(slots), k_num, dir->fs(), std::move(table_dir));
+        };
     }
+    RETURN_IF_ERROR(_prepare_state_tables(state, intermediate_agg_states, detail_agg_states, factory));
 
+    RETURN_IF_ERROR(_result_state_table->prepare(state));
+    if (_intermediate_state_table) {
+        RETURN_IF_ERROR(_intermediate_state_table->prepare(state));
+    }
+    for (auto& detail_state_table : _detail_state_tables) {
+        RETURN_IF_ERROR(detail_state_table->prepare(state));
+    }
     return Status::OK();
 }
 
-Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
-                                                const std::vector<AggStateData*>& intermediate_agg_states,
-                                                const std::vector<AggStateData*>& detail_agg_states) {
+Status AggGroupState::_prepare_state_tables(RuntimeState* state,
+                                            const std::vector<AggStateData*>& intermediate_agg_states,
+                                            const std::vector<AggStateData*>& detail_agg_states,
+                                            const StateTableFactory& factory) {
     auto key_size = _params->grouping_exprs.size();
     // result state table must be made!
     auto output_slots = _output_tuple_desc->slots();
-    _result_state_table = std::make_unique<MemStateTable>(output_slots, key_size);
+    _result_state_table = factory(output_slots, key_size);
 
     // intermediate agg_state is created when intermediate/detail agg states are not empty.
     if (!intermediate_agg_states.empty()) {
@@ -84,7 +104,7 @@ Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
             DCHECK_LT(agg_func_id + key_size, _intermediate_tuple_desc->slots().size());
             intermediate_slots.push_back(_intermediate_tuple_desc->slots()[agg_func_id + key_size]);
         }
-        _intermediate_state_table = std::make_unique<MemStateTable>(intermediate_slots, key_size);
+        _intermediate_state_table = factory(intermediate_slots, key_size);
     }
 
     if (!detail_agg_states.empty()) {
@@ -102,19 +122,12 @@ Status AggGroupState::_prepare_mem_state_tables(RuntimeState* state,
             detail_table_slots.push_back(_output_tuple_desc->slots()[key_size + agg_func_idx]);
             detail_table_slots.push_back(_output_tuple_desc->slots()[key_size + count_agg_idx]);
             DCHECK_EQ(detail_table_slots.size(), key_size + 2);
-            auto detail_state_table = std::make_unique<MemStateTable>(detail_table_slots, key_size + 1);
-            _detail_state_tables.emplace_back(std::move(detail_state_table));
+            _detail_state_tables.emplace_back(factory(detail_table_slots, key_size + 1));
         }
     }
     return Status::OK();
 }
 
-Status AggGroupState::_prepare_imt_state_tables(RuntimeState* state,
-                                                const std::vector<AggStateData*>& intermediate_agg_states,
-                                                const std::vector<AggStateData*>& detail_agg_states) {
-    return Status::InternalError("IMT state table is not supported yet.");
-}
-
 Status AggGroupState::open(RuntimeState* state) {
     // Update result table
     DCHECK(_result_state_table);
@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <functional>
+
 #include "exec/stream/aggregate/agg_state_data.h"
+#include "exec/stream/state/local_state_table.h"
 #include "exec/stream/state/mem_state_table.h"
 
 namespace starrocks::stream {
@@ -54,10 +57,11 @@ public:
     Status reset_epoch(RuntimeState* state);
 
 private:
-    Status _prepare_mem_state_tables(RuntimeState* state, const std::vector<AggStateData*>& intermediate_agg_states,
-                                     const std::vector<AggStateData*>& detail_agg_states);
-    Status _prepare_imt_state_tables(RuntimeState* state, const std::vector<AggStateData*>& intermediate_agg_states,
-                                     const std::vector<AggStateData*>& detail_agg_states);
+    // Makes a state table of `slots` whose first `k_num` slots are the keys.
+    using StateTableFactory =
+            std::function<std::unique_ptr<StateTable>(std::vector<SlotDescriptor*> slots, size_t k_num)>;
+    Status _prepare_state_tables(RuntimeState* state, const std::vector<AggStateData*>& intermediate_agg_states,
+                                 const std::vector<AggStateData*>& detail_agg_states, const StateTableFactory& factory);
     StateTable* _find_detail_state_table(const AggStateDataUPtr& agg_state) const;
     ChunkPtr _build_intermediate_chunk(const Columns& group_by_columns, const Columns& agg_intermediate_columns) const;
 
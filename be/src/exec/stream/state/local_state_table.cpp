@@ -0,0 +1,394 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/stream/state/local_state_table.h"
+
+#include <algorithm>
+#include <map>
+
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "fmt/format.h"
+#include "storage/sstable/comparator.h"
+#include "storage/sstable/iterator.h"
+#include "storage/sstable/merger.h"
+
+namespace starrocks::stream {
+namespace {
+
+// The first byte of an encoded value.
+constexpr char kPut = 1;
+constexpr char kDelete = 0;
+
+// The iterator of the rows found by a prefix scan, which are all output by the first get_next().
+class StateChunkIterator final : public ChunkIterator {
+public:
+    StateChunkIterator(Schema schema, ChunkPtr chunk)
+            : ChunkIterator(std::move(schema), chunk->num_rows()), _chunk(std::move(chunk)) {}
+    void close() override {}
+
+protected:
+    Status do_get_next(Chunk* chunk) override {
+        if (_chunk == nullptr) {
+            return Status::EndOfFile("end of state chunk iterator");
+        }
+        chunk->append(*_chunk);
+        _chunk.reset();
+        return Status::OK();
+    }
+    Status do_get_next(Chunk* chunk, vector<uint32_t>* rowid) override {
+        return Status::EndOfFile("end of state chunk iterator");
+    }
+
+private:
+    ChunkPtr _chunk;
+};
+
+Schema make_schema_from_slots(const std::vector<SlotDescriptor*>& slots) {
+    Fields fields;
+    for (auto& slot : slots) {
+        auto field = std::make_shared<Field>(slot->id(), slot->col_name(), slot->type().type, slot->is_nullable());
+        fields.emplace_back(std::move(field));
+    }
+    return Schema(std::move(fields), KeysType::PRIMARY_KEYS, {});
+}
+
+// Appends a null flag and the serialized datum of the row, so that the encoding doesn't depend on whether the column
+// is nullable or constant, and the encoded columns can be concatenated.
+void encode_datum(Column* column, size_t row, std::string* dst) {
+    if (column->is_constant()) {
+        column = down_cast<ConstColumn*>(column)->mutable_data_column()->get();
+        row = 0;
+    }
+    if (column->is_null(row)) {
+        dst->push_back(1);
+        return;
+    }
+    dst->push_back(0);
+    Column* data_column = ColumnHelper::get_data_column(column);
+    size_t offset = dst->size();
+    dst->resize(offset + data_column->serialize_size(row));
+    data_column->serialize(row, reinterpret_cast<uint8_t*>(dst->data() + offset));
+}
+
+const uint8_t* decode_datum(const uint8_t* pos, Column* dst) {
+    if (*pos++ != 0) {
+        dst->append_nulls(1);
+        return pos;
+    }
+    if (dst->is_nullable()) {
+        auto* nullable_column = down_cast<NullableColumn*>(dst);
+        pos = nullable_column->mutable_data_column()->deserialize_and_append(pos);
+        nullable_column->null_column_data().emplace_back(0);
+        return pos;
+    }
+    return dst->deserialize_and_append(pos);
+}
+
+std::string encode_key(const Columns& columns, size_t num_columns, size_t row) {
+    std::string key;
+    for (size_t i = 0; i < num_columns; i++) {
+        encode_datum(columns[i].get(), row, &key);
+    }
+    return key;
+}
+
+// Decodes the datums from `pos` into the columns [start, end) of `dst`.
+const uint8_t* decode_datums(const uint8_t* pos, Chunk* dst, size_t start, size_t end) {
+    for (size_t i = start; i < end; i++) {
+        pos = decode_datum(pos, dst->get_column_by_index(i).get());
+    }
+    return pos;
+}
+
+} // namespace
+
+LocalStateTable::LocalStateTable(std::vector<SlotDescriptor*> slots, size_t k_num, FileSystem* fs, std::string dir)
+        : _slots(std::move(slots)), _k_num(k_num), _fs(fs), _dir(std::move(dir)) {
+    DCHECK_LT(_k_num, _slots.size());
+    _v_schema = make_schema_from_slots(std::vector<SlotDescriptor*>{_slots.begin() + _k_num, _slots.end()});
+    _filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+    _sstable_options.filter_policy = _filter_policy.get();
+}
+
+LocalStateTable::~LocalStateTable() {
+    _runs.clear();
+    if (auto st = _fs->delete_dir_recursive(_dir); !st.ok() && !st.is_not_found()) {
+        LOG(WARNING) << "failed to remove the dir of the state table: " << _dir << ", " << st;
+    }
+}
+
+Status LocalStateTable::prepare(RuntimeState* state) {
+    return _fs->create_dir_recursive(_dir);
+}
+
+Status LocalStateTable::open(RuntimeState* state) {
+    return Status::OK();
+}
+
+Status LocalStateTable::seek(const Columns& keys, StateTableResult& values) const {
+    return _seek(keys, nullptr, values);
+}
+
+Status LocalStateTable::seek(const Columns& keys, const Filter& selection, StateTableResult& values) const {
+    DCHECK_LT(0, keys.size());
+    DCHECK_EQ(selection.size(), keys[0]->size());
+    return _seek(keys, &selection, values);
+}
+
+Status LocalStateTable::seek(const Columns& keys, const std::vector<std::string>& projection_columns,
+                             StateTableResult& values) const {
+    return Status::NotSupported("Seek with projection columns is not supported yet.");
+}
+
+Status LocalStateTable::_seek(const Columns& keys, const Filter* selection, StateTableResult& values) const {
+    DCHECK_EQ(keys.size(), _k_num);
+    auto num_rows = keys[0]->size();
+    std::vector<std::string> encoded_keys(num_rows);
+    // The found encoded values, in the write buffer or `run_values`.
+    std::vector<const std::string*> encoded_values(num_rows, nullptr);
+    std::vector<std::string> run_values(num_rows);
+    std::vector<size_t> misses;
+    for (size_t i = 0; i < num_rows; i++) {
+        if (selection != nullptr && !(*selection)[i]) {
+            continue;
+        }
+        encoded_keys[i] = encode_key(keys, _k_num, i);
+        if (auto iter = _write_buffer.find(encoded_keys[i]); iter != _write_buffer.end()) {
+            encoded_values[i] = &iter->second;
+        } else {
+            misses.push_back(i);
+        }
+    }
+
+    if (!misses.empty() && !_runs.empty()) {
+        std::vector<Slice> key_slices(encoded_keys.begin(), encoded_keys.end());
+        // probe the keys in order, so that the keys in the same data block are found with one block read.
+        std::sort(misses.begin(), misses.end(),
+                  [&](size_t lhs, size_t rhs) { return key_slices[lhs].compare(key_slices[rhs]) < 0; });
+        sstable::ReadOptions options;
+        std::vector<std::string> found_values;
+        std::vector<size_t> remaining;
+        for (auto run = _runs.rbegin(); run != _runs.rend() && !misses.empty(); ++run) {
+            found_values.assign(misses.size(), std::string());
+            RETURN_IF_ERROR((*run)->table->MultiGet(options, key_slices.data(), misses.begin(), misses.end(),
+                                                    &found_values));
+            remaining.clear();
+            for (size_t j = 0; j < misses.size(); j++) {
+                // The encoded values are never empty, so an empty one means not found.
+                if (found_values[j].empty()) {
+                    remaining.push_back(misses[j]);
+                } else {
+                    run_values[misses[j]] = std::move(found_values[j]);
+                    encoded_values[misses[j]] = &run_values[misses[j]];
+                }
+            }
+            misses.swap(remaining);
+        }
+    }
+
+    auto& found = values.found;
+    auto& result_chunk = values.result_chunk;
+    found.assign(num_rows, false);
+    result_chunk = ChunkHelper::new_chunk(_v_schema, num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        const std::string* value = encoded_values[i];
+        if (value == nullptr || (*value)[0] == kDelete) {
+            continue;
+        }
+        found[i] = true;
+        decode_datums(reinterpret_cast<const uint8_t*>(value->data() + 1), result_chunk.get(), 0,
+                      result_chunk->num_columns());
+    }
+    return Status::OK();
+}
+
+ChunkIteratorPtrOr LocalStateTable::prefix_scan(const Columns& keys, size_t row_idx) const {
+    auto prefix_size = keys.size();
+    DCHECK_LE(prefix_size, _k_num);
+    auto prefix = encode_key(keys, prefix_size, row_idx);
+
+    // Merge the runs and the write buffer from the oldest, the newer values replace the older ones.
+    std::map<std::string, std::string> rows;
+    sstable::ReadOptions options;
+    options.fill_cache = false;
+    for (auto& run : _runs) {
+        std::unique_ptr<sstable::Iterator> iter(run->table->NewIterator(options));
+        for (iter->Seek(prefix); iter->Valid() && iter->key().starts_with(prefix); iter->Next()) {
+            rows[iter->key().to_string()] = iter->value().to_string();
+        }
+        RETURN_IF_ERROR(iter->status());
+    }
+    for (auto iter = _write_buffer.lower_bound(prefix);
+         iter != _write_buffer.end() && Slice(iter->first).starts_with(prefix); ++iter) {
+        rows[iter->first] = iter->second;
+    }
+
+    // Output the remaining key columns and the value columns.
+    auto schema = make_schema_from_slots(std::vector<SlotDescriptor*>{_slots.begin() + prefix_size, _slots.end()});
+    auto chunk = ChunkHelper::new_chunk(schema, rows.size());
+    for (auto& [key, value] : rows) {
+        if (value[0] == kDelete) {
+            continue;
+        }
+        decode_datums(reinterpret_cast<const uint8_t*>(key.data() + prefix.size()), chunk.get(), 0,
+                      _k_num - prefix_size);
+        decode_datums(reinterpret_cast<const uint8_t*>(value.data() + 1), chunk.get(), _k_num - prefix_size,
+                      chunk->num_columns());
+    }
+    if (chunk->is_empty()) {
+        return Status::EndOfFile("");
+    }
+    return std::make_shared<StateChunkIterator>(std::move(schema), std::move(chunk));
+}
+
+ChunkIteratorPtrOr LocalStateTable::prefix_scan(const std::vector<std::string>& projection_columns,
+                                                const Columns& keys, size_t row_idx) const {
+    return Status::NotSupported("PrefixScan with projection columns is not supported yet.");
+}
+
+void LocalStateTable::_put(std::string key, std::string value) {
+    auto [iter, inserted] = _write_buffer.try_emplace(std::move(key));
+    if (inserted) {
+        _write_buffer_bytes += iter->first.size();
+    } else {
+        _write_buffer_bytes -= iter->second.size();
+    }
+    _write_buffer_bytes += value.size();
+    iter->second = std::move(value);
+}
+
+Status LocalStateTable::write(RuntimeState* state, const StreamChunkPtr& chunk) {
+    DCHECK(chunk);
+    auto chunk_size = chunk->num_rows();
+    auto& columns = chunk->columns();
+    const StreamRowOp* ops = nullptr;
+    if (StreamChunkConverter::has_ops_column(chunk)) {
+        ops = StreamChunkConverter::ops(chunk);
+    }
+    for (size_t i = 0; i < chunk_size; i++) {
+        if (ops != nullptr && ops[i] == StreamRowOp::OP_UPDATE_BEFORE) {
+            continue;
+        }
+        std::string value;
+        if (ops != nullptr && ops[i] == StreamRowOp::OP_DELETE) {
+            value.push_back(kDelete);
+        } else {
+            value.push_back(kPut);
+            for (size_t j = _k_num; j < _slots.size(); j++) {
+                encode_datum(columns[j].get(), i, &value);
+            }
+        }
+        _put(encode_key(columns, _k_num, i), std::move(value));
+    }
+    return Status::OK();
+}
+
+Status LocalStateTable::commit(RuntimeState* state) {
+    if (!_write_buffer.empty() && _write_buffer_bytes >= config::stream_state_table_write_buffer_bytes) {
+        RETURN_IF_ERROR(_flush_write_buffer());
+    }
+    if (_runs.size() > std::max(config::stream_state_table_max_runs, 1)) {
+        RETURN_IF_ERROR(_compact_runs());
+    }
+    return Status::OK();
+}
+
+Status LocalStateTable::reset_epoch(RuntimeState* state) {
+    return Status::OK();
+}
+
+Status LocalStateTable::_flush_write_buffer() {
+    // The tombstones only hide the keys in the older runs.
+    bool keep_deletes = !_runs.empty();
+    ASSIGN_OR_RETURN(auto run, _write_run([&](sstable::TableBuilder* builder) {
+                         for (auto& [key, value] : _write_buffer) {
+                             if (keep_deletes || value[0] != kDelete) {
+                                 builder->Add(key, value);
+                             }
+                         }
+                     }));
+    if (run != nullptr) {
+        _runs.emplace_back(std::move(run));
+    }
+    _write_buffer.clear();
+    _write_buffer_bytes = 0;
+    return Status::OK();
+}
+
+Status LocalStateTable::_compact_runs() {
+    // The merging iterator outputs the entry of the first child among the equal keys, so the newest run goes first.
+    std::vector<sstable::Iterator*> children;
+    sstable::ReadOptions options;
+    options.fill_cache = false;
+    for (auto run = _runs.rbegin(); run != _runs.rend(); ++run) {
+        children.push_back((*run)->table->NewIterator(options));
+    }
+    std::unique_ptr<sstable::Iterator> iter(
+            sstable::NewMergingIterator(_sstable_options.comparator, children.data(), children.size()));
+    ASSIGN_OR_RETURN(auto run, _write_run([&](sstable::TableBuilder* builder) {
+                         std::string last_key;
+                         bool has_last_key = false;
+                         for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+                             if (has_last_key && iter->key() == Slice(last_key)) {
+                                 continue;
+                             }
+                             last_key = iter->key().to_string();
+                             has_last_key = true;
+                             // All the runs are merged, so the tombstones hide nothing.
+                             if (iter->value()[0] != kDelete) {
+                                 builder->Add(iter->key(), iter->value());
+                             }
+                         }
+                     }));
+    RETURN_IF_ERROR(iter->status());
+    iter.reset();
+
+    std::vector<std::string> obsolete_paths;
+    for (auto& obsolete_run : _runs) {
+        obsolete_paths.push_back(obsolete_run->path);
+    }
+    _runs.clear();
+    if (run != nullptr) {
+        _runs.emplace_back(std::move(run));
+    }
+    for (auto& path : obsolete_paths) {
+        WARN_IF_ERROR(_fs->delete_file(path), "failed to remove the run of the state table: " + path);
+    }
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<LocalStateTable::Run>> LocalStateTable::_write_run(
+        const std::function<void(sstable::TableBuilder*)>& add_entries) {
+    auto run = std::make_unique<Run>();
+    run->path = fmt::format("{}/{}.sst", _dir, _next_run_id++);
+    ASSIGN_OR_RETURN(auto wf, _fs->new_writable_file(run->path));
+    sstable::TableBuilder builder(_sstable_options, wf.get());
+    add_entries(&builder);
+    RETURN_IF_ERROR(builder.Finish());
+    RETURN_IF_ERROR(wf->close());
+    if (builder.NumEntries() == 0) {
+        RETURN_IF_ERROR(_fs->delete_file(run->path));
+        return std::unique_ptr<Run>();
+    }
+
+    ASSIGN_OR_RETURN(run->file, _fs->new_random_access_file(run->path));
+    sstable::Table* table;
+    RETURN_IF_ERROR(sstable::Table::Open(_sstable_options, run->file.get(), builder.FileSize(), &table));
+    run->table.reset(table);
+    return run;
+}
+
+} // namespace starrocks::stream
@@ -0,0 +1,108 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "column/schema.h"
+#include "exec/stream/state/state_table.h"
+#include "fs/fs.h"
+#include "storage/sstable/filter_policy.h"
+#include "storage/sstable/table.h"
+#include "storage/sstable/table_builder.h"
+#include "util/phmap/btree.h"
+
+namespace starrocks::stream {
+
+// `LocalStateTable` keeps the state of a stateful operator in a small LSM tree on the local disks, so that the state
+// doesn't have to fit in memory.
+//
+// The changes of the current epochs are kept in a sorted write buffer. At the end of an epoch, i.e. commit(), the
+// write buffer is written into an immutable sorted run, a sstable with a bloom filter, once it's larger than
+// config::stream_state_table_write_buffer_bytes, so a run never contains a part of an epoch. The runs are merged into
+// one once there are more than config::stream_state_table_max_runs of them.
+//
+// Each row is keyed by its first `k_num` columns, encoded as a null flag and the serialized datum of each column, so
+// the encoding of the first n key columns is a prefix of the encoding of the whole key. A deleted key is kept as a
+// tombstone until the runs are merged.
+//
+// seek() probes the keys of a chunk in a batch: the misses of the write buffer are sorted and probed in each run from
+// the newest, so that each data block is read at most once per run.
+//
+// NOTE: The files are removed with the table, the state doesn't survive a restart of the BE.
+class LocalStateTable final : public StateTable {
+public:
+    // The flushed chunks' columns are assigned as: _k_num | _v_num. The runs are written into `dir` of `fs`.
+    LocalStateTable(std::vector<SlotDescriptor*> slots, size_t k_num, FileSystem* fs, std::string dir);
+    ~LocalStateTable() override;
+
+    Status prepare(RuntimeState* state) override;
+    Status open(RuntimeState* state) override;
+
+    Status seek(const Columns& keys, StateTableResult& values) const override;
+    Status seek(const Columns& keys, const Filter& selection, StateTableResult& values) const override;
+    Status seek(const Columns& keys, const std::vector<std::string>& projection_columns,
+                StateTableResult& values) const override;
+
+    ChunkIteratorPtrOr prefix_scan(const Columns& keys, size_t row_idx) const override;
+    ChunkIteratorPtrOr prefix_scan(const std::vector<std::string>& projection_columns, const Columns& keys,
+                                   size_t row_idx) const override;
+
+    Status write(RuntimeState* state, const StreamChunkPtr& chunk) override;
+    Status commit(RuntimeState* state) override;
+    Status reset_epoch(RuntimeState* state) override;
+
+    size_t num_runs() const { return _runs.size(); }
+    size_t write_buffer_bytes() const { return _write_buffer_bytes; }
+
+private:
+    struct Run {
+        std::string path;
+        std::unique_ptr<RandomAccessFile> file;
+        std::unique_ptr<sstable::Table> table;
+    };
+
+    Status _seek(const Columns& keys, const Filter* selection, StateTableResult& values) const;
+
+    void _put(std::string key, std::string value);
+    Status _flush_write_buffer();
+    Status _compact_runs();
+    // Writes the entries added by `add_entries` in order into a new run, which is nullptr if there is no entry.
+    StatusOr<std::unique_ptr<Run>> _write_run(const std::function<void(sstable::TableBuilder*)>& add_entries);
+
+private:
+    std::vector<SlotDescriptor*> _slots;
+    size_t _k_num;
+    FileSystem* _fs;
+    std::string _dir;
+
+    // value's schema
+    Schema _v_schema;
+
+    std::unique_ptr<sstable::FilterPolicy> _filter_policy;
+    sstable::Options _sstable_options;
+
+    // The encoded keys => the encoded values or tombstones of the current epochs.
+    phmap::btree_map<std::string, std::string, std::less<>> _write_buffer;
+    size_t _write_buffer_bytes = 0;
+
+    // From the oldest to the newest.
+    std::vector<std::unique_ptr<Run>> _runs;
+    int64_t _next_run_id = 0;
+};
+
+} // namespace starrocks::stream
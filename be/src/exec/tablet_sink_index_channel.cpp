@@ -81,7 +81,8 @@ Status NodeChannel::init(RuntimeState* state) {
         return _err_st;
     }
 
-    _stub = state->exec_env()->brpc_stub_cache()->get_stub(_node_info->host, _node_info->brpc_port);
+    _stub = state->exec_env()->brpc_stub_cache()->get_stub(_node_info->host, _node_info->brpc_port,
+                                                           BrpcTrafficClass::LOAD);
     if (_stub == nullptr) {
         _cancelled = true;
         auto msg = fmt::format("Connect {}:{} failed.", _node_info->host, _node_info->brpc_port);
@@ -371,6 +372,13 @@ Status NodeChannel::_serialize_chunk(const Chunk* src, ChunkPB* dst) {
         return _err_st;
     }
 
+    // the data compressed poorly recently, send it as is and save the cpu of compression
+    if (_compress_codec != nullptr && _compress_skip_chunks > 0) {
+        _compress_skip_chunks--;
+        COUNTER_UPDATE(_ts_profile->compress_skipped_counter, 1);
+        return Status::OK();
+    }
+
     // try compress the ChunkPB data
     if (_compress_codec != nullptr && uncompressed_size > 0) {
         SCOPED_TIMER(_ts_profile->compress_timer);
@@ -398,6 +406,13 @@ Status NodeChannel::_serialize_chunk(const Chunk* src, ChunkPB* dst) {
         if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
             dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
             dst->set_compress_type(_compress_type);
+            _compress_backoff_chunks = 0;
+        } else {
+            // skip compressing exponentially more chunks every time the ratio doesn't reach the threshold,
+            // and probe it again afterwards in case the data changes
+            _compress_backoff_chunks = std::min<int64_t>(std::max<int64_t>(_compress_backoff_chunks * 2, 1),
+                                                         config::load_rpc_compress_max_skip_chunks);
+            _compress_skip_chunks = _compress_backoff_chunks;
         }
 
         VLOG_ROW << "uncompressed size: " << uncompressed_size << ", compressed size: " << _compression_scratch.size();
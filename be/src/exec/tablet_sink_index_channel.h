@@ -91,6 +91,7 @@ struct TabletSinkProfile {
     RuntimeProfile::Counter* serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* wait_response_timer = nullptr;
     RuntimeProfile::Counter* compress_timer = nullptr;
+    RuntimeProfile::Counter* compress_skipped_counter = nullptr;
     RuntimeProfile::Counter* pack_chunk_timer = nullptr;
     RuntimeProfile::Counter* send_rpc_timer = nullptr;
     RuntimeProfile::Counter* client_rpc_timer = nullptr;
@@ -202,6 +203,10 @@ private:
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
     const BlockCompressionCodec* _compress_codec = nullptr;
     raw::RawString _compression_scratch;
+    // The number of the next chunks sent without trying compression, and the number to use the next time
+    // compression doesn't pay off.
+    int64_t _compress_skip_chunks = 0;
+    int64_t _compress_backoff_chunks = 0;
 
     // this should be set in init() using config
     int _rpc_timeout_ms = 60000;
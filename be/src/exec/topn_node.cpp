@@ -17,6 +17,7 @@
 #include <any>
 #include <memory>
 
+#include "common/config.h"
 #include "exec/chunks_sorter.h"
 #include "exec/chunks_sorter_full_sort.h"
 #include "exec/chunks_sorter_heap_sort.h"
@@ -217,9 +218,8 @@ void TopNNode::close(RuntimeState* state) {
 Status TopNNode::_consume_chunks(RuntimeState* state, ExecNode* child) {
     ScopedTimer<MonotonicStopWatch> timer(_sort_timer);
     if (_limit > 0) {
-        // ChunksSorterHeapSort has higher performance when sorting fewer elements,
-        // after testing we think 1024 is a good threshold
-        if (_limit <= ChunksSorter::USE_HEAP_SORTER_LIMIT_SZ) {
+        // ChunksSorterHeapSort has higher performance when sorting fewer elements
+        if (ChunksSorter::use_heap_sorter(_sort_exec_exprs.lhs_ordering_expr_ctxs(), _offset + _limit)) {
             _chunks_sorter = std::make_unique<ChunksSorterHeapSort>(state, &(_sort_exec_exprs.lhs_ordering_expr_ctxs()),
                                                                     &_is_asc_order, &_is_null_first, _sort_keys,
                                                                     _offset, _limit);
@@ -296,7 +296,7 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory>> TopNNode::_decompose_to_
     auto spill_channel_factory = std::make_shared<SpillProcessChannelFactory>(degree_of_parallelism);
 
     // spill process operator
-    if (runtime_state()->enable_spill() && runtime_state()->enable_sort_spill() && _limit < 0 && !is_partition_topn) {
+    if (_is_spillable() && !is_partition_topn) {
         context->interpolate_spill_process(id(), spill_channel_factory, degree_of_parallelism);
     }
 
@@ -361,6 +361,19 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory>> TopNNode::_decompose_to_
     return operators_source_with_sort;
 }
 
+bool TopNNode::_is_spillable() const {
+    if (!runtime_state()->enable_spill() || !runtime_state()->enable_sort_spill()) {
+        return false;
+    }
+    if (_limit < 0) {
+        return true;
+    }
+    // The sort context applies the offset and the limit when merging the outputs of the full sort,
+    // which is only the same as the topn of ROW_NUMBER.
+    return _tnode.sort_node.topn_type == TTopNType::ROW_NUMBER && config::sort_spill_topn_min_limit >= 0 &&
+           _limit + _offset >= config::sort_spill_topn_min_limit;
+}
+
 pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
 
@@ -384,7 +397,7 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
                                        LocalPartitionTopnSourceOperatorFactory>(
                         context, is_partition_topn, is_partition_skewed, need_merge, enable_parallel_merge);
     } else {
-        if (runtime_state()->enable_spill() && runtime_state()->enable_sort_spill() && _limit < 0) {
+        if (_is_spillable()) {
             if (enable_parallel_merge) {
                 operators_source_with_sort =
                         _decompose_to_pipeline<SortContextFactory, SpillablePartitionSortSinkOperatorFactory,
@@ -47,6 +47,9 @@ private:
             pipeline::PipelineBuilderContext* context, bool is_partition_topn, bool is_partition_skewed,
             bool is_merging, bool enable_parallel_merge);
 
+    // Whether the non-partition topn is sorted by the spillable full sort.
+    bool _is_spillable() const;
+
     Status _consume_chunks(RuntimeState* state, ExecNode* child);
     const TPlanNode& _tnode;
 
@@ -14,6 +14,7 @@
 
 #include "exec/workgroup/pipeline_executor_set_manager.h"
 
+#include "util/cpu_info.h"
 #include "work_group.h"
 
 namespace starrocks::workgroup {
@@ -59,11 +60,11 @@ void ExecutorsManager::assign_cpuids_to_workgroup(WorkGroup* wg) {
         return;
     }
 
-    CpuUtil::CpuIds cpuids;
-    CpuUtil::CpuIds new_common_cpuids;
+    CpuUtil::CpuIds new_common_cpuids = common_cpuids;
     const size_t n = std::min<size_t>({wg->exclusive_cpu_cores(), common_cpuids.size() - 1, _conf.num_total_cores - 1});
-    std::copy_n(common_cpuids.begin(), n, std::back_inserter(cpuids));
-    std::copy(common_cpuids.begin() + n, common_cpuids.end(), std::back_inserter(new_common_cpuids));
+    // Keep the exclusive cpuids of a workgroup in as few NUMA nodes as possible,
+    // so its drivers and scan tasks don't bounce between sockets.
+    CpuUtil::CpuIds cpuids = CpuUtil::pick_numa_local_cpuids(&new_common_cpuids, n, CpuInfo::get_numa_node_for_core);
 
     LOG(INFO) << "[WORKGROUP] assign cpuids to workgroup "
               << "[workgroup=" << wg->to_string() << "] "
@@ -90,12 +91,20 @@ void ExecutorsManager::reclaim_cpuids_from_worgroup(WorkGroup* wg) {
               << "[workgroup=" << wg->to_string() << "] "
               << "[cpuids=" << CpuUtil::to_string(cpuids) << "] ";
 
-    std::ranges::copy(cpuids, std::back_inserter(_wg_to_cpuids[COMMON_WORKGROUP]));
-    _wg_to_cpuids.erase(wg);
+    auto& common_cpuids = _wg_to_cpuids[COMMON_WORKGROUP];
+    std::ranges::copy(cpuids, std::back_inserter(common_cpuids));
+    // Keep the common cpuids grouped by NUMA node, so that later assignments can still find local cpuids.
+    std::ranges::sort(common_cpuids, [](CpuUtil::CpuId lhs, CpuUtil::CpuId rhs) {
+        const int lhs_node = CpuInfo::get_numa_node_for_core(lhs);
+        const int rhs_node = CpuInfo::get_numa_node_for_core(rhs);
+        return lhs_node != rhs_node ? lhs_node < rhs_node : lhs < rhs;
+    });
 
     for (auto cpuid : cpuids) {
         _cpu_owners[cpuid].set_wg(COMMON_WORKGROUP);
     }
+    // `cpuids` refers to the entry of `wg`, so erase it at last.
+    _wg_to_cpuids.erase(wg);
 }
 
 const CpuUtil::CpuIds& ExecutorsManager::get_cpuids_of_workgroup(WorkGroup* wg) const {
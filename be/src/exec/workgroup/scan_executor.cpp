@@ -15,7 +15,9 @@
 #include "exec/workgroup/scan_executor.h"
 
 #include "exec/workgroup/scan_task_queue.h"
+#include "io/io_profiler.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 namespace starrocks::workgroup {
 
@@ -71,10 +73,18 @@ void ScanExecutor::worker_thread() {
         auto& task = maybe_task.value();
 
         int64_t time_spent_ns = 0;
+        IOProfiler::IOStat io_snapshot;
+        IOProfiler::take_tls_io_snapshot(&io_snapshot);
         {
             SCOPED_RAW_TIMER(&time_spent_ns);
             task.run();
         }
+        if (task.workgroup != nullptr) {
+            // Charge the local disk io of this task to the io budget of its workgroup.
+            const auto io_stat = IOProfiler::calculate_scoped_tls_io(io_snapshot);
+            task.workgroup->charge_io(io_stat.read_bytes + io_stat.write_bytes, io_stat.read_ops + io_stat.write_ops,
+                                      MonotonicNanos());
+        }
         if (current_thread != nullptr) {
             current_thread->inc_finished_tasks();
         }
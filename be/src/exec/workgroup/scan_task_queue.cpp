@@ -14,9 +14,11 @@
 
 #include "exec/workgroup/scan_task_queue.h"
 
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "util/time.h"
 
 namespace starrocks::workgroup {
 
@@ -83,12 +85,18 @@ StatusOr<ScanTask> WorkGroupScanTaskQueue::take() {
         // TODO: In the future, we may implement different task queues for exclusive workgroup and shared workgroup,
         // since exclusive workgroup does not need two-level queues about workgroup.
         wg_entity = _pick_next_wg();
+        if (wg_entity != nullptr && config::workgroup_io_bytes_per_second_per_core > 0) {
+            wg_entity = _pick_next_wg_within_io_budget(MonotonicNanos());
+        }
         if (wg_entity != nullptr &&
             !ExecEnv::GetInstance()->workgroup_manager()->should_yield(wg_entity->workgroup())) {
             break;
         }
 
-        if (wg_entity == nullptr) {
+        if (wg_entity == nullptr && !_wg_entities.empty()) {
+            // All the ready workgroups have run out of their io budgets.
+            _cv.wait_for(lock, std::chrono::milliseconds(IO_THROTTLE_WAIT_MS));
+        } else if (wg_entity == nullptr) {
             _cv.wait(lock);
         } else {
             // This thread can only run on the borrowed CPU. At this time, the owner of the borrowed CPU has a task
@@ -197,6 +205,15 @@ WorkGroupScanSchedEntity* WorkGroupScanTaskQueue::_pick_next_wg() const {
     return *_wg_entities.begin();
 }
 
+WorkGroupScanSchedEntity* WorkGroupScanTaskQueue::_pick_next_wg_within_io_budget(int64_t now_ns) const {
+    for (auto* wg_entity : _wg_entities) {
+        if (!wg_entity->workgroup()->is_io_throttled(now_ns)) {
+            return wg_entity;
+        }
+    }
+    return nullptr;
+}
+
 void WorkGroupScanTaskQueue::_enqueue_workgroup(WorkGroupScanSchedEntity* wg_entity) {
     _sum_cpu_weight += wg_entity->cpu_weight();
 
@@ -204,8 +221,10 @@ void WorkGroupScanTaskQueue::_enqueue_workgroup(WorkGroupScanSchedEntity* wg_ent
         // The workgroup maybe leaves for a long time, which results in that the runtime of it
         // may be much smaller than the other workgroups. If the runtime isn't adjusted, the others
         // will starve. Therefore, the runtime is adjusted according the minimum vruntime in _ready_wgs,
-        // and give it half of ideal runtime in a schedule period as compensation.
-        int64_t new_vruntime_ns = std::min(min_wg_entity->vruntime_ns() - _ideal_runtime_ns(wg_entity) / 2,
+        // and give it a burst credit growing with its idle time as compensation. The busy workgroups
+        // are preempted by should_yield() until the credit is used up.
+        const int64_t credit_ns = wg_entity->burst_credit_ns(_ideal_runtime_ns(wg_entity), MonotonicNanos());
+        int64_t new_vruntime_ns = std::min(min_wg_entity->vruntime_ns() - credit_ns,
                                            min_wg_entity->runtime_ns() / int64_t(wg_entity->cpu_weight()));
         int64_t diff_vruntime_ns = new_vruntime_ns - wg_entity->vruntime_ns();
         if (diff_vruntime_ns > 0) {
@@ -221,6 +240,7 @@ void WorkGroupScanTaskQueue::_enqueue_workgroup(WorkGroupScanSchedEntity* wg_ent
 void WorkGroupScanTaskQueue::_dequeue_workgroup(WorkGroupScanSchedEntity* wg_entity) {
     _sum_cpu_weight -= wg_entity->cpu_weight();
     _wg_entities.erase(wg_entity);
+    wg_entity->mark_idle(MonotonicNanos());
     _update_min_wg();
 }
 
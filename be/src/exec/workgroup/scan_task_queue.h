@@ -175,6 +175,8 @@ public:
 private:
     /// These methods should be guarded by the outside _global_mutex.
     WorkGroupScanSchedEntity* _pick_next_wg() const;
+    // Pick the workgroup with the minimum vruntime among the ones not running out of their io budgets.
+    WorkGroupScanSchedEntity* _pick_next_wg_within_io_budget(int64_t now_ns) const;
     // _update_min_wg is invoked when an entity is enqueued or dequeued from _wg_entities.
     void _update_min_wg();
     void _enqueue_workgroup(WorkGroupScanSchedEntity* wg_entity);
@@ -188,6 +190,7 @@ private:
 
 private:
     static constexpr int64_t SCHEDULE_PERIOD_PER_WG_NS = 100'000'000;
+    static constexpr int64_t IO_THROTTLE_WAIT_MS = 10;
 
     struct WorkGroupScanSchedEntityComparator {
         using WorkGroupScanSchedEntityPtr = WorkGroupScanSchedEntity*;
@@ -14,6 +14,7 @@
 
 #include "exec/workgroup/work_group.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "common/config.h"
@@ -46,6 +47,7 @@ struct WorkGroupMetrics {
     std::unique_ptr<IntGauge> total_queries = nullptr;
     std::unique_ptr<IntGauge> concurrency_overflow_count = nullptr;
     std::unique_ptr<IntGauge> bigquery_count = nullptr;
+    std::unique_ptr<IntGauge> io_bytes = nullptr;
 
     std::unique_ptr<DoubleGauge> inuse_cpu_cores = nullptr;
     int64_t timestamp_ns = 0;
@@ -83,6 +85,17 @@ void WorkGroupSchedEntity<Q>::adjust_runtime_ns(int64_t runtime_ns) {
     _vruntime_ns += runtime_ns / cpu_weight();
 }
 
+template <typename Q>
+int64_t WorkGroupSchedEntity<Q>::burst_credit_ns(int64_t ideal_runtime_ns, int64_t now_ns) const {
+    const int64_t min_credit_ns = ideal_runtime_ns / 2;
+    const int64_t max_credit_ns = config::workgroup_max_burst_credit_ms * 1'000'000L;
+    if (_idle_since_ns <= 0 || max_credit_ns <= min_credit_ns) {
+        return min_credit_ns;
+    }
+    const int64_t idle_ns = now_ns - _idle_since_ns;
+    return std::clamp(idle_ns / 2, min_credit_ns, max_credit_ns);
+}
+
 template class WorkGroupSchedEntity<pipeline::DriverQueue>;
 template class WorkGroupSchedEntity<ScanTaskQueue>;
 
@@ -266,6 +279,30 @@ void WorkGroup::copy_metrics(const WorkGroup& rhs) {
     _num_total_queries = rhs.num_total_queries();
     _concurrency_overflow_count = rhs.concurrency_overflow_count();
     _bigquery_count = rhs.bigquery_count();
+    _io_bytes = rhs.io_bytes();
+}
+
+int64_t WorkGroup::io_bytes_per_second_limit() const {
+    return std::max<int64_t>(0, config::workgroup_io_bytes_per_second_per_core) * _cpu_weight;
+}
+
+void WorkGroup::charge_io(int64_t bytes, int64_t ops, int64_t now_ns) {
+    if (bytes <= 0 && ops <= 0) {
+        return;
+    }
+    _io_bytes += bytes;
+
+    const int64_t limit = io_bytes_per_second_limit();
+    if (limit <= 0) {
+        return;
+    }
+    const int64_t charged_bytes = std::max(bytes, ops * MIN_IO_BYTES_PER_OP);
+    const auto cost_ns = static_cast<int64_t>(static_cast<double>(charged_bytes) * NANOS_PER_SEC / limit);
+    // The budget unused in the last IO_BURST_NS is still available, which allows a short burst.
+    int64_t ready_ns = _io_budget_ready_ns.load(std::memory_order_relaxed);
+    while (!_io_budget_ready_ns.compare_exchange_weak(ready_ns, std::max(ready_ns, now_ns - IO_BURST_NS) + cost_ns,
+                                                      std::memory_order_relaxed)) {
+    }
 }
 
 // ------------------------------------------------------------------------------------
@@ -364,6 +401,11 @@ void WorkGroupManager::add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockTy
                 "resource_group_bigquery_count", MetricLabels().add("name", wg->name()),
                 resource_group_bigquery_count.get());
 
+        // disk io bytes of scan and spill
+        auto resource_group_io_bytes = std::make_unique<IntGauge>(MetricUnit::BYTES);
+        bool io_bytes_registered = StarRocksMetrics::instance()->metrics()->register_metric(
+                "resource_group_io_bytes", MetricLabels().add("name", wg->name()), resource_group_io_bytes.get());
+
         unique_lock.lock();
         auto it = _wg_metrics.find(wg->name());
         if (it == _wg_metrics.end()) {
@@ -387,6 +429,7 @@ void WorkGroupManager::add_metrics_unlocked(const WorkGroupPtr& wg, UniqueLockTy
         if (concurrency_registered)
             wg_metrics->concurrency_overflow_count = std::move(resource_group_concurrency_overflow);
         if (bigquery_registered) wg_metrics->bigquery_count = std::move(resource_group_bigquery_count);
+        if (io_bytes_registered) wg_metrics->io_bytes = std::move(resource_group_io_bytes);
     }
     _wg_metrics[wg->name()]->group_unique_id = wg->unique_id();
 }
@@ -441,6 +484,7 @@ void WorkGroupManager::update_metrics_unlocked() {
             wg_metrics->total_queries->set_value(wg->num_total_queries());
             wg_metrics->concurrency_overflow_count->set_value(wg->concurrency_overflow_count());
             wg_metrics->bigquery_count->set_value(wg->bigquery_count());
+            wg_metrics->io_bytes->set_value(wg->io_bytes());
 
             int64_t new_timestamp_ns = MonotonicNanos();
             int64_t new_cpu_runtime_ns = wg->cpu_runtime_ns();
@@ -464,6 +508,7 @@ void WorkGroupManager::update_metrics_unlocked() {
             wg_metrics->concurrency_overflow_count->set_value(0);
             wg_metrics->bigquery_count->set_value(0);
             wg_metrics->inuse_cpu_cores->set_value(0);
+            wg_metrics->io_bytes->set_value(0);
         }
     }
 }
@@ -82,6 +82,14 @@ public:
     void incr_runtime_ns(int64_t runtime_ns);
     void adjust_runtime_ns(int64_t runtime_ns);
 
+    /// Record the time when the workgroup leaves the queue, i.e. it has no ready driver or task.
+    void mark_idle(int64_t now_ns) { _idle_since_ns = now_ns; }
+    /// The runtime a workgroup coming back to the queue is allowed to run ahead of the minimum vruntime.
+    /// It is half of |ideal_runtime_ns| as before, and grows with the time the workgroup has been idle up to
+    /// config::workgroup_max_burst_credit_ms, so a bursty and mostly idle workgroup gets the cores right away
+    /// instead of sharing them evenly with the busy ones.
+    int64_t burst_credit_ns(int64_t ideal_runtime_ns, int64_t now_ns) const;
+
 private:
     WorkGroup* _workgroup; // The workgroup owning this entity.
 
@@ -93,6 +101,8 @@ private:
     int64_t _unadjusted_runtime_ns = 0;
     int64_t _curr_unadjusted_runtime_ns = 0;
     int64_t _last_unadjusted_runtime_ns = 0;
+
+    int64_t _idle_since_ns = 0;
 };
 
 using WorkGroupDriverSchedEntity = WorkGroupSchedEntity<pipeline::DriverQueue>;
@@ -197,6 +207,17 @@ public:
     void incr_cpu_runtime_ns(int64_t delta_ns) { _cpu_runtime_ns += delta_ns; }
     int64_t cpu_runtime_ns() const { return _cpu_runtime_ns; }
 
+    // The disk io budget of this workgroup, which is config::workgroup_io_bytes_per_second_per_core per core of
+    // its cpu weight, or 0 if it is unlimited.
+    int64_t io_bytes_per_second_limit() const;
+    // Charge the disk io issued by the io tasks of this workgroup, i.e. scan and spill, to its io budget.
+    // The budget is a token bucket holding up to IO_BURST_NS of io, and each io op is charged at least
+    // MIN_IO_BYTES_PER_OP, so that the small random reads are bounded by IOPS too.
+    void charge_io(int64_t bytes, int64_t ops, int64_t now_ns);
+    // Whether the io tasks of this workgroup should wait, since it has run out of its io budget.
+    bool is_io_throttled(int64_t now_ns) const { return _io_budget_ready_ns.load(std::memory_order_relaxed) > now_ns; }
+    int64_t io_bytes() const { return _io_bytes; }
+
     void set_shared_executors(PipelineExecutorSet* executors) { _executors = executors; }
     void set_exclusive_executors(std::unique_ptr<PipelineExecutorSet> executors) {
         _exclusive_executors = std::move(executors);
@@ -217,6 +238,9 @@ public:
     // if it runs in the worker thread owned by other workgroup, which has running drivers.
     static constexpr int64_t YIELD_PREEMPT_MAX_TIME_SPENT = 5'000'000L;
 
+    static constexpr int64_t IO_BURST_NS = 1'000'000'000L;
+    static constexpr int64_t MIN_IO_BYTES_PER_OP = 4096;
+
 private:
     static constexpr double ABSENT_MEMORY_LIMIT = -1;
     static constexpr size_t ABSENT_CONCURRENCY_LIMIT = 0;
@@ -259,6 +283,9 @@ private:
     /// The total CPU runtime cost in nanos unit, including driver execution time, and the cpu execution time of
     /// other threads including Source and Sink threads.
     std::atomic<int64_t> _cpu_runtime_ns = 0;
+    std::atomic<int64_t> _io_bytes = 0;
+    // The time when the io charged so far has been paid off by the io budget.
+    std::atomic<int64_t> _io_budget_ready_ns = 0;
 
     std::unique_ptr<PipelineExecutorSet> _exclusive_executors;
     PipelineExecutorSet* _executors = nullptr;
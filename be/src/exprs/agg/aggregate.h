@@ -168,6 +168,13 @@ public:
     virtual void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                            AggDataPtr __restrict state) const = 0;
 
+    // update the rows whose null_data[i] is 0 to single state, used by the no-group-by aggregation of a nullable
+    // column. Returns false if the function has no such batch kernel, then the caller updates row by row.
+    virtual bool update_batch_single_state_not_null(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                                    const uint8_t* null_data, AggDataPtr __restrict state) const {
+        return false;
+    }
+
     // For window functions
     // A peer group is all of the rows that are peers within the specified ordering.
     // Rows are peers if they compare equal to each other using the specified ordering expression.
@@ -99,6 +99,10 @@ class ThreadLocalStateAllocatorSetter {
 public:
     ThreadLocalStateAllocatorSetter(Allocator* allocator)
             : _agg_state_allocator_setter(allocator), _roaring_allocator_setter(allocator) {}
+    // The roaring bitmaps can be moved out of the states, e.g. into the result column, so they may need
+    // an allocator that is still valid after the states are gone.
+    ThreadLocalStateAllocatorSetter(Allocator* agg_state_allocator, Allocator* roaring_allocator)
+            : _agg_state_allocator_setter(agg_state_allocator), _roaring_allocator_setter(roaring_allocator) {}
     ~ThreadLocalStateAllocatorSetter() = default;
 
 private:
@@ -106,7 +110,7 @@ private:
     ThreadLocalRoaringAllocatorSetter _roaring_allocator_setter;
 };
 
-#define SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(allocator) \
-    auto VARNAME_LINENUM(alloc_setter) = ThreadLocalStateAllocatorSetter(allocator)
+#define SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(...) \
+    auto VARNAME_LINENUM(alloc_setter) = ThreadLocalStateAllocatorSetter(__VA_ARGS__)
 
 } // namespace starrocks
@@ -51,20 +51,20 @@ struct ApproxTopKState {
     int32_t k = 0;
     int32_t counter_num = 0;
     int32_t unused_idx = 0;
+    // The counters are allocated on demand, so the groups with a few distinct values stay small,
+    // counters.size() is always unused_idx.
     mutable VectorWithAggStateAllocator<Counter> counters;
     mutable Counter null_counter{0};
     using EQ = std::conditional_t<IsSlice<CppType>, SliceEqual, phmap::priv::hash_default_eq<CppType>>;
-    phmap::flat_hash_map<CppType, Counter*, PhmapDefaultHashFunc<LT, PhmapSeed1>, EQ> table;
+    // value -> index of its counter
+    phmap::flat_hash_map<CppType, int32_t, PhmapDefaultHashFunc<LT, PhmapSeed1>, EQ> table;
     bool is_init = false;
 
     void reset(int32_t k, int32_t counter_num) {
         this->k = k;
         this->counter_num = counter_num;
         this->unused_idx = 0;
-        this->counters.reserve(counter_num);
-        for (size_t i = 0; i < counter_num; i++) {
-            this->counters.emplace_back(i);
-        }
+        this->counters.clear();
         null_counter.count = 0;
         this->table.clear();
     }
@@ -83,14 +83,14 @@ struct ApproxTopKState {
     void process(MemPool* mem_pool, const CppType& value, const int64_t count, bool is_merge) {
         auto it = table.find(value);
         if (it != table.end()) {
-            auto* counter = it->second;
-            counter->count += count;
-            _maintain_ordering(counter->_index);
+            const int32_t idx = it->second;
+            counters[idx].count += count;
+            _maintain_ordering(idx);
         } else if (unused_idx < counter_num) {
-            auto& empty_counter = counters[unused_idx];
+            auto& empty_counter = counters.emplace_back(unused_idx);
             empty_counter.value = _copy<IsDeepCopy>(mem_pool, value);
             empty_counter.count = count;
-            table[empty_counter.value] = &empty_counter;
+            table[empty_counter.value] = unused_idx;
             unused_idx++;
             _maintain_ordering(unused_idx - 1);
         } else {
@@ -101,13 +101,13 @@ struct ApproxTopKState {
                 min_counter.value = _copy<IsDeepCopy>(mem_pool, value);
                 // This is by design, space space algorithm requires increasing it instead of setting to <count>
                 min_counter.count += count;
-                table[min_counter.value] = &min_counter;
+                table[min_counter.value] = min_idx;
                 _maintain_ordering(min_idx);
             } else if (count > min_counter.count) {
                 table.erase(min_counter.value);
                 min_counter.value = _copy<IsDeepCopy>(mem_pool, value);
                 min_counter.count = count;
-                table[min_counter.value] = &min_counter;
+                table[min_counter.value] = min_idx;
                 _maintain_ordering(min_idx);
             }
         }
@@ -202,13 +202,13 @@ private:
                 table.erase(counters[i].value);
             }
             for (size_t i = start; i <= end; i++) {
-                table[counters[i].value] = &counters[i];
+                table[counters[i].value] = i;
             }
         }
         DCHECK(std::is_sorted(counters.begin(), counters.begin() + unused_idx, cmp));
         [[maybe_unused]] auto check = [this]() -> bool {
             // Check index
-            for (size_t i = 0; i < counter_num; i++) {
+            for (size_t i = 0; i < counters.size(); i++) {
                 if (i != counters[i]._index) {
                     return false;
                 }
@@ -216,7 +216,7 @@ private:
             // Check table
             static EQ eq;
             for (auto& [k, v] : table) {
-                if (!eq(k, v->value)) {
+                if (!eq(k, counters[v].value)) {
                     return false;
                 }
             }
@@ -247,14 +247,19 @@ public:
     static constexpr int32_t DEFAULT_K = 5;
     static constexpr int32_t MAX_COUNTER_NUM = 100000;
 
-    std::pair<int32_t, int32_t> get_k_and_counter_num(FunctionContext* ctx) const {
-        int32_t k = DEFAULT_K;
-        if (ctx->get_num_args() > 1) {
+    // The combinators of the agg state (e.g. approx_top_k_union) have no constant arguments, they use the
+    // `default_k` and `default_counter_num` serialized in the states instead.
+    std::pair<int32_t, int32_t> get_k_and_counter_num(FunctionContext* ctx, int32_t default_k = DEFAULT_K,
+                                                      int32_t default_counter_num = 0) const {
+        int32_t k = default_k;
+        if (ctx->get_num_args() > 1 && ctx->is_notnull_constant_column(1)) {
             k = ColumnHelper::get_const_value<TYPE_INT>(ctx->get_constant_column(1));
         }
         int32_t counter_num;
-        if (ctx->get_num_args() > 2) {
+        if (ctx->get_num_args() > 2 && ctx->is_notnull_constant_column(2)) {
             counter_num = ColumnHelper::get_const_value<TYPE_INT>(ctx->get_constant_column(2));
+        } else if (default_counter_num >= k) {
+            counter_num = default_counter_num;
         } else {
             counter_num = std::min(std::max(2 * k, 100), MAX_COUNTER_NUM);
         }
@@ -266,12 +271,13 @@ public:
         return std::make_pair(k, counter_num);
     }
 
-    void init_state_if_necessary(FunctionContext* ctx, AggDataPtr __restrict state) const {
+    void init_state_if_necessary(FunctionContext* ctx, AggDataPtr __restrict state, int32_t default_k = DEFAULT_K,
+                                 int32_t default_counter_num = 0) const {
         if (this->data(state).is_init) {
             return;
         }
         this->data(state).is_init = true;
-        const auto kv = get_k_and_counter_num(ctx);
+        const auto kv = get_k_and_counter_num(ctx, default_k, default_counter_num);
         this->data(state).reset(kv.first, kv.second);
     }
 
@@ -318,8 +324,17 @@ public:
             std::memcpy(&descrialize_counters[i].count, bytes.data + start, sizeof(int64_t));
             start += sizeof(int64_t);
         }
+        // k and counter number, absent in the states serialized by the old versions
+        int32_t k = DEFAULT_K;
+        int32_t counter_num = 0;
+        if (start + 2 * sizeof(int32_t) <= bytes.size) {
+            std::memcpy(&k, bytes.data + start, sizeof(int32_t));
+            start += sizeof(int32_t);
+            std::memcpy(&counter_num, bytes.data + start, sizeof(int32_t));
+            start += sizeof(int32_t);
+        }
 
-        init_state_if_necessary(ctx, state);
+        init_state_if_necessary(ctx, state, k, counter_num);
         this->data(state).process_null(null_count);
         this->data(state).merge(ctx->mem_pool(), descrialize_counters);
     }
@@ -332,6 +347,42 @@ public:
         this->data(state).template process<true>(ctx->mem_pool(), value, 1, false);
     }
 
+    // process(value, n) is the same as processing the value n times, so the runs of the same value of a state
+    // are processed at once.
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        const auto* column = down_cast<const InputColumnType*>(ColumnHelper::get_data_column(columns[0]));
+        size_t i = 0;
+        while (i < chunk_size) {
+            const auto& value = AggDataTypeTraits<LT>::get_row_ref(*column, i);
+            size_t j = i + 1;
+            while (j < chunk_size && states[j] == states[i] &&
+                   AggDataTypeTraits<LT>::get_row_ref(*column, j) == value) {
+                j++;
+            }
+            AggDataPtr state = states[i] + state_offset;
+            init_state_if_necessary(ctx, state);
+            this->data(state).template process<true>(ctx->mem_pool(), value, j - i, false);
+            i = j;
+        }
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        init_state_if_necessary(ctx, state);
+        const auto* column = down_cast<const InputColumnType*>(ColumnHelper::get_data_column(columns[0]));
+        size_t i = 0;
+        while (i < chunk_size) {
+            const auto& value = AggDataTypeTraits<LT>::get_row_ref(*column, i);
+            size_t j = i + 1;
+            while (j < chunk_size && AggDataTypeTraits<LT>::get_row_ref(*column, j) == value) {
+                j++;
+            }
+            this->data(state).template process<true>(ctx->mem_pool(), value, j - i, false);
+            i = j;
+        }
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         DCHECK(to->is_binary());
         serialize_state(this->data(state), down_cast<BinaryColumn*>(to));
@@ -379,6 +430,8 @@ public:
         total_size += sizeof(int64_t);
         // effective counter number
         total_size += sizeof(int32_t);
+        // k and counter number
+        total_size += 2 * sizeof(int32_t);
         for (auto& counter : state.counters) {
             if (counter.count == 0) {
                 continue;
@@ -424,6 +477,12 @@ public:
             std::memcpy(bytes.data() + start, &counter.count, sizeof(int64_t));
             start += sizeof(int64_t);
         }
+        // k and counter number, appended after the counters to keep compatible with the old versions
+        std::memcpy(bytes.data() + start, &state.k, sizeof(int32_t));
+        start += sizeof(int32_t);
+        std::memcpy(bytes.data() + start, &state.counter_num, sizeof(int32_t));
+        start += sizeof(int32_t);
+        DCHECK_EQ(new_size, start);
         dst->get_offset().emplace_back(new_size);
     }
 
@@ -21,6 +21,7 @@
 #include "column/type_traits.h"
 #include "exec/sorting/sorting.h"
 #include "exprs/agg/aggregate.h"
+#include "exprs/agg/helpers/state_row_groups.hpp"
 #include "exprs/function_context.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
@@ -266,6 +267,60 @@ public:
         }
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        StateRowGroups groups;
+        groups.build(chunk_size, states);
+        update_groups(ctx, chunk_size, state_offset, columns, groups);
+    }
+
+    void update_batch_selectively(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                                  AggDataPtr* states, const Filter& filter) const override {
+        StateRowGroups groups;
+        groups.build(chunk_size, states, filter.data());
+        update_groups(ctx, chunk_size, state_offset, columns, groups);
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        if (UNLIKELY(!check_input_size(ctx, chunk_size, columns))) {
+            return;
+        }
+        auto& state_impl = this->data(state);
+        for (auto i = 0; i < ctx->get_num_args(); ++i) {
+            if (columns[i]->is_constant()) {
+                StateRowGroups::append_rows(state_impl.data_columns[i].get(), *columns[i], nullptr, 0, chunk_size);
+            } else {
+                state_impl.update(*columns[i], i, 0, chunk_size);
+            }
+        }
+    }
+
+    // Append the rows of every state with one append_selective per argument.
+    void update_groups(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                       const StateRowGroups& groups) const {
+        if (UNLIKELY(!check_input_size(ctx, chunk_size, columns))) {
+            return;
+        }
+        for (size_t g = 0; g < groups.num_groups(); ++g) {
+            auto& state_impl = this->data(groups.state(g) + state_offset);
+            for (auto i = 0; i < ctx->get_num_args(); ++i) {
+                StateRowGroups::append_rows(state_impl.data_columns[i].get(), *columns[i], groups.rows(),
+                                            groups.from(g), groups.size(g));
+            }
+        }
+    }
+
+    bool check_input_size(FunctionContext* ctx, size_t chunk_size, const Column** columns) const {
+        for (auto i = 0; i < ctx->get_num_args(); ++i) {
+            if (UNLIKELY(!columns[i]->is_constant() && columns[i]->size() < chunk_size)) {
+                ctx->set_error(std::string(get_name() + "'s update row number overflow").c_str(), false);
+                return false;
+            }
+        }
+        return true;
+    }
+
     // struct and array elements aren't be null, as they consist from several columns
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         auto& input_columns = down_cast<const StructColumn*>(ColumnHelper::get_data_column(column))->fields();
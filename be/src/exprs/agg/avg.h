@@ -16,10 +16,12 @@
 
 #include "column/type_traits.h"
 #include "exprs/agg/aggregate.h"
+#include "exprs/agg/helpers/simd_reduce.hpp"
 #include "exprs/agg/sum.h"
 #include "exprs/arithmetic_operation.h"
 #include "exprs/function_context.h"
 #include "gutil/casts.h"
+#include "simd/simd.h"
 #include "types/logical_type.h"
 
 namespace starrocks {
@@ -123,6 +125,31 @@ public:
         return AggStateTableKind::INTERMEDIATE;
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        if constexpr (lt_is_arithmetic<LT> || lt_is_decimal<LT>) {
+            const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+            this->data(state).sum = SIMDReduce::sum<ImmediateType>(data, nullptr, chunk_size, this->data(state).sum);
+            this->data(state).count += chunk_size;
+        } else {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                do_update<true>(ctx, columns, state, i);
+            }
+        }
+    }
+
+    bool update_batch_single_state_not_null(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                            const uint8_t* null_data, AggDataPtr __restrict state) const override {
+        if constexpr (lt_is_arithmetic<LT> || lt_is_decimal<LT>) {
+            const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+            this->data(state).sum = SIMDReduce::sum<ImmediateType>(data, null_data, chunk_size, this->data(state).sum);
+            this->data(state).count += SIMD::count_zero(null_data, chunk_size);
+            return true;
+        } else {
+            return false;
+        }
+    }
+
     void retract(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
                  size_t row_num) const override {
         do_update<false>(ctx, columns, state, row_num);
@@ -19,6 +19,7 @@
 #include "column/object_column.h"
 #include "column/vectorized_fwd.h"
 #include "exprs/agg/aggregate.h"
+#include "exprs/agg/helpers/state_row_groups.hpp"
 #include "gutil/casts.h"
 #include "types/bitmap_value.h"
 
@@ -52,6 +53,65 @@ public:
         }
     }
 
+    // The batch methods collect the bitmaps of every state, and intersect them by BitmapValue::fast_intersect.
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        intersect_batch(down_cast<const BitmapColumn*>(columns[0]), chunk_size, state_offset, states);
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        intersect_range(down_cast<const BitmapColumn*>(columns[0]), 0, chunk_size, state);
+    }
+
+    void merge_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column* column,
+                     AggDataPtr* states) const override {
+        DCHECK(column->is_object());
+        intersect_batch(down_cast<const BitmapColumn*>(column), chunk_size, state_offset, states);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        DCHECK(column->is_object());
+        intersect_range(down_cast<const BitmapColumn*>(column), start, size, state);
+    }
+
+    void intersect_batch(const BitmapColumn* col, size_t chunk_size, size_t state_offset, AggDataPtr* states) const {
+        StateRowGroups groups;
+        groups.build(chunk_size, states);
+        std::vector<const BitmapValue*> values;
+        for (size_t g = 0; g < groups.num_groups(); ++g) {
+            values.clear();
+            const uint32_t* rows = groups.rows() + groups.from(g);
+            for (uint32_t i = 0; i < groups.size(g); ++i) {
+                values.emplace_back(col->get_object(rows[i]));
+            }
+            intersect_values(values, groups.state(g) + state_offset);
+        }
+    }
+
+    void intersect_range(const BitmapColumn* col, size_t start, size_t size, AggDataPtr __restrict state) const {
+        std::vector<const BitmapValue*> values;
+        values.reserve(size);
+        for (size_t i = start; i < start + size; ++i) {
+            values.emplace_back(col->get_object(i));
+        }
+        intersect_values(values, state);
+    }
+
+    void intersect_values(std::vector<const BitmapValue*>& values, AggDataPtr __restrict state) const {
+        if (values.empty()) {
+            return;
+        }
+        auto& packed = this->data(state);
+        if (!packed.initial) {
+            packed.bitmap |= *values.back();
+            packed.initial = true;
+            values.pop_back();
+        }
+        packed.bitmap.fast_intersect(values);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         auto* col = down_cast<BitmapColumn*>(to);
         auto& bitmap = const_cast<BitmapValue&>(this->data(state).bitmap);
@@ -17,6 +17,7 @@
 #include "column/nullable_column.h"
 #include "exprs/agg/aggregate.h"
 #include "gutil/casts.h"
+#include "simd/simd.h"
 
 namespace starrocks {
 
@@ -203,9 +204,7 @@ public:
             const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
             if (nullable_column->has_null()) {
                 const uint8_t* null_data = nullable_column->immutable_null_column_data().data();
-                for (size_t i = 0; i < chunk_size; ++i) {
-                    this->data(state).count += !null_data[i];
-                }
+                this->data(state).count += SIMD::count_zero(null_data, chunk_size);
             } else {
                 this->data(state).count += nullable_column->size();
             }
@@ -15,8 +15,10 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <string>
 #include <type_traits>
 
@@ -27,6 +29,7 @@
 #include "column/hash_set.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/agg/aggregate.h"
 #include "exprs/agg/aggregate_state_allocator.h"
 #include "exprs/agg/sum.h"
@@ -37,6 +40,7 @@
 #include "runtime/mem_pool.h"
 #include "runtime/memory/counting_allocator.h"
 #include "thrift/protocol/TJSONProtocol.h"
+#include "types/bitmap_value.h"
 #include "util/phmap/phmap_dump.h"
 #include "util/slice.h"
 
@@ -55,28 +59,78 @@ struct DistinctAggregateState<LT, SumLT, FixedLengthLTGuard<LT>> {
     using SumType = RunTimeCppType<SumLT>;
     using MyHashSet = HashSetWithAggStateAllocator<T>;
 
-    void update(T key) { set.insert(key); }
+    // A large set of integers in a narrow range is moved into a roaring bitmap, which takes about 2 bytes
+    // per value instead of the 8~16 bytes of the hash set, and is much cheaper to insert into once the set
+    // doesn't fit in cache. See `_maybe_convert_to_bitmap`.
+    static constexpr bool kCanUseBitmap = std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+    // The bitmap is used only if the range of the values is at most `kMaxBitmapRangePerValue` times the
+    // number of the values.
+    static constexpr uint64_t kMaxBitmapRangePerValue = 16;
+
+    void update(T key) {
+        if constexpr (kCanUseBitmap) {
+            if (bitmap != nullptr) {
+                bitmap->add(static_cast<uint64_t>(static_cast<int64_t>(key)));
+            } else if (set.insert(key).second) {
+                _maybe_convert_to_bitmap(set.size() - 1);
+            }
+        } else {
+            set.insert(key);
+        }
+    }
 
-    void update_with_hash([[maybe_unused]] MemPool* mempool, T key, size_t hash) { set.emplace_with_hash(hash, key); }
+    void update_with_hash([[maybe_unused]] MemPool* mempool, T key, size_t hash) {
+        if constexpr (kCanUseBitmap) {
+            if (bitmap != nullptr) {
+                bitmap->add(static_cast<uint64_t>(static_cast<int64_t>(key)));
+            } else if (set.emplace_with_hash(hash, key).second) {
+                _maybe_convert_to_bitmap(set.size() - 1);
+            }
+        } else {
+            set.emplace_with_hash(hash, key);
+        }
+    }
 
     void prefetch(T key) { set.prefetch(key); }
 
-    int64_t disctint_count() const { return set.size(); }
+    int64_t disctint_count() const {
+        if constexpr (kCanUseBitmap) {
+            if (bitmap != nullptr) {
+                return bitmap->cardinality();
+            }
+        }
+        return set.size();
+    }
 
+    // The bitmap is serialized as a hash set, so the serialized states are the same as before no matter
+    // which one the state uses.
     size_t serialize_size() const {
-        size_t size = set.dump_bound();
+        const MyHashSet& dump_set = _set_to_dump();
+        size_t size = dump_set.dump_bound();
         DCHECK(size >= MIN_SIZE_OF_HASH_SET_SERIALIZED_DATA);
         return size;
     }
 
     void serialize(uint8_t* dst) const {
+        const MyHashSet& dump_set = _set_to_dump();
         phmap::InMemoryOutput output(reinterpret_cast<char*>(dst));
-        set.dump(output);
-        DCHECK(output.length() == set.dump_bound());
+        dump_set.dump(output);
+        DCHECK(output.length() == dump_set.dump_bound());
+        _bitmap_dump_set.reset();
     }
 
     void deserialize_and_merge(const uint8_t* src, size_t len) {
         phmap::InMemoryInput input(reinterpret_cast<const char*>(src));
+        if constexpr (kCanUseBitmap) {
+            if (bitmap != nullptr) {
+                MyHashSet set_src;
+                set_src.load(input);
+                for (auto key : set_src) {
+                    bitmap->add(static_cast<uint64_t>(static_cast<int64_t>(key)));
+                }
+                return;
+            }
+        }
         auto old_size = set.size();
         if (old_size == 0) {
             set.load(input);
@@ -85,6 +139,9 @@ struct DistinctAggregateState<LT, SumLT, FixedLengthLTGuard<LT>> {
             set_src.load(input);
             set.merge(set_src);
         }
+        if constexpr (kCanUseBitmap) {
+            _maybe_convert_to_bitmap(old_size);
+        }
     }
 
     SumType sum_distinct() const {
@@ -94,6 +151,16 @@ struct DistinctAggregateState<LT, SumLT, FixedLengthLTGuard<LT>> {
             return sum;
         }
 
+        if constexpr (kCanUseBitmap) {
+            if (bitmap != nullptr) {
+                Buffer<int64_t> values;
+                bitmap->to_array(&values);
+                for (auto key : values) {
+                    sum += static_cast<T>(key);
+                }
+                return sum;
+            }
+        }
         for (auto& key : set) {
             sum += key;
         }
@@ -101,6 +168,51 @@ struct DistinctAggregateState<LT, SumLT, FixedLengthLTGuard<LT>> {
     }
 
     MyHashSet set;
+    // Not null once the values have been moved from `set` into it.
+    std::unique_ptr<BitmapValue> bitmap;
+
+private:
+    // Check the density only when the size of the set crosses a power of two, so the scans of the set
+    // cost O(1) per value.
+    void _maybe_convert_to_bitmap(size_t old_size) {
+        const int64_t min_size = config::distinct_agg_bitmap_min_size;
+        if (min_size <= 0 || set.size() < static_cast<size_t>(min_size) ||
+            std::bit_width(old_size) == std::bit_width(set.size())) {
+            return;
+        }
+        auto [min_it, max_it] = std::minmax_element(set.begin(), set.end());
+        const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(*max_it)) -
+                               static_cast<uint64_t>(static_cast<int64_t>(*min_it));
+        if (range / kMaxBitmapRangePerValue >= set.size()) {
+            return;
+        }
+        bitmap = std::make_unique<BitmapValue>();
+        for (auto key : set) {
+            bitmap->add(static_cast<uint64_t>(static_cast<int64_t>(key)));
+        }
+        MyHashSet().swap(set);
+    }
+
+    const MyHashSet& _set_to_dump() const {
+        if constexpr (kCanUseBitmap) {
+            if (bitmap != nullptr) {
+                if (_bitmap_dump_set == nullptr) {
+                    Buffer<int64_t> values;
+                    bitmap->to_array(&values);
+                    _bitmap_dump_set = std::make_unique<MyHashSet>();
+                    _bitmap_dump_set->reserve(values.size());
+                    for (auto key : values) {
+                        _bitmap_dump_set->insert(static_cast<T>(key));
+                    }
+                }
+                return *_bitmap_dump_set;
+            }
+        }
+        return set;
+    }
+
+    // The values of `bitmap` as a hash set, built by serialize_size and released by serialize.
+    mutable std::unique_ptr<MyHashSet> _bitmap_dump_set;
 };
 
 template <LogicalType LT, LogicalType SumLT>
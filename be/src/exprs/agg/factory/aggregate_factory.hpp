@@ -196,6 +196,8 @@ public:
 
     static AggregateFunctionPtr MakePercentileApproxAggregateFunction();
 
+    static AggregateFunctionPtr MakePercentileApproxDDSketchAggregateFunction();
+
     static AggregateFunctionPtr MakePercentileUnionAggregateFunction();
 
     template <LogicalType LT>
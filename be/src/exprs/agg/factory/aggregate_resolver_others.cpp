@@ -52,6 +52,8 @@ void AggregateFuncResolver::register_others() {
                                                             AggregateFactory::MakePercentileApproxAggregateFunction());
     add_aggregate_mapping_notnull<TYPE_DOUBLE, TYPE_DOUBLE>("percentile_approx", false,
                                                             AggregateFactory::MakePercentileApproxAggregateFunction());
+    add_aggregate_mapping_notnull<TYPE_DOUBLE, TYPE_DOUBLE>(
+            "percentile_approx_ddsketch", false, AggregateFactory::MakePercentileApproxDDSketchAggregateFunction());
     add_aggregate_mapping<TYPE_PERCENTILE, TYPE_PERCENTILE, PercentileValue>(
             "percentile_union", false, AggregateFactory::MakePercentileUnionAggregateFunction());
 
@@ -23,6 +23,7 @@
 #include "column/type_traits.h"
 #include "exec/sorting/sorting.h"
 #include "exprs/agg/aggregate.h"
+#include "exprs/agg/helpers/state_row_groups.hpp"
 #include "exprs/function_context.h"
 #include "gutil/casts.h"
 #include "runtime/runtime_state.h"
@@ -404,19 +405,82 @@ public:
         }
     }
 
+    void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                      AggDataPtr* states) const override {
+        Filter skip(chunk_size, 0);
+        if (!skip_null_outputs(ctx, chunk_size, columns, &skip)) {
+            return;
+        }
+        StateRowGroups groups;
+        groups.build(chunk_size, states, skip.data());
+        update_groups(ctx, state_offset, columns, groups);
+    }
+
+    void update_batch_selectively(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                                  AggDataPtr* states, const Filter& filter) const override {
+        Filter skip(filter.begin(), filter.begin() + chunk_size);
+        if (!skip_null_outputs(ctx, chunk_size, columns, &skip)) {
+            return;
+        }
+        StateRowGroups groups;
+        groups.build(chunk_size, states, skip.data());
+        update_groups(ctx, state_offset, columns, groups);
+    }
+
     void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
                                    AggDataPtr __restrict state) const override {
         auto& state_impl = this->data(state);
         if (state_impl.data_columns == nullptr) {
             create_impl(ctx, state_impl);
         }
-        for (auto i = 0; i < state_impl.output_col_num; ++i) {
+        Filter skip(chunk_size, 0);
+        if (!skip_null_outputs(ctx, chunk_size, columns, &skip)) {
+            return;
+        }
+        std::vector<uint32_t> rows;
+        rows.reserve(chunk_size);
+        for (uint32_t i = 0; i < chunk_size; ++i) {
+            if (!skip[i]) {
+                rows.emplace_back(i);
+            }
+        }
+        append_rows(ctx, state, columns, rows.data(), 0, rows.size());
+    }
+
+    // Mark the rows with any null output column in `skip`, return false if all the rows are skipped.
+    static bool skip_null_outputs(FunctionContext* ctx, size_t chunk_size, const Column** columns, Filter* skip) {
+        auto output_col_num = static_cast<int>(ctx->get_num_args() - ctx->get_nulls_first().size()) - 1;
+        for (auto i = 0; i < output_col_num; ++i) {
             if (columns[i]->only_null()) {
-                return;
+                return false;
+            }
+            if (columns[i]->is_nullable() && !columns[i]->is_constant() && columns[i]->has_null()) {
+                const auto& nulls = down_cast<const NullableColumn*>(columns[i])->immutable_null_column_data();
+                for (size_t row = 0; row < chunk_size; ++row) {
+                    (*skip)[row] |= nulls[row];
+                }
             }
         }
-        for (size_t i = 0; i < chunk_size; ++i) {
-            update(ctx, columns, state, i);
+        return true;
+    }
+
+    // Append the rows of every state with one append_selective per argument.
+    void update_groups(FunctionContext* ctx, size_t state_offset, const Column** columns,
+                       const StateRowGroups& groups) const {
+        for (size_t g = 0; g < groups.num_groups(); ++g) {
+            append_rows(ctx, groups.state(g) + state_offset, columns, groups.rows(), groups.from(g), groups.size(g));
+        }
+    }
+
+    void append_rows(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns, const uint32_t* rows,
+                     uint32_t from, uint32_t size) const {
+        auto& state_impl = this->data(state);
+        if (state_impl.data_columns == nullptr) {
+            create_impl(ctx, state_impl);
+        }
+        // data_columns is empty if create_impl failed.
+        for (auto i = 0; i < state_impl.data_columns->size(); ++i) {
+            StateRowGroups::append_rows((*state_impl.data_columns)[i].get(), *columns[i], rows, from, size);
         }
     }
 
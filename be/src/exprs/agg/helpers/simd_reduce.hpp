@@ -0,0 +1,85 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace starrocks {
+
+// Reduction kernels of the no-group-by aggregation (sum/avg/min/max over fixed-width columns).
+//
+// The rows are reduced into kReduceLanes independent accumulators, which breaks the loop-carried dependency
+// so the compiler can keep the accumulators in vector registers. This matters for floating point types, whose
+// reductions are never auto-vectorized without -ffast-math. The null rows are replaced by the identity of
+// the reduction instead of branching on them, so a nullable column is reduced in the same single pass.
+class SIMDReduce {
+public:
+    static constexpr size_t kReduceLanes = 8;
+
+    // Fold data[0, size) into `acc` with `op`, skipping the rows whose nulls[i] is not 0.
+    // `nulls` may be nullptr if there is no null.
+    template <typename Acc, typename T, typename Op>
+    static Acc reduce(const T* __restrict data, const uint8_t* __restrict nulls, size_t size, Acc acc,
+                      Acc identity, Op op) {
+        Acc lanes[kReduceLanes];
+        std::fill(lanes, lanes + kReduceLanes, identity);
+
+        const size_t batch_end = size / kReduceLanes * kReduceLanes;
+        size_t i = 0;
+        if (nulls == nullptr) {
+            for (; i < batch_end; i += kReduceLanes) {
+                for (size_t j = 0; j < kReduceLanes; ++j) {
+                    lanes[j] = op(lanes[j], static_cast<Acc>(data[i + j]));
+                }
+            }
+        } else {
+            for (; i < batch_end; i += kReduceLanes) {
+                for (size_t j = 0; j < kReduceLanes; ++j) {
+                    lanes[j] = op(lanes[j], nulls[i + j] ? identity : static_cast<Acc>(data[i + j]));
+                }
+            }
+        }
+        for (size_t j = 0; j < kReduceLanes; ++j) {
+            acc = op(acc, lanes[j]);
+        }
+        for (; i < size; ++i) {
+            if (nulls == nullptr || !nulls[i]) {
+                acc = op(acc, static_cast<Acc>(data[i]));
+            }
+        }
+        return acc;
+    }
+
+    template <typename Acc, typename T>
+    static Acc sum(const T* data, const uint8_t* nulls, size_t size, Acc acc) {
+        return reduce<Acc>(data, nulls, size, acc, Acc{}, [](Acc l, Acc r) { return l + r; });
+    }
+
+    // `identity` is the lower bound of the type, i.e. the initial value of the max state.
+    template <typename Acc, typename T>
+    static Acc max(const T* data, const uint8_t* nulls, size_t size, Acc acc, Acc identity) {
+        return reduce<Acc>(data, nulls, size, acc, identity, [](Acc l, Acc r) { return std::max<Acc>(l, r); });
+    }
+
+    // `identity` is the upper bound of the type, i.e. the initial value of the min state.
+    template <typename Acc, typename T>
+    static Acc min(const T* data, const uint8_t* nulls, size_t size, Acc acc, Acc identity) {
+        return reduce<Acc>(data, nulls, size, acc, identity, [](Acc l, Acc r) { return std::min<Acc>(l, r); });
+    }
+};
+
+} // namespace starrocks
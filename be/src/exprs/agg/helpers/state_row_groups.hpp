@@ -0,0 +1,110 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "column/column.h"
+#include "column/const_column.h"
+#include "exprs/agg/aggregate.h"
+#include "gutil/casts.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+// StateRowGroups groups the rows of a chunk by their aggregate states with a counting sort, so the aggregate
+// functions collecting their input rows (array_agg, group_concat) can append all the rows of a state in one
+// append_selective call, instead of several small appends per row.
+// The rows of a state keep their input order.
+class StateRowGroups {
+public:
+    // Group the rows whose `skip` is 0, or all the rows if `skip` is nullptr.
+    void build(size_t chunk_size, const AggDataPtr* states, const uint8_t* skip = nullptr) {
+        _states.clear();
+        _offsets.assign(1, 0);
+        _rows.resize(chunk_size);
+        _row_groups.resize(chunk_size);
+        _state_to_group.clear();
+
+        std::vector<uint32_t> counts;
+        AggDataPtr last_state = nullptr;
+        uint32_t last_group = 0;
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (skip != nullptr && skip[i]) {
+                continue;
+            }
+            // The rows of the same group are usually adjacent, e.g. sorted or clustered by the group by keys.
+            if (states[i] != last_state || counts.empty()) {
+                auto [iter, inserted] = _state_to_group.try_emplace(states[i], _states.size());
+                if (inserted) {
+                    _states.emplace_back(states[i]);
+                    counts.emplace_back(0);
+                }
+                last_state = states[i];
+                last_group = iter->second;
+            }
+            _row_groups[i] = last_group;
+            counts[last_group]++;
+        }
+
+        _offsets.resize(_states.size() + 1);
+        for (size_t g = 0; g < _states.size(); ++g) {
+            _offsets[g + 1] = _offsets[g] + counts[g];
+        }
+        // Reuse the counts as the next position of every group.
+        for (size_t g = 0; g < _states.size(); ++g) {
+            counts[g] = _offsets[g];
+        }
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (skip == nullptr || !skip[i]) {
+                _rows[counts[_row_groups[i]]++] = i;
+            }
+        }
+        _rows.resize(_offsets.back());
+    }
+
+    size_t num_groups() const { return _states.size(); }
+    AggDataPtr state(size_t group) const { return _states[group]; }
+    // The rows of the group are rows()[from(group), from(group) + size(group)).
+    const uint32_t* rows() const { return _rows.data(); }
+    uint32_t from(size_t group) const { return _offsets[group]; }
+    uint32_t size(size_t group) const { return _offsets[group + 1] - _offsets[group]; }
+
+    // Append the rows of `src` to the nullable `dst`, the const column is expanded.
+    static void append_rows(Column* dst, const Column& src, const uint32_t* rows, uint32_t from, uint32_t size) {
+        if (size == 0) {
+            return;
+        }
+        if (src.only_null()) {
+            dst->append_nulls(size);
+        } else if (src.is_constant()) {
+            dst->append_value_multiple_times(*down_cast<const ConstColumn&>(src).data_column(), 0, size);
+        } else {
+            dst->append_selective(src, rows, from, size);
+        }
+    }
+
+private:
+    std::vector<AggDataPtr> _states;
+    // _offsets[g] is the first row of group g in _rows.
+    std::vector<uint32_t> _offsets;
+    std::vector<uint32_t> _rows;
+    std::vector<uint32_t> _row_groups;
+    phmap::flat_hash_map<AggDataPtr, uint32_t> _state_to_group;
+};
+
+} // namespace starrocks
@@ -98,9 +98,8 @@ public:
         DCHECK(column->is_binary());
 
         const auto* hll_column = down_cast<const BinaryColumn*>(column);
-        HyperLogLog hll(hll_column->get(row_num).get_slice());
         int64_t prev_memory = this->data(state).mem_usage();
-        this->data(state).merge(hll);
+        this->data(state).merge_serialized(hll_column->get_slice(row_num));
         ctx->add_mem_usage(this->data(state).mem_usage() - prev_memory);
     }
 
@@ -21,6 +21,7 @@
 #include "column/type_traits.h"
 #include "exprs/agg/aggregate.h"
 #include "exprs/agg/aggregate_traits.h"
+#include "exprs/agg/helpers/simd_reduce.hpp"
 #include "gutil/casts.h"
 #include "util/raw_container.h"
 
@@ -151,6 +152,34 @@ public:
         OP()(this->data(state), value);
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        if (!update_batch_single_state_not_null(ctx, chunk_size, columns, nullptr, state)) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                update(ctx, columns, state, i);
+            }
+        }
+    }
+
+    bool update_batch_single_state_not_null(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                            const uint8_t* null_data, AggDataPtr __restrict state) const override {
+        if constexpr (lt_is_arithmetic<LT> || lt_is_decimal<LT>) {
+            using ResultType = std::decay_t<decltype(this->data(state).result)>;
+            const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+            auto& result = this->data(state).result;
+            if constexpr (std::is_same_v<OP, MaxElement<LT, State>>) {
+                result = SIMDReduce::max<ResultType>(data, null_data, chunk_size, result,
+                                                     RunTimeTypeLimits<LT>::min_value());
+                return true;
+            } else if constexpr (std::is_same_v<OP, MinElement<LT, State>>) {
+                result = SIMDReduce::min<ResultType>(data, null_data, chunk_size, result,
+                                                     RunTimeTypeLimits<LT>::max_value());
+                return true;
+            }
+        }
+        return false;
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
@@ -526,6 +526,17 @@ public:
             }
 
             const uint8_t* f_data = column->null_column()->raw_data();
+            if constexpr (IgnoreNull) {
+                // The SIMD pass, reduce the not null rows without branching on every row
+                if (this->nested_function->update_batch_single_state_not_null(
+                            ctx, chunk_size, &data_column, f_data, this->data(state).mutable_nest_state())) {
+                    if (SIMD::count_zero(f_data, chunk_size) > 0) {
+                        this->data(state).is_null = false;
+                    }
+                    return;
+                }
+            }
+
             int offset = 0;
 #ifdef __AVX2__
             // !important: filter must be an uint8_t container
@@ -19,6 +19,7 @@
 #include "column/vectorized_fwd.h"
 #include "exprs/agg/aggregate.h"
 #include "gutil/casts.h"
+#include "util/ddsketch.h"
 #include "util/percentile_value.h"
 #include "util/tdigest.h"
 
@@ -188,4 +189,161 @@ public:
 
     std::string get_name() const override { return "percentile_approx"; }
 };
+
+struct PercentileApproxDDSketchState {
+    DDSketch sketch;
+    double quantile = -1.0;
+    bool is_null = true;
+};
+
+// percentile_approx_ddsketch(expr, quantile) has the same semantic as percentile_approx, but estimates with a
+// DDSketch, whose state is a few KB at most and is a compact array of the bucket counts, so it takes much less
+// memory for a large number of groups, and merges by adding up the counts instead of re-sorting the centroids.
+// The intermediate state is the double quantile followed by the serialized sketch.
+class PercentileApproxDDSketchAggregateFunction final
+        : public AggregateFunctionBatchHelper<PercentileApproxDDSketchState,
+                                              PercentileApproxDDSketchAggregateFunction> {
+public:
+    void update(FunctionContext* ctx, const Column** columns, AggDataPtr __restrict state,
+                size_t row_num) const override {
+        if (columns[0]->is_null(row_num)) {
+            return;
+        }
+        if (!_check_quantile(ctx, columns[1])) {
+            return;
+        }
+        const auto* input = down_cast<const DoubleColumn*>(ColumnHelper::get_data_column(columns[0]));
+        _add(ctx, state, &input->get_data()[row_num], 1, columns[1]->get(0).get_double());
+    }
+
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        if (columns[0]->has_null()) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                update(ctx, columns, state, i);
+            }
+            return;
+        }
+        if (chunk_size == 0 || !_check_quantile(ctx, columns[1])) {
+            return;
+        }
+        const auto* input = down_cast<const DoubleColumn*>(ColumnHelper::get_data_column(columns[0]));
+        _add(ctx, state, input->get_data().data(), chunk_size, columns[1]->get(0).get_double());
+    }
+
+    void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
+        if (column->is_null(row_num)) {
+            return;
+        }
+        const auto* binary_column = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(column));
+        Slice src = binary_column->get_slice(row_num);
+        DDSketch sketch;
+        double quantile;
+        if (src.size < sizeof(double) ||
+            !sketch.deserialize(Slice(src.data + sizeof(double), src.size - sizeof(double)))) {
+            ctx->set_error("Invalid intermediate state of percentile_approx_ddsketch.", false);
+            return;
+        }
+        memcpy(&quantile, src.data, sizeof(double));
+
+        auto& data = this->data(state);
+        int64_t prev_memory = data.sketch.mem_usage();
+        data.sketch.merge(sketch);
+        data.quantile = quantile;
+        // The state of a NULL row converted by convert_to_serialize_format is an empty sketch.
+        data.is_null = data.is_null && sketch.count() == 0;
+        ctx->add_mem_usage(data.sketch.mem_usage() - prev_memory);
+    }
+
+    void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        const auto& data = this->data(state);
+        if (to->is_nullable()) {
+            auto* nullable_column = down_cast<NullableColumn*>(to);
+            if (data.is_null) {
+                nullable_column->append_default();
+                return;
+            }
+            nullable_column->null_column_data().push_back(0);
+            to = nullable_column->data_column().get();
+        }
+        _serialize(data.quantile, data.sketch, down_cast<BinaryColumn*>(to));
+    }
+
+    void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
+                                     ColumnPtr* dst) const override {
+        DCHECK(src[1]->is_constant());
+        double quantile = src[1]->get(0).get_double();
+        const auto* input = down_cast<const DoubleColumn*>(ColumnHelper::get_data_column(src[0].get()));
+
+        BinaryColumn* result = nullptr;
+        if ((*dst)->is_nullable()) {
+            auto* dst_nullable_column = down_cast<NullableColumn*>((*dst).get());
+            result = down_cast<BinaryColumn*>(dst_nullable_column->data_column().get());
+            if (src[0]->is_nullable()) {
+                const auto* nullable_column = down_cast<const NullableColumn*>(src[0].get());
+                dst_nullable_column->null_column_data() = nullable_column->immutable_null_column_data();
+                dst_nullable_column->set_has_null(nullable_column->has_null());
+            } else {
+                dst_nullable_column->null_column_data().resize(chunk_size, 0);
+            }
+        } else {
+            result = down_cast<BinaryColumn*>((*dst).get());
+        }
+
+        result->reserve(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            DDSketch sketch;
+            if (!src[0]->is_null(i)) {
+                sketch.add(input->get_data()[i]);
+            }
+            _serialize(quantile, sketch, result);
+        }
+    }
+
+    void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
+        const auto& data = this->data(state);
+        if (to->is_nullable()) {
+            auto* nullable_column = down_cast<NullableColumn*>(to);
+            if (data.is_null) {
+                nullable_column->append_default();
+                return;
+            }
+            nullable_column->null_column_data().push_back(0);
+            to = nullable_column->data_column().get();
+        }
+        down_cast<DoubleColumn*>(to)->append(data.sketch.quantile(data.quantile));
+    }
+
+    std::string get_name() const override { return "percentile_approx_ddsketch"; }
+
+private:
+    static bool _check_quantile(FunctionContext* ctx, const Column* column) {
+        if (column->only_null()) {
+            ctx->set_error("For percentile_approx_ddsketch the second argument is expected to be non-null.",
+                           false);
+            return false;
+        }
+        return true;
+    }
+
+    void _add(FunctionContext* ctx, AggDataPtr __restrict state, const double* values, size_t num_values,
+              double quantile) const {
+        auto& data = this->data(state);
+        int64_t prev_memory = data.sketch.mem_usage();
+        data.sketch.add(values, num_values);
+        data.quantile = quantile;
+        data.is_null = false;
+        ctx->add_mem_usage(data.sketch.mem_usage() - prev_memory);
+    }
+
+    static void _serialize(double quantile, const DDSketch& sketch, BinaryColumn* column) {
+        Bytes& bytes = column->get_bytes();
+        size_t old_size = bytes.size();
+        bytes.resize(old_size + sizeof(double) + sketch.serialize_size());
+        memcpy(bytes.data() + old_size, &quantile, sizeof(double));
+        size_t size = sketch.serialize(bytes.data() + old_size + sizeof(double));
+        DCHECK_EQ(old_size + sizeof(double) + size, bytes.size());
+        column->get_offset().emplace_back(bytes.size());
+    }
+};
 } // namespace starrocks
@@ -16,6 +16,7 @@
 
 #include "column/type_traits.h"
 #include "exprs/agg/aggregate.h"
+#include "exprs/agg/helpers/simd_reduce.hpp"
 #include "gutil/casts.h"
 #include "types/logical_type.h"
 
@@ -75,8 +76,23 @@ public:
                                    AggDataPtr __restrict state) const override {
         const auto* column = down_cast<const InputColumnType*>(columns[0]);
         const auto* data = column->get_data().data();
-        for (size_t i = 0; i < chunk_size; ++i) {
-            this->data(state).sum += data[i];
+        if constexpr (lt_is_arithmetic<LT> || lt_is_decimal<LT>) {
+            this->data(state).sum = SIMDReduce::sum<ResultType>(data, nullptr, chunk_size, this->data(state).sum);
+        } else {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                this->data(state).sum += data[i];
+            }
+        }
+    }
+
+    bool update_batch_single_state_not_null(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                            const uint8_t* null_data, AggDataPtr __restrict state) const override {
+        if constexpr (lt_is_arithmetic<LT> || lt_is_decimal<LT>) {
+            const auto* data = down_cast<const InputColumnType*>(columns[0])->get_data().data();
+            this->data(state).sum = SIMDReduce::sum<ResultType>(data, null_data, chunk_size, this->data(state).sum);
+            return true;
+        } else {
+            return false;
         }
     }
 
@@ -16,6 +16,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 
@@ -26,6 +27,7 @@
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/constexpr.h"
 #include "common/statusor.h"
 #include "exprs/anyval_util.h"
@@ -37,6 +39,39 @@
 #include "storage/chunk_helper.h"
 
 namespace starrocks {
+// Return true if every row of `expr` only depends on the same row of its inputs, and the results are neither strings
+// nor nested types, so evaluating it over millions of elements at once costs no more than over the chunks.
+static bool is_elementwise_expr(const Expr* expr) {
+    switch (expr->node_type()) {
+    case TExprNodeType::SLOT_REF:
+    case TExprNodeType::BOOL_LITERAL:
+    case TExprNodeType::DATE_LITERAL:
+    case TExprNodeType::FLOAT_LITERAL:
+    case TExprNodeType::INT_LITERAL:
+    case TExprNodeType::LARGE_INT_LITERAL:
+    case TExprNodeType::DECIMAL_LITERAL:
+    case TExprNodeType::STRING_LITERAL:
+    case TExprNodeType::NULL_LITERAL:
+        return true;
+    case TExprNodeType::ARITHMETIC_EXPR:
+    case TExprNodeType::BINARY_PRED:
+    case TExprNodeType::COMPOUND_PRED:
+    case TExprNodeType::IS_NULL_PRED:
+    case TExprNodeType::IN_PRED:
+    case TExprNodeType::CAST_EXPR:
+    case TExprNodeType::CASE_EXPR:
+    case TExprNodeType::JIT_EXPR:
+        break;
+    default:
+        return false;
+    }
+    const auto& type = expr->type();
+    if (type.is_complex_type() || type.is_string_type() || type.is_huge_type()) {
+        return false;
+    }
+    return std::all_of(expr->children().begin(), expr->children().end(), is_elementwise_expr);
+}
+
 ArrayMapExpr::ArrayMapExpr(const TExprNode& node) : Expr(node, false) {}
 
 ArrayMapExpr::ArrayMapExpr(TypeDescriptor type) : Expr(std::move(type), false) {}
@@ -59,6 +94,10 @@ Status ArrayMapExpr::prepare(RuntimeState* state, ExprContext* context) {
     }
     RETURN_IF_ERROR(lambda_expr->prepare(state, context));
 
+    // The lambda function itself only evaluates its common sub exprs and the lambda expr in its children.
+    _one_pass_lambda_expr = config::enable_array_map_one_pass_eval &&
+                            std::all_of(lambda_expr->children().begin(), lambda_expr->children().end(),
+                                        is_elementwise_expr);
     return Status::OK();
 }
 
@@ -179,6 +218,19 @@ StatusOr<ColumnPtr> ArrayMapExpr::evaluate_lambda_expr(ExprContext* context, Chu
             // if result is a const column, we should unpack it first and make it to be the elements column of array column
             column = ColumnHelper::unpack_and_duplicate_const_column(tmp_col->size(), tmp_col);
             column = ColumnHelper::align_return_type(column, type().children[0], column->size(), true);
+        } else if (_one_pass_lambda_expr || cur_chunk->num_rows() <= DEFAULT_CHUNK_SIZE) {
+            // Save copying all the elements into the accumulated chunks and copying the results back.
+            const size_t num_rows = cur_chunk->num_rows();
+            ASSIGN_OR_RETURN(column, context->evaluate(_children[0], cur_chunk.get()));
+            column->check_or_die();
+            // The result of x -> x is the input elements, which must not be shared with the result array.
+            for (const auto& input : cur_chunk->columns()) {
+                if (column == input) {
+                    column = column->clone();
+                    break;
+                }
+            }
+            column = ColumnHelper::align_return_type(column, type().children[0], num_rows, true);
         } else {
             ChunkAccumulator accumulator(DEFAULT_CHUNK_SIZE);
             RETURN_IF_ERROR(accumulator.push(std::move(cur_chunk)));
@@ -43,6 +43,9 @@ public:
     std::string debug_string() const override;
     int get_slot_ids(std::vector<SlotId>* slot_ids) const override;
 
+    // for tests
+    bool is_one_pass_lambda_expr() const { return _one_pass_lambda_expr; }
+
 private:
     template <bool all_const_input, bool independent_lambda_expr>
     StatusOr<ColumnPtr> evaluate_lambda_expr(ExprContext* context, Chunk* chunk,
@@ -50,5 +53,7 @@ private:
 
     // use map to make sure the order of execution
     std::map<SlotId, Expr*> _outer_common_exprs;
+    // True if the lambda expr is evaluated over all the elements at once, see is_elementwise_expr.
+    bool _one_pass_lambda_expr = false;
 };
 } // namespace starrocks
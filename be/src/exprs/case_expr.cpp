@@ -14,7 +14,10 @@
 
 #include "exprs/case_expr.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <numeric>
+#include <vector>
 
 #include "column/chunk.h"
 #include "column/column_builder.h"
@@ -22,6 +25,7 @@
 #include "column/column_viewer.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "gutil/casts.h"
 #include "runtime/runtime_state.h"
@@ -457,6 +461,13 @@ private:
     //  If all `WHEN` is null/false, return NULL
     //  If `WHEN` is not null and true, return `THEN`
     StatusOr<ColumnPtr> evaluate_no_case(ExprContext* context, Chunk* chunk) {
+        if constexpr (!lt_is_collection<ResultType>) {
+            if (chunk != nullptr && !chunk->is_empty() && config::case_when_selective_eval_max_ratio > 0 &&
+                has_expensive_branch()) {
+                return evaluate_no_case_selective(context, chunk);
+            }
+        }
+
         ColumnPtr else_column = nullptr;
         if (!_has_else_expr) {
             else_column = ColumnHelper::create_const_null_column(chunk != nullptr ? chunk->num_rows() : 1);
@@ -646,6 +657,186 @@ private:
         }
     }
 
+    // Return true if any WHEN except the first one or any THEN/ELSE is worth being evaluated on fewer rows,
+    // the constants and the column refs are free to evaluate on all the rows.
+    bool has_expensive_branch() const {
+        return std::any_of(_children.begin() + 1, _children.end(),
+                           [](const Expr* child) { return !child->is_constant() && !child->is_slotref(); });
+    }
+
+    // Evaluate `expr` only on the `rows` of `chunk`, the i-th row of the result is the `rows[i]`-th row.
+    // Return nullptr if `expr` should be evaluated on the whole chunk, because most of the rows are selected
+    // or it's cheap to evaluate.
+    StatusOr<ColumnPtr> evaluate_on_rows(ExprContext* context, Chunk* chunk, Expr* expr,
+                                          const std::vector<uint32_t>& rows) {
+        if (rows.size() > chunk->num_rows() * config::case_when_selective_eval_max_ratio || expr->is_constant() ||
+            expr->is_slotref()) {
+            return nullptr;
+        }
+        std::vector<SlotId> slot_ids;
+        expr->get_slot_ids(&slot_ids);
+        if (slot_ids.empty() ||
+            std::any_of(slot_ids.begin(), slot_ids.end(), [chunk](SlotId id) { return !chunk->is_slot_exist(id); })) {
+            return nullptr;
+        }
+        std::sort(slot_ids.begin(), slot_ids.end());
+        slot_ids.erase(std::unique(slot_ids.begin(), slot_ids.end()), slot_ids.end());
+
+        Chunk selected_chunk;
+        for (SlotId id : slot_ids) {
+            const auto& column = chunk->get_column_by_slot_id(id);
+            ColumnPtr selected = column->clone_empty();
+            selected->append_selective(*column, rows.data(), 0, rows.size());
+            selected_chunk.append_column(std::move(selected), id);
+        }
+        return expr->evaluate_checked(context, &selected_chunk);
+    }
+
+    // Same as evaluate_no_case, but every WHEN is only evaluated on the rows not matched by the previous WHENs,
+    // and every THEN/ELSE is only evaluated on the rows it's selected by, unless most of the rows are selected.
+    // The result is gathered by the branch index of every row, which is a table lookup if all the THEN/ELSE
+    // are constant.
+    StatusOr<ColumnPtr> evaluate_no_case_selective(ExprContext* context, Chunk* chunk) {
+        const size_t num_rows = chunk->num_rows();
+        const int loop_end = _children.size() - 1;
+
+        // branches[row] is the index of the THEN selected by the row, the rows matching no WHEN select the ELSE,
+        // whose index is the number of the matched THENs.
+        constexpr uint32_t kUnmatched = UINT32_MAX;
+        std::vector<uint32_t> branches(num_rows, kUnmatched);
+        std::vector<uint32_t> unmatched_rows(num_rows);
+        std::iota(unmatched_rows.begin(), unmatched_rows.end(), 0);
+        std::vector<Expr*> then_exprs;
+
+        for (int i = 0; i < loop_end && !unmatched_rows.empty(); i += 2) {
+            ASSIGN_OR_RETURN(ColumnPtr when_column, evaluate_on_rows(context, chunk, _children[i], unmatched_rows));
+            const bool dense = when_column == nullptr;
+            if (dense) {
+                ASSIGN_OR_RETURN(when_column, _children[i]->evaluate_checked(context, chunk));
+            }
+            if (ColumnHelper::count_true_with_notnull(when_column) == 0) {
+                continue;
+            }
+            const auto branch = static_cast<uint32_t>(then_exprs.size());
+            then_exprs.emplace_back(_children[i + 1]);
+
+            ColumnViewer<TYPE_BOOLEAN> when_viewer(when_column);
+            size_t num_unmatched = 0;
+            for (size_t k = 0; k < unmatched_rows.size(); k++) {
+                const uint32_t row = unmatched_rows[k];
+                const size_t idx = dense ? row : k;
+                if (!when_viewer.is_null(idx) && when_viewer.value(idx)) {
+                    branches[row] = branch;
+                } else {
+                    unmatched_rows[num_unmatched++] = row;
+                }
+            }
+            unmatched_rows.resize(num_unmatched);
+        }
+
+        const auto else_branch = static_cast<uint32_t>(then_exprs.size());
+        for (uint32_t row : unmatched_rows) {
+            branches[row] = else_branch;
+        }
+        if (then_exprs.empty() || (then_exprs.size() == 1 && unmatched_rows.empty())) {
+            // All the rows select the same branch.
+            Expr* expr = then_exprs.empty() ? (_has_else_expr ? _children.back() : nullptr) : then_exprs[0];
+            if (expr == nullptr) {
+                return ColumnHelper::create_const_null_column(num_rows);
+            }
+            ASSIGN_OR_RETURN(ColumnPtr column, expr->evaluate_checked(context, chunk));
+            return column->clone();
+        }
+
+        const size_t num_branches = then_exprs.size() + 1;
+        std::vector<std::vector<uint32_t>> branch_rows(num_branches);
+        for (uint32_t row = 0; row < num_rows; row++) {
+            branch_rows[branches[row]].emplace_back(row);
+        }
+
+        Columns then_columns(num_branches);
+        // dense[i] is true if then_columns[i] is evaluated on all the rows.
+        std::vector<uint8_t> dense(num_branches, 1);
+        bool all_const = true;
+        for (size_t i = 0; i < num_branches; i++) {
+            Expr* expr = i < then_exprs.size() ? then_exprs[i] : (_has_else_expr ? _children.back() : nullptr);
+            if (expr == nullptr || branch_rows[i].empty()) {
+                then_columns[i] = ColumnHelper::create_const_null_column(num_rows);
+            } else {
+                ASSIGN_OR_RETURN(then_columns[i], evaluate_on_rows(context, chunk, expr, branch_rows[i]));
+                if (then_columns[i] == nullptr) {
+                    ASSIGN_OR_RETURN(then_columns[i], expr->evaluate_checked(context, chunk));
+                } else {
+                    dense[i] = 0;
+                }
+            }
+            all_const &= then_columns[i]->is_constant();
+        }
+
+        if constexpr (isArithmeticLT<ResultType>) {
+            if (all_const) {
+                return lookup_const_branches(branches, then_columns);
+            }
+        }
+
+        std::vector<ColumnViewer<ResultType>> then_viewers;
+        then_viewers.reserve(num_branches);
+        for (const auto& column : then_columns) {
+            then_viewers.emplace_back(column);
+        }
+        // The next row of every branch evaluated on the selected rows.
+        std::vector<size_t> cursors(num_branches, 0);
+        ColumnBuilder<ResultType> builder(num_rows, this->type().precision, this->type().scale);
+        for (size_t row = 0; row < num_rows; row++) {
+            const uint32_t branch = branches[row];
+            const size_t idx = dense[branch] ? row : cursors[branch]++;
+            if (then_viewers[branch].is_null(idx)) {
+                builder.append_null();
+            } else {
+                builder.append(then_viewers[branch].value(idx));
+            }
+        }
+        return builder.build(false);
+    }
+
+    // Every row takes the value of its branch from the constant THEN/ELSE columns without any branch.
+    ColumnPtr lookup_const_branches(const std::vector<uint32_t>& branches, const Columns& then_columns) {
+        using CppType = RunTimeCppType<ResultType>;
+        const size_t num_branches = then_columns.size();
+        std::vector<CppType> values(num_branches);
+        std::vector<uint8_t> nulls(num_branches, 0);
+        bool has_null = false;
+        for (size_t i = 0; i < num_branches; i++) {
+            ColumnViewer<ResultType> viewer(then_columns[i]);
+            nulls[i] = viewer.is_null(0);
+            has_null |= nulls[i];
+            if (!nulls[i]) {
+                values[i] = viewer.value(0);
+            }
+        }
+
+        const size_t num_rows = branches.size();
+        auto res = RunTimeColumnType<ResultType>::create();
+        if constexpr (lt_is_decimal<ResultType>) {
+            res->set_scale(this->type().scale);
+            res->set_precision(this->type().precision);
+        }
+        auto& data = res->get_data();
+        data.resize(num_rows);
+        for (size_t row = 0; row < num_rows; row++) {
+            data[row] = values[branches[row]];
+        }
+        if (!has_null) {
+            return res;
+        }
+        auto null_column = NullColumn::create(num_rows);
+        auto& null_data = null_column->get_data();
+        for (size_t row = 0; row < num_rows; row++) {
+            null_data[row] = nulls[branches[row]];
+        }
+        return NullableColumn::create(std::move(res), std::move(null_column));
+    }
+
 private:
     const bool _has_case_expr;
     const bool _has_else_expr;
@@ -14,8 +14,11 @@
 
 #include "exprs/compound_predicate.h"
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/column_ref.h"
+#include "exprs/like_predicate.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -128,7 +131,21 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    Status open(RuntimeState* state, ExprContext* context, FunctionContext::FunctionStateScope scope) override {
+        // Open before the children, so the nested ORs know whether they are evaluated by this one.
+        if (scope == FunctionContext::FRAGMENT_LOCAL && !_in_multi_pattern_tree && _matcher == nullptr) {
+            _try_build_multi_pattern_matcher(context);
+        }
+        return Expr::open(state, context, scope);
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (_matcher != nullptr) {
+            ASSIGN_OR_RETURN(auto input, _matcher_input->evaluate_checked(context, ptr));
+            return _matcher->match_any(input);
+        }
+
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -189,6 +206,64 @@ public:
             << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    // Collect the patterns of the leaves of the OR tree rooted at `expr`, return false if any leaf is not a LIKE or
+    // REGEXP with a constant pattern on the same column.
+    static bool _collect_patterns(Expr* expr, ExprContext* context, LikePredicate::MultiPatternMatcher* matcher,
+                                  ColumnRef** input, std::vector<VectorizedOrCompoundPredicate*>* nested) {
+        if (auto* pred = dynamic_cast<VectorizedOrCompoundPredicate*>(expr); pred != nullptr) {
+            nested->emplace_back(pred);
+            return _collect_patterns(expr->get_child(0), context, matcher, input, nested) &&
+                   _collect_patterns(expr->get_child(1), context, matcher, input, nested);
+        }
+        const int64_t fid = expr->fn().fid;
+        if (expr->node_type() != TExprNodeType::FUNCTION_CALL || expr->get_num_children() != 2 ||
+            (fid != LikePredicate::LIKE_FID && fid != LikePredicate::REGEXP_FID)) {
+            return false;
+        }
+        auto* ref = dynamic_cast<ColumnRef*>(expr->get_child(0));
+        Expr* pattern_expr = expr->get_child(1);
+        if (ref == nullptr || !pattern_expr->is_constant() ||
+            (*input != nullptr && (*input)->slot_id() != ref->slot_id())) {
+            return false;
+        }
+        auto pattern = pattern_expr->evaluate_checked(context, nullptr);
+        if (!pattern.ok() || pattern.value()->only_null()) {
+            return false;
+        }
+        *input = ref;
+        matcher->add_pattern(ColumnHelper::get_const_value<TYPE_VARCHAR>(pattern.value()),
+                             fid == LikePredicate::LIKE_FID);
+        return true;
+    }
+
+    void _try_build_multi_pattern_matcher(ExprContext* context) {
+        const int32_t min_patterns = config::like_multi_pattern_min_patterns;
+        if (min_patterns <= 0) {
+            return;
+        }
+        auto matcher = std::make_shared<LikePredicate::MultiPatternMatcher>();
+        ColumnRef* input = nullptr;
+        std::vector<VectorizedOrCompoundPredicate*> nested;
+        if (!_collect_patterns(this, context, matcher.get(), &input, &nested) ||
+            matcher->num_patterns() < static_cast<size_t>(min_patterns)) {
+            return;
+        }
+        // The nested ORs are in the same tree, they need no try even if the patterns fail to compile.
+        for (auto* pred : nested) {
+            pred->_in_multi_pattern_tree = pred != this;
+        }
+        if (matcher->compile()) {
+            _matcher = std::move(matcher);
+            _matcher_input = input;
+        }
+    }
+
+    bool _in_multi_pattern_tree = false;
+    // Not null if all the leaves are LIKE or REGEXP on the same column, which are evaluated together by it.
+    std::shared_ptr<LikePredicate::MultiPatternMatcher> _matcher;
+    ColumnRef* _matcher_input = nullptr;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
@@ -14,16 +14,88 @@
 
 #pragma once
 
+#include <type_traits>
+#include <vector>
+
 #include "column/column_builder.h"
 #include "exprs/arithmetic_operation.h"
 #include "exprs/binary_function.h"
 #include "exprs/overflow.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/integer_overflow_arithmetics.h"
 #include "types/logical_type.h"
 
 namespace starrocks {
+
+// The Op of an ArithmeticBinaryOperator.
+template <typename T>
+struct BinaryOperatorOp;
+template <typename Op, LogicalType Type, typename Guard1, typename Guard2>
+struct BinaryOperatorOp<ArithmeticBinaryOperator<Op, Type, Guard1, Guard2>> {
+    using type = Op;
+};
+
 template <OverflowMode overflow_mode, typename Op>
 struct DecimalBinaryFunction {
+    // Evaluate the decimal128 add/sub/mul of a chunk with overflow check without a branch per row.
+    // add/sub compute the overflow of every row from the signs, mul checks the max absolute values of the operands
+    // of the whole chunk in advance, and scaling up the lhs is a mul by the scale factor.
+    // Return false if mul or scaling up may overflow, then the rows should be evaluated one by one.
+    template <bool lhs_is_const, bool rhs_is_const, bool adjust_left, typename BinaryOperator>
+    static inline bool batch_evaluate_decimal128(size_t num_rows, const int128_t* lhs_data, const int128_t* rhs_data,
+                                                 int128_t* result_data, NullColumn::ValueType* nulls, bool* has_null,
+                                                 int128_t scale_factor) {
+        using BatchOp = typename BinaryOperatorOp<BinaryOperator>::type;
+        constexpr bool is_add_sub = is_add_op<BatchOp> || is_sub_op<BatchOp> || is_reverse_sub_op<BatchOp>;
+        if constexpr (!is_add_sub && !is_mul_op<BatchOp>) {
+            return false;
+        }
+        const size_t lhs_size = lhs_is_const ? 1 : num_rows;
+        const size_t rhs_size = rhs_is_const ? 1 : num_rows;
+
+        // The const lhs has been scaled up by the caller.
+        std::vector<int128_t> adjusted_lhs;
+        if constexpr (adjust_left && !lhs_is_const) {
+            if (!int128_mul_never_overflow(int128_max_abs(lhs_data, lhs_size), scale_factor)) {
+                return false;
+            }
+            adjusted_lhs.resize(lhs_size);
+            for (size_t i = 0; i < lhs_size; i++) {
+                adjusted_lhs[i] = lhs_data[i] * scale_factor;
+            }
+            lhs_data = adjusted_lhs.data();
+        }
+
+        bool overflow = false;
+        if constexpr (is_add_op<BatchOp>) {
+            overflow = int128_add_sub_overflow_batch<false, lhs_is_const, rhs_is_const>(lhs_data, rhs_data,
+                                                                                        result_data, nulls, num_rows);
+        } else if constexpr (is_sub_op<BatchOp>) {
+            overflow = int128_add_sub_overflow_batch<true, lhs_is_const, rhs_is_const>(lhs_data, rhs_data,
+                                                                                       result_data, nulls, num_rows);
+        } else if constexpr (is_reverse_sub_op<BatchOp>) {
+            overflow = int128_add_sub_overflow_batch<true, rhs_is_const, lhs_is_const>(rhs_data, lhs_data,
+                                                                                       result_data, nulls, num_rows);
+        } else {
+            if (!int128_mul_never_overflow(int128_max_abs(lhs_data, lhs_size), int128_max_abs(rhs_data, rhs_size))) {
+                return false;
+            }
+            for (size_t i = 0; i < num_rows; i++) {
+                result_data[i] = lhs_data[lhs_is_const ? 0 : i] * rhs_data[rhs_is_const ? 0 : i];
+            }
+        }
+        if (overflow) {
+            if constexpr (error_if_overflow<overflow_mode>) {
+                throw std::overflow_error(strings::Substitute("The '$0' operation involving decimal values overflows",
+                                                              get_op_name<Op>()));
+            } else {
+                static_assert(null_if_overflow<overflow_mode>);
+                *has_null = true;
+            }
+        }
+        return true;
+    }
+
     // Adjust the scale of lhs operand, then evaluate binary operation, the rules about operand
     // scaling is defined in function: compute_result_type.  each operations are depicted as
     // following:
@@ -79,6 +151,16 @@ struct DecimalBinaryFunction {
             rhs_datum = rhs_data[0];
         }
 
+        if constexpr (check_overflow<overflow_mode> && !(lhs_is_const && rhs_is_const) &&
+                      std::is_same_v<LhsCppType, int128_t> && std::is_same_v<RhsCppType, int128_t> &&
+                      std::is_same_v<ResultCppType, int128_t>) {
+            if (batch_evaluate_decimal128<lhs_is_const, rhs_is_const, adjust_left, BinaryOperator>(
+                        num_rows, lhs_is_const ? &lhs_datum : lhs_data, rhs_data, result_data, nulls, has_null,
+                        scale_factor)) {
+                return false;
+            }
+        }
+
         for (auto i = 0; i < num_rows; ++i) {
             if constexpr (lhs_is_const && rhs_is_const) {
                 overflow = BinaryOperator::template apply<check_overflow<overflow_mode>, false, LhsCppType, RhsCppType,
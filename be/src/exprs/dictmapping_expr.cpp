@@ -14,9 +14,16 @@
 
 #include "exprs/dictmapping_expr.h"
 
+#include <algorithm>
+
+#include "column/binary_column.h"
 #include "column/chunk.h"
+#include "column/column_hash.h"
 #include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
 #include "runtime/runtime_state.h"
+#include "util/phmap/phmap.h"
 
 namespace starrocks {
 DictMappingExpr::DictMappingExpr(const TExprNode& node) : Expr(node, false) {}
@@ -43,6 +50,10 @@ StatusOr<ColumnPtr> DictMappingExpr::evaluate_checked(ExprContext* context, Chun
 
         if (data_column->is_binary()) {
             DCHECK(dict_func_expr == nullptr);
+            ASSIGN_OR_RETURN(auto result, _evaluate_on_distinct_values(context, target_column));
+            if (result != nullptr) {
+                return result;
+            }
             return get_child(1)->evaluate_checked(context, ptr);
         } else if (dict_func_expr != nullptr) {
             return dict_func_expr->evaluate_checked(context, ptr);
@@ -64,4 +75,68 @@ StatusOr<ColumnPtr> DictMappingExpr::evaluate_checked(ExprContext* context, Chun
     return Status::InternalError(fmt::format("unreachable path, dict children size: {}", _children.size()));
 }
 
+StatusOr<ColumnPtr> DictMappingExpr::_evaluate_on_distinct_values(ExprContext* context, const ColumnPtr& input) {
+    const double max_ratio = config::dict_mapping_distinct_eval_max_ratio;
+    const size_t num_rows = input->size();
+    if (max_ratio <= 0 || input->is_constant() || num_rows == 0) {
+        return nullptr;
+    }
+    // The origin expression should only read the low cardinality column.
+    std::vector<SlotId> slot_ids;
+    get_child(1)->get_slot_ids(&slot_ids);
+    if (std::any_of(slot_ids.begin(), slot_ids.end(), [this](SlotId id) { return id != slot_id(); })) {
+        return nullptr;
+    }
+
+    const size_t max_distinct = num_rows * max_ratio;
+    const auto* binary = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(input.get()));
+    const uint8_t* nulls = nullptr;
+    if (input->is_nullable()) {
+        nulls = down_cast<const NullableColumn*>(input.get())->immutable_null_column_data().data();
+    }
+    phmap::flat_hash_map<Slice, uint32_t, SliceHash, SliceNormalEqual> distinct_indexes;
+    std::vector<Slice> distinct_values;
+    std::vector<uint32_t> indexes(num_rows);
+    // The index of the null, which is put after all the distinct values.
+    constexpr uint32_t kNullIndex = UINT32_MAX;
+    bool has_null = false;
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (nulls != nullptr && nulls[i]) {
+            indexes[i] = kNullIndex;
+            has_null = true;
+            continue;
+        }
+        Slice value = binary->get_slice(i);
+        auto [iter, inserted] = distinct_indexes.try_emplace(value, distinct_values.size());
+        if (inserted) {
+            if (distinct_values.size() >= max_distinct) {
+                return nullptr;
+            }
+            distinct_values.emplace_back(value);
+        }
+        indexes[i] = iter->second;
+    }
+
+    auto values = BinaryColumn::create();
+    values->append_strings(distinct_values.data(), distinct_values.size());
+    ColumnPtr distinct_column = std::move(values);
+    if (has_null) {
+        distinct_column = NullableColumn::create(distinct_column, NullColumn::create(distinct_values.size(), 0));
+        distinct_column->append_nulls(1);
+        std::replace(indexes.begin(), indexes.end(), kNullIndex, static_cast<uint32_t>(distinct_values.size()));
+    }
+
+    Chunk distinct_chunk;
+    distinct_chunk.append_column(distinct_column, slot_id());
+    ASSIGN_OR_RETURN(auto distinct_result, get_child(1)->evaluate_checked(context, &distinct_chunk));
+    if (distinct_result->is_constant()) {
+        ColumnPtr result = distinct_result->clone();
+        result->resize(num_rows);
+        return result;
+    }
+    ColumnPtr result = distinct_result->clone_empty();
+    result->append_selective(*distinct_result, indexes.data(), 0, num_rows);
+    return result;
+}
+
 } // namespace starrocks
@@ -72,6 +72,10 @@ public:
     void disable_open_rewrite() { _open_rewrite = false; }
 
 private:
+    // Evaluate the origin expression on the distinct values of the decoded string column `input` and gather the
+    // results, return nullptr if there are too many distinct values.
+    StatusOr<ColumnPtr> _evaluate_on_distinct_values(ExprContext* context, const ColumnPtr& input);
+
     std::shared_ptr<std::once_flag> _rewrite_once_flag = std::make_shared<std::once_flag>();
     Status _rewrite_status;
     // used for dictionary expression calculation.
@@ -14,11 +14,15 @@
 
 #include "exprs/geo_functions.h"
 
+#include <algorithm>
+
 #include "column/column_builder.h"
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
+#include "column/nullable_column.h"
 #include "common/logging.h"
 #include "geo/geo_types.h"
+#include "gutil/casts.h"
 
 namespace starrocks {
 
@@ -243,7 +247,39 @@ StatusOr<ColumnPtr> GeoFunctions::st_y(FunctionContext* context, const Columns&
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
+// The distances of the non-null, non-constant coordinates, computed over the raw data without the per-row viewer
+// and builder dispatches, the invalid coordinates are set to null.
+static ColumnPtr st_distance_sphere_columns(const Columns& columns) {
+    const double* x_lng = down_cast<const DoubleColumn*>(columns[0].get())->get_data().data();
+    const double* x_lat = down_cast<const DoubleColumn*>(columns[1].get())->get_data().data();
+    const double* y_lng = down_cast<const DoubleColumn*>(columns[2].get())->get_data().data();
+    const double* y_lat = down_cast<const DoubleColumn*>(columns[3].get())->get_data().data();
+
+    auto size = columns[0]->size();
+    auto result = DoubleColumn::create(size);
+    auto nulls = NullColumn::create(size, 0);
+    double* dists = result->get_data().data();
+    uint8_t* null_data = nulls->get_data().data();
+    bool has_null = false;
+    for (size_t row = 0; row < size; ++row) {
+        if (!GeoPoint::st_distance_sphere(x_lng[row], x_lat[row], y_lng[row], y_lat[row], &dists[row])) {
+            dists[row] = 0;
+            null_data[row] = 1;
+            has_null = true;
+        }
+    }
+    if (!has_null) {
+        return result;
+    }
+    return NullableColumn::create(std::move(result), std::move(nulls));
+}
+
 StatusOr<ColumnPtr> GeoFunctions::st_distance_sphere(FunctionContext* context, const Columns& columns) {
+    if (std::none_of(columns.begin(), columns.end(),
+                     [](const ColumnPtr& column) { return column->is_nullable() || column->is_constant(); })) {
+        return st_distance_sphere_columns(columns);
+    }
+
     ColumnViewer<TYPE_DOUBLE> x_lng(columns[0]);
     ColumnViewer<TYPE_DOUBLE> x_lat(columns[1]);
     ColumnViewer<TYPE_DOUBLE> y_lng(columns[2]);
@@ -359,6 +395,10 @@ StatusOr<ColumnPtr> GeoFunctions::st_contains(FunctionContext* context, const Co
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_BOOLEAN> result(size);
+    // The last decoded shapes of the non-constant arguments, owned by local_state, and their encoded values.
+    StContainsState local_state;
+    Slice last_encoded[2];
+    bool last_decoded[2] = {false, false};
     for (int row = 0; row < size; ++row) {
         if (lhs_viewer.is_null(row) || rhs_viewer.is_null(row)) {
             result.append_null();
@@ -369,18 +409,24 @@ StatusOr<ColumnPtr> GeoFunctions::st_contains(FunctionContext* context, const Co
         auto lhs_value = lhs_viewer.value(row);
         auto rhs_value = rhs_viewer.value(row);
         const Slice* strs[2] = {&lhs_value, &rhs_value};
-        // use this to delete new
-        StContainsState local_state;
         int i;
         for (i = 0; i < 2; ++i) {
             if (state != nullptr && state->shapes[i] != nullptr) {
                 shapes[i] = state->shapes[i];
-            } else {
-                shapes[i] = local_state.shapes[i] = GeoShape::from_encoded(strs[i]->data, strs[i]->size);
-                if (shapes[i] == nullptr) {
-                    result.append_null();
-                    break;
-                }
+                continue;
+            }
+            // The same shape is usually repeated in consecutive rows, e.g. a polygon of the build side of a nested
+            // loop join, so the last decoded shape is reused instead of decoding it and building its index again.
+            if (!last_decoded[i] || last_encoded[i] != *strs[i]) {
+                delete local_state.shapes[i];
+                local_state.shapes[i] = GeoShape::from_encoded(strs[i]->data, strs[i]->size);
+                last_encoded[i] = *strs[i];
+                last_decoded[i] = true;
+            }
+            shapes[i] = local_state.shapes[i];
+            if (shapes[i] == nullptr) {
+                result.append_null();
+                break;
             }
         }
 
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -28,6 +30,14 @@
 #include "runtime/types.h"
 #include "simd/simd.h"
 
+#ifdef STARROCKS_JIT_ENABLE
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Value.h>
+
+#include "exprs/jit/ir_helper.h"
+#include "runtime/runtime_state.h"
+#endif
+
 namespace starrocks {
 
 class RuntimeState;
@@ -100,6 +110,9 @@ public:
             const auto& hash_set = that->hash_set();
             _hash_set.insert(hash_set.begin(), hash_set.end());
             _null_in_set = _null_in_set || that->null_in_set();
+            if (_use_dense_array) {
+                _try_use_dense_array();
+            }
             return Status::OK();
         } else {
             return Status::NotSupported(strings::Substitute("$0 cannot be merged with VectorizedInConstPredicate",
@@ -174,6 +187,7 @@ public:
                     _hash_set.emplace(viewer.value(0));
                 }
             }
+            _try_use_dense_array();
         }
         return Status::OK();
     }
@@ -292,7 +306,7 @@ public:
         if (!_eq_null && ColumnHelper::count_nulls(lhs) == lhs->size()) {
             return ColumnHelper::create_const_null_column(lhs->size());
         }
-        bool use_array = is_use_array();
+        bool use_array = is_use_array() || _use_dense_array;
 
         if (_null_in_set) {
             if (_eq_null) {
@@ -327,6 +341,57 @@ public:
         return evaluate_with_filter(context, ptr, nullptr);
     }
 
+#ifdef STARROCKS_JIT_ENABLE
+    // Max number of the values of an IN list compiled into a chain of comparisons.
+    static constexpr size_t kMaxJitInListSize = 32;
+
+    // Only the short IN lists of literals are compiled. The predicates built by the runtime filters have no values
+    // in the children, so they are always evaluated with the hash set.
+    bool is_compilable(RuntimeState* state) const override {
+        if (!state->can_jit_expr(CompilableExprType::CMP) || !IRHelper::support_jit(Type) || _eq_null ||
+            _is_join_runtime_filter || _children.size() < 2 || _children.size() > kMaxJitInListSize + 1) {
+            return false;
+        }
+        return std::all_of(_children.begin() + 1, _children.end(), [state](const Expr* child) {
+            return child->is_constant() && child->type().type == Type && child->is_compilable(state);
+        });
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(LLVMDatum lhs, _children[0]->generate_ir(context, jit_ctx));
+        auto& b = jit_ctx->builder;
+        llvm::Value* found = b.getInt8(0);
+        llvm::Value* null_in_set = b.getInt8(0);
+        for (size_t i = 1; i < _children.size(); i++) {
+            ASSIGN_OR_RETURN(LLVMDatum value, _children[i]->generate_ir(context, jit_ctx));
+            llvm::Value* eq = nullptr;
+            if constexpr (lt_is_float<Type>) {
+                eq = b.CreateFCmpOEQ(lhs.value, value.value);
+            } else {
+                eq = b.CreateICmpEQ(lhs.value, value.value);
+            }
+            eq = b.CreateIntCast(eq, b.getInt8Ty(), false);
+            found = b.CreateOr(found, b.CreateAnd(eq, b.CreateXor(value.null_flag, b.getInt8(1))));
+            null_in_set = b.CreateOr(null_in_set, value.null_flag);
+        }
+        // Same as eval_on_chunk, the result is null if the input is null, or if the input is not found while
+        // there is a null in the set.
+        LLVMDatum result(b);
+        llvm::Value* not_found = b.CreateXor(found, b.getInt8(1));
+        result.value = _is_not_in ? not_found : found;
+        result.null_flag = b.CreateOr(lhs.null_flag, b.CreateAnd(not_found, null_in_set));
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        std::string name = "{" + _children[0]->jit_func_name(state) + (_is_not_in ? " not in (" : " in (");
+        for (size_t i = 1; i < _children.size(); i++) {
+            name += (i > 1 ? "," : "") + _children[i]->jit_func_name(state);
+        }
+        return name + ")}" + (is_constant() ? "c:" : "") + (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+#endif
+
     ColumnPtr get_all_values() const {
         ColumnPtr values = ColumnHelper::create_column(TypeDescriptor{Type}, true);
         if constexpr (isSliceLT<Type>) {
@@ -393,14 +458,59 @@ public:
 
     bool is_use_array() const { return _array_size != 0; }
 
+    // True if the values are looked up in an array indexed by value minus the min value, see _try_use_dense_array.
+    bool is_use_dense_array() const { return _use_dense_array; }
+
+    // The values of an IN list with at most kMaxDenseArraySize values between its min and max value, or with
+    // at least one value every kMaxDenseArrayStride values, are looked up in an array instead of the hash set.
+    static constexpr uint64_t kMaxDenseArraySize = 1 << 20;
+    static constexpr uint64_t kMinDenseArraySize = 4096;
+    static constexpr uint64_t kMaxDenseArrayStride = 8;
+
 private:
     // Note(yan): It's very tempting to use real bitmap, but the real scenario is, the array size is usually small like dict codes.
     // To usse real bitmap involves bit shift, and/or ops, which eats much cpu cycles.
     // Since the bitmap size is quite small, we can use trade memory usage for performance
     // According to experiments, there is 20% performance gain.
 
-    void _set_array_index(int64_t index) { _array_buffer[index] = 1; }
-    uint8_t _get_array_index(int64_t index) const { return _array_buffer[index]; }
+    void _set_array_index(int64_t index) { _array_buffer[index - _array_min] = 1; }
+    uint8_t _get_array_index(int64_t index) const {
+        // The unsigned offset of the values less than _array_min is out of the array as well.
+        const uint64_t offset = static_cast<uint64_t>(index) - static_cast<uint64_t>(_array_min);
+        return offset < _array_buffer.size() ? _array_buffer[offset] : 0;
+    }
+
+    // Replace the hash set lookup of the integer IN lists with the dense array lookup if the range of the values is
+    // small, e.g. the ids generated in a batch. The hash set is kept for get_all_values and merge.
+    void _try_use_dense_array() {
+        if constexpr (can_use_array()) {
+            if (is_use_array()) {
+                return;
+            }
+            _use_dense_array = false;
+            _array_min = 0;
+            _array_buffer.clear();
+            if (_hash_set.empty()) {
+                return;
+            }
+            auto [min_it, max_it] = std::minmax_element(_hash_set.begin(), _hash_set.end());
+            const int64_t min_value = *min_it;
+            const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(*max_it)) -
+                                   static_cast<uint64_t>(min_value) + 1;
+            const uint64_t max_range = std::min(
+                    kMaxDenseArraySize, std::max(kMinDenseArraySize, _hash_set.size() * kMaxDenseArrayStride));
+            // range is 0 if all the bigint values are in the array.
+            if (range == 0 || range > max_range) {
+                return;
+            }
+            _array_min = min_value;
+            _array_buffer.assign(range, 0);
+            for (const auto& v : _hash_set) {
+                _set_array_index(v);
+            }
+            _use_dense_array = true;
+        }
+    }
 
     void _init_array_buffer() {
         if constexpr (can_use_array()) {
@@ -416,6 +526,9 @@ private:
     bool _is_join_runtime_filter = false;
     bool _eq_null = false;
     int _array_size = 0;
+    bool _use_dense_array = false;
+    // The value of _array_buffer[0], always 0 unless _use_dense_array.
+    int64_t _array_min = 0;
     std::vector<uint8_t> _array_buffer;
 
     in_const_pred_detail::LHashSetType<Type> _hash_set;
@@ -20,6 +20,13 @@
 #include "exprs/unary_function.h"
 #include "types/logical_type.h"
 
+#ifdef STARROCKS_JIT_ENABLE
+#include <llvm/IR/Value.h>
+
+#include "exprs/jit/ir_helper.h"
+#include "runtime/runtime_state.h"
+#endif
+
 namespace starrocks {
 
 #define DEFINE_CLASS_CONSTRUCT_FN(NAME)              \
@@ -62,6 +69,40 @@ public:
         auto col = ColumnHelper::as_raw_column<NullableColumn>(column)->null_column();
         return VectorizedStrictUnaryFunction<isNullImpl>::evaluate<TYPE_NULL, TYPE_BOOLEAN>(col);
     }
+
+#ifdef STARROCKS_JIT_ENABLE
+    // JSON NULL is not null in the null flags, but JSON is not supported by JIT either.
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CMP) && IRHelper::support_jit(_children[0]->type().type);
+    }
+
+    JitScore compute_jit_score(RuntimeState* state) const override {
+        JitScore jit_score = {0, 0};
+        if (!is_compilable(state)) {
+            return jit_score;
+        }
+        for (auto child : _children) {
+            auto tmp = child->compute_jit_score(state);
+            jit_score.score += tmp.score;
+            jit_score.num += tmp.num;
+        }
+        jit_score.num++;
+        jit_score.score += 0; // no benefit
+        return jit_score;
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(LLVMDatum datum, _children[0]->generate_ir(context, jit_ctx));
+        LLVMDatum result(jit_ctx->builder);
+        result.value = datum.null_flag;
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{" + _children[0]->jit_func_name(state) + " is null}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+#endif
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(isNotNullImpl, v) {
@@ -97,6 +138,41 @@ public:
         auto col = ColumnHelper::as_raw_column<NullableColumn>(column)->null_column();
         return VectorizedStrictUnaryFunction<isNotNullImpl>::evaluate<TYPE_NULL, TYPE_BOOLEAN>(col);
     }
+
+#ifdef STARROCKS_JIT_ENABLE
+    // JSON NULL is not null in the null flags, but JSON is not supported by JIT either.
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CMP) && IRHelper::support_jit(_children[0]->type().type);
+    }
+
+    JitScore compute_jit_score(RuntimeState* state) const override {
+        JitScore jit_score = {0, 0};
+        if (!is_compilable(state)) {
+            return jit_score;
+        }
+        for (auto child : _children) {
+            auto tmp = child->compute_jit_score(state);
+            jit_score.score += tmp.score;
+            jit_score.num += tmp.num;
+        }
+        jit_score.num++;
+        jit_score.score += 0; // no benefit
+        return jit_score;
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(LLVMDatum datum, _children[0]->generate_ir(context, jit_ctx));
+        auto& b = jit_ctx->builder;
+        LLVMDatum result(b);
+        result.value = b.CreateXor(datum.null_flag, b.getInt8(1));
+        return result;
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{" + _children[0]->jit_func_name(state) + " is not null}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+#endif
 };
 
 Expr* VectorizedIsNullPredicateFactory::from_thrift(const TExprNode& node) {
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <boost/tokenizer.hpp>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -378,17 +379,13 @@ StatusOr<ColumnPtr> _string_json(FunctionContext* context, const Columns& column
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
-template <LogicalType ResultType>
-StatusOr<ColumnPtr> JsonFunctions::_get_json_value(FunctionContext* context, const Columns& columns) {
-    ASSIGN_OR_RETURN(auto jsons, _string_json(context, columns));
-    const auto& paths = columns[1];
-    return _full_json_query_impl<ResultType>(context, Columns{jsons, paths});
-}
-
 //////////////////////////// User visiable functions /////////////////////////////////
 struct NativeJsonState {
 public:
     JsonPath json_path;
+    // Keys of the prepared path if it only accesses object fields, e.g. ["a", "b"] of "$.a.b",
+    // used by get_json_* to extract the value from the json string without parsing it into JsonValue.
+    std::vector<std::string> object_keys;
 
     // flat json used
     std::once_flag init_flat_once;
@@ -419,6 +416,21 @@ static StatusOr<JsonPath*> get_prepared_or_parse(FunctionContext* context, Slice
     return out;
 }
 
+static void init_object_keys(const JsonPath& json_path, std::vector<std::string>* object_keys) {
+    const auto& pieces = json_path.paths;
+    if (pieces.size() < 2 || pieces[0].array_selector->type != NONE) {
+        return;
+    }
+    for (size_t i = 1; i < pieces.size(); i++) {
+        const auto& key = pieces[i].key;
+        if (key.empty() || key == "$" || key == "*" || pieces[i].array_selector->type != NONE) {
+            object_keys->clear();
+            return;
+        }
+        object_keys->emplace_back(key);
+    }
+}
+
 Status JsonFunctions::native_json_path_prepare(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
     if (scope != FunctionContext::FRAGMENT_LOCAL) {
         return Status::OK();
@@ -433,6 +445,7 @@ Status JsonFunctions::native_json_path_prepare(FunctionContext* context, Functio
         auto* state = new NativeJsonState();
         state->json_path.reset(std::move(json_path.value()));
         state->init_flat = false;
+        init_object_keys(state->json_path, &state->object_keys);
         context->set_function_state(scope, state);
         VLOG(10) << "prepare json path: " << path_value;
     } else {
@@ -451,6 +464,129 @@ Status JsonFunctions::native_json_path_close(FunctionContext* context, FunctionC
     return Status::OK();
 }
 
+// Extract the field of `object_keys` from the json string with simdjson On-Demand, which only scans the string
+// until the field is found, and append the scalar value to `result` directly.
+// Return false if the row must be parsed into JsonValue to get the same result as extracting from the JsonValue,
+// e.g. the value is an object or a number string, or the string isn't a json object.
+template <LogicalType ResultType>
+static bool simd_extract_json_value(simdjson::ondemand::parser* parser, const std::vector<std::string>& object_keys,
+                                    const Slice& json, std::string* buffer, ColumnBuilder<ResultType>* result) {
+    // simdjson requires SIMDJSON_PADDING readable bytes after the string.
+    if (buffer->size() < json.size + simdjson::SIMDJSON_PADDING) {
+        buffer->resize(json.size + simdjson::SIMDJSON_PADDING);
+    }
+    memcpy(buffer->data(), json.data, json.size);
+
+    simdjson::ondemand::document doc;
+    if (parser->iterate(buffer->data(), json.size, buffer->size()).get(doc)) {
+        return false;
+    }
+    simdjson::ondemand::value value;
+    auto err = doc.find_field_unordered(object_keys[0]).get(value);
+    for (size_t i = 1; i < object_keys.size() && !err; i++) {
+        err = value.find_field_unordered(object_keys[i]).get(value);
+    }
+    if (err == simdjson::NO_SUCH_FIELD) {
+        // simdjson compares the raw keys, an escaped key may equal to the required one.
+        if (memchr(json.data, '\\', json.size) != nullptr) {
+            return false;
+        }
+        result->append_null();
+        return true;
+    }
+    if (err) {
+        return false;
+    }
+
+    simdjson::ondemand::json_type type;
+    if (value.type().get(type)) {
+        return false;
+    }
+    if (type == simdjson::ondemand::json_type::null) {
+        bool is_null = false;
+        if (value.is_null().get(is_null) || !is_null) {
+            return false;
+        }
+        result->append_null();
+        return true;
+    }
+    if constexpr (lt_is_string<ResultType>) {
+        std::string_view str;
+        if (type != simdjson::ondemand::json_type::string || value.get_string().get(str)) {
+            return false;
+        }
+        result->append(Slice(str.data(), str.size()));
+        return true;
+    } else {
+        if (type == simdjson::ondemand::json_type::boolean) {
+            bool b = false;
+            if (value.get_bool().get(b)) {
+                return false;
+            }
+            result->append(b);
+            return true;
+        }
+        if (type != simdjson::ondemand::json_type::number) {
+            return false;
+        }
+        if constexpr (lt_is_integer<ResultType>) {
+            int64_t v = 0;
+            if (value.get_int64().get(v) || v < static_cast<int64_t>(RunTimeTypeLimits<ResultType>::min_value()) ||
+                v > static_cast<int64_t>(RunTimeTypeLimits<ResultType>::max_value())) {
+                return false;
+            }
+            result->append(static_cast<RunTimeCppType<ResultType>>(v));
+        } else {
+            double v = 0;
+            if (value.get_double().get(v)) {
+                return false;
+            }
+            result->append(static_cast<RunTimeCppType<ResultType>>(v));
+        }
+        return true;
+    }
+}
+
+template <LogicalType ResultType>
+StatusOr<ColumnPtr> JsonFunctions::_get_json_value(FunctionContext* context, const Columns& columns) {
+    auto* state = get_native_json_state(context);
+    if (!config::enable_json_simd_extract || state == nullptr || state->object_keys.empty()) {
+        ASSIGN_OR_RETURN(auto jsons, _string_json(context, columns));
+        const auto& paths = columns[1];
+        return _full_json_query_impl<ResultType>(context, Columns{jsons, paths});
+    }
+
+    // The path is constant, so extract from the json strings with the prepared keys, and only parse the rows
+    // that can't be handled by simdjson.
+    auto num_rows = columns[0]->size();
+    ColumnViewer<TYPE_VARCHAR> viewer(columns[0]);
+    ColumnBuilder<ResultType> result(num_rows);
+    simdjson::ondemand::parser parser;
+    std::string buffer;
+    vpack::Builder builder;
+    for (size_t row = 0; row < num_rows; row++) {
+        if (viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+        auto json = viewer.value(row);
+        if (simd_extract_json_value<ResultType>(&parser, state->object_keys, json, &buffer, &result)) {
+            continue;
+        }
+        JsonValue json_value;
+        if (!JsonValue::parse(json, &json_value).ok()) {
+            result.append_null();
+            continue;
+        }
+        builder.clear();
+        vpack::Slice slice = JsonPath::extract(&json_value, state->json_path, &builder);
+        if (!cast_vpjson_to<ResultType, false>(slice, result).ok()) {
+            result.append_null();
+        }
+    }
+    return result.build(ColumnHelper::is_all_const(columns));
+}
+
 StatusOr<ColumnPtr> JsonFunctions::json_query(FunctionContext* context, const Columns& columns) {
     return _json_query_impl<TYPE_JSON>(context, columns);
 }
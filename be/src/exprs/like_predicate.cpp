@@ -625,10 +625,13 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
-    std::string re_pattern;
-    re_pattern.clear();
-
     auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(state->escape_char, pattern);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(char escape_char, const Slice& pattern) {
+    std::string re_pattern;
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -641,7 +644,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -682,4 +685,91 @@ void LikePredicate::remove_escape_character(std::string* search_string) {
     }
 }
 
+LikePredicate::MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+void LikePredicate::MultiPatternMatcher::add_pattern(const Slice& pattern, bool is_like) {
+    if (is_like) {
+        // \z instead of the $ of convert_like_pattern<true>, which also matches before a trailing newline.
+        _patterns.emplace_back("^" + convert_like_pattern<false>('\\', pattern) + "\\z");
+    } else {
+        _patterns.emplace_back(pattern.to_string());
+    }
+}
+
+bool LikePredicate::MultiPatternMatcher::compile() {
+    DCHECK(_database == nullptr);
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> flags;
+    std::vector<unsigned int> ids;
+    for (size_t i = 0; i < _patterns.size(); i++) {
+        expressions.emplace_back(_patterns[i].c_str());
+        flags.emplace_back(HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH);
+        ids.emplace_back(i);
+    }
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), flags.data(), ids.data(), expressions.size(), HS_MODE_BLOCK, nullptr,
+                         &_database, &compile_err) != HS_SUCCESS) {
+        LOG(WARNING) << "Invalid hyperscan expressions: " << compile_err->message
+                     << ", evaluate the patterns one by one.";
+        hs_free_compile_error(compile_err);
+        _database = nullptr;
+        return false;
+    }
+    if (hs_alloc_scratch(_database, &_scratch) != HS_SUCCESS) {
+        LOG(WARNING) << "Unable to allocate scratch space, evaluate the patterns one by one.";
+        hs_free_database(_database);
+        _database = nullptr;
+        return false;
+    }
+    return true;
+}
+
+StatusOr<ColumnPtr> LikePredicate::MultiPatternMatcher::match_any(const ColumnPtr& column) const {
+    DCHECK(_database != nullptr);
+    hs_scratch_t* scratch = nullptr;
+    hs_error_t status;
+    if ((status = hs_clone_scratch(_scratch, &scratch)) != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", status));
+    }
+    DeferOp op([&] {
+        if (scratch != nullptr) {
+            hs_error_t st;
+            if ((st = hs_free_scratch(scratch)) != HS_SUCCESS) {
+                LOG(ERROR) << "free scratch space failure. status: " << st;
+            }
+        }
+    });
+
+    ColumnViewer<TYPE_VARCHAR> viewer(column);
+    ColumnBuilder<TYPE_BOOLEAN> result(viewer.size());
+    for (int row = 0; row < viewer.size(); ++row) {
+        if (viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+        bool v = false;
+        auto value = viewer.value(row);
+        [[maybe_unused]] auto status = hs_scan(
+                // Use &_DUMMY_STRING_FOR_EMPTY_PATTERN instead of nullptr to avoid crash.
+                _database, value.size ? value.data : &_DUMMY_STRING_FOR_EMPTY_PATTERN, value.size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    // Any pattern matching is enough.
+                    *((bool*)ctx) = true;
+                    return 1;
+                },
+                &v);
+        DCHECK(status == HS_SUCCESS || status == HS_SCAN_TERMINATED) << " status: " << status;
+        result.append(v);
+    }
+    return result.build(column->is_constant());
+}
+
 } // namespace starrocks
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -58,6 +59,37 @@ public:
      */
     DEFINE_VECTORIZED_FN(regex);
 
+    // Function ids of LIKE and REGEXP, see gensrc/script/functions.py.
+    static constexpr int64_t LIKE_FID = 60010;
+    static constexpr int64_t REGEXP_FID = 60020;
+
+    // Matches the strings against many constant LIKE and REGEXP patterns by one scan of a multi-pattern hyperscan
+    // database, which evaluates the OR of all the patterns. It is immutable after compile, so it can be shared
+    // by the threads.
+    class MultiPatternMatcher {
+    public:
+        MultiPatternMatcher() = default;
+        ~MultiPatternMatcher();
+
+        MultiPatternMatcher(const MultiPatternMatcher&) = delete;
+        MultiPatternMatcher& operator=(const MultiPatternMatcher&) = delete;
+
+        // Add the pattern of `str LIKE pattern` if `is_like`, otherwise the pattern of `str REGEXP pattern`.
+        void add_pattern(const Slice& pattern, bool is_like);
+        size_t num_patterns() const { return _patterns.size(); }
+
+        // Return false if hyperscan can not compile the patterns, which have to be evaluated one by one.
+        bool compile();
+
+        // Return true for the rows matching any of the patterns, and null for the null rows.
+        StatusOr<ColumnPtr> match_any(const ColumnPtr& column) const;
+
+    private:
+        std::vector<std::string> _patterns;
+        hs_database_t* _database = nullptr;
+        hs_scratch_t* _scratch = nullptr;
+    };
+
 private:
     /**
      * use for:
@@ -150,6 +182,8 @@ private:
     /// regular expression pattern. Escaped chars are copied verbatim.
     template <bool fullMatch>
     static std::string convert_like_pattern(FunctionContext* context, const Slice& pattern);
+    template <bool fullMatch>
+    static std::string convert_like_pattern(char escape_char, const Slice& pattern);
 
     static void remove_escape_character(std::string* search_string);
 
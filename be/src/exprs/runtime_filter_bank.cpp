@@ -202,6 +202,62 @@ StatusOr<ExprContext*> RuntimeFilterHelper::rewrite_runtime_filter_in_cross_join
     return expr;
 }
 
+StatusOr<ExprContext*> RuntimeFilterHelper::rewrite_range_runtime_filter_in_cross_join_node(
+        ObjectPool* pool, ExprContext* conjunct, const std::vector<ChunkPtr>& chunks) {
+    Expr* root = conjunct->root();
+    TExprOpcode::type op = root->op();
+    if (root->node_type() != TExprNodeType::BINARY_PRED ||
+        (op != TExprOpcode::LT && op != TExprOpcode::LE && op != TExprOpcode::GT && op != TExprOpcode::GE)) {
+        return nullptr;
+    }
+    bool use_min = op == TExprOpcode::GT || op == TExprOpcode::GE;
+    auto left_child = root->get_child(0);
+    auto right_child = root->get_child(1);
+
+    // The NULLs never match, the bound is NULL if all the values are NULL so that no probe row passes.
+    ColumnPtr bound_column;
+    size_t bound_row = 0;
+    for (const auto& chunk : chunks) {
+        // all of the child(1) in expr is in build chunk
+        ASSIGN_OR_RETURN(auto res, conjunct->evaluate(right_child, chunk.get()));
+        const Column* data = ColumnHelper::get_data_column(res.get());
+        size_t num_rows = res->is_constant() ? 1 : res->size();
+        for (size_t row = 0; row < num_rows; row++) {
+            if (res->is_null(row)) {
+                continue;
+            }
+            if (bound_column != nullptr) {
+                int c = data->compare_at(row, bound_row, *ColumnHelper::get_data_column(bound_column.get()), 1);
+                if (use_min ? c >= 0 : c <= 0) {
+                    continue;
+                }
+            }
+            bound_column = res;
+            bound_row = row;
+        }
+    }
+
+    ColumnPtr col;
+    if (bound_column == nullptr) {
+        col = ColumnHelper::create_const_null_column(1);
+    } else {
+        const Column* data = ColumnHelper::get_data_column(bound_column.get());
+        ColumnPtr value = data->clone_empty();
+        value->append(*data, bound_row, 1);
+        col = std::make_shared<ConstColumn>(std::move(value), 1);
+    }
+
+    auto literal = pool->add(new VectorizedLiteral(std::move(col), right_child->type()));
+    auto new_expr = root->clone(pool);
+    auto new_left = left_child->clone(pool);
+    new_expr->clear_children();
+    new_expr->add_child(new_left);
+    new_expr->add_child(literal);
+    auto expr = pool->add(new ExprContext(new_expr));
+    expr->set_build_from_only_in_filter(true);
+    return expr;
+}
+
 struct FilterZoneMapWithMinMaxOp {
     template <LogicalType ltype>
     bool operator()(const JoinRuntimeFilter* expr, const Column* min_column, const Column* max_column) {
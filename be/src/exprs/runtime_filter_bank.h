@@ -67,6 +67,12 @@ public:
                                             LogicalType type, JoinRuntimeFilter* filter, size_t column_offset);
     static StatusOr<ExprContext*> rewrite_runtime_filter_in_cross_join_node(ObjectPool* pool, ExprContext* conjunct,
                                                                             Chunk* chunk);
+    // Rewrites the range comparison `probe_expr OP build_expr` of a cross join with many build rows into
+    // `probe_expr OP min(build_expr)` for > and >=, or `probe_expr OP max(build_expr)` for < and <=, which any probe
+    // row matching some build row satisfies. Returns nullptr if `conjunct` isn't such a comparison.
+    static StatusOr<ExprContext*> rewrite_range_runtime_filter_in_cross_join_node(ObjectPool* pool,
+                                                                                  ExprContext* conjunct,
+                                                                                  const std::vector<ChunkPtr>& chunks);
 
     static bool filter_zonemap_with_min_max(LogicalType type, const JoinRuntimeFilter* filter, const Column* min_column,
                                             const Column* max_column);
@@ -15,6 +15,7 @@
 #include "exprs/time_functions.h"
 
 #include <algorithm>
+#include <cstring>
 #include <string_view>
 #include <unordered_map>
 
@@ -2045,12 +2046,87 @@ Status TimeFunctions::format_prepare(FunctionContext* context, FunctionContext::
         fc->fmt_type = TimeFunctions::yyyy;
     } else {
         fc->fmt_type = TimeFunctions::None;
+        if (!compile_format_program(fc->fmt, &fc->program)) {
+            fc->program.clear();
+        }
     }
 
     fc->is_valid = true;
     return Status::OK();
 }
 
+bool TimeFunctions::compile_format_program(const std::string& fmt, std::vector<FormatOp>* program) {
+    // Leave the long outputs to DateTimeValue::to_format_string, which returns null if exceeding its buffer.
+    constexpr size_t max_output_len = 100;
+    size_t output_len = 0;
+    auto append_literal = [&](char ch) {
+        if (program->empty() || program->back().field != FormatOp::LITERAL) {
+            program->push_back({FormatOp::LITERAL, 0, {}});
+        }
+        program->back().literal.push_back(ch);
+        output_len++;
+    };
+    auto append_field = [&](FormatOp::Field field, uint8_t width, size_t max_len) {
+        program->push_back({field, width, {}});
+        output_len += max_len;
+    };
+
+    program->clear();
+    for (size_t i = 0; i < fmt.size(); ++i) {
+        if (fmt[i] != '%' || i + 1 == fmt.size()) {
+            append_literal(fmt[i]);
+            continue;
+        }
+        const char ch = fmt[++i];
+        switch (ch) {
+        case 'Y':
+            append_field(FormatOp::YEAR, 4, 4);
+            break;
+        case 'y':
+            append_field(FormatOp::YEAR2, 2, 2);
+            break;
+        case 'm':
+        case 'c':
+            append_field(FormatOp::MONTH, ch == 'm' ? 2 : 1, 2);
+            break;
+        case 'd':
+        case 'e':
+            append_field(FormatOp::DAY, ch == 'd' ? 2 : 1, 2);
+            break;
+        case 'H':
+        case 'k':
+            append_field(FormatOp::HOUR, ch == 'H' ? 2 : 1, 2);
+            break;
+        case 'h':
+        case 'I':
+        case 'l':
+            append_field(FormatOp::HOUR12, ch == 'l' ? 1 : 2, 2);
+            break;
+        case 'i':
+            append_field(FormatOp::MINUTE, 2, 2);
+            break;
+        case 's':
+        case 'S':
+            append_field(FormatOp::SECOND, 2, 2);
+            break;
+        case 'f':
+            append_field(FormatOp::MICROSECOND, 6, 6);
+            break;
+        case 'T':
+            append_field(FormatOp::TIME, 0, 8);
+            break;
+        default:
+            // The names, the week and the day of year fields are left to the standard format.
+            if (isalpha(ch)) {
+                return false;
+            }
+            append_literal(ch);
+            break;
+        }
+    }
+    return !program->empty() && output_len <= max_output_len;
+}
+
 Status TimeFunctions::format_close(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
     if (scope != FunctionContext::FRAGMENT_LOCAL) {
         return Status::OK();
@@ -2222,6 +2298,87 @@ StatusOr<ColumnPtr> standard_format(const std::string& fmt, int len, const starr
     return result.build(ColumnHelper::is_all_const(columns));
 }
 
+static inline char* append_padded_number(uint32_t value, uint8_t width, char* to) {
+    char buf[16];
+    char* end = buf + sizeof(buf);
+    char* pos = end;
+    do {
+        *--pos = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    for (int n = end - pos; n < width; ++n) {
+        *to++ = '0';
+    }
+    memcpy(to, pos, end - pos);
+    return to + (end - pos);
+}
+
+// Format the rows with the pattern compiled by TimeFunctions::compile_format_program,
+// the output is the same as standard_format.
+template <LogicalType Type>
+StatusOr<ColumnPtr> program_format(const std::vector<TimeFunctions::FormatOp>& program, const Columns& columns) {
+    using FormatOp = TimeFunctions::FormatOp;
+    auto ts_viewer = ColumnViewer<Type>(columns[0]);
+
+    size_t size = columns[0]->size();
+    ColumnBuilder<TYPE_VARCHAR> result(size);
+
+    char buf[128];
+    for (size_t i = 0; i < size; ++i) {
+        if (ts_viewer.is_null(i)) {
+            result.append_null();
+            continue;
+        }
+        int year, month, day, hour, minute, second, microsecond;
+        ((TimestampValue)ts_viewer.value(i)).to_timestamp(&year, &month, &day, &hour, &minute, &second, &microsecond);
+        char* to = buf;
+        for (const auto& op : program) {
+            switch (op.field) {
+            case FormatOp::LITERAL:
+                memcpy(to, op.literal.data(), op.literal.size());
+                to += op.literal.size();
+                break;
+            case FormatOp::YEAR:
+                to = append_padded_number(year, op.width, to);
+                break;
+            case FormatOp::YEAR2:
+                to = append_padded_number(year % 100, op.width, to);
+                break;
+            case FormatOp::MONTH:
+                to = append_padded_number(month, op.width, to);
+                break;
+            case FormatOp::DAY:
+                to = append_padded_number(day, op.width, to);
+                break;
+            case FormatOp::HOUR:
+                to = append_padded_number(hour, op.width, to);
+                break;
+            case FormatOp::HOUR12:
+                to = append_padded_number((hour % 24 + 11) % 12 + 1, op.width, to);
+                break;
+            case FormatOp::MINUTE:
+                to = append_padded_number(minute, op.width, to);
+                break;
+            case FormatOp::SECOND:
+                to = append_padded_number(second, op.width, to);
+                break;
+            case FormatOp::MICROSECOND:
+                to = append_padded_number(microsecond, op.width, to);
+                break;
+            case FormatOp::TIME:
+                to = append_padded_number(hour % 24, 2, to);
+                *to++ = ':';
+                to = append_padded_number(minute, 2, to);
+                *to++ = ':';
+                to = append_padded_number(second, 2, to);
+                break;
+            }
+        }
+        result.append(Slice(buf, to - buf));
+    }
+    return result.build(ColumnHelper::is_all_const(columns));
+}
+
 template <LogicalType Type>
 StatusOr<ColumnPtr> do_format(const TimeFunctions::FormatCtx* ctx, const Columns& cols) {
     if (ctx->fmt_type == TimeFunctions::yyyyMMdd) {
@@ -2236,6 +2393,8 @@ StatusOr<ColumnPtr> do_format(const TimeFunctions::FormatCtx* ctx, const Columns
         return date_format_func<yyyyMMImpl, Type>(cols, 6);
     } else if (ctx->fmt_type == TimeFunctions::yyyy) {
         return date_format_func<yyyyImpl, Type>(cols, 4);
+    } else if (!ctx->program.empty()) {
+        return program_format<Type>(ctx->program, cols);
     } else {
         return standard_format<Type>(ctx->fmt, 128, cols);
     }
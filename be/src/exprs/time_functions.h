@@ -851,13 +851,29 @@ public:
         None
     };
 
+    // One step of a date_format pattern compiled in format_prepare.
+    struct FormatOp {
+        enum Field : uint8_t { LITERAL, YEAR, YEAR2, MONTH, DAY, HOUR, HOUR12, MINUTE, SECOND, MICROSECOND, TIME };
+        Field field;
+        // Minimal number of the digits of a numeric field, padded with '0'.
+        uint8_t width;
+        // The literal chars copied as is.
+        std::string literal;
+    };
+
     struct FormatCtx {
         bool is_valid = false;
         std::string fmt;
         int len;
         FormatType fmt_type;
+        // Not empty if fmt_type is None and the pattern only has the numeric fields and literals,
+        // so the rows are formatted without interpreting the pattern again.
+        std::vector<FormatOp> program;
     };
 
+    // Compile `fmt` into `program`, return false if `fmt` has the fields not supported by FormatOp.
+    static bool compile_format_program(const std::string& fmt, std::vector<FormatOp>* program);
+
     struct ParseJodaState {
         std::unique_ptr<joda::JodaFormat> joda;
 
@@ -16,6 +16,8 @@
 
 #include <unordered_set>
 
+#include "simd/simd.h"
+
 namespace starrocks {
 
 using Field = Slice;
@@ -555,17 +557,17 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        SIMD::for_each_equal_byte(record.data, size, _parse_options.column_delimiter[0], [&](size_t i) {
+            ptr = record.data + i;
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, ptr - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, ptr - value);
             }
-        }
+            value = ptr + 1;
+        });
+        ptr = record.data + size;
     } else {
         const auto* const base = ptr;
 
@@ -0,0 +1,58 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <roaring/roaring.hh>
+
+namespace starrocks {
+
+// Helpers to apply a deletion vector, the roaring bitmap of the positions of the deleted rows in a file, to the rows
+// read by the file readers.
+
+// Returns the number of the deleted rows in [from, to).
+inline size_t count_deleted_rows(const roaring::Roaring& deletion_vector, int64_t from, int64_t to) {
+    static constexpr int64_t kMaxRows = int64_t(UINT32_MAX) + 1;
+    to = std::min(to, kMaxRows);
+    if (from >= to) {
+        return 0;
+    }
+    uint64_t deleted = deletion_vector.rank(static_cast<uint32_t>(to - 1));
+    if (from > 0) {
+        deleted -= deletion_vector.rank(static_cast<uint32_t>(from - 1));
+    }
+    return deleted;
+}
+
+// Clears |filter| of the deleted rows in [from, to), where filter[0] is of the row |from|. Returns whether there are
+// deleted rows in the range.
+inline bool apply_deletion_vector(const roaring::Roaring& deletion_vector, int64_t from, int64_t to, uint8_t* filter) {
+    static constexpr int64_t kMaxRows = int64_t(UINT32_MAX) + 1;
+    if (from >= kMaxRows) {
+        return false;
+    }
+    bool deleted = false;
+    auto iter = deletion_vector.begin();
+    const auto end = deletion_vector.end();
+    iter.equalorlarger(static_cast<uint32_t>(from));
+    for (; iter != end && *iter < to; ++iter) {
+        filter[*iter - from] = 0;
+        deleted = true;
+    }
+    return deleted;
+}
+
+} // namespace starrocks
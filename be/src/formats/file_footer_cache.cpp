@@ -0,0 +1,70 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/file_footer_cache.h"
+
+#include <fmt/format.h>
+
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+static void footer_deleter(const CacheKey& key, void* value) {
+    delete static_cast<std::shared_ptr<void>*>(value);
+}
+
+FileFooterCache::FileFooterCache(size_t capacity) {
+    if (capacity > 0) {
+        _cache = new_lru_cache(capacity);
+    }
+}
+
+FileFooterCache::~FileFooterCache() {
+    delete _cache;
+}
+
+std::string FileFooterCache::make_key(std::string_view kind, std::string_view path, int64_t modification_time,
+                                      int64_t file_size) {
+    return fmt::format("{}:{}:{}:{}", kind, modification_time, file_size, path);
+}
+
+std::shared_ptr<void> FileFooterCache::_lookup(const std::string& key) {
+    if (_cache == nullptr) {
+        return nullptr;
+    }
+    Cache::Handle* handle = _cache->lookup(CacheKey(key));
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    std::shared_ptr<void> value = *static_cast<std::shared_ptr<void>*>(_cache->value(handle));
+    _cache->release(handle);
+    return value;
+}
+
+void FileFooterCache::insert(const std::string& key, std::shared_ptr<void> value, size_t charge) {
+    if (_cache == nullptr) {
+        return;
+    }
+    auto* holder = new std::shared_ptr<void>(std::move(value));
+    Cache::Handle* handle = _cache->insert(CacheKey(key), holder, charge, footer_deleter);
+    if (handle != nullptr) {
+        _cache->release(handle);
+    }
+}
+
+size_t FileFooterCache::memory_usage() const {
+    return _cache == nullptr ? 0 : _cache->get_memory_usage();
+}
+
+} // namespace starrocks
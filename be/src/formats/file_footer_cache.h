@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "common/config.h"
+#include "gutil/macros.h"
+
+namespace starrocks {
+
+class Cache;
+
+// Caches the parsed footers of the external parquet and orc files, shared by all the queries of the BE, so that the
+// scans of a file don't read and parse its footer again. The files are identified by their paths together with their
+// modification times and sizes, as the files of the external tables are not modified in place.
+//
+// It is used when the footers are not cached by the datacache, and disabled if
+// config::external_file_footer_cache_capacity is 0.
+class FileFooterCache {
+public:
+    static FileFooterCache* instance() {
+        static FileFooterCache cache(std::max<int64_t>(0, config::external_file_footer_cache_capacity));
+        return &cache;
+    }
+
+    // |capacity| is in bytes, 0 disables the cache.
+    explicit FileFooterCache(size_t capacity);
+    ~FileFooterCache();
+
+    DISALLOW_COPY(FileFooterCache);
+
+    bool enabled() const { return _cache != nullptr; }
+
+    // Returns the key of the footer of the file. |kind| tells the different objects cached for the same file apart.
+    static std::string make_key(std::string_view kind, std::string_view path, int64_t modification_time,
+                                int64_t file_size);
+
+    // Returns the cached object of |key|, or null if it is not cached.
+    template <typename T>
+    std::shared_ptr<T> lookup(const std::string& key) {
+        return std::static_pointer_cast<T>(_lookup(key));
+    }
+
+    // Caches |value| as |key| with the memory usage |charge|.
+    void insert(const std::string& key, std::shared_ptr<void> value, size_t charge);
+
+    size_t memory_usage() const;
+
+private:
+    std::shared_ptr<void> _lookup(const std::string& key);
+
+    Cache* _cache = nullptr;
+};
+
+} // namespace starrocks
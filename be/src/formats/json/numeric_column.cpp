@@ -173,6 +173,20 @@ Status add_numeric_column(Column* column, const TypeDescriptor& type_desc, const
         simdjson::ondemand::json_type tp = value->type();
         switch (tp) {
         case simdjson::ondemand::json_type::number: {
+            if constexpr (!std::is_floating_point_v<T>) {
+                // Most integers fit in int64_t, parse them only once instead of parsing them to get the number
+                // type first. A failed get_int64() doesn't consume the value, so the others fall back.
+                int64_t in = 0;
+                if (value->get_int64().get(in) == simdjson::SUCCESS) {
+                    T out{};
+                    if (!checked_cast(in, &out)) {
+                        numeric_column->append_numbers(&out, sizeof(out));
+                        return Status::OK();
+                    }
+                    auto err_msg = strings::Substitute("Value is overflow. column=$0, value=$1", name, in);
+                    return Status::InvalidArgument(err_msg);
+                }
+            }
             return add_column_with_numeric_value(numeric_column, type_desc, name, value);
         }
 
@@ -97,6 +97,14 @@ public:
     virtual bool isIOAdaptiveCoalesceEnabled() const;
     virtual void releaseToOffset(const int64_t offset);
     virtual void setIORanges(std::vector<InputStream::IORange>& io_ranges);
+    /**
+     * Whether to read the stripe at stripeOffset ahead, while the stripe before it is decoding.
+     */
+    virtual bool isStripePrefetchEnabled(const uint64_t stripeOffset) const;
+    /**
+     * Set the io ranges of a stripe that will be read later, and start reading them in the background.
+     */
+    virtual void prefetchIORanges(std::vector<InputStream::IORange>& io_ranges);
 };
 
 /**
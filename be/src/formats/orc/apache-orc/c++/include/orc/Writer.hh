@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
@@ -39,6 +40,9 @@ enum RleVersion { RleVersion_1 = 0, RleVersion_2 = 1 };
 
 class Timezone;
 
+// Runs all the tasks and returns after they finish.
+using ColumnsExecutor = std::function<void(std::vector<std::function<void()>>&)>;
+
 /**
    * Options for creating a Writer.
    */
@@ -228,6 +232,19 @@ public:
      * @param zone writer timezone name
      */
     WriterOptions& setTimezoneName(const std::string& zone);
+
+    /**
+     * Set the executor of the top-level columns of the added batches. It's called
+     * with a task for each column and returns after all the tasks finish, so the
+     * columns can be encoded and compressed in parallel. The columns are written
+     * one by one if it's not set.
+     */
+    WriterOptions& setColumnsExecutor(ColumnsExecutor executor);
+
+    /**
+     * Get the executor of the top-level columns
+     */
+    const ColumnsExecutor& getColumnsExecutor() const;
 };
 
 class Writer {
@@ -18,6 +18,8 @@
 
 #include "ColumnWriter.hh"
 
+#include <exception>
+
 #include "ByteRLE.hh"
 #include "RLE.hh"
 #include "Statistics.hh"
@@ -273,6 +275,8 @@ public:
 
 private:
     std::vector<std::unique_ptr<ColumnWriter>> children;
+    // Only set for the root column.
+    ColumnsExecutor columnsExecutor;
 };
 
 StructColumnWriter::StructColumnWriter(const Type& type, const StreamsFactory& factory, const WriterOptions& options)
@@ -281,6 +285,9 @@ StructColumnWriter::StructColumnWriter(const Type& type, const StreamsFactory& f
         const Type& child = *type.getSubtype(i);
         children.push_back(buildWriter(child, factory, options));
     }
+    if (type.getColumnId() == 0) {
+        columnsExecutor = options.getColumnsExecutor();
+    }
 
     if (enableIndex) {
         recordPosition();
@@ -296,8 +303,30 @@ void StructColumnWriter::add(ColumnVectorBatch& rowBatch, uint64_t offset, uint6
 
     ColumnWriter::add(rowBatch, offset, numValues, incomingMask);
     const char* notNull = structBatch->hasNulls ? structBatch->notNull.data() + offset : nullptr;
-    for (uint32_t i = 0; i < children.size(); ++i) {
-        children[i]->add(*structBatch->fields[i], offset, numValues, notNull);
+    if (columnsExecutor && children.size() > 1) {
+        // The writers of the columns share nothing but the memory pool.
+        std::vector<std::exception_ptr> errors(children.size());
+        std::vector<std::function<void()>> tasks;
+        tasks.reserve(children.size());
+        for (uint32_t i = 0; i < children.size(); ++i) {
+            tasks.emplace_back([&, i]() {
+                try {
+                    children[i]->add(*structBatch->fields[i], offset, numValues, notNull);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        columnsExecutor(tasks);
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    } else {
+        for (uint32_t i = 0; i < children.size(); ++i) {
+            children[i]->add(*structBatch->fields[i], offset, numValues, notNull);
+        }
     }
 
     // update stats
@@ -1006,10 +1006,11 @@ void RowReaderImpl::markEndOfFile() {
     }
 }
 
-void RowReaderImpl::buildIORanges(std::vector<InputStream::IORange>* io_ranges) {
+void RowReaderImpl::buildIORanges(const proto::StripeInformation& stripeInfo, const proto::StripeFooter& stripeFooter,
+                                  std::vector<InputStream::IORange>* io_ranges) {
     // column streams: index & data
-    uint64_t offset = currentStripeInfo.offset();
-    for (const proto::Stream& stream : currentStripeFooter.streams()) {
+    uint64_t offset = stripeInfo.offset();
+    for (const proto::Stream& stream : stripeFooter.streams()) {
         uint32_t columnId = stream.column();
         uint64_t length = stream.length();
         // ColumnId = 0 is root column, we always need it
@@ -1033,6 +1034,31 @@ void RowReaderImpl::buildIORanges(std::vector<InputStream::IORange>* io_ranges)
     }
 }
 
+void RowReaderImpl::prefetchNextStripe() {
+    const uint64_t nextStripe = currentStripe + 1;
+    if (nextStripe >= lastStripe || nextStripe == prefetchedStripe) {
+        return;
+    }
+    const proto::StripeInformation& nextStripeInfo = footer->stripes(static_cast<int>(nextStripe));
+    if (!contents->stream->isStripePrefetchEnabled(nextStripeInfo.offset())) {
+        return;
+    }
+    size_t stripeSize = nextStripeInfo.indexlength() + nextStripeInfo.datalength() + nextStripeInfo.footerlength();
+    // malformed stripe is reported when it is opened.
+    if ((nextStripeInfo.offset() + stripeSize) >= contents->stream->getLength()) {
+        return;
+    }
+    // tiny stripes are already read together.
+    if (contents->stream->isAlreadyCollectedInSharedBuffer(nextStripeInfo.offset(), stripeSize)) {
+        return;
+    }
+    prefetchedStripeFooter = getStripeFooter(nextStripeInfo, *contents);
+    prefetchedStripe = nextStripe;
+    std::vector<InputStream::IORange> io_ranges;
+    buildIORanges(nextStripeInfo, prefetchedStripeFooter, &io_ranges);
+    contents->stream->prefetchIORanges(io_ranges);
+}
+
 void RowReaderImpl::startNextStripe() {
     reader.reset(); // ColumnReaders use lots of memory; free old memory first
     rowIndexes.clear();
@@ -1094,14 +1120,24 @@ void RowReaderImpl::startNextStripe() {
         if (isIOCoalesceEnabled) {
             contents->stream->releaseToOffset(currentStripeInfo.offset());
         }
-        currentStripeFooter = getStripeFooter(currentStripeInfo, *contents);
+        // the io ranges of a prefetched stripe are already set in shared buffer.
+        const bool isPrefetched = (currentStripe == prefetchedStripe);
+        if (isPrefetched) {
+            currentStripeFooter = std::move(prefetchedStripeFooter);
+            prefetchedStripe = (std::numeric_limits<uint64_t>::max)();
+        } else {
+            currentStripeFooter = getStripeFooter(currentStripeInfo, *contents);
+        }
         // We need to check this stripe is already set in shared buffer(tiny stripe optimize) to avoid shared buffer overlap
-        if (isIOCoalesceEnabled &&
+        if (isIOCoalesceEnabled && !isPrefetched &&
             !contents->stream->isAlreadyCollectedInSharedBuffer(currentStripeInfo.offset(), stripeSize)) {
             std::vector<InputStream::IORange> io_ranges;
-            buildIORanges(&io_ranges);
+            buildIORanges(currentStripeInfo, currentStripeFooter, &io_ranges);
             contents->stream->setIORanges(io_ranges);
         }
+        if (isIOCoalesceEnabled) {
+            prefetchNextStripe();
+        }
 
         if (sargsApplier) {
             // read row group statistics and bloom filters of current stripe
@@ -1588,6 +1624,12 @@ void InputStream::releaseToOffset(const int64_t offset) {}
 
 void InputStream::setIORanges(std::vector<InputStream::IORange>& io_ranges) {}
 
+bool InputStream::isStripePrefetchEnabled(const uint64_t stripeOffset) const {
+    return false;
+}
+
+void InputStream::prefetchIORanges(std::vector<InputStream::IORange>& io_ranges) {}
+
 std::atomic<int32_t>* InputStream::get_lazy_column_coalesce_counter() {
     return nullptr;
 }
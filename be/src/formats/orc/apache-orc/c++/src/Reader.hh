@@ -157,6 +157,9 @@ private:
     uint64_t numRowGroupsInStripeRange;
     proto::StripeInformation currentStripeInfo;
     proto::StripeFooter currentStripeFooter;
+    // the stripe after current stripe whose io ranges are prefetched, and its footer.
+    uint64_t prefetchedStripe = (std::numeric_limits<uint64_t>::max)();
+    proto::StripeFooter prefetchedStripeFooter;
     std::unique_ptr<ColumnReader> reader;
 
     bool enableEncodedBlock;
@@ -212,7 +215,9 @@ private:
      */
     bool hasBadBloomFilters();
 
-    void buildIORanges(std::vector<InputStream::IORange>* io_ranges);
+    void buildIORanges(const proto::StripeInformation& stripeInfo, const proto::StripeFooter& stripeFooter,
+                       std::vector<InputStream::IORange>* io_ranges);
+    void prefetchNextStripe();
 
 public:
     /**
@@ -42,6 +42,7 @@ struct WriterOptionsPrivate {
     double bloomFilterFalsePositiveProb;
     BloomFilterVersion bloomFilterVersion;
     std::string timezone;
+    ColumnsExecutor columnsExecutor;
 
     WriterOptionsPrivate() : fileVersion(FileVersion::v_0_12()) { // default to Hive_0_12
         stripeSize = 64 * 1024 * 1024;                            // 64M
@@ -246,6 +247,15 @@ WriterOptions& WriterOptions::setTimezoneName(const std::string& zone) {
     return *this;
 }
 
+WriterOptions& WriterOptions::setColumnsExecutor(ColumnsExecutor executor) {
+    privateBits->columnsExecutor = std::move(executor);
+    return *this;
+}
+
+const ColumnsExecutor& WriterOptions::getColumnsExecutor() const {
+    return privateBits->columnsExecutor;
+}
+
 Writer::~Writer() {
     // PASS
 }
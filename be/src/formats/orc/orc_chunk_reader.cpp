@@ -27,6 +27,7 @@
 #include "column/vectorized_fwd.h"
 #include "exprs/cast_expr.h"
 #include "exprs/literal.h"
+#include "formats/deletion_vector.h"
 #include "formats/orc/orc_mapping.h"
 #include "formats/orc/orc_memory_pool.h"
 #include "formats/orc/utils.h"
@@ -1229,6 +1230,21 @@ size_t OrcChunkReader::get_row_delete_number(const std::set<int64_t>& deleted_po
     return std::distance(iter, end);
 }
 
+ColumnPtr OrcChunkReader::get_row_delete_filter(const roaring::Roaring& deletion_vector) {
+    int64_t start_pos = _row_reader->getRowNumber();
+    auto num_rows = _batch->numElements;
+    ColumnPtr filter_column = BooleanColumn::create(num_rows, 1);
+    auto& filter = static_cast<BooleanColumn*>(filter_column.get())->get_data();
+    apply_deletion_vector(deletion_vector, start_pos, start_pos + num_rows, filter.data());
+    return filter_column;
+}
+
+size_t OrcChunkReader::get_row_delete_number(const roaring::Roaring& deletion_vector) {
+    int64_t start_pos = _row_reader->getRowNumber();
+    auto num_rows = _batch->numElements;
+    return count_deleted_rows(deletion_vector, start_pos, start_pos + num_rows);
+}
+
 Status OrcChunkReader::apply_dict_filter_eval_cache(const std::unordered_map<SlotId, FilterPtr>& dict_filter_eval_cache,
                                                     Filter* filter) {
     if (dict_filter_eval_cache.size() == 0) {
@@ -16,6 +16,7 @@
 
 #include <boost/algorithm/string.hpp>
 #include <orc/OrcFile.hh>
+#include <roaring/roaring.hh>
 
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
@@ -127,6 +128,9 @@ public:
     StatusOr<ChunkPtr> get_lazy_chunk();
     ColumnPtr get_row_delete_filter(const std::set<int64_t>& deleted_pos);
     size_t get_row_delete_number(const std::set<int64_t>& deleted_pos);
+    // Same as above, the deleted rows are given by a deletion vector.
+    ColumnPtr get_row_delete_filter(const roaring::Roaring& deletion_vector);
+    size_t get_row_delete_number(const roaring::Roaring& deletion_vector);
 
     bool is_implicit_castable(TypeDescriptor& starrocks_type, const TypeDescriptor& orc_type);
 
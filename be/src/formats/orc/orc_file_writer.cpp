@@ -16,6 +16,7 @@
 
 #include <fmt/format.h>
 
+#include <atomic>
 #include <utility>
 
 #include "column/array_column.h"
@@ -25,7 +26,10 @@
 #include "formats/orc/utils.h"
 #include "formats/utils.h"
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
+#include "util/countdown_latch.h"
 #include "util/debug_util.h"
+#include "util/threadpool.h"
 
 namespace starrocks::formats {
 
@@ -109,6 +113,32 @@ void AsyncOrcOutputStream::close() {
     }
 }
 
+// Runs |tasks| by the threads of |pool| and the calling thread, returns after all of them finish.
+static void run_in_parallel(ThreadPool* pool, std::vector<std::function<void()>>& tasks) {
+    std::atomic<size_t> next_task = 0;
+    auto run_tasks = [&]() {
+        for (size_t i = next_task++; i < tasks.size(); i = next_task++) {
+            tasks[i]();
+        }
+    };
+
+    size_t num_threads = std::min<size_t>(tasks.size() - 1, pool->max_threads());
+    CountDownLatch latch(num_threads);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    for (size_t i = 0; i < num_threads; i++) {
+        auto st = pool->submit_func([&]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            run_tasks();
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            latch.count_down();
+        }
+    }
+    run_tasks();
+    latch.wait();
+}
+
 ORCFileWriter::ORCFileWriter(std::string location, std::shared_ptr<orc::OutputStream> output_stream,
                              std::vector<std::string> column_names, std::vector<TypeDescriptor> type_descs,
                              std::vector<std::unique_ptr<ColumnEvaluator>>&& column_evaluators,
@@ -130,6 +160,11 @@ Status ORCFileWriter::init() {
     ASSIGN_OR_RETURN(auto compression, _convert_compression_type(_compression_type));
     options.setCompression(compression);
     options.setMemoryPool(&_memory_pool);
+    if (_writer_options != nullptr && _writer_options->encode_pool != nullptr) {
+        options.setColumnsExecutor([pool = _writer_options->encode_pool](std::vector<std::function<void()>>& tasks) {
+            run_in_parallel(pool, tasks);
+        });
+    }
     _writer = orc::createWriter(*_schema, _output_stream.get(), options);
     _writer->addUserMetadata(STARROCKS_ORC_WRITER_VERSION_KEY, get_short_version());
     return Status::OK();
@@ -144,8 +179,9 @@ int64_t ORCFileWriter::get_allocated_bytes() {
 }
 
 Status ORCFileWriter::write(Chunk* chunk) {
-    ASSIGN_OR_RETURN(auto cvb, _convert(chunk));
-    _writer->add(*cvb);
+    Columns columns;
+    RETURN_IF_ERROR(_convert(chunk, &columns));
+    _writer->add(*_row_batch);
     _row_counter += chunk->num_rows();
     return Status::OK();
 }
@@ -173,21 +209,27 @@ FileWriter::CommitResult ORCFileWriter::commit() {
     auto promise = std::make_shared<std::promise<FileWriter::CommitResult>>();
     std::future<FileWriter::CommitResult> future = promise->get_future();
 
+    _row_batch = nullptr;
     _writer = nullptr;
     return result;
 }
 
-StatusOr<std::unique_ptr<orc::ColumnVectorBatch>> ORCFileWriter::_convert(Chunk* chunk) {
-    auto cvb = _writer->createRowBatch(chunk->num_rows());
-    auto root = down_cast<orc::StructVectorBatch*>(cvb.get());
+Status ORCFileWriter::_convert(Chunk* chunk, Columns* columns) {
+    if (_row_batch == nullptr) {
+        _row_batch = _writer->createRowBatch(chunk->num_rows());
+    }
+    auto root = down_cast<orc::StructVectorBatch*>(_row_batch.get());
+    root->resize(chunk->num_rows());
 
+    columns->reserve(_column_evaluators.size());
     for (size_t i = 0; i < _column_evaluators.size(); ++i) {
         ASSIGN_OR_RETURN(auto column, _column_evaluators[i]->evaluate(chunk));
         RETURN_IF_ERROR(_write_column(*root->fields[i], column, _type_descs[i]));
+        columns->emplace_back(std::move(column));
     }
 
     root->numElements = chunk->num_rows();
-    return cvb;
+    return Status::OK();
 }
 
 Status ORCFileWriter::_write_column(orc::ColumnVectorBatch& orc_column, ColumnPtr& column,
@@ -494,6 +536,7 @@ Status ORCFileWriterFactory::init() {
         RETURN_IF_ERROR(e->init());
     }
     _parsed_options = std::make_shared<ORCWriterOptions>();
+    _parsed_options->encode_pool = ExecEnv::GetInstance()->parquet_writer_encode_pool();
     return Status::OK();
 }
 
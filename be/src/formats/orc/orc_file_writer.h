@@ -21,6 +21,10 @@
 #include "formats/file_writer.h"
 #include "orc_memory_pool.h"
 
+namespace starrocks {
+class ThreadPool;
+} // namespace starrocks
+
 namespace starrocks::formats {
 
 class OrcOutputStream : public orc::OutputStream {
@@ -65,7 +69,10 @@ private:
     bool _is_closed = false;
 };
 
-struct ORCWriterOptions : public FileWriterOptions {};
+struct ORCWriterOptions : public FileWriterOptions {
+    // The pool encoding and compressing the columns of the batches in parallel, null to encode them serially.
+    ThreadPool* encode_pool = nullptr;
+};
 
 class ORCFileWriter final : public FileWriter {
 public:
@@ -97,7 +104,9 @@ private:
 
     static void _populate_orc_notnull(orc::ColumnVectorBatch& orc_column, uint8_t* null_column, size_t column_size);
 
-    StatusOr<std::unique_ptr<orc::ColumnVectorBatch>> _convert(Chunk* chunk);
+    // Converts |chunk| into _row_batch. The string vectors point to the bytes of the columns, which are kept in
+    // |columns| until the batch is added to the writer.
+    Status _convert(Chunk* chunk, Columns* columns);
 
     Status _write_column(orc::ColumnVectorBatch& orc_column, ColumnPtr& column, const TypeDescriptor& type_desc);
 
@@ -124,6 +133,8 @@ private:
     std::unique_ptr<orc::Type> _schema;
     std::shared_ptr<orc::Writer> _writer;
     OrcMemoryPool _memory_pool;
+    // Reused by the chunks, its vectors grow to the largest chunk. Allocated from _memory_pool.
+    std::unique_ptr<orc::ColumnVectorBatch> _row_batch;
     TCompressionType::type _compression_type = TCompressionType::UNKNOWN_COMPRESSION;
     std::shared_ptr<ORCWriterOptions> _writer_options;
     int64_t _row_counter{0};
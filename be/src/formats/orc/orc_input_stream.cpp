@@ -86,6 +86,25 @@ void ORCHdfsFileStream::setIORanges(std::vector<IORange>& io_ranges) {
     }
 }
 
+bool ORCHdfsFileStream::isStripePrefetchEnabled(const uint64_t stripeOffset) const {
+    if (!_sb_stream || !config::orc_prefetch_next_stripe_enable) {
+        return false;
+    }
+    return stripeOffset >= _prefetch_range_offset && stripeOffset < _prefetch_range_offset + _prefetch_range_length;
+}
+
+void ORCHdfsFileStream::prefetchIORanges(std::vector<IORange>& io_ranges) {
+    if (!_sb_stream || io_ranges.empty()) return;
+    setIORanges(io_ranges);
+    uint64_t begin = io_ranges.front().offset;
+    uint64_t end = begin;
+    for (const auto& r : io_ranges) {
+        begin = std::min(begin, r.offset);
+        end = std::max(end, r.offset + r.size);
+    }
+    _sb_stream->prefetch(begin, end - begin);
+}
+
 std::atomic<int32_t>* ORCHdfsFileStream::get_lazy_column_coalesce_counter() {
     return _lazy_column_coalesce_counter;
 }
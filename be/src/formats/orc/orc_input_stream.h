@@ -68,6 +68,13 @@ public:
     bool isAlreadyCollectedInSharedBuffer(const int64_t offset, const int64_t length) const override;
     void releaseToOffset(const int64_t offset) override;
     void setIORanges(std::vector<IORange>& io_ranges) override;
+    bool isStripePrefetchEnabled(const uint64_t stripeOffset) const override;
+    void prefetchIORanges(std::vector<IORange>& io_ranges) override;
+    // Only the stripes starting in [offset, offset + length) are prefetched, the others are not read by this scan.
+    void set_prefetch_range(uint64_t offset, uint64_t length) {
+        _prefetch_range_offset = offset;
+        _prefetch_range_length = length;
+    }
     Status setIORanges(const std::vector<io::SharedBufferedInputStream::IORange>& io_ranges,
                        const bool coalesce_active_lazy_column = true);
     std::atomic<int32_t>* get_lazy_column_coalesce_counter() override;
@@ -78,5 +85,7 @@ private:
     io::SharedBufferedInputStream* _sb_stream;
     std::atomic<int32_t>* _lazy_column_coalesce_counter = nullptr;
     HdfsScanStats* _app_stats = nullptr;
+    uint64_t _prefetch_range_offset = 0;
+    uint64_t _prefetch_range_length = 0;
 };
 } // namespace starrocks
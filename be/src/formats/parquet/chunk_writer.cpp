@@ -14,10 +14,12 @@
 
 #include "formats/parquet/chunk_writer.h"
 
+#include <fmt/format.h>
 #include <parquet/file_writer.h>
 #include <parquet/schema.h>
 
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <utility>
 
@@ -26,31 +28,74 @@
 #include "exprs/function_context.h"
 #include "formats/parquet/column_chunk_writer.h"
 #include "formats/parquet/level_builder.h"
+#include "runtime/current_thread.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 
 namespace starrocks::parquet {
 
+static int num_leaf_columns(const ::parquet::schema::Node& node) {
+    if (node.is_primitive()) {
+        return 1;
+    }
+    const auto& group_node = static_cast<const ::parquet::schema::GroupNode&>(node);
+    int num_leaves = 0;
+    for (int i = 0; i < group_node.field_count(); i++) {
+        num_leaves += num_leaf_columns(*group_node.field(i));
+    }
+    return num_leaves;
+}
+
 ChunkWriter::ChunkWriter(::parquet::RowGroupWriter* rg_writer, std::vector<TypeDescriptor> type_descs,
                          std::shared_ptr<::parquet::schema::GroupNode> schema,
                          std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> eval_func, std::string timezone,
-                         bool use_legacy_decimal_encoding, bool use_int96_timestamp_encoding)
+                         bool use_legacy_decimal_encoding, bool use_int96_timestamp_encoding,
+                         ThreadPool* encode_pool)
         : _rg_writer(rg_writer),
           _type_descs(std::move(type_descs)),
           _schema(std::move(schema)),
           _eval_func(std::move(eval_func)),
           _timezone(std::move(timezone)),
           _use_legacy_decimal_encoding(use_legacy_decimal_encoding),
-          _use_int96_timestamp_encoding(use_int96_timestamp_encoding) {
+          _use_int96_timestamp_encoding(use_int96_timestamp_encoding),
+          _encode_pool(encode_pool) {
     int num_columns = rg_writer->num_columns();
     _estimated_buffered_bytes.resize(num_columns);
     std::fill(_estimated_buffered_bytes.begin(), _estimated_buffered_bytes.end(), 0);
+
+    _first_leaf_column_idx.resize(_type_descs.size());
+    int leaf_column_idx = 0;
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        _first_leaf_column_idx[i] = leaf_column_idx;
+        leaf_column_idx += num_leaf_columns(*_schema->field(i));
+    }
 }
 
 Status ChunkWriter::write(Chunk* chunk) {
     LevelBuilderContext ctx(chunk->num_rows());
 
-    // Writes out all leaf parquet columns to the RowGroupWriter. Each leaf column is written fully before
-    // the next column is written. Columns are written in DFS order.
-    int leaf_column_idx = 0;
+    if (_encode_pool == nullptr || _type_descs.size() < 2) {
+        // Writes out all leaf parquet columns to the RowGroupWriter. Each leaf column is written fully before
+        // the next column is written. Columns are written in DFS order.
+        for (size_t i = 0; i < _type_descs.size(); i++) {
+            ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
+            RETURN_IF_ERROR(_write_column(ctx, i, col));
+        }
+        return Status::OK();
+    }
+
+    // The column evaluators are not thread safe, so the columns are evaluated before they are written in parallel.
+    Columns columns;
+    columns.reserve(_type_descs.size());
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
+        columns.emplace_back(std::move(col));
+    }
+    return _write_columns_in_parallel(ctx, columns);
+}
+
+Status ChunkWriter::_write_column(const LevelBuilderContext& ctx, size_t column_idx, const ColumnPtr& col) {
+    int leaf_column_idx = _first_leaf_column_idx[column_idx];
 
     auto write_leaf_column = [&](const LevelBuilderResult& result) {
         auto leaf_column_writer = ColumnChunkWriter(_rg_writer->column(leaf_column_idx));
@@ -59,14 +104,46 @@ Status ChunkWriter::write(Chunk* chunk) {
         ++leaf_column_idx;
     };
 
-    for (size_t i = 0; i < _type_descs.size(); i++) {
-        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
-        auto level_builder = LevelBuilder(_type_descs[i], _schema->field(i), _timezone, _use_legacy_decimal_encoding,
-                                          _use_int96_timestamp_encoding);
-        RETURN_IF_ERROR(level_builder.init());
-        RETURN_IF_ERROR(level_builder.write(ctx, col, write_leaf_column));
+    auto level_builder = LevelBuilder(_type_descs[column_idx], _schema->field(column_idx), _timezone,
+                                      _use_legacy_decimal_encoding, _use_int96_timestamp_encoding);
+    RETURN_IF_ERROR(level_builder.init());
+    return level_builder.write(ctx, col, write_leaf_column);
+}
+
+Status ChunkWriter::_write_columns_in_parallel(const LevelBuilderContext& ctx, const Columns& columns) {
+    std::atomic<size_t> next_column = 0;
+    std::vector<Status> statuses(columns.size());
+    // Each column is written by only one thread, which takes the next column not written yet.
+    auto write_columns = [&]() {
+        for (size_t i = next_column++; i < columns.size(); i = next_column++) {
+            try {
+                statuses[i] = _write_column(ctx, i, columns[i]);
+            } catch (const ::parquet::ParquetException& e) {
+                statuses[i] = Status::IOError(fmt::format("write parquet column error: {}", e.what()));
+            }
+        }
+    };
+
+    // The calling thread writes the columns too, instead of only waiting for the pool.
+    size_t num_tasks = std::min<size_t>(columns.size() - 1, _encode_pool->max_threads());
+    CountDownLatch latch(num_tasks);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    for (size_t i = 0; i < num_tasks; i++) {
+        auto st = _encode_pool->submit_func([&]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            write_columns();
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            latch.count_down();
+        }
     }
+    write_columns();
+    latch.wait();
 
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
     return Status::OK();
 }
 
@@ -52,20 +52,26 @@ class GroupNode;
 } // namespace parquet
 namespace starrocks {
 class Chunk;
+class ThreadPool;
 template <typename T>
 class StatusOr;
 } // namespace starrocks
 
 namespace starrocks::parquet {
 
+class LevelBuilderContext;
+
 // Wraps parquet::RowGroupWriter.
 // Write chunks into buffer. Flush on closing.
+// The leaf columns of a buffered row group are encoded and compressed into their own buffers, so if |encode_pool| is
+// set, the columns of a chunk are encoded in parallel by the pool and the calling thread.
 class ChunkWriter {
 public:
     ChunkWriter(::parquet::RowGroupWriter* rg_writer, std::vector<TypeDescriptor> type_descs,
                 std::shared_ptr<::parquet::schema::GroupNode> schema,
                 std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> eval_func, std::string timezone,
-                bool use_legacy_decimal_encoding = false, bool use_int96_timestamp_encoding = false);
+                bool use_legacy_decimal_encoding = false, bool use_int96_timestamp_encoding = false,
+                ThreadPool* encode_pool = nullptr);
 
     Status write(Chunk* chunk);
 
@@ -74,6 +80,11 @@ public:
     int64_t estimated_buffered_bytes() const;
 
 private:
+    // Writes the column |column_idx| of the schema, whose leaf columns start from |_first_leaf_column_idx|.
+    Status _write_column(const LevelBuilderContext& ctx, size_t column_idx, const ColumnPtr& col);
+
+    Status _write_columns_in_parallel(const LevelBuilderContext& ctx, const Columns& columns);
+
     ::parquet::RowGroupWriter* _rg_writer;
     std::vector<TypeDescriptor> _type_descs;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
@@ -82,6 +93,8 @@ private:
     std::string _timezone;
     bool _use_legacy_decimal_encoding = false;
     bool _use_int96_timestamp_encoding = false;
+    ThreadPool* _encode_pool = nullptr;
+    std::vector<int> _first_leaf_column_idx;
 };
 
 } // namespace starrocks::parquet
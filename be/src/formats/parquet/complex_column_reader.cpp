@@ -103,6 +103,30 @@ Status ListColumnReader::read_range(const Range<uint64_t>& range, const Filter*
     return Status::OK();
 }
 
+Status ListColumnReader::fill_dst_column(ColumnPtr& dst, ColumnPtr& src) {
+    ArrayColumn* array_column_src = nullptr;
+    ArrayColumn* array_column_dst = nullptr;
+    if (src->is_nullable()) {
+        auto* nullable_column_src = down_cast<NullableColumn*>(src.get());
+        DCHECK(nullable_column_src->mutable_data_column()->is_array());
+        array_column_src = down_cast<ArrayColumn*>(nullable_column_src->mutable_data_column());
+        auto* nullable_column_dst = down_cast<NullableColumn*>(dst.get());
+        DCHECK(nullable_column_dst->mutable_data_column()->is_array());
+        array_column_dst = down_cast<ArrayColumn*>(nullable_column_dst->mutable_data_column());
+        nullable_column_dst->mutable_null_column()->swap_column(*nullable_column_src->mutable_null_column());
+        nullable_column_src->update_has_null();
+        nullable_column_dst->update_has_null();
+    } else {
+        DCHECK(src->is_array());
+        DCHECK(dst->is_array());
+        DCHECK(!_field->is_nullable);
+        array_column_src = down_cast<ArrayColumn*>(src.get());
+        array_column_dst = down_cast<ArrayColumn*>(dst.get());
+    }
+    array_column_dst->offsets_column()->swap_column(*array_column_src->offsets_column());
+    return _element_reader->fill_dst_column(array_column_dst->elements_column(), array_column_src->elements_column());
+}
+
 Status MapColumnReader::read_range(const Range<uint64_t>& range, const Filter* filter, ColumnPtr& dst) {
     NullableColumn* nullable_column = nullptr;
     MapColumn* map_column = nullptr;
@@ -170,6 +194,42 @@ Status MapColumnReader::read_range(const Range<uint64_t>& range, const Filter* f
     return Status::OK();
 }
 
+Status MapColumnReader::fill_dst_column(ColumnPtr& dst, ColumnPtr& src) {
+    MapColumn* map_column_src = nullptr;
+    MapColumn* map_column_dst = nullptr;
+    if (src->is_nullable()) {
+        auto* nullable_column_src = down_cast<NullableColumn*>(src.get());
+        DCHECK(nullable_column_src->mutable_data_column()->is_map());
+        map_column_src = down_cast<MapColumn*>(nullable_column_src->mutable_data_column());
+        auto* nullable_column_dst = down_cast<NullableColumn*>(dst.get());
+        DCHECK(nullable_column_dst->mutable_data_column()->is_map());
+        map_column_dst = down_cast<MapColumn*>(nullable_column_dst->mutable_data_column());
+        nullable_column_dst->mutable_null_column()->swap_column(*nullable_column_src->mutable_null_column());
+        nullable_column_src->update_has_null();
+        nullable_column_dst->update_has_null();
+    } else {
+        DCHECK(src->is_map());
+        DCHECK(dst->is_map());
+        DCHECK(!_field->is_nullable);
+        map_column_src = down_cast<MapColumn*>(src.get());
+        map_column_dst = down_cast<MapColumn*>(dst.get());
+    }
+    map_column_dst->offsets_column()->swap_column(*map_column_src->offsets_column());
+    // The keys or values without reader are filled with the default values, no need to decode them.
+    if (_key_reader != nullptr) {
+        RETURN_IF_ERROR(_key_reader->fill_dst_column(map_column_dst->keys_column(), map_column_src->keys_column()));
+    } else {
+        map_column_dst->keys_column()->swap_column(*map_column_src->keys_column());
+    }
+    if (_value_reader != nullptr) {
+        RETURN_IF_ERROR(
+                _value_reader->fill_dst_column(map_column_dst->values_column(), map_column_src->values_column()));
+    } else {
+        map_column_dst->values_column()->swap_column(*map_column_src->values_column());
+    }
+    return Status::OK();
+}
+
 Status StructColumnReader::read_range(const Range<uint64_t>& range, const Filter* filter, ColumnPtr& dst) {
     NullableColumn* nullable_column = nullptr;
     StructColumn* struct_column = nullptr;
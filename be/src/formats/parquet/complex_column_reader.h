@@ -39,6 +39,12 @@ public:
         _element_reader->set_need_parse_levels(need_parse_levels);
     }
 
+    // The elements of the rows filtered by the predicates of the other columns are decoded as dict codes, and
+    // only the codes of the selected rows are decoded into values in fill_dst_column.
+    void set_can_lazy_decode(bool can_lazy_decode) override { _element_reader->set_can_lazy_decode(can_lazy_decode); }
+
+    Status fill_dst_column(ColumnPtr& dst, ColumnPtr& src) override;
+
     void collect_column_io_range(std::vector<io::SharedBufferedInputStream::IORange>* ranges, int64_t* end_offset,
                                  ColumnIOType type, bool active) override {
         _element_reader->collect_column_io_range(ranges, end_offset, type, active);
@@ -95,6 +101,17 @@ public:
         }
     }
 
+    void set_can_lazy_decode(bool can_lazy_decode) override {
+        if (_key_reader != nullptr) {
+            _key_reader->set_can_lazy_decode(can_lazy_decode);
+        }
+        if (_value_reader != nullptr) {
+            _value_reader->set_can_lazy_decode(can_lazy_decode);
+        }
+    }
+
+    Status fill_dst_column(ColumnPtr& dst, ColumnPtr& src) override;
+
     void collect_column_io_range(std::vector<io::SharedBufferedInputStream::IORange>* ranges, int64_t* end_offset,
                                  ColumnIOType type, bool active) override {
         if (_key_reader != nullptr) {
@@ -0,0 +1,100 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "column/column.h"
+#include "common/status.h"
+#include "formats/parquet/encoding.h"
+#include "gutil/strings/substitute.h"
+#include "util/slice.h"
+
+namespace starrocks::parquet {
+
+// BYTE_STREAM_SPLIT decoder for FLOAT, DOUBLE, INT32 and INT64.
+// The K bytes of every value are scattered into K streams, the i-th stream stores the i-th byte of all the values.
+// More details refer to: https://github.com/apache/parquet-format/blob/master/Encodings.md
+template <typename T>
+class ByteStreamSplitDecoder final : public Decoder {
+public:
+    ByteStreamSplitDecoder() = default;
+    ~ByteStreamSplitDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        if (UNLIKELY(data.size % SIZE_OF_TYPE != 0)) {
+            return Status::Corruption(
+                    strings::Substitute("BYTE_STREAM_SPLIT data size $0 is not a multiple of $1", data.size,
+                                        static_cast<size_t>(SIZE_OF_TYPE)));
+        }
+        _data = data;
+        _num_values = data.size / SIZE_OF_TYPE;
+        _offset = 0;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        if (_offset + count > _num_values) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _num_values));
+        }
+        _buffer.resize(count * SIZE_OF_TYPE);
+        _decode(count, _buffer.data());
+        auto n = dst->append_numbers(_buffer.data(), count * SIZE_OF_TYPE);
+        CHECK_EQ(count, n);
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        if (_offset + values_to_skip > _num_values) {
+            return Status::InternalError(
+                    strings::Substitute("going to skip out-of-bounds data, offset=$0,skip=$1,size=$2", _offset,
+                                        values_to_skip, _num_values));
+        }
+        _offset += values_to_skip;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        if (_offset + count > _num_values) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _num_values));
+        }
+        _decode(count, dst);
+        return Status::OK();
+    }
+
+private:
+    enum { SIZE_OF_TYPE = sizeof(T) };
+
+    // Interleave the streams back into values. The inner loop has a constant trip count,
+    // so the compiler unrolls it and vectorizes the gather of all the streams.
+    void _decode(size_t count, uint8_t* __restrict__ dst) {
+        const auto* __restrict__ src = reinterpret_cast<const uint8_t*>(_data.data) + _offset;
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t b = 0; b < SIZE_OF_TYPE; ++b) {
+                dst[i * SIZE_OF_TYPE + b] = src[b * _num_values + i];
+            }
+        }
+        _offset += count;
+    }
+
+    Slice _data;
+    size_t _num_values = 0;
+    size_t _offset = 0;
+    std::vector<uint8_t> _buffer;
+};
+
+} // namespace starrocks::parquet
@@ -0,0 +1,337 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "column/column.h"
+#include "common/status.h"
+#include "formats/parquet/encoding.h"
+#include "gutil/strings/substitute.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/slice.h"
+
+namespace starrocks::parquet {
+
+// DELTA_BINARY_PACKED decoder for INT32 and INT64.
+// The whole page is decoded in set_data(), because every value depends on all the values before it,
+// the following next_batch()/skip() calls only copy or drop the decoded values.
+// More details refer to: https://github.com/apache/parquet-format/blob/master/Encodings.md
+template <typename T>
+class DeltaBinaryPackedDecoder final : public Decoder {
+public:
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    DeltaBinaryPackedDecoder() = default;
+    ~DeltaBinaryPackedDecoder() override = default;
+
+    // Decode the DELTA_BINARY_PACKED values at the beginning of |data| into |values|,
+    // the number of bytes taken by the values is returned in |num_bytes|.
+    static Status decode(const Slice& data, std::vector<T>* values, size_t* num_bytes) {
+        const auto* begin = reinterpret_cast<const uint8_t*>(data.data);
+        const uint8_t* pos = begin;
+        const uint8_t* end = begin + data.size;
+
+        uint64_t block_size = 0;
+        uint64_t num_miniblocks = 0;
+        uint64_t total_count = 0;
+        uint64_t first_value = 0;
+        if (!_get_uleb128(&pos, end, &block_size) || !_get_uleb128(&pos, end, &num_miniblocks) ||
+            !_get_uleb128(&pos, end, &total_count) || !_get_uleb128(&pos, end, &first_value)) {
+            return Status::Corruption("invalid DELTA_BINARY_PACKED header");
+        }
+        if (block_size == 0 || block_size % 128 != 0 || block_size > kMaxBlockSize || num_miniblocks == 0 ||
+            block_size % num_miniblocks != 0 || (block_size / num_miniblocks) % 32 != 0) {
+            return Status::Corruption(strings::Substitute(
+                    "invalid DELTA_BINARY_PACKED block, block_size=$0,num_miniblocks=$1", block_size, num_miniblocks));
+        }
+        const size_t values_per_miniblock = block_size / num_miniblocks;
+
+        values->clear();
+        if (total_count == 0) {
+            *num_bytes = pos - begin;
+            return Status::OK();
+        }
+        values->reserve(std::min<uint64_t>(total_count, kMaxBlockSize));
+
+        auto last = static_cast<UnsignedT>(_zigzag_decode(first_value));
+        values->push_back(static_cast<T>(last));
+        uint64_t remaining = total_count - 1;
+
+        std::vector<UnsignedT> deltas(values_per_miniblock);
+        std::vector<uint8_t> bit_widths(num_miniblocks);
+        while (remaining > 0) {
+            uint64_t min_delta_zigzag = 0;
+            if (!_get_uleb128(&pos, end, &min_delta_zigzag) || static_cast<uint64_t>(end - pos) < num_miniblocks) {
+                return Status::Corruption("invalid DELTA_BINARY_PACKED block header");
+            }
+            const auto min_delta = static_cast<UnsignedT>(_zigzag_decode(min_delta_zigzag));
+            memcpy(bit_widths.data(), pos, num_miniblocks);
+            pos += num_miniblocks;
+
+            for (size_t i = 0; i < num_miniblocks && remaining > 0; ++i) {
+                const int bit_width = bit_widths[i];
+                if (bit_width > static_cast<int>(sizeof(T) * 8)) {
+                    return Status::Corruption(
+                            strings::Substitute("invalid DELTA_BINARY_PACKED bit width $0", bit_width));
+                }
+                const size_t num_values = std::min<uint64_t>(remaining, values_per_miniblock);
+                // the last miniblock may be not padded, so only unpack the values needed (rounded up to 32 to keep
+                // the unpacking on byte boundaries), then skip the rest of the miniblock.
+                const size_t num_unpack = std::min((num_values + 31) / 32 * 32, values_per_miniblock);
+                const size_t miniblock_bytes =
+                        std::min<size_t>(values_per_miniblock * bit_width / 8, static_cast<size_t>(end - pos));
+                auto [next, num_unpacked] =
+                        BitPackingAdapter::UnpackValues(bit_width, pos, miniblock_bytes, num_unpack, deltas.data());
+                if (UNLIKELY(num_unpacked < static_cast<int64_t>(num_values))) {
+                    return Status::Corruption("DELTA_BINARY_PACKED miniblock is truncated");
+                }
+
+                const size_t base = values->size();
+                values->resize(base + num_values);
+                T* out = values->data() + base;
+                for (size_t j = 0; j < num_values; ++j) {
+                    last += min_delta + deltas[j];
+                    out[j] = static_cast<T>(last);
+                }
+                pos += miniblock_bytes;
+                remaining -= num_values;
+            }
+        }
+        *num_bytes = pos - begin;
+        return Status::OK();
+    }
+
+    Status set_data(const Slice& data) override {
+        _offset = 0;
+        size_t num_bytes = 0;
+        return decode(data, &_values, &num_bytes);
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        if (_offset + count > _values.size()) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _values.size()));
+        }
+        auto n = dst->append_numbers(_values.data() + _offset, count * sizeof(T));
+        CHECK_EQ(count, n);
+        _offset += count;
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        if (_offset + values_to_skip > _values.size()) {
+            return Status::InternalError(
+                    strings::Substitute("going to skip out-of-bounds data, offset=$0,skip=$1,size=$2", _offset,
+                                        values_to_skip, _values.size()));
+        }
+        _offset += values_to_skip;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        if (_offset + count > _values.size()) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, offset=$0,count=$1,size=$2", _offset, count, _values.size()));
+        }
+        memcpy(dst, _values.data() + _offset, count * sizeof(T));
+        _offset += count;
+        return Status::OK();
+    }
+
+private:
+    // Limit the memory allocated from an untrusted header.
+    static constexpr uint64_t kMaxBlockSize = 1 << 16;
+
+    static bool _get_uleb128(const uint8_t** pos, const uint8_t* end, uint64_t* v) {
+        *v = 0;
+        for (int shift = 0; shift < 64 && *pos < end; shift += 7) {
+            uint8_t byte = *(*pos)++;
+            *v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static uint64_t _zigzag_decode(uint64_t v) { return (v >> 1) ^ (~(v & 1) + 1); }
+
+    std::vector<T> _values;
+    size_t _offset = 0;
+};
+
+// DELTA_LENGTH_BYTE_ARRAY decoder: the lengths of all the values are encoded with DELTA_BINARY_PACKED
+// and followed by the concatenated values.
+class DeltaLengthByteArrayDecoder final : public Decoder {
+public:
+    DeltaLengthByteArrayDecoder() = default;
+    ~DeltaLengthByteArrayDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        size_t num_bytes = 0;
+        RETURN_IF_ERROR(DeltaBinaryPackedDecoder<int32_t>::decode(data, &_lengths, &num_bytes));
+        size_t total_length = 0;
+        for (int32_t length : _lengths) {
+            if (UNLIKELY(length < 0)) {
+                return Status::Corruption(strings::Substitute("invalid DELTA_LENGTH_BYTE_ARRAY length $0", length));
+            }
+            total_length += length;
+        }
+        if (UNLIKELY(num_bytes + total_length > data.size)) {
+            return Status::Corruption(
+                    strings::Substitute("DELTA_LENGTH_BYTE_ARRAY data is truncated, need=$0,size=$1",
+                                        num_bytes + total_length, data.size));
+        }
+        _data = Slice(data.data + num_bytes, total_length);
+        _index = 0;
+        _data_offset = 0;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        std::vector<Slice> slices(count);
+        RETURN_IF_ERROR(next_batch(count, reinterpret_cast<uint8_t*>(slices.data())));
+        if (UNLIKELY(!dst->append_strings(slices))) {
+            return Status::InternalError("DeltaLengthByteArrayDecoder append strings to column failed");
+        }
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        if (_index + values_to_skip > _lengths.size()) {
+            return Status::InternalError(
+                    strings::Substitute("going to skip out-of-bounds data, index=$0,skip=$1,size=$2", _index,
+                                        values_to_skip, _lengths.size()));
+        }
+        for (size_t i = 0; i < values_to_skip; ++i) {
+            _data_offset += _lengths[_index++];
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        if (_index + count > _lengths.size()) {
+            return Status::InternalError(strings::Substitute(
+                    "going to read out-of-bounds data, index=$0,count=$1,size=$2", _index, count, _lengths.size()));
+        }
+        auto* slices = reinterpret_cast<Slice*>(dst);
+        for (size_t i = 0; i < count; ++i) {
+            int32_t length = _lengths[_index++];
+            slices[i] = Slice(_data.data + _data_offset, length);
+            _data_offset += length;
+        }
+        return Status::OK();
+    }
+
+    size_t num_values() const { return _lengths.size(); }
+
+private:
+    std::vector<int32_t> _lengths;
+    Slice _data;
+    size_t _index = 0;
+    size_t _data_offset = 0;
+};
+
+// DELTA_BYTE_ARRAY decoder: the length of the prefix shared with the previous value is encoded with
+// DELTA_BINARY_PACKED, and followed by the suffixes encoded with DELTA_LENGTH_BYTE_ARRAY.
+// The whole page is rebuilt in set_data(), because every value depends on the previous one.
+class DeltaByteArrayDecoder final : public Decoder {
+public:
+    DeltaByteArrayDecoder() = default;
+    ~DeltaByteArrayDecoder() override = default;
+
+    Status set_data(const Slice& data) override {
+        size_t num_bytes = 0;
+        RETURN_IF_ERROR(DeltaBinaryPackedDecoder<int32_t>::decode(data, &_prefix_lengths, &num_bytes));
+        RETURN_IF_ERROR(_suffix_decoder.set_data(Slice(data.data + num_bytes, data.size - num_bytes)));
+        const size_t num_values = _prefix_lengths.size();
+        if (UNLIKELY(_suffix_decoder.num_values() != num_values)) {
+            return Status::Corruption(strings::Substitute("DELTA_BYTE_ARRAY has $0 prefixes but $1 suffixes",
+                                                          num_values, _suffix_decoder.num_values()));
+        }
+        std::vector<Slice> suffixes(num_values);
+        RETURN_IF_ERROR(_suffix_decoder.next_batch(num_values, reinterpret_cast<uint8_t*>(suffixes.data())));
+
+        _buffer.clear();
+        _offsets.resize(num_values + 1);
+        _offsets[0] = 0;
+        size_t prev_offset = 0;
+        size_t prev_length = 0;
+        for (size_t i = 0; i < num_values; ++i) {
+            const int32_t prefix_length = _prefix_lengths[i];
+            if (UNLIKELY(prefix_length < 0 || static_cast<size_t>(prefix_length) > prev_length)) {
+                return Status::Corruption(strings::Substitute("invalid DELTA_BYTE_ARRAY prefix length $0, previous=$1",
+                                                              prefix_length, prev_length));
+            }
+            const size_t offset = _buffer.size();
+            _buffer.resize(offset + prefix_length + suffixes[i].size);
+            // the prefix is copied from the previous value, which is before |offset|, so they never overlap
+            memcpy(_buffer.data() + offset, _buffer.data() + prev_offset, prefix_length);
+            memcpy(_buffer.data() + offset + prefix_length, suffixes[i].data, suffixes[i].size);
+            prev_offset = offset;
+            prev_length = prefix_length + suffixes[i].size;
+            _offsets[i + 1] = _buffer.size();
+        }
+        _index = 0;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, ColumnContentType content_type, Column* dst) override {
+        std::vector<Slice> slices(count);
+        RETURN_IF_ERROR(next_batch(count, reinterpret_cast<uint8_t*>(slices.data())));
+        if (UNLIKELY(!dst->append_strings(slices))) {
+            return Status::InternalError("DeltaByteArrayDecoder append strings to column failed");
+        }
+        return Status::OK();
+    }
+
+    Status skip(size_t values_to_skip) override {
+        if (_index + values_to_skip > _prefix_lengths.size()) {
+            return Status::InternalError(
+                    strings::Substitute("going to skip out-of-bounds data, index=$0,skip=$1,size=$2", _index,
+                                        values_to_skip, _prefix_lengths.size()));
+        }
+        _index += values_to_skip;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t count, uint8_t* dst) override {
+        if (_index + count > _prefix_lengths.size()) {
+            return Status::InternalError(
+                    strings::Substitute("going to read out-of-bounds data, index=$0,count=$1,size=$2", _index, count,
+                                        _prefix_lengths.size()));
+        }
+        auto* slices = reinterpret_cast<Slice*>(dst);
+        for (size_t i = 0; i < count; ++i, ++_index) {
+            slices[i] = Slice(_buffer.data() + _offsets[_index], _offsets[_index + 1] - _offsets[_index]);
+        }
+        return Status::OK();
+    }
+
+private:
+    std::vector<int32_t> _prefix_lengths;
+    DeltaLengthByteArrayDecoder _suffix_decoder;
+    // all the values of the page are stored consecutively in |_buffer|
+    std::string _buffer;
+    std::vector<size_t> _offsets;
+    size_t _index = 0;
+};
+
+} // namespace starrocks::parquet
@@ -44,6 +44,8 @@
 #include "exprs/expr_context.h"
 #include "exprs/runtime_filter.h"
 #include "exprs/runtime_filter_bank.h"
+#include "formats/deletion_vector.h"
+#include "formats/file_footer_cache.h"
 #include "formats/parquet/column_converter.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/metadata.h"
@@ -113,13 +115,14 @@ static int64_t _get_row_group_end_offset(const tparquet::RowGroup& row_group) {
 
 FileReader::FileReader(int chunk_size, RandomAccessFile* file, size_t file_size,
                        const DataCacheOptions& datacache_options, io::SharedBufferedInputStream* sb_stream,
-                       const std::set<int64_t>* _need_skip_rowids)
+                       const std::set<int64_t>* _need_skip_rowids, const roaring::Roaring* deletion_vector)
         : _chunk_size(chunk_size),
           _file(file),
           _file_size(file_size),
           _datacache_options(datacache_options),
           _sb_stream(sb_stream),
-          _need_skip_rowids(_need_skip_rowids) {}
+          _need_skip_rowids(_need_skip_rowids),
+          _deletion_vector(deletion_vector) {}
 
 FileReader::~FileReader() = default;
 
@@ -154,6 +157,9 @@ Status FileReader::init(HdfsScannerContext* ctx) {
         _cache = BlockCache::instance();
     }
 #endif
+    if (_cache == nullptr && ctx->use_file_metacache && FileFooterCache::instance()->enabled()) {
+        _footer_cache = FileFooterCache::instance();
+    }
     RETURN_IF_ERROR(_get_footer());
 
     // set existed SlotDescriptor in this parquet file
@@ -255,6 +261,10 @@ Status FileReader::_get_footer() {
         return Status::OK();
     }
 
+    if (_footer_cache != nullptr) {
+        return _get_footer_from_footer_cache();
+    }
+
     if (!_cache) {
         int64_t file_metadata_size = 0;
         return _parse_footer(&_file_metadata, &file_metadata_size);
@@ -299,6 +309,29 @@ Status FileReader::_get_footer() {
     return Status::OK();
 }
 
+Status FileReader::_get_footer_from_footer_cache() {
+    // The parsed metadata depends on the case sensitivity of the column names.
+    std::string key = FileFooterCache::make_key(_scanner_ctx->case_sensitive ? "parquet" : "parquet_ci",
+                                                _file->filename(), _datacache_options.modification_time, _file_size);
+    {
+        SCOPED_RAW_TIMER(&_scanner_ctx->stats->footer_cache_read_ns);
+        _file_metadata = _footer_cache->lookup<FileMetaData>(key);
+    }
+    if (_file_metadata != nullptr) {
+        _scanner_ctx->stats->footer_cache_read_count += 1;
+        return Status::OK();
+    }
+
+    int64_t file_metadata_size = 0;
+    RETURN_IF_ERROR(_parse_footer(&_file_metadata, &file_metadata_size));
+    if (file_metadata_size > 0) {
+        _footer_cache->insert(key, _file_metadata, file_metadata_size);
+        _scanner_ctx->stats->footer_cache_write_bytes += file_metadata_size;
+        _scanner_ctx->stats->footer_cache_write_count += 1;
+    }
+    return Status::OK();
+}
+
 Status FileReader::_build_split_tasks() {
     // dont do split in following cases:
     // 1. this feature is not enabled
@@ -685,8 +718,8 @@ Status FileReader::_init_group_readers() {
                 continue;
             }
 
-            auto row_group_reader =
-                    std::make_shared<GroupReader>(_group_reader_param, i, _need_skip_rowids, row_group_first_row);
+            auto row_group_reader = std::make_shared<GroupReader>(_group_reader_param, i, _need_skip_rowids,
+                                                                  row_group_first_row, _deletion_vector);
             _row_group_readers.emplace_back(row_group_reader);
             int64_t num_rows = _file_metadata->t_metadata().row_groups[i].num_rows;
             // for iceberg v2 pos delete
@@ -695,6 +728,10 @@ Status FileReader::_init_group_readers() {
                 auto end_iter = _need_skip_rowids->upper_bound(row_group_first_row + num_rows - 1);
                 num_rows -= std::distance(start_iter, end_iter);
             }
+            // for paimon deletion vector
+            if (_deletion_vector != nullptr && num_rows > 0 && !_deletion_vector->isEmpty()) {
+                num_rows -= count_deleted_rows(*_deletion_vector, row_group_first_row, row_group_first_row + num_rows);
+            }
             _total_row_count += num_rows;
         } else {
             continue;
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <roaring/roaring.hh>
 #include <set>
 #include <string>
 #include <vector>
@@ -41,6 +42,7 @@ namespace starrocks {
 class RandomAccessFile;
 struct HdfsScannerContext;
 class BlockCache;
+class FileFooterCache;
 class SlotDescriptor;
 
 namespace io {
@@ -68,7 +70,8 @@ public:
     FileReader(int chunk_size, RandomAccessFile* file, size_t file_size,
                const DataCacheOptions& datacache_options = DataCacheOptions(),
                io::SharedBufferedInputStream* sb_stream = nullptr,
-               const std::set<int64_t>* _need_skip_rowids = nullptr);
+               const std::set<int64_t>* _need_skip_rowids = nullptr,
+               const roaring::Roaring* deletion_vector = nullptr);
     ~FileReader();
 
     Status init(HdfsScannerContext* scanner_ctx);
@@ -86,6 +89,7 @@ private:
     Status _get_footer();
 
     std::string _build_metacache_key();
+    Status _get_footer_from_footer_cache();
 
     std::shared_ptr<MetaHelper> _build_meta_helper();
 
@@ -148,6 +152,8 @@ private:
     bool _no_materialized_column_scan = false;
 
     BlockCache* _cache = nullptr;
+    // The BE-wide cache of the parsed footers, used when the footers are not cached by the datacache.
+    FileFooterCache* _footer_cache = nullptr;
     FileMetaDataPtr _file_metadata = nullptr;
 
     // not exist column conjuncts eval false, file can be skipped
@@ -157,6 +163,7 @@ private:
     GroupReaderParam _group_reader_param;
     std::shared_ptr<MetaHelper> _meta_helper = nullptr;
     const std::set<int64_t>* _need_skip_rowids;
+    const roaring::Roaring* _deletion_vector;
 };
 
 } // namespace starrocks::parquet
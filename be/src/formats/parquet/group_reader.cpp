@@ -43,8 +43,11 @@
 namespace starrocks::parquet {
 
 GroupReader::GroupReader(GroupReaderParam& param, int row_group_number, const std::set<int64_t>* need_skip_rowids,
-                         int64_t row_group_first_row)
-        : _row_group_first_row(row_group_first_row), _need_skip_rowids(need_skip_rowids), _param(param) {
+                         int64_t row_group_first_row, const roaring::Roaring* deletion_vector)
+        : _row_group_first_row(row_group_first_row),
+          _need_skip_rowids(need_skip_rowids),
+          _deletion_vector(deletion_vector),
+          _param(param) {
     _row_group_metadata = &_param.file_metadata->t_metadata().row_groups[row_group_number];
 }
 
@@ -67,6 +70,14 @@ Status GroupReader::_deal_with_pageindex() {
         ASSIGN_OR_RETURN(bool flag, page_index_reader->generate_read_range(_range));
         if (flag && !_is_group_filtered) {
             page_index_reader->select_column_offset_index();
+        } else if (!_is_group_filtered) {
+            // No page is filtered by the page index, but the rows selected by the predicates of active columns
+            // can still be sparse. With the offset index, the lazy columns seek to the pages of the selected rows
+            // directly, instead of reading the headers of all the pages before them.
+            for (int idx : _lazy_column_indices) {
+                SlotId slot_id = _param.read_cols[idx].slot_id();
+                _column_readers[slot_id]->select_offset_index(_range, _row_group_first_row);
+            }
         }
     }
 
@@ -148,6 +159,15 @@ Status GroupReader::get_next(ChunkPtr* chunk, size_t* row_count) {
                 }
             }
         }
+        if (_deletion_vector != nullptr && !_deletion_vector->isEmpty()) {
+            SCOPED_RAW_TIMER(&_param.stats->iceberg_delete_file_build_filter_ns);
+            if (apply_deletion_vector(*_deletion_vector, r.begin(), r.end(), chunk_filter.data())) {
+                has_filter = true;
+                if (SIMD::count_nonzero(chunk_filter.data(), count) == 0) {
+                    continue;
+                }
+            }
+        }
 
         // we really have predicate to run round by round
         if (!_dict_column_indices.empty() || !_left_no_dict_filter_conjuncts_by_slot.empty()) {
@@ -32,6 +32,7 @@
 #include "common/status.h"
 #include "common/statusor.h"
 #include "exprs/expr_context.h"
+#include "formats/deletion_vector.h"
 #include "formats/parquet/column_read_order_ctx.h"
 #include "formats/parquet/column_reader.h"
 #include "formats/parquet/metadata.h"
@@ -110,7 +111,7 @@ class GroupReader {
 
 public:
     GroupReader(GroupReaderParam& param, int row_group_number, const std::set<int64_t>* need_skip_rowids,
-                int64_t row_group_first_row);
+                int64_t row_group_first_row, const roaring::Roaring* deletion_vector = nullptr);
     ~GroupReader() = default;
 
     // init used to init column reader, and devide active/lazy
@@ -156,6 +157,8 @@ private:
     const tparquet::RowGroup* _row_group_metadata = nullptr;
     int64_t _row_group_first_row = 0;
     const std::set<int64_t>* _need_skip_rowids;
+    // The deleted rows of the file, which are skipped as well as the ones of _need_skip_rowids.
+    const roaring::Roaring* _deletion_vector;
     int64_t _raw_rows_read = 0;
 
     // column readers for column chunk in row group
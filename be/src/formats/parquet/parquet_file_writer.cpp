@@ -24,11 +24,15 @@
 #include <parquet/statistics.h>
 #include <runtime/current_thread.h>
 
+#include <algorithm>
 #include <future>
 #include <ostream>
 #include <utility>
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
+#include "exec/sorting/sort_permute.h"
+#include "exec/sorting/sorting.h"
 #include "formats/file_writer.h"
 #include "formats/parquet/arrow_memory_pool.h"
 #include "formats/parquet/chunk_writer.h"
@@ -36,6 +40,7 @@
 #include "formats/parquet/utils.h"
 #include "formats/utils.h"
 #include "fs/fs.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "types/logical_type.h"
 #include "util/debug_util.h"
@@ -48,10 +53,26 @@ class Chunk;
 namespace starrocks::formats {
 
 Status ParquetFileWriter::write(Chunk* chunk) {
+    if (_writer_options->sort_columns.empty()) {
+        return _write_chunk(chunk);
+    }
+
+    if (_unsorted_chunk == nullptr) {
+        _unsorted_chunk = chunk->clone_empty_with_slot();
+    }
+    _unsorted_chunk->append(*chunk);
+    if (_unsorted_chunk->bytes_usage() >= _writer_options->rowgroup_size) {
+        return _flush_sorted_row_group();
+    }
+    return Status::OK();
+}
+
+Status ParquetFileWriter::_write_chunk(Chunk* chunk) {
     if (_rowgroup_writer == nullptr) {
         _rowgroup_writer = std::make_unique<parquet::ChunkWriter>(
                 _writer->AppendBufferedRowGroup(), _type_descs, _schema, _eval_func, _writer_options->time_zone,
-                _writer_options->use_legacy_decimal_encoding, _writer_options->use_int96_timestamp_encoding);
+                _writer_options->use_legacy_decimal_encoding, _writer_options->use_int96_timestamp_encoding,
+                _writer_options->encode_pool);
     }
 
     RETURN_IF_ERROR(_rowgroup_writer->write(chunk));
@@ -63,9 +84,48 @@ Status ParquetFileWriter::write(Chunk* chunk) {
     return Status::OK();
 }
 
+Status ParquetFileWriter::_flush_sorted_row_group() {
+    if (_unsorted_chunk == nullptr || _unsorted_chunk->is_empty()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_unsorted_chunk->upgrade_if_overflow());
+
+    Columns sort_keys;
+    std::vector<bool> is_asc;
+    std::vector<bool> nulls_first;
+    for (const auto& sort_column : _writer_options->sort_columns) {
+        ASSIGN_OR_RETURN(auto key, _eval_func(_unsorted_chunk.get(), sort_column.column_index));
+        sort_keys.emplace_back(std::move(key));
+        is_asc.push_back(sort_column.is_asc);
+        nulls_first.push_back(sort_column.nulls_first);
+    }
+    Permutation perm;
+    RETURN_IF_ERROR(sort_and_tie_columns(false, sort_keys, SortDescs(is_asc, nulls_first), &perm));
+    sort_keys.clear();
+
+    // Write the sorted rows in small chunks, to bound the memory of the evaluated columns.
+    std::vector<ChunkPtr> unsorted_chunks{std::move(_unsorted_chunk)};
+    _unsorted_chunk = nullptr;
+    const size_t batch_size = config::vector_chunk_size;
+    for (size_t offset = 0; offset < perm.size(); offset += batch_size) {
+        size_t num_rows = std::min(batch_size, perm.size() - offset);
+        auto sorted_chunk = unsorted_chunks[0]->clone_empty_with_slot(num_rows);
+        PermutationView batch_perm(perm.data() + offset, num_rows);
+        materialize_by_permutation(sorted_chunk.get(), unsorted_chunks, batch_perm);
+        RETURN_IF_ERROR(_write_chunk(sorted_chunk.get()));
+    }
+    if (_rowgroup_writer != nullptr) {
+        return _flush_row_group();
+    }
+    return Status::OK();
+}
+
 FileWriter::CommitResult ParquetFileWriter::commit() {
     FileWriter::CommitResult result{
             .io_status = Status::OK(), .format = PARQUET, .location = _location, .rollback_action = _rollback_action};
+    if (auto status = _flush_sorted_row_group(); !status.ok()) {
+        result.io_status.update(status);
+    }
     try {
         _writer->Close();
     } catch (const ::parquet::ParquetStatusException& e) {
@@ -90,11 +150,18 @@ int64_t ParquetFileWriter::get_written_bytes() {
     if (_rowgroup_writer != nullptr) {
         n += _rowgroup_writer->estimated_buffered_bytes();
     }
+    if (_unsorted_chunk != nullptr) {
+        n += _unsorted_chunk->bytes_usage();
+    }
     return n;
 }
 
 int64_t ParquetFileWriter::get_allocated_bytes() {
-    return _memory_pool.bytes_allocated();
+    int64_t bytes = _memory_pool.bytes_allocated();
+    if (_unsorted_chunk != nullptr) {
+        bytes += _unsorted_chunk->memory_usage();
+    }
+    return bytes;
 }
 
 Status ParquetFileWriter::_flush_row_group() {
@@ -452,7 +519,8 @@ ParquetFileWriterFactory::ParquetFileWriterFactory(std::shared_ptr<FileSystem> f
                                                    std::vector<std::string> column_names,
                                                    std::vector<std::unique_ptr<ColumnEvaluator>>&& column_evaluators,
                                                    std::optional<std::vector<formats::FileColumnId>> field_ids,
-                                                   PriorityThreadPool* executors, RuntimeState* runtime_state)
+                                                   PriorityThreadPool* executors, RuntimeState* runtime_state,
+                                                   std::vector<ParquetSortColumn> sort_columns)
         : _fs(std::move(fs)),
           _compression_type(compression_type),
           _field_ids(std::move(field_ids)),
@@ -460,7 +528,8 @@ ParquetFileWriterFactory::ParquetFileWriterFactory(std::shared_ptr<FileSystem> f
           _column_names(std::move(column_names)),
           _column_evaluators(std::move(column_evaluators)),
           _executors(executors),
-          _runtime_state(runtime_state) {}
+          _runtime_state(runtime_state),
+          _sort_columns(std::move(sort_columns)) {}
 
 Status ParquetFileWriterFactory::init() {
     RETURN_IF_ERROR(ColumnEvaluator::init(_column_evaluators));
@@ -477,6 +546,8 @@ Status ParquetFileWriterFactory::init() {
 #ifndef BE_TEST
     _parsed_options->time_zone = _runtime_state->timezone();
 #endif
+    _parsed_options->encode_pool = ExecEnv::GetInstance()->parquet_writer_encode_pool();
+    _parsed_options->sort_columns = _sort_columns;
     return Status::OK();
 }
 
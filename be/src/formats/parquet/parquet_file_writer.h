@@ -72,6 +72,7 @@ class Chunk;
 class FileSystem;
 class PriorityThreadPool;
 class RuntimeState;
+class ThreadPool;
 
 namespace parquet {
 class ChunkWriter;
@@ -86,6 +87,13 @@ struct FileColumnId {
     std::vector<FileColumnId> children;
 };
 
+// A column by which the rows of each row group are sorted before they are written.
+struct ParquetSortColumn {
+    int32_t column_index = 0;
+    bool is_asc = true;
+    bool nulls_first = true;
+};
+
 struct ParquetWriterOptions : FileWriterOptions {
     int64_t dictionary_pagesize = 1024 * 1024; // 1MB
     int64_t page_size = 1024 * 1024;           // 1MB
@@ -95,6 +103,11 @@ struct ParquetWriterOptions : FileWriterOptions {
     std::string time_zone = TimezoneUtils::default_time_zone;
     bool use_legacy_decimal_encoding = false;
     bool use_int96_timestamp_encoding = false;
+    // The pool encoding the columns of the row groups in parallel, null to encode them serially.
+    ThreadPool* encode_pool = nullptr;
+    // The rows of each row group are sorted by these columns, so that the statistics of the pages and the row groups
+    // are selective for the readers. Empty to write the rows in their arrival order.
+    std::vector<ParquetSortColumn> sort_columns;
 
     inline static std::string USE_LEGACY_DECIMAL_ENCODING = "use_legacy_decimal_encoding";
     inline static std::string USE_INT96_TIMESTAMP_ENCODING = "use_int96_timestamp_encoding";
@@ -136,6 +149,11 @@ private:
 
     Status _flush_row_group();
 
+    Status _write_chunk(Chunk* chunk);
+
+    // Sorts the rows buffered for the current row group by the sort columns, writes and flushes them.
+    Status _flush_sorted_row_group();
+
     std::shared_ptr<::parquet::WriterProperties> _properties;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
 
@@ -152,6 +170,9 @@ private:
     std::shared_ptr<::parquet::ParquetFileWriter> _writer;
     std::shared_ptr<parquet::ChunkWriter> _rowgroup_writer;
     const std::function<void()> _rollback_action;
+
+    // The rows of the current row group, buffered until it is full if the rows are sorted.
+    ChunkPtr _unsorted_chunk;
 };
 
 class ParquetFileWriterFactory : public FileWriterFactory {
@@ -160,7 +181,7 @@ public:
                              std::map<std::string, std::string> options, std::vector<std::string> column_names,
                              std::vector<std::unique_ptr<ColumnEvaluator>>&& column_evaluators,
                              std::optional<std::vector<formats::FileColumnId>> field_ids, PriorityThreadPool* executors,
-                             RuntimeState* runtime_state);
+                             RuntimeState* runtime_state, std::vector<ParquetSortColumn> sort_columns = {});
 
     Status init() override;
 
@@ -177,6 +198,7 @@ private:
     std::vector<std::unique_ptr<ColumnEvaluator>> _column_evaluators;
     PriorityThreadPool* _executors = nullptr;
     RuntimeState* _runtime_state = nullptr;
+    std::vector<ParquetSortColumn> _sort_columns;
 };
 
 } // namespace starrocks::formats
@@ -333,6 +333,9 @@ struct WritableFileOptions {
     bool skip_fill_local_cache = false;
 
     bool direct_write = false;
+    // For object storage, the number of multipart upload parts uploaded in the background while writing,
+    // 1 means uploading each part synchronously.
+    int64_t max_inflight_upload_parts = 1;
 
     // See OpenMode for details.
     FileSystem::OpenMode mode = FileSystem::MUST_CREATE;
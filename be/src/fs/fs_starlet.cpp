@@ -32,12 +32,14 @@
 #include "fs/output_stream_adapter.h"
 #include "gutil/strings/util.h"
 #include "io/input_stream.h"
+#include "io/io_latency_metrics.h"
 #include "io/output_stream.h"
 #include "io/seekable_input_stream.h"
 #include "io/throttled_output_stream.h"
 #include "io/throttled_seekable_input_stream.h"
 #include "service/staros_worker.h"
 #include "storage/olap_common.h"
+#include "util/stopwatch.hpp"
 #include "util/string_parser.hpp"
 
 namespace starrocks {
@@ -143,8 +145,16 @@ public:
         if (!stream_st.ok()) {
             return to_status(stream_st.status());
         }
+        // The starlet stream reads from its local cache or from the remote storage.
+        int64_t bytes_read_remote = (*stream_st)->get_io_stats().bytes_read_remote;
+        MonotonicStopWatch watch;
+        watch.start();
         auto res = (*stream_st)->read(data, count);
         if (res.ok()) {
+            IOLatencyMetrics::record((*stream_st)->get_io_stats().bytes_read_remote > bytes_read_remote
+                                             ? IOSource::REMOTE_STORAGE
+                                             : IOSource::BLOCK_CACHE_DISK,
+                                     watch.elapsed_time());
             g_starlet_io_num_reads << 1;
             g_starlet_io_read << *res;
             return *res;
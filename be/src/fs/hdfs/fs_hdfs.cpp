@@ -24,6 +24,7 @@
 #include "fs/fs_util.h"
 #include "fs/hdfs/hdfs_fs_cache.h"
 #include "gutil/strings/substitute.h"
+#include "io/io_latency_metrics.h"
 #include "runtime/file_result_writer.h"
 #include "service/backend_options.h"
 #include "testutil/sync_point.h"
@@ -211,6 +212,7 @@ StatusOr<int64_t> HdfsInputStream::read(void* data, int64_t size) {
     if (UNLIKELY(size > std::numeric_limits<tSize>::max())) {
         size = std::numeric_limits<tSize>::max();
     }
+    ScopedIOLatencyTimer timer(IOSource::REMOTE_STORAGE);
     return _handle->pread(static_cast<uint8_t*>(data), size, config::hdfs_client_io_read_retry);
     // return _handle->read(static_cast<uint8_t*>(data), size, config::hdfs_client_io_read_retry);
 }
@@ -23,6 +23,8 @@
 
 #include "block_cache/block_cache.h"
 #include "block_cache/block_cache_hit_rate_counter.hpp"
+#include "block_cache/block_cache_warmer.h"
+#include "common/config.h"
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
@@ -34,6 +36,10 @@ const static std::string HEADER_JSON = "application/json";
 const static std::string ACTION_KEY = "action";
 const static std::string ACTION_STAT = "stat";
 const static std::string ACTION_APP_STAT = "app_stat";
+const static std::string ACTION_WARMUP = "warmup";
+const static std::string ACTION_WARMUP_STAT = "warmup_stat";
+const static std::string PARAM_TOP_K = "top_k";
+const static std::string PARAM_RATE_LIMIT_BYTES = "rate_limit_bytes";
 
 std::string cache_status_str(const DataCacheStatus& status) {
     std::string str_status;
@@ -55,11 +61,14 @@ std::string cache_status_str(const DataCacheStatus& status) {
 }
 
 bool DataCacheAction::_check_request(HttpRequest* req) {
-    if (req->method() != HttpMethod::GET) {
+    const auto& action = req->param(ACTION_KEY);
+    // Starting a warmup job changes the node state, so it is only allowed by POST.
+    if (req->method() != (action == ACTION_WARMUP ? HttpMethod::POST : HttpMethod::GET)) {
         HttpChannel::send_reply(req, HttpStatus::METHOD_NOT_ALLOWED, "Method Not Allowed");
         return false;
     }
-    if (req->param(ACTION_KEY) != ACTION_STAT && req->param(ACTION_KEY) != ACTION_APP_STAT) {
+    if (action != ACTION_STAT && action != ACTION_APP_STAT && action != ACTION_WARMUP &&
+        action != ACTION_WARMUP_STAT) {
         HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, "Not Found");
         return false;
     }
@@ -78,6 +87,10 @@ void DataCacheAction::handle(HttpRequest* req) {
         _handle_error(req, strings::Substitute("No more metrics for current cache engine type"));
     } else if (req->param(ACTION_KEY) == ACTION_STAT) {
         _handle_stat(req, block_cache);
+    } else if (req->param(ACTION_KEY) == ACTION_WARMUP) {
+        _handle_warmup(req);
+    } else if (req->param(ACTION_KEY) == ACTION_WARMUP_STAT) {
+        _handle_warmup_stat(req);
     } else {
         _handle_app_stat(req);
     }
@@ -193,6 +206,52 @@ void DataCacheAction::_handle_app_stat(HttpRequest* req) {
     });
 }
 
+void DataCacheAction::_handle_warmup(HttpRequest* req) {
+    int64_t top_k = config::datacache_warmup_top_k;
+    int64_t rate_limit_bytes = config::datacache_warmup_rate_limit_bytes;
+    try {
+        if (!req->param(PARAM_TOP_K).empty()) {
+            top_k = std::stoll(req->param(PARAM_TOP_K));
+        }
+        if (!req->param(PARAM_RATE_LIMIT_BYTES).empty()) {
+            rate_limit_bytes = std::stoll(req->param(PARAM_RATE_LIMIT_BYTES));
+        }
+    } catch (const std::exception& e) {
+        _handle_error(req, strings::Substitute("Invalid warmup parameter: $0", e.what()));
+        return;
+    }
+    if (top_k <= 0 || rate_limit_bytes < 0) {
+        _handle_error(req, "Invalid warmup parameter: top_k must be positive and rate_limit_bytes non-negative");
+        return;
+    }
+    Status st = BlockCacheWarmer::instance()->start_warmup(top_k, rate_limit_bytes);
+    if (!st.ok()) {
+        _handle_error(req, st.to_string());
+        return;
+    }
+    _handle_warmup_stat(req);
+}
+
+void DataCacheAction::_handle_warmup_stat(HttpRequest* req) {
+    _handle(req, [=](rapidjson::Document& root) {
+        auto& allocator = root.GetAllocator();
+        auto* warmer = BlockCacheWarmer::instance();
+        auto progress = warmer->progress();
+        std::string state = BlockCacheWarmer::state_name(progress.state);
+
+        rapidjson::Value state_value;
+        state_value.SetString(state.c_str(), state.length(), allocator);
+        root.AddMember("state", state_value, allocator);
+        root.AddMember("history_blocks", rapidjson::Value(warmer->history_size()), allocator);
+        root.AddMember("total_blocks", rapidjson::Value(progress.total_blocks), allocator);
+        root.AddMember("finished_blocks", rapidjson::Value(progress.finished_blocks), allocator);
+        root.AddMember("skipped_blocks", rapidjson::Value(progress.skipped_blocks), allocator);
+        root.AddMember("failed_blocks", rapidjson::Value(progress.failed_blocks), allocator);
+        root.AddMember("warmed_bytes", rapidjson::Value(progress.warmed_bytes), allocator);
+        root.AddMember("elapsed_ms", rapidjson::Value(progress.elapsed_ms), allocator);
+    });
+}
+
 void DataCacheAction::_handle_error(HttpRequest* req, const std::string& err_msg) {
     _handle(req, [err_msg](rapidjson::Document& root) {
         auto& allocator = root.GetAllocator();
@@ -41,6 +41,8 @@ private:
     void _handle(HttpRequest* req, const std::function<void(rapidjson::Document& root)>& func);
     void _handle_stat(HttpRequest* req, BlockCache* cache);
     void _handle_app_stat(HttpRequest* req);
+    void _handle_warmup(HttpRequest* req);
+    void _handle_warmup_stat(HttpRequest* req);
     void _handle_error(HttpRequest* req, const std::string& error_msg);
 
     ExecEnv* _exec_env;
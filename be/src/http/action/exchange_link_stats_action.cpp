@@ -0,0 +1,108 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "http/action/exchange_link_stats_action.h"
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+
+#include "common/logging.h"
+#include "exec/pipeline/exchange/exchange_link_stats.h"
+#include "gutil/strings/substitute.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+
+namespace starrocks {
+
+const static std::string HEADER_JSON = "application/json";
+const static std::string ACTION_KEY = "action";
+const static std::string ACTION_STAT = "stat";
+const static std::string ACTION_RESET = "reset";
+
+void ExchangeLinkStatsAction::handle(HttpRequest* req) {
+    VLOG_ROW << req->debug_string();
+    const auto& action = req->param(ACTION_KEY);
+    if (req->method() == HttpMethod::GET && action == ACTION_STAT) {
+        _handle_stat(req);
+    } else if (req->method() == HttpMethod::POST && action == ACTION_RESET) {
+        _handle_reset(req);
+    } else {
+        _handle_error(req,
+                      strings::Substitute("Not support $0 method: '$1'", to_method_desc(req->method()), req->uri()));
+    }
+}
+
+void ExchangeLinkStatsAction::_handle(HttpRequest* req, const std::function<void(rapidjson::Document&)>& func) {
+    rapidjson::Document root;
+    root.SetObject();
+    func(root);
+    rapidjson::StringBuffer strbuf;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+    root.Accept(writer);
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, strbuf.GetString());
+}
+
+void ExchangeLinkStatsAction::_handle_stat(HttpRequest* req) {
+    using ExchangeLinkStats = pipeline::ExchangeLinkStats;
+    _handle(req, [](rapidjson::Document& root) {
+        auto& allocator = root.GetAllocator();
+        rapidjson::Value links_obj(rapidjson::kArrayType);
+        for (const auto& link : ExchangeLinkStats::instance()->snapshot()) {
+            rapidjson::Value link_obj(rapidjson::kObjectType);
+            link_obj.AddMember("address", rapidjson::Value(link.address.c_str(), allocator), allocator);
+            link_obj.AddMember("rpc_count", rapidjson::Value(link.rpc_count), allocator);
+            link_obj.AddMember("failed_rpc_count", rapidjson::Value(link.failed_rpc_count), allocator);
+            link_obj.AddMember("bytes_sent", rapidjson::Value(link.bytes_sent), allocator);
+            link_obj.AddMember("raw_bytes_sent", rapidjson::Value(link.raw_bytes_sent), allocator);
+            int64_t avg_rtt_us = link.rtt_ns / std::max<int64_t>(link.rpc_count, 1) / 1000;
+            link_obj.AddMember("avg_rtt_us", rapidjson::Value(avg_rtt_us), allocator);
+            link_obj.AddMember("max_rtt_us", rapidjson::Value(link.max_rtt_ns / 1000), allocator);
+            link_obj.AddMember("queue_wait_us", rapidjson::Value(link.queue_wait_ns / 1000), allocator);
+
+            rapidjson::Value histogram_obj(rapidjson::kArrayType);
+            for (size_t i = 0; i < ExchangeLinkStats::kNumRttBuckets; ++i) {
+                rapidjson::Value bucket_obj(rapidjson::kObjectType);
+                // The upper bound of the bucket, -1 means unbounded.
+                int64_t le = i + 1 == ExchangeLinkStats::kNumRttBuckets ? -1 : (int64_t(1) << i);
+                bucket_obj.AddMember("le", rapidjson::Value(le), allocator);
+                bucket_obj.AddMember("count", rapidjson::Value(link.rtt_histogram[i]), allocator);
+                histogram_obj.PushBack(bucket_obj, allocator);
+            }
+            link_obj.AddMember("rtt_histogram_ms", histogram_obj, allocator);
+            links_obj.PushBack(link_obj, allocator);
+        }
+        root.AddMember("links", links_obj, allocator);
+    });
+}
+
+void ExchangeLinkStatsAction::_handle_reset(HttpRequest* req) {
+    pipeline::ExchangeLinkStats::instance()->reset();
+    _handle(req, [](rapidjson::Document& root) {
+        root.AddMember("status", rapidjson::Value("OK"), root.GetAllocator());
+    });
+}
+
+void ExchangeLinkStatsAction::_handle_error(HttpRequest* req, const std::string& err_msg) {
+    _handle(req, [err_msg](rapidjson::Document& root) {
+        auto& allocator = root.GetAllocator();
+        root.AddMember("error", rapidjson::Value(err_msg.c_str(), err_msg.size()), allocator);
+    });
+}
+
+} // namespace starrocks
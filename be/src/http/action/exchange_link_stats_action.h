@@ -0,0 +1,56 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <rapidjson/document.h>
+
+#include <functional>
+#include <string>
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+// Exposes the transmit chunk rpcs sent by this BE per destination.
+// GET /api/exchange_link_stats/stat returns the stats, POST /api/exchange_link_stats/reset zeroes them.
+class ExchangeLinkStatsAction : public HttpHandler {
+public:
+    ExchangeLinkStatsAction() = default;
+    ~ExchangeLinkStatsAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    void _handle(HttpRequest* req, const std::function<void(rapidjson::Document& root)>& func);
+    // Returns the stats with the following format:
+    // {
+    //      "links": [{
+    //          "address": "host:port",
+    //          "rpc_count": "int",
+    //          "failed_rpc_count": "int",
+    //          "bytes_sent": "int",
+    //          "raw_bytes_sent": "int",
+    //          "avg_rtt_us": "int",
+    //          "max_rtt_us": "int",
+    //          "queue_wait_us": "int",
+    //          "rtt_histogram_ms": [{"le": "int", "count": "int"}]
+    //      }]
+    // }
+    void _handle_stat(HttpRequest* req);
+    void _handle_reset(HttpRequest* req);
+    void _handle_error(HttpRequest* req, const std::string& error_msg);
+};
+
+} // namespace starrocks
@@ -0,0 +1,42 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "http/action/pipeline_driver_timeline_action.h"
+
+#include <string>
+#include <string_view>
+
+#include "exec/pipeline/driver_timeline.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+void PipelineDriverTimelineAction::handle(HttpRequest* req) {
+    const std::string& query_id_str = req->param("query_id");
+    auto pos = query_id_str.find('-');
+    if (pos == std::string::npos) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "Invalid query_id: " + query_id_str);
+        return;
+    }
+    UniqueId query_id(std::string_view(query_id_str).substr(0, pos), std::string_view(query_id_str).substr(pos + 1));
+    std::string trace = pipeline::DriverTimeline::instance()->to_chrome_trace(query_id.to_thrift());
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    HttpChannel::send_reply(req, HttpStatus::OK, trace);
+}
+
+} // namespace starrocks
@@ -0,0 +1,32 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+// Exports the state transitions of the drivers of a query recorded by pipeline::DriverTimeline in the Chrome trace
+// format, which can be opened by chrome://tracing or https://ui.perfetto.dev.
+// GET /api/pipeline_driver_timeline?query_id=<hi>-<lo>
+class PipelineDriverTimelineAction : public HttpHandler {
+public:
+    PipelineDriverTimelineAction() = default;
+    ~PipelineDriverTimelineAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace starrocks
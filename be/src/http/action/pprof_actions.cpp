@@ -41,6 +41,7 @@
 #include <mutex>
 
 #include "common/config.h"
+#include "common/prof/cpu_sampler.h"
 #include "common/prof/heap_prof.h"
 #include "common/status.h"
 #include "common/tracer.h"
@@ -48,6 +49,7 @@
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
+#include "http/http_status.h"
 #include "io/io_profiler.h"
 #include "util/bfd_parser.h"
 
@@ -112,9 +114,12 @@ void ProfileAction::handle(HttpRequest* req) {
     std::ostringstream tmp_prof_file_name;
     // Build a temporary file name that is hopefully unique.
     tmp_prof_file_name << config::pprof_profile_dir << "/starrocks_profile." << getpid() << "." << rand();
+    // Both of gperftools and the cpu sampler rely on SIGPROF.
+    CpuSampler::getInstance().pause();
     ProfilerStart(tmp_prof_file_name.str().c_str());
     sleep(seconds);
     ProfilerStop();
+    CpuSampler::getInstance().resume();
     std::ifstream prof_file(tmp_prof_file_name.str().c_str(), std::ios::in);
     std::stringstream ss;
     if (!prof_file.is_open()) {
@@ -131,6 +136,34 @@ void ProfileAction::handle(HttpRequest* req) {
 #endif
 }
 
+void CpuSamplesAction::handle(HttpRequest* req) {
+    if (CpuSampler::getInstance().frequency() == 0) {
+        HttpChannel::send_reply(req, HttpStatus::SERVICE_UNAVAILABLE,
+                                "The cpu sampler is disabled, set cpu_sampler_frequency to enable it");
+        return;
+    }
+    CpuSampler::Filter filter;
+    const std::string& seconds_str = req->param(SECOND_KEY);
+    if (!seconds_str.empty()) {
+        filter.seconds = std::atoi(seconds_str.c_str());
+    }
+    const std::string& query_id_str = req->param("query_id");
+    if (!query_id_str.empty()) {
+        auto pos = query_id_str.find('-');
+        if (pos == std::string::npos) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "Invalid query_id: " + query_id_str);
+            return;
+        }
+        filter.query_id = UniqueId(std::string_view(query_id_str).substr(0, pos),
+                                   std::string_view(query_id_str).substr(pos + 1));
+    }
+    const std::string& workgroup_id_str = req->param("workgroup_id");
+    if (!workgroup_id_str.empty()) {
+        filter.workgroup_id = std::atoll(workgroup_id_str.c_str());
+    }
+    HttpChannel::send_reply(req, CpuSampler::getInstance().dump_folded(filter));
+}
+
 static std::mutex kIOPprofActionMutex;
 
 void IOProfileAction::handle(HttpRequest* req) {
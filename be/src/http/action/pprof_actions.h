@@ -64,6 +64,16 @@ public:
     void handle(HttpRequest* req) override;
 };
 
+// Exports the samples of the continuous cpu sampler in the folded format, see common/prof/cpu_sampler.h.
+// Parameters: seconds, query_id and workgroup_id to filter the samples.
+class CpuSamplesAction : public HttpHandler {
+public:
+    CpuSamplesAction() = default;
+    ~CpuSamplesAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
 class IOProfileAction : public HttpHandler {
 public:
     IOProfileAction() = default;
@@ -169,9 +169,11 @@ void TransactionStreamLoadAction::handle(HttpRequest* req) {
     }
 
     // Append buffer to the pipe on every http request finishing.
-    // For CSV, it supports parsing in stream.
+    // For CSV, it supports parsing in stream, so the data of small requests is batched in the buffer until
+    // it's full or the transaction commits, rather than pushing a tiny buffer into the pipe per request.
     // For JSON, now the buffer contains a complete json.
-    if (ctx->buffer != nullptr && ctx->buffer->pos > 0) {
+    bool batch_put = config::enable_transaction_stream_load_batch_put && ctx->format != TFileFormatType::FORMAT_JSON;
+    if (ctx->buffer != nullptr && ctx->buffer->pos > 0 && !(batch_put && ctx->buffer->has_remaining())) {
         ctx->buffer->flip();
         WARN_IF_ERROR(ctx->body_sink->append(std::move(ctx->buffer)),
                       "append MessageBodySink failed when handle TransactionStreamLoad");
@@ -528,12 +530,12 @@ void TransactionStreamLoadAction::on_chunk_data(HttpRequest* req) {
     size_t len = 0;
     while ((len = evbuffer_get_length(evbuf)) > 0) {
         if (ctx->buffer == nullptr) {
-            // Initialize buffer.
+            // Initialize buffer. Leave some room for the following requests if they are batched in the buffer.
+            bool reserve =
+                    ctx->format == TFileFormatType::FORMAT_JSON || config::enable_transaction_stream_load_batch_put;
             ASSIGN_OR_SET_STATUS_AND_RETURN_IF_ERROR(
                     ctx->status, ctx->buffer,
-                    ByteBuffer::allocate_with_tracker(ctx->format == TFileFormatType::FORMAT_JSON
-                                                              ? std::max(len, ctx->kDefaultBufferSize)
-                                                              : len));
+                    ByteBuffer::allocate_with_tracker(reserve ? std::max(len, ctx->kDefaultBufferSize) : len));
 
         } else if (ctx->buffer->remaining() < len) {
             if (ctx->format == TFileFormatType::FORMAT_JSON) {
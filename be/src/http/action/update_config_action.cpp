@@ -46,6 +46,7 @@
 #include "block_cache/block_cache.h"
 #include "common/configbase.h"
 #include "common/logging.h"
+#include "common/prof/cpu_sampler.h"
 #include "common/status.h"
 #include "exec/workgroup/scan_executor.h"
 #include "gutil/strings/substitute.h"
@@ -117,6 +118,10 @@ Status UpdateConfigAction::update_config(const std::string& name, const std::str
             (void)BlockCache::instance()->adjust_disk_spaces(spaces);
         });
         _config_callback.emplace("datacache_disk_path", _config_callback["datacache_disk_size"]);
+        _config_callback.emplace("cpu_sampler_frequency", [&]() {
+            auto st = CpuSampler::getInstance().set_frequency(config::cpu_sampler_frequency);
+            LOG_IF(WARNING, !st.ok()) << "Failed to update cpu_sampler_frequency: " << st;
+        });
         _config_callback.emplace("max_compaction_concurrency", [&]() {
             (void)StorageEngine::instance()->compaction_manager()->update_max_threads(
                     config::max_compaction_concurrency);
@@ -211,6 +216,14 @@ Status UpdateConfigAction::update_config(const std::string& name, const std::str
             (void)StorageEngine::instance()->update_manager()->get_pindex_thread_pool()->update_max_threads(
                     max_thread_cnt);
         });
+        _config_callback.emplace("transaction_apply_segment_worker_count", [&]() {
+            int max_thread_cnt = CpuInfo::num_cores();
+            if (config::transaction_apply_segment_worker_count > 0) {
+                max_thread_cnt = config::transaction_apply_segment_worker_count;
+            }
+            (void)StorageEngine::instance()->update_manager()->apply_segment_thread_pool()->update_max_threads(
+                    max_thread_cnt);
+        });
         _config_callback.emplace("drop_tablet_worker_count", [&]() {
             auto thread_pool = ExecEnv::GetInstance()->agent_server()->get_thread_pool(TTaskType::DROP);
             (void)thread_pool->update_max_threads(config::drop_tablet_worker_count);
@@ -18,8 +18,13 @@
 
 #include <utility>
 
+#include "block_cache/block_cache_warmer.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
-#include "util/hash_util.hpp"
+#include "io/io_latency_metrics.h"
+#include "runtime/current_thread.h"
+#include "util/defer_op.h"
+#include "util/priority_thread_pool.hpp"
 #include "util/runtime_profile.h"
 #include "util/stack_util.h"
 
@@ -36,33 +41,26 @@ CacheInputStream::CacheInputStream(const std::shared_ptr<SharedBufferedInputStre
           _filename(filename),
           _sb_stream(stream),
           _offset(0),
-          _size(size) {
+          _size(size),
+          _modification_time(modification_time) {
     _cache = BlockCache::instance();
     _block_size = _cache->block_size();
 
-    _cache_key.resize(12);
-
-    char* data = _cache_key.data();
-    uint64_t hash_value = HashUtil::hash64(filename.data(), filename.size(), 0);
-    memcpy(data, &hash_value, sizeof(hash_value));
-    // The modification time is more appropriate to indicate the different file versions.
-    // While some data source, such as Hudi, have no modification time because their files
-    // cannot be overwritten. So, if the modification time is unsupported, we use file size instead.
-    // Usually the last modification timestamp has 41 bits, to reduce memory usage, we ignore the tail 9
-    // bytes and choose the high 32 bits to represent the second timestamp.
-    if (modification_time > 0) {
-        uint32_t mtime_s = (modification_time >> 9) & 0x00000000FFFFFFFF;
-        memcpy(data + 8, &mtime_s, sizeof(mtime_s));
-    } else {
-        uint32_t file_size = _size;
-        memcpy(data + 8, &file_size, sizeof(file_size));
-    }
+    _cache_key = BlockCache::file_cache_key(filename, size, modification_time);
+    _record_access = config::datacache_warmup_history_capacity > 0;
+
     // default _buffer size is 4MB = (16 * 256KB)
     _buffer_size = 16 * _block_size;
     _buffer.reserve(_buffer_size);
 }
 
 CacheInputStream::~CacheInputStream() {
+    // The read-ahead tasks use this stream, wait for them before anything is destroyed.
+    _wait_readahead(0, -1);
+    if (!_accessed_blocks.empty()) {
+        std::vector<int64_t> block_offsets(_accessed_blocks.begin(), _accessed_blocks.end());
+        BlockCacheWarmer::instance()->record_access(_filename, _size, _modification_time, block_offsets);
+    }
     int64_t io_bytes = _sb_stream->shared_io_bytes() + _sb_stream->direct_io_bytes();
     if (_enable_cache_io_adaptor && io_bytes > 0) {
         int64_t latency_us_per_block = (_sb_stream->shared_io_timer() + _sb_stream->direct_io_timer()) / 1000;
@@ -98,7 +96,9 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
     auto iter = _block_map.find(block_id);
     if (iter != _block_map.end()) {
         auto& block = iter->second;
-        block.buffer.copy_to(out, size, offset - block.offset);
+        if (out != nullptr) {
+            block.buffer.copy_to(out, size, offset - block.offset);
+        }
         _stats.read_block_buffer_bytes += size;
         _stats.read_block_buffer_count += 1;
         return Status::OK();
@@ -115,7 +115,9 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
         if (ret.ok()) {
             sb = ret.value();
             if (sb->buffer.capacity() > 0) {
-                strings::memcpy_inlined(out, sb->buffer.data() + offset - sb->offset, size);
+                if (out != nullptr) {
+                    strings::memcpy_inlined(out, sb->buffer.data() + offset - sb->offset, size);
+                }
                 if (_enable_populate_cache) {
                     _populate_cache_from_zero_copy_buffer((const char*)sb->buffer.data() + block_offset - sb->offset,
                                                           block_offset, load_size, sb);
@@ -145,7 +147,9 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
     }
     if (res.ok()) {
         if (_enable_block_buffer) {
-            block.buffer.copy_to(out, size, shift);
+            if (out != nullptr) {
+                block.buffer.copy_to(out, size, shift);
+            }
             block.offset = block_offset;
             _block_map[block_id] = block;
         }
@@ -154,6 +158,9 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
         _stats.read_mem_cache_bytes += options.stats.read_mem_bytes;
         _stats.read_disk_cache_bytes += options.stats.read_disk_bytes;
         _stats.read_cache_ns += read_cache_ns;
+        IOLatencyMetrics::record(
+                options.stats.read_disk_bytes > 0 ? IOSource::BLOCK_CACHE_DISK : IOSource::BLOCK_CACHE_MEMORY,
+                read_cache_ns);
         if (_enable_cache_io_adaptor) {
             _cache->record_read_cache(read_size, read_cache_ns / 1000);
         }
@@ -316,6 +323,11 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
         return Status::EndOfFile("");
     }
     const int64_t end_offset = offset + count;
+    if (!_readahead_tasks.empty()) {
+        _wait_readahead(offset, count);
+    }
+    // Read ahead after this read finishes, so they don't compete for the underlying stream.
+    DeferOp readahead([&]() { _maybe_readahead(origin_offset, end_offset); });
 
     char* p = static_cast<char*>(out);
     char* pe = p + count;
@@ -329,6 +341,9 @@ Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count)
         size_t off = std::max(offset, i * _block_size);
         size_t end = std::min((i + 1) * _block_size, end_offset);
         size_t size = end - off;
+        if (_record_access) {
+            _accessed_blocks.insert(i * _block_size);
+        }
         Status st = _read_block_from_local(off, size, p);
         if (st.is_not_found()) {
             // Not found block from local, we need to load it from remote
@@ -413,13 +428,136 @@ StatusOr<std::string_view> CacheInputStream::peek(int64_t count) {
     // if app level uses zero copy read, it does bypass the cache layer.
     // so here we have to fill cache manually.
     SharedBufferPtr sb;
-    ASSIGN_OR_RETURN(auto s, _sb_stream->peek_shared_buffer(count, &sb));
+    auto ret = _sb_stream->peek_shared_buffer(count, &sb);
+    if (!ret.ok()) {
+        // The range is not in the shared buffer, try to hand out the memory of the cached block instead.
+        auto block_ret = _peek_block_buffer(count);
+        return block_ret.ok() ? block_ret : ret;
+    }
+    auto s = ret.value();
     if (_enable_populate_cache) {
         _populate_cache_from_zero_copy_buffer(s.data(), _offset, count, sb);
     }
     return s;
 }
 
+void CacheInputStream::_maybe_readahead(int64_t offset, int64_t end_offset) {
+    _sequential_reads = offset == _last_read_end ? _sequential_reads + 1 : 0;
+    _last_read_end = end_offset;
+    // Two reads in a row are enough to tell a sequential scan from the random reads of the footers and indexes.
+    static const int64_t kSequentialReads = 2;
+    if (_readahead_executor == nullptr || !_enable_populate_cache || _sequential_reads < kSequentialReads) {
+        return;
+    }
+    const int64_t window = std::max<int64_t>(config::datacache_readahead_window_bytes / _block_size, 1) * _block_size;
+    const int64_t next_block_offset = (end_offset + _block_size - 1) / _block_size * _block_size;
+    // Start the next read-ahead once the reader has consumed half of the previous one, so the remote reads
+    // keep ahead of the reader and each of them covers half of the window at least.
+    if (_readahead_end - next_block_offset > window / 2) {
+        return;
+    }
+    int64_t begin = std::max(next_block_offset, _readahead_end);
+    const int64_t end = std::min(next_block_offset + window, _size);
+    while (begin < end && _cache->exist(_cache_key, begin, std::min(_block_size, _size - begin))) {
+        begin += _block_size;
+    }
+    if (begin >= end) {
+        _readahead_end = std::max(_readahead_end, end);
+        return;
+    }
+    const int64_t size = end - begin;
+    std::atomic<int64_t>* inflight_bytes = _readahead_inflight_bytes;
+    if (inflight_bytes != nullptr && inflight_bytes->fetch_add(size) + size > _readahead_max_inflight_bytes) {
+        // Too many bytes are being read ahead by this query, leave the bandwidth to the other reads.
+        inflight_bytes->fetch_sub(size);
+        return;
+    }
+
+    auto promise = std::make_shared<std::promise<Status>>();
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    // the stream waits for all the read-ahead tasks in its destructor, so `this` outlives them.
+    auto task = [this, begin, size, promise, mem_tracker, inflight_bytes]() {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        Status st = _readahead_blocks(begin, size);
+        if (inflight_bytes != nullptr) {
+            inflight_bytes->fetch_sub(size);
+        }
+        promise->set_value(std::move(st));
+    };
+    if (!_readahead_executor->try_offer(std::move(task))) {
+        if (inflight_bytes != nullptr) {
+            inflight_bytes->fetch_sub(size);
+        }
+        return;
+    }
+    _readahead_tasks.push_back({begin, size, promise->get_future()});
+    _readahead_end = end;
+}
+
+Status CacheInputStream::_readahead_blocks(int64_t offset, int64_t size) {
+    // One remote request for all the blocks, and then split it into blocks to write the cache.
+    std::vector<char> buffer(size);
+    RETURN_IF_ERROR(_sb_stream->read_directly(offset, buffer.data(), size));
+    for (int64_t pos = 0; pos < size; pos += _block_size) {
+        WriteCacheOptions options;
+        options.evict_probability = _datacache_evict_probability;
+        options.priority = _priority;
+        options.ttl_seconds = _ttl_seconds;
+        const int64_t write_size = std::min(_block_size, size - pos);
+        Status st = _cache->write_buffer(_cache_key, offset + pos, write_size, buffer.data() + pos, &options);
+        if (!st.ok() && !_can_ignore_populate_error(st)) {
+            return st;
+        }
+    }
+    return Status::OK();
+}
+
+void CacheInputStream::_wait_readahead(int64_t offset, int64_t count) {
+    SCOPED_RAW_TIMER(&_stats.readahead_wait_ns);
+    for (auto it = _readahead_tasks.begin(); it != _readahead_tasks.end();) {
+        bool overlapped = count < 0 || (it->offset < offset + count && offset < it->offset + it->size);
+        if (!overlapped && it->status.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++it;
+            continue;
+        }
+        Status st = it->status.get();
+        if (st.ok()) {
+            _stats.readahead_count += 1;
+            _stats.readahead_bytes += it->size;
+        } else {
+            // The blocks not in the cache will be read on demand.
+            LOG(WARNING) << "read ahead " << _filename << " failed, offset: " << it->offset << ", size: " << it->size
+                         << ", error: " << st;
+        }
+        it = _readahead_tasks.erase(it);
+    }
+}
+
+StatusOr<std::string_view> CacheInputStream::_peek_block_buffer(int64_t count) {
+    const int64_t block_id = _offset / _block_size;
+    if (!_enable_block_buffer || count <= 0 || _offset + count > _size ||
+        (_offset + count - 1) / _block_size != block_id) {
+        return Status::NotSupported("peek range can not be served by one cached block");
+    }
+    auto iter = _block_map.find(block_id);
+    if (iter == _block_map.end()) {
+        // Load the block into the block map without copying it out.
+        RETURN_IF_ERROR(_read_block_from_local(_offset, count, nullptr));
+        iter = _block_map.find(block_id);
+        if (iter == _block_map.end()) {
+            return Status::NotFound("block is not in block buffer");
+        }
+    }
+    const auto& block = iter->second;
+    const char* data = block.buffer.contiguous_data(_offset - block.offset, count);
+    if (data == nullptr) {
+        return Status::NotSupported("peek range is not contiguous in the cached block");
+    }
+    _stats.read_block_buffer_bytes += count;
+    _stats.read_block_buffer_count += 1;
+    return std::string_view(data, count);
+}
+
 void CacheInputStream::_populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count,
                                                              const SharedBufferPtr& sb) {
     int64_t begin = offset / _block_size * _block_size;
@@ -14,13 +14,20 @@
 
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <memory>
 #include <string>
+#include <unordered_set>
 
 #include "block_cache/block_cache.h"
 #include "block_cache/io_buffer.h"
 #include "io/shared_buffered_input_stream.h"
 
+namespace starrocks {
+class PriorityThreadPool;
+}
+
 namespace starrocks::io {
 
 class CacheInputStream : public SeekableInputStreamWrapper {
@@ -44,6 +51,9 @@ public:
         int64_t write_cache_fail_bytes = 0;
         int64_t read_block_buffer_bytes = 0;
         int64_t read_block_buffer_count = 0;
+        int64_t readahead_count = 0;
+        int64_t readahead_bytes = 0;
+        int64_t readahead_wait_ns = 0;
     };
 
     explicit CacheInputStream(const std::shared_ptr<SharedBufferedInputStream>& stream, const std::string& filename,
@@ -77,6 +87,16 @@ public:
 
     void set_ttl_seconds(const uint64_t ttl_seconds) { _ttl_seconds = ttl_seconds; }
 
+    // Enables reading ahead the blocks after a sequential scan in the background on `executor`. The blocks
+    // read ahead are written to the cache. `inflight_bytes` is shared by all the streams of a query, and the
+    // read-ahead is skipped if it would exceed `max_inflight_bytes`.
+    void set_readahead(PriorityThreadPool* executor, std::atomic<int64_t>* inflight_bytes,
+                       int64_t max_inflight_bytes) {
+        _readahead_executor = executor;
+        _readahead_inflight_bytes = inflight_bytes;
+        _readahead_max_inflight_bytes = max_inflight_bytes;
+    }
+
     int64_t get_align_size() const;
 
     StatusOr<std::string_view> peek(int64_t count) override;
@@ -91,16 +111,29 @@ protected:
         int64_t offset;
         IOBuffer buffer;
     };
+    struct ReadAheadTask {
+        int64_t offset;
+        int64_t size;
+        std::future<Status> status;
+    };
     using SharedBufferPtr = SharedBufferedInputStream::SharedBufferPtr;
 
     // Read block from local, if not found, will return Status::NotFound();
+    // If `out` is nullptr, the block is only loaded into the block buffer.
     virtual Status _read_block_from_local(const int64_t offset, const int64_t size, char* out);
     // Read multiple blocks from remote
     virtual Status _read_blocks_from_remote(const int64_t offset, const int64_t size, char* out);
+    // Return the memory of the cached block covering [_offset, _offset + count) without copying.
+    StatusOr<std::string_view> _peek_block_buffer(int64_t count);
     Status _populate_to_cache(const int64_t offset, const int64_t size, char* src, const SharedBufferPtr& sb);
     void _populate_cache_from_zero_copy_buffer(const char* p, int64_t offset, int64_t count, const SharedBufferPtr& sb);
     void _deduplicate_shared_buffer(const SharedBufferPtr& sb);
     bool _can_ignore_populate_error(const Status& status) const;
+    // Detect the sequential reads and start reading ahead the blocks after `end_offset`.
+    void _maybe_readahead(int64_t offset, int64_t end_offset);
+    Status _readahead_blocks(int64_t offset, int64_t size);
+    // Wait for the read-ahead tasks overlapping with [offset, offset + count), or all of them if count < 0.
+    void _wait_readahead(int64_t offset, int64_t count);
 
     std::string _cache_key;
     std::string _filename;
@@ -110,6 +143,7 @@ protected:
     std::string _buffer;
     Stats _stats;
     int64_t _size;
+    int64_t _modification_time;
     bool _enable_populate_cache = false;
     bool _enable_async_populate_mode = false;
     bool _enable_block_buffer = false;
@@ -120,6 +154,19 @@ protected:
     std::unordered_map<int64_t, BlockBuffer> _block_map;
     int8_t _priority = 0;
     uint64_t _ttl_seconds = 0;
+    // The aligned offsets of the blocks read by this stream, recorded into the datacache access history.
+    bool _record_access = false;
+    std::unordered_set<int64_t> _accessed_blocks;
+
+    PriorityThreadPool* _readahead_executor = nullptr;
+    std::atomic<int64_t>* _readahead_inflight_bytes = nullptr;
+    int64_t _readahead_max_inflight_bytes = 0;
+    // The end of the last read, the reads are sequential if each one starts where the previous one stopped.
+    int64_t _last_read_end = -1;
+    int64_t _sequential_reads = 0;
+    // The end of the blocks the background tasks have read ahead.
+    int64_t _readahead_end = 0;
+    std::vector<ReadAheadTask> _readahead_tasks;
 };
 
 } // namespace starrocks::io
@@ -18,9 +18,15 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <vector>
+
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "io/io_error.h"
+#include "io/io_latency_metrics.h"
 #include "io_profiler.h"
 #include "util/stopwatch.hpp"
 
@@ -85,10 +91,70 @@ StatusOr<int64_t> FdInputStream::read(void* data, int64_t count) {
     s_posixread_iosize.Observe(res);
 #endif
     _offset += res;
-    IOProfiler::add_read(res, watch.elapsed_time());
+    int64_t elapsed = watch.elapsed_time();
+    IOProfiler::add_read(res, elapsed);
+    IOLatencyMetrics::record(IOSource::LOCAL_DISK, elapsed);
     return res;
 }
 
+Status FdInputStream::read_at_fully_batch(std::span<const ReadRequest> requests) {
+    CHECK_IS_CLOSED(_is_closed);
+    std::vector<size_t> order(requests.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t l, size_t r) { return requests[l].offset < requests[r].offset; });
+
+    std::vector<struct iovec> iovs;
+    size_t i = 0;
+    while (i < order.size()) {
+        const int64_t offset = requests[order[i]].offset;
+        int64_t end = offset;
+        iovs.clear();
+        for (; i < order.size() && iovs.size() < IOV_MAX; ++i) {
+            const auto& r = requests[order[i]];
+            if (r.offset != end) break;
+            iovs.push_back({r.out, static_cast<size_t>(r.count)});
+            end += r.count;
+        }
+        RETURN_IF_ERROR(_preadv_fully(iovs.data(), static_cast<int>(iovs.size()), offset));
+    }
+    return Status::OK();
+}
+
+Status FdInputStream::_preadv_fully(struct iovec* iov, int iovcnt, int64_t offset) {
+    MonotonicStopWatch watch;
+    watch.start();
+    int64_t total = 0;
+    while (iovcnt > 0) {
+        ssize_t res;
+        RETRY_ON_EINTR(res, ::preadv(_fd, iov, iovcnt, offset));
+        if (UNLIKELY(res < 0)) {
+            _errno = errno;
+            return io_error("preadv", _errno);
+        }
+        offset += res;
+        total += res;
+        // skip the buffers filled completely, then adjust the partially filled one
+        size_t left = res;
+        while (iovcnt > 0 && left >= iov->iov_len) {
+            left -= iov->iov_len;
+            ++iov;
+            --iovcnt;
+        }
+        if (iovcnt > 0) {
+            if (res == 0) {
+                return Status::IOError("can not read fully");
+            }
+            iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+            iov->iov_len -= left;
+        }
+    }
+    int64_t elapsed = watch.elapsed_time();
+    IOProfiler::add_read(total, elapsed);
+    IOLatencyMetrics::record(IOSource::LOCAL_DISK, elapsed);
+    return Status::OK();
+}
+
 StatusOr<int64_t> FdInputStream::get_size() {
     CHECK_IS_CLOSED(_is_closed);
     struct stat st;
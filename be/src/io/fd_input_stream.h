@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <sys/uio.h>
+
 #include "io/seekable_input_stream.h"
 
 namespace starrocks::io {
@@ -32,6 +34,9 @@ public:
 
     StatusOr<int64_t> read(void* data, int64_t count) override;
 
+    // Requests on contiguous ranges are read together with a single preadv(2).
+    Status read_at_fully_batch(std::span<const ReadRequest> requests) override;
+
     StatusOr<int64_t> get_size() override;
 
     StatusOr<int64_t> position() override { return _offset; }
@@ -58,6 +63,8 @@ public:
     int get_errno() const { return _errno; }
 
 private:
+    Status _preadv_fully(struct iovec* iov, int iovcnt, int64_t offset);
+
     int _fd;
     int _errno;
     int64_t _offset;
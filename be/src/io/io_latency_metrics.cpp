@@ -0,0 +1,206 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_latency_metrics.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "util/metrics.h"
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+static constexpr int kNumSources = static_cast<int>(IOSource::NUM_SOURCES);
+
+static thread_local IOLatencyHistograms* tls_query_histograms = nullptr;
+static thread_local IOLatencyHistograms* tls_workgroup_histograms = nullptr;
+
+const char* io_source_to_string(IOSource source) {
+    switch (source) {
+    case IOSource::LOCAL_DISK:
+        return "local_disk";
+    case IOSource::PAGE_CACHE_MISS:
+        return "page_cache_miss";
+    case IOSource::BLOCK_CACHE_MEMORY:
+        return "block_cache_memory";
+    case IOSource::BLOCK_CACHE_DISK:
+        return "block_cache_disk";
+    case IOSource::REMOTE_STORAGE:
+        return "remote_storage";
+    default:
+        return "unknown";
+    }
+}
+
+int LatencyHistogram::bucket_of(int64_t latency_ns) {
+    if (latency_ns < kNumSubBuckets) {
+        return std::max<int64_t>(latency_ns, 0);
+    }
+    latency_ns = std::min<int64_t>(latency_ns, (1L << kMaxBits) - 1);
+    int msb = 63 - __builtin_clzll(latency_ns);
+    int shift = msb - kSubBucketBits;
+    int sub = (latency_ns >> shift) & (kNumSubBuckets - 1);
+    return (shift + 1) * kNumSubBuckets + sub;
+}
+
+int64_t LatencyHistogram::bucket_upper_bound(int bucket) {
+    if (bucket < kNumSubBuckets) {
+        return bucket;
+    }
+    int shift = bucket / kNumSubBuckets - 1;
+    int sub = bucket % kNumSubBuckets;
+    int64_t lower = static_cast<int64_t>(kNumSubBuckets + sub) << shift;
+    return lower + (1L << shift) - 1;
+}
+
+void LatencyHistogram::snapshot(Snapshot* snapshot) const {
+    for (int i = 0; i < kNumBuckets; i++) {
+        (*snapshot)[i] = _buckets[i].load(std::memory_order_relaxed);
+    }
+}
+
+int64_t LatencyHistogram::count(const Snapshot& snapshot) {
+    int64_t count = 0;
+    for (int64_t c : snapshot) {
+        count += c;
+    }
+    return count;
+}
+
+int64_t LatencyHistogram::percentile(const Snapshot& snapshot, double p) {
+    int64_t total = count(snapshot);
+    if (total <= 0) {
+        return 0;
+    }
+    auto rank = std::max<int64_t>(static_cast<int64_t>(std::ceil(total * std::clamp(p, 0.0, 100.0) / 100)), 1);
+    int64_t seen = 0;
+    for (int i = 0; i < kNumBuckets; i++) {
+        seen += snapshot[i];
+        if (seen >= rank) {
+            return bucket_upper_bound(i);
+        }
+    }
+    return bucket_upper_bound(kNumBuckets - 1);
+}
+
+struct IOLatencyMetrics::Metrics {
+    const IOLatencyHistograms* histograms;
+    LatencyHistogram::Snapshot last_snapshots[kNumSources] = {};
+
+    std::unique_ptr<IntGauge> count[kNumSources];
+    std::unique_ptr<IntGauge> p50_us[kNumSources];
+    std::unique_ptr<IntGauge> p99_us[kNumSources];
+    std::unique_ptr<IntGauge> p999_us[kNumSources];
+};
+
+IOLatencyMetrics* IOLatencyMetrics::instance() {
+    static IOLatencyMetrics metrics;
+    return &metrics;
+}
+
+IOLatencyMetrics::IOLatencyMetrics() {
+    _register_metrics(&_process_histograms, -1);
+    StarRocksMetrics::instance()->metrics()->register_hook("io_latency_metrics_hook", [this] { _update_metrics(); });
+}
+
+void IOLatencyMetrics::record(IOSource source, int64_t latency_ns) {
+    instance()->_process_histograms.record(source, latency_ns);
+    if (tls_workgroup_histograms != nullptr) {
+        tls_workgroup_histograms->record(source, latency_ns);
+    }
+    if (tls_query_histograms != nullptr) {
+        tls_query_histograms->record(source, latency_ns);
+    }
+}
+
+IOLatencyHistograms* IOLatencyMetrics::workgroup_histograms(int64_t workgroup_id) {
+    IOLatencyHistograms* histograms = nullptr;
+    {
+        std::lock_guard l(_mutex);
+        auto& entry = _workgroup_histograms[workgroup_id];
+        if (entry != nullptr) {
+            return entry.get();
+        }
+        entry = std::make_unique<IOLatencyHistograms>();
+        histograms = entry.get();
+    }
+    // Register the metrics out of _mutex to avoid deadlock, since the hook takes the mutex of MetricRegistry then
+    // _mutex.
+    _register_metrics(histograms, workgroup_id);
+    return histograms;
+}
+
+void IOLatencyMetrics::_register_metrics(const IOLatencyHistograms* histograms, int64_t workgroup_id) {
+    auto metrics = std::make_unique<Metrics>();
+    metrics->histograms = histograms;
+    auto* registry = StarRocksMetrics::instance()->metrics();
+    for (int i = 0; i < kNumSources; i++) {
+        MetricLabels labels;
+        labels.add("source", io_source_to_string(static_cast<IOSource>(i)));
+        if (workgroup_id >= 0) {
+            labels.add("workgroup_id", std::to_string(workgroup_id));
+        }
+        metrics->count[i] = std::make_unique<IntGauge>(MetricUnit::OPERATIONS);
+        metrics->p50_us[i] = std::make_unique<IntGauge>(MetricUnit::MICROSECONDS);
+        metrics->p99_us[i] = std::make_unique<IntGauge>(MetricUnit::MICROSECONDS);
+        metrics->p999_us[i] = std::make_unique<IntGauge>(MetricUnit::MICROSECONDS);
+        registry->register_metric("io_latency_count", labels, metrics->count[i].get());
+        registry->register_metric("io_latency_p50_us", labels, metrics->p50_us[i].get());
+        registry->register_metric("io_latency_p99_us", labels, metrics->p99_us[i].get());
+        registry->register_metric("io_latency_p999_us", labels, metrics->p999_us[i].get());
+    }
+    std::lock_guard l(_mutex);
+    _metrics.emplace_back(std::move(metrics));
+}
+
+void IOLatencyMetrics::_update_metrics() {
+    std::lock_guard l(_mutex);
+    LatencyHistogram::Snapshot snapshot;
+    LatencyHistogram::Snapshot delta;
+    for (auto& metrics : _metrics) {
+        for (int i = 0; i < kNumSources; i++) {
+            metrics->histograms->get(static_cast<IOSource>(i)).snapshot(&snapshot);
+            for (int b = 0; b < LatencyHistogram::kNumBuckets; b++) {
+                delta[b] = snapshot[b] - metrics->last_snapshots[i][b];
+            }
+            metrics->last_snapshots[i] = snapshot;
+            metrics->count[i]->set_value(LatencyHistogram::count(snapshot));
+            metrics->p50_us[i]->set_value(LatencyHistogram::percentile(delta, 50) / 1000);
+            metrics->p99_us[i]->set_value(LatencyHistogram::percentile(delta, 99) / 1000);
+            metrics->p999_us[i]->set_value(LatencyHistogram::percentile(delta, 99.9) / 1000);
+        }
+    }
+}
+
+ScopedIOLatencyContext::ScopedIOLatencyContext(IOLatencyHistograms* query_histograms, int64_t workgroup_id)
+        : _prev_query_histograms(tls_query_histograms), _prev_workgroup_histograms(tls_workgroup_histograms) {
+    // The histograms of a workgroup are never freed, so the last one looked up by the thread can be cached, which
+    // avoids taking the mutex each time a driver or a scan task is scheduled.
+    static thread_local int64_t cached_workgroup_id = -1;
+    static thread_local IOLatencyHistograms* cached_workgroup_histograms = nullptr;
+    if (workgroup_id >= 0 && workgroup_id != cached_workgroup_id) {
+        cached_workgroup_histograms = IOLatencyMetrics::instance()->workgroup_histograms(workgroup_id);
+        cached_workgroup_id = workgroup_id;
+    }
+    tls_query_histograms = query_histograms;
+    tls_workgroup_histograms = workgroup_id >= 0 ? cached_workgroup_histograms : nullptr;
+}
+
+ScopedIOLatencyContext::~ScopedIOLatencyContext() {
+    tls_query_histograms = _prev_query_histograms;
+    tls_workgroup_histograms = _prev_workgroup_histograms;
+}
+
+} // namespace starrocks
@@ -0,0 +1,138 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "util/stopwatch.hpp"
+
+namespace starrocks {
+
+// The sources of the latency of the reads.
+enum class IOSource {
+    LOCAL_DISK = 0,
+    // Reading a page of a segment which misses the page cache, whichever the file is read from.
+    PAGE_CACHE_MISS,
+    BLOCK_CACHE_MEMORY,
+    BLOCK_CACHE_DISK,
+    // S3, HDFS and the other remote storages.
+    REMOTE_STORAGE,
+    NUM_SOURCES,
+};
+
+const char* io_source_to_string(IOSource source);
+
+// A lock-free histogram of latencies in log-linear buckets, like HdrHistogram: each power of two is divided into
+// 2^kSubBucketBits buckets, so the relative error of a percentile is at most 1/2^kSubBucketBits.
+class LatencyHistogram {
+public:
+    static constexpr int kSubBucketBits = 3;
+    static constexpr int kNumSubBuckets = 1 << kSubBucketBits;
+    // Up to 2^47 ns, about 39 hours.
+    static constexpr int kMaxBits = 47;
+    static constexpr int kNumBuckets = (kMaxBits - kSubBucketBits + 1) * kNumSubBuckets;
+
+    using Snapshot = std::array<int64_t, kNumBuckets>;
+
+    void record(int64_t latency_ns) {
+        _buckets[bucket_of(latency_ns)].fetch_add(1, std::memory_order_relaxed);
+        _sum_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    }
+
+    void snapshot(Snapshot* snapshot) const;
+    int64_t sum_ns() const { return _sum_ns.load(std::memory_order_relaxed); }
+
+    static int bucket_of(int64_t latency_ns);
+    // The upper bound of the values of |bucket|.
+    static int64_t bucket_upper_bound(int bucket);
+    static int64_t count(const Snapshot& snapshot);
+    // The |p|-th percentile in [0, 100] of the values of |snapshot|, 0 if it's empty.
+    static int64_t percentile(const Snapshot& snapshot, double p);
+
+private:
+    std::atomic<int64_t> _buckets[kNumBuckets] = {};
+    std::atomic<int64_t> _sum_ns = 0;
+};
+
+// The latency histograms of each IOSource.
+class IOLatencyHistograms {
+public:
+    void record(IOSource source, int64_t latency_ns) { _histograms[static_cast<int>(source)].record(latency_ns); }
+    const LatencyHistogram& get(IOSource source) const { return _histograms[static_cast<int>(source)]; }
+
+private:
+    LatencyHistogram _histograms[static_cast<int>(IOSource::NUM_SOURCES)];
+};
+
+// The io latency histograms of the process and of each workgroup, exported as the metrics
+// io_latency_{count,p50_us,p99_us,p999_us}{source=...[,workgroup_id=...]}. The percentiles are of the reads since
+// the last collection of the metrics.
+//
+// The reads of a query are also recorded into the histograms of the query set by ScopedIOLatencyContext.
+class IOLatencyMetrics {
+public:
+    static IOLatencyMetrics* instance();
+
+    // Records the latency of a read into the histograms of the process and of the current workgroup and query.
+    static void record(IOSource source, int64_t latency_ns);
+
+    // The histograms of |workgroup_id|, created at the first call.
+    IOLatencyHistograms* workgroup_histograms(int64_t workgroup_id);
+
+    const IOLatencyHistograms& process_histograms() const { return _process_histograms; }
+
+private:
+    struct Metrics;
+
+    IOLatencyMetrics();
+    void _register_metrics(const IOLatencyHistograms* histograms, int64_t workgroup_id);
+    void _update_metrics();
+
+    IOLatencyHistograms _process_histograms;
+
+    std::mutex _mutex;
+    std::unordered_map<int64_t, std::unique_ptr<IOLatencyHistograms>> _workgroup_histograms;
+    std::vector<std::unique_ptr<Metrics>> _metrics;
+};
+
+// Sets the histograms of the query and of the workgroup which the reads of the current thread are recorded into.
+// Either can be null.
+class ScopedIOLatencyContext {
+public:
+    ScopedIOLatencyContext(IOLatencyHistograms* query_histograms, int64_t workgroup_id);
+    ~ScopedIOLatencyContext();
+
+private:
+    IOLatencyHistograms* _prev_query_histograms;
+    IOLatencyHistograms* _prev_workgroup_histograms;
+};
+
+// Records the time of its scope as a read of |source|.
+class ScopedIOLatencyTimer {
+public:
+    explicit ScopedIOLatencyTimer(IOSource source) : _source(source) { _watch.start(); }
+    ~ScopedIOLatencyTimer() { IOLatencyMetrics::record(_source, _watch.elapsed_time()); }
+
+private:
+    IOSource _source;
+    MonotonicStopWatch _watch;
+};
+
+} // namespace starrocks
@@ -20,6 +20,7 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include "io/io_latency_metrics.h"
 #include "io/s3_zero_copy_iostream.h"
 
 #ifdef USE_STAROS
@@ -35,6 +36,12 @@ inline Status make_error_status(const Aws::S3::S3Error& error) {
             static_cast<int>(error.GetResponseCode()), static_cast<int>(error.GetErrorType()), error.GetMessage()));
 }
 
+static Aws::S3::Model::GetObjectOutcome get_object(Aws::S3::S3Client* client,
+                                                   const Aws::S3::Model::GetObjectRequest& request) {
+    ScopedIOLatencyTimer timer(IOSource::REMOTE_STORAGE);
+    return client->GetObject(request);
+}
+
 StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     if (UNLIKELY(_size == -1)) {
         ASSIGN_OR_RETURN(_size, S3InputStream::get_size());
@@ -64,7 +71,7 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
             return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, reinterpret_cast<char*>(out), real_length);
         });
 
-        Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+        Aws::S3::Model::GetObjectOutcome outcome = get_object(_s3client.get(), request);
         if (outcome.IsSuccess()) {
             if (UNLIKELY(outcome.GetResult().GetContentLength() != real_length)) {
                 return Status::InternalError("The response length is different from request length for io stream!");
@@ -100,7 +107,7 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
             request.SetKey(_object);
             request.SetRange(std::move(range));
 
-            Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+            Aws::S3::Model::GetObjectOutcome outcome = get_object(_s3client.get(), request);
             if (outcome.IsSuccess()) {
                 Aws::IOStream& body = outcome.GetResult().GetBody();
                 int64_t read_length = read_end_offset - read_start_offset;
@@ -151,7 +158,7 @@ StatusOr<std::string> S3InputStream::read_all() {
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(_bucket);
     request.SetKey(_object);
-    Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+    Aws::S3::Model::GetObjectOutcome outcome = get_object(_s3client.get(), request);
     if (outcome.IsSuccess()) {
         Aws::IOStream& body = outcome.GetResult().GetBody();
         return std::string(std::istreambuf_iterator<char>(body), {});
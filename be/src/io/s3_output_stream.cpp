@@ -27,18 +27,24 @@
 namespace starrocks::io {
 
 S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
-                               int64_t max_single_part_size, int64_t min_upload_part_size)
+                               int64_t max_single_part_size, int64_t min_upload_part_size, int64_t max_inflight_parts)
         : _client(std::move(client)),
           _bucket(std::move(bucket)),
           _object(std::move(object)),
           _max_single_part_size(max_single_part_size),
           _min_upload_part_size(min_upload_part_size),
+          _max_inflight_parts(max_inflight_parts),
           _buffer(),
           _upload_id(),
           _etags() {
     CHECK(_client != nullptr);
 }
 
+S3OutputStream::~S3OutputStream() {
+    // the inflight requests refer to the buffers
+    WARN_IF_ERROR(wait_inflight_parts(0), fmt::format("S3: Fail to upload part of {}/{}", _bucket, _object));
+}
+
 Status S3OutputStream::write(const void* data, int64_t size) {
     _buffer.append(static_cast<const char*>(data), size);
     if (_upload_id.empty() && _buffer.size() > _max_single_part_size) {
@@ -81,6 +87,7 @@ Status S3OutputStream::close() {
         RETURN_IF_ERROR(singlepart_upload());
     } else {
         RETURN_IF_ERROR(multipart_upload());
+        RETURN_IF_ERROR(wait_inflight_parts(0));
         RETURN_IF_ERROR(complete_multipart_upload());
     }
     _client = nullptr;
@@ -123,12 +130,22 @@ Status S3OutputStream::multipart_upload() {
     if (_buffer.empty()) {
         return Status::OK();
     }
+    if (_max_inflight_parts > 1) {
+        RETURN_IF_ERROR(wait_inflight_parts(_max_inflight_parts - 1));
+    }
     Aws::S3::Model::UploadPartRequest req;
     req.SetBucket(_bucket);
     req.SetKey(_object);
-    req.SetPartNumber(static_cast<int>(_etags.size() + 1));
+    req.SetPartNumber(static_cast<int>(_etags.size() + _inflight_parts.size() + 1));
     req.SetUploadId(_upload_id);
     req.SetContentLength(static_cast<int64_t>(_buffer.size()));
+    if (_max_inflight_parts > 1) {
+        auto buffer = std::make_unique<Aws::String>(std::move(_buffer));
+        _buffer.clear();
+        req.SetBody(Aws::MakeShared<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, buffer->data(), buffer->size()));
+        _inflight_parts.push_back({std::move(buffer), _client->UploadPartCallable(req)});
+        return Status::OK();
+    }
     req.SetBody(Aws::MakeShared<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, _buffer.data(), _buffer.size()));
     auto outcome = _client->UploadPart(req);
     if (outcome.IsSuccess()) {
@@ -139,6 +156,21 @@ Status S3OutputStream::multipart_upload() {
             fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
 }
 
+Status S3OutputStream::wait_inflight_parts(size_t max_parts) {
+    Status status;
+    while (_inflight_parts.size() > max_parts) {
+        auto outcome = _inflight_parts.front().outcome.get();
+        _inflight_parts.pop_front();
+        if (!outcome.IsSuccess()) {
+            status.update(Status::IOError(fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object,
+                                                      outcome.GetError().GetMessage())));
+        } else if (status.ok()) {
+            _etags.push_back(outcome.GetResult().GetETag());
+        }
+    }
+    return status;
+}
+
 Status S3OutputStream::complete_multipart_upload() {
     VLOG(12) << "Completing multipart upload s3://" << _bucket << "/" << _object;
     DCHECK(!_upload_id.empty());
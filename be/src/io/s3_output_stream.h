@@ -16,16 +16,21 @@
 
 #include <aws/s3/S3Client.h>
 
+#include <deque>
+#include <memory>
+
 #include "io/output_stream.h"
 
 namespace starrocks::io {
 
 class S3OutputStream : public OutputStream {
 public:
+    // Up to |max_inflight_parts| parts of a multipart upload are uploaded in the background while the following
+    // data is written, 1 means uploading each part synchronously.
     explicit S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
-                            int64_t max_single_part_size, int64_t min_upload_part_size);
+                            int64_t max_single_part_size, int64_t min_upload_part_size, int64_t max_inflight_parts = 1);
 
-    ~S3OutputStream() override = default;
+    ~S3OutputStream() override;
 
     // Disallow copy and assignment
     S3OutputStream(const S3OutputStream&) = delete;
@@ -54,15 +59,25 @@ private:
     Status multipart_upload();
     Status singlepart_upload();
     Status complete_multipart_upload();
+    // wait for the oldest inflight parts until at most |max_parts| are left.
+    Status wait_inflight_parts(size_t max_parts);
+
+    struct InflightPart {
+        // the body of the request, kept alive until the part is uploaded
+        std::unique_ptr<Aws::String> buffer;
+        Aws::S3::Model::UploadPartOutcomeCallable outcome;
+    };
 
     std::shared_ptr<Aws::S3::S3Client> _client;
     const Aws::String _bucket;
     const Aws::String _object;
     const int64_t _max_single_part_size;
     const int64_t _min_upload_part_size;
+    const int64_t _max_inflight_parts;
     Aws::String _buffer;
     Aws::String _upload_id;
     std::vector<Aws::String> _etags;
+    std::deque<InflightPart> _inflight_parts;
 };
 
 } // namespace starrocks::io
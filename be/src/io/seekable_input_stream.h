@@ -14,12 +14,20 @@
 
 #pragma once
 
+#include <span>
+
 #include "io/input_stream.h"
 
 namespace starrocks::io {
 
 class SeekableInputStream : public InputStream {
 public:
+    struct ReadRequest {
+        int64_t offset;
+        void* out;
+        int64_t count;
+    };
+
     ~SeekableInputStream() override = default;
 
     // Repositions the offset of the InputStream to the argument |position|.
@@ -57,6 +65,16 @@ public:
     // ```
     virtual Status read_at_fully(int64_t offset, void* out, int64_t count);
 
+    // Read all the |requests|, each one as if by `read_at_fully()`. The position
+    // of the stream after this call is unspecified.
+    // Implementations may serve several requests with one IO operation.
+    //
+    // Default implementation:
+    // ```
+    //    for (auto& r : requests) RETURN_IF_ERROR(read_at_fully(r.offset, r.out, r.count));
+    // ```
+    virtual Status read_at_fully_batch(std::span<const ReadRequest> requests);
+
     // Return the total file size in bytes, or error.
     virtual StatusOr<int64_t> get_size() = 0;
 
@@ -128,6 +146,10 @@ public:
         return _impl->read_at_fully(offset, out, count);
     }
 
+    Status read_at_fully_batch(std::span<const ReadRequest> requests) override {
+        return _impl->read_at_fully_batch(requests);
+    }
+
     StatusOr<int64_t> get_size() override { return _impl->get_size(); }
 
     Status seek(int64_t offset) override { return _impl->seek(offset); }
@@ -19,14 +19,54 @@
 #include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
+#include "util/priority_thread_pool.hpp"
 #include "util/runtime_profile.h"
+#include "util/stopwatch.hpp"
 
 namespace starrocks::io {
 
+void IOCostModel::update(int64_t bytes, int64_t time_ns) {
+    if (bytes <= 0 || time_ns <= 0) {
+        return;
+    }
+    const double x = static_cast<double>(bytes);
+    const double y = static_cast<double>(time_ns);
+    std::lock_guard<std::mutex> l(_mutex);
+    _sum_w = _sum_w * kDecay + 1;
+    _sum_x = _sum_x * kDecay + x;
+    _sum_y = _sum_y * kDecay + y;
+    _sum_xx = _sum_xx * kDecay + x * x;
+    _sum_xy = _sum_xy * kDecay + x * y;
+}
+
+int64_t IOCostModel::break_even_distance(int64_t default_value) const {
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_sum_w < kMinSamples) {
+        return default_value;
+    }
+    const double denominator = _sum_w * _sum_xx - _sum_x * _sum_x;
+    // all the samples have (almost) the same size, latency and bandwidth can not be told apart.
+    if (denominator <= 1e-9 * _sum_w * _sum_xx) {
+        return default_value;
+    }
+    // time per byte and first-byte latency, in nanoseconds.
+    const double slope = (_sum_w * _sum_xy - _sum_x * _sum_y) / denominator;
+    const double intercept = (_sum_y - slope * _sum_x) / _sum_w;
+    if (slope <= 0 || intercept <= 0) {
+        return default_value;
+    }
+    return static_cast<int64_t>(std::min(intercept / slope, static_cast<double>(INT64_MAX / 2)));
+}
+
 SharedBufferedInputStream::SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename,
                                                      size_t file_size)
         : _stream(std::move(stream)), _filename(std::move(filename)), _file_size(file_size) {}
 
+SharedBufferedInputStream::~SharedBufferedInputStream() {
+    // the prefetch tasks read from `_stream`, whose resources may be owned by the caller.
+    _wait_prefetch(_map.begin(), _map.end());
+}
+
 void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t file_size) {
     if (align_size != 0) {
         offset = raw_offset / align_size * align_size;
@@ -66,8 +106,16 @@ Status SharedBufferedInputStream::_sort_and_check_overlap(std::vector<IORange>&
     return Status::OK();
 }
 
+int64_t SharedBufferedInputStream::_max_dist_size() const {
+    if (_cost_model == nullptr) {
+        return _options.max_dist_size;
+    }
+    return std::min(_cost_model->break_even_distance(_options.max_dist_size), _options.max_buffer_size);
+}
+
 void SharedBufferedInputStream::_merge_small_ranges(const std::vector<IORange>& small_ranges) {
     if (small_ranges.size() > 0) {
+        const int64_t max_dist_size = _max_dist_size();
         auto update_map = [&](size_t from, size_t to) {
             // merge from [unmerge, i-1]
             int64_t ref_count = (to - from + 1);
@@ -86,7 +134,7 @@ void SharedBufferedInputStream::_merge_small_ranges(const std::vector<IORange>&
             size_t now_end = now.offset + now.size;
             size_t prev_end = prev.offset + prev.size;
             if (((now_end - small_ranges[unmerge].offset) <= _options.max_buffer_size) &&
-                (now.offset - prev_end) <= _options.max_dist_size) {
+                (now.offset - prev_end) <= max_dist_size) {
                 continue;
             } else {
                 update_map(unmerge, i - 1);
@@ -215,6 +263,12 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
     }
 
     SharedBuffer& sb = *shared_buffer;
+    if (sb.buffer.capacity() == 0 && sb.prefetch_status.valid()) {
+        // the time waiting for the prefetch is the io time not overlapped with the computation.
+        SCOPED_RAW_TIMER(&_shared_io_timer);
+        RETURN_IF_ERROR(sb.prefetch_status.get());
+        sb.buffer.swap(sb.prefetch_buffer);
+    }
     if (sb.buffer.capacity() == 0) {
         RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
         SCOPED_RAW_TIMER(&_shared_io_timer);
@@ -226,18 +280,67 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
             _shared_align_io_bytes += sb.size - sb.raw_size;
         }
         sb.buffer.reserve(sb.size);
-        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+        RETURN_IF_ERROR(_read_at_fully(sb.offset, sb.buffer.data(), sb.size));
     }
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
 }
 
+void SharedBufferedInputStream::prefetch(int64_t offset, int64_t count) {
+    if (_prefetch_executor == nullptr) {
+        return;
+    }
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    for (auto it = _map.upper_bound(offset); it != _map.end(); ++it) {
+        SharedBufferPtr sb = it->second;
+        if (sb->raw_offset >= offset + count) {
+            break;
+        }
+        if (sb->raw_offset < offset || sb->buffer.capacity() != 0 || sb->prefetch_status.valid()) {
+            continue;
+        }
+        if (!mem_tracker->check_mem_limit("prefetch shared buffer").ok()) {
+            return;
+        }
+        auto promise = std::make_shared<std::promise<Status>>();
+        sb->prefetch_status = promise->get_future();
+        // the stream waits for all the prefetch tasks before the buffers are released, so `this` outlives them.
+        auto task = [this, sb, promise, mem_tracker]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            sb->prefetch_buffer.reserve(sb->size);
+            promise->set_value(_read_at_fully(sb->offset, sb->prefetch_buffer.data(), sb->size));
+        };
+        if (!_prefetch_executor->try_offer(std::move(task))) {
+            // the executor is busy, the buffer will be read on demand.
+            sb->prefetch_status = std::future<Status>();
+            return;
+        }
+        _prefetch_io_count += 1;
+        _shared_io_count += 1;
+        _shared_io_bytes += sb->size;
+        if (sb->size > sb->raw_size) {
+            _shared_align_io_bytes += sb->size - sb->raw_size;
+        }
+    }
+}
+
+void SharedBufferedInputStream::_wait_prefetch(std::map<int64_t, SharedBufferPtr>::iterator begin,
+                                               std::map<int64_t, SharedBufferPtr>::iterator end) {
+    for (auto it = begin; it != end; ++it) {
+        if (it->second->prefetch_status.valid()) {
+            it->second->prefetch_status.wait();
+        }
+    }
+}
+
 void SharedBufferedInputStream::release() {
+    _wait_prefetch(_map.begin(), _map.end());
     _map.clear();
 }
 
 void SharedBufferedInputStream::release_to_offset(int64_t offset) {
     auto it = _map.upper_bound(offset);
+    _wait_prefetch(_map.begin(), it);
     _map.erase(_map.begin(), it);
 }
 
@@ -247,7 +350,7 @@ Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64
         SCOPED_RAW_TIMER(&_direct_io_timer);
         _direct_io_count += 1;
         _direct_io_bytes += count;
-        RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
+        RETURN_IF_ERROR(_read_at_fully(offset, out, count));
         return Status::OK();
     }
     const uint8_t* buffer = nullptr;
@@ -256,11 +359,24 @@ Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64
     return Status::OK();
 }
 
+Status SharedBufferedInputStream::_read_at_fully(int64_t offset, void* out, int64_t count) {
+    std::lock_guard<std::mutex> l(_stream_mutex);
+    if (_cost_model == nullptr) {
+        return _stream->read_at_fully(offset, out, count);
+    }
+    MonotonicStopWatch watch;
+    watch.start();
+    RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
+    _cost_model->update(count, watch.elapsed_time());
+    return Status::OK();
+}
+
 StatusOr<int64_t> SharedBufferedInputStream::get_size() {
     return _file_size;
 }
 
 StatusOr<int64_t> SharedBufferedInputStream::read(void* data, int64_t count) {
+    std::lock_guard<std::mutex> l(_stream_mutex);
     auto n = _stream->read_at(_offset, data, count);
     RETURN_IF_ERROR(n);
     _offset += n.value();
@@ -16,13 +16,44 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/seekable_input_stream.h"
 
+namespace starrocks {
+class PriorityThreadPool;
+}
+
 namespace starrocks::io {
 
+// Learns the cost of a read request on a storage from the observed reads, by fitting
+// `time = first_byte_latency + bytes / bandwidth` with exponentially decayed least squares,
+// so that it follows the changes of the storage. Thread safe, one model can be shared by all
+// the streams of the same storage.
+class IOCostModel {
+public:
+    void update(int64_t bytes, int64_t time_ns);
+
+    // The gap size that takes as long to transfer as the first-byte latency of one request,
+    // i.e. first_byte_latency * bandwidth. Reading through a smaller gap is cheaper than issuing
+    // one more request. Returns `default_value` until the model has enough samples.
+    int64_t break_even_distance(int64_t default_value) const;
+
+private:
+    static constexpr double kDecay = 0.99;
+    static constexpr double kMinSamples = 16;
+
+    mutable std::mutex _mutex;
+    double _sum_w = 0;
+    double _sum_x = 0;
+    double _sum_y = 0;
+    double _sum_xx = 0;
+    double _sum_xy = 0;
+};
+
 class SharedBufferedInputStream : public SeekableInputStream {
 public:
     struct IORange {
@@ -47,16 +78,21 @@ public:
         int64_t size;
         int64_t ref_count;
         std::vector<uint8_t> buffer;
+        // valid while the buffer is prefetched in the background, `prefetch_buffer` holds the data until
+        // the reader waits for it and moves it into `buffer`.
+        std::future<Status> prefetch_status;
+        std::vector<uint8_t> prefetch_buffer;
         void align(int64_t align_size, int64_t file_size);
         std::string debug_string() const;
     };
     using SharedBufferPtr = std::shared_ptr<SharedBuffer>;
 
     SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename, size_t file_size);
-    ~SharedBufferedInputStream() override = default;
+    ~SharedBufferedInputStream() override;
 
     Status seek(int64_t position) override {
         _offset = position;
+        std::lock_guard<std::mutex> l(_stream_mutex);
         return _stream->seek(position);
     }
     StatusOr<int64_t> position() override { return _offset; }
@@ -65,6 +101,7 @@ public:
     StatusOr<int64_t> get_size() override;
     Status skip(int64_t count) override {
         _offset += count;
+        std::lock_guard<std::mutex> l(_stream_mutex);
         return _stream->skip(count);
     }
 
@@ -82,6 +119,18 @@ public:
     void release();
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
     void set_align_size(int64_t size) { _align_size = size; }
+    // When set, the merge distance of the io ranges is derived from the model instead of
+    // `CoalesceOptions::max_dist_size`, and all the reads of this stream feed the model.
+    void set_cost_model(IOCostModel* model) { _cost_model = model; }
+    // Enables `prefetch()`, the prefetch tasks run on `executor`.
+    void set_prefetch_executor(PriorityThreadPool* executor) { _prefetch_executor = executor; }
+    // Starts reading the shared buffers within [offset, offset + count) in the background, so that their IO
+    // overlaps with the decoding of the data before them. The buffers must be set by `set_io_ranges` before.
+    void prefetch(int64_t offset, int64_t count);
+
+    // Read from the underlying stream without looking up the shared buffers, it is safe to be called by
+    // the background tasks while the reader is using this stream. The read is not counted in the io stats.
+    Status read_directly(int64_t offset, void* out, int64_t count) { return _read_at_fully(offset, out, count); }
 
     int64_t shared_io_count() const { return _shared_io_count; }
     int64_t shared_io_bytes() const { return _shared_io_bytes; }
@@ -90,6 +139,7 @@ public:
     int64_t direct_io_count() const { return _direct_io_count; }
     int64_t direct_io_bytes() const { return _direct_io_bytes; }
     int64_t direct_io_timer() const { return _direct_io_timer; }
+    int64_t prefetch_io_count() const { return _prefetch_io_count; }
     int64_t estimated_mem_usage() const { return _estimated_mem_usage; }
     // each SharedBuffer may contain several ranges, the return the ref sum
     int64_t current_range_ref_sum() const;
@@ -101,14 +151,22 @@ public:
 
 private:
     void _update_estimated_mem_usage();
+    int64_t _max_dist_size() const;
+    Status _read_at_fully(int64_t offset, void* out, int64_t count);
+    void _wait_prefetch(std::map<int64_t, SharedBufferPtr>::iterator begin,
+                        std::map<int64_t, SharedBufferPtr>::iterator end);
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
     Status _set_io_ranges_active_and_lazy_columns(const std::vector<IORange>& ranges);
     const std::shared_ptr<SeekableInputStream> _stream;
+    // `_stream` is not thread safe, serializes the reads of the prefetch tasks and the reader.
+    std::mutex _stream_mutex;
     const std::string _filename;
     std::map<int64_t, SharedBufferPtr> _map;
     CoalesceOptions _options;
+    IOCostModel* _cost_model = nullptr;
+    PriorityThreadPool* _prefetch_executor = nullptr;
     int64_t _offset = 0;
     int64_t _file_size = 0;
     int64_t _shared_io_count = 0;
@@ -118,6 +176,7 @@ private:
     int64_t _direct_io_count = 0;
     int64_t _direct_io_bytes = 0;
     int64_t _direct_io_timer = 0;
+    int64_t _prefetch_io_count = 0;
     int64_t _align_size = 0;
     int64_t _estimated_mem_usage = 0;
 };
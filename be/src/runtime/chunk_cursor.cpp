@@ -46,6 +46,10 @@ ChunkCursor::ChunkCursor(ChunkSupplier chunk_supplier, ChunkProbeSupplier chunk_
             _null_first_flag[i] = (*is_null_first)[i] ? 1 : -1;
         }
     }
+    if (col_num > 0) {
+        _first_is_asc = (*is_asc)[0];
+        _first_null_first = (*is_null_first)[0];
+    }
 
     if (!_is_pipeline) {
         _reset_with_next_chunk();
@@ -59,6 +63,13 @@ bool ChunkCursor::operator<(const ChunkCursor& cursor) const {
     // both cursors must be pointing to valid data.
     DCHECK(_current_pos >= 0 && _current_chunk != nullptr);
     DCHECK(cursor._current_pos >= 0 && cursor._current_chunk != nullptr);
+    if (!_current_prefixes.empty() && !cursor._current_prefixes.empty()) {
+        uint64_t prefix = _current_prefixes[_current_pos];
+        uint64_t other_prefix = cursor._current_prefixes[cursor._current_pos];
+        if (prefix != other_prefix) {
+            return prefix < other_prefix;
+        }
+    }
     const size_t number_of_order_by_columns = _current_order_by_columns.size();
     bool is_ahead = true;
     for (size_t col_index = 0; col_index < number_of_order_by_columns; ++col_index) {
@@ -146,6 +157,7 @@ bool ChunkCursor::chunk_has_supplier() {
 
 void ChunkCursor::_reset_with_next_chunk() {
     _current_order_by_columns.clear();
+    _current_prefixes.clear();
     Chunk* tmp_chunk = nullptr;
     (void)_chunk_supplier(&tmp_chunk);
     _current_chunk.reset(tmp_chunk);
@@ -153,17 +165,12 @@ void ChunkCursor::_reset_with_next_chunk() {
     if (_current_chunk == nullptr) {
         return;
     }
-
-    // prepare order by columns
-    _current_order_by_columns.reserve(_sort_exprs->size());
-    for (ExprContext* expr_ctx : *_sort_exprs) {
-        auto col = EVALUATE_NULL_IF_ERROR(expr_ctx, expr_ctx->root(), _current_chunk.get());
-        _current_order_by_columns.push_back(std::move(col));
-    }
+    _prepare_order_by_columns();
 }
 
 void ChunkCursor::next_chunk_for_pipeline() {
     _current_order_by_columns.clear();
+    _current_prefixes.clear();
     Chunk* tmp_chunk = nullptr;
     _chunk_probe_supplier(&tmp_chunk);
     _current_chunk.reset(tmp_chunk);
@@ -172,13 +179,19 @@ void ChunkCursor::next_chunk_for_pipeline() {
         return;
     }
     DCHECK(!_current_chunk->is_empty());
+    _prepare_order_by_columns();
+}
 
-    // prepare order by columns
+void ChunkCursor::_prepare_order_by_columns() {
     _current_order_by_columns.reserve(_sort_exprs->size());
     for (ExprContext* expr_ctx : *_sort_exprs) {
         auto col = EVALUATE_NULL_IF_ERROR(expr_ctx, expr_ctx->root(), _current_chunk.get());
         _current_order_by_columns.push_back(std::move(col));
     }
+    if (!_current_order_by_columns.empty()) {
+        (void)ColumnHelper::encode_sort_key_prefixes(*_current_order_by_columns[0], _first_is_asc, _first_null_first,
+                                                     &_current_prefixes);
+    }
 }
 
 SimpleChunkSortCursor::SimpleChunkSortCursor(ChunkProvider chunk_provider, const std::vector<ExprContext*>* sort_exprs)
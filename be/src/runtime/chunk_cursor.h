@@ -77,6 +77,7 @@ public:
 
 private:
     void _reset_with_next_chunk();
+    void _prepare_order_by_columns();
 
 private:
     ChunkSupplier _chunk_supplier;
@@ -94,6 +95,11 @@ private:
     std::vector<int> _sort_order_flag; // 1 for ascending, -1 for descending.
     std::vector<int> _null_first_flag; // 1 for greatest, -1 for least.
     bool _is_pipeline;
+    // The prefixes of the first order by column of the current chunk, compared before the columns, or empty if its
+    // type has no encoding.
+    std::vector<uint64_t> _current_prefixes;
+    bool _first_is_asc = true;
+    bool _first_null_first = true;
 };
 
 // SimpleChunkCursor a simple cursor over the SenderQueue, avoid copy the chunk
@@ -14,7 +14,9 @@
 
 #include "runtime/current_thread.h"
 
+#include "common/config.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/allocation_samples.h"
 #include "storage/storage_engine.h"
 
 namespace starrocks {
@@ -47,6 +49,22 @@ starrocks::MemTracker* CurrentThread::singleton_check_mem_tracker() {
     return tls_singleton_check_mem_tracker;
 }
 
+void CurrentThread::_take_allocation_sample(int64_t size) {
+    int64_t interval = config::mem_alloc_sample_interval_bytes;
+    if (interval <= 0) {
+        // Check the config again after some allocations.
+        _bytes_until_allocation_sample = 64L * 1024 * 1024;
+        return;
+    }
+    // A large allocation may cover several intervals, the sample stands for all of them.
+    int64_t num_intervals = -_bytes_until_allocation_sample / interval + 1;
+    _bytes_until_allocation_sample += num_intervals * interval;
+    MemTracker* tracker = tls_operator_mem_tracker;
+    if (tracker != nullptr && tracker->allocation_samples() != nullptr) {
+        tracker->allocation_samples()->record(size, num_intervals * interval);
+    }
+}
+
 CurrentThread& CurrentThread::current() {
     return tls_thread_status;
 }
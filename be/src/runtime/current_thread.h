@@ -242,6 +242,9 @@ public:
     const starrocks::TUniqueId& fragment_instance_id() { return _fragment_instance_id; }
     void set_pipeline_driver_id(int32_t driver_id) { _driver_id = driver_id; }
     int32_t get_driver_id() const { return _driver_id; }
+    // The id of the workgroup of the pipeline driver running on this thread, or -1 if none.
+    void set_workgroup_id(int64_t workgroup_id) { _workgroup_id = workgroup_id; }
+    int64_t workgroup_id() const { return _workgroup_id; }
 
     void set_custom_coredump_msg(const std::string& custom_coredump_msg) { _custom_coredump_msg = custom_coredump_msg; }
 
@@ -295,11 +298,13 @@ public:
     void mem_consume(int64_t size) {
         _mem_cache_manager.consume(size);
         _operator_mem_cache_manager.consume(size);
+        _sample_allocation(size);
     }
 
     bool try_mem_consume(int64_t size) {
         if (_mem_cache_manager.try_mem_consume(size)) {
             _operator_mem_cache_manager.consume(size);
+            _sample_allocation(size);
             return true;
         }
         return false;
@@ -360,6 +365,16 @@ public:
     int64_t get_consumed_bytes() const { return _mem_cache_manager.get_consumed_bytes(); }
 
 private:
+    // Samples an allocation of each config::mem_alloc_sample_interval_bytes bytes allocated by the thread into the
+    // AllocationSamples of the operator mem tracker.
+    void _sample_allocation(int64_t size) {
+        _bytes_until_allocation_sample -= size;
+        if (UNLIKELY(_bytes_until_allocation_sample < 0)) {
+            _take_allocation_sample(size);
+        }
+    }
+    void _take_allocation_sample(int64_t size);
+
     // In order to record operator level memory trace while keep up high performance, we need to
     // record the normal MemTracker's tree and operator's isolated MemTracker independently.
     // `tls_operator_mem_tracker` will be updated every time when `Operator::pull_chunk` or `Operator::push_chunk`
@@ -372,6 +387,8 @@ private:
     TUniqueId _fragment_instance_id;
     std::string _custom_coredump_msg{};
     int32_t _driver_id = 0;
+    int64_t _workgroup_id = -1;
+    int64_t _bytes_until_allocation_sample = 0;
     bool _check = true;
     bool _reserve_mod = false;
 };
@@ -509,6 +526,10 @@ private:
     SET_TRACE_INFO(driver_id, query_id, fragment_instance_id)            \
     auto VARNAME_LINENUM(defer) = DeferOp([] { RESET_TRACE_INFO() });
 
+#define SCOPED_SET_WORKGROUP_ID(workgroup_id)                \
+    CurrentThread::current().set_workgroup_id(workgroup_id); \
+    auto VARNAME_LINENUM(defer) = DeferOp([] { CurrentThread::current().set_workgroup_id(-1); });
+
 #define SCOPED_SET_CUSTOM_COREDUMP_MSG(custom_coredump_msg)                \
     CurrentThread::current().set_custom_coredump_msg(custom_coredump_msg); \
     auto VARNAME_LINENUM(defer) = DeferOp([] { CurrentThread::current().set_custom_coredump_msg({}); });
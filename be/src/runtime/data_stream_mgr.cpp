@@ -147,6 +147,31 @@ Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::goog
         // errors from receiver-initiated teardowns.
         VLOG_QUERY << request.sender_id() << " sender transmits chunks to a non-existing receiver fragment "
                    << print_id(request.finst_id());
+        if (request.fanout_finst_ids_size() == 0) {
+            return Status::OK();
+        }
+    }
+
+    bool eos = request.eos();
+    // The broadcast chunks are sent once and added to all the receivers of the fragment instances on this BE.
+    // The request may be released once the closure is run by the receiver that holds it, so they are added
+    // before the chunks of the original receiver, which is the only one that can hold the closure.
+    for (const auto& fanout_finst_id : request.fanout_finst_ids()) {
+        TUniqueId t_fanout_finst_id;
+        t_fanout_finst_id.hi = fanout_finst_id.hi();
+        t_fanout_finst_id.lo = fanout_finst_id.lo();
+        std::shared_ptr<DataStreamRecvr> fanout_recvr = find_recvr(t_fanout_finst_id, request.node_id());
+        if (fanout_recvr == nullptr) {
+            continue;
+        }
+        if (request.chunks_size() > 0) {
+            RETURN_IF_ERROR(fanout_recvr->add_chunks(request, nullptr));
+        }
+        if (eos) {
+            fanout_recvr->remove_sender(request.sender_id(), request.be_number());
+        }
+    }
+    if (recvr == nullptr) {
         return Status::OK();
     }
 
@@ -157,7 +182,6 @@ Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::goog
         recvr->add_sub_plan_statistics(request.query_statistics(), request.sender_id());
     }
 
-    bool eos = request.eos();
     DeferOp op([&eos, &recvr, &request]() {
         if (eos) {
             recvr->remove_sender(request.sender_id(), request.be_number());
@@ -41,12 +41,14 @@
 #include <utility>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/sort_exec_exprs.h"
 #include "gen_cpp/data.pb.h"
 #include "runtime/chunk_cursor.h"
 #include "runtime/current_thread.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
 #include "runtime/sender_queue.h"
 #include "runtime/sorted_chunks_merger.h"
 #include "util/compression/block_compression.h"
@@ -195,6 +197,23 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
     }
 }
 
+bool DataStreamRecvr::exceeds_elastic_limit(int chunk_size) {
+    const size_t buffered_bytes = _num_buffered_bytes + chunk_size;
+    if (buffered_bytes <= _total_buffer_limit) {
+        return false;
+    }
+    const double factor = config::exchange_recvr_elastic_buffer_factor;
+    if (factor <= 1 || buffered_bytes > _total_buffer_limit * factor) {
+        return true;
+    }
+    // Only a query with a known memory budget can tell whether the extra buffer is affordable.
+    if (_query_mem_tracker == nullptr || !_query_mem_tracker->has_limit()) {
+        return true;
+    }
+    return _query_mem_tracker->limit_exceeded_by_ratio(config::exchange_recvr_elastic_buffer_mem_ratio) ||
+           (_query_mem_tracker->parent() != nullptr && _query_mem_tracker->parent()->limit_exceeded());
+}
+
 void DataStreamRecvr::bind_profile(int32_t driver_sequence, const std::shared_ptr<RuntimeProfile>& profile) {
     DCHECK(profile != nullptr);
     DCHECK_GE(driver_sequence, 0);
@@ -247,6 +266,7 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
     int use_sender_id = _is_merging ? request.sender_id() : 0;
     // Add all batches to the same queue if _is_merging is false.
 
+    DeferOp notify([this] { _observable.notify_observers(); });
     if (_keep_order) {
         DCHECK(_is_pipeline);
         return _sender_queues[use_sender_id]->add_chunks_and_keep_order(request, metrics, done);
@@ -258,12 +278,14 @@ Status DataStreamRecvr::add_chunks(const PTransmitChunkParams& request, ::google
 void DataStreamRecvr::remove_sender(int sender_id, int be_number) {
     int use_sender_id = _is_merging ? sender_id : 0;
     _sender_queues[use_sender_id]->decrement_senders(be_number);
+    _observable.notify_observers();
 }
 
 void DataStreamRecvr::cancel_stream() {
     for (auto& _sender_queue : _sender_queues) {
         _sender_queue->cancel();
     }
+    _observable.notify_observers();
 }
 
 void DataStreamRecvr::close() {
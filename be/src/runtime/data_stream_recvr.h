@@ -39,6 +39,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "exec/pipeline/pipeline_observable.h"
 #include "exec/sorting/merge_path.h"
 #include "gen_cpp/Types_types.h" // for TUniqueId
 #include "runtime/descriptors.h"
@@ -132,6 +133,9 @@ public:
 
     bool get_encode_level() const { return _encode_level; }
 
+    // Notified when chunks arrive, a sender finishes or the stream is cancelled.
+    pipeline::PipelineObservable* observable() { return &_observable; }
+
 private:
     friend class DataStreamMgr;
     class SenderQueue;
@@ -159,6 +163,10 @@ private:
     // total buffer limit.
     bool exceeds_limit(int chunk_size) { return _num_buffered_bytes + chunk_size > _total_buffer_limit; }
 
+    // Like exceeds_limit, but tolerates buffering up to `exchange_recvr_elastic_buffer_factor` times of the
+    // limit while the query has enough memory headroom, so a slow consumer does not stall the senders at once.
+    bool exceeds_elastic_limit(int chunk_size);
+
     // Return a metrics for current rpc in round-robin manner.
     Metrics& get_metrics_round_robin() { return _metrics[_rpc_round_roubin_index++ % _metrics.size()]; }
 
@@ -248,6 +256,8 @@ private:
 
     int _encode_level;
     bool _closed = false;
+
+    pipeline::PipelineObservable _observable;
 };
 
 } // end namespace starrocks
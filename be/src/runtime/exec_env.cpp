@@ -407,6 +407,32 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_dictionary_cache_pool));
 
+    if (config::parquet_writer_encode_thread_pool_thread_num >= 0) {
+        int num_encode_threads = config::parquet_writer_encode_thread_pool_thread_num;
+        if (num_encode_threads == 0) {
+            num_encode_threads = CpuInfo::num_cores();
+        }
+        RETURN_IF_ERROR(ThreadPoolBuilder("parquet_encode") // thread pool for encoding the parquet columns of sinks
+                                .set_min_threads(0)
+                                .set_max_threads(num_encode_threads)
+                                .set_max_queue_size(INT32_MAX)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                                .build(&_parquet_writer_encode_pool));
+    }
+
+    if (config::lake_segment_finalize_thread_num >= 0) {
+        int num_finalize_threads = config::lake_segment_finalize_thread_num;
+        if (num_finalize_threads == 0) {
+            num_finalize_threads = CpuInfo::num_cores();
+        }
+        RETURN_IF_ERROR(ThreadPoolBuilder("lake_seg_finalize") // thread pool for finalizing the lake segments
+                                .set_min_threads(0)
+                                .set_max_threads(num_finalize_threads)
+                                .set_max_queue_size(INT32_MAX)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                                .build(&_lake_segment_finalize_pool));
+    }
+
     _max_executor_threads = CpuInfo::num_cores();
     if (config::pipeline_exec_thread_pool_thread_num > 0) {
         _max_executor_threads = config::pipeline_exec_thread_pool_thread_num;
@@ -653,6 +679,14 @@ void ExecEnv::stop() {
         _dictionary_cache_pool->shutdown();
     }
 
+    if (_parquet_writer_encode_pool) {
+        _parquet_writer_encode_pool->shutdown();
+    }
+
+    if (_lake_segment_finalize_pool) {
+        _lake_segment_finalize_pool->shutdown();
+    }
+
 #ifndef BE_TEST
     close_s3_clients();
 #endif
@@ -709,6 +743,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_lake_replication_txn_manager);
     SAFE_DELETE(_cache_mgr);
     _dictionary_cache_pool.reset();
+    _parquet_writer_encode_pool.reset();
+    _lake_segment_finalize_pool.reset();
     _automatic_partition_pool.reset();
     _metrics = nullptr;
 }
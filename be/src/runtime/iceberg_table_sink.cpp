@@ -14,6 +14,8 @@
 
 #include "iceberg_table_sink.h"
 
+#include <algorithm>
+
 #include "exprs/expr.h"
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
@@ -79,6 +81,23 @@ Status IcebergTableSink::decompose_to_pipeline(pipeline::OpFactories prev_operat
             connector::IcebergUtils::generate_parquet_field_ids(iceberg_table_desc->get_iceberg_schema()->fields);
     sink_ctx->column_evaluators = ColumnExprEvaluator::from_exprs(this->get_output_expr(), runtime_state);
     sink_ctx->fragment_context = fragment_ctx;
+    if (t_iceberg_sink.__isset.sort_column_names &&
+        t_iceberg_sink.sort_is_asc.size() == t_iceberg_sink.sort_column_names.size() &&
+        t_iceberg_sink.sort_nulls_first.size() == t_iceberg_sink.sort_column_names.size()) {
+        for (size_t i = 0; i < t_iceberg_sink.sort_column_names.size(); i++) {
+            auto iter = std::find(sink_ctx->column_names.begin(), sink_ctx->column_names.end(),
+                                  t_iceberg_sink.sort_column_names[i]);
+            // The rows are sorted by the prefix of the sort order found in the written columns.
+            if (iter == sink_ctx->column_names.end()) {
+                break;
+            }
+            formats::ParquetSortColumn sort_column;
+            sort_column.column_index = iter - sink_ctx->column_names.begin();
+            sort_column.is_asc = t_iceberg_sink.sort_is_asc[i];
+            sort_column.nulls_first = t_iceberg_sink.sort_nulls_first[i];
+            sink_ctx->sort_columns.push_back(sort_column);
+        }
+    }
 
     auto connector = connector::ConnectorManager::default_instance()->get(connector::Connector::ICEBERG);
     auto sink_provider = connector->create_data_sink_provider();
@@ -143,4 +143,50 @@ inline bool mul_overflow(int128_t a, int128_t b, int128_t* c) {
 #endif
 }
 
+// Branch-free int128 add/sub over arrays, used to evaluate the decimal128 arithmetics of a chunk without a branch
+// per row. An array of a const operand has only one element. overflows[i] is set to 1 if the i-th result overflows,
+// and return true if any result overflows.
+template <bool is_sub, bool lhs_is_const, bool rhs_is_const>
+inline bool int128_add_sub_overflow_batch(const int128_t* a, const int128_t* b, int128_t* c, uint8_t* overflows,
+                                          size_t n) {
+    uint8_t any_overflow = 0;
+    for (size_t i = 0; i < n; i++) {
+        const int128_t x = a[lhs_is_const ? 0 : i];
+        const int128_t y = b[rhs_is_const ? 0 : i];
+        int128_t z;
+        uint8_t overflow;
+        if constexpr (is_sub) {
+            z = static_cast<int128_t>(static_cast<uint128_t>(x) - static_cast<uint128_t>(y));
+            // x - y overflows iff x and y have different signs and z has a different sign from x.
+            overflow = ((x ^ y) & (x ^ z)) < 0;
+        } else {
+            z = static_cast<int128_t>(static_cast<uint128_t>(x) + static_cast<uint128_t>(y));
+            // x + y overflows iff z has a different sign from both x and y.
+            overflow = ((x ^ z) & (y ^ z)) < 0;
+        }
+        c[i] = z;
+        overflows[i] |= overflow;
+        any_overflow |= overflow;
+    }
+    return any_overflow;
+}
+
+// Max absolute value of the int128 array, uint128 can represent the absolute value of the min int128.
+inline uint128_t int128_max_abs(const int128_t* a, size_t n) {
+    uint128_t max_abs = 0;
+    for (size_t i = 0; i < n; i++) {
+        const auto sign = static_cast<uint128_t>(a[i] >> 127);
+        const uint128_t abs = (static_cast<uint128_t>(a[i]) ^ sign) - sign;
+        max_abs = max_abs < abs ? abs : max_abs;
+    }
+    return max_abs;
+}
+
+// Return true if the product of any two values whose absolute values are at most max_abs_a and max_abs_b
+// can't overflow int128.
+inline bool int128_mul_never_overflow(uint128_t max_abs_a, uint128_t max_abs_b) {
+    static constexpr auto int128_max = static_cast<uint128_t>(get_max<int128_t>());
+    return max_abs_a == 0 || max_abs_b <= int128_max / max_abs_a;
+}
+
 } // namespace starrocks
@@ -21,6 +21,7 @@
 #include "runtime/snapshot_loader.h"
 #include "storage/lake/filenames.h"
 #include "storage/lake/tablet.h"
+#include "storage/protobuf_file.h"
 #include "util/network_util.h"
 #include "util/raw_container.h"
 
@@ -191,8 +192,12 @@ Status LakeSnapshotLoader::upload(const ::starrocks::UploadSnapshotsRequest* req
                 file_locations[segment] = tablet->segment_location(segment);
             }
         }
-        file_locations[starrocks::lake::tablet_metadata_filename(tablet_id, snapshot.version())] =
-                tablet->metadata_location(snapshot.version());
+        auto metadata_location = tablet->metadata_location(snapshot.version());
+        // The tablet metadata written by an aggregated publish is in a bundle, save it as a single file to upload.
+        if (!fs::path_exist(metadata_location)) {
+            RETURN_IF_ERROR(ProtobufFile(metadata_location).save(**tablet_metadata));
+        }
+        file_locations[starrocks::lake::tablet_metadata_filename(tablet_id, snapshot.version())] = metadata_location;
 
         for (auto& [file_name, file] : file_locations) {
             // calc md5sum of file
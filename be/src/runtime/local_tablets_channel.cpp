@@ -39,6 +39,7 @@
 #include "serde/protobuf_serde.h"
 #include "storage/delta_writer.h"
 #include "storage/memtable.h"
+#include "storage/memtable_flush_scheduler.h"
 #include "storage/segment_flush_executor.h"
 #include "storage/segment_replicate_executor.h"
 #include "storage/storage_engine.h"
@@ -78,6 +79,8 @@ LocalTabletsChannel::LocalTabletsChannel(LoadChannel* load_channel, const Tablet
     _wait_write_timer = ADD_CHILD_TIMER(_profile, "WaitWriteTime", "AddChunkTime");
     _wait_replica_timer = ADD_CHILD_TIMER(_profile, "WaitReplicaTime", "AddChunkTime");
     _wait_txn_persist_timer = ADD_CHILD_TIMER(_profile, "WaitTxnPersistTime", "AddChunkTime");
+    _schedule_flush_count = ADD_COUNTER(_profile, "ScheduleFlushCount", TUnit::UNIT);
+    _schedule_flush_bytes = ADD_COUNTER(_profile, "ScheduleFlushBytes", TUnit::BYTES);
 }
 
 LocalTabletsChannel::~LocalTabletsChannel() {
@@ -389,6 +392,7 @@ void LocalTabletsChannel::add_chunk(Chunk* chunk, const PTabletWriterAddChunkReq
     // which prevents triggering a flush,
     // we need to proactively perform a flush when memory resources are insufficient.
     _flush_stale_memtables();
+    _schedule_flush_memtables();
 
     if (close_channel) {
         // persist txn.
@@ -521,6 +525,52 @@ void LocalTabletsChannel::_flush_stale_memtables() {
     }
 }
 
+void LocalTabletsChannel::_schedule_flush_memtables() {
+    const int64_t ratio = config::memtable_flush_schedule_mem_ratio;
+    int64_t bytes_to_release = MemTableFlushScheduler::bytes_to_release(_mem_tracker, ratio);
+    if (_mem_tracker->parent() != nullptr) {
+        // other loads are flushing their memtables as well, so this one only releases its share
+        int64_t parent_bytes_to_release = MemTableFlushScheduler::bytes_to_release(_mem_tracker->parent(), ratio);
+        if (parent_bytes_to_release > 0 && _mem_tracker->parent()->consumption() > 0) {
+            parent_bytes_to_release = static_cast<int64_t>(static_cast<double>(parent_bytes_to_release) *
+                                                           _mem_tracker->consumption() /
+                                                           _mem_tracker->parent()->consumption());
+            bytes_to_release = std::max(bytes_to_release, parent_bytes_to_release);
+        }
+    }
+    if (bytes_to_release <= 0) {
+        return;
+    }
+
+    std::vector<AsyncDeltaWriter*> writers;
+    std::vector<MemTableFlushScheduler::Candidate> candidates;
+    writers.reserve(_delta_writers.size());
+    candidates.reserve(_delta_writers.size());
+    for (auto& [tablet_id, writer] : _delta_writers) {
+        auto& candidate = candidates.emplace_back();
+        candidate.write_buffer_size = writer->write_buffer_size();
+        candidate.last_write_ts = writer->last_write_ts();
+        candidate.flushed_segments = writer->get_flush_stats().flush_count;
+        candidate.queueing_memtables = writer->get_flush_stats().queueing_memtable_num;
+        writers.push_back(writer.get());
+    }
+    auto picked = MemTableFlushScheduler::pick(candidates, bytes_to_release, config::memtable_flush_schedule_min_bytes,
+                                               butil::gettimeofday_s());
+    int64_t total_flush_bytes = 0;
+    for (auto i : picked) {
+        total_flush_bytes += candidates[i].write_buffer_size;
+        writers[i]->flush();
+    }
+    if (!picked.empty()) {
+        COUNTER_UPDATE(_schedule_flush_count, picked.size());
+        COUNTER_UPDATE(_schedule_flush_bytes, total_flush_bytes);
+        VLOG(1) << "Schedule flush memtable txn_id: " << _txn_id << " bytes_to_release: " << bytes_to_release
+                << " total_flush_bytes: " << total_flush_bytes << " total_flush_writer: " << picked.size()
+                << " total_writer: " << _delta_writers.size() << " job_mem_usage: " << _mem_tracker->consumption()
+                << " job_mem_limit: " << _mem_tracker->limit();
+    }
+}
+
 void LocalTabletsChannel::_abort_replica_tablets(
         const PTabletWriterAddChunkRequest& request, const std::string& abort_reason,
         const std::unordered_map<int64_t, std::vector<int64_t>>& node_id_to_abort_tablets) {
@@ -179,6 +179,9 @@ private:
 
     void _flush_stale_memtables();
 
+    // Flush the memtables picked by MemTableFlushScheduler when the memory usage is high.
+    void _schedule_flush_memtables();
+
     LoadChannel* _load_channel;
 
     TabletsChannelKey _key;
@@ -250,6 +253,10 @@ private:
     RuntimeProfile::Counter* _wait_replica_timer = nullptr;
     // Accumulated time to wait for txn persist in add_chunk()
     RuntimeProfile::Counter* _wait_txn_persist_timer = nullptr;
+    // Number of memtables flushed by _schedule_flush_memtables()
+    RuntimeProfile::Counter* _schedule_flush_count = nullptr;
+    // Total write buffer size of the memtables flushed by _schedule_flush_memtables()
+    RuntimeProfile::Counter* _schedule_flush_bytes = nullptr;
 };
 
 std::shared_ptr<TabletsChannel> new_local_tablets_channel(LoadChannel* load_channel, const TabletsChannelKey& key,
@@ -36,6 +36,7 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "service/backend_options.h"
 
 namespace starrocks {
@@ -113,6 +114,12 @@ void MemTracker::Init() {
     }
     DCHECK_GT(_all_trackers.size(), 0);
     DCHECK_EQ(_all_trackers[0], this);
+
+    if ((_type == PROCESS || _type == QUERY_POOL) && config::mem_tracker_core_local_batch_bytes > 0) {
+        _core_local_consumption = std::make_unique<CoreLocalValue<int64_t>>(0);
+        _core_local_batch_bytes = config::mem_tracker_core_local_batch_bytes;
+        _max_unflushed_consumption = _core_local_batch_bytes * static_cast<int64_t>(_core_local_consumption->size());
+    }
 }
 
 MemTracker::~MemTracker() {
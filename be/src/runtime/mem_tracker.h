@@ -42,12 +42,14 @@
 #include <unordered_map>
 
 #include "common/status.h"
+#include "util/core_local.h"
 #include "util/metrics.h"
 #include "util/runtime_profile.h"
 #include "util/spinlock.h"
 
 namespace starrocks {
 
+class AllocationSamples;
 class MemTracker;
 class RuntimeState;
 
@@ -133,7 +135,10 @@ public:
     }
 
     // used for single mem_tracker
-    void set(int64_t bytes) { _consumption->set(bytes); }
+    void set(int64_t bytes) {
+        _drain_core_local_consumption();
+        _consumption->set(bytes);
+    }
 
     void update_allocation(int64_t bytes) {
         if (bytes <= 0) return;
@@ -154,7 +159,7 @@ public:
             return;
         }
         for (auto* tracker : _all_trackers) {
-            tracker->_consumption->add(bytes);
+            tracker->_add_consumption(bytes);
         }
     }
 
@@ -164,7 +169,7 @@ public:
             return;
         }
         for (size_t i = 0; i < _all_trackers.size() - 1; i++) {
-            _all_trackers[i]->_consumption->add(bytes);
+            _all_trackers[i]->_add_consumption(bytes);
         }
     }
 
@@ -180,7 +185,7 @@ public:
         }
         item.level = cur_level;
         item.limit = _limit;
-        item.cur_consumption = _consumption->current_value();
+        item.cur_consumption = consumption();
         item.peak_consumption = _consumption->value();
 
         (*items).emplace_back(item);
@@ -206,14 +211,14 @@ public:
             MemTracker* tracker = _all_trackers[i];
             const int64_t limit = tracker->limit();
             if (limit < 0) {
-                tracker->_consumption->add(bytes); // No limit at this tracker.
+                tracker->_add_consumption(bytes); // No limit at this tracker.
             } else {
-                if (LIKELY(tracker->_consumption->try_add(bytes, limit))) {
+                if (LIKELY(tracker->_try_add_consumption(bytes, limit))) {
                     continue;
                 } else {
                     // Failed for this mem tracker. Roll back the ones that succeeded.
                     for (int64_t j = _all_trackers.size() - 1; j > i; --j) {
-                        _all_trackers[j]->_consumption->add(-bytes);
+                        _all_trackers[j]->_add_consumption(-bytes);
                     }
                     return tracker;
                 }
@@ -237,14 +242,14 @@ public:
             }
             if (limit < 0) {
                 DCHECK_EQ(limit, -1);
-                tracker->_consumption->add(bytes); // No limit at this tracker.
+                tracker->_add_consumption(bytes); // No limit at this tracker.
             } else {
-                if (LIKELY(tracker->_consumption->try_add(bytes, limit))) {
+                if (LIKELY(tracker->_try_add_consumption(bytes, limit))) {
                     continue;
                 } else {
                     // Failed for this mem tracker. Roll back the ones that succeeded.
                     for (int64_t j = _all_trackers.size() - 1; j > i; --j) {
-                        _all_trackers[j]->_consumption->add(-bytes);
+                        _all_trackers[j]->_add_consumption(-bytes);
                     }
                     return tracker;
                 }
@@ -261,7 +266,7 @@ public:
             return;
         }
         for (auto* tracker : _all_trackers) {
-            tracker->_consumption->add(-bytes);
+            tracker->_add_consumption(-bytes);
         }
     }
 
@@ -271,7 +276,7 @@ public:
         }
 
         for (size_t i = 0; i < _all_trackers.size() - 1; i++) {
-            _all_trackers[i]->_consumption->add(-bytes);
+            _all_trackers[i]->_add_consumption(-bytes);
         }
     }
 
@@ -295,11 +300,11 @@ public:
         return nullptr;
     }
 
-    bool limit_exceeded() const { return _limit >= 0 && _limit < consumption(); }
+    bool limit_exceeded() const { return _limit >= 0 && _exceeds(_limit, 0); }
 
-    bool limit_exceeded_by_ratio(int64_t ratio) const { return _limit >= 0 && (_limit * ratio / 100) < consumption(); }
+    bool limit_exceeded_by_ratio(int64_t ratio) const { return _limit >= 0 && _exceeds(_limit * ratio / 100, 0); }
 
-    bool limit_exceeded_precheck(int64_t consume) const { return _limit >= 0 && _limit < consumption() + consume; }
+    bool limit_exceeded_precheck(int64_t consume) const { return _limit >= 0 && _exceeds(_limit, consume); }
 
     bool any_limit_exceeded_precheck(int64_t consume) const {
         for (auto& _limit_tracker : _limit_trackers) {
@@ -334,7 +339,15 @@ public:
         return v;
     }
 
-    int64_t consumption() const { return _consumption->current_value(); }
+    int64_t consumption() const {
+        int64_t value = _consumption->current_value();
+        if (_core_local_consumption != nullptr) {
+            for (size_t i = 0; i < _core_local_consumption->size(); i++) {
+                value += __atomic_load_n(_core_local_consumption->access_at_core(i), __ATOMIC_RELAXED);
+            }
+        }
+        return value;
+    }
 
     int64_t peak_consumption() const { return _consumption->value(); }
     int64_t allocation() const { return _allocation->value(); }
@@ -342,6 +355,13 @@ public:
 
     MemTracker* parent() const { return _parent; }
 
+    // The sampled allocations tracked by this tracker, only set for the trackers of the operators when
+    // config::mem_alloc_sample_interval_bytes is positive.
+    AllocationSamples* allocation_samples() const { return _allocation_samples.get(); }
+    void set_allocation_samples(std::shared_ptr<AllocationSamples> samples) {
+        _allocation_samples = std::move(samples);
+    }
+
     Status check_mem_limit(const std::string& msg) const;
 
     std::string err_msg(const std::string& msg) const;
@@ -354,7 +374,7 @@ public:
         std::stringstream msg;
         msg << "limit: " << _limit << "; "
             << "reserve_limit: " << _reserve_limit << "; "
-            << "consumption: " << _consumption->current_value() << "; "
+            << "consumption: " << consumption() << "; "
             << "allocation: " << _allocation->value() << "; "
             << "deallocation: " << _deallocation->value() << "; "
             << "label: " << _label << "; "
@@ -366,8 +386,7 @@ public:
 
     // no any memory allocate
     size_t debug_string(char* dst, size_t max_length) {
-        return snprintf(dst, max_length, "tracker:%s consumption: %ld\n", _label.c_str(),
-                        _consumption->current_value());
+        return snprintf(dst, max_length, "tracker:%s consumption: %ld\n", _label.c_str(), consumption());
     }
 
     Type type() const { return _type; }
@@ -380,6 +399,61 @@ private:
     // Walks the MemTracker hierarchy and populates _all_trackers and _limit_trackers
     void Init();
 
+    // The process wide trackers are updated by all the queries, so their consumption is first accumulated in per
+    // core deltas, which are folded into `_consumption` once they reach `_core_local_batch_bytes`. It turns most of
+    // the updates into atomic adds on a cache line private to the core. Each delta stays below the batch size, so
+    // `_consumption` is off by at most `_max_unflushed_consumption`; the limit checks only sum up the deltas, or
+    // fold them in, when that error could change the result.
+    void _add_consumption(int64_t bytes) {
+        if (_core_local_consumption == nullptr) {
+            _consumption->add(bytes);
+            return;
+        }
+        int64_t* delta = _core_local_consumption->access();
+        const int64_t new_delta = __atomic_add_fetch(delta, bytes, __ATOMIC_RELAXED);
+        if (new_delta >= _core_local_batch_bytes || new_delta <= -_core_local_batch_bytes) {
+            _consumption->add(__atomic_exchange_n(delta, 0, __ATOMIC_RELAXED));
+        }
+    }
+
+    bool _try_add_consumption(int64_t bytes, int64_t limit) {
+        if (_core_local_consumption == nullptr) {
+            return _consumption->try_add(bytes, limit);
+        }
+        if (_consumption->current_value() + _max_unflushed_consumption + bytes <= limit) {
+            _add_consumption(bytes);
+            return true;
+        }
+        // Close to the limit, decide on the precise consumption.
+        _drain_core_local_consumption();
+        return _consumption->try_add(bytes, limit);
+    }
+
+    void _drain_core_local_consumption() {
+        if (_core_local_consumption == nullptr) {
+            return;
+        }
+        for (size_t i = 0; i < _core_local_consumption->size(); i++) {
+            int64_t* delta_ptr = _core_local_consumption->access_at_core(i);
+            const int64_t delta = __atomic_exchange_n(delta_ptr, 0, __ATOMIC_RELAXED);
+            if (delta != 0) {
+                _consumption->add(delta);
+            }
+        }
+    }
+
+    // Whether consumption() + bytes > limit.
+    bool _exceeds(int64_t limit, int64_t bytes) const {
+        const int64_t approximate = _consumption->current_value() + bytes;
+        if (approximate + _max_unflushed_consumption <= limit) {
+            return false;
+        }
+        if (approximate - _max_unflushed_consumption > limit) {
+            return true;
+        }
+        return consumption() + bytes > limit;
+    }
+
     // Adds tracker to _child_trackers
     void add_child_tracker(MemTracker* tracker) {
         std::lock_guard<std::mutex> l(_child_trackers_lock);
@@ -400,6 +474,11 @@ private:
     /// holds _consumption counter if not tied to a profile
     RuntimeProfile::HighWaterMarkCounter _local_consumption_counter;
 
+    /// the per core deltas of _consumption, see _add_consumption()
+    std::unique_ptr<CoreLocalValue<int64_t>> _core_local_consumption;
+    int64_t _core_local_batch_bytes = 0;
+    int64_t _max_unflushed_consumption = 0;
+
     /// in bytes; not owned. Only record allocation but ignore deallocation
     /// And for sake of performance, it can only be updated through `update_allocation`
     RuntimeProfile::Counter* _allocation;
@@ -414,6 +493,8 @@ private:
     /// holds _deallocation counter if not tied to a profile
     RuntimeProfile::Counter _local_deallocation_counter;
 
+    std::shared_ptr<AllocationSamples> _allocation_samples;
+
     std::vector<MemTracker*> _all_trackers;   // this tracker plus all of its ancestors
     std::vector<MemTracker*> _limit_trackers; // _all_trackers with valid limits
 
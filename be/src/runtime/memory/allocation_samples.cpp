@@ -0,0 +1,123 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/allocation_samples.h"
+
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+
+#include "fmt/format.h"
+#include "util/pretty_printer.h"
+
+// import hidden stack trace functions from glog
+namespace google::glog_internal_namespace_ {
+enum class SymbolizeOptions { kNone = 0, kNoLineNumbers = 1 };
+int GetStackTrace(void** result, int max_depth, int skip_count);
+bool Symbolize(void* pc, char* out, unsigned long out_size, SymbolizeOptions options = SymbolizeOptions::kNone);
+} // namespace google::glog_internal_namespace_
+
+namespace starrocks {
+
+// The allocations made while recording a sample, e.g. of the map of the sites, are not sampled.
+static thread_local bool tls_in_record = false;
+
+void AllocationSamples::record(int64_t size, int64_t weight) {
+    if (tls_in_record) {
+        return;
+    }
+    tls_in_record = true;
+    void* addrs[kMaxStackDepth];
+    int depth = google::glog_internal_namespace_::GetStackTrace(addrs, kMaxStackDepth, 1);
+    std::vector<void*> stack(addrs, addrs + std::max(depth, 0));
+    {
+        std::lock_guard l(_lock);
+        _num_samples++;
+        _weight += weight;
+        auto it = _sites.find(stack);
+        if (it == _sites.end() && _sites.size() < kMaxSites) {
+            it = _sites.emplace(std::move(stack), Site()).first;
+        }
+        if (it != _sites.end()) {
+            it->second.num_samples++;
+            it->second.weight += weight;
+            it->second.size += size;
+        }
+    }
+    tls_in_record = false;
+}
+
+int64_t AllocationSamples::num_samples() const {
+    std::lock_guard l(_lock);
+    return _num_samples;
+}
+
+int64_t AllocationSamples::sampled_bytes() const {
+    std::lock_guard l(_lock);
+    return _weight;
+}
+
+// The frames of the allocators and the memory hooks, which are skipped from the top of the stacks.
+static bool is_allocator_frame(std::string_view symbol) {
+    static constexpr std::string_view kAllocatorSymbols[] = {"my_",         "je_",           "malloc",
+                                                             "calloc",      "realloc",       "operator new",
+                                                             "allocate",    "Allocator",     "CurrentThread",
+                                                             "AllocationSamples"};
+    return std::any_of(std::begin(kAllocatorSymbols), std::end(kAllocatorSymbols),
+                       [&](std::string_view s) { return symbol.find(s) != std::string_view::npos; });
+}
+
+std::string AllocationSamples::top_sites(size_t n) const {
+    std::vector<std::pair<std::vector<void*>, Site>> sites;
+    {
+        std::lock_guard l(_lock);
+        sites.assign(_sites.begin(), _sites.end());
+    }
+    n = std::min(n, sites.size());
+    std::partial_sort(sites.begin(), sites.begin() + n, sites.end(),
+                      [](const auto& lhs, const auto& rhs) { return lhs.second.weight > rhs.second.weight; });
+
+    static constexpr int kMaxFrames = 6;
+    std::unordered_map<void*, std::string> symbols;
+    std::string result;
+    for (size_t i = 0; i < n; i++) {
+        const auto& [stack, site] = sites[i];
+        result += fmt::format("{} ({} samples, avg {}):", PrettyPrinter::print(site.weight, TUnit::BYTES),
+                              site.num_samples, PrettyPrinter::print(site.size / site.num_samples, TUnit::BYTES));
+        int num_frames = 0;
+        for (void* addr : stack) {
+            auto& symbol = symbols[addr];
+            if (symbol.empty()) {
+                char buf[1024];
+                if (google::glog_internal_namespace_::Symbolize(addr, buf, sizeof(buf))) {
+                    symbol = buf;
+                } else {
+                    symbol = fmt::format("{}", addr);
+                }
+            }
+            if (num_frames == 0 && is_allocator_frame(symbol)) {
+                continue;
+            }
+            result += num_frames == 0 ? " " : " <- ";
+            result += symbol;
+            if (++num_frames == kMaxFrames) {
+                break;
+            }
+        }
+        result += '\n';
+    }
+    return result;
+}
+
+} // namespace starrocks
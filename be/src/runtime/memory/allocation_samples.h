@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "util/spinlock.h"
+
+namespace starrocks {
+
+// The allocations sampled by CurrentThread, one per config::mem_alloc_sample_interval_bytes bytes allocated by a
+// thread, aggregated by the stack of the allocation. Each sample stands for the bytes allocated since the previous
+// sample of the thread, so the bytes of a site are an unbiased estimate of the bytes it allocated, and the sites
+// allocating the most are the ones to look at to reduce the allocation churn.
+//
+// The samples of an operator are attached to its MemTracker, see QueryContext::operator_mem_tracker.
+class AllocationSamples {
+public:
+    // The distinct stacks kept, the samples of the other stacks are only counted in total.
+    static constexpr size_t kMaxSites = 4096;
+    static constexpr int kMaxStackDepth = 32;
+
+    // Records a sample of an allocation of |size| bytes standing for |weight| bytes, with the stack of the caller.
+    void record(int64_t size, int64_t weight);
+
+    int64_t num_samples() const;
+    // The estimated bytes allocated.
+    int64_t sampled_bytes() const;
+
+    // Returns the |n| sites allocating the most bytes, one per line, e.g.
+    // "12.00 MB (3 samples, avg 4.00 MB): starrocks::Foo::bar() <- starrocks::Foo::run() <- ...".
+    std::string top_sites(size_t n) const;
+
+private:
+    struct Site {
+        int64_t num_samples = 0;
+        int64_t weight = 0;
+        int64_t size = 0;
+    };
+
+    mutable SpinLock _lock;
+    std::map<std::vector<void*>, Site> _sites;
+    int64_t _num_samples = 0;
+    int64_t _weight = 0;
+};
+
+} // namespace starrocks
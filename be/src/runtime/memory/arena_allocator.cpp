@@ -0,0 +1,172 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/arena_allocator.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace starrocks {
+
+static uint8_t* align_up(uint8_t* ptr, size_t align) {
+    auto value = reinterpret_cast<uintptr_t>(ptr);
+    return reinterpret_cast<uint8_t*>((value + align - 1) & ~(static_cast<uintptr_t>(align) - 1));
+}
+
+void* ArenaAllocator::_allocate(size_t align, size_t size) {
+    align = std::max(align, kMinAlignment);
+    if ((align & (align - 1)) != 0) {
+        return nullptr;
+    }
+    if (size > kMaxSmallSize || align > kMaxSmallSize) {
+        return _allocate_large(align, size);
+    }
+    uint8_t* ptr = _cursor == nullptr ? nullptr : align_up(_cursor + sizeof(uint64_t), align);
+    if (ptr == nullptr || ptr + size > _chunk_end) {
+        _new_chunk(size + align + sizeof(uint64_t));
+        if (_cursor == nullptr) {
+            return nullptr;
+        }
+        ptr = align_up(_cursor + sizeof(uint64_t), align);
+    }
+    _header(ptr) = size;
+    _cursor = ptr + size;
+    _last = ptr;
+    return ptr;
+}
+
+void* ArenaAllocator::_allocate_large(size_t align, size_t size) {
+    const size_t raw_size = size + sizeof(LargeNode) + align;
+    auto* raw = static_cast<uint8_t*>(_upstream->alloc(raw_size));
+    if (raw == nullptr) {
+        return nullptr;
+    }
+    uint8_t* ptr = align_up(raw + sizeof(LargeNode), align);
+    auto* node = reinterpret_cast<LargeNode*>(ptr - sizeof(LargeNode));
+    node->prev = nullptr;
+    node->next = _large_head;
+    node->raw = raw;
+    node->raw_size = raw_size;
+    node->header = size | kLargeFlag;
+    if (_large_head != nullptr) {
+        _large_head->prev = node;
+    }
+    _large_head = node;
+    _allocated_bytes += raw_size;
+    return ptr;
+}
+
+void ArenaAllocator::_new_chunk(size_t min_size) {
+    size_t size = _chunks.empty() ? kInitialChunkSize : std::min(_chunks.back().second * 2, kMaxChunkSize);
+    size = std::max(size, min_size);
+    auto* chunk = static_cast<uint8_t*>(_upstream->alloc(size));
+    if (chunk == nullptr) {
+        _cursor = _chunk_end = nullptr;
+        return;
+    }
+    _chunks.emplace_back(chunk, size);
+    _allocated_bytes += size;
+    _cursor = chunk;
+    _chunk_end = chunk + size;
+    _last = nullptr;
+}
+
+void ArenaAllocator::free(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (_header(ptr) & kLargeFlag) {
+        auto* node = reinterpret_cast<LargeNode*>(static_cast<uint8_t*>(ptr) - sizeof(LargeNode));
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            _large_head = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        }
+        _allocated_bytes -= node->raw_size;
+        _upstream->free(node->raw);
+    } else if (ptr == _last) {
+        _cursor = static_cast<uint8_t*>(ptr) - sizeof(uint64_t);
+        _last = nullptr;
+    }
+}
+
+void* ArenaAllocator::realloc(void* ptr, size_t size) {
+    if (ptr == nullptr) {
+        return alloc(size);
+    }
+    if (size == 0) {
+        free(ptr);
+        return nullptr;
+    }
+    const uint64_t header = _header(ptr);
+    const size_t old_size = header & ~kLargeFlag;
+    if (!(header & kLargeFlag)) {
+        // Grow or shrink the last allocation in place.
+        if (ptr == _last && size <= kMaxSmallSize && static_cast<uint8_t*>(ptr) + size <= _chunk_end) {
+            _header(ptr) = size;
+            _cursor = static_cast<uint8_t*>(ptr) + size;
+            return ptr;
+        }
+        if (size <= old_size) {
+            _header(ptr) = size;
+            return ptr;
+        }
+    }
+    void* new_ptr = alloc(size);
+    if (new_ptr == nullptr) {
+        return nullptr;
+    }
+    memcpy(new_ptr, ptr, std::min(old_size, size));
+    free(ptr);
+    return new_ptr;
+}
+
+void* ArenaAllocator::calloc(size_t n, size_t size) {
+    if (size != 0 && n > SIZE_MAX / size) {
+        return nullptr;
+    }
+    void* ptr = alloc(n * size);
+    if (ptr != nullptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+int ArenaAllocator::posix_memalign(void** ptr, size_t align, size_t size) {
+    if (align < sizeof(void*) || (align & (align - 1)) != 0) {
+        return EINVAL;
+    }
+    *ptr = _allocate(align, size);
+    return *ptr == nullptr ? ENOMEM : 0;
+}
+
+void ArenaAllocator::release_all() {
+    for (auto& [chunk, size] : _chunks) {
+        _upstream->free(chunk);
+    }
+    _chunks.clear();
+    while (_large_head != nullptr) {
+        LargeNode* next = _large_head->next;
+        _upstream->free(_large_head->raw);
+        _large_head = next;
+    }
+    _cursor = _chunk_end = _last = nullptr;
+    _allocated_bytes = 0;
+}
+
+} // namespace starrocks
@@ -0,0 +1,93 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "runtime/memory/allocator.h"
+
+namespace starrocks {
+
+// ArenaAllocator serves the small allocations by bumping a pointer in the chunks it gets from `upstream`, and
+// frees all of them at once in release_all() or its destructor. Freeing a small allocation does nothing, unless
+// it's the last one of the current chunk, so destroying a lot of small objects costs nothing and doesn't
+// fragment the heap. The allocations larger than kMaxSmallSize are got from `upstream` one by one and freed
+// as usual, but they are also freed by release_all() if they are still alive.
+//
+// Every allocation is preceded by a header, so realloc knows the old size. It's not thread-safe.
+class ArenaAllocator final : public AllocatorFactory<Allocator, ArenaAllocator> {
+public:
+    static constexpr size_t kInitialChunkSize = 4096;
+    static constexpr size_t kMaxChunkSize = 512 * 1024;
+    static constexpr size_t kMaxSmallSize = 8192;
+
+    explicit ArenaAllocator(Allocator* upstream) : _upstream(upstream) {}
+    ~ArenaAllocator() override { release_all(); }
+
+    ArenaAllocator(const ArenaAllocator&) = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+    void* alloc(size_t size) override { return _allocate(kMinAlignment, size); }
+    void free(void* ptr) override;
+    void* realloc(void* ptr, size_t size) override;
+    void* calloc(size_t n, size_t size) override;
+    void cfree(void* ptr) override { free(ptr); }
+    void* memalign(size_t align, size_t size) override { return _allocate(align, size); }
+    void* aligned_alloc(size_t align, size_t size) override { return _allocate(align, size); }
+    void* valloc(size_t size) override { return _allocate(kPageSize, size); }
+    void* pvalloc(size_t size) override {
+        return _allocate(kPageSize, (size + kPageSize - 1) / kPageSize * kPageSize);
+    }
+    int posix_memalign(void** ptr, size_t align, size_t size) override;
+
+    // Free all the memory got from `upstream`, every pointer returned before is invalid then.
+    void release_all();
+
+    // Bytes got from `upstream` and not freed yet.
+    int64_t allocated_bytes() const { return _allocated_bytes; }
+
+private:
+    static constexpr size_t kMinAlignment = 16;
+    static constexpr size_t kPageSize = 4096;
+    static constexpr uint64_t kLargeFlag = 1ULL << 63;
+
+    // Precedes every large allocation, the last field is the header of all the allocations.
+    struct LargeNode {
+        LargeNode* prev;
+        LargeNode* next;
+        void* raw;
+        size_t raw_size;
+        uint64_t header;
+    };
+
+    static uint64_t& _header(void* ptr) { return *(reinterpret_cast<uint64_t*>(ptr) - 1); }
+
+    void* _allocate(size_t align, size_t size);
+    void* _allocate_large(size_t align, size_t size);
+    void _new_chunk(size_t min_size);
+
+    Allocator* const _upstream;
+    std::vector<std::pair<uint8_t*, size_t>> _chunks;
+    uint8_t* _cursor = nullptr;
+    uint8_t* _chunk_end = nullptr;
+    // The last small allocation, which can be freed or grown in place.
+    uint8_t* _last = nullptr;
+    LargeNode* _large_head = nullptr;
+    int64_t _allocated_bytes = 0;
+};
+
+} // namespace starrocks
@@ -18,6 +18,7 @@
 
 #include <memory>
 
+#include "runtime/memory/column_buffer_pool.h"
 #include "runtime/memory/mem_hook_allocator.h"
 
 namespace starrocks {
@@ -46,11 +47,18 @@ public:
 
     T* allocate(size_t n) {
         DCHECK(tls_column_allocator != nullptr);
+        if (tls_column_buffer_pool != nullptr && ColumnBufferPool::is_pooled(n * sizeof(T))) {
+            return static_cast<T*>(tls_column_buffer_pool->allocate(n * sizeof(T)));
+        }
         return static_cast<T*>(tls_column_allocator->alloc(n * sizeof(T)));
     }
 
     void deallocate(T* ptr, size_t n) {
         DCHECK(tls_column_allocator != nullptr);
+        if (tls_column_buffer_pool != nullptr && ColumnBufferPool::is_pooled(n * sizeof(T))) {
+            tls_column_buffer_pool->deallocate(ptr, n * sizeof(T));
+            return;
+        }
         tls_column_allocator->free(ptr);
     }
 
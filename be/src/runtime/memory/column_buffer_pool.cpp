@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/column_buffer_pool.h"
+
+#include <malloc.h>
+
+#include <cstdlib>
+#include <new>
+
+#include "common/compiler_util.h"
+
+namespace starrocks {
+
+static_assert(ColumnBufferPool::kMinPooledBytes == 1UL << 12);
+static_assert(ColumnBufferPool::kMaxPooledBytes == 1UL << (12 + 9 - 1));
+
+void* ColumnBufferPool::allocate(size_t bytes) {
+    const int capacity_class = _capacity_class(bytes);
+    auto& buffers = _free_buffers[capacity_class];
+    if (!buffers.empty()) {
+        void* ptr = buffers.back();
+        buffers.pop_back();
+        _cached_bytes -= _class_bytes(capacity_class);
+        _num_hits++;
+        return ptr;
+    }
+    void* ptr = ::malloc(_class_bytes(capacity_class));
+    if (UNLIKELY(ptr == nullptr)) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void ColumnBufferPool::deallocate(void* ptr, size_t bytes) {
+    const int capacity_class = _capacity_class(bytes);
+    const size_t class_bytes = _class_bytes(capacity_class);
+    // The buffers allocated outside of the pool may be smaller than their class.
+    if (_cached_bytes + class_bytes > _capacity_bytes || malloc_usable_size(ptr) < class_bytes) {
+        ::free(ptr);
+        return;
+    }
+    _free_buffers[capacity_class].push_back(ptr);
+    _cached_bytes += class_bytes;
+}
+
+void ColumnBufferPool::clear() {
+    for (auto& buffers : _free_buffers) {
+        for (void* ptr : buffers) {
+            ::free(ptr);
+        }
+        buffers.clear();
+    }
+    _cached_bytes = 0;
+}
+
+} // namespace starrocks
@@ -0,0 +1,84 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace starrocks {
+
+// A bounded cache of the column buffers freed by one pipeline driver, so that the buffers of the next chunks
+// are taken from it instead of the global allocator. It is installed in `tls_column_buffer_pool` while a driver
+// is running, and ColumnAllocator draws from and returns to it.
+//
+// The buffers are grouped by capacity class, i.e. the size rounded up to a power of two, which covers the
+// different types of the same chunk size (e.g. 4096 int32 and 2048 int64 values share a class). The buffers
+// are allocated by malloc with the size of their class, and a buffer freed to the pool is only cached if its
+// usable size covers its class, so the buffers allocated outside of the pool may be freed to it and vice versa.
+// The cached buffers are still accounted to the mem tracker they were allocated under.
+//
+// Not thread-safe, a driver only runs on one thread at a time.
+class ColumnBufferPool {
+public:
+    // The smaller buffers are served well by the thread cache of the allocator.
+    static constexpr size_t kMinPooledBytes = 4096;
+    static constexpr size_t kMaxPooledBytes = 1024 * 1024;
+
+    explicit ColumnBufferPool(size_t capacity_bytes) : _capacity_bytes(capacity_bytes) {}
+    ~ColumnBufferPool() { clear(); }
+
+    ColumnBufferPool(const ColumnBufferPool&) = delete;
+    ColumnBufferPool& operator=(const ColumnBufferPool&) = delete;
+
+    static bool is_pooled(size_t bytes) { return bytes >= kMinPooledBytes && bytes <= kMaxPooledBytes; }
+
+    // |bytes| must be pooled.
+    void* allocate(size_t bytes);
+    void deallocate(void* ptr, size_t bytes);
+
+    void clear();
+
+    size_t cached_bytes() const { return _cached_bytes; }
+    size_t num_hits() const { return _num_hits; }
+
+private:
+    static constexpr int kMinClass = 12; // log2(kMinPooledBytes)
+    static constexpr int kNumClasses = 9;
+
+    static int _capacity_class(size_t bytes) { return 64 - __builtin_clzll(bytes - 1) - kMinClass; }
+    static size_t _class_bytes(int capacity_class) { return 1UL << (capacity_class + kMinClass); }
+
+    const size_t _capacity_bytes;
+    size_t _cached_bytes = 0;
+    size_t _num_hits = 0;
+    std::vector<void*> _free_buffers[kNumClasses];
+};
+
+inline thread_local ColumnBufferPool* tls_column_buffer_pool = nullptr;
+
+class ThreadLocalColumnBufferPoolSetter {
+public:
+    explicit ThreadLocalColumnBufferPoolSetter(ColumnBufferPool* pool) {
+        _prev = tls_column_buffer_pool;
+        tls_column_buffer_pool = pool;
+    }
+    ~ThreadLocalColumnBufferPoolSetter() { tls_column_buffer_pool = _prev; }
+
+private:
+    ColumnBufferPool* _prev = nullptr;
+};
+
+} // namespace starrocks
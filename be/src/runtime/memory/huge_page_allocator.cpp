@@ -0,0 +1,112 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/huge_page_allocator.h"
+
+#include <sys/mman.h>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "runtime/current_thread.h"
+
+namespace starrocks {
+
+static size_t round_up_to_huge_page(size_t size) {
+    return (size + HugePageAllocatorBase::kHugePageSize - 1) & ~(HugePageAllocatorBase::kHugePageSize - 1);
+}
+
+static void consume_huge_pages(int64_t size) {
+    if (LIKELY(tls_is_thread_status_init)) {
+        if (UNLIKELY(!tls_thread_status.try_mem_consume(size))) {
+            if (tls_thread_status.is_catched()) {
+                throw std::bad_alloc();
+            }
+            tls_thread_status.mem_consume(size);
+        }
+    } else {
+        CurrentThread::mem_consume_without_cache(size);
+    }
+}
+
+static void release_huge_pages(int64_t size) {
+    if (LIKELY(tls_is_thread_status_init)) {
+        tls_thread_status.mem_release(size);
+    } else {
+        CurrentThread::mem_release_without_cache(size);
+    }
+}
+
+// mmap only guarantees the alignment of small pages, while a transparent huge page can only back a range aligned
+// to kHugePageSize, so map one more huge page and trim the unaligned head and tail.
+static void* mmap_aligned(size_t length) {
+    const size_t mapped_length = length + HugePageAllocatorBase::kHugePageSize;
+    void* ptr = mmap(nullptr, mapped_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        return nullptr;
+    }
+    auto addr = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t aligned = round_up_to_huge_page(addr);
+    if (aligned > addr) {
+        munmap(ptr, aligned - addr);
+    }
+    const size_t tail = addr + mapped_length - (aligned + length);
+    if (tail > 0) {
+        munmap(reinterpret_cast<void*>(aligned + length), tail);
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+bool HugePageAllocatorBase::is_huge(size_t size) {
+    return config::huge_page_alloc_threshold_bytes > 0 &&
+           size >= static_cast<size_t>(config::huge_page_alloc_threshold_bytes);
+}
+
+void* HugePageAllocatorBase::allocate_huge(size_t size) {
+    const size_t length = round_up_to_huge_page(size);
+    consume_huge_pages(length);
+
+    void* ptr = MAP_FAILED;
+    if (config::huge_page_alloc_use_hugetlb) {
+        ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr == MAP_FAILED) {
+            PLOG_FIRST_N(WARNING, 1) << "fail to allocate " << length
+                                     << " bytes of hugetlb pages, fall back to transparent huge pages";
+        }
+    }
+    if (ptr == MAP_FAILED) {
+        ptr = mmap_aligned(length);
+        if (ptr == nullptr) {
+            PLOG(ERROR) << "fail to allocate " << length << " bytes via mmap";
+            release_huge_pages(length);
+            throw std::bad_alloc();
+        }
+        if (madvise(ptr, length, MADV_HUGEPAGE) != 0) {
+            PLOG_FIRST_N(WARNING, 1) << "fail to madvise huge pages";
+        }
+    }
+    return ptr;
+}
+
+void HugePageAllocatorBase::free_huge(void* ptr, size_t size) {
+    if (ptr == nullptr) {
+        return;
+    }
+    const size_t length = round_up_to_huge_page(size);
+    if (munmap(ptr, length) != 0) {
+        PLOG(ERROR) << "fail to free memory via munmap";
+    }
+    release_huge_pages(length);
+}
+
+} // namespace starrocks
@@ -0,0 +1,99 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "common/compiler_util.h"
+
+namespace starrocks {
+
+// Serves the allocations not smaller than `config::huge_page_alloc_threshold_bytes` from huge pages, and the
+// others from malloc. It is meant for the large and randomly accessed arrays, such as the buckets of the join
+// hash table and of the aggregate hash map, whose TLB misses dominate the probing once they grow to gigabytes.
+//
+// The huge allocations are mmapped directly, aligned to kHugePageSize, and either madvised as transparent huge
+// pages or, if `config::huge_page_alloc_use_hugetlb` is set, taken from the reserved hugetlb pool with a fallback
+// to transparent huge pages when the pool is exhausted. The pages are not populated on mmap, so under the default
+// NUMA policy they are faulted in on the node of the thread that first touches them, which is the thread building
+// the hash table. mmap bypasses the malloc hook, so these allocations are accounted to the MemTracker of the
+// current thread here.
+class HugePageAllocatorBase {
+public:
+    static constexpr size_t kHugePageSize = 2UL * 1024 * 1024;
+
+    // Whether an allocation of |size| bytes is served from huge pages. It only depends on immutable configs,
+    // so the allocation and the deallocation of the same size always take the same path.
+    static bool is_huge(size_t size);
+
+    // Throws std::bad_alloc if the memory limit is exceeded in a catched scope or mmap fails.
+    static void* allocate_huge(size_t size);
+    static void free_huge(void* ptr, size_t size);
+
+    static void* allocate(size_t size) {
+        if (UNLIKELY(is_huge(size))) {
+            return allocate_huge(size);
+        }
+        void* ptr = ::malloc(size);
+        if (UNLIKELY(ptr == nullptr)) {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    static void free(void* ptr, size_t size) {
+        if (UNLIKELY(is_huge(size))) {
+            free_huge(ptr, size);
+        } else {
+            ::free(ptr);
+        }
+    }
+};
+
+// STL allocator over HugePageAllocatorBase, for std::vector and phmap containers.
+template <class T>
+class HugePageAllocator {
+public:
+    typedef T value_type;
+    typedef size_t size_type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <typename U>
+    struct rebind {
+        using other = HugePageAllocator<U>;
+    };
+    HugePageAllocator() = default;
+    template <class U>
+    HugePageAllocator(const HugePageAllocator<U>& other) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(HugePageAllocatorBase::allocate(n * sizeof(T))); }
+
+    void deallocate(T* ptr, size_t n) { HugePageAllocatorBase::free(ptr, n * sizeof(T)); }
+
+    bool operator==(const HugePageAllocator& rhs) const { return true; }
+
+    bool operator!=(const HugePageAllocator& rhs) const { return false; }
+};
+
+template <typename T>
+using HugePageBuffer = std::vector<T, HugePageAllocator<T>>;
+
+} // namespace starrocks
@@ -88,6 +88,7 @@ Status MemoryScratchSink::prepare(RuntimeState* state) {
     // create queue
     TUniqueId fragment_instance_id = state->fragment_instance_id();
     state->exec_env()->result_queue_mgr()->create_queue(fragment_instance_id, &_queue);
+    _queue->set_schema(_arrow_schema);
     std::stringstream title;
     title << "MemoryScratchSink (frag_id=" << fragment_instance_id << ")";
     // create profile
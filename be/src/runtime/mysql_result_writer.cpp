@@ -35,14 +35,22 @@
 #include "runtime/mysql_result_writer.h"
 
 #include <column/column_helper.h>
+#include <fmt/compile.h>
+#include <fmt/format.h>
 
+#include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/const_column.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "exprs/expr.h"
+#include "gutil/casts.h"
+#include "gutil/strings/fastmem.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/current_thread.h"
 #include "types/logical_type.h"
 #include "util/mysql_row_buffer.h"
+#include "util/raw_container.h"
 
 namespace starrocks {
 
@@ -112,15 +120,142 @@ Status MysqlResultWriter::close() {
     return Status::OK();
 }
 
-StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
-    SCOPED_TIMER(_append_chunk_timer);
-    int num_rows = chunk->num_rows();
-    auto result = std::make_unique<TFetchDataResult>();
-    auto& result_rows = result->result_batch.rows;
-    result_rows.resize(num_rows);
+// The text cells of a column. The cells of a binary column are copied from the column directly, the others are
+// formatted into `data`, the i-th one is data[offsets[i], offsets[i + 1]).
+struct MysqlTextCells {
+    const BinaryColumn* binary = nullptr;
+    const uint8_t* nulls = nullptr;
+    std::string data;
+    std::vector<uint32_t> offsets;
+
+    size_t length(size_t row) const {
+        if (binary != nullptr) {
+            if (nulls != nullptr && nulls[row]) {
+                return 1;
+            }
+            size_t size = binary->get_offset()[row + 1] - binary->get_offset()[row];
+            return mysql_vlen_size(size) + size;
+        }
+        return offsets[row + 1] - offsets[row];
+    }
+
+    char* append_to(size_t row, char* pos) const {
+        if (binary != nullptr) {
+            if (nulls != nullptr && nulls[row]) {
+                *pos++ = static_cast<char>(0xfb);
+                return pos;
+            }
+            const auto& binary_offsets = binary->get_offset();
+            size_t size = binary_offsets[row + 1] - binary_offsets[row];
+            pos = reinterpret_cast<char*>(mysql_pack_vlen(reinterpret_cast<uint8_t*>(pos), size));
+            strings::memcpy_inlined(pos, binary->get_bytes().data() + binary_offsets[row], size);
+            return pos + size;
+        }
+        size_t size = offsets[row + 1] - offsets[row];
+        strings::memcpy_inlined(pos, data.data() + offsets[row], size);
+        return pos + size;
+    }
+};
+
+// Formats the integers as MysqlRowBuffer::push_number in a typed loop, one length byte and the digits of each value.
+template <typename T>
+static void format_integers(const T* values, const uint8_t* nulls, size_t num_rows, MysqlTextCells* cells) {
+    // 1 for length, 1 for sign, other for digits.
+    constexpr size_t kMaxWidth = 2 + 40;
+    raw::stl_string_resize_uninitialized(&cells->data, num_rows * kMaxWidth);
+    cells->offsets.resize(num_rows + 1);
+    char* begin = cells->data.data();
+    char* pos = begin;
+    for (size_t i = 0; i < num_rows; i++) {
+        cells->offsets[i] = pos - begin;
+        if (nulls != nullptr && nulls[i]) {
+            *pos++ = static_cast<char>(0xfb);
+            continue;
+        }
+        char* end = fmt::format_to(pos + 1, FMT_COMPILE("{}"), values[i]);
+        *pos = static_cast<char>(end - pos - 1);
+        pos = end;
+    }
+    cells->offsets[num_rows] = pos - begin;
+    cells->data.resize(pos - begin);
+}
+
+template <typename T>
+static bool try_format_integers(const Column* data_column, const uint8_t* nulls, size_t num_rows,
+                                MysqlTextCells* cells) {
+    const auto* column = dynamic_cast<const FixedLengthColumn<T>*>(data_column);
+    if (column == nullptr) {
+        return false;
+    }
+    format_integers(column->get_data().data(), nulls, num_rows, cells);
+    return true;
+}
+
+static void to_text_cells(const ColumnPtr& column, size_t num_rows, MysqlTextCells* cells) {
+    const Column* data_column = column.get();
+    const uint8_t* nulls = nullptr;
+    if (column->is_nullable()) {
+        const auto* nullable = down_cast<const NullableColumn*>(column.get());
+        data_column = nullable->data_column().get();
+        nulls = nullable->has_null() ? nullable->null_column()->get_data().data() : nullptr;
+    }
+
+    if (!data_column->is_constant()) {
+        if (data_column->is_binary()) {
+            cells->binary = down_cast<const BinaryColumn*>(data_column);
+            cells->nulls = nulls;
+            return;
+        }
+        if (try_format_integers<int8_t>(data_column, nulls, num_rows, cells) ||
+            try_format_integers<uint8_t>(data_column, nulls, num_rows, cells) ||
+            try_format_integers<int16_t>(data_column, nulls, num_rows, cells) ||
+            try_format_integers<int32_t>(data_column, nulls, num_rows, cells) ||
+            try_format_integers<int64_t>(data_column, nulls, num_rows, cells) ||
+            try_format_integers<int128_t>(data_column, nulls, num_rows, cells)) {
+            return;
+        }
+    }
+
+    // the other columns are formatted cell by cell into one buffer.
+    MysqlRowBuffer buffer;
+    buffer.reserve(num_rows * 16);
+    cells->offsets.resize(num_rows + 1);
+    for (size_t i = 0; i < num_rows; i++) {
+        cells->offsets[i] = buffer.length();
+        column->put_mysql_row_buffer(&buffer, i);
+    }
+    cells->offsets[num_rows] = buffer.length();
+    buffer.move_content(&cells->data);
+}
+
+void MysqlResultWriter::serialize_text_rows(const Columns& columns, size_t num_rows, std::vector<std::string>* rows) {
+    std::vector<MysqlTextCells> cells(columns.size());
+    for (size_t col = 0; col < columns.size(); col++) {
+        to_text_cells(columns[col], num_rows, &cells[col]);
+    }
+
+    // compute the length of each row first, so each row is allocated exactly once.
+    std::vector<size_t> lengths(num_rows, 0);
+    for (const auto& column_cells : cells) {
+        for (size_t i = 0; i < num_rows; i++) {
+            lengths[i] += column_cells.length(i);
+        }
+    }
+
+    rows->resize(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        auto& row = (*rows)[i];
+        raw::stl_string_resize_uninitialized(&row, lengths[i]);
+        char* pos = row.data();
+        for (const auto& column_cells : cells) {
+            pos = column_cells.append_to(i, pos);
+        }
+        DCHECK_EQ(row.data() + row.size(), pos);
+    }
+}
 
+StatusOr<Columns> MysqlResultWriter::_evaluate_output_columns(Chunk* chunk) {
     Columns result_columns;
-    // Step 1: compute expr
     int num_columns = _output_expr_ctxs.size();
     result_columns.reserve(num_columns);
 
@@ -131,26 +266,39 @@ StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
                          : column;
         result_columns.emplace_back(std::move(column));
     }
+    return result_columns;
+}
 
-    // Step 2: convert chunk to mysql row format row by row
-    {
-        _row_buffer->reserve(128);
-        SCOPED_TIMER(_convert_tuple_timer);
-        for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
-                _row_buffer->start_binary_row(num_columns);
-            };
-            for (auto& result_column : result_columns) {
-                if (_is_binary_format && !result_column->is_nullable()) {
-                    _row_buffer->update_field_pos();
-                }
-                result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
+StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
+    SCOPED_TIMER(_append_chunk_timer);
+    int num_rows = chunk->num_rows();
+    auto result = std::make_unique<TFetchDataResult>();
+    auto& result_rows = result->result_batch.rows;
+
+    // Step 1: compute expr
+    ASSIGN_OR_RETURN(auto result_columns, _evaluate_output_columns(chunk));
+    int num_columns = result_columns.size();
+
+    // Step 2: convert chunk to mysql row format
+    SCOPED_TIMER(_convert_tuple_timer);
+    if (!_is_binary_format) {
+        serialize_text_rows(result_columns, num_rows, &result_rows);
+        return result;
+    }
+    result_rows.resize(num_rows);
+    _row_buffer->reserve(128);
+    for (int i = 0; i < num_rows; ++i) {
+        DCHECK_EQ(0, _row_buffer->length());
+        _row_buffer->start_binary_row(num_columns);
+        for (auto& result_column : result_columns) {
+            if (!result_column->is_nullable()) {
+                _row_buffer->update_field_pos();
             }
-            size_t len = _row_buffer->length();
-            _row_buffer->move_content(&result_rows[i]);
-            _row_buffer->reserve(len * 1.1);
+            result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
         }
+        size_t len = _row_buffer->length();
+        _row_buffer->move_content(&result_rows[i]);
+        _row_buffer->reserve(len * 1.1);
     }
     return result;
 }
@@ -160,62 +308,48 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
     int num_rows = chunk->num_rows();
     std::vector<TFetchDataResultPtr> results;
 
-    Columns result_columns;
     // Step 1: compute expr
-    int num_columns = _output_expr_ctxs.size();
-    result_columns.reserve(num_columns);
+    ASSIGN_OR_RETURN(auto result_columns, _evaluate_output_columns(chunk));
+    int num_columns = result_columns.size();
 
-    for (int i = 0; i < num_columns; ++i) {
-        ASSIGN_OR_RETURN(ColumnPtr column, _output_expr_ctxs[i]->evaluate(chunk));
-        column = _output_expr_ctxs[i]->root()->type().type == TYPE_TIME
-                         ? ColumnHelper::convert_time_column_from_double_to_str(column)
-                         : column;
-        result_columns.emplace_back(std::move(column));
-    }
-
-    // Step 2: convert chunk to mysql row format row by row
+    // Step 2: convert chunk to mysql row format
     {
         TRY_CATCH_ALLOC_SCOPE_START()
-        _row_buffer->reserve(128);
-        size_t current_bytes = 0;
-        int current_rows = 0;
         SCOPED_TIMER(_convert_tuple_timer);
-        auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
-
-        for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
+        std::vector<std::string> rows;
+        if (_is_binary_format) {
+            rows.resize(num_rows);
+            _row_buffer->reserve(128);
+            for (int i = 0; i < num_rows; ++i) {
+                DCHECK_EQ(0, _row_buffer->length());
                 _row_buffer->start_binary_row(num_columns);
-            }
-            for (auto& result_column : result_columns) {
-                if (_is_binary_format && !result_column->is_nullable()) {
-                    _row_buffer->update_field_pos();
+                for (auto& result_column : result_columns) {
+                    if (!result_column->is_nullable()) {
+                        _row_buffer->update_field_pos();
+                    }
+                    result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
                 }
-                result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
+                size_t len = _row_buffer->length();
+                _row_buffer->move_content(&rows[i]);
+                _row_buffer->reserve(len * 1.1);
             }
-            size_t len = _row_buffer->length();
+        } else {
+            serialize_text_rows(result_columns, num_rows, &rows);
+        }
 
-            if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
+        // split the rows into the results of at most _max_row_buffer_size bytes.
+        auto result = std::make_unique<TFetchDataResult>();
+        size_t current_bytes = 0;
+        for (auto& row : rows) {
+            if (UNLIKELY(current_bytes + row.size() >= _max_row_buffer_size && current_bytes > 0)) {
                 results.emplace_back(std::move(result));
-
                 result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
-
                 current_bytes = 0;
-                current_rows = 0;
             }
-            _row_buffer->move_content(&result_rows[current_rows]);
-            _row_buffer->reserve(len * 1.1);
-
-            current_bytes += len;
-            current_rows += 1;
+            current_bytes += row.size();
+            result->result_batch.rows.emplace_back(std::move(row));
         }
-        if (current_rows > 0) {
-            result_rows.resize(current_rows);
+        if (!result->result_batch.rows.empty()) {
             results.emplace_back(std::move(result));
         }
         TRY_CATCH_ALLOC_SCOPE_END()
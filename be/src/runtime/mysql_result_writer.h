@@ -64,10 +64,14 @@ public:
 
     StatusOr<bool> try_add_batch(TFetchDataResultPtrs& results) override;
 
+    // Serializes the first `num_rows` rows of `columns` in the MySQL text protocol into `rows`, column by column.
+    static void serialize_text_rows(const Columns& columns, size_t num_rows, std::vector<std::string>* rows);
+
 private:
     void _init_profile();
     // this function is only used in non-pipeline engine
     StatusOr<TFetchDataResultPtr> _process_chunk(Chunk* chunk);
+    StatusOr<Columns> _evaluate_output_columns(Chunk* chunk);
 
     BufferControlBlock* _sinker;
     const std::vector<ExprContext*>& _output_expr_ctxs;
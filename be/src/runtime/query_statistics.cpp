@@ -44,6 +44,10 @@ void QueryStatistics::to_pb(PQueryStatistics* statistics) {
     statistics->set_cpu_cost_ns(cpu_ns);
     statistics->set_mem_cost_bytes(mem_cost_bytes);
     statistics->set_spill_bytes(spill_bytes);
+    statistics->set_hw_cycles(hw_cycles);
+    statistics->set_hw_instructions(hw_instructions);
+    statistics->set_hw_llc_misses(hw_llc_misses);
+    statistics->set_hw_branch_misses(hw_branch_misses);
     {
         std::lock_guard l(_lock);
         for (const auto& [table_id, stats_item] : _stats_items) {
@@ -73,6 +77,10 @@ void QueryStatistics::to_params(TAuditStatistics* params) {
     params->__set_cpu_cost_ns(cpu_ns);
     params->__set_mem_cost_bytes(mem_cost_bytes);
     params->__set_spill_bytes(spill_bytes);
+    params->__set_hw_cycles(hw_cycles);
+    params->__set_hw_instructions(hw_instructions);
+    params->__set_hw_llc_misses(hw_llc_misses);
+    params->__set_hw_branch_misses(hw_branch_misses);
     {
         std::lock_guard l(_lock);
         for (const auto& [table_id, stats_item] : _stats_items) {
@@ -90,6 +98,10 @@ void QueryStatistics::clear() {
     cpu_ns = 0;
     returned_rows = 0;
     spill_bytes = 0;
+    hw_cycles = 0;
+    hw_instructions = 0;
+    hw_llc_misses = 0;
+    hw_branch_misses = 0;
     _stats_items.clear();
     _exec_stats_items.clear();
 }
@@ -166,6 +178,11 @@ void QueryStatistics::merge(int sender_id, QueryStatistics& other) {
         this->spill_bytes += spill_bytes;
     }
 
+    this->hw_cycles += other.hw_cycles.exchange(0);
+    this->hw_instructions += other.hw_instructions.exchange(0);
+    this->hw_llc_misses += other.hw_llc_misses.exchange(0);
+    this->hw_branch_misses += other.hw_branch_misses.exchange(0);
+
     {
         std::unordered_map<int64_t, std::shared_ptr<ScanStats>> other_stats_item;
         std::unordered_map<uint32_t, std::shared_ptr<NodeExecStats>> other_exec_stats_items;
@@ -200,6 +217,12 @@ void QueryStatistics::merge_pb(const PQueryStatistics& statistics) {
     if (statistics.has_spill_bytes()) {
         spill_bytes += statistics.spill_bytes();
     }
+    if (statistics.has_hw_cycles()) {
+        hw_cycles += statistics.hw_cycles();
+        hw_instructions += statistics.hw_instructions();
+        hw_llc_misses += statistics.hw_llc_misses();
+        hw_branch_misses += statistics.hw_branch_misses();
+    }
     if (statistics.has_mem_cost_bytes()) {
         mem_cost_bytes = std::max<int64_t>(mem_cost_bytes, statistics.mem_cost_bytes());
     }
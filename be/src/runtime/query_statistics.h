@@ -38,6 +38,7 @@
 
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/data.pb.h"
+#include "util/perf_event_counters.h"
 #include "util/spinlock.h"
 
 namespace starrocks {
@@ -60,6 +61,12 @@ public:
     void add_cpu_costs(int64_t cpu_ns) { this->cpu_ns += cpu_ns; }
     void add_mem_costs(int64_t bytes) { mem_cost_bytes += bytes; }
     void add_spill_bytes(int64_t bytes) { spill_bytes += bytes; }
+    void add_hardware_counters(const PerfEventValues& values) {
+        hw_cycles += values.cycles;
+        hw_instructions += values.instructions;
+        hw_llc_misses += values.llc_misses;
+        hw_branch_misses += values.branch_misses;
+    }
 
     void to_pb(PQueryStatistics* statistics);
     void to_params(TAuditStatistics* params);
@@ -83,6 +90,11 @@ private:
     std::atomic_int64_t cpu_ns{0};
     std::atomic_int64_t mem_cost_bytes{0};
     std::atomic_int64_t spill_bytes{0};
+    // The hardware counters of the operators, see config::pipeline_enable_hardware_counters.
+    std::atomic_int64_t hw_cycles{0};
+    std::atomic_int64_t hw_instructions{0};
+    std::atomic_int64_t hw_llc_misses{0};
+    std::atomic_int64_t hw_branch_misses{0};
 
     // number rows returned by query.
     // only set once by result sink when closing.
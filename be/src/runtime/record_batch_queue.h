@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <memory>
 #include <util/spinlock.h>
 
 #include "common/status.h"
@@ -25,7 +26,8 @@
 namespace arrow {
 
 class RecordBatch;
-}
+class Schema;
+} // namespace arrow
 
 namespace starrocks {
 
@@ -44,6 +46,17 @@ public:
 
     void update_status(const Status& status);
 
+    // The schema of the record batches, set by the sink before it puts any batch, so an empty result has a schema.
+    std::shared_ptr<arrow::Schema> schema() {
+        std::lock_guard<SpinLock> l(_status_lock);
+        return _schema;
+    }
+
+    void set_schema(std::shared_ptr<arrow::Schema> schema) {
+        std::lock_guard<SpinLock> l(_status_lock);
+        _schema = std::move(schema);
+    }
+
     bool blocking_get(std::shared_ptr<arrow::RecordBatch>* result) { return _queue.blocking_get(result); }
 
     bool blocking_put(const std::shared_ptr<arrow::RecordBatch>& val) { return _queue.blocking_put(val); }
@@ -57,6 +70,7 @@ private:
     BlockingQueue<std::shared_ptr<arrow::RecordBatch>> _queue;
     SpinLock _status_lock;
     Status _status;
+    std::shared_ptr<arrow::Schema> _schema;
 };
 
 } // namespace starrocks
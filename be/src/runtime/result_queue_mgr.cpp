@@ -82,6 +82,16 @@ Status ResultQueueMgr::fetch_result(const TUniqueId& fragment_instance_id, std::
     return Status::OK();
 }
 
+Status ResultQueueMgr::fetch_schema(const TUniqueId& fragment_instance_id, std::shared_ptr<arrow::Schema>* schema) {
+    std::lock_guard<std::mutex> l(_lock);
+    auto iter = _fragment_queue_map.find(fragment_instance_id);
+    if (_fragment_queue_map.end() == iter) {
+        return Status::InternalError("fragment_instance_id does not exists");
+    }
+    *schema = iter->second->schema();
+    return Status::OK();
+}
+
 void ResultQueueMgr::create_queue(const TUniqueId& fragment_instance_id, BlockQueueSharedPtr* queue) {
     std::lock_guard<std::mutex> l(_lock);
     auto iter = _fragment_queue_map.find(fragment_instance_id);
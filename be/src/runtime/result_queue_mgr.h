@@ -30,7 +30,8 @@
 namespace arrow {
 
 class RecordBatch;
-}
+class Schema;
+} // namespace arrow
 
 namespace starrocks {
 
@@ -45,6 +46,9 @@ public:
 
     Status fetch_result(const TUniqueId& fragment_instance_id, std::shared_ptr<arrow::RecordBatch>* result, bool* eos);
 
+    // The schema of the results of the fragment instance, nullptr if its sink isn't prepared yet.
+    Status fetch_schema(const TUniqueId& fragment_instance_id, std::shared_ptr<arrow::Schema>* schema);
+
     void create_queue(const TUniqueId& fragment_instance_id, BlockQueueSharedPtr* queue);
 
     Status cancel(const TUniqueId& fragment_id);
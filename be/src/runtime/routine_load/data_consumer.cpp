@@ -34,6 +34,7 @@
 
 #include "runtime/routine_load/data_consumer.h"
 
+#include <algorithm>
 #include <functional>
 #include <string>
 #include <vector>
@@ -189,7 +190,7 @@ Status KafkaDataConsumer::assign_topic_partitions(const std::map<int32_t, int64_
     return Status::OK();
 }
 
-Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms) {
+Status KafkaDataConsumer::group_consume(TimedBlockingQueue<KafkaMessageBatch>* queue, int64_t max_running_time_ms) {
     DCHECK(!_k_consumer->closed());
     _last_visit_time = time(nullptr);
     int64_t left_time = max_running_time_ms;
@@ -197,6 +198,8 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
 
     int64_t received_rows = 0;
     int64_t put_rows = 0;
+    int64_t put_batches = 0;
+    const size_t batch_size = std::max(1, config::routine_load_kafka_consume_batch_size);
     Status st = Status::OK();
     MonotonicStopWatch consumer_watch;
     MonotonicStopWatch watch;
@@ -214,22 +217,42 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
         }
 
         bool done = false;
-        // consume 1 message at a time
+        // wait for the first message, then drain the messages already fetched by librdkafka without waiting,
+        // so that they are handed off to the consumer group in one batch
         consumer_watch.start();
         int64_t consume_timeout = std::min<int64_t>(left_time, config::routine_load_kafka_timeout_second * 1000);
+        KafkaMessageBatch batch;
         std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(consume_timeout /* timeout, ms */));
+        while (msg->err() == RdKafka::ERR_NO_ERROR) {
+            ++received_rows;
+            batch.emplace_back(std::move(msg));
+            if (batch.size() >= batch_size) {
+                break;
+            }
+            msg.reset(_k_consumer->consume(0));
+        }
         consumer_watch.stop();
-        switch (msg->err()) {
-        case RdKafka::ERR_NO_ERROR:
-            if (!queue->blocking_put(msg.get())) {
-                // queue is shutdown
+
+        if (!batch.empty()) {
+            size_t num_msgs = batch.size();
+            if (!queue->blocking_put(std::move(batch))) {
+                // queue is shutdown, the msgs are deleted with the batch
                 done = true;
             } else {
-                ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
+                put_rows += num_msgs;
+                ++put_batches;
             }
-            ++received_rows;
-            break;
+            // the batch is full or there is no more fetched msg, otherwise handle the msg stopping the drain below
+            if (done || msg == nullptr || msg->err() == RdKafka::ERR__TIMED_OUT) {
+                left_time = max_running_time_ms - watch.elapsed_time() / 1000 / 1000;
+                if (done) {
+                    break;
+                }
+                continue;
+            }
+        }
+
+        switch (msg->err()) {
         case RdKafka::ERR__TIMED_OUT: {
             // leave the status as OK, because this may happened
             // if there is no data in kafka.
@@ -260,13 +283,12 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
             // The last offset of partition = `offset of eof` - 1
             // The goal of put the EOF msg to queue is that:
             // we will calculate the last offset of the partition using offset of EOF msg
-            if (!queue->blocking_put(msg.get())) {
+            KafkaMessageBatch eof_batch;
+            eof_batch.emplace_back(std::move(msg));
+            if (!queue->blocking_put(std::move(eof_batch))) {
                 done = true;
             } else if (_non_eof_partition_count <= 0) {
-                msg.release();
                 done = true;
-            } else {
-                msg.release();
             }
             break;
         }
@@ -304,7 +326,7 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
     LOG(INFO) << "kafka consume done: " << _id << ", grp: " << _grp_id << ". cancelled: " << _cancelled
               << ", left time(ms): " << left_time << ", total cost(ms): " << watch.elapsed_time() / 1000 / 1000
               << ", consume cost(ms): " << consumer_watch.elapsed_time() / 1000 / 1000
-              << ", received rows: " << received_rows << ", put rows: " << put_rows;
+              << ", received rows: " << received_rows << ", put rows: " << put_rows << ", put batches: " << put_batches;
 
     return st;
 }
@@ -561,6 +583,8 @@ Status PulsarDataConsumer::group_consume(TimedBlockingQueue<pulsar::Message*>* q
 
     int64_t received_rows = 0;
     int64_t put_rows = 0;
+    int64_t put_batches = 0;
+    const size_t batch_size = std::max(1, config::routine_load_kafka_consume_batch_size);
     Status st = Status::OK();
     MonotonicStopWatch consumer_watch;
     MonotonicStopWatch watch;
@@ -620,7 +644,7 @@ Status PulsarDataConsumer::group_consume(TimedBlockingQueue<pulsar::Message*>* q
     LOG(INFO) << "pulsar consume done: " << _id << ", grp: " << _grp_id << ". cancelled: " << _cancelled
               << ", left time(ms): " << left_time << ", total cost(ms): " << watch.elapsed_time() / 1000 / 1000
               << ", consume cost(ms): " << consumer_watch.elapsed_time() / 1000 / 1000
-              << ", received rows: " << received_rows << ", put rows: " << put_rows;
+              << ", received rows: " << received_rows << ", put rows: " << put_rows << ", put batches: " << put_batches;
 
     return st;
 }
@@ -35,8 +35,10 @@
 #pragma once
 
 #include <ctime>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "librdkafka/rdkafkacpp.h"
 #include "pulsar/Client.h"
@@ -52,6 +54,9 @@ class StreamLoadPipe;
 
 using PulsarConsumerPipe = KafkaConsumerPipe;
 
+// The kafka messages handed off from a consumer to its consumer group at a time.
+using KafkaMessageBatch = std::vector<std::unique_ptr<RdKafka::Message>>;
+
 class DataConsumer {
 public:
     DataConsumer() : _id(UniqueId::gen_uid()), _grp_id(UniqueId::gen_uid()) {}
@@ -171,8 +176,8 @@ public:
     Status assign_topic_partitions(const std::map<int32_t, int64_t>& begin_partition_offset, const std::string& topic,
                                    StreamLoadContext* ctx);
 
-    // start the consumer and put msgs to queue
-    Status group_consume(TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms);
+    // start the consumer and put msgs to queue in batches
+    Status group_consume(TimedBlockingQueue<KafkaMessageBatch>* queue, int64_t max_running_time_ms);
 
     // get the partitions ids of the topic
     Status get_partition_meta(std::vector<int32_t>* partition_ids, int timeout);
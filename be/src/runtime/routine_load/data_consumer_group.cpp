@@ -38,7 +38,6 @@
 #include "runtime/routine_load/data_consumer.h"
 #include "runtime/routine_load/kafka_consumer_pipe.h"
 #include "runtime/stream_load/stream_load_context.h"
-#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -69,11 +68,8 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
     // clean the msgs left in queue
     _queue.shutdown();
     while (true) {
-        RdKafka::Message* msg;
-        if (_queue.blocking_get(&msg)) {
-            delete msg;
-            msg = nullptr;
-        } else {
+        KafkaMessageBatch batch;
+        if (!_queue.blocking_get(&batch)) {
             break;
         }
     }
@@ -192,54 +188,62 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
             }
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
+        KafkaMessageBatch batch;
+        bool res = _queue.blocking_get(&batch);
         if (res) {
-            VLOG(3) << "get kafka message"
-                    << ", partition: " << msg->partition() << ", offset: " << msg->offset() << ", len: " << msg->len();
-            DeferOp msgDeleter([&] { delete msg; });
-
-            if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
-                // For transaction producer, producer will append one control msg to the group of msgs,
-                // but the control msg will not return to consumer,
-                // so we use the offset of eof to compute the last offset.
-                // The last offset of partition = `offset of eof` - 1
-                //
-                // if msg->offset == 0, don't record into cmt_offset,
-                // because the fe will +1 and then consume the next msg.
-                //
-                // Our offset recorded in the kafka is the offset of last consumed msg,
-                // but the standard usage is to record the last offset + 1.
-                if (msg->offset() > 0) {
-                    cmt_offset[msg->partition()] = msg->offset() - 1;
-                    auto timestamp = msg->timestamp();
-                    if (timestamp.type != RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE) {
-                        cmt_offset_timestamp[msg->partition()] = msg->timestamp().timestamp;
-                    }
-                }
-            } else {
-                Status st = Status::OK();
-                st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
-                                                      static_cast<size_t>(msg->len()), row_delimiter);
-                if (st.ok()) {
-                    received_rows++;
-                    left_bytes -= msg->len();
-                    cmt_offset[msg->partition()] = msg->offset();
-
-                    auto timestamp = msg->timestamp();
-                    if (timestamp.type != RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE) {
-                        cmt_offset_timestamp[msg->partition()] = msg->timestamp().timestamp;
+            for (auto& msg : batch) {
+                VLOG(3) << "get kafka message"
+                        << ", partition: " << msg->partition() << ", offset: " << msg->offset()
+                        << ", len: " << msg->len();
+
+                if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
+                    // For transaction producer, producer will append one control msg to the group of msgs,
+                    // but the control msg will not return to consumer,
+                    // so we use the offset of eof to compute the last offset.
+                    // The last offset of partition = `offset of eof` - 1
+                    //
+                    // if msg->offset == 0, don't record into cmt_offset,
+                    // because the fe will +1 and then consume the next msg.
+                    //
+                    // Our offset recorded in the kafka is the offset of last consumed msg,
+                    // but the standard usage is to record the last offset + 1.
+                    if (msg->offset() > 0) {
+                        cmt_offset[msg->partition()] = msg->offset() - 1;
+                        auto timestamp = msg->timestamp();
+                        if (timestamp.type != RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE) {
+                            cmt_offset_timestamp[msg->partition()] = msg->timestamp().timestamp;
+                        }
                     }
-                    VLOG(3) << "consume partition[" << msg->partition() << " - " << msg->offset() << "]";
                 } else {
-                    // failed to append this msg, we must stop
-                    LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id << ", errmsg=" << st.message();
-                    eos = true;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        if (result_st.ok()) {
-                            result_st = st;
+                    Status st = Status::OK();
+                    st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
+                                                          static_cast<size_t>(msg->len()), row_delimiter);
+                    if (st.ok()) {
+                        received_rows++;
+                        left_bytes -= msg->len();
+                        cmt_offset[msg->partition()] = msg->offset();
+
+                        auto timestamp = msg->timestamp();
+                        if (timestamp.type != RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE) {
+                            cmt_offset_timestamp[msg->partition()] = msg->timestamp().timestamp;
+                        }
+                        VLOG(3) << "consume partition[" << msg->partition() << " - " << msg->offset() << "]";
+                        if (left_bytes <= 0) {
+                            // the rest msgs of the batch are not committed, they will be consumed by the next task
+                            break;
+                        }
+                    } else {
+                        // failed to append this msg, we must stop
+                        LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id
+                                     << ", errmsg=" << st.message();
+                        eos = true;
+                        {
+                            std::unique_lock<std::mutex> lock(_mutex);
+                            if (result_st.ok()) {
+                                result_st = st;
+                            }
                         }
+                        break;
                     }
                 }
             }
@@ -255,7 +259,7 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
 }
 
 void KafkaDataConsumerGroup::actual_consume(const std::shared_ptr<DataConsumer>& consumer,
-                                            TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms,
+                                            TimedBlockingQueue<KafkaMessageBatch>* queue, int64_t max_running_time_ms,
                                             const ConsumeFinishCallback& cb) {
     Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume(queue, max_running_time_ms);
     cb(st);
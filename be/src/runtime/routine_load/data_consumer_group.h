@@ -34,6 +34,9 @@
 
 #pragma once
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "runtime/routine_load/data_consumer.h"
 #include "util/blocking_queue.hpp"
 #include "util/priority_thread_pool.hpp"
@@ -80,7 +83,10 @@ protected:
 // for kafka
 class KafkaDataConsumerGroup : public DataConsumerGroup {
 public:
-    KafkaDataConsumerGroup(size_t sz) : DataConsumerGroup(sz), _queue(500) {}
+    // The queue holds at most about 500 msgs like the pulsar one, in batches.
+    KafkaDataConsumerGroup(size_t sz)
+            : DataConsumerGroup(sz),
+              _queue(std::max(1, 500 / std::max(1, config::routine_load_kafka_consume_batch_size))) {}
 
     ~KafkaDataConsumerGroup() override;
 
@@ -90,12 +96,12 @@ public:
 
 private:
     // start a single consumer
-    void actual_consume(const std::shared_ptr<DataConsumer>& consumer, TimedBlockingQueue<RdKafka::Message*>* queue,
+    void actual_consume(const std::shared_ptr<DataConsumer>& consumer, TimedBlockingQueue<KafkaMessageBatch>* queue,
                         int64_t max_running_time_ms, const ConsumeFinishCallback& cb);
 
 private:
-    // blocking queue to receive msgs from all consumers
-    TimedBlockingQueue<RdKafka::Message*> _queue;
+    // blocking queue to receive msg batches from all consumers
+    TimedBlockingQueue<KafkaMessageBatch> _queue;
 };
 
 // for pulsar
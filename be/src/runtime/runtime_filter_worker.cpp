@@ -298,6 +298,7 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
         // something wrong with deserialization.
         return;
     }
+    bool had_bf = status->can_use_bf;
     if (!rf->can_use_bf()) {
         VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. some partial rf's size exceeds "
                      "global_runtime_filter_build_max_size, stop building bf and only reserve min/max filter";
@@ -318,15 +319,26 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
     status->arrives.insert(be_number);
     status->filters.insert(std::make_pair(be_number, rf));
 
-    // not ready. still have to wait more filters.
-    if (status->filters.size() < status->expect_number) return;
+    // once the merged bf is known to be dropped, release the partial bfs right away instead of holding
+    // every partition's bf until the last partial rf arrives.
     if (!status->can_use_bf) {
-        VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter, clear bf in all filters";
-        for (auto& [be_number, rf] : status->filters) {
+        if (had_bf) {
+            VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter, clear bf in all filters";
+            for (auto& [be_number, rf] : status->filters) {
+                rf->clear_bf();
+            }
+        } else {
             rf->clear_bf();
         }
     }
+
+    // not ready. still have to wait more filters.
+    if (status->filters.size() < status->expect_number) return;
     _send_total_runtime_filter(rf_version, filter_id);
+
+    // partial rfs have been released along with the pool, drop the dangling pointers.
+    status->stop = true;
+    status->filters.clear();
 }
 
 struct BatchClosuresJoinAndClean {
@@ -343,6 +343,9 @@ public:
     bool enable_multi_cast_local_exchange_spill() const {
         return spillable_operator_mask() & (1LL << TSpillableOperatorType::MULTI_CAST_LOCAL_EXCHANGE);
     }
+    bool enable_set_operator_spill() const {
+        return spillable_operator_mask() & (1LL << TSpillableOperatorType::SET_OPERATOR);
+    }
 
     int32_t spill_mem_table_size() const {
         return EXTRACE_SPILL_PARAM(_query_options, _spill_options, spill_mem_table_size);
@@ -746,7 +746,7 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
 
         auto& chunk_queues = _buffered_chunk_queues[be_number];
 
-        if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes)) {
+        if (!chunks.empty() && done != nullptr && _recvr->exceeds_elastic_limit(total_chunk_bytes)) {
             chunks.back().closure = *done;
             chunks.back().queue_enter_time = MonotonicNanos();
             COUNTER_UPDATE(metrics.closure_block_counter, 1);
@@ -798,7 +798,7 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
             iter++;
         }
 
-        if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes)) {
+        if (!chunks.empty() && done != nullptr && _recvr->exceeds_elastic_limit(total_chunk_bytes)) {
             chunks.back().closure = *done;
             chunks.back().queue_enter_time = MonotonicNanos();
             COUNTER_UPDATE(metrics.closure_block_counter, 1);
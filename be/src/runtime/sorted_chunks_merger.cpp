@@ -37,18 +37,13 @@ Status SortedChunksMerger::init(const ChunkSuppliers& chunk_suppliers, const Chu
         _single_has_supplier = chunk_has_suppliers[0];
     } else {
         _cursors.reserve(chunk_suppliers.size());
-        _min_heap.reserve(chunk_suppliers.size());
         for (int i = 0; i < chunk_suppliers.size(); ++i) {
             _cursors.emplace_back(std::make_unique<ChunkCursor>(chunk_suppliers[i], chunk_probe_suppliers[i],
                                                                 chunk_has_suppliers[i], sort_exprs, is_asc,
                                                                 is_null_first, _is_pipeline));
-            ChunkCursor* cursor = _cursors.rbegin()->get();
-            cursor->next();
-            if (cursor->is_valid()) {
-                _min_heap.push_back(cursor);
-            }
+            _cursors.back()->next();
         }
-        std::make_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        build_cursor_tree();
     }
     return Status::OK();
 }
@@ -77,48 +72,53 @@ bool SortedChunksMerger::is_data_ready() {
     if (_cursors.size() == 1) {
         return _cursors[0]->chunk_has_supplier();
     } else {
-        if (!_after_min_heap) {
+        if (!_after_cursor_tree) {
             for (auto& cursor : _cursors) {
                 if (!cursor->chunk_has_supplier()) {
                     return false;
                 }
             }
-            init_for_min_heap();
+            init_for_cursor_tree();
             return true;
         } else {
             // if wait for data, we should probe next row;
-            // else because we have move to next row, so just test min_heap.
+            // else because we have move to next row, so just test the cursor tree.
             if (_wait_for_data) {
                 return _cursor->has_next() || _cursor->chunk_has_supplier();
             } else {
-                // when _wait_for_data is false, min heap is ready to produce output.
-                // case 1: min heap is empty, EOS has arrived.
-                // case 2: min heap is not emtpy, each cursor in min heap must satisfy one of properties following:
+                // when _wait_for_data is false, the cursor tree is ready to produce output.
+                // case 1: the cursor tree is empty, EOS has arrived.
+                // case 2: the cursor tree is not emtpy, each cursor in it must satisfy one of properties following:
                 //     property 1: the current chunk is the cursor is not exhausted, or
                 //     property 2: the SenderQueue of the cursor has chunks ready for processing, or
                 //     property 3: the SenderQueue of the cursor has received the EOS.
                 //
-                // so in conclusion, in such situations, min_heap is always ready.
+                // so in conclusion, in such situations, the cursor tree is always ready.
                 return true;
             }
         }
     }
 }
 
-void SortedChunksMerger::init_for_min_heap() {
+void SortedChunksMerger::build_cursor_tree() {
+    _cursor_tree = std::make_unique<CursorTree>(_cursors.size(), CursorLess{&_cursors});
+    for (size_t i = 0; i < _cursors.size(); ++i) {
+        if (!_cursors[i]->is_valid()) {
+            _cursor_tree->mark_exhausted(i);
+        }
+    }
+    _cursor_tree->build();
+}
+
+void SortedChunksMerger::init_for_cursor_tree() {
     if (_cursors.size() > 1) {
-        _min_heap.reserve(_cursors.size());
-        for (auto& cursor_ptr : _cursors) {
-            ChunkCursor* cursor = cursor_ptr.get();
+        for (auto& cursor : _cursors) {
             cursor->next_chunk_for_pipeline();
             cursor->next_for_pipeline();
-            if (cursor->is_valid()) {
-                _min_heap.push_back(cursor);
-            }
         }
-        std::make_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        build_cursor_tree();
     }
-    _after_min_heap = true;
+    _after_cursor_tree = true;
 }
 
 void SortedChunksMerger::set_profile(RuntimeProfile* profile) {
@@ -129,7 +129,7 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
     ScopedTimer<MonotonicStopWatch> timer(_total_timer);
 
     DCHECK(chunk != nullptr);
-    if (_min_heap.empty() && !_single_supplier) {
+    if (is_merge_finished() && !_single_supplier) {
         *eos = true;
         *chunk = nullptr;
         return Status::OK();
@@ -146,7 +146,7 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
 
     // multiple sources
     *eos = false;
-    ChunkCursor* cursor = _min_heap[0];
+    ChunkCursor* cursor = _cursors[_cursor_tree->winner()].get();
     *chunk = cursor->clone_empty_chunk(_state->chunk_size());
 
     ChunkPtr current_chunk = cursor->get_current_chunk();
@@ -155,16 +155,15 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
     selective_values.push_back(cursor->get_current_position_in_chunk());
     size_t row_number = 1;
 
-    std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
     cursor->next();
     if (cursor->is_valid()) {
-        std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        _cursor_tree->replay();
     } else {
-        _min_heap.pop_back();
+        _cursor_tree->pop();
     }
 
-    while (row_number < _state->chunk_size() && !_min_heap.empty()) {
-        cursor = _min_heap[0];
+    while (row_number < _state->chunk_size() && !_cursor_tree->empty()) {
+        cursor = _cursors[_cursor_tree->winner()].get();
         const auto& ptr = cursor->get_current_chunk();
         if (current_chunk == ptr) {
             selective_values.push_back(cursor->get_current_position_in_chunk());
@@ -175,12 +174,11 @@ Status SortedChunksMerger::get_next(ChunkPtr* chunk, bool* eos) {
             selective_values.push_back(cursor->get_current_position_in_chunk());
         }
 
-        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
         cursor->next();
         if (cursor->is_valid()) {
-            std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+            _cursor_tree->replay();
         } else {
-            _min_heap.pop_back();
+            _cursor_tree->pop();
         }
 
         ++row_number;
@@ -197,7 +195,7 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
 
     DCHECK(chunk != nullptr);
     *chunk = std::make_shared<Chunk>();
-    if (_min_heap.empty() && !_single_probe_supplier) {
+    if (is_merge_finished() && !_single_probe_supplier) {
         *eos = true;
         return Status::OK();
     }
@@ -228,16 +226,16 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
         // move to next row
         if (_wait_for_data) {
             _wait_for_data = false;
-            move_cursor_and_adjust_min_heap(eos);
-            if (_row_number >= _state->chunk_size() || _min_heap.empty()) {
+            move_cursor_and_replay(eos);
+            if (_row_number >= _state->chunk_size() || _cursor_tree->empty()) {
                 collect_merged_chunks(chunk);
                 break;
             }
         }
 
         // STEP 0:
-        // Guarantee: min_heap is keep min heap property, and it isn't empty.
-        _cursor = _min_heap[0];
+        // Guarantee: the cursor tree isn't empty, and its winner is the cursor of the smallest row.
+        _cursor = _cursors[_cursor_tree->winner()].get();
         if (!_row_number) {
             _result_chunk = _cursor->clone_empty_chunk(_state->chunk_size());
             _current_chunk = _cursor->get_current_chunk();
@@ -259,8 +257,7 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
         }
 
         ++_row_number;
-        // we move min-element in the heap and then probe next row in cursor.
-        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        // the winner stays in the cursor tree until it moves to the next row, then the tree is replayed.
         _wait_for_data = true;
 
         // probe next row.
@@ -271,8 +268,8 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
             // STEP 1:
             // move to next row
             _wait_for_data = false;
-            move_cursor_and_adjust_min_heap(eos);
-            if (_row_number >= _state->chunk_size() || _min_heap.empty()) {
+            move_cursor_and_replay(eos);
+            if (_row_number >= _state->chunk_size() || _cursor_tree->empty()) {
                 collect_merged_chunks(chunk);
                 break;
             }
@@ -282,16 +279,16 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
     return Status::OK();
 }
 
-void SortedChunksMerger::move_cursor_and_adjust_min_heap(std::atomic<bool>* eos) {
+void SortedChunksMerger::move_cursor_and_replay(std::atomic<bool>* eos) {
     // It has next row, so we move cursor.
     _cursor->next_for_pipeline();
     if (_cursor->is_valid()) {
-        // we should adjust min_heap to keep min heap property.
-        std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+        // replay the matches of the cursor with its next row.
+        _cursor_tree->replay();
     } else {
         // just remove one source.
-        _min_heap.pop_back();
-        *eos = _min_heap.empty();
+        _cursor_tree->pop();
+        *eos = _cursor_tree->empty();
     }
 }
 void SortedChunksMerger::collect_merged_chunks(ChunkPtr* chunk) {
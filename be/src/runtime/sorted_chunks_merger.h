@@ -20,6 +20,7 @@
 #include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "runtime/chunk_cursor.h"
+#include "util/loser_tree.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -46,14 +47,19 @@ public:
     Status get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bool>* eos, bool* should_exit);
 
 private:
-    struct CursorCmpGreater {
-        // if a is greater than b.
-        inline bool operator()(const ChunkCursor* a, const ChunkCursor* b) { return b->operator<(*a); }
+    struct CursorLess {
+        const std::vector<std::unique_ptr<ChunkCursor>>* cursors;
+
+        bool operator()(size_t lhs, size_t rhs) const { return *(*cursors)[lhs] < *(*cursors)[rhs]; }
     };
+    using CursorTree = LoserTree<CursorLess>;
 
-    void init_for_min_heap();
+    // Builds the loser tree of the cursors, after each of them moved to its first row.
+    void build_cursor_tree();
+    void init_for_cursor_tree();
+    bool is_merge_finished() const { return _cursor_tree == nullptr || _cursor_tree->empty(); }
     void collect_merged_chunks(ChunkPtr* chunk);
-    void move_cursor_and_adjust_min_heap(std::atomic<bool>* eos);
+    void move_cursor_and_replay(std::atomic<bool>* eos);
 
     RuntimeState* _state;
     bool _is_pipeline;
@@ -63,17 +69,16 @@ private:
     ChunkHasSupplier _single_has_supplier;
 
     std::vector<std::unique_ptr<ChunkCursor>> _cursors;
-    CursorCmpGreater _cursor_cmp_greater;
-    std::vector<ChunkCursor*> _min_heap;
+    std::unique_ptr<CursorTree> _cursor_tree;
 
     RuntimeProfile::Counter* _total_timer = nullptr;
 
     // for multiple suppliers.
-    bool _after_min_heap = false;
+    bool _after_cursor_tree = false;
 
     /* this is for pipeline.
      * _row_number: is initial 0, and record the number of rows between calls, after return datas, set _row_number back to 0.
-     * _cursor: will record top element of min_heap.
+     * _cursor: will record the winner of the cursor tree.
      * _current_chunk: record currently used chunk.
      * _result_chunk: copy rows from every _current_chunk. 
      * _selective_values: used to record index in _current_chunk.
@@ -423,12 +423,40 @@ bool date::from_string_to_datetime_internal(const char* ptr_date, const char* pt
 
     return true;
 }
+// process string based on format like "%Y-%m-%d %H:%i:%s.%f" or "%Y-%m-%dT%H:%i:%s.%f"
+// with 1 to 6 digits of fraction, which is the common output of the logs and the ISO-8601 writers.
+// if successful return true;
+// else return false;
+bool date::from_string_to_datetime_with_fraction(const char* ptr, int length, ToDatetimeResult* res) {
+    if (length <= 20 || length > 26 || (ptr[10] != ' ' && ptr[10] != 'T') || ptr[19] != '.') {
+        return false;
+    }
+    auto& [year, month, day, hour, minute, second, microsecond] = *res;
+    if (!from_string_to_datetime_internal(ptr, ptr + 11, &year, &month, &day, &hour, &minute, &second,
+                                          &microsecond)) {
+        return false;
+    }
+    int fraction = 0;
+    for (int i = 20; i < length; ++i) {
+        uint8_t digit;
+        if (char_to_digit(ptr, i, &digit)) {
+            return false;
+        }
+        fraction = fraction * 10 + digit;
+    }
+    microsecond = fraction * LOG_10_INT[26 - length];
+    return true;
+}
+
 // if string content is 10 chars try to process based on "%Y-%m-%d",
 //    if successful return result;
 //    else failed use uncommon approach.
 // if string content is like "%Y-%m-%d %H:%i:%s" try to process based on %Y-%m-%d %H:%i:%s,
 //    if successful return result;
 //    else failed use uncommon approach.
+// if string content is like "%Y-%m-%d %H:%i:%s.%f" try to process based on it,
+//    if successful return result;
+//    else failed use uncommon approach.
 // else use uncommon approach.
 //
 // @return <is_valid, is_only_date>
@@ -457,6 +485,13 @@ std::pair<bool, bool> date::from_string_to_datetime(const char* date_str, size_t
         return {from_string(date_str, len, &year, &month, &day, &hour, &minute, &second, &microsecond), false};
     }
 
+    if (length > 20 && length <= 26 && ptr[19] == '.') {
+        if (from_string_to_datetime_with_fraction(ptr, length, res)) {
+            return {true, false};
+        }
+        return {from_string(date_str, len, &year, &month, &day, &hour, &minute, &second, &microsecond), false};
+    }
+
     const char* ptr_date = ptr;
     const char* ptr_time = nullptr;
     if (is_standard_datetime_format(ptr, length, &ptr_time)) {
@@ -167,6 +167,10 @@ public:
         int microsecond;
     };
 
+    // process string based on format like "%Y-%m-%d %H:%i:%s.%f" with 1 to 6 digits of fraction,
+    // `ptr` has no leading and trailing spaces.
+    static bool from_string_to_datetime_with_fraction(const char* ptr, int length, ToDatetimeResult* res);
+
     static std::pair<bool, bool> from_string_to_datetime(const char* date_str, size_t len, ToDatetimeResult* res);
 
 public:
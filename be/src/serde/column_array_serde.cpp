@@ -20,6 +20,11 @@
 #include <streamvbyte.h>
 #include <streamvbytedelta.h>
 
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include "column/array_column.h"
 #include "column/binary_column.h"
 #include "column/column_visitor_adapter.h"
@@ -34,6 +39,7 @@
 #include "gutil/strings/substitute.h"
 #include "runtime/descriptors.h"
 #include "serde/protobuf_serde.h"
+#include "simd/null_mask.h"
 #include "types/hll.h"
 #include "util/coding.h"
 #include "util/json.h"
@@ -111,6 +117,116 @@ const uint8_t* decode_integers(const uint8_t* buff, void* target, size_t size) {
     return buff + decode_size;
 }
 
+// Frame of reference encoding: the integers are stored as their unsigned deltas to the minimum value, which are
+// encoded by streamvbyte if all of them fit into 32 bits. Small range values such as timestamps or ids with a
+// large base are encoded into 1~2 bytes per value, while streamvbyte over the raw words can not shrink them.
+// The columns made of long runs of the same value, e.g. the sort key prefix or the partition columns of a scan,
+// are run-length encoded instead.
+constexpr uint8_t kIntegersRaw = 0;
+constexpr uint8_t kIntegersFrameOfReference = 1;
+constexpr uint8_t kIntegersRunLength = 2;
+// Run-length encode if the runs are 8 values long on average.
+constexpr size_t kMinAverageRunLength = 8;
+
+template <typename T>
+uint8_t* encode_integers_for(const T* data, size_t num, uint8_t* buff, int encode_level) {
+    using U = std::make_unsigned_t<T>;
+    T min_value = data[0];
+    T max_value = data[0];
+    size_t num_runs = 1;
+    for (size_t i = 1; i < num; i++) {
+        min_value = std::min(min_value, data[i]);
+        max_value = std::max(max_value, data[i]);
+        num_runs += data[i] != data[i - 1];
+    }
+    if (num_runs * kMinAverageRunLength <= num) {
+        *buff++ = kIntegersRunLength;
+        buff = write_little_endian_64(num_runs, buff);
+        size_t run_start = 0;
+        for (size_t i = 1; i <= num; i++) {
+            if (i == num || data[i] != data[run_start]) {
+                buff = write_raw(&data[run_start], sizeof(T), buff);
+                buff = write_little_endian_32(static_cast<uint32_t>(i - run_start), buff);
+                run_start = i;
+            }
+        }
+        VLOG_ROW << fmt::format("raw size = {}, num runs = {}, run length compression ratio = {}\n", num * sizeof(T),
+                                num_runs, num_runs * (sizeof(T) + sizeof(uint32_t)) * 1.0 / (num * sizeof(T)));
+        return buff;
+    }
+    if (static_cast<U>(static_cast<U>(max_value) - static_cast<U>(min_value)) > std::numeric_limits<uint32_t>::max()) {
+        *buff++ = kIntegersRaw;
+        return encode_integers<false>(data, num * sizeof(T), buff, encode_level);
+    }
+    *buff++ = kIntegersFrameOfReference;
+    buff = write_raw(&min_value, sizeof(T), buff);
+    std::vector<uint32_t> deltas(num);
+    for (size_t i = 0; i < num; i++) {
+        deltas[i] = static_cast<uint32_t>(static_cast<U>(data[i]) - static_cast<U>(min_value));
+    }
+    uint64_t encode_size = streamvbyte_encode(deltas.data(), num, buff + sizeof(uint64_t));
+    buff = write_little_endian_64(encode_size, buff);
+
+    VLOG_ROW << fmt::format("raw size = {}, encoded size = {}, frame of reference compression ratio = {}\n",
+                            num * sizeof(T), encode_size, encode_size * 1.0 / (num * sizeof(T)));
+    return buff + encode_size;
+}
+
+template <typename T>
+const uint8_t* decode_integers_for(const uint8_t* buff, T* target, size_t num) {
+    using U = std::make_unsigned_t<T>;
+    const uint8_t mode = *buff++;
+    if (mode == kIntegersRaw) {
+        return decode_integers<false>(buff, target, num * sizeof(T));
+    }
+    if (mode == kIntegersRunLength) {
+        uint64_t num_runs = 0;
+        buff = read_little_endian_64(buff, &num_runs);
+        size_t offset = 0;
+        for (uint64_t i = 0; i < num_runs; i++) {
+            T value;
+            uint32_t run_length = 0;
+            buff = read_raw(buff, &value, sizeof(T));
+            buff = read_little_endian_32(buff, &run_length);
+            if (offset + run_length > num) {
+                throw std::runtime_error(
+                        fmt::format("run length decoded more than {} values, num runs = {}.", num, num_runs));
+            }
+            std::fill(target + offset, target + offset + run_length, value);
+            offset += run_length;
+        }
+        if (offset != num) {
+            throw std::runtime_error(fmt::format("run length decoded {} values, but expect {}.", offset, num));
+        }
+        return buff;
+    }
+    T min_value;
+    buff = read_raw(buff, &min_value, sizeof(T));
+    uint64_t encode_size = 0;
+    buff = read_little_endian_64(buff, &encode_size);
+    uint64_t decode_size = 0;
+    if constexpr (sizeof(T) == sizeof(uint32_t)) {
+        // decode the deltas in place
+        decode_size = streamvbyte_decode(buff, reinterpret_cast<uint32_t*>(target), num);
+        for (size_t i = 0; i < num; i++) {
+            target[i] = static_cast<T>(static_cast<U>(target[i]) + static_cast<U>(min_value));
+        }
+    } else {
+        std::vector<uint32_t> deltas(num);
+        decode_size = streamvbyte_decode(buff, deltas.data(), num);
+        for (size_t i = 0; i < num; i++) {
+            target[i] = static_cast<T>(static_cast<U>(deltas[i]) + static_cast<U>(min_value));
+        }
+    }
+    if (encode_size != decode_size) {
+        throw std::runtime_error(fmt::format(
+                "frame of reference encode size does not equal when decoding, encode size = {}, but decode get size "
+                "= {}, num values = {}.",
+                encode_size, decode_size, num));
+    }
+    return buff + decode_size;
+}
+
 uint8_t* encode_string_lz4(const void* data, size_t size, uint8_t* buff, int encode_level) {
     if (size > LZ4_MAX_INPUT_SIZE) {
         throw std::runtime_error(
@@ -150,10 +266,19 @@ const uint8_t* decode_string_lz4(const uint8_t* buff, void* target, size_t size)
 template <typename T, bool sorted>
 class FixedLengthColumnSerde {
 public:
+    static constexpr bool kSupportFrameOfReference =
+            !sorted && std::is_integral_v<T> && (sizeof(T) == sizeof(int32_t) || sizeof(T) == sizeof(int64_t));
+
+    static bool use_frame_of_reference(const int encode_level) {
+        return kSupportFrameOfReference && EncodeContext::enable_encode_frame_of_reference(encode_level);
+    }
+
     static int64_t max_serialized_size(const FixedLengthColumnBase<T>& column, const int encode_level) {
         uint32_t size = sizeof(T) * column.size();
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
-            return sizeof(uint32_t) + sizeof(uint64_t) +
+            // the mode byte and the minimum value of frame of reference
+            int64_t for_header = use_frame_of_reference(encode_level) ? 1 + sizeof(T) : 0;
+            return sizeof(uint32_t) + sizeof(uint64_t) + for_header +
                    std::max((int64_t)size, (int64_t)streamvbyte_max_compressedbytes(upper_int32(size)));
         } else {
             return sizeof(uint32_t) + size;
@@ -164,6 +289,11 @@ public:
         uint32_t size = sizeof(T) * column.size();
         buff = write_little_endian_32(size, buff);
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
+            if constexpr (kSupportFrameOfReference) {
+                if (use_frame_of_reference(encode_level)) {
+                    return encode_integers_for<T>(column.get_data().data(), column.size(), buff, encode_level);
+                }
+            }
             if (sizeof(T) == 4 && sorted) { // only support sorted 32-bit integers
                 buff = encode_integers<true>(column.raw_data(), size, buff, encode_level);
             } else {
@@ -181,6 +311,11 @@ public:
         auto& data = column->get_data();
         raw::make_room(&data, size / sizeof(T));
         if (EncodeContext::enable_encode_integer(encode_level) && size >= ENCODE_SIZE_LIMIT) {
+            if constexpr (kSupportFrameOfReference) {
+                if (use_frame_of_reference(encode_level)) {
+                    return decode_integers_for<T>(buff, data.data(), size / sizeof(T));
+                }
+            }
             if (sizeof(T) == 4 && sorted) { // only support sorted 32-bit integers
                 buff = decode_integers<true>(buff, data.data(), size);
             } else {
@@ -195,6 +330,13 @@ public:
 
 class BinaryColumnSerde {
 public:
+    // LZ4 can't compress more than LZ4_MAX_INPUT_SIZE bytes in one block, so the bytes of a large binary column
+    // above it are written raw rather than failing the whole exchange or spill.
+    static bool encode_bytes(const int encode_level, size_t bytes_size) {
+        return EncodeContext::enable_encode_string(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT &&
+               bytes_size <= LZ4_MAX_INPUT_SIZE;
+    }
+
     template <typename T>
     static int64_t max_serialized_size(const BinaryColumnBase<T>& column, const int encode_level) {
         const auto& bytes = column.get_bytes();
@@ -207,7 +349,7 @@ public:
         } else {
             res += offsets_size;
         }
-        if (EncodeContext::enable_encode_string(encode_level) && bytes.size() >= ENCODE_SIZE_LIMIT) {
+        if (encode_bytes(encode_level, bytes.size())) {
             res += sizeof(uint64_t) + std::max((int64_t)bytes.size(), (int64_t)LZ4_compressBound(bytes.size()));
         } else {
             res += bytes.size();
@@ -226,7 +368,7 @@ public:
         } else {
             buff = write_little_endian_64(bytes_size, buff);
         }
-        if (EncodeContext::enable_encode_string(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT) {
+        if (encode_bytes(encode_level, bytes_size)) {
             buff = encode_string_lz4(bytes.data(), bytes_size, buff, encode_level);
         } else {
             buff = write_raw(bytes.data(), bytes_size, buff);
@@ -260,7 +402,7 @@ public:
             buff = read_little_endian_64(buff, &bytes_size);
         }
         column->get_bytes().resize(bytes_size);
-        if (EncodeContext::enable_encode_string(encode_level) && bytes_size >= ENCODE_SIZE_LIMIT) {
+        if (encode_bytes(encode_level, bytes_size)) {
             buff = decode_string_lz4(buff, column->get_bytes().data(), bytes_size);
         } else {
             buff = read_raw(buff, column->get_bytes().data(), bytes_size);
@@ -381,18 +523,36 @@ public:
 class NullableColumnSerde {
 public:
     static int64_t max_serialized_size(const NullableColumn& column, const int encode_level) {
-        return serde::ColumnArraySerde::max_serialized_size(*column.null_column(), encode_level) +
-               serde::ColumnArraySerde::max_serialized_size(*column.data_column(), encode_level);
+        int64_t null_size = EncodeContext::enable_encode_null_mask(encode_level)
+                                    ? sizeof(uint32_t) + SIMD::NullMask::num_bytes(column.size())
+                                    : serde::ColumnArraySerde::max_serialized_size(*column.null_column(), encode_level);
+        return null_size + serde::ColumnArraySerde::max_serialized_size(*column.data_column(), encode_level);
     }
 
     static uint8_t* serialize(const NullableColumn& column, uint8_t* buff, const int encode_level) {
-        buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+        if (EncodeContext::enable_encode_null_mask(encode_level)) {
+            const auto num_rows = static_cast<uint32_t>(column.size());
+            buff = write_little_endian_32(num_rows, buff);
+            SIMD::NullMask::pack(column.null_column()->raw_data(), num_rows, buff);
+            buff += SIMD::NullMask::num_bytes(num_rows);
+        } else {
+            buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+        }
         buff = serde::ColumnArraySerde::serialize(*column.data_column(), buff, false, encode_level);
         return buff;
     }
 
     static const uint8_t* deserialize(const uint8_t* buff, NullableColumn* column, const int encode_level) {
-        buff = serde::ColumnArraySerde::deserialize(buff, column->null_column().get(), false, encode_level);
+        if (EncodeContext::enable_encode_null_mask(encode_level)) {
+            uint32_t num_rows = 0;
+            buff = read_little_endian_32(buff, &num_rows);
+            auto& null_data = column->null_column()->get_data();
+            raw::make_room(&null_data, num_rows);
+            SIMD::NullMask::unpack(buff, num_rows, null_data.data());
+            buff += SIMD::NullMask::num_bytes(num_rows);
+        } else {
+            buff = serde::ColumnArraySerde::deserialize(buff, column->null_column().get(), false, encode_level);
+        }
         buff = serde::ColumnArraySerde::deserialize(buff, column->data_column().get(), false, encode_level);
         column->update_has_null();
         return buff;
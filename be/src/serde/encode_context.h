@@ -61,9 +61,19 @@ public:
 
     static bool enable_encode_string(const int encode_level) { return encode_level & ENCODE_STRING; }
 
+    // Encode 32/64-bit integers with frame of reference before streamvbyte, it only works with ENCODE_INTEGER.
+    static bool enable_encode_frame_of_reference(const int encode_level) {
+        return encode_level & ENCODE_FRAME_OF_REFERENCE;
+    }
+
+    // Serialize the null data of nullable columns as bit-packed null masks.
+    static bool enable_encode_null_mask(const int encode_level) { return encode_level & ENCODE_NULL_MASK; }
+
 private:
     static constexpr int ENCODE_INTEGER = 2;
     static constexpr int ENCODE_STRING = 4;
+    static constexpr int ENCODE_FRAME_OF_REFERENCE = 8;
+    static constexpr int ENCODE_NULL_MASK = 16;
 
     // if encode ratio < EncodeRatioLimit, encode it, otherwise not.
     void _adjust(const int col_id);
@@ -0,0 +1,151 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "service/service_be/arrow_flight_service.h"
+
+#include <arrow/flight/server.h>
+#include <arrow/record_batch.h>
+
+#include <ctime>
+
+#include "runtime/exec_env.h"
+#include "runtime/external_scan_context_mgr.h"
+#include "runtime/result_queue_mgr.h"
+#include "service/backend_options.h"
+#include "util/arrow/utils.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+static arrow::Status to_arrow_status(const Status& status) {
+    if (status.ok()) {
+        return arrow::Status::OK();
+    }
+    return arrow::Status::IOError(status.to_string());
+}
+
+// Reads the record batches of an external scan from the result queue of its fragment instance, and keeps the offset
+// of the scan context as get_next does. The context isn't reaped while it's being read.
+class ScanContextReader final : public arrow::RecordBatchReader {
+public:
+    ScanContextReader(ExecEnv* env, std::shared_ptr<ScanContext> context) : _env(env), _context(std::move(context)) {
+        _context->last_access_time = -1;
+    }
+
+    ~ScanContextReader() override { _context->last_access_time = time(nullptr); }
+
+    // Waits for the first batch, after which the sink must have set the schema.
+    arrow::Status init() {
+        ARROW_RETURN_NOT_OK(_fetch(&_first_batch));
+        if (_first_batch != nullptr) {
+            _schema = _first_batch->schema();
+        } else {
+            ARROW_RETURN_NOT_OK(to_arrow_status(
+                    _env->result_queue_mgr()->fetch_schema(_context->fragment_instance_id, &_schema)));
+        }
+        if (_schema == nullptr) {
+            return arrow::Status::Invalid("the schema of the scan is unknown, context_id=", _context->context_id);
+        }
+        return arrow::Status::OK();
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override { return _schema; }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override {
+        if (_first_batch != nullptr) {
+            *batch = std::move(_first_batch);
+            return arrow::Status::OK();
+        }
+        return _fetch(batch);
+    }
+
+private:
+    arrow::Status _fetch(std::shared_ptr<arrow::RecordBatch>* batch) {
+        batch->reset();
+        if (_eos) {
+            return arrow::Status::OK();
+        }
+        std::shared_ptr<arrow::RecordBatch> result;
+        auto* result_queue_mgr = _env->result_queue_mgr();
+        ARROW_RETURN_NOT_OK(
+                to_arrow_status(result_queue_mgr->fetch_result(_context->fragment_instance_id, &result, &_eos)));
+        if (!_eos) {
+            _context->offset += result->num_rows();
+            *batch = std::move(result);
+        }
+        return arrow::Status::OK();
+    }
+
+    ExecEnv* _env;
+    std::shared_ptr<ScanContext> _context;
+    std::shared_ptr<arrow::Schema> _schema;
+    std::shared_ptr<arrow::RecordBatch> _first_batch;
+    bool _eos = false;
+};
+
+class ArrowFlightServiceBE::FlightServer final : public arrow::flight::FlightServerBase {
+public:
+    explicit FlightServer(ExecEnv* env) : _env(env) {}
+
+    arrow::Status DoGet(const arrow::flight::ServerCallContext& context, const arrow::flight::Ticket& request,
+                        std::unique_ptr<arrow::flight::FlightDataStream>* stream) override {
+        std::shared_ptr<ScanContext> scan_context;
+        ARROW_RETURN_NOT_OK(
+                to_arrow_status(_env->external_scan_context_mgr()->get_scan_context(request.ticket, &scan_context)));
+        if (scan_context->offset != 0) {
+            return arrow::Status::Invalid("the scan has been read by get_next, context_id=", request.ticket);
+        }
+        auto reader = std::make_shared<ScanContextReader>(_env, std::move(scan_context));
+        ARROW_RETURN_NOT_OK(reader->init());
+        *stream = std::make_unique<arrow::flight::RecordBatchStream>(std::move(reader));
+        return arrow::Status::OK();
+    }
+
+private:
+    ExecEnv* _env;
+};
+
+ArrowFlightServiceBE::ArrowFlightServiceBE(ExecEnv* env, int port) : _env(env), _port(port) {}
+
+ArrowFlightServiceBE::~ArrowFlightServiceBE() {
+    stop();
+}
+
+Status ArrowFlightServiceBE::start() {
+    auto location = arrow::flight::Location::ForGrpcTcp(BackendOptions::get_service_bind_address(), _port);
+    if (!location.ok()) {
+        return to_status(location.status());
+    }
+    auto server = std::make_unique<FlightServer>(_env);
+    arrow::flight::FlightServerOptions options(*location);
+    RETURN_IF_ERROR(to_status(server->Init(options)));
+    LOG(INFO) << "Arrow Flight server bind to host: " << BackendOptions::get_service_bind_address()
+              << ", port: " << _port;
+    _server = std::move(server);
+    return Status::OK();
+}
+
+void ArrowFlightServiceBE::stop() {
+    if (_server == nullptr) {
+        return;
+    }
+    auto st = _server->Shutdown();
+    if (st.ok()) {
+        st = _server->Wait();
+    }
+    LOG_IF(WARNING, !st.ok()) << "Fail to stop the Arrow Flight server: " << st.ToString();
+    _server.reset();
+}
+
+} // namespace starrocks
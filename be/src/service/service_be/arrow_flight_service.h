@@ -0,0 +1,47 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+class ExecEnv;
+
+// Arrow Flight service for StarRocks BE.
+//
+// It streams the results of an external scan, opened by BackendService::open_scanner, as Arrow record batches: the
+// ticket of a DoGet is the context id of the scan, and the batches are read from the result queue of the fragment
+// instance, which is filled by the memory scratch sink. Unlike get_next, the client doesn't fetch and deserialize
+// the batches one by one through thrift.
+class ArrowFlightServiceBE {
+public:
+    ArrowFlightServiceBE(ExecEnv* env, int port);
+    ~ArrowFlightServiceBE();
+
+    Status start();
+    void stop();
+
+private:
+    class FlightServer;
+
+    ExecEnv* _env;
+    int _port;
+    std::unique_ptr<FlightServer> _server;
+};
+
+} // namespace starrocks
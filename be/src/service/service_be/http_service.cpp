@@ -40,6 +40,7 @@
 #include "http/action/compact_rocksdb_meta_action.h"
 #include "http/action/compaction_action.h"
 #include "http/action/datacache_action.h"
+#include "http/action/exchange_link_stats_action.h"
 #include "http/action/greplog_action.h"
 #include "http/action/health_action.h"
 #include "http/action/lake/dump_tablet_metadata_action.h"
@@ -47,6 +48,7 @@
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pipeline_blocking_drivers_action.h"
+#include "http/action/pipeline_driver_timeline_action.h"
 #include "http/action/pprof_actions.h"
 #include "http/action/query_cache_action.h"
 #include "http/action/reload_tablet_action.h"
@@ -181,6 +183,10 @@ Status HttpServiceBE::start() {
     _ev_http_server->register_handler(HttpMethod::POST, "/pprof/symbol", symbol_action);
     _http_handlers.emplace_back(symbol_action);
 
+    auto* cpu_samples_action = new CpuSamplesAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/pprof/cpu_samples", cpu_samples_action);
+    _http_handlers.emplace_back(cpu_samples_action);
+
     auto* ioprofile_action = new IOProfileAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/ioprofile", ioprofile_action);
     _http_handlers.emplace_back(ioprofile_action);
@@ -264,6 +270,7 @@ Status HttpServiceBE::start() {
 
     auto* datacache_action = new DataCacheAction(_env);
     _ev_http_server->register_handler(HttpMethod::GET, "/api/datacache/{action}", datacache_action);
+    _ev_http_server->register_handler(HttpMethod::POST, "/api/datacache/{action}", datacache_action);
     _http_handlers.emplace_back(datacache_action);
 
     auto* pipeline_driver_poller_action = new PipelineBlockingDriversAction(_env);
@@ -271,6 +278,17 @@ Status HttpServiceBE::start() {
                                       pipeline_driver_poller_action);
     _http_handlers.emplace_back(pipeline_driver_poller_action);
 
+    auto* pipeline_driver_timeline_action = new PipelineDriverTimelineAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/pipeline_driver_timeline",
+                                      pipeline_driver_timeline_action);
+    _http_handlers.emplace_back(pipeline_driver_timeline_action);
+
+    auto* exchange_link_stats_action = new ExchangeLinkStatsAction();
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/exchange_link_stats/{action}", exchange_link_stats_action);
+    _ev_http_server->register_handler(HttpMethod::POST, "/api/exchange_link_stats/{action}",
+                                      exchange_link_stats_action);
+    _http_handlers.emplace_back(exchange_link_stats_action);
+
     auto* greplog_action = new GrepLogAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/greplog", greplog_action);
     _http_handlers.emplace_back(greplog_action);
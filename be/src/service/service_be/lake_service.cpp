@@ -163,6 +163,9 @@ void LakeServiceImpl::publish_version(::google::protobuf::RpcController* control
     auto thread_pool_token = ConcurrencyLimitedThreadPoolToken(thread_pool, thread_pool->max_threads() * 2);
     auto latch = BThreadCountDownLatch(request->tablet_ids_size());
     bthread::Mutex response_mtx;
+    // The new metadata to be written into the bundle by the aggregated publish, guarded by |response_mtx|.
+    auto aggregate_publish = request->enable_aggregate_publish();
+    std::vector<TabletMetadataPtr> bundle_metadatas;
     scoped_refptr<Trace> trace_gurad = scoped_refptr<Trace>(new Trace());
     Trace* trace = trace_gurad.get();
     TRACE_TO(trace, "got request. txn_ids=$0 base_version=$1 new_version=$2 #tablets=$3",
@@ -207,7 +210,8 @@ void LakeServiceImpl::publish_version(::google::protobuf::RpcController* control
 
             StatusOr<TabletMetadataPtr> res;
             if (std::chrono::system_clock::now() < timeout_deadline) {
-                res = lake::publish_version(_tablet_mgr, tablet_id, base_version, new_version, txns);
+                res = lake::publish_version(_tablet_mgr, tablet_id, base_version, new_version, txns,
+                                            aggregate_publish);
             } else {
                 auto t = MilliSecondsSinceEpochFromTimePoint(timeout_deadline);
                 res = Status::TimedOut(fmt::format("reached deadline={}/timeout={}", t, timeout_ms));
@@ -217,6 +221,9 @@ void LakeServiceImpl::publish_version(::google::protobuf::RpcController* control
                 auto score = compaction_score(_tablet_mgr, metadata);
                 std::lock_guard l(response_mtx);
                 response->mutable_compaction_scores()->insert({tablet_id, score});
+                if (aggregate_publish && metadata->schema().keys_type() != PRIMARY_KEYS) {
+                    bundle_metadatas.emplace_back(std::move(metadata));
+                }
             } else {
                 g_publish_version_failed_tasks << 1;
                 if (res.status().is_resource_busy()) {
@@ -247,6 +254,30 @@ void LakeServiceImpl::publish_version(::google::protobuf::RpcController* control
     }
 
     latch.wait();
+
+    if (!bundle_metadatas.empty()) {
+        // The bundle is written only if all the tablets were published, the retry overwrites the whole bundle.
+        bool bundle_written = false;
+        if (response->failed_tablets_size() == 0) {
+            auto st = _tablet_mgr->put_bundle_tablet_metadata(bundle_metadatas);
+            TRACE_TO(trace, "wrote bundle tablet metadata. #tablets=$0", bundle_metadatas.size());
+            if (st.ok()) {
+                bundle_written = true;
+            } else {
+                LOG(WARNING) << "Fail to put bundle tablet metadata: " << st << ". txn_ids="
+                             << JoinInts(request->txn_ids(), ",") << " version=" << request->new_version();
+                st.to_protobuf(response->mutable_status());
+            }
+        }
+        if (!bundle_written) {
+            for (const auto& metadata : bundle_metadatas) {
+                g_publish_version_failed_tasks << 1;
+                response->mutable_compaction_scores()->erase(metadata->id());
+                response->add_failed_tablets(metadata->id());
+            }
+        }
+    }
+
     auto cost = butil::gettimeofday_us() - start_ts;
     auto is_slow = cost >= config::lake_publish_version_slow_log_ms * 1000;
     if (config::lake_enable_publish_version_trace_log && is_slow) {
@@ -22,8 +22,10 @@
 #include "agent/heartbeat_server.h"
 #include "backend_service.h"
 #include "block_cache/block_cache.h"
+#include "block_cache/block_cache_warmer.h"
 #include "common/config.h"
 #include "common/daemon.h"
+#include "common/prof/cpu_sampler.h"
 #include "common/status.h"
 #include "exec/pipeline/query_context.h"
 #include "gutil/strings/join.h"
@@ -33,6 +35,7 @@
 #include "runtime/jdbc_driver_manager.h"
 #include "service/brpc.h"
 #include "service/service.h"
+#include "service/service_be/arrow_flight_service.h"
 #include "service/service_be/http_service.h"
 #include "service/service_be/internal_service.h"
 #include "service/service_be/lake_service.h"
@@ -131,6 +134,43 @@ Status init_datacache(GlobalEnv* global_env, const std::vector<StorePath>& stora
     return Status::OK();
 }
 
+// The access history is saved beside the datacache meta, or in the first disk cache directory.
+static std::string datacache_access_history_path() {
+    std::string dir = config::datacache_meta_path;
+    if (dir.empty()) {
+        std::string disk_path = config::datacache_disk_path;
+        dir = disk_path.substr(0, disk_path.find(';'));
+    }
+    return dir.empty() ? "" : dir + "/access_history";
+}
+
+static void start_datacache_warmup() {
+    if (config::datacache_warmup_history_capacity <= 0) {
+        return;
+    }
+    auto path = datacache_access_history_path();
+    auto* warmer = BlockCacheWarmer::instance();
+    if (auto st = warmer->load_history(path); !st.ok() && !st.is_not_found()) {
+        LOG(WARNING) << "Fail to load datacache access history: " << st;
+        warmer->clear_history();
+        return;
+    }
+    if (config::datacache_warmup_on_startup && warmer->history_size() > 0) {
+        auto st = warmer->start_warmup(config::datacache_warmup_top_k, config::datacache_warmup_rate_limit_bytes);
+        LOG_IF(WARNING, !st.ok()) << "Fail to start datacache warmup: " << st;
+    }
+}
+
+static void stop_datacache_warmup() {
+    auto* warmer = BlockCacheWarmer::instance();
+    warmer->stop_warmup();
+    auto path = datacache_access_history_path();
+    if (config::datacache_warmup_history_capacity > 0 && !path.empty()) {
+        auto st = warmer->save_history(path);
+        LOG_IF(WARNING, !st.ok()) << "Fail to save datacache access history: " << st;
+    }
+}
+
 StorageEngine* init_storage_engine(GlobalEnv* global_env, std::vector<StorePath> paths, bool as_cn) {
     // Init and open storage engine.
     EngineOptions options;
@@ -157,6 +197,11 @@ void start_be(const std::vector<StorePath>& paths, bool as_cn) {
     daemon->init(as_cn, paths);
     LOG(INFO) << process_name << " start step " << start_step++ << ": daemon threads start successfully";
 
+    if (config::cpu_sampler_frequency > 0) {
+        auto st = CpuSampler::getInstance().set_frequency(config::cpu_sampler_frequency);
+        LOG_IF(WARNING, !st.ok()) << "Fail to start the cpu sampler: " << st;
+    }
+
     // init jdbc driver manager
     EXIT_IF_ERROR(JDBCDriverManager::getInstance()->init(std::string(getenv("STARROCKS_HOME")) + "/lib/jdbc_drivers"));
     LOG(INFO) << process_name << " start step " << start_step++ << ": jdbc driver manager init successfully";
@@ -200,6 +245,7 @@ void start_be(const std::vector<StorePath>& paths, bool as_cn) {
     }
     if (config::datacache_enable) {
         LOG(INFO) << process_name << " start step " << start_step++ << ": datacache init successfully";
+        start_datacache_warmup();
     } else {
         LOG(INFO) << process_name << " starts by skipping the datacache initialization";
     }
@@ -278,6 +324,18 @@ void start_be(const std::vector<StorePath>& paths, bool as_cn) {
     }
     LOG(INFO) << process_name << " start step " << start_step++ << ": start http server successfully";
 
+    // Start Arrow Flight server
+    std::unique_ptr<ArrowFlightServiceBE> arrow_flight_server;
+    if (config::arrow_flight_port > 0) {
+        arrow_flight_server = std::make_unique<ArrowFlightServiceBE>(exec_env, config::arrow_flight_port);
+        if (auto status = arrow_flight_server->start(); !status.ok()) {
+            LOG(ERROR) << process_name << " arrow flight server did not start correctly, exiting: " << status.message();
+            shutdown_logging();
+            exit(1);
+        }
+        LOG(INFO) << process_name << " start step " << start_step++ << ": start arrow flight server successfully";
+    }
+
     // Start heartbeat server
     std::unique_ptr<ThriftServer> heartbeat_server;
     if (auto ret = create_heartbeat_server(exec_env, config::heartbeat_service_port,
@@ -312,6 +370,12 @@ void start_be(const std::vector<StorePath>& paths, bool as_cn) {
     heartbeat_server.reset();
     LOG(INFO) << process_name << " exit step " << exit_step++ << ": heartbeat server exit successfully";
 
+    if (arrow_flight_server != nullptr) {
+        arrow_flight_server->stop();
+        arrow_flight_server.reset();
+        LOG(INFO) << process_name << " exit step " << exit_step++ << ": arrow flight server exit successfully";
+    }
+
     http_server->stop();
     brpc_server->Stop(0);
     thrift_server->stop();
@@ -333,6 +397,7 @@ void start_be(const std::vector<StorePath>& paths, bool as_cn) {
 
 #if defined(WITH_STARCACHE)
     if (config::datacache_enable) {
+        stop_datacache_warmup();
         (void)BlockCache::instance()->shutdown();
         LOG(INFO) << process_name << " exit step " << exit_step++ << ": datacache shutdown successfully";
     }
@@ -20,6 +20,9 @@
 #include <vector>
 
 #include "column/column.h"
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 #ifdef __SSE2__
 #include <emmintrin.h>
 #elif defined(__ARM_NEON) && defined(__aarch64__)
@@ -226,4 +229,50 @@ inline uint64_t get_nibble_mask(uint8x16_t values) {
 
 #endif
 
+// Call `f(i)` for every index `i` that `data[i] == c` in ascending order.
+// The bytes are compared 64 at a time, which is much faster than comparing them one by one if `c` is sparse.
+template <typename F>
+inline void for_each_equal_byte(const char* data, size_t size, char c, F&& f) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i target = _mm256_set1_epi8(c);
+    for (; i + 64 <= size; i += 64) {
+        const auto* block = reinterpret_cast<const __m256i*>(data + i);
+        auto lo = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(block), target)));
+        auto hi = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(block + 1), target)));
+        uint64_t mask = lo | (static_cast<uint64_t>(hi) << 32u);
+        for (; mask != 0; mask &= mask - 1) {
+            f(i + __builtin_ctzll(mask));
+        }
+    }
+#elif defined(__SSE2__)
+    const __m128i target = _mm_set1_epi8(c);
+    for (; i + 64 <= size; i += 64) {
+        const auto* block = reinterpret_cast<const __m128i*>(data + i);
+        uint64_t mask = 0;
+        for (int k = 0; k < 4; ++k) {
+            auto bits = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(block + k), target)));
+            mask |= static_cast<uint64_t>(bits) << (16u * k);
+        }
+        for (; mask != 0; mask &= mask - 1) {
+            f(i + __builtin_ctzll(mask));
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t target = vdupq_n_u8(static_cast<uint8_t>(c));
+    for (; i + 16 <= size; i += 16) {
+        // every byte equal to `c` is a nibble 0xf of the mask
+        uint64_t mask = get_nibble_mask(vceqq_u8(vld1q_u8(reinterpret_cast<const uint8_t*>(data + i)), target));
+        for (; mask != 0; mask &= ~(0xfULL << (__builtin_ctzll(mask) & ~3u))) {
+            f(i + (__builtin_ctzll(mask) >> 2u));
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        if (data[i] == c) {
+            f(i);
+        }
+    }
+}
+
 } // namespace SIMD
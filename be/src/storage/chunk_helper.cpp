@@ -551,24 +551,45 @@ bool ChunkPipelineAccumulator::_check_json_schema_equallity(const Chunk* one, co
     return true;
 }
 
+void ChunkRowWidthEstimator::update(size_t num_rows, size_t bytes) {
+    if (num_rows == 0) {
+        return;
+    }
+    size_t row_bytes = std::max<size_t>(bytes / num_rows, 1);
+    size_t avg = _avg_row_bytes.load(std::memory_order_relaxed);
+    // An exponential moving average, the races of the updates only lose some samples.
+    _avg_row_bytes.store(avg == 0 ? row_bytes : (avg * 7 + row_bytes) / 8, std::memory_order_relaxed);
+}
+
+size_t ChunkRowWidthEstimator::rows_within(size_t max_rows, size_t target_bytes) const {
+    size_t avg = avg_row_bytes();
+    if (target_bytes == 0 || avg == 0) {
+        return max_rows;
+    }
+    return std::clamp(target_bytes / avg, std::min(kMinRows, max_rows), max_rows);
+}
+
 void ChunkPipelineAccumulator::push(const ChunkPtr& chunk) {
     chunk->check_or_die();
     DCHECK(_out_chunk == nullptr);
+    size_t chunk_bytes = chunk->bytes_usage();
+    _row_width.update(chunk->num_rows(), chunk_bytes);
+    size_t max_size = _row_width.rows_within(_max_size, _max_bytes);
     if (_in_chunk == nullptr) {
         _in_chunk = chunk;
-        _mem_usage = chunk->bytes_usage();
-    } else if (_in_chunk->num_rows() + chunk->num_rows() > _max_size ||
+        _mem_usage = chunk_bytes;
+    } else if (_in_chunk->num_rows() + chunk->num_rows() > max_size ||
                _in_chunk->owner_info() != chunk->owner_info() || _in_chunk->owner_info().is_last_chunk() ||
                !_check_json_schema_equallity(chunk.get(), _in_chunk.get())) {
         _out_chunk = std::move(_in_chunk);
         _in_chunk = chunk;
-        _mem_usage = chunk->bytes_usage();
+        _mem_usage = chunk_bytes;
     } else {
         _in_chunk->append(*chunk);
-        _mem_usage += chunk->bytes_usage();
+        _mem_usage += chunk_bytes;
     }
 
-    if (_out_chunk == nullptr && (_in_chunk->num_rows() >= _max_size * LOW_WATERMARK_ROWS_RATE ||
+    if (_out_chunk == nullptr && (_in_chunk->num_rows() >= max_size * LOW_WATERMARK_ROWS_RATE ||
                                   _mem_usage >= LOW_WATERMARK_BYTES || _in_chunk->owner_info().is_last_chunk())) {
         _out_chunk = std::move(_in_chunk);
         _mem_usage = 0;
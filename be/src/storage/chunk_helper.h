@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <queue>
 
@@ -116,10 +117,31 @@ private:
     size_t _accumulate_count = 0;
 };
 
+// Estimates the bytes of a row from the chunks seen, to size the chunks of wide rows by a budget of bytes instead of
+// rows, see config::pipeline_chunk_target_bytes. Thread-safe, the chunk sources of a scan operator share one.
+class ChunkRowWidthEstimator {
+public:
+    // Never shrinks a chunk below it, in case the estimate is off by a few huge rows.
+    static constexpr size_t kMinRows = 64;
+
+    void update(size_t num_rows, size_t bytes);
+    size_t avg_row_bytes() const { return _avg_row_bytes.load(std::memory_order_relaxed); }
+    // The number of rows of a chunk within |target_bytes|, in [min(kMinRows, max_rows), max_rows]. |max_rows| if
+    // |target_bytes| is 0 or nothing is seen yet.
+    size_t rows_within(size_t max_rows, size_t target_bytes) const;
+
+private:
+    std::atomic<size_t> _avg_row_bytes = 0;
+};
+
 class ChunkPipelineAccumulator {
 public:
     ChunkPipelineAccumulator() = default;
     void set_max_size(size_t max_size) { _max_size = max_size; }
+    // Outputs a chunk once its bytes reach |max_bytes|, so the chunks of wide rows have less than max_size rows.
+    // 0 disables it.
+    void set_max_bytes(size_t max_bytes) { _max_bytes = max_bytes; }
+    size_t avg_row_bytes() const { return _row_width.avg_row_bytes(); }
     void push(const ChunkPtr& chunk);
     ChunkPtr& pull();
     void finalize();
@@ -143,6 +165,8 @@ private:
     ChunkPtr _in_chunk = nullptr;
     ChunkPtr _out_chunk = nullptr;
     size_t _max_size = 4096;
+    size_t _max_bytes = 0;
+    ChunkRowWidthEstimator _row_width;
     // For bitmap columns, the cost of calculating mem_usage is relatively high,
     // so incremental calculation is used to avoid becoming a performance bottleneck.
     size_t _mem_usage = 0;
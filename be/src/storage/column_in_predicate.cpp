@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 #include "column/column.h"
 #include "column/column_helper.h"
@@ -28,6 +30,10 @@
 
 namespace starrocks {
 
+// The zone map of every page is checked with a binary search in the sorted values instead of
+// a scan of all the values if the IN list has more values than this.
+static constexpr size_t kMaxLinearZoneMapValues = 16;
+
 template <LogicalType field_type, typename ItemSet>
 class ColumnInPredicate : public ColumnPredicate {
     using ValueType = typename CppTypeTraits<field_type>::CppType;
@@ -35,7 +41,15 @@ class ColumnInPredicate : public ColumnPredicate {
 
 public:
     ColumnInPredicate(const TypeInfoPtr& type_info, ColumnId id, ItemSet values)
-            : ColumnPredicate(type_info, id), _values(std::move(values)) {}
+            : ColumnPredicate(type_info, id), _values(std::move(values)) {
+        if (_values.size() > kMaxLinearZoneMapValues) {
+            _sorted_values.assign(_values.begin(), _values.end());
+            const auto* type_info_ptr = this->type_info();
+            std::sort(_sorted_values.begin(), _sorted_values.end(), [&](const ValueType& lhs, const ValueType& rhs) {
+                return type_info_ptr->cmp(Datum(lhs), Datum(rhs)) < 0;
+            });
+        }
+    }
 
     ~ColumnInPredicate() override = default;
 
@@ -95,6 +109,12 @@ public:
         const auto& min = detail.min_or_null_value();
         const auto& max = detail.max_value();
         const auto type_info = this->type_info();
+        if (!_sorted_values.empty()) {
+            auto iter = std::lower_bound(
+                    _sorted_values.begin(), _sorted_values.end(), min,
+                    [&](const ValueType& v, const Datum& bound) { return type_info->cmp(Datum(v), bound) < 0; });
+            return iter != _sorted_values.end() && type_info->cmp(Datum(*iter), max) <= 0;
+        }
         for (const ValueType& v : _values) {
             if (type_info->cmp(Datum(v), min) >= 0 && type_info->cmp(Datum(v), max) <= 0) {
                 return true;
@@ -191,6 +211,7 @@ public:
 
 private:
     ItemSet _values;
+    std::vector<ValueType> _sorted_values;
 };
 
 // Template specialization for binary column
@@ -202,6 +223,13 @@ public:
         for (const std::string& s : _zero_padded_strs) {
             _slices.emplace(Slice(s));
         }
+        if (_slices.size() > kMaxLinearZoneMapValues) {
+            _sorted_slices.assign(_slices.begin(), _slices.end());
+            const auto* type_info_ptr = this->type_info();
+            std::sort(_sorted_slices.begin(), _sorted_slices.end(), [&](const Slice& lhs, const Slice& rhs) {
+                return type_info_ptr->cmp(Datum(lhs), Datum(rhs)) < 0;
+            });
+        }
     }
 
     ~BinaryColumnInPredicate() override = default;
@@ -279,6 +307,12 @@ public:
         const auto& min = detail.min_or_null_value();
         const auto& max = detail.max_value();
         const auto type_info = this->type_info();
+        if (!_sorted_slices.empty()) {
+            auto iter = std::lower_bound(
+                    _sorted_slices.begin(), _sorted_slices.end(), min,
+                    [&](const Slice& v, const Datum& bound) { return type_info->cmp(Datum(v), bound) < 0; });
+            return iter != _sorted_slices.end() && type_info->cmp(Datum(*iter), max) <= 0;
+        }
         for (const Slice& v : _slices) {
             if (type_info->cmp(Datum(v), min) >= 0 && type_info->cmp(Datum(v), max) <= 0) {
                 return true;
@@ -366,6 +400,7 @@ public:
 private:
     std::vector<std::string> _zero_padded_strs;
     ItemHashSet<Slice> _slices;
+    std::vector<Slice> _sorted_slices;
 };
 
 class DictionaryCodeInPredicate : public ColumnPredicate {
@@ -581,9 +616,41 @@ ColumnPredicate* new_column_in_predicate_small(const TypeInfoPtr& type_info, Col
     return nullptr;
 }
 
+template <LogicalType field_type>
+ColumnPredicate* new_column_in_predicate_dense(const TypeInfoPtr& type_info, ColumnId id,
+                                               const std::vector<std::string>& strs) {
+    using CppType = typename CppTypeTraits<field_type>::CppType;
+    std::vector<CppType> values = predicate_internal::strings_to_set<field_type>(strs);
+    if (!DenseRangeSet<CppType>::is_dense(values)) {
+        return nullptr;
+    }
+    return new ColumnInPredicate<field_type, DenseRangeSet<CppType>>(type_info, id,
+                                                                     DenseRangeSet<CppType>(std::move(values)));
+}
+
+// Return nullptr if the values are not integers in a small range.
+ColumnPredicate* new_column_in_predicate_dense(const TypeInfoPtr& type_info, ColumnId id,
+                                               const std::vector<std::string>& strs) {
+    switch (type_info->type()) {
+    case TYPE_TINYINT:
+        return new_column_in_predicate_dense<TYPE_TINYINT>(type_info, id, strs);
+    case TYPE_SMALLINT:
+        return new_column_in_predicate_dense<TYPE_SMALLINT>(type_info, id, strs);
+    case TYPE_INT:
+        return new_column_in_predicate_dense<TYPE_INT>(type_info, id, strs);
+    case TYPE_BIGINT:
+        return new_column_in_predicate_dense<TYPE_BIGINT>(type_info, id, strs);
+    default:
+        return nullptr;
+    }
+}
+
 ColumnPredicate* new_column_in_predicate(const TypeInfoPtr& type_info, ColumnId id,
                                          const std::vector<std::string>& strs) {
     if (strs.size() > 3) {
+        if (auto* pred = new_column_in_predicate_dense(type_info, id, strs); pred != nullptr) {
+            return pred;
+        }
         return new_column_in_predicate_generic<ItemHashSet>(type_info, id, strs);
     } else {
         return new_column_in_predicate_small(type_info, id, strs);
@@ -152,6 +152,10 @@ public:
     // Return false to filter out a data page.
     virtual bool zone_map_filter(const ZoneMapDetail& detail) const { return true; }
 
+    // Return true if all the rows covered by the zone map satisfy this predicate,
+    // so that it's unnecessary to evaluate this predicate row by row.
+    virtual bool zone_map_always_true(const ZoneMapDetail& detail) const { return false; }
+
     virtual bool support_original_bloom_filter() const { return false; }
 
     // return true means this predicate can support ngram bloom filter, don't consider gram number(N)
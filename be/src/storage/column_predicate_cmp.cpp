@@ -263,6 +263,11 @@ public:
         return this->type_info()->cmp(Datum(this->_value), max) <= 0;
     }
 
+    bool zone_map_always_true(const ZoneMapDetail& detail) const override {
+        return !detail.has_null() && !detail.min_value().is_null() &&
+               this->type_info()->cmp(Datum(this->_value), detail.min_value()) <= 0;
+    }
+
     bool support_bitmap_filter() const override { return true; }
 
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
@@ -309,6 +314,11 @@ public:
         return this->type_info()->cmp(Datum(this->_value), max) < 0;
     }
 
+    bool zone_map_always_true(const ZoneMapDetail& detail) const override {
+        return !detail.has_null() && !detail.min_value().is_null() &&
+               this->type_info()->cmp(Datum(this->_value), detail.min_value()) < 0;
+    }
+
     bool support_bitmap_filter() const override { return true; }
 
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
@@ -356,6 +366,11 @@ public:
         return (this->type_info()->cmp(Datum(this->_value), min) >= 0) & !max.is_null();
     }
 
+    bool zone_map_always_true(const ZoneMapDetail& detail) const override {
+        return !detail.has_null() && !detail.max_value().is_null() &&
+               this->type_info()->cmp(Datum(this->_value), detail.max_value()) >= 0;
+    }
+
     bool support_bitmap_filter() const override { return true; }
 
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
@@ -403,6 +418,11 @@ public:
         return (this->type_info()->cmp(Datum(this->_value), min) > 0) & !max.is_null();
     }
 
+    bool zone_map_always_true(const ZoneMapDetail& detail) const override {
+        return !detail.has_null() && !detail.max_value().is_null() &&
+               this->type_info()->cmp(Datum(this->_value), detail.max_value()) > 0;
+    }
+
     bool support_bitmap_filter() const override { return true; }
 
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
@@ -451,6 +471,15 @@ public:
         return type_info->cmp(Datum(this->_value), min) >= 0 && type_info->cmp(Datum(this->_value), max) <= 0;
     }
 
+    bool zone_map_always_true(const ZoneMapDetail& detail) const override {
+        if (detail.has_null() || detail.min_value().is_null() || detail.max_value().is_null()) {
+            return false;
+        }
+        const auto type_info = this->type_info();
+        return type_info->cmp(Datum(this->_value), detail.min_value()) == 0 &&
+               type_info->cmp(Datum(this->_value), detail.max_value()) == 0;
+    }
+
     bool support_bitmap_filter() const override { return true; }
 
     Status seek_bitmap_dictionary(BitmapIndexIterator* iter, SparseRange<>* range) const override {
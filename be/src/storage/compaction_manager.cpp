@@ -14,10 +14,17 @@
 
 #include "storage/compaction_manager.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <thread>
 
+#include "exec/pipeline/pipeline_driver_executor.h"
+#include "exec/workgroup/pipeline_executor_set.h"
+#include "exec/workgroup/work_group.h"
+#include "runtime/exec_env.h"
 #include "storage/data_dir.h"
+#include "util/cpu_info.h"
 #include "util/starrocks_metrics.h"
 #include "util/thread.h"
 
@@ -344,7 +351,7 @@ void CompactionManager::update_tablet(const TabletSharedPtr& tablet) {
     if (tablet->need_compaction()) {
         CompactionCandidate candidate;
         candidate.tablet = tablet;
-        candidate.score = tablet->compaction_score();
+        candidate.score = candidate_score(tablet->compaction_score(), tablet->read_heat());
         candidate.type = tablet->compaction_type();
         update_candidates({candidate});
     }
@@ -569,6 +576,35 @@ Status CompactionManager::update_max_threads(int max_threads) {
     }
 }
 
+int32_t CompactionManager::effective_max_task_num() {
+    double queued_drivers_per_core = config::compaction_throttle_queued_drivers_per_core;
+    if (queued_drivers_per_core <= 0) {
+        return _max_task_num;
+    }
+    auto* workgroup_manager = ExecEnv::GetInstance()->workgroup_manager();
+    if (workgroup_manager == nullptr) {
+        return _max_task_num;
+    }
+    size_t num_queued_drivers = 0;
+    workgroup_manager->for_each_executors([&num_queued_drivers](auto& executors) {
+        if (executors.driver_executor() != nullptr) {
+            num_queued_drivers += executors.driver_executor()->num_queued_drivers();
+        }
+    });
+    if (num_queued_drivers <= queued_drivers_per_core * CpuInfo::num_cores()) {
+        return _max_task_num;
+    }
+    double ratio = std::clamp(config::compaction_busy_concurrency_ratio, 0.0, 1.0);
+    return std::min(_max_task_num, std::max(1, static_cast<int32_t>(_max_task_num * ratio)));
+}
+
+double CompactionManager::candidate_score(double compaction_score, double read_heat) {
+    if (config::compaction_read_heat_weight <= 0 || read_heat <= 0) {
+        return compaction_score;
+    }
+    return compaction_score * (1 + config::compaction_read_heat_weight * std::log2(1 + read_heat));
+}
+
 double CompactionManager::max_score() {
     std::lock_guard lg(_candidates_mutex);
     if (_compaction_candidates.empty()) {
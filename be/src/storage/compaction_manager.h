@@ -82,13 +82,14 @@ public:
             LOG_ONCE(WARNING) << "register compaction task failed for compaction is disabled";
             exceed = true;
         }
+        int32_t max_task_num = effective_max_task_num();
         std::lock_guard lg(_tasks_mutex);
         size_t running_tasks_num = 0;
         for (const auto& it : _running_tasks) {
             running_tasks_num += it.second.size();
         }
-        if (running_tasks_num >= _max_task_num) {
-            VLOG(2) << "register compaction task failed for running tasks reach max limit:" << _max_task_num;
+        if (running_tasks_num >= max_task_num) {
+            VLOG(2) << "register compaction task failed for running tasks reach max limit:" << max_task_num;
             exceed = true;
         }
         return exceed;
@@ -96,6 +97,12 @@ public:
 
     int32_t max_task_num() { return _max_task_num; }
 
+    // The max task num, lowered while the queries are queueing up for the pipeline worker threads.
+    int32_t effective_max_task_num();
+
+    // The priority of a tablet in the candidates, see compaction_read_heat_weight.
+    static double candidate_score(double compaction_score, double read_heat);
+
     uint16_t running_cumulative_tasks_num_for_dir(DataDir* data_dir) {
         std::lock_guard lg(_tasks_mutex);
         return _data_dir_to_cumulative_task_num_map[data_dir];
@@ -22,6 +22,7 @@
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/storage_engine.h"
+#include "storage/tablet_meta_manager.h"
 #include "util/scoped_cleanup.h"
 #include "util/starrocks_metrics.h"
 #include "util/time.h"
@@ -198,8 +199,34 @@ void CompactionTask::_failure_callback(const Status& st) {
     LOG(WARNING) << "compaction task:" << _task_info.task_id << ", tablet:" << _task_info.tablet_id << " failed.";
 }
 
+StatusOr<bool> CompactionTask::_can_link_rowsets(const std::vector<RowsetSharedPtr>& data_rowsets) {
+    if (!config::enable_compaction_link_rowsets || _tablet_schema->keys_type() != DUP_KEYS ||
+        !_tablet->enable_shortcut_compaction()) {
+        return false;
+    }
+    KVStore* kvstore = _tablet->data_dir()->get_meta();
+    for (const auto& rowset : data_rowsets) {
+        if (rowset->schema()->id() != _tablet_schema->id() || rowset->num_segments() == 0 ||
+            rowset->rowset_meta()->data_disk_size() / rowset->num_segments() <
+                    config::compaction_link_rowsets_min_segment_bytes) {
+            return false;
+        }
+        // The column files of partial updates belong to the segment ids of the input rowset.
+        for (int i = 0; i < rowset->num_segments(); i++) {
+            DeltaColumnGroupList dcgs;
+            RETURN_IF_ERROR(TabletMetaManager::scan_delta_column_group(kvstore, _tablet->tablet_id(),
+                                                                       rowset->rowset_id(), i, 0, INT64_MAX, &dcgs));
+            if (!dcgs.empty()) {
+                return false;
+            }
+        }
+    }
+    return CompactionUtils::is_rowsets_sorted_and_disjoint(data_rowsets, _tablet_schema);
+}
+
 Status CompactionTask::_shortcut_compact(Statistics* statistics) {
-    // if there is only one rowset has data, we can shortcut compact
+    // if there is only one rowset has data, or the data rowsets are in key order (see _can_link_rowsets),
+    // we can shortcut compact
     // shortcut compact means hard link old rowset to new rowset directly
     // no need to read and write data
     std::vector<RowsetSharedPtr> data_rowsets;
@@ -219,21 +246,30 @@ Status CompactionTask::_shortcut_compact(Statistics* statistics) {
     // the reason is after we support add/drop field for struct column, we need to make sure the rowset schema is
     // consistent with segment data because of some compatible issue. so we will skip shortcut compaction when we
     // found the scheam id is different.
+    bool shortcut = false;
     if (data_rowsets.size() == 1 && !data_rowsets.back()->rowset_meta()->is_segments_overlapping() &&
         _tablet->enable_shortcut_compaction() && data_rowsets[0]->schema()->id() == _tablet_schema->id()) {
+        shortcut = true;
+    } else if (data_rowsets.size() > 1) {
+        ASSIGN_OR_RETURN(shortcut, _can_link_rowsets(data_rowsets));
+    }
+    if (shortcut) {
         TRACE("[Compaction] start shortcut comapction data");
         int64_t max_rows_per_segment = CompactionUtils::get_segment_max_rows(
                 config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
 
+        // Only the horizontal rowset writer supports adding rowsets.
         std::unique_ptr<RowsetWriter> output_rs_writer;
         RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
-                _tablet.get(), max_rows_per_segment, _task_info.algorithm, _task_info.output_version,
+                _tablet.get(), max_rows_per_segment, HORIZONTAL_COMPACTION, _task_info.output_version,
                 data_rowsets.back()->rowset_meta()->gtid(), &output_rs_writer, _tablet_schema));
-        Status status = output_rs_writer->add_rowset(data_rowsets.back());
-        if (!status.ok()) {
-            LOG(WARNING) << "fail to compact rowset."
-                         << ", tablet=" << _tablet->full_name() << ", version=" << output_rs_writer->version();
-            return status;
+        for (const auto& rowset : data_rowsets) {
+            Status status = output_rs_writer->add_rowset(rowset);
+            if (!status.ok()) {
+                LOG(WARNING) << "fail to compact rowset."
+                             << ", tablet=" << _tablet->full_name() << ", version=" << output_rs_writer->version();
+                return status;
+            }
         }
         StatusOr<RowsetSharedPtr> build_res = output_rs_writer->build();
         if (!build_res.ok()) {
@@ -299,8 +299,14 @@ protected:
 
     void _failure_callback(const Status& st);
 
+    // Links the segments of the input rowsets to the output rowset instead of merging them if possible.
     Status _shortcut_compact(Statistics* statistics);
 
+    // Whether the segments of several data rowsets can be linked to the output rowset as they are, which skips
+    // decoding and encoding the data entirely. The rowsets must be non-overlapping duplicate key rowsets of the
+    // tablet schema, disjoint and ascending in key order, with segments large enough to be kept.
+    StatusOr<bool> _can_link_rowsets(const std::vector<RowsetSharedPtr>& data_rowsets);
+
 protected:
     CompactionTaskInfo _task_info;
     RuntimeProfile _runtime_profile;
@@ -14,14 +14,17 @@
 
 #include "storage/compaction_utils.h"
 
+#include "column/datum_convert.h"
 #include "common/config.h"
 #include "storage/row_source_mask.h"
+#include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
+#include "storage/types.h"
 
 namespace starrocks {
 
@@ -142,4 +145,62 @@ RowsetSharedPtr& CompactionUtils::rowset_with_max_schema_version(std::vector<Row
     });
 }
 
+StatusOr<bool> CompactionUtils::is_rowsets_sorted_and_disjoint(const std::vector<RowsetSharedPtr>& rowsets,
+                                                               const TabletSchemaCSPtr& tablet_schema) {
+    const auto& sort_key_idxes = tablet_schema->sort_key_idxes();
+    const TabletColumn& first_key = tablet_schema->column(sort_key_idxes.empty() ? 0 : sort_key_idxes[0]);
+    TypeInfoPtr type_info = get_type_info(delegate_type(first_key.type()));
+    // The datums of strings refer to the zone maps of the loaded segments.
+    Datum prev_max;
+    bool has_prev = false;
+    for (const auto& rowset : rowsets) {
+        if (rowset->rowset_meta()->is_segments_overlapping()) {
+            return false;
+        }
+        RETURN_IF_ERROR(rowset->load());
+        Datum min;
+        Datum max;
+        bool has_null = false;
+        bool has_not_null = false;
+        for (const auto& segment : rowset->segments()) {
+            if (segment->num_rows() == 0) {
+                continue;
+            }
+            const ColumnReader* reader = segment->column_with_uid(first_key.unique_id());
+            if (reader == nullptr || reader->segment_zone_map() == nullptr) {
+                return false;
+            }
+            const ZoneMapPB& zone_map = *reader->segment_zone_map();
+            has_null |= zone_map.has_null();
+            if (!zone_map.has_not_null()) {
+                continue;
+            }
+            Datum segment_min;
+            Datum segment_max;
+            RETURN_IF_ERROR(datum_from_string(type_info.get(), &segment_min, zone_map.min(), nullptr));
+            RETURN_IF_ERROR(datum_from_string(type_info.get(), &segment_max, zone_map.max(), nullptr));
+            if (!has_not_null || type_info->cmp(segment_min, min) < 0) {
+                min = segment_min;
+            }
+            if (!has_not_null || type_info->cmp(segment_max, max) > 0) {
+                max = segment_max;
+            }
+            has_not_null = true;
+        }
+        if (!has_not_null) {
+            // Nulls sort first, so a rowset of only nulls can only be the first one.
+            if (has_prev || !has_null) {
+                return false;
+            }
+            continue;
+        }
+        if (has_prev && (has_null || type_info->cmp(prev_max, min) >= 0)) {
+            return false;
+        }
+        prev_max = max;
+        has_prev = true;
+    }
+    return true;
+}
+
 } // namespace starrocks
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "common/status.h"
+#include "common/statusor.h"
 #include "storage/olap_common.h"
 #include "tablet_schema.h"
 
@@ -70,6 +71,12 @@ public:
                                                            size_t source_num);
 
     static RowsetSharedPtr& rowset_with_max_schema_version(std::vector<RowsetSharedPtr>& rowsets);
+
+    // Whether |rowsets| are non-overlapping and their key ranges are disjoint and ascending in the given order, so
+    // their segments concatenated form a non-overlapping rowset. Only the first sort key column is compared, by the
+    // segment zone maps, so false may be returned for rowsets that are in order.
+    static StatusOr<bool> is_rowsets_sorted_and_disjoint(const std::vector<RowsetSharedPtr>& rowsets,
+                                                         const TabletSchemaCSPtr& tablet_schema);
 };
 
 } // namespace starrocks
@@ -35,6 +35,7 @@
 #include "storage/data_dir.h"
 
 #include <filesystem>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <utility>
@@ -59,6 +60,7 @@
 #include "util/errno.h"
 #include "util/monotime.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 
 using strings::Substitute;
 
@@ -66,6 +68,107 @@ namespace starrocks {
 
 static const char* const kTestFilePath = "/.testfile";
 
+namespace {
+
+// Loads the tablets of the metas walked from the meta store in batches by a thread pool, since parsing the metas
+// and creating the tablets dominate the startup of a BE with many tablets. The metas of the same tablet id, e.g.
+// of different schema hashes, are loaded by the same thread in the order of the walk.
+class TabletMetaBatchLoader {
+public:
+    using LoadFunc = std::function<void(int64_t tablet_id, int32_t schema_hash, std::string_view value)>;
+
+    TabletMetaBatchLoader(std::string path, LoadFunc load_func, int num_threads)
+            : _path(std::move(path)), _load_func(std::move(load_func)), _num_threads(std::max(num_threads, 1)) {
+        if (_num_threads > 1) {
+            Status st = ThreadPoolBuilder("load_tablet_meta")
+                                .set_min_threads(_num_threads)
+                                .set_max_threads(_num_threads)
+                                .build(&_pool);
+            if (!st.ok()) {
+                LOG(WARNING) << "build thread pool of loading tablet metas failed, load them serially: " << st;
+                _num_threads = 1;
+            }
+        }
+    }
+
+    ~TabletMetaBatchLoader() {
+        if (_pool != nullptr) {
+            _pool->shutdown();
+        }
+    }
+
+    bool add(int64_t tablet_id, int32_t schema_hash, std::string_view value) {
+        if (_num_threads == 1) {
+            _load_func(tablet_id, schema_hash, value);
+            _on_loaded(1);
+            return true;
+        }
+        _batch.push_back({tablet_id, schema_hash, std::string(value)});
+        if (_batch.size() >= kBatchSize) {
+            flush();
+        }
+        return true;
+    }
+
+    // Loads the metas added and waits for them.
+    void flush() {
+        if (_batch.empty()) {
+            return;
+        }
+        std::vector<std::vector<const Meta*>> partitions(_num_threads);
+        for (const auto& meta : _batch) {
+            partitions[meta.tablet_id % _num_threads].push_back(&meta);
+        }
+        for (auto& partition : partitions) {
+            if (partition.empty()) {
+                continue;
+            }
+            auto task = [this, partition = std::move(partition)] {
+                for (const auto* meta : partition) {
+                    _load_func(meta->tablet_id, meta->schema_hash, meta->value);
+                }
+            };
+            Status st = _pool->submit_func(task);
+            if (!st.ok()) {
+                task();
+            }
+        }
+        _pool->wait();
+        _on_loaded(_batch.size());
+        _batch.clear();
+    }
+
+private:
+    static constexpr size_t kBatchSize = 4096;
+    static constexpr int64_t kProgressLogIntervalMs = 10000;
+
+    struct Meta {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string value;
+    };
+
+    void _on_loaded(size_t num_metas) {
+        _num_loaded += num_metas;
+        int64_t now = MonotonicMillis();
+        if (now - _last_log_ms >= kProgressLogIntervalMs) {
+            LOG(INFO) << "loaded " << _num_loaded << " tablet metas of " << _path << " in " << now - _start_ms << "ms";
+            _last_log_ms = now;
+        }
+    }
+
+    const std::string _path;
+    const LoadFunc _load_func;
+    int _num_threads;
+    std::unique_ptr<ThreadPool> _pool;
+    std::vector<Meta> _batch;
+    size_t _num_loaded = 0;
+    const int64_t _start_ms = MonotonicMillis();
+    int64_t _last_log_ms = MonotonicMillis();
+};
+
+} // namespace
+
 DataDir::DataDir(const std::string& path, TStorageMedium::type storage_medium, TabletManager* tablet_manager,
                  TxnManager* txn_manager)
         : _path(path),
@@ -275,12 +378,14 @@ Status DataDir::load() {
     // create tablet from tablet meta and add it to tablet mgr
     int64_t load_tablet_start = MonotonicMillis();
     LOG(INFO) << "begin loading tablet from meta " << _path;
+    std::mutex tablet_ids_lock;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
+    auto load_tablet_func = [this, &tablet_ids_lock, &tablet_ids, &failed_tablet_ids](
+                                    int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status st =
                 _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_lock);
         if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
             // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
             // This may happen when the tablet was just deleted before the BE restarted,
@@ -294,10 +399,14 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
-        return true;
+    };
+    TabletMetaBatchLoader loader(_path, load_tablet_func, config::load_tablet_meta_threads_per_data_dir);
+    auto add_tablet_func = [&loader](int64_t tablet_id, int32_t schema_hash, std::string_view value) {
+        return loader.add(tablet_id, schema_hash, value);
     };
     Status load_tablet_status =
-            TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, config::load_tablet_timeout_seconds);
+            TabletMetaManager::walk_until_timeout(_kv_store, add_tablet_func, config::load_tablet_timeout_seconds);
+    loader.flush();
     if (load_tablet_status.is_time_out()) {
         LOG(WARNING) << "load tablets from rocksdb timeout, try to compact meta and retry. path: " << _path;
         Status s = _kv_store->compact();
@@ -315,7 +424,8 @@ Status DataDir::load() {
         LOG(WARNING) << "compact meta finished, retry load tablets from rocksdb. path: " << _path;
         tablet_ids.clear();
         failed_tablet_ids.clear();
-        load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+        load_tablet_status = TabletMetaManager::walk(_kv_store, add_tablet_func);
+        loader.flush();
     }
 
     if (failed_tablet_ids.size() != 0) {
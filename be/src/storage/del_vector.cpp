@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "gutil/strings/substitute.h"
+#include "storage/roaring2range.h"
 #include "util/raw_container.h"
 
 namespace starrocks {
@@ -31,6 +32,7 @@ void DelVector::set_empty() {
     _cardinality = 0;
     _memory_usage = 0;
     _roaring.reset();
+    _deleted_ranges = std::make_unique<DeletedRanges>();
 }
 
 void DelVector::_add_dels(const std::vector<uint32_t>& dels) {
@@ -102,11 +104,21 @@ void DelVector::save_to(std::string* str) const {
     }
 }
 
+const SparseRange<>& DelVector::deleted_ranges() const {
+    std::call_once(_deleted_ranges->once, [this] {
+        if (_roaring) {
+            _deleted_ranges->ranges = roaring2range(*_roaring);
+        }
+    });
+    return _deleted_ranges->ranges;
+}
+
 string DelVector::to_string() const {
     return strings::Substitute("version:$0 $1", _version, _roaring ? _roaring->toString() : string("null"));
 }
 
 void DelVector::_update_stats() {
+    _deleted_ranges = std::make_unique<DeletedRanges>();
     // TODO(cbl): optimization
     if (_roaring) {
         roaring::api::roaring_statistics_t st;
@@ -130,6 +142,7 @@ void DelVector::copy_from(const DelVector& delvec) {
     } else {
         _roaring.reset();
     }
+    _deleted_ranges = std::make_unique<DeletedRanges>();
 }
 
 } // namespace starrocks
@@ -14,10 +14,12 @@
 
 #pragma once
 
+#include <mutex>
 #include <roaring/roaring.hh>
 
 #include "common/status.h"
 #include "storage/olap_common.h"
+#include "storage/range.h"
 
 namespace starrocks {
 
@@ -61,6 +63,11 @@ public:
 
     Roaring* roaring() { return _roaring.get(); }
 
+    // The deleted rows as sorted ranges. They are built at the first call and kept with this version of the
+    // delvec, which is shared by the caches of delvecs, so that the scans of the segment subtract them from their
+    // scan ranges instead of converting every scanned row between bitmaps and ranges.
+    const SparseRange<>& deleted_ranges() const;
+
     void copy_from(const DelVector& delvec);
 
 private:
@@ -68,11 +75,18 @@ private:
 
     void _update_stats();
 
+    struct DeletedRanges {
+        std::once_flag once;
+        SparseRange<> ranges;
+    };
+
     bool _loaded = false;
     int64_t _version = 1;
     size_t _cardinality = 0;
     size_t _memory_usage = 0;
     std::unique_ptr<Roaring> _roaring;
+    // Reset whenever |_roaring| changes, which is before the delvec is shared.
+    std::unique_ptr<DeletedRanges> _deleted_ranges = std::make_unique<DeletedRanges>();
 };
 
 typedef std::shared_ptr<DelVector> DelVectorPtr;
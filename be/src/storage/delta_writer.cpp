@@ -144,6 +144,22 @@ bool DeltaWriter::is_partial_update_with_sort_key_conflict(const PartialUpdateMo
     return false;
 }
 
+PartialUpdateMode DeltaWriter::resolve_auto_partial_update_mode(size_t num_update_columns, size_t num_columns,
+                                                                size_t num_key_columns) {
+    const int32_t min_columns = config::auto_column_mode_partial_update_min_columns;
+    if (min_columns <= 0 || num_columns < static_cast<size_t>(min_columns) || num_columns <= num_key_columns ||
+        num_update_columns < num_key_columns) {
+        return PartialUpdateMode::ROW_MODE;
+    }
+    // only the value columns are rewritten, the key columns are written by both modes
+    double ratio = (double)(num_update_columns - num_key_columns) / (double)(num_columns - num_key_columns);
+    if (ratio > config::auto_column_mode_partial_update_max_ratio) {
+        return PartialUpdateMode::ROW_MODE;
+    }
+    // upsert keeps the semantics of row mode, which inserts the rows whose keys don't exist
+    return PartialUpdateMode::COLUMN_UPSERT_MODE;
+}
+
 Status DeltaWriter::_init() {
     SCOPED_THREAD_LOCAL_MEM_SETTER(_mem_tracker, false);
 
@@ -271,6 +287,21 @@ Status DeltaWriter::_init() {
             }
             writer_context.referenced_column_ids.push_back(index);
         }
+        auto sort_key_idxes = _tablet_schema->sort_key_idxes();
+        std::sort(sort_key_idxes.begin(), sort_key_idxes.end());
+        if (_opt.partial_update_mode == PartialUpdateMode::AUTO_MODE && _opt.merge_condition.empty() &&
+            !_opt.miss_auto_increment_column && !_tablet->is_column_with_row_store() &&
+            partial_cols_num == _opt.slots->size()) {
+            auto mode = resolve_auto_partial_update_mode(partial_cols_num, real_num_columns,
+                                                         _tablet_schema->num_key_columns());
+            if (mode != PartialUpdateMode::ROW_MODE &&
+                !is_partial_update_with_sort_key_conflict(mode, writer_context.referenced_column_ids, sort_key_idxes,
+                                                          _tablet_schema->num_key_columns())) {
+                VLOG(1) << "use column mode partial update for tablet " << _opt.tablet_id << " txn " << _opt.txn_id
+                        << ", update " << partial_cols_num << " of " << real_num_columns << " columns";
+                _opt.partial_update_mode = mode;
+            }
+        }
         if (_opt.partial_update_mode == PartialUpdateMode::ROW_MODE) {
             // no need to control memtable row when using column mode, because we don't need to fill missing column
             int64_t average_row_size = _tablet->updates()->get_average_row_size();
@@ -284,8 +315,6 @@ Status DeltaWriter::_init() {
                 _memtable_buffer_row = config::write_buffer_size / average_row_size;
             }
         }
-        auto sort_key_idxes = _tablet_schema->sort_key_idxes();
-        std::sort(sort_key_idxes.begin(), sort_key_idxes.end());
         if (is_partial_update_with_sort_key_conflict(_opt.partial_update_mode, writer_context.referenced_column_ids,
                                                      sort_key_idxes, _tablet_schema->num_key_columns())) {
             _partial_schema_with_sort_key_conflict = true;
@@ -667,6 +696,12 @@ void DeltaWriter::_reset_mem_table() {
                                                 _mem_table_sink.get(), "", _mem_tracker);
     }
     _mem_table->set_write_buffer_row(_memtable_buffer_row);
+    if (config::memtable_recycle_chunk_max_bytes > 0) {
+        if (_chunk_recycler == nullptr) {
+            _chunk_recycler = std::make_shared<MemTableChunkRecycler>(_mem_tracker);
+        }
+        _mem_table->set_chunk_recycler(_chunk_recycler);
+    }
     _write_buffer_size = _mem_table->write_buffer_size();
 }
 
@@ -37,6 +37,7 @@ class SlotDescriptor;
 
 class MemTable;
 class MemTableSink;
+class MemTableChunkRecycler;
 
 enum ReplicaState {
     // peer storage engine
@@ -172,6 +173,13 @@ public:
                                                          const std::vector<ColumnId>& sort_key_idxes,
                                                          size_t num_key_columns);
 
+    // Choose the partial update mode of a load in AUTO_MODE. The column mode writes only the updated columns as
+    // delta column groups instead of rewriting whole rows, which is much cheaper when a few columns of a wide
+    // table are updated. See `auto_column_mode_partial_update_min_columns` and
+    // `auto_column_mode_partial_update_max_ratio`.
+    static PartialUpdateMode resolve_auto_partial_update_mode(size_t num_update_columns, size_t num_columns,
+                                                              size_t num_key_columns);
+
 private:
     DeltaWriter(DeltaWriterOptions opt, MemTracker* parent, StorageEngine* storage_engine);
 
@@ -207,6 +215,8 @@ private:
     Schema _vectorized_schema;
     std::unique_ptr<MemTable> _mem_table;
     std::unique_ptr<MemTableSink> _mem_table_sink;
+    // The column buffers of the flushed memtables reused by the next one.
+    std::shared_ptr<MemTableChunkRecycler> _chunk_recycler;
     // tablet schema owned by delta writer, all write will use this tablet schema
     // it's build from unsafe_tablet_schema_ref（stored when create tablet） and OlapTableSchema
     // every request will have it's own tablet schema so simple schema change can work
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 #include "column/hash_set.h"
 #include "runtime/decimalv3.h"
 #include "storage/type_traits.h"
@@ -65,6 +69,66 @@ struct ArraySet : public std::array<T, N> {
     }
 };
 
+// Set of the integers looked up in an array indexed by the value minus the min value,
+// for the long IN lists whose values are in a small range, e.g. the ids generated in a batch.
+template <typename T>
+struct DenseRangeSet {
+    static_assert(std::is_integral_v<T>);
+    using value_type = T;
+
+    // Same as VectorizedInConstPredicate.
+    static constexpr uint64_t kMaxRange = 1 << 20;
+    static constexpr uint64_t kMinRange = 4096;
+    static constexpr uint64_t kMaxStride = 8;
+
+    DenseRangeSet() = default;
+
+    // `values` must be dense, see is_dense.
+    explicit DenseRangeSet(std::vector<T> values) : _values(std::move(values)) {
+        std::sort(_values.begin(), _values.end());
+        _values.erase(std::unique(_values.begin(), _values.end()), _values.end());
+        if (_values.empty()) {
+            return;
+        }
+        _min = _values.front();
+        _present.assign(_offset(_values.back()) + 1, 0);
+        for (const T& v : _values) {
+            _present[_offset(v)] = 1;
+        }
+    }
+
+    static bool is_dense(const std::vector<T>& values) {
+        if (values.empty()) {
+            return false;
+        }
+        auto [min_it, max_it] = std::minmax_element(values.begin(), values.end());
+        const uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(*max_it)) -
+                               static_cast<uint64_t>(static_cast<int64_t>(*min_it)) + 1;
+        // range is 0 if all the bigint values are in the set.
+        return range != 0 && range <= std::min(kMaxRange, std::max(kMinRange, values.size() * kMaxStride));
+    }
+
+    bool contains(const T& v) const noexcept {
+        // The unsigned offset of the values less than _min is out of the array as well.
+        const uint64_t offset = _offset(v);
+        return offset < _present.size() && _present[offset];
+    }
+
+    size_t size() const { return _values.size(); }
+    auto begin() const { return _values.begin(); }
+    auto end() const { return _values.end(); }
+
+private:
+    uint64_t _offset(T v) const {
+        return static_cast<uint64_t>(static_cast<int64_t>(v)) - static_cast<uint64_t>(static_cast<int64_t>(_min));
+    }
+
+    T _min{};
+    std::vector<uint8_t> _present;
+    // Sorted distinct values.
+    std::vector<T> _values;
+};
+
 namespace predicate_internal {
 
 template <typename T>
@@ -101,6 +165,11 @@ private:
         }
     };
 
+    template <typename U>
+    struct convert_to_container<DenseRangeSet<U>> {
+        DenseRangeSet<U> operator()(const std::vector<T>& elems) { return DenseRangeSet<U>(elems); }
+    };
+
     template <size_t N>
     struct convert_to_container<ArraySet<T, N>> {
         ArraySet<T, N> operator()(const std::vector<T>& elems) {
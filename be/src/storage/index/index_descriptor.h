@@ -26,6 +26,8 @@ class IndexDescriptor {
 public:
     inline static const std::string mark_word = "TENANNEMPTYMARK";
     inline static const int64_t mark_word_len = 15;
+    // Marks the vector index whose building is deferred to the background, with the same length as mark_word.
+    inline static const std::string deferred_mark_word = "TENANNDEFERMARK";
 
     static StatusOr<std::string> get_index_file_path(const IndexType index_type, const std::string& rowset_dir,
                                                      const std::string& rowset_id, int segment_id, int64_t index_id) {
@@ -52,6 +54,12 @@ public:
         return fmt::format("{}/{}_{}_{}.{}", rowset_dir, rowset_id, segment_id, index_id, "vi");
     }
 
+    static std::string sorted_index_file_path(const std::string& rowset_dir, const std::string& rowset_id,
+                                              int32_t column_uid) {
+        // {rowset_dir}/{schema_hash}/{rowset_id}_{column_uid}.sidx
+        return fmt::format("{}/{}_{}.{}", rowset_dir, rowset_id, column_uid, "sidx");
+    }
+
     static const std::string get_temporary_null_bitmap_file_name() { return "null_bitmap"; }
 };
 
@@ -0,0 +1,334 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/index/inverted/builtin/builtin_inverted_reader.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+#include "fs/fs_util.h"
+#include "storage/index/inverted/builtin/builtin_inverted_util.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+#include "util/raw_container.h"
+
+namespace starrocks {
+
+// Matches |term| against |pattern|, where '*' matches any characters and '?' matches one UTF-8 character.
+static bool wildcard_match(std::string_view term, std::string_view pattern) {
+    auto next_char = [&](size_t pos) {
+        pos++;
+        while (pos < term.size() && (static_cast<uint8_t>(term[pos]) & 0xC0) == 0x80) {
+            pos++;
+        }
+        return pos;
+    };
+    size_t t = 0;
+    size_t p = 0;
+    size_t star_p = std::string_view::npos;
+    size_t star_t = 0;
+    while (t < term.size()) {
+        if (p < pattern.size() && pattern[p] == '?') {
+            t = next_char(t);
+            p++;
+        } else if (p < pattern.size() && pattern[p] == '*') {
+            star_p = p++;
+            star_t = t;
+        } else if (p < pattern.size() && pattern[p] == term[t]) {
+            t++;
+            p++;
+        } else if (star_p != std::string_view::npos) {
+            // Let the last '*' match one more character.
+            p = star_p + 1;
+            star_t = next_char(star_t);
+            t = star_t;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') {
+        p++;
+    }
+    return p == pattern.size();
+}
+
+Status BuiltinInvertedReader::create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                                     LogicalType field_type, std::unique_ptr<InvertedReader>* res) {
+    if (!is_string_type(field_type)) {
+        return Status::InvalidArgument(fmt::format("Not supported type {}", field_type));
+    }
+    InvertedIndexParserType parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(tablet_index->index_properties()));
+    *res = std::make_unique<BuiltinInvertedReader>(path, tablet_index->index_id(), parser_type);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::new_iterator(const std::shared_ptr<TabletIndex> index_meta,
+                                           InvertedIndexIterator** iterator) {
+    *iterator = new InvertedIndexIterator(index_meta, this);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_load() {
+    std::string file_path = _index_path + "/" + kBuiltinIndexFileName;
+    if (!index_exists(file_path)) {
+        LOG(WARNING) << "inverted index file: " << file_path << " not exist.";
+        return Status::NotFound(fmt::format("Not exists index_file {}", file_path));
+    }
+    ASSIGN_OR_RETURN(auto file, fs::new_random_access_file(file_path));
+    ASSIGN_OR_RETURN(auto file_size, file->get_size());
+    if (file_size < kBuiltinIndexFooterSize) {
+        return Status::Corruption(fmt::format("Bad inverted index file {}: file size {}", file_path, file_size));
+    }
+    uint8_t footer[kBuiltinIndexFooterSize];
+    RETURN_IF_ERROR(file->read_at_fully(file_size - kBuiltinIndexFooterSize, footer, kBuiltinIndexFooterSize));
+    uint64_t block_index_offset = decode_fixed64_le(footer);
+    uint32_t block_index_size = decode_fixed32_le(footer + 8);
+    _null_bitmap_offset = decode_fixed64_le(footer + 12);
+    _null_bitmap_size = decode_fixed32_le(footer + 20);
+    uint32_t version = decode_fixed32_le(footer + 28);
+    uint32_t magic = decode_fixed32_le(footer + 32);
+    if (magic != kBuiltinIndexMagic || version != kBuiltinIndexVersion) {
+        return Status::Corruption(
+                fmt::format("Bad inverted index file {}: magic {} version {}", file_path, magic, version));
+    }
+
+    std::string buf;
+    raw::stl_string_resize_uninitialized(&buf, block_index_size);
+    RETURN_IF_ERROR(file->read_at_fully(block_index_offset, buf.data(), block_index_size));
+    Slice input(buf);
+    uint32_t num_blocks = 0;
+    if (!get_varint32(&input, &num_blocks)) {
+        return Status::Corruption(fmt::format("Bad block index of inverted index file {}", file_path));
+    }
+    std::vector<TermBlock> blocks(num_blocks);
+    for (auto& block : blocks) {
+        Slice first_term;
+        if (!get_length_prefixed_slice(&input, &first_term) || !get_varint64(&input, &block.offset) ||
+            !get_varint32(&input, &block.size) || !get_varint64(&input, &block.posting_offset)) {
+            return Status::Corruption(fmt::format("Bad block index of inverted index file {}", file_path));
+        }
+        block.first_term = first_term.to_string();
+    }
+    _blocks = std::move(blocks);
+    _file = std::move(file);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_scan_terms(std::string_view from,
+                                          const std::function<ScanAction(std::string_view)>& visit,
+                                          roaring::Roaring* result) {
+    auto iter = std::upper_bound(_blocks.begin(), _blocks.end(), from,
+                                 [](std::string_view v, const TermBlock& block) { return v < block.first_term; });
+    size_t block_idx = iter == _blocks.begin() ? 0 : iter - _blocks.begin() - 1;
+
+    // The posting lists of the accepted terms, as the offset and size in the file.
+    std::vector<std::pair<uint64_t, uint32_t>> postings;
+    std::string buf;
+    std::string term;
+    bool stopped = false;
+    for (; !stopped && block_idx < _blocks.size(); block_idx++) {
+        const auto& block = _blocks[block_idx];
+        raw::stl_string_resize_uninitialized(&buf, block.size);
+        RETURN_IF_ERROR(_file->read_at_fully(block.offset, buf.data(), block.size));
+        Slice input(buf);
+        uint64_t posting_offset = block.posting_offset;
+        term.clear();
+        while (!input.empty()) {
+            uint32_t shared = 0;
+            uint32_t suffix_size = 0;
+            uint32_t posting_size = 0;
+            if (!get_varint32(&input, &shared) || !get_varint32(&input, &suffix_size) || shared > term.size() ||
+                input.size < suffix_size) {
+                return Status::Corruption(fmt::format("Bad term block of inverted index {}", _index_path));
+            }
+            term.resize(shared);
+            term.append(input.data, suffix_size);
+            input.remove_prefix(suffix_size);
+            if (!get_varint32(&input, &posting_size)) {
+                return Status::Corruption(fmt::format("Bad term block of inverted index {}", _index_path));
+            }
+            ScanAction action = visit(term);
+            if (action == ScanAction::STOP) {
+                stopped = true;
+                break;
+            }
+            if (action == ScanAction::ACCEPT) {
+                postings.emplace_back(posting_offset, posting_size);
+            }
+            posting_offset += posting_size;
+        }
+    }
+    if (postings.empty()) {
+        *result = roaring::Roaring();
+        return Status::OK();
+    }
+
+    std::vector<roaring::Roaring> bitmaps;
+    bitmaps.reserve(postings.size());
+    size_t i = 0;
+    while (i < postings.size()) {
+        // The posting lists of the adjacent terms are read at once.
+        size_t j = i + 1;
+        uint64_t end = postings[i].first + postings[i].second;
+        while (j < postings.size() && postings[j].first == end) {
+            end += postings[j].second;
+            j++;
+        }
+        raw::stl_string_resize_uninitialized(&buf, end - postings[i].first);
+        RETURN_IF_ERROR(_file->read_at_fully(postings[i].first, buf.data(), buf.size()));
+        const char* data = buf.data();
+        for (; i < j; i++) {
+            bitmaps.emplace_back(roaring::Roaring::readSafe(data, postings[i].second));
+            data += postings[i].second;
+        }
+    }
+    if (bitmaps.size() == 1) {
+        result->swap(bitmaps[0]);
+        return Status::OK();
+    }
+    std::vector<const roaring::Roaring*> inputs;
+    inputs.reserve(bitmaps.size());
+    for (const auto& bitmap : bitmaps) {
+        inputs.push_back(&bitmap);
+    }
+    *result = roaring::Roaring::fastunion(inputs.size(), inputs.data());
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_query_terms(std::string_view value, roaring::Roaring* result) {
+    std::vector<std::string> terms;
+    std::string term_buffer;
+    for_each_term(_parser_type, Slice(value.data(), value.size()), &term_buffer,
+                  [&](std::string_view term) { terms.emplace_back(term); });
+    std::sort(terms.begin(), terms.end());
+    terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+
+    std::vector<roaring::Roaring> postings(terms.size());
+    for (size_t i = 0; i < terms.size(); i++) {
+        std::string_view term = terms[i];
+        RETURN_IF_ERROR(_scan_terms(
+                term,
+                [term](std::string_view t) {
+                    int cmp = t.compare(term);
+                    return cmp < 0 ? ScanAction::SKIP : (cmp == 0 ? ScanAction::ACCEPT : ScanAction::STOP);
+                },
+                &postings[i]));
+        if (postings[i].isEmpty()) {
+            *result = roaring::Roaring();
+            return Status::OK();
+        }
+    }
+    if (postings.empty()) {
+        *result = roaring::Roaring();
+        return Status::OK();
+    }
+    // Intersect from the smallest posting list, which bounds the size of all the intermediate results.
+    std::sort(postings.begin(), postings.end(),
+              [](const auto& l, const auto& r) { return l.cardinality() < r.cardinality(); });
+    for (size_t i = 1; i < postings.size() && !postings[0].isEmpty(); i++) {
+        postings[0] &= postings[i];
+    }
+    result->swap(postings[0]);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::_query_wildcard(std::string_view value, roaring::Roaring* result) {
+    std::string pattern(value);
+    std::replace(pattern.begin(), pattern.end(), '%', '*');
+    if (_parser_type != InvertedIndexParserType::PARSER_NONE) {
+        // The terms of the tokenized index are lower cased.
+        for (auto& c : pattern) {
+            if (c >= 'A' && c <= 'Z') {
+                c = c - 'A' + 'a';
+            }
+        }
+    }
+    std::string_view prefix(pattern.data(), std::min(pattern.find_first_of("*?"), pattern.size()));
+    std::string_view pattern_view(pattern);
+    return _scan_terms(
+            prefix,
+            [prefix, pattern_view](std::string_view term) {
+                if (term < prefix) {
+                    return ScanAction::SKIP;
+                }
+                if (term.substr(0, prefix.size()) != prefix) {
+                    return ScanAction::STOP;
+                }
+                return wildcard_match(term, pattern_view) ? ScanAction::ACCEPT : ScanAction::SKIP;
+            },
+            result);
+}
+
+Status BuiltinInvertedReader::query(OlapReaderStatistics* stats, const std::string& column_name,
+                                    const void* query_value, InvertedIndexQueryType query_type,
+                                    roaring::Roaring* bit_map) {
+    RETURN_IF_ERROR(success_once(_load_once, [this]() { return _load(); }).status());
+    Slice search_value = strip_char_padding(*reinterpret_cast<const Slice*>(query_value));
+    std::string_view value(search_value.data, search_value.size);
+    VLOG(1) << "begin to query the builtin inverted index, column_name: " << column_name
+            << ", search_str: " << value;
+
+    roaring::Roaring result;
+    switch (query_type) {
+    case InvertedIndexQueryType::MATCH_ALL_QUERY:
+    case InvertedIndexQueryType::EQUAL_QUERY:
+        RETURN_IF_ERROR(_query_terms(value, &result));
+        break;
+    case InvertedIndexQueryType::LESS_THAN_QUERY:
+        RETURN_IF_ERROR(_scan_terms(
+                "", [value](std::string_view t) { return t < value ? ScanAction::ACCEPT : ScanAction::STOP; },
+                &result));
+        break;
+    case InvertedIndexQueryType::LESS_EQUAL_QUERY:
+        RETURN_IF_ERROR(_scan_terms(
+                "", [value](std::string_view t) { return t <= value ? ScanAction::ACCEPT : ScanAction::STOP; },
+                &result));
+        break;
+    case InvertedIndexQueryType::GREATER_THAN_QUERY:
+        RETURN_IF_ERROR(_scan_terms(
+                value, [value](std::string_view t) { return t > value ? ScanAction::ACCEPT : ScanAction::SKIP; },
+                &result));
+        break;
+    case InvertedIndexQueryType::GREATER_EQUAL_QUERY:
+        RETURN_IF_ERROR(_scan_terms(
+                value, [value](std::string_view t) { return t >= value ? ScanAction::ACCEPT : ScanAction::SKIP; },
+                &result));
+        break;
+    case InvertedIndexQueryType::MATCH_WILDCARD_QUERY:
+        RETURN_IF_ERROR(_query_wildcard(value, &result));
+        break;
+    case InvertedIndexQueryType::MATCH_PHRASE_QUERY:
+        // The positions of the terms are not indexed.
+        return Status::NotSupported("Phrase query is not supported by the builtin inverted index");
+    default:
+        return Status::InvalidArgument("Unknown query type");
+    }
+    bit_map->swap(result);
+    return Status::OK();
+}
+
+Status BuiltinInvertedReader::query_null(OlapReaderStatistics* stats, const std::string& column_name,
+                                         roaring::Roaring* bit_map) {
+    RETURN_IF_ERROR(success_once(_load_once, [this]() { return _load(); }).status());
+    std::string buf;
+    raw::stl_string_resize_uninitialized(&buf, _null_bitmap_size);
+    RETURN_IF_ERROR(_file->read_at_fully(_null_bitmap_offset, buf.data(), _null_bitmap_size));
+    roaring::Roaring null_bitmap = roaring::Roaring::readSafe(buf.data(), buf.size());
+    bit_map->swap(null_bitmap);
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,79 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include "fs/fs.h"
+#include "storage/index/inverted/inverted_reader.h"
+#include "util/once.h"
+
+namespace starrocks {
+
+// Reads the index written by BuiltinInvertedWriter. The block index is loaded on the first query and shared
+// by the following ones, the term blocks and posting lists are read on demand.
+//
+// A query of several terms intersects their posting lists, and a query of a term range or a wildcard unions
+// the posting lists of the matched terms, both on roaring bitmaps whose container operations are vectorized.
+class BuiltinInvertedReader : public InvertedReader {
+public:
+    BuiltinInvertedReader(std::string path, uint32_t index_id, InvertedIndexParserType parser_type)
+            : InvertedReader(std::move(path), index_id), _parser_type(parser_type) {}
+
+    static Status create(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                         LogicalType field_type, std::unique_ptr<InvertedReader>* res);
+
+    Status new_iterator(const std::shared_ptr<TabletIndex> index_meta, InvertedIndexIterator** iterator) override;
+
+    Status query(OlapReaderStatistics* stats, const std::string& column_name, const void* query_value,
+                 InvertedIndexQueryType query_type, roaring::Roaring* bit_map) override;
+
+    Status query_null(OlapReaderStatistics* stats, const std::string& column_name, roaring::Roaring* bit_map) override;
+
+    InvertedIndexReaderType get_inverted_index_reader_type() override { return InvertedIndexReaderType::TEXT; }
+
+private:
+    struct TermBlock {
+        std::string first_term;
+        uint64_t offset;
+        uint32_t size;
+        uint64_t posting_offset;
+    };
+
+    enum class ScanAction { SKIP, ACCEPT, STOP };
+
+    Status _load();
+
+    // Scans the terms from the block that may contain |from| on, and unions the posting lists of the terms
+    // accepted by |visit| into |result|, until it returns STOP.
+    Status _scan_terms(std::string_view from, const std::function<ScanAction(std::string_view)>& visit,
+                       roaring::Roaring* result);
+
+    Status _query_terms(std::string_view value, roaring::Roaring* result);
+
+    Status _query_wildcard(std::string_view pattern, roaring::Roaring* result);
+
+    InvertedIndexParserType _parser_type;
+
+    OnceFlag _load_once;
+    std::unique_ptr<RandomAccessFile> _file;
+    std::vector<TermBlock> _blocks;
+    uint64_t _null_bitmap_offset = 0;
+    uint32_t _null_bitmap_size = 0;
+};
+
+} // namespace starrocks
@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "storage/index/inverted/inverted_index_common.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+// The builtin implementation keeps the whole index of a segment in one file in the index directory:
+//
+//   posting lists | term blocks | block index | null bitmap | footer
+//
+// - posting lists: the row ids of every term as a portable roaring bitmap, in the order of the terms.
+// - term blocks:   the sorted terms, front coded in blocks of kBuiltinTermsPerBlock terms. Each entry is
+//                  varint32 shared prefix length, varint32 suffix length, suffix, varint32 posting list size.
+//                  The posting lists of a block follow each other, starting from the offset in the block index.
+// - block index:   varint32 number of blocks, and for each block its length prefixed first term, varint64 offset,
+//                  varint32 size and varint64 offset of its first posting list. It is the only part held in
+//                  memory by the reader, a term is looked up by a binary search on it and a scan of one block.
+// - null bitmap:   portable roaring bitmap of the null rows.
+// - footer:        fixed64 block index offset, fixed32 block index size, fixed64 null bitmap offset,
+//                  fixed32 null bitmap size, fixed32 number of terms, fixed32 version, fixed32 magic.
+inline const std::string kBuiltinIndexFileName = "builtin_inverted.bii";
+inline constexpr uint32_t kBuiltinIndexMagic = 0x42494958; // "BIIX"
+inline constexpr uint32_t kBuiltinIndexVersion = 1;
+inline constexpr size_t kBuiltinIndexFooterSize = 36;
+inline constexpr size_t kBuiltinTermsPerBlock = 64;
+
+// The values of CHAR columns are padded with zeros.
+inline Slice strip_char_padding(const Slice& value) {
+    return {value.data, strnlen(value.data, value.size)};
+}
+
+// Splits |value| into the terms to index or to search, and calls |fn| with each of them.
+// PARSER_NONE keeps the whole value as one term. The other parsers split the value on the ASCII characters
+// other than letters and digits and lower case the ASCII letters, the multi-byte UTF-8 characters are kept
+// in the terms. |buffer| holds the lower cased term passed to |fn|.
+template <typename Fn>
+inline void for_each_term(InvertedIndexParserType parser_type, const Slice& value, std::string* buffer, Fn&& fn) {
+    if (parser_type == InvertedIndexParserType::PARSER_NONE) {
+        fn(std::string_view(value.data, value.size));
+        return;
+    }
+    auto is_term_char = [](uint8_t c) {
+        return c >= 0x80 || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    };
+    const auto* data = reinterpret_cast<const uint8_t*>(value.data);
+    size_t i = 0;
+    while (i < value.size) {
+        while (i < value.size && !is_term_char(data[i])) {
+            i++;
+        }
+        if (i == value.size) {
+            break;
+        }
+        buffer->clear();
+        for (; i < value.size && is_term_char(data[i]); i++) {
+            uint8_t c = data[i];
+            buffer->push_back(static_cast<char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c));
+        }
+        fn(std::string_view(*buffer));
+    }
+}
+
+} // namespace starrocks
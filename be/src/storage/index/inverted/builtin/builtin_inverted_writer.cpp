@@ -0,0 +1,159 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/index/inverted/builtin/builtin_inverted_writer.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "fs/fs_util.h"
+#include "gutil/strings/substitute.h"
+#include "storage/index/inverted/builtin/builtin_inverted_util.h"
+#include "storage/index/inverted/inverted_index_option.h"
+#include "types/logical_type.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+Status BuiltinInvertedWriter::create(const TypeInfoPtr& typeinfo, const std::string& directory,
+                                     TabletIndex* tablet_index, std::unique_ptr<InvertedWriter>* res) {
+    LogicalType type = typeinfo->type();
+    if (type != LogicalType::TYPE_CHAR && type != LogicalType::TYPE_VARCHAR) {
+        return Status::NotSupported(
+                strings::Substitute("Unsupported type for inverted index: $0", type_to_string_v2(type)));
+    }
+    auto parser_type = get_inverted_index_parser_type_from_string(
+            get_parser_string_from_properties(tablet_index->index_properties()));
+    if (parser_type != InvertedIndexParserType::PARSER_NONE &&
+        parser_type != InvertedIndexParserType::PARSER_STANDARD &&
+        parser_type != InvertedIndexParserType::PARSER_ENGLISH) {
+        return Status::NotSupported(strings::Substitute("Unsupported parser for builtin inverted index: $0",
+                                                        inverted_index_parser_type_to_string(parser_type)));
+    }
+    *res = std::make_unique<BuiltinInvertedWriter>(directory, parser_type);
+    return Status::OK();
+}
+
+Status BuiltinInvertedWriter::init() {
+    return fs::create_directories(_directory);
+}
+
+void BuiltinInvertedWriter::add_values(const void* values, size_t count) {
+    const auto* slices = reinterpret_cast<const Slice*>(values);
+    for (size_t i = 0; i < count; i++) {
+        for_each_term(_parser_type, strip_char_padding(slices[i]), &_term_buffer, [&](std::string_view term) {
+            auto iter = _postings.find(term);
+            if (iter == _postings.end()) {
+                iter = _postings.emplace(std::string(term), roaring::Roaring()).first;
+                _buffer_bytes += term.size() + sizeof(std::string) + sizeof(roaring::Roaring);
+            }
+            // The row ids are added in order, a row with repeated terms is added once.
+            iter->second.add(_rid);
+            _buffer_bytes += sizeof(uint16_t);
+        });
+        _rid++;
+    }
+}
+
+void BuiltinInvertedWriter::add_nulls(uint32_t count) {
+    _null_bitmap.addRange(_rid, _rid + count);
+    _rid += count;
+}
+
+Status BuiltinInvertedWriter::finish() {
+    std::vector<std::pair<std::string_view, roaring::Roaring*>> terms;
+    terms.reserve(_postings.size());
+    for (auto& [term, posting] : _postings) {
+        terms.emplace_back(term, &posting);
+    }
+    std::sort(terms.begin(), terms.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+
+    ASSIGN_OR_RETURN(auto file, fs::new_writable_file(_directory + "/" + kBuiltinIndexFileName));
+    uint64_t offset = 0;
+    faststring buf;
+    auto append_bitmap = [&](roaring::Roaring* bitmap) -> StatusOr<uint32_t> {
+        bitmap->runOptimize();
+        size_t size = bitmap->getSizeInBytes();
+        buf.resize(size);
+        bitmap->write(reinterpret_cast<char*>(buf.data()));
+        RETURN_IF_ERROR(file->append(Slice(buf.data(), size)));
+        offset += size;
+        return static_cast<uint32_t>(size);
+    };
+
+    std::vector<uint32_t> posting_sizes;
+    posting_sizes.reserve(terms.size());
+    for (auto& [term, posting] : terms) {
+        ASSIGN_OR_RETURN(auto size, append_bitmap(posting));
+        posting_sizes.push_back(size);
+    }
+
+    faststring block_index;
+    faststring block;
+    put_varint32(&block_index, (terms.size() + kBuiltinTermsPerBlock - 1) / kBuiltinTermsPerBlock);
+    uint64_t posting_offset = 0;
+    for (size_t start = 0; start < terms.size(); start += kBuiltinTermsPerBlock) {
+        size_t end = std::min(start + kBuiltinTermsPerBlock, terms.size());
+        put_length_prefixed_slice(&block_index, Slice(terms[start].first.data(), terms[start].first.size()));
+        put_varint64(&block_index, offset);
+
+        block.clear();
+        std::string_view prev;
+        uint64_t first_posting_offset = posting_offset;
+        for (size_t i = start; i < end; i++) {
+            std::string_view term = terms[i].first;
+            size_t shared = 0;
+            size_t max_shared = std::min(prev.size(), term.size());
+            while (shared < max_shared && prev[shared] == term[shared]) {
+                shared++;
+            }
+            put_varint32(&block, shared);
+            put_varint32(&block, term.size() - shared);
+            block.append(term.data() + shared, term.size() - shared);
+            put_varint32(&block, posting_sizes[i]);
+            posting_offset += posting_sizes[i];
+            prev = term;
+        }
+        put_varint32(&block_index, block.size());
+        put_varint64(&block_index, first_posting_offset);
+        RETURN_IF_ERROR(file->append(Slice(block.data(), block.size())));
+        offset += block.size();
+    }
+
+    uint64_t block_index_offset = offset;
+    RETURN_IF_ERROR(file->append(Slice(block_index.data(), block_index.size())));
+    offset += block_index.size();
+
+    uint64_t null_bitmap_offset = offset;
+    ASSIGN_OR_RETURN(auto null_bitmap_size, append_bitmap(&_null_bitmap));
+
+    faststring footer;
+    put_fixed64_le(&footer, block_index_offset);
+    put_fixed32_le(&footer, block_index.size());
+    put_fixed64_le(&footer, null_bitmap_offset);
+    put_fixed32_le(&footer, null_bitmap_size);
+    put_fixed32_le(&footer, terms.size());
+    put_fixed32_le(&footer, kBuiltinIndexVersion);
+    put_fixed32_le(&footer, kBuiltinIndexMagic);
+    DCHECK_EQ(kBuiltinIndexFooterSize, footer.size());
+    RETURN_IF_ERROR(file->append(Slice(footer.data(), footer.size())));
+    RETURN_IF_ERROR(file->close());
+
+    _postings.clear();
+    _buffer_bytes = 0;
+    return Status::OK();
+}
+
+} // namespace starrocks
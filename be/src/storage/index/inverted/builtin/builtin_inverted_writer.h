@@ -0,0 +1,64 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <roaring/roaring.hh>
+#include <string>
+
+#include "storage/index/inverted/inverted_index_common.h"
+#include "storage/index/inverted/inverted_writer.h"
+#include "storage/rowset/common.h"
+#include "storage/tablet_schema.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+// Builds the posting list of every term of a segment in memory, and writes them in the format described in
+// builtin_inverted_util.h when finished.
+class BuiltinInvertedWriter : public InvertedWriter {
+public:
+    BuiltinInvertedWriter(std::string directory, InvertedIndexParserType parser_type)
+            : _directory(std::move(directory)), _parser_type(parser_type) {}
+
+    ~BuiltinInvertedWriter() override = default;
+
+    static Status create(const TypeInfoPtr& typeinfo, const std::string& directory, TabletIndex* tablet_index,
+                         std::unique_ptr<InvertedWriter>* res);
+
+    Status init() override;
+
+    void add_values(const void* values, size_t count) override;
+
+    void add_nulls(uint32_t count) override;
+
+    Status finish() override;
+
+    uint64_t size() const override { return _rid; }
+
+    uint64_t estimate_buffer_size() const override { return _buffer_bytes; }
+
+    uint64_t total_mem_footprint() const override { return _buffer_bytes; }
+
+private:
+    std::string _directory;
+    InvertedIndexParserType _parser_type;
+    rowid_t _rid = 0;
+    phmap::flat_hash_map<std::string, roaring::Roaring> _postings;
+    roaring::Roaring _null_bitmap;
+    std::string _term_buffer;
+    uint64_t _buffer_bytes = 0;
+};
+
+} // namespace starrocks
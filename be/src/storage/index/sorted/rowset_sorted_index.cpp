@@ -0,0 +1,419 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/index/sorted/rowset_sorted_index.h"
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
+#include "fs/fs_util.h"
+#include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
+#include "storage/index/index_descriptor.h"
+#include "storage/key_coder.h"
+#include "storage/olap_common.h"
+#include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/roaring2range.h"
+#include "storage/rowset/column_iterator.h"
+#include "storage/rowset/segment.h"
+#include "storage/sstable/filter_policy.h"
+#include "storage/sstable/iterator.h"
+#include "storage/sstable/options.h"
+#include "storage/sstable/table.h"
+#include "storage/sstable/table_builder.h"
+#include "util/coding.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+namespace {
+
+const sstable::FilterPolicy* bloom_filter_policy() {
+    static const sstable::FilterPolicy* policy = sstable::NewBloomFilterPolicy(10);
+    return policy;
+}
+
+// The values of a column selected by the predicates on it, either the set of |values| within the bounds, or all
+// the values within the bounds if |values| is not set. Each value is in the memcomparable encoding of the index.
+struct ValueBounds {
+    std::optional<std::vector<std::string>> values;
+    std::optional<std::string> lower;
+    bool lower_inclusive = true;
+    std::optional<std::string> upper;
+    bool upper_inclusive = true;
+
+    bool is_unbounded() const { return !values.has_value() && !lower.has_value() && !upper.has_value(); }
+
+    bool above_lower(const Slice& key) const {
+        if (!lower.has_value()) {
+            return true;
+        }
+        int cmp = key.compare(Slice(lower.value()));
+        return cmp > 0 || (cmp == 0 && lower_inclusive);
+    }
+
+    bool below_upper(const Slice& key) const {
+        if (!upper.has_value()) {
+            return true;
+        }
+        int cmp = key.compare(Slice(upper.value()));
+        return cmp < 0 || (cmp == 0 && upper_inclusive);
+    }
+
+    void add_values(std::vector<std::string>&& new_values) {
+        std::sort(new_values.begin(), new_values.end());
+        new_values.erase(std::unique(new_values.begin(), new_values.end()), new_values.end());
+        if (!values.has_value()) {
+            values = std::move(new_values);
+            return;
+        }
+        std::vector<std::string> intersection;
+        std::set_intersection(values->begin(), values->end(), new_values.begin(), new_values.end(),
+                              std::back_inserter(intersection));
+        values = std::move(intersection);
+    }
+
+    void add_lower(std::string&& key, bool inclusive) {
+        if (!lower.has_value() || key > lower.value() || (key == lower.value() && !inclusive)) {
+            lower = std::move(key);
+            lower_inclusive = inclusive;
+        }
+    }
+
+    void add_upper(std::string&& key, bool inclusive) {
+        if (!upper.has_value() || key < upper.value() || (key == upper.value() && !inclusive)) {
+            upper = std::move(key);
+            upper_inclusive = inclusive;
+        }
+    }
+};
+
+// Only the predicates of the same type as the column are used, the others are evaluated by the scan as usual.
+ValueBounds parse_predicates(const PredicateColumnNodes& col_nodes, LogicalType type, const KeyCoder* key_coder) {
+    auto encode = [key_coder](const Datum& value) {
+        std::string key;
+        key_coder->full_encode_ascending(value, &key);
+        return key;
+    };
+
+    ValueBounds bounds;
+    for (const auto& col_node : col_nodes) {
+        const auto* col_pred = col_node.col_pred();
+        if (col_pred->type_info()->type() != type) {
+            continue;
+        }
+        switch (col_pred->type()) {
+        case PredicateType::kEQ: {
+            Datum value = col_pred->value();
+            if (!value.is_null()) {
+                bounds.add_values({encode(value)});
+            }
+            break;
+        }
+        case PredicateType::kInList: {
+            std::vector<Datum> values = col_pred->values();
+            if (values.empty()) {
+                break;
+            }
+            std::vector<std::string> keys;
+            keys.reserve(values.size());
+            for (const auto& value : values) {
+                if (!value.is_null()) {
+                    keys.emplace_back(encode(value));
+                }
+            }
+            bounds.add_values(std::move(keys));
+            break;
+        }
+        case PredicateType::kGT:
+        case PredicateType::kGE: {
+            Datum value = col_pred->value();
+            if (!value.is_null()) {
+                bounds.add_lower(encode(value), col_pred->type() == PredicateType::kGE);
+            }
+            break;
+        }
+        case PredicateType::kLT:
+        case PredicateType::kLE: {
+            Datum value = col_pred->value();
+            if (!value.is_null()) {
+                bounds.add_upper(encode(value), col_pred->type() == PredicateType::kLE);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return bounds;
+}
+
+Status decode_positions(Slice positions, std::vector<Roaring>* segment_rows, size_t* num_rows) {
+    uint32_t segment_id = 0;
+    uint32_t rowid = 0;
+    while (!positions.empty()) {
+        if (!get_varint32(&positions, &segment_id) || !get_varint32(&positions, &rowid)) {
+            return Status::Corruption("invalid row positions in the sorted index");
+        }
+        if (segment_id >= segment_rows->size()) {
+            return Status::Corruption(fmt::format("invalid segment id {} in the sorted index", segment_id));
+        }
+        (*segment_rows)[segment_id].add(rowid);
+        (*num_rows)++;
+    }
+    return Status::OK();
+}
+
+// Returns the rows of each segment selected by |bounds|, or nullopt if they are too many to use the index.
+StatusOr<std::optional<std::vector<Roaring>>> search(const Rowset& rowset, const std::string& index_path,
+                                                      const ValueBounds& bounds) {
+    ASSIGN_OR_RETURN(auto read_file, fs::new_random_access_file(index_path));
+    ASSIGN_OR_RETURN(auto file_size, read_file->get_size());
+    sstable::Options options;
+    options.filter_policy = bloom_filter_policy();
+    sstable::Table* table_ptr = nullptr;
+    RETURN_IF_ERROR(sstable::Table::Open(options, read_file.get(), file_size, &table_ptr));
+    std::unique_ptr<sstable::Table> table(table_ptr);
+
+    const auto max_rows = static_cast<size_t>(rowset.num_rows() * config::rowset_sorted_index_max_filter_ratio);
+    std::vector<Roaring> segment_rows(rowset.num_segments());
+    size_t num_rows = 0;
+    sstable::ReadOptions read_options;
+    if (bounds.values.has_value()) {
+        std::vector<Slice> keys;
+        for (const auto& value : bounds.values.value()) {
+            if (bounds.above_lower(Slice(value)) && bounds.below_upper(Slice(value))) {
+                keys.emplace_back(value);
+            }
+        }
+        // The keys are sorted, so that each data block is read at most once.
+        std::vector<size_t> key_indexes(keys.size());
+        std::iota(key_indexes.begin(), key_indexes.end(), 0);
+        std::vector<std::string> positions(keys.size());
+        RETURN_IF_ERROR(table->MultiGet(read_options, keys.data(), key_indexes.begin(), key_indexes.end(), &positions));
+        for (const auto& position : positions) {
+            RETURN_IF_ERROR(decode_positions(Slice(position), &segment_rows, &num_rows));
+            if (num_rows > max_rows) {
+                return std::nullopt;
+            }
+        }
+    } else {
+        std::unique_ptr<sstable::Iterator> iter(table->NewIterator(read_options));
+        if (bounds.lower.has_value()) {
+            iter->Seek(Slice(bounds.lower.value()));
+        } else {
+            iter->SeekToFirst();
+        }
+        for (; iter->Valid(); iter->Next()) {
+            if (!bounds.above_lower(iter->key())) {
+                continue;
+            }
+            if (!bounds.below_upper(iter->key())) {
+                break;
+            }
+            RETURN_IF_ERROR(decode_positions(iter->value(), &segment_rows, &num_rows));
+            if (num_rows > max_rows) {
+                return std::nullopt;
+            }
+        }
+        RETURN_IF_ERROR(iter->status());
+    }
+    return segment_rows;
+}
+
+} // namespace
+
+bool RowsetSortedIndex::is_supported_column(const TabletColumn& column) {
+    if (!column.is_bf_column()) {
+        return false;
+    }
+    switch (column.type()) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+    case TYPE_VARCHAR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+StatusOr<int64_t> RowsetSortedIndex::build_rowset(const RowsetSharedPtr& rowset) {
+    if (rowset->num_segments() == 0 || rowset->num_rows() > config::rowset_sorted_index_max_rows) {
+        return 0;
+    }
+    const auto& tablet_schema = rowset->schema();
+    std::vector<int32_t> column_indexes;
+    for (size_t i = 0; i < tablet_schema->num_columns(); i++) {
+        const TabletColumn& column = tablet_schema->column(i);
+        if (!is_supported_column(column)) {
+            continue;
+        }
+        std::string index_path = IndexDescriptor::sorted_index_file_path(rowset->rowset_path(),
+                                                                         rowset->rowset_id_str(), column.unique_id());
+        if (!fs::path_exist(index_path)) {
+            column_indexes.emplace_back(static_cast<int32_t>(i));
+        }
+    }
+    if (column_indexes.empty()) {
+        return 0;
+    }
+
+    // Keep the files of the rowset until the building finishes, even if it is compacted meanwhile.
+    RowsetReleaseGuard guard(rowset);
+    RETURN_IF_ERROR(rowset->load());
+    for (int32_t column_index : column_indexes) {
+        RETURN_IF_ERROR(build(rowset, column_index));
+    }
+    return column_indexes.size();
+}
+
+Status RowsetSortedIndex::build(const RowsetSharedPtr& rowset, int32_t column_index) {
+    const TabletColumn& column = rowset->schema()->column(column_index);
+    const KeyCoder* key_coder = get_key_coder(column.type());
+    std::string index_path =
+            IndexDescriptor::sorted_index_file_path(rowset->rowset_path(), rowset->rowset_id_str(), column.unique_id());
+    std::string tmp_index_path = index_path + ".building";
+    bool built = false;
+    DeferOp remove_tmp_file([&]() {
+        if (!built && fs::path_exist(tmp_index_path)) {
+            WARN_IF_ERROR(fs::delete_file(tmp_index_path), "failed to remove " + tmp_index_path);
+        }
+    });
+
+    struct Entry {
+        std::string key;
+        uint32_t segment_id;
+        rowid_t rowid;
+    };
+    std::vector<Entry> entries;
+    entries.reserve(rowset->num_rows());
+    auto values = ChunkHelper::column_from_field(ChunkHelper::convert_field(column_index, column));
+    for (const auto& segment : rowset->segments()) {
+        OlapReaderStatistics stats;
+        ColumnIteratorOptions iter_opts;
+        iter_opts.stats = &stats;
+        // The values are read only once, do not evict the pages of the queries.
+        iter_opts.use_page_cache = false;
+        ASSIGN_OR_RETURN(auto read_file, segment->file_system()->new_random_access_file(segment->file_info()));
+        iter_opts.read_file = read_file.get();
+        ASSIGN_OR_RETURN(auto column_iter, segment->new_column_iterator(column, nullptr));
+        RETURN_IF_ERROR(column_iter->init(iter_opts));
+        RETURN_IF_ERROR(column_iter->seek_to_first());
+
+        rowid_t rowid = 0;
+        while (rowid < segment->num_rows()) {
+            size_t num_rows = std::min<size_t>(segment->num_rows() - rowid, config::vector_chunk_size);
+            values->reset_column();
+            RETURN_IF_ERROR(column_iter->next_batch(&num_rows, values.get()));
+            if (num_rows == 0) {
+                return Status::Corruption(fmt::format("segment {} has less rows than {}", segment->file_name(),
+                                                      segment->num_rows()));
+            }
+            for (size_t i = 0; i < num_rows; i++) {
+                if (values->is_null(i)) {
+                    continue;
+                }
+                auto& entry = entries.emplace_back();
+                key_coder->full_encode_ascending(values->get(i), &entry.key);
+                entry.segment_id = segment->id();
+                entry.rowid = rowid + i;
+            }
+            rowid += num_rows;
+        }
+    }
+    // The entries of each value stay in the order of (segment id, rowid).
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.key < rhs.key; });
+
+    ASSIGN_OR_RETURN(auto write_file, fs::new_writable_file(tmp_index_path));
+    sstable::Options options;
+    options.filter_policy = bloom_filter_policy();
+    sstable::TableBuilder builder(options, write_file.get());
+    std::string positions;
+    for (size_t i = 0; i < entries.size();) {
+        positions.clear();
+        size_t j = i;
+        for (; j < entries.size() && entries[j].key == entries[i].key; j++) {
+            put_varint32(&positions, entries[j].segment_id);
+            put_varint32(&positions, entries[j].rowid);
+        }
+        builder.Add(Slice(entries[i].key), Slice(positions));
+        i = j;
+    }
+    RETURN_IF_ERROR(builder.Finish());
+    RETURN_IF_ERROR(write_file->close());
+    RETURN_IF_ERROR(FileSystem::Default()->rename_file(tmp_index_path, index_path));
+    built = true;
+    VLOG(1) << "built the sorted index " << index_path << " of " << entries.size() << " values";
+    return Status::OK();
+}
+
+Status RowsetSortedIndex::lookup(const Rowset& rowset, const TabletSchema& read_schema, const PredicateTree& pred_tree,
+                                 std::vector<SparseRangePtr>* segment_ranges) {
+    segment_ranges->clear();
+    if (rowset.num_segments() == 0) {
+        return Status::OK();
+    }
+
+    std::optional<std::vector<Roaring>> candidates;
+    for (const auto& [cid, col_nodes] : pred_tree.root().col_children_map()) {
+        if (cid >= read_schema.num_columns()) {
+            continue;
+        }
+        int32_t column_index = rowset.schema()->field_index(read_schema.column(cid).unique_id());
+        if (column_index < 0) {
+            continue;
+        }
+        const TabletColumn& column = rowset.schema()->column(column_index);
+        if (!is_supported_column(column) || column.type() != read_schema.column(cid).type()) {
+            continue;
+        }
+        ValueBounds bounds = parse_predicates(col_nodes, column.type(), get_key_coder(column.type()));
+        if (bounds.is_unbounded()) {
+            continue;
+        }
+        std::string index_path = IndexDescriptor::sorted_index_file_path(rowset.rowset_path(), rowset.rowset_id_str(),
+                                                                         column.unique_id());
+        if (!fs::path_exist(index_path)) {
+            continue;
+        }
+
+        ASSIGN_OR_RETURN(auto segment_rows, search(rowset, index_path, bounds));
+        if (!segment_rows.has_value()) {
+            continue;
+        }
+        if (!candidates.has_value()) {
+            candidates = std::move(segment_rows);
+        } else {
+            for (size_t i = 0; i < candidates->size(); i++) {
+                (*candidates)[i] &= (*segment_rows)[i];
+            }
+        }
+    }
+
+    if (candidates.has_value()) {
+        segment_ranges->reserve(candidates->size());
+        for (const auto& rows : candidates.value()) {
+            segment_ranges->emplace_back(std::make_shared<SparseRange<>>(roaring2range(rows)));
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
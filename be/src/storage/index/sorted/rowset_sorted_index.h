@@ -0,0 +1,53 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "common/statusor.h"
+#include "storage/predicate_tree/predicate_tree_fwd.h"
+#include "storage/range.h"
+#include "storage/rowset/rowset.h"
+#include "storage/tablet_schema.h"
+
+namespace starrocks {
+
+// The sorted index of a rowset maps each non-null value of a column to the (segment id, rowid) of its rows, stored
+// as an sstable keyed by the memcomparable encoding of the value. The per-segment indexes have to be probed once
+// for each segment, while a lookup on the sorted index of a rowset, which is usually the only one of a tablet after
+// the compactions, finds the candidate rows of all the segments at once.
+//
+// The index is built in the background after a rowset is written by a load or a compaction, and removed together
+// with the rowset. A rowset without the index is read as usual.
+class RowsetSortedIndex {
+public:
+    // Whether the sorted index is built for |column|.
+    static bool is_supported_column(const TabletColumn& column);
+
+    // Builds the missing sorted indexes of all the supported columns of |rowset|, returns the number of the indexes
+    // built.
+    static StatusOr<int64_t> build_rowset(const RowsetSharedPtr& rowset);
+
+    // Builds the sorted index of the column |column_index| of the schema of |rowset|.
+    static Status build(const RowsetSharedPtr& rowset, int32_t column_index);
+
+    // Finds the candidate rows of each segment of |rowset| by the predicates of the root of |pred_tree| on the
+    // indexed columns. |segment_ranges| is left empty if no index is used, otherwise it has a range for each segment.
+    // |read_schema| is the schema which the column ids of |pred_tree| refer to.
+    static Status lookup(const Rowset& rowset, const TabletSchema& read_schema, const PredicateTree& pred_tree,
+                         std::vector<SparseRangePtr>* segment_ranges);
+};
+
+} // namespace starrocks
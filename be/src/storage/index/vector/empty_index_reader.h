@@ -20,8 +20,13 @@ namespace starrocks {
 
 class EmptyIndexReader final : public VectorIndexReader {
 public:
+    explicit EmptyIndexReader(bool is_deferred = false) : _is_deferred(is_deferred) {}
     ~EmptyIndexReader() override = default;
 
+    // Whether the index is not built yet rather than skipped for too few rows, so the rows of the segment must be
+    // searched without the index.
+    bool is_deferred() const { return _is_deferred; }
+
     Status init_searcher(const tenann::IndexMeta& meta, const std::string& index_path) override {
         return Status::NotSupported("Not implement");
     }
@@ -36,6 +41,9 @@ public:
                         int order) override {
         return Status::NotSupported("Not implement");
     }
+
+private:
+    const bool _is_deferred;
 };
 
 } // namespace starrocks
\ No newline at end of file
@@ -0,0 +1,156 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/index/vector/vector_exact_search.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+#include <cmath>
+
+namespace starrocks {
+
+#ifdef __AVX2__
+static inline float horizontal_sum(__m256 v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+static inline float l2_distance(const float* x, const float* y, size_t dim) {
+    size_t i = 0;
+    float sum = 0;
+#ifdef __AVX2__
+    __m256 sum_vec = _mm256_setzero_ps();
+    for (; i + 8 <= dim; i += 8) {
+        __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i));
+        sum_vec = _mm256_add_ps(sum_vec, _mm256_mul_ps(diff, diff));
+    }
+    sum = horizontal_sum(sum_vec);
+#endif
+    for (; i < dim; i++) {
+        float diff = x[i] - y[i];
+        sum += diff * diff;
+    }
+    return sum;
+}
+
+// Returns the inner product of |x| and |y|, and the squared norm of |y| in |y_norm| if it is not null.
+static inline float inner_product(const float* x, const float* y, size_t dim, float* y_norm) {
+    size_t i = 0;
+    float sum = 0;
+    float norm = 0;
+#ifdef __AVX2__
+    __m256 sum_vec = _mm256_setzero_ps();
+    __m256 norm_vec = _mm256_setzero_ps();
+    for (; i + 8 <= dim; i += 8) {
+        __m256 x_vec = _mm256_loadu_ps(x + i);
+        __m256 y_vec = _mm256_loadu_ps(y + i);
+        sum_vec = _mm256_add_ps(sum_vec, _mm256_mul_ps(x_vec, y_vec));
+        if (y_norm != nullptr) {
+            norm_vec = _mm256_add_ps(norm_vec, _mm256_mul_ps(y_vec, y_vec));
+        }
+    }
+    sum = horizontal_sum(sum_vec);
+    norm = horizontal_sum(norm_vec);
+#endif
+    for (; i < dim; i++) {
+        sum += x[i] * y[i];
+        norm += y[i] * y[i];
+    }
+    if (y_norm != nullptr) {
+        *y_norm = norm;
+    }
+    return sum;
+}
+
+StatusOr<VectorMetric> VectorExactSearch::parse_metric(const std::string& metric_type) {
+    const std::string metric = boost::algorithm::to_lower_copy(metric_type);
+    if (metric == "l2_distance") {
+        return VectorMetric::L2_DISTANCE;
+    } else if (metric == "cosine_similarity") {
+        return VectorMetric::COSINE_SIMILARITY;
+    } else if (metric == "inner_product") {
+        return VectorMetric::INNER_PRODUCT;
+    }
+    return Status::NotSupported("Exact vector search does not support metric type " + metric_type);
+}
+
+void VectorExactSearch::compute_distances(VectorMetric metric, bool is_normed, const float* query,
+                                          const float* vectors, size_t dim, size_t num_vectors, float* distances) {
+    switch (metric) {
+    case VectorMetric::L2_DISTANCE:
+        for (size_t i = 0; i < num_vectors; i++) {
+            distances[i] = l2_distance(query, vectors + i * dim, dim);
+        }
+        break;
+    case VectorMetric::INNER_PRODUCT:
+        for (size_t i = 0; i < num_vectors; i++) {
+            distances[i] = inner_product(query, vectors + i * dim, dim, nullptr);
+        }
+        break;
+    case VectorMetric::COSINE_SIMILARITY: {
+        if (is_normed) {
+            for (size_t i = 0; i < num_vectors; i++) {
+                distances[i] = inner_product(query, vectors + i * dim, dim, nullptr);
+            }
+            break;
+        }
+        float query_norm = 0;
+        inner_product(query, query, dim, &query_norm);
+        query_norm = std::sqrt(query_norm);
+        for (size_t i = 0; i < num_vectors; i++) {
+            float norm = 0;
+            float product = inner_product(query, vectors + i * dim, dim, &norm);
+            distances[i] = product / (query_norm * std::sqrt(norm));
+        }
+        break;
+    }
+    }
+}
+
+void VectorExactSearch::select_closest(VectorMetric metric, const std::vector<int64_t>& ids,
+                                       const std::vector<float>& distances, int64_t k, double range,
+                                       std::vector<int64_t>* result_ids, std::vector<float>* result_distances) {
+    const bool ascending = is_ascending(metric);
+    std::vector<uint32_t> order;
+    order.reserve(ids.size());
+    for (uint32_t i = 0; i < ids.size(); i++) {
+        if (range > 0 && (ascending ? distances[i] > range : distances[i] < range)) {
+            continue;
+        }
+        order.push_back(i);
+    }
+    auto closer = [&](uint32_t l, uint32_t r) {
+        return ascending ? distances[l] < distances[r] : distances[l] > distances[r];
+    };
+    size_t n = std::min<size_t>(std::max<int64_t>(k, 0), order.size());
+    std::partial_sort(order.begin(), order.begin() + n, order.end(), closer);
+
+    result_ids->clear();
+    result_distances->clear();
+    result_ids->reserve(n);
+    result_distances->reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        result_ids->push_back(ids[order[i]]);
+        result_distances->push_back(distances[order[i]]);
+    }
+}
+
+} // namespace starrocks
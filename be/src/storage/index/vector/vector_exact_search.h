@@ -0,0 +1,56 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/statusor.h"
+
+namespace starrocks {
+
+// The metrics of the vector index, with the same definition of the distances as the sql functions, e.g. the
+// l2 distance is the squared euclidean distance as `approx_l2_distance`.
+enum class VectorMetric {
+    L2_DISTANCE,
+    COSINE_SIMILARITY,
+    INNER_PRODUCT,
+};
+
+// Exact nearest neighbor search on the vectors of a segment, which replaces the index search when only a few
+// rows are left by the other filters.
+class VectorExactSearch {
+public:
+    // Returns NotSupported for the metrics without an exact implementation.
+    static StatusOr<VectorMetric> parse_metric(const std::string& metric_type);
+
+    // Whether a smaller distance is closer.
+    static bool is_ascending(VectorMetric metric) { return metric == VectorMetric::L2_DISTANCE; }
+
+    // Computes the distances between |query| and the |num_vectors| vectors of |dim| floats stored one after another
+    // in |vectors|. |is_normed| means the vectors are normalized, so the cosine similarity is the inner product.
+    static void compute_distances(VectorMetric metric, bool is_normed, const float* query, const float* vectors,
+                                  size_t dim, size_t num_vectors, float* distances);
+
+    // Selects the at most |k| ids closest to the query by |distances|, closest first. If |range| is positive,
+    // only the ids within it are selected, i.e. the distance is no more than it for an ascending metric, or no
+    // less than it otherwise.
+    static void select_closest(VectorMetric metric, const std::vector<int64_t>& ids, const std::vector<float>& distances,
+                               int64_t k, double range, std::vector<int64_t>* result_ids,
+                               std::vector<float>* result_distances);
+};
+
+} // namespace starrocks
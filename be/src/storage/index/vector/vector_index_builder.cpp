@@ -19,11 +19,19 @@
 
 namespace starrocks {
 
-Status VectorIndexBuilder::flush_empty(const std::string& segment_index_path) {
+static Status flush_mark(const std::string& segment_index_path, const std::string& mark) {
     ASSIGN_OR_RETURN(auto empty_file, fs::new_writable_file(segment_index_path));
-    RETURN_IF_ERROR(empty_file->append(IndexDescriptor::mark_word));
+    RETURN_IF_ERROR(empty_file->append(mark));
     RETURN_IF_ERROR(empty_file->flush(WritableFile::FLUSH_SYNC));
     return empty_file->close();
 }
 
+Status VectorIndexBuilder::flush_empty(const std::string& segment_index_path) {
+    return flush_mark(segment_index_path, IndexDescriptor::mark_word);
+}
+
+Status VectorIndexBuilder::flush_deferred(const std::string& segment_index_path) {
+    return flush_mark(segment_index_path, IndexDescriptor::deferred_mark_word);
+}
+
 } // namespace starrocks
\ No newline at end of file
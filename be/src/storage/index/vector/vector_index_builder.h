@@ -50,6 +50,9 @@ public:
     // by marking the index file.
     static Status flush_empty(const std::string& segment_index_path);
 
+    // Marks the index file of a segment whose index will be built in the background.
+    static Status flush_deferred(const std::string& segment_index_path);
+
 protected:
     std::shared_ptr<TabletIndex> _tablet_index;
     std::unique_ptr<VectorIndexBuilder> _debug_writer;
@@ -0,0 +1,127 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/index/vector/vector_index_deferred_builder.h"
+
+#include "fs/fs_util.h"
+#include "storage/chunk_helper.h"
+#include "storage/index/index_descriptor.h"
+#include "storage/index/vector/vector_index_writer.h"
+#include "storage/olap_common.h"
+#include "storage/rowset/column_iterator.h"
+#include "storage/rowset/segment.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+StatusOr<bool> VectorIndexDeferredBuilder::is_deferred(const std::string& index_path) {
+    ASSIGN_OR_RETURN(auto index_file, fs::new_random_access_file(index_path));
+    ASSIGN_OR_RETURN(auto file_size, index_file->get_size());
+    if (file_size != IndexDescriptor::mark_word_len) {
+        return false;
+    }
+    std::string buf(file_size, '\0');
+    RETURN_IF_ERROR(index_file->read_fully(buf.data(), file_size));
+    return buf == IndexDescriptor::deferred_mark_word;
+}
+
+StatusOr<int64_t> VectorIndexDeferredBuilder::build_rowset(const RowsetSharedPtr& rowset) {
+    std::vector<std::shared_ptr<TabletIndex>> vector_indexes;
+    for (const auto& index : *rowset->schema()->indexes()) {
+        if (index.index_type() == VECTOR) {
+            vector_indexes.emplace_back(std::make_shared<TabletIndex>(index));
+        }
+    }
+    if (vector_indexes.empty() || rowset->num_segments() == 0) {
+        return 0;
+    }
+
+    // Keep the files of the rowset until the building finishes, even if it is compacted meanwhile.
+    RowsetReleaseGuard guard(rowset);
+    RETURN_IF_ERROR(rowset->load());
+    int64_t num_built = 0;
+    for (const auto& segment : rowset->segments()) {
+        for (const auto& tablet_index : vector_indexes) {
+            std::string index_path = IndexDescriptor::vector_index_file_path(
+                    rowset->rowset_path(), rowset->rowset_id_str(), segment->id(), tablet_index->index_id());
+            if (!fs::path_exist(index_path)) {
+                continue;
+            }
+            ASSIGN_OR_RETURN(bool deferred, is_deferred(index_path));
+            if (deferred) {
+                RETURN_IF_ERROR(build_segment(rowset, segment, tablet_index));
+                num_built++;
+            }
+        }
+    }
+    return num_built;
+}
+
+Status VectorIndexDeferredBuilder::build_segment(const RowsetSharedPtr& rowset, const SegmentSharedPtr& segment,
+                                                 const std::shared_ptr<TabletIndex>& tablet_index) {
+    const auto& tablet_schema = rowset->schema();
+    int32_t column_index = tablet_schema->field_index(tablet_index->col_unique_ids()[0]);
+    if (column_index < 0) {
+        return Status::NotFound(fmt::format("column {} of vector index {} not found",
+                                            tablet_index->col_unique_ids()[0], tablet_index->index_id()));
+    }
+    const TabletColumn& column = tablet_schema->column(column_index);
+
+    std::string index_path = IndexDescriptor::vector_index_file_path(rowset->rowset_path(), rowset->rowset_id_str(),
+                                                                     segment->id(), tablet_index->index_id());
+    std::string tmp_index_path = index_path + ".building";
+    bool built = false;
+    DeferOp remove_tmp_file([&]() {
+        if (!built && fs::path_exist(tmp_index_path)) {
+            WARN_IF_ERROR(fs::delete_file(tmp_index_path), "failed to remove " + tmp_index_path);
+        }
+    });
+
+    OlapReaderStatistics stats;
+    ColumnIteratorOptions iter_opts;
+    iter_opts.stats = &stats;
+    // The vectors are read only once, do not evict the pages of the queries.
+    iter_opts.use_page_cache = false;
+    ASSIGN_OR_RETURN(auto read_file, segment->file_system()->new_random_access_file(segment->file_info()));
+    iter_opts.read_file = read_file.get();
+    ASSIGN_OR_RETURN(auto column_iter, segment->new_column_iterator(column, nullptr));
+    RETURN_IF_ERROR(column_iter->init(iter_opts));
+    RETURN_IF_ERROR(column_iter->seek_to_first());
+
+    std::unique_ptr<VectorIndexWriter> index_writer;
+    VectorIndexWriter::create(tablet_index, tmp_index_path, column.is_nullable(), &index_writer);
+    index_writer->disable_deferred_build();
+    RETURN_IF_ERROR(index_writer->init());
+
+    auto values = ChunkHelper::column_from_field(ChunkHelper::convert_field(column_index, column));
+    size_t remaining = segment->num_rows();
+    while (remaining > 0) {
+        size_t num_rows = std::min<size_t>(remaining, config::vector_chunk_size);
+        values->reset_column();
+        RETURN_IF_ERROR(column_iter->next_batch(&num_rows, values.get()));
+        if (num_rows == 0) {
+            return Status::Corruption(fmt::format("segment {} has less rows than {}", segment->file_name(),
+                                                  segment->num_rows()));
+        }
+        RETURN_IF_ERROR(index_writer->append(*values));
+        remaining -= num_rows;
+    }
+    RETURN_IF_ERROR(index_writer->finish(nullptr));
+    RETURN_IF_ERROR(FileSystem::Default()->rename_file(tmp_index_path, index_path));
+    built = true;
+    VLOG(1) << "built the deferred vector index " << index_path << " of " << segment->num_rows() << " rows";
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,44 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "common/statusor.h"
+#include "storage/rowset/rowset.h"
+#include "storage/tablet_schema.h"
+
+namespace starrocks {
+
+// Builds the vector indexes of the segments written with the deferred mark when
+// config::enable_vector_index_deferred_build is set.
+//
+// The index is built from the vector column of the segment into a temporary file, which then replaces the mark by
+// a rename, so a concurrent query either searches the segment exactly by the mark or with the whole index. The
+// segments written by compactions are deferred in the same way, and their indexes are built from their own rows.
+class VectorIndexDeferredBuilder {
+public:
+    // Whether the index file at |index_path| is the deferred mark.
+    static StatusOr<bool> is_deferred(const std::string& index_path);
+
+    // Builds the deferred indexes of all the segments of |rowset|, returns the number of the indexes built.
+    static StatusOr<int64_t> build_rowset(const RowsetSharedPtr& rowset);
+
+    // Builds the index described by |tablet_index| of the segment |segment| of |rowset|.
+    static Status build_segment(const RowsetSharedPtr& rowset, const SegmentSharedPtr& segment,
+                                const std::shared_ptr<TabletIndex>& tablet_index);
+};
+
+} // namespace starrocks
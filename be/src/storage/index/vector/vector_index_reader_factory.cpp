@@ -36,6 +36,10 @@ Status VectorIndexReaderFactory::create_from_file(const std::string& index_path,
             (*vector_index_reader) = std::make_shared<EmptyIndexReader>();
             return Status::OK();
         }
+        if (buf_str == IndexDescriptor::deferred_mark_word) {
+            (*vector_index_reader) = std::make_shared<EmptyIndexReader>(true);
+            return Status::OK();
+        }
     }
     (*vector_index_reader) = std::make_shared<TenANNReader>();
     return Status::OK();
@@ -27,6 +27,7 @@ void VectorIndexWriter::create(const std::shared_ptr<TabletIndex>& tablet_index,
 }
 
 Status VectorIndexWriter::init() {
+    _deferred_build = _allow_deferred_build && config::enable_vector_index_deferred_build;
     auto index_type_iter = _tablet_index->common_properties().find("index_type");
     if (index_type_iter->second != "ivfpq") {
         _start_vector_index_build_threshold = 0;
@@ -41,6 +42,11 @@ Status VectorIndexWriter::init() {
 }
 
 Status VectorIndexWriter::append(const Column& src) {
+    if (_deferred_build) {
+        _next_row_id += src.size();
+        _row_size += src.size();
+        return Status::OK();
+    }
     int64_t duration = 0;
     {
         SCOPED_RAW_TIMER(&duration);
@@ -83,7 +89,9 @@ Status VectorIndexWriter::finish(uint64_t* index_size) {
     {
         SCOPED_RAW_TIMER(&duration);
 
-        if (_index_builder.get() != nullptr) {
+        if (_deferred_build) {
+            RETURN_IF_ERROR(VectorIndexBuilder::flush_deferred(_vector_index_file_path));
+        } else if (_index_builder.get() != nullptr) {
             // flush with index
             RETURN_IF_ERROR(_index_builder->flush());
         } else {
@@ -56,6 +56,10 @@ public:
 
     bool is_nullable() const { return _is_nullable; }
 
+    // Builds the index in finish() even if config::enable_vector_index_deferred_build is set, used by the background
+    // building of the deferred indexes. Must be called before init().
+    void disable_deferred_build() { _allow_deferred_build = false; }
+
 private:
     std::shared_ptr<TabletIndex> _tablet_index;
     std::string _vector_index_file_path;
@@ -63,6 +67,10 @@ private:
 
     uint32_t _start_vector_index_build_threshold = config::config_vector_index_default_build_threshold;
 
+    // Only the deferred mark is written for the segment, and the index is built in the background.
+    bool _allow_deferred_build = true;
+    bool _deferred_build = false;
+
     // buffer data for tiny data size
     ColumnPtr _buffer_column;
 
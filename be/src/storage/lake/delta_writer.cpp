@@ -54,14 +54,14 @@ public:
 
     Status flush_chunk(const Chunk& chunk, starrocks::SegmentPB* segment = nullptr) override {
         RETURN_IF_ERROR(_writer->write(chunk, segment));
-        return _writer->flush(segment);
+        return _writer->flush_async(segment);
     }
 
     Status flush_chunk_with_deletes(const Chunk& upserts, const Column& deletes,
                                     starrocks::SegmentPB* segment = nullptr) override {
         RETURN_IF_ERROR(_writer->flush_del_file(deletes));
         RETURN_IF_ERROR(_writer->write(upserts, segment));
-        return _writer->flush(segment);
+        return _writer->flush_async(segment);
     }
 
 private:
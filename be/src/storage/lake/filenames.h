@@ -73,6 +73,23 @@ inline std::string tablet_metadata_filename(int64_t tablet_id, int64_t version)
     return fmt::format("{:016X}_{:016X}.meta", tablet_id, version);
 }
 
+inline std::string bundle_tablet_metadata_filename(int64_t version) {
+    return fmt::format("{:016X}.bundle", version);
+}
+
+inline bool is_bundle_tablet_metadata(std::string_view file_name) {
+    return HasSuffixString(file_name, ".bundle");
+}
+
+inline int64_t parse_bundle_tablet_metadata_filename(std::string_view file_name) {
+    constexpr static int kBase = 16;
+    CHECK_EQ(23, file_name.size()) << file_name;
+    StringParser::ParseResult res;
+    auto version = StringParser::string_to_int<int64_t>(file_name.data(), 16, kBase, &res);
+    CHECK_EQ(StringParser::PARSE_SUCCESS, res) << file_name;
+    return version;
+}
+
 inline std::string tablet_initial_metadata_filename() {
     return tablet_metadata_filename(0, kInitialVersion);
 }
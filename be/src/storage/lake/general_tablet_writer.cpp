@@ -21,6 +21,7 @@
 #include "fs/fs_util.h"
 #include "fs/key_cache.h"
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "serde/column_array_serde.h"
 #include "storage/lake/filenames.h"
 #include "storage/lake/tablet_manager.h"
@@ -35,11 +36,20 @@ HorizontalGeneralTabletWriter::HorizontalGeneralTabletWriter(TabletManager* tabl
                                                              bool is_compaction, ThreadPool* flush_pool)
         : TabletWriter(tablet_mgr, tablet_id, std::move(schema), txn_id, is_compaction, flush_pool) {}
 
-HorizontalGeneralTabletWriter::~HorizontalGeneralTabletWriter() = default;
+HorizontalGeneralTabletWriter::~HorizontalGeneralTabletWriter() {
+    auto st = collect_finalized_segments(true);
+    LOG_IF(WARNING, !st.ok()) << "Fail to finalize segment, tablet_id: " << _tablet_id << ", txn_id: " << _txn_id
+                              << ", status:" << st;
+}
 
 // To developers: Do NOT perform any I/O in this method, because this method may be invoked
 // in a bthread.
 Status HorizontalGeneralTabletWriter::open() {
+    auto* finalize_pool = ExecEnv::GetInstance()->lake_segment_finalize_pool();
+    if (finalize_pool != nullptr && config::lake_max_in_flight_segments_per_tablet > 0) {
+        _segment_finalize_token = std::make_unique<ConcurrencyLimitedThreadPoolToken>(
+                finalize_pool, config::lake_max_in_flight_segments_per_tablet);
+    }
     return Status::OK();
 }
 
@@ -55,16 +65,24 @@ Status HorizontalGeneralTabletWriter::write(const starrocks::Chunk& data, Segmen
 }
 
 Status HorizontalGeneralTabletWriter::flush(SegmentPB* segment) {
+    RETURN_IF_ERROR(flush_segment_writer(segment));
+    return collect_finalized_segments(true);
+}
+
+Status HorizontalGeneralTabletWriter::flush_async(SegmentPB* segment) {
     return flush_segment_writer(segment);
 }
 
 Status HorizontalGeneralTabletWriter::finish(SegmentPB* segment) {
     RETURN_IF_ERROR(flush_segment_writer(segment));
+    RETURN_IF_ERROR(collect_finalized_segments(true));
     _finished = true;
     return Status::OK();
 }
 
 void HorizontalGeneralTabletWriter::close() {
+    // the files of the segments being finalized are deleted as well.
+    (void)collect_finalized_segments(true);
     if (!_finished && !_files.empty()) {
         std::vector<std::string> full_paths_to_delete;
         full_paths_to_delete.reserve(_files.size());
@@ -87,6 +105,7 @@ Status HorizontalGeneralTabletWriter::reset_segment_writer() {
     auto name = gen_segment_filename(_txn_id);
     SegmentWriterOptions opts;
     opts.is_compaction = _is_compaction;
+    opts.tablet_id = _tablet_id;
     WritableFileOptions wopts;
     if (config::enable_transparent_data_encryption) {
         ASSIGN_OR_RETURN(auto pair, KeyCache::instance().create_encryption_meta_pair_using_current_kek());
@@ -106,7 +125,12 @@ Status HorizontalGeneralTabletWriter::reset_segment_writer() {
 }
 
 Status HorizontalGeneralTabletWriter::flush_segment_writer(SegmentPB* segment) {
+    if (_seg_writer != nullptr && _segment_finalize_token != nullptr && segment == nullptr) {
+        return finalize_segment_async();
+    }
     if (_seg_writer != nullptr) {
+        // keep the segments in the order of their ids.
+        RETURN_IF_ERROR(collect_finalized_segments(true));
         uint64_t segment_size = 0;
         uint64_t index_size = 0;
         uint64_t footer_position = 0;
@@ -126,6 +150,52 @@ Status HorizontalGeneralTabletWriter::flush_segment_writer(SegmentPB* segment) {
     return Status::OK();
 }
 
+Status HorizontalGeneralTabletWriter::finalize_segment_async() {
+    RETURN_IF_ERROR(collect_finalized_segments(false));
+    std::shared_ptr<SegmentWriter> seg_writer = std::move(_seg_writer);
+    auto mem_tracker = tls_thread_status.mem_tracker();
+    auto task = std::make_shared<std::packaged_task<StatusOr<FileInfo>()>>(
+            [seg_writer, mem_tracker]() -> StatusOr<FileInfo> {
+                SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+                uint64_t segment_size = 0;
+                uint64_t index_size = 0;
+                uint64_t footer_position = 0;
+                RETURN_IF_ERROR(seg_writer->finalize(&segment_size, &index_size, &footer_position));
+                const std::string& segment_path = seg_writer->segment_path();
+                std::string segment_name = std::string(basename(segment_path));
+                return FileInfo{segment_name, segment_size, seg_writer->encryption_meta()};
+            });
+    _finalizing_segments.push_back(task->get_future());
+    auto timeout_deadline =
+            std::chrono::system_clock::now() + std::chrono::milliseconds(kDefaultTimeoutForAsyncWriteSegment);
+    auto st = _segment_finalize_token->submit_func([task]() { (*task)(); }, timeout_deadline);
+    if (!st.ok()) {
+        LOG(WARNING) << "Fail to submit segment finalizing task to thread pool, finalize it in place, " << st;
+        (*task)();
+    }
+    return Status::OK();
+}
+
+Status HorizontalGeneralTabletWriter::collect_finalized_segments(bool wait_all) {
+    Status ret;
+    while (!_finalizing_segments.empty()) {
+        auto& future = _finalizing_segments.front();
+        if (!wait_all && future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            break;
+        }
+        auto res = future.get();
+        _finalizing_segments.pop_front();
+        if (!res.ok()) {
+            LOG(WARNING) << "Segment finalizing task resulted in error: " << res.status();
+            ret.update(res.status());
+            continue;
+        }
+        _data_size += res->size.value();
+        _files.emplace_back(std::move(res).value());
+    }
+    return ret;
+}
+
 VerticalGeneralTabletWriter::VerticalGeneralTabletWriter(TabletManager* tablet_mgr, int64_t tablet_id,
                                                          std::shared_ptr<const TabletSchema> schema, int64_t txn_id,
                                                          uint32_t max_rows_per_segment, bool is_compaction,
@@ -282,6 +352,7 @@ StatusOr<std::shared_ptr<SegmentWriter>> VerticalGeneralTabletWriter::create_seg
     auto name = gen_segment_filename(_txn_id);
     SegmentWriterOptions opts;
     opts.is_compaction = _is_compaction;
+    opts.tablet_id = _tablet_id;
     WritableFileOptions wopts;
     if (config::enable_transparent_data_encryption) {
         ASSIGN_OR_RETURN(auto pair, KeyCache::instance().create_encryption_meta_pair_using_current_kek());
@@ -14,11 +14,13 @@
 
 #pragma once
 
+#include <deque>
 #include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "common/statusor.h"
 #include "gutil/macros.h"
 #include "storage/lake/tablet_writer.h"
 
@@ -63,6 +65,8 @@ public:
 
     Status flush(SegmentPB* segment = nullptr) override;
 
+    Status flush_async(SegmentPB* segment = nullptr) override;
+
     Status flush_columns() override {
         return Status::NotSupported("HorizontalGeneralTabletWriter flush_columns not support");
     }
@@ -76,8 +80,19 @@ public:
 protected:
     Status reset_segment_writer();
     virtual Status flush_segment_writer(SegmentPB* segment = nullptr);
+    // Finalizes the current segment in the background, the next segment is written meanwhile.
+    Status finalize_segment_async();
+    // Adds the finalized segments to _files in the order of their ids, waits for all of them if `wait_all`.
+    Status collect_finalized_segments(bool wait_all);
 
     std::unique_ptr<SegmentWriter> _seg_writer;
+
+    static constexpr int64_t kDefaultTimeoutForAsyncWriteSegment = 1 * 60 * 1000L; // 1 minutes
+
+    // Bounds the segments of the tablet finalized in the background by config::lake_max_in_flight_segments_per_tablet,
+    // nullptr if the segments are finalized synchronously.
+    std::unique_ptr<ConcurrencyLimitedThreadPoolToken> _segment_finalize_token;
+    std::deque<std::future<StatusOr<FileInfo>>> _finalizing_segments;
 };
 
 class VerticalGeneralTabletWriter : public TabletWriter {
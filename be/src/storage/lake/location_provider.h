@@ -65,6 +65,11 @@ public:
         return join_path(metadata_root_location(tablet_id), tablet_metadata_filename(tablet_id, version));
     }
 
+    // The bundle is shared by all the tablets in the same metadata root location.
+    std::string bundle_tablet_metadata_location(int64_t tablet_id, int64_t version) const {
+        return join_path(metadata_root_location(tablet_id), bundle_tablet_metadata_filename(version));
+    }
+
     std::string tablet_initial_metadata_location(int64_t tablet_id) const {
         return join_path(metadata_root_location(tablet_id), tablet_initial_metadata_filename());
     }
@@ -16,6 +16,7 @@
 
 #include <bvar/bvar.h>
 
+#include "common/config.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "storage/del_vector.h"
 #include "storage/lake/tablet_manager.h"
@@ -64,6 +65,9 @@ static bvar::Adder<uint64_t> g_segment_cache_miss;
 static bvar::Window<bvar::Adder<uint64_t>> g_segment_cache_miss_minute("lake", "segment_cache_miss_minute",
                                                                        &g_segment_cache_miss, 60);
 
+static bvar::Adder<uint64_t> g_metacache_admission_rejected("lake", "metacache_admission_rejected");
+static bvar::Adder<uint64_t> g_metacache_admission_ghost_hit("lake", "metacache_admission_ghost_hit");
+
 #ifndef BE_TEST
 static Metacache* get_metacache() {
     auto mgr = ExecEnv::GetInstance()->lake_tablet_manager();
@@ -84,15 +88,43 @@ static bvar::PassiveStatus<size_t> g_metacache_capacity("lake", "metacache_capac
 static bvar::PassiveStatus<size_t> g_metacache_usage("lake", "metacache_usage", get_metacache_usage, nullptr);
 #endif
 
-Metacache::Metacache(int64_t cache_capacity) : _cache(new_lru_cache(cache_capacity)) {}
+Metacache::Metacache(int64_t cache_capacity)
+        : _cache(new_lru_cache(cache_capacity, ChargeMode::VALUESIZE,
+                               cache_eviction_policy_from_string(config::lake_metacache_eviction_policy))) {}
 
 Metacache::~Metacache() = default;
 
-void Metacache::insert(std::string_view key, CacheValue* ptr, size_t size) {
-    Cache::Handle* handle = _cache->insert(CacheKey(key), ptr, size, cache_value_deleter);
+void Metacache::insert(std::string_view key, CacheValue* ptr, size_t size, CachePriority priority) {
+    Cache::Handle* handle = _cache->insert(CacheKey(key), ptr, size, cache_value_deleter, priority);
     _cache->release(handle);
 }
 
+static CachePriority metadata_priority() {
+    return config::lake_metacache_durable_metadata ? CachePriority::DURABLE : CachePriority::NORMAL;
+}
+
+bool Metacache::_admit(std::string_view key, size_t size) {
+    const size_t ghost_list_size = std::max(config::lake_metacache_admission_ghost_list_size, 0);
+    if (ghost_list_size == 0 || _cache->get_memory_usage() + size <= _cache->get_capacity()) {
+        return true;
+    }
+    // the cache is full, caching the entry evicts others.
+    const size_t hash = std::hash<std::string_view>()(key);
+    std::lock_guard<std::mutex> lock(_ghost_mutex);
+    if (_ghost_set.erase(hash) > 0) {
+        g_metacache_admission_ghost_hit << 1;
+        return true;
+    }
+    _ghost_set.insert(hash);
+    _ghost_queue.push_back(hash);
+    while (_ghost_queue.size() > ghost_list_size) {
+        _ghost_set.erase(_ghost_queue.front());
+        _ghost_queue.pop_front();
+    }
+    g_metacache_admission_rejected << 1;
+    return false;
+}
+
 std::shared_ptr<const TabletMetadataPB> Metacache::lookup_tablet_metadata(std::string_view key) {
     auto handle = _cache->lookup(CacheKey(key));
     if (handle == nullptr) {
@@ -213,8 +245,11 @@ void Metacache::cache_segment(std::string_view key, std::shared_ptr<Segment> seg
 
 void Metacache::_cache_segment_no_lock(std::string_view key, std::shared_ptr<Segment> segment) {
     auto mem_cost = segment->mem_usage();
+    if (!_admit(key, mem_cost)) {
+        return;
+    }
     auto value = std::make_unique<CacheValue>(std::move(segment));
-    insert(key, value.release(), mem_cost);
+    insert(key, value.release(), mem_cost, CachePriority::NORMAL);
 }
 
 std::shared_ptr<Segment> Metacache::cache_segment_if_absent(std::string_view key, std::shared_ptr<Segment> segment) {
@@ -231,28 +266,31 @@ std::shared_ptr<Segment> Metacache::cache_segment_if_absent(std::string_view key
 
 void Metacache::cache_delvec(std::string_view key, std::shared_ptr<const DelVector> delvec) {
     auto mem_cost = delvec->memory_usage();
+    if (!_admit(key, mem_cost)) {
+        return;
+    }
     auto value = std::make_unique<CacheValue>(std::move(delvec));
-    insert(key, value.release(), mem_cost);
+    insert(key, value.release(), mem_cost, CachePriority::NORMAL);
 }
 
 void Metacache::cache_tablet_metadata(std::string_view key, std::shared_ptr<const TabletMetadataPB> metadata) {
     auto value_ptr = std::make_unique<CacheValue>(metadata);
-    insert(key, value_ptr.release(), metadata->SpaceUsedLong());
+    insert(key, value_ptr.release(), metadata->SpaceUsedLong(), metadata_priority());
 }
 
 void Metacache::cache_txn_log(std::string_view key, std::shared_ptr<const TxnLogPB> log) {
     auto value_ptr = std::make_unique<CacheValue>(log);
-    insert(key, value_ptr.release(), log->SpaceUsedLong());
+    insert(key, value_ptr.release(), log->SpaceUsedLong(), CachePriority::NORMAL);
 }
 
 void Metacache::cache_combined_txn_log(std::string_view key, std::shared_ptr<const CombinedTxnLogPB> log) {
     auto value_ptr = std::make_unique<CacheValue>(log);
-    insert(key, value_ptr.release(), log->SpaceUsedLong());
+    insert(key, value_ptr.release(), log->SpaceUsedLong(), CachePriority::NORMAL);
 }
 
 void Metacache::cache_tablet_schema(std::string_view key, std::shared_ptr<const TabletSchema> schema, size_t size) {
     auto cache_value = std::make_unique<CacheValue>(schema);
-    insert(key, cache_value.release(), size);
+    insert(key, cache_value.release(), size, metadata_priority());
 }
 
 void Metacache::erase(std::string_view key) {
@@ -14,9 +14,11 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string_view>
+#include <unordered_set>
 #include <variant>
 
 #include "gutil/macros.h"
@@ -24,6 +26,7 @@
 namespace starrocks {
 class Cache;
 class CacheKey;
+enum class CachePriority;
 class DelVector;
 class Segment;
 class TabletSchema;
@@ -68,7 +71,8 @@ public:
 
     void cache_segment(std::string_view key, std::shared_ptr<Segment> segment);
 
-    // cache the segment if the given key not exists in the cache, returns the segment shared_ptr stored in the cache.
+    // cache the segment if the given key not exists in the cache, returns the segment shared_ptr stored in the cache,
+    // or nullptr if the segment is not cached.
     std::shared_ptr<Segment> cache_segment_if_absent(std::string_view key, std::shared_ptr<Segment> segment);
 
     void cache_delvec(std::string_view key, std::shared_ptr<const DelVector> delvec);
@@ -89,11 +93,19 @@ private:
     std::shared_ptr<Segment> _lookup_segment_no_lock(std::string_view key);
     void _cache_segment_no_lock(std::string_view key, std::shared_ptr<Segment> segment);
 
-    void insert(std::string_view key, CacheValue* ptr, size_t size);
+    void insert(std::string_view key, CacheValue* ptr, size_t size, CachePriority priority);
+
+    // Returns false if the entry should not be cached, see `config::lake_metacache_admission_ghost_list_size`.
+    bool _admit(std::string_view key, size_t size);
 
     std::unique_ptr<Cache> _cache;
 
     std::mutex _mutex;
+
+    // FIFO of the hashes of the keys rejected by `_admit()`.
+    std::mutex _ghost_mutex;
+    std::deque<size_t> _ghost_queue;
+    std::unordered_set<size_t> _ghost_set;
 };
 
 } // namespace starrocks::lake
@@ -14,6 +14,7 @@
 
 #include "storage/lake/persistent_index_sstable.h"
 
+#include <algorithm>
 #include <butil/time.h> // NOLINT
 
 #include "fs/fs.h"
@@ -69,13 +70,18 @@ Status PersistentIndexSstable::multi_get(const Slice* keys, const KeyIndexSet& k
     sstable::ReadOptions options;
     options.stat = &stat;
     auto start_ts = butil::gettimeofday_us();
-    RETURN_IF_ERROR(_sst->MultiGet(options, keys, key_indexes.begin(), key_indexes.end(), &index_value_with_vers));
+    // probe the keys in order, so that the keys in the same data block are found with one block read.
+    std::vector<KeyIndex> sorted_key_indexes(key_indexes.begin(), key_indexes.end());
+    std::sort(sorted_key_indexes.begin(), sorted_key_indexes.end(),
+              [keys](KeyIndex a, KeyIndex b) { return keys[a].compare(keys[b]) < 0; });
+    RETURN_IF_ERROR(_sst->MultiGet(options, keys, sorted_key_indexes.begin(), sorted_key_indexes.end(),
+                                   &index_value_with_vers));
     auto end_ts = butil::gettimeofday_us();
     TRACE_COUNTER_INCREMENT("multi_get_us", end_ts - start_ts);
     TRACE_COUNTER_INCREMENT("read_block_hit_cache_cnt", stat.block_cnt_from_cache);
     TRACE_COUNTER_INCREMENT("read_block_miss_cache_cnt", stat.block_cnt_from_file);
     size_t i = 0;
-    for (auto& key_index : key_indexes) {
+    for (auto& key_index : sorted_key_indexes) {
         // Index_value_with_vers is empty means key is not found in sst.
         // Value in sst can not be empty.
         if (index_value_with_vers[i].empty()) {
@@ -18,6 +18,7 @@
 #include <bvar/bvar.h>
 
 #include <atomic>
+#include <map>
 #include <utility>
 
 #include "agent/master_info.h"
@@ -56,6 +57,7 @@
 namespace starrocks::lake {
 static bvar::LatencyRecorder g_get_tablet_metadata_latency("lake", "get_tablet_metadata");
 static bvar::LatencyRecorder g_put_tablet_metadata_latency("lake", "put_tablet_metadata");
+static bvar::LatencyRecorder g_put_bundle_tablet_metadata_latency("lake", "put_bundle_tablet_metadata");
 static bvar::LatencyRecorder g_get_txn_log_latency("lake", "get_txn_log");
 static bvar::LatencyRecorder g_put_txn_log_latency("lake", "put_txn_log");
 static bvar::LatencyRecorder g_del_txn_log_latency("lake", "del_txn_log");
@@ -90,6 +92,10 @@ std::string TabletManager::tablet_initial_metadata_location(int64_t tablet_id) c
     return _location_provider->tablet_initial_metadata_location(tablet_id);
 }
 
+std::string TabletManager::bundle_tablet_metadata_location(int64_t tablet_id, int64_t version) const {
+    return _location_provider->bundle_tablet_metadata_location(tablet_id, version);
+}
+
 std::string TabletManager::txn_log_location(int64_t tablet_id, int64_t txn_id) const {
     return _location_provider->txn_log_location(tablet_id, txn_id);
 }
@@ -235,6 +241,55 @@ Status TabletManager::put_tablet_metadata(const TabletMetadata& metadata) {
     return put_tablet_metadata(std::move(metadata_ptr));
 }
 
+Status TabletManager::put_bundle_tablet_metadata(std::span<const TabletMetadataPtr> metadatas) {
+    TEST_ERROR_POINT("TabletManager::put_bundle_tablet_metadata");
+    auto t0 = butil::gettimeofday_us();
+    std::map<std::string, BundleTabletMetadataPB> bundles;
+    for (const auto& metadata : metadatas) {
+        auto location = bundle_tablet_metadata_location(metadata->id(), metadata->version());
+        (*bundles[location].mutable_tablet_metas())[metadata->id()] = *metadata;
+    }
+    for (const auto& [location, bundle] : bundles) {
+        ProtobufFile file(location);
+        RETURN_IF_ERROR(file.save(bundle));
+    }
+    for (const auto& metadata : metadatas) {
+        _metacache->cache_tablet_metadata(tablet_metadata_location(metadata->id(), metadata->version()), metadata);
+        _metacache->cache_tablet_metadata(tablet_latest_metadata_cache_key(metadata->id()), metadata);
+    }
+    g_put_bundle_tablet_metadata_latency << (butil::gettimeofday_us() - t0);
+    TRACE("end write bundle tablet metadata");
+    return Status::OK();
+}
+
+StatusOr<std::shared_ptr<const BundleTabletMetadataPB>> TabletManager::load_bundle_tablet_metadata(
+        const std::string& path) {
+    auto t0 = butil::gettimeofday_us();
+    auto bundle = std::make_shared<BundleTabletMetadataPB>();
+    ProtobufFile file(path);
+    RETURN_IF_ERROR(file.load(bundle.get(), false));
+    // All the tablets of the bundle are likely to be read soon, e.g. by a scan of the partition or by the
+    // publish of the next version, cache them together even if the caller doesn't fill the cache, so that
+    // the bundle is read once instead of once per tablet.
+    for (const auto& [tablet_id, metadata] : bundle->tablet_metas()) {
+        _metacache->cache_tablet_metadata(tablet_metadata_location(tablet_id, metadata.version()),
+                                          std::make_shared<TabletMetadataPB>(metadata));
+    }
+    g_get_tablet_metadata_latency << (butil::gettimeofday_us() - t0);
+    return std::move(bundle);
+}
+
+StatusOr<TabletMetadataPtr> TabletManager::get_tablet_metadata_from_bundle(int64_t tablet_id, int64_t version) {
+    auto path = bundle_tablet_metadata_location(tablet_id, version);
+    ASSIGN_OR_RETURN(auto bundle, _bundle_metadata_group.Do(path, [&]() { return load_bundle_tablet_metadata(path); }));
+    auto iter = bundle->tablet_metas().find(tablet_id);
+    if (iter == bundle->tablet_metas().end()) {
+        return Status::NotFound(fmt::format("tablet {} not found in {}", tablet_id, path));
+    }
+    TRACE("end read bundle tablet metadata");
+    return std::make_shared<TabletMetadataPB>(iter->second);
+}
+
 StatusOr<TabletMetadataPtr> TabletManager::load_tablet_metadata(std::shared_ptr<FileSystem> fs,
                                                                 const string& metadata_location, bool fill_cache) {
     TEST_ERROR_POINT("TabletManager::load_tablet_metadata");
@@ -260,7 +315,14 @@ StatusOr<TabletMetadataPtr> TabletManager::get_tablet_metadata(int64_t tablet_id
             return tablet_metadata;
         }
     }
-    return get_tablet_metadata(tablet_metadata_location(tablet_id, version), fill_cache);
+    auto res = get_tablet_metadata(tablet_metadata_location(tablet_id, version), fill_cache);
+    if (res.status().is_not_found() && version > kInitialVersion) {
+        auto bundle_res = get_tablet_metadata_from_bundle(tablet_id, version);
+        if (bundle_res.ok() || !bundle_res.status().is_not_found()) {
+            return bundle_res;
+        }
+    }
+    return res;
 }
 
 StatusOr<TabletMetadataPtr> TabletManager::get_tablet_metadata(const string& path, bool fill_cache) {
@@ -299,7 +361,14 @@ Status TabletManager::tablet_metadata_exists(int64_t tablet_id, int64_t version)
             return status;
         }
     }
-    return tablet_metadata_exists(tablet_metadata_location(tablet_id, version));
+    auto status = tablet_metadata_exists(tablet_metadata_location(tablet_id, version));
+    if (status.is_not_found() && version > kInitialVersion) {
+        auto bundle_res = get_tablet_metadata_from_bundle(tablet_id, version);
+        if (bundle_res.ok() || !bundle_res.status().is_not_found()) {
+            return bundle_res.status();
+        }
+    }
+    return status;
 }
 
 Status TabletManager::tablet_metadata_exists(const std::string& path) {
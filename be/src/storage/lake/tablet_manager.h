@@ -17,6 +17,7 @@
 #include <bthread/types.h>
 
 #include <shared_mutex>
+#include <span>
 #include <variant>
 
 #include "common/statusor.h"
@@ -30,6 +31,7 @@
 #include "util/bthreads/single_flight.h"
 
 namespace starrocks {
+class BundleTabletMetadataPB;
 struct FileInfo;
 class Segment;
 class TabletSchemaPB;
@@ -78,6 +80,11 @@ public:
 
     Status put_tablet_metadata(const TabletMetadataPtr& metadata);
 
+    // Writes the tablet metadata of the same version of many tablets with one object per metadata root location
+    // instead of one object per tablet, see `get_tablet_metadata(int64_t, int64_t, bool)`.
+    Status put_bundle_tablet_metadata(std::span<const TabletMetadataPtr> metadatas);
+
+    // Reads the bundle of the tablet metadata if there is no single object of the version of the tablet.
     StatusOr<TabletMetadataPtr> get_tablet_metadata(int64_t tablet_id, int64_t version, bool fill_cache = true);
 
     StatusOr<TabletMetadataPtr> get_tablet_metadata(const std::string& path, bool fill_cache = true);
@@ -152,6 +159,8 @@ public:
 
     std::string tablet_initial_metadata_location(int64_t tablet_id) const;
 
+    std::string bundle_tablet_metadata_location(int64_t tablet_id, int64_t version) const;
+
     std::string txn_log_location(int64_t tablet_id, int64_t txn_id) const;
 
     std::string txn_slog_location(int64_t tablet_id, int64_t txn_id) const;
@@ -222,6 +231,8 @@ private:
     StatusOr<TabletMetadataPtr> load_tablet_metadata(const std::string& metadata_location, bool fill_cache);
     StatusOr<TxnLogPtr> load_txn_log(const std::string& txn_log_location, bool fill_cache);
     StatusOr<CombinedTxnLogPtr> load_combined_txn_log(const std::string& path, bool fill_cache);
+    StatusOr<std::shared_ptr<const BundleTabletMetadataPB>> load_bundle_tablet_metadata(const std::string& path);
+    StatusOr<TabletMetadataPtr> get_tablet_metadata_from_bundle(int64_t tablet_id, int64_t version);
 
     std::shared_ptr<LocationProvider> _location_provider;
     std::unique_ptr<Metacache> _metacache;
@@ -233,6 +244,8 @@ private:
 
     bthreads::singleflight::Group<std::string, StatusOr<TabletSchemaPtr>> _schema_group;
     bthreads::singleflight::Group<std::string, StatusOr<CombinedTxnLogPtr>> _combined_txn_log_group;
+    bthreads::singleflight::Group<std::string, StatusOr<std::shared_ptr<const BundleTabletMetadataPB>>>
+            _bundle_metadata_group;
 };
 
 } // namespace starrocks::lake
@@ -490,7 +490,9 @@ Status TabletReader::init_collector(const TabletReaderParams& params) {
                     seg_iters,
                     (keys_type == PRIMARY_KEYS) && StorageEngine::instance()->enable_light_pk_compaction_publish());
         }
-    } else if (params.sorted_by_keys_per_tablet && (keys_type == DUP_KEYS || keys_type == PRIMARY_KEYS) &&
+    } else if (params.sorted_by_keys_per_tablet &&
+               (keys_type == DUP_KEYS || keys_type == PRIMARY_KEYS || (keys_type == UNIQUE_KEYS && skip_aggr) ||
+                (keys_type == AGG_KEYS && skip_aggr)) &&
                seg_iters.size() > 1) {
         if (params.profile != nullptr && (params.is_pipeline || params.profile->parent() != nullptr)) {
             RuntimeProfile* p;
@@ -110,6 +110,10 @@ public:
     // and the data written after it.
     virtual Status flush(SegmentPB* segment = nullptr) = 0;
 
+    // Same as `flush()`, but the segment files may still be written out in the background when it returns, they are
+    // in `files()` after a following `flush()` or `finish()`.
+    virtual Status flush_async(SegmentPB* segment = nullptr) { return flush(segment); }
+
     // Flushes partial columns data when current columns are written finished.
     //
     // For vertical writer.
@@ -135,7 +135,8 @@ StatusOr<TxnLogPtr> load_txn_log(TabletManager* tablet_mgr, int64_t tablet_id, c
 } // namespace
 
 StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t tablet_id, int64_t base_version,
-                                            int64_t new_version, std::span<const TxnInfoPB> txns) {
+                                            int64_t new_version, std::span<const TxnInfoPB> txns,
+                                            bool skip_write_tablet_metadata) {
     if (!add_tablet(tablet_id)) {
         return Status::ResourceBusy(
                 fmt::format("The previous publish version task for tablet {} has not finished. You can ignore this "
@@ -372,10 +373,16 @@ StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t t
         }
     }
 
+    // The txn version logs are deleted once applied, so the tablet metadata applied them must be saved right now.
+    bool skip_write = skip_write_tablet_metadata && alter_version == -1 && log_applier->skip_write_tablet_metadata();
+
     // Save new metadata
     RETURN_IF_ERROR(log_applier->finish());
 
-    delete_files_async(std::move(files_to_delete));
+    // Keep the txn logs for the retries until the caller saves the new metadata, they will be deleted by vacuum.
+    if (!skip_write) {
+        delete_files_async(std::move(files_to_delete));
+    }
 
     return new_metadata;
 }
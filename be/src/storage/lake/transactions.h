@@ -44,11 +44,14 @@ class TabletManager;
 // - new_version The new version to be published
 // - txns Transactions to apply in sequence
 // - commit_time New commit timestamp
+// - skip_write_tablet_metadata If true, the new metadata of a non primary key tablet is not persisted in step 5, the
+//   caller must write it, e.g. by TabletManager::put_bundle_tablet_metadata(), and the txn logs are left to vacuum.
 //
 // Return:
 // - StatusOr containing the new published TabletMetadataPtr on success.
 StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t tablet_id, int64_t base_version,
-                                            int64_t new_version, std::span<const TxnInfoPB> txns);
+                                            int64_t new_version, std::span<const TxnInfoPB> txns,
+                                            bool skip_write_tablet_metadata = false);
 
 // Publish a batch new versions of transaction logs.
 //
@@ -368,9 +368,17 @@ public:
     Status finish() override {
         _metadata->GetReflection()->MutableUnknownFields(_metadata.get())->Clear();
         _metadata->set_version(_new_version);
+        if (_skip_write_tablet_metadata) {
+            return Status::OK();
+        }
         return _tablet.put_metadata(_metadata);
     }
 
+    bool skip_write_tablet_metadata() override {
+        _skip_write_tablet_metadata = true;
+        return true;
+    }
+
 private:
     Status apply_write_log(const TxnLogPB_OpWrite& op_write) {
         TEST_ERROR_POINT("NonPrimaryKeyTxnLogApplier::apply_write_log");
@@ -586,6 +594,7 @@ private:
     Tablet _tablet;
     MutableTabletMetadataPtr _metadata;
     int64_t _new_version;
+    bool _skip_write_tablet_metadata = false;
 };
 
 std::unique_ptr<TxnLogApplier> new_txn_log_applier(const Tablet& tablet, MutableTabletMetadataPtr metadata,
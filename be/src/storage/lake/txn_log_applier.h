@@ -39,6 +39,10 @@ public:
 
     virtual Status finish() = 0;
 
+    // Do not write the new tablet metadata in finish(), the caller will write it, e.g. into a bundle.
+    // Returns false if the applier must write the tablet metadata by itself, e.g. of a primary key tablet.
+    virtual bool skip_write_tablet_metadata() { return false; }
+
     void observe_empty_compaction() { _has_empty_compaction = true; }
 
 protected:
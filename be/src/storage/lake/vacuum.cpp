@@ -274,10 +274,11 @@ static Status collect_garbage_files(const TabletMetadataPB& metadata, const std:
     return Status::OK();
 }
 
+// |*vacuumed_versions| is set to the range [first, second) of the versions that are not used by the tablet any more.
 static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_view root_dir, int64_t tablet_id,
                                       int64_t grace_timestamp, int64_t min_retain_version,
                                       AsyncFileDeleter* datafile_deleter, AsyncFileDeleter* metafile_deleter,
-                                      int64_t* total_datafile_size) {
+                                      int64_t* total_datafile_size, std::pair<int64_t, int64_t>* vacuumed_versions) {
     auto t0 = butil::gettimeofday_ms();
     auto meta_dir = join_path(root_dir, kMetadataDirectoryName);
     auto data_dir = join_path(root_dir, kSegmentDirectoryName);
@@ -350,9 +351,11 @@ static Status collect_files_to_vacuum(TabletManager* tablet_mgr, std::string_vie
 
     if (!skip_check_grace_timestamp) {
         // All tablet metadata files encountered were created after the grace timestamp, there were no files to delete
+        *vacuumed_versions = {version + 1, version + 1};
         return Status::OK();
     }
     DCHECK_LE(version, final_retain_version);
+    *vacuumed_versions = {version + 1, final_retain_version};
     for (auto v = version + 1; v < final_retain_version; v++) {
         RETURN_IF_ERROR(metafile_deleter->delete_file(join_path(meta_dir, tablet_metadata_filename(tablet_id, v))));
     }
@@ -369,6 +372,37 @@ static void erase_tablet_metadata_from_metacache(TabletManager* tablet_mgr, cons
     }
 }
 
+// Deletes the bundles of the versions in the range [first, second) if all the tablets in them are in |tablet_ids|.
+// A bundle with other tablets is kept, because the other tablets may still use it.
+static Status vacuum_bundle_tablet_metadata(std::string_view root_dir, const std::vector<int64_t>& tablet_ids,
+                                            std::pair<int64_t, int64_t> versions, int64_t* vacuumed_files) {
+    auto meta_dir = join_path(root_dir, kMetadataDirectoryName);
+    std::vector<std::string> bundles_to_delete;
+    for (auto v = versions.first; v < versions.second; v++) {
+        auto path = join_path(meta_dir, bundle_tablet_metadata_filename(v));
+        BundleTabletMetadataPB bundle;
+        auto st = ProtobufFile(path).load(&bundle, false);
+        if (st.is_not_found()) {
+            continue;
+        } else if (!st.ok()) {
+            return st;
+        }
+        bool all_vacuumed = true;
+        for (const auto& [tablet_id, _] : bundle.tablet_metas()) {
+            all_vacuumed &= std::binary_search(tablet_ids.begin(), tablet_ids.end(), tablet_id);
+        }
+        if (all_vacuumed) {
+            bundles_to_delete.emplace_back(std::move(path));
+        }
+    }
+    if (bundles_to_delete.empty()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(delete_files(bundles_to_delete));
+    (*vacuumed_files) += bundles_to_delete.size();
+    return Status::OK();
+}
+
 static Status vacuum_tablet_metadata(TabletManager* tablet_mgr, std::string_view root_dir,
                                      const std::vector<int64_t>& tablet_ids, int64_t min_retain_version,
                                      int64_t grace_timestamp, int64_t* vacuumed_files, int64_t* vacuumed_file_size) {
@@ -383,17 +417,23 @@ static Status vacuum_tablet_metadata(TabletManager* tablet_mgr, std::string_view
         erase_tablet_metadata_from_metacache(tablet_mgr, files);
     };
 
+    // The bundles of the versions which are not used by any of the tablets.
+    auto bundle_versions = std::pair<int64_t, int64_t>{INT64_MAX, INT64_MAX};
     for (auto tablet_id : tablet_ids) {
         AsyncFileDeleter datafile_deleter(config::lake_vacuum_min_batch_delete_size);
         AsyncFileDeleter metafile_deleter(INT64_MAX, metafile_delete_cb);
+        auto vacuumed_versions = std::pair<int64_t, int64_t>{};
         RETURN_IF_ERROR(collect_files_to_vacuum(tablet_mgr, root_dir, tablet_id, grace_timestamp, min_retain_version,
-                                                &datafile_deleter, &metafile_deleter, vacuumed_file_size));
+                                                &datafile_deleter, &metafile_deleter, vacuumed_file_size,
+                                                &vacuumed_versions));
         RETURN_IF_ERROR(datafile_deleter.finish());
         RETURN_IF_ERROR(metafile_deleter.finish());
         (*vacuumed_files) += datafile_deleter.delete_count();
         (*vacuumed_files) += metafile_deleter.delete_count();
+        bundle_versions.first = std::min(bundle_versions.first, vacuumed_versions.first);
+        bundle_versions.second = std::min(bundle_versions.second, vacuumed_versions.second);
     }
-    return Status::OK();
+    return vacuum_bundle_tablet_metadata(root_dir, tablet_ids, bundle_versions, vacuumed_files);
 }
 
 static Status vacuum_txn_log(std::string_view root_location, int64_t min_active_txn_id, int64_t* vacuumed_files,
@@ -573,7 +613,13 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
         }
     }
 
+    std::vector<std::string> bundles;
+    std::vector<std::string> bundles_to_delete;
     RETURN_IF_ERROR(ignore_not_found(fs->iterate_dir(meta_dir, [&](std::string_view name) {
+        if (is_bundle_tablet_metadata(name)) {
+            bundles.emplace_back(name);
+            return true;
+        }
         if (!is_tablet_metadata(name)) {
             return true;
         }
@@ -586,6 +632,31 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
         return true;
     })));
 
+    // The versions of the tablets in the bundles, the bundle is deleted if all the tablets in it are deleted.
+    for (const auto& name : bundles) {
+        auto path = join_path(meta_dir, name);
+        auto version = parse_bundle_tablet_metadata_filename(name);
+        BundleTabletMetadataPB bundle;
+        auto st = ProtobufFile(path).load(&bundle, false);
+        if (st.is_not_found()) {
+            continue;
+        } else if (!st.ok()) {
+            return st;
+        }
+        bool all_deleted = true;
+        for (const auto& [tablet_id, _] : bundle.tablet_metas()) {
+            if (std::binary_search(tablet_ids.begin(), tablet_ids.end(), tablet_id)) {
+                // The single metadata file of the same version may exist as well, it's not a duplicate.
+                tablet_versions[tablet_id].insert(version);
+            } else {
+                all_deleted = false;
+            }
+        }
+        if (all_deleted) {
+            bundles_to_delete.emplace_back(std::move(path));
+        }
+    }
+
     for (auto& [tablet_id, versions] : tablet_versions) {
         DCHECK(!versions.empty());
 
@@ -634,6 +705,11 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
         }
     }
 
+    // Deleted at last, the tablet metadata above may be read from them.
+    for (auto& path : bundles_to_delete) {
+        RETURN_IF_ERROR(deleter.delete_file(std::move(path)));
+    }
+
     return deleter.finish();
 }
 
@@ -697,7 +773,8 @@ static StatusOr<std::list<std::string>> list_meta_files(FileSystem* fs, const st
     std::list<std::string> meta_files;
     RETURN_IF_ERROR_WITH_WARN(ignore_not_found(fs->iterate_dir(metadata_root_location,
                                                                [&](std::string_view name) {
-                                                                   if (!is_tablet_metadata(name)) {
+                                                                   if (!is_tablet_metadata(name) &&
+                                                                       !is_bundle_tablet_metadata(name)) {
                                                                        return true;
                                                                    }
                                                                    meta_files.emplace_back(name);
@@ -771,6 +848,26 @@ static StatusOr<std::map<std::string, DirEntry>> find_orphan_data_files(FileSyst
     int64_t progress = 0;
     for (const auto& name : meta_files) {
         auto location = join_path(metadata_root_location, name);
+        if (is_bundle_tablet_metadata(name)) {
+            BundleTabletMetadataPB bundle;
+            auto st = ProtobufFile(location).load(&bundle, false);
+            if (st.is_not_found()) { // This bundle meta file was deleted by another node
+                LOG(INFO) << location << " is deleted by other node";
+                continue;
+            } else if (!st.ok()) {
+                LOG(WARNING) << "Failed to get bundle meta file: " << location << ", status: " << st;
+                continue;
+            }
+            for (const auto& [tablet_id, metadata] : bundle.tablet_metas()) {
+                for (const auto& rowset : metadata.rowsets()) {
+                    check_rowset(rowset);
+                }
+            }
+            ++progress;
+            LOG(INFO) << "Filtered with bundle meta file: " << name << " (" << progress << '/' << meta_files.size()
+                      << ')';
+            continue;
+        }
         auto res = get_tablet_metadata(location, false);
         if (res.status().is_not_found()) { // This metadata file was deleted by another node
             LOG(INFO) << location << " is deleted by other node";
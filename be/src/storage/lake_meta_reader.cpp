@@ -77,14 +77,14 @@ Status LakeMetaReader::_build_collect_context(const lake::VersionedTablet& table
         // get result slot id
         _collect_context.result_slot_ids.emplace_back(it.first);
 
-        // only collect the field of dict need read data page
-        // others just depend on footer
-        if (collect_field == "dict_merge") {
+        // only collect the field of dict and the not-null count of the pages which have nulls need read
+        // data page, others just depend on footer
+        if (collect_field == "dict_merge" || collect_field == "nonnull_count") {
             _collect_context.seg_collecter_params.read_page.emplace_back(true);
         } else {
             _collect_context.seg_collecter_params.read_page.emplace_back(false);
         }
-        _has_count_agg |= (collect_field == "count");
+        _has_count_agg |= (collect_field == "count" || collect_field == "nonnull_count");
     }
     _collect_context.seg_collecter_params.tablet_schema = tablet_schema;
     return Status::OK();
@@ -19,11 +19,13 @@
 #include "column/binary_column.h"
 #include "column/json_column.h"
 #include "common/logging.h"
+#include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/mem_tracker.h"
 #include "storage/chunk_helper.h"
 #include "storage/memtable_sink.h"
 #include "storage/primary_key_encoder.h"
@@ -121,7 +123,49 @@ MemTable::MemTable(int64_t tablet_id, const Schema* schema, MemTableSink* sink,
     _init_aggregator_if_needed();
 }
 
-MemTable::~MemTable() = default;
+void MemTableChunkRecycler::recycle(ChunkPtr chunk) {
+    // the columns may still be referenced by others, or have been moved out by a rolling append
+    if (chunk == nullptr || chunk.use_count() > 1) {
+        return;
+    }
+    for (const auto& column : chunk->columns()) {
+        if (column == nullptr || column.use_count() > 1) {
+            return;
+        }
+    }
+    const size_t bytes = chunk->memory_usage();
+    if (bytes > static_cast<size_t>(std::max<int64_t>(config::memtable_recycle_chunk_max_bytes, 0))) {
+        return;
+    }
+    if (_mem_tracker != nullptr && _mem_tracker->any_limit_exceeded_precheck(bytes)) {
+        return;
+    }
+    chunk->reset();
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_chunk == nullptr) {
+        _chunk = std::move(chunk);
+        _chunk_bytes = bytes;
+    }
+}
+
+ChunkPtr MemTableChunkRecycler::acquire() {
+    std::lock_guard<std::mutex> l(_mutex);
+    _chunk_bytes = 0;
+    return std::move(_chunk);
+}
+
+size_t MemTableChunkRecycler::recycled_bytes() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _chunk_bytes;
+}
+
+MemTable::~MemTable() {
+    // the result chunk has the same columns as the insert chunk unless the op column has been split out
+    if (_chunk_recycler != nullptr && _result_chunk != nullptr &&
+        _result_chunk->num_columns() == _vectorized_schema->num_fields()) {
+        _chunk_recycler->recycle(std::move(_result_chunk));
+    }
+}
 
 size_t MemTable::memory_usage() const {
     size_t size = 0;
@@ -163,7 +207,20 @@ bool MemTable::check_supported_column_partial_update(const Chunk& chunk) {
 
 StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size) {
     if (_chunk == nullptr) {
-        _chunk = ChunkHelper::new_chunk(*_vectorized_schema, 0);
+        if (_chunk_recycler != nullptr) {
+            _chunk = _chunk_recycler->acquire();
+        }
+        if (_chunk == nullptr) {
+            _chunk = ChunkHelper::new_chunk(*_vectorized_schema, 0);
+        }
+        if (config::memtable_max_sorted_runs > 0 && _merge_condition.empty()) {
+            // the first sort of the inserted rows is by primary key for PK tables, otherwise by sort key
+            auto sort_key_idxes = _sort_key_idxes(_keys_type != KeysType::PRIMARY_KEYS);
+            if (sort_key_idxes.ok()) {
+                _sorted_run_key_idxes = std::move(sort_key_idxes).value();
+                _track_sorted_runs = true;
+            }
+        }
     }
 
     bool is_column_with_row = false;
@@ -215,6 +272,8 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
         }
     }
 
+    _update_sorted_runs(cur_row_count);
+
     if (chunk.has_rows()) {
         _chunk_memory_usage += chunk.memory_usage() * size / chunk.num_rows();
         _chunk_bytes_usage += _chunk->bytes_usage(cur_row_count, size);
@@ -259,6 +318,7 @@ Status MemTable::finalize() {
             }
 
             if (_merge_count > 1) {
+                _track_sorted_runs = false;
                 _chunk = _aggregator->aggregate_result();
                 _aggregator->aggregate_reset();
 
@@ -304,6 +364,7 @@ Status MemTable::finalize() {
                 if (std::mismatch(sort_key_idxes.begin(), sort_key_idxes.end(), primary_key_idxes.begin(),
                                   primary_key_idxes.end())
                             .first != sort_key_idxes.end()) {
+                    _track_sorted_runs = false;
                     _chunk = _result_chunk;
                     RETURN_IF_ERROR(_sort(true, true));
                 }
@@ -410,8 +471,22 @@ Status MemTable::_sort(bool is_final, bool by_sort_key) {
     if (_keys_type != KeysType::PRIMARY_KEYS) {
         by_sort_key = true;
     }
-    RETURN_IF_ERROR(_sort_column_inc(by_sort_key));
-    if (is_final) {
+    ASSIGN_OR_RETURN(auto sort_key_idxes, _sort_key_idxes(by_sort_key));
+    bool in_order = false;
+    if (_track_sorted_runs && sort_key_idxes == _sorted_run_key_idxes) {
+        in_order = _sorted_run_starts.empty();
+        RETURN_IF_ERROR(_merge_sorted_runs());
+    } else {
+        RETURN_IF_ERROR(_sort_column_inc(sort_key_idxes));
+    }
+    _reset_sorted_runs();
+    if (in_order) {
+        // the rows are inserted in order, e.g. loading sorted files, take them as the result instead of copying
+        _result_chunk = std::move(_chunk);
+        if (!is_final) {
+            _chunk = _result_chunk->clone_empty_with_schema(0);
+        }
+    } else if (is_final) {
         // No need to reserve, it will be reserve in IColumn::append_selective(),
         // Otherwise it will use more peak memory
         _result_chunk = _chunk->clone_empty_with_schema(0);
@@ -485,8 +560,7 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
     return Status::OK();
 }
 
-Status MemTable::_sort_column_inc(bool by_sort_key) {
-    Columns columns;
+StatusOr<std::vector<ColumnId>> MemTable::_sort_key_idxes(bool by_sort_key) const {
     std::vector<ColumnId> sort_key_idxes;
     if (by_sort_key) {
         sort_key_idxes = _vectorized_schema->sort_key_idxes();
@@ -514,7 +588,11 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
             sort_key_idxes.push_back(i);
         }
     }
+    return sort_key_idxes;
+}
 
+Status MemTable::_sort_column_inc(const std::vector<ColumnId>& sort_key_idxes) {
+    Columns columns;
     for (auto sort_key_idx : sort_key_idxes) {
         columns.push_back(_chunk->get_column_by_index(sort_key_idx));
     }
@@ -534,4 +612,116 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
     return st;
 }
 
+void MemTable::_update_sorted_runs(size_t begin) {
+    if (!_track_sorted_runs) {
+        return;
+    }
+    Columns columns;
+    for (auto sort_key_idx : _sorted_run_key_idxes) {
+        columns.push_back(_chunk->get_column_by_index(sort_key_idx));
+    }
+    const size_t num_rows = _chunk->num_rows();
+    for (size_t row = std::max<size_t>(begin, 1); row < num_rows; row++) {
+        int cmp = 0;
+        for (const auto& column : columns) {
+            // null first, the same as the sort
+            cmp = column->compare_at(row - 1, row, *column, -1);
+            if (cmp != 0) {
+                break;
+            }
+        }
+        if (cmp <= 0) {
+            continue;
+        }
+        if (_sorted_run_starts.size() + 1 >= static_cast<size_t>(config::memtable_max_sorted_runs)) {
+            // too many runs, a full sort is cheaper than merging them
+            _track_sorted_runs = false;
+            _sorted_run_starts.clear();
+            return;
+        }
+        _sorted_run_starts.push_back(static_cast<uint32_t>(row));
+    }
+}
+
+Status MemTable::_merge_sorted_runs() {
+    DCHECK_EQ(_chunk->num_rows(), _permutations.size());
+    if (_sorted_run_starts.empty()) {
+        // the rows are inserted in order, the identity permutation is the result
+        return Status::OK();
+    }
+
+    struct Run {
+        Columns keys;
+        // the rows of `_chunk` in the order of `keys`
+        std::vector<uint32_t> rows;
+    };
+    std::vector<Run> runs;
+    runs.reserve(_sorted_run_starts.size() + 1);
+    for (size_t i = 0; i <= _sorted_run_starts.size(); i++) {
+        uint32_t begin = i == 0 ? 0 : _sorted_run_starts[i - 1];
+        uint32_t end = i == _sorted_run_starts.size() ? _chunk->num_rows() : _sorted_run_starts[i];
+        auto& run = runs.emplace_back();
+        for (auto sort_key_idx : _sorted_run_key_idxes) {
+            const auto& column = _chunk->get_column_by_index(sort_key_idx);
+            ColumnPtr key = column->clone_empty();
+            key->append(*column, begin, end - begin);
+            run.keys.push_back(std::move(key));
+        }
+        run.rows.resize(end - begin);
+        std::iota(run.rows.begin(), run.rows.end(), begin);
+    }
+
+    auto to_sorted_run = [](const Columns& keys) {
+        auto chunk = std::make_shared<Chunk>();
+        for (size_t i = 0; i < keys.size(); i++) {
+            chunk->append_column(keys[i], static_cast<SlotId>(i));
+        }
+        return SortedRun(chunk, keys);
+    };
+    const auto sort_descs = SortDescs::asc_null_first(_sorted_run_key_idxes.size());
+    Permutation perm;
+    // Merge the adjacent runs level by level, the left run always holds the earlier rows and wins the ties,
+    // so the result is the same as the stable sort.
+    while (runs.size() > 1) {
+        const bool last_level = runs.size() == 2;
+        std::vector<Run> merged_runs;
+        merged_runs.reserve((runs.size() + 1) / 2);
+        for (size_t i = 0; i + 1 < runs.size(); i += 2) {
+            auto& left = runs[i];
+            auto& right = runs[i + 1];
+            RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_descs, to_sorted_run(left.keys),
+                                                        to_sorted_run(right.keys), &perm));
+            auto& merged = merged_runs.emplace_back();
+            merged.rows.resize(perm.size());
+            for (size_t j = 0; j < perm.size(); j++) {
+                const auto& rows = perm[j].chunk_index == 0 ? left.rows : right.rows;
+                merged.rows[j] = rows[perm[j].index_in_chunk];
+            }
+            if (!last_level) {
+                for (size_t k = 0; k < left.keys.size(); k++) {
+                    ColumnPtr key = left.keys[k]->clone_empty();
+                    materialize_column_by_permutation(key.get(), {left.keys[k], right.keys[k]}, perm);
+                    merged.keys.push_back(std::move(key));
+                }
+            }
+        }
+        if (runs.size() % 2 == 1) {
+            merged_runs.push_back(std::move(runs.back()));
+        }
+        runs.swap(merged_runs);
+    }
+
+    const auto& rows = runs[0].rows;
+    DCHECK_EQ(rows.size(), _permutations.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        _permutations[i].index_in_chunk = rows[i];
+    }
+    return Status::OK();
+}
+
+void MemTable::_reset_sorted_runs() {
+    _sorted_run_starts.clear();
+    _track_sorted_runs = !_sorted_run_key_idxes.empty();
+}
+
 } // namespace starrocks
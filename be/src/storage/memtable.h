@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <ostream>
 
 #include "column/chunk.h"
@@ -30,6 +32,29 @@ class TabletSchema;
 
 class MemTableSink;
 
+// MemTableChunkRecycler keeps the result chunk of a flushed memtable, so that the next memtable of the
+// same writer appends rows to its column buffers instead of allocating them from scratch. It is shared by
+// the writer and its memtables, which are released on the flush threads.
+class MemTableChunkRecycler {
+public:
+    explicit MemTableChunkRecycler(MemTracker* mem_tracker) : _mem_tracker(mem_tracker) {}
+
+    // Keep `chunk` for reuse if no other chunk is kept, it is not larger than
+    // `memtable_recycle_chunk_max_bytes`, and keeping it leaves the memory limits room for another one.
+    void recycle(ChunkPtr chunk);
+
+    // Return the kept chunk with no rows, or nullptr if there is none.
+    ChunkPtr acquire();
+
+    size_t recycled_bytes() const;
+
+private:
+    MemTracker* _mem_tracker;
+    mutable std::mutex _mutex;
+    ChunkPtr _chunk;
+    size_t _chunk_bytes = 0;
+};
+
 class MemTable {
 public:
     MemTable(int64_t tablet_id, const Schema* schema, const std::vector<SlotDescriptor*>* slot_descs,
@@ -64,6 +89,12 @@ public:
 
     void set_write_buffer_row(size_t max_buffer_row) { _max_buffer_row = max_buffer_row; }
 
+    // The first insert takes the chunk kept by `recycler`, and the result chunk is handed back to it
+    // when the memtable is released.
+    void set_chunk_recycler(std::shared_ptr<MemTableChunkRecycler> recycler) {
+        _chunk_recycler = std::move(recycler);
+    }
+
     static Schema convert_schema(const TabletSchemaCSPtr& tablet_schema,
                                  const std::vector<SlotDescriptor*>* slot_descs);
 
@@ -75,7 +106,13 @@ private:
     Status _merge();
 
     Status _sort(bool is_final, bool by_sort_key = false);
-    Status _sort_column_inc(bool by_sort_key = false);
+    StatusOr<std::vector<ColumnId>> _sort_key_idxes(bool by_sort_key) const;
+    Status _sort_column_inc(const std::vector<ColumnId>& sort_key_idxes);
+    // Record where the rows appended from `begin` break the sorted order of `_chunk`.
+    void _update_sorted_runs(size_t begin);
+    // Build `_permutations` by merging the sorted runs of `_chunk`.
+    Status _merge_sorted_runs();
+    void _reset_sorted_runs();
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     void _init_aggregator_if_needed();
@@ -90,6 +127,13 @@ private:
     SmallPermutation _permutations;
     std::vector<uint32_t> _selective_values;
 
+    // Start rows of the sorted runs of `_chunk` in insertion order, except the first run starting at row 0.
+    std::vector<uint32_t> _sorted_run_starts;
+    // The columns the first sort of the inserted rows orders by.
+    std::vector<ColumnId> _sorted_run_key_idxes;
+    // False if the rows of `_chunk` form too many runs, or `_chunk` doesn't hold the inserted rows.
+    bool _track_sorted_runs = false;
+
     int64_t _tablet_id;
 
     const Schema* _vectorized_schema;
@@ -115,6 +159,8 @@ private:
     size_t _total_rows = 0;
     size_t _merged_rows = 0;
 
+    std::shared_ptr<MemTableChunkRecycler> _chunk_recycler;
+
     // memory statistic
     MemTracker* _mem_tracker = nullptr;
     // memory usage and bytes usage calculation cost of object column is high,
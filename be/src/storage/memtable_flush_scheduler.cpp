@@ -0,0 +1,67 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/memtable_flush_scheduler.h"
+
+#include <algorithm>
+
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+int64_t MemTableFlushScheduler::bytes_to_release(const MemTracker* tracker, int64_t ratio) {
+    if (tracker == nullptr || tracker->limit() <= 0 || ratio <= 0) {
+        return 0;
+    }
+    return std::max<int64_t>(tracker->consumption() - tracker->limit() * ratio / 100, 0);
+}
+
+std::vector<size_t> MemTableFlushScheduler::pick(const std::vector<Candidate>& candidates, int64_t bytes_to_release,
+                                                 int64_t min_flush_bytes, int64_t now) {
+    std::vector<size_t> picked;
+    if (bytes_to_release <= 0) {
+        return picked;
+    }
+    for (size_t i = 0; i < candidates.size(); i++) {
+        const auto& candidate = candidates[i];
+        if (candidate.last_write_ts > 0 && candidate.queueing_memtables == 0 && candidate.write_buffer_size > 0 &&
+            candidate.write_buffer_size >= min_flush_bytes) {
+            picked.push_back(i);
+        }
+    }
+    auto is_idle = [now](const Candidate& candidate) { return now - candidate.last_write_ts > 1; };
+    std::sort(picked.begin(), picked.end(), [&](size_t lhs, size_t rhs) {
+        const auto& l = candidates[lhs];
+        const auto& r = candidates[rhs];
+        if (is_idle(l) != is_idle(r)) {
+            return is_idle(l);
+        }
+        if (l.write_buffer_size != r.write_buffer_size) {
+            return l.write_buffer_size > r.write_buffer_size;
+        }
+        if (l.flushed_segments != r.flushed_segments) {
+            return l.flushed_segments < r.flushed_segments;
+        }
+        return lhs < rhs;
+    });
+    int64_t released = 0;
+    size_t num_picked = 0;
+    while (num_picked < picked.size() && released < bytes_to_release) {
+        released += candidates[picked[num_picked++]].write_buffer_size;
+    }
+    picked.resize(num_picked);
+    return picked;
+}
+
+} // namespace starrocks
@@ -0,0 +1,55 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace starrocks {
+
+class MemTracker;
+
+// MemTableFlushScheduler decides which memtables of a load to flush when the load memory usage is high.
+// Without it, the writer hitting the memory limit flushes its own memtable, whatever its size, which
+// produces many small segments to be compacted later. The scheduler flushes the memtables that release
+// the most memory with the fewest segments before the limit is reached:
+//   1. memtables not written in the last second first, because they won't grow any more;
+//   2. then larger memtables first;
+//   3. then memtables of the tablets which have flushed fewer segments in this load first.
+// Memtables smaller than `min_flush_bytes` or already having a memtable in the flush queue are skipped,
+// they are left to grow or to be flushed by the writers at the memory limit.
+class MemTableFlushScheduler {
+public:
+    struct Candidate {
+        int64_t write_buffer_size = 0;
+        // seconds since epoch of the last write, 0 if never written
+        int64_t last_write_ts = 0;
+        // the number of segments flushed by the writer
+        int64_t flushed_segments = 0;
+        int64_t queueing_memtables = 0;
+    };
+
+    // Return the bytes to release to bring the consumption of `tracker` down to `ratio` percent of its limit,
+    // 0 if it is under that or has no limit.
+    static int64_t bytes_to_release(const MemTracker* tracker, int64_t ratio);
+
+    // Return the indexes of the `candidates` to flush in order, which release at least `bytes_to_release`
+    // bytes in total if possible.
+    static std::vector<size_t> pick(const std::vector<Candidate>& candidates, int64_t bytes_to_release,
+                                    int64_t min_flush_bytes, int64_t now);
+};
+
+} // namespace starrocks
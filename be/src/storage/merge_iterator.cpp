@@ -16,13 +16,16 @@
 
 #include <boost/heap/skew_heap.hpp>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <vector>
 
 #include "column/chunk.h"
+#include "column/column_helper.h"
 #include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "storage/chunk_helper.h"
+#include "util/loser_tree.h"
 
 namespace starrocks {
 
@@ -89,41 +92,74 @@ public:
         _rssid_rowids = std::move(rssid_rowids);
     }
 
+    // The prefixes of the first sort key of the rows, see ColumnHelper::encode_sort_key_prefixes(), or nullptr.
+    void set_key_prefixes(const uint64_t* key_prefixes) { _key_prefixes = key_prefixes; }
+
     bool operator>(const ComparableChunk& rhs) const {
         DCHECK_EQ(_key_columns, rhs._key_columns);
-        int r = compare_chunk(_key_columns, _sort_key_idxes, *_chunk, _compared_row, *rhs._chunk, rhs._compared_row,
-                              _merge_condition);
+        int r = compare_row(_compared_row, rhs, rhs._compared_row);
         return (r > 0) | ((r == 0) & (_order > rhs._order));
     }
 
     // return true iff all rows in |this| chunk are less than those in |rhs|, i.e, if
     // last row in |this| chunk is less than the first row in |rhs|.
     // assume both |this| and |rhs| are not empty.
-    bool less_than_all(const ComparableChunk& rhs) {
+    bool less_than_all(const ComparableChunk& rhs) const {
         size_t last_row = _chunk->num_rows() - 1;
         return less_than(last_row, rhs);
     }
 
     // return the next row number of last row whose key value is less than all values in |rhs|
-    size_t last_row_less_than(const ComparableChunk& rhs, size_t limit_num) {
+    size_t last_row_less_than(const ComparableChunk& rhs, size_t limit_num) const {
         // As we previously pop this chunk from the heap top, `_compared_row` in this chunk
         // must be less than all rows in rhs, thus here we start comparision from _compared_row + 1;
         size_t next_compare_row = _compared_row + 1;
         size_t upper_bound = std::min(_compared_row + limit_num, _chunk->num_rows());
-        while (next_compare_row < upper_bound && less_than(next_compare_row, rhs)) {
-            next_compare_row++;
+        // The rows less than |rhs| are a prefix of the sorted rows, which is found by galloping then a binary
+        // search: a short run still takes few comparisons, and a long one log(n) instead of n.
+        size_t step = 1;
+        size_t not_less_row = upper_bound;
+        while (next_compare_row < upper_bound) {
+            size_t probe_row = std::min(next_compare_row + step - 1, upper_bound - 1);
+            if (!less_than(probe_row, rhs)) {
+                not_less_row = probe_row;
+                break;
+            }
+            next_compare_row = probe_row + 1;
+            step *= 2;
+        }
+        while (next_compare_row < not_less_row) {
+            size_t mid_row = next_compare_row + (not_less_row - next_compare_row) / 2;
+            if (less_than(mid_row, rhs)) {
+                next_compare_row = mid_row + 1;
+            } else {
+                not_less_row = mid_row;
+            }
         }
         return next_compare_row;
     }
 
-    bool less_than(size_t lhs_row, const ComparableChunk& rhs) {
-        int r = compare_chunk(_key_columns, _sort_key_idxes, *_chunk, lhs_row, *rhs._chunk, rhs._compared_row,
-                              _merge_condition);
+    bool less_than(size_t lhs_row, const ComparableChunk& rhs) const {
+        int r = compare_row(lhs_row, rhs, rhs._compared_row);
         return (r < 0) | ((r == 0) & (_order < rhs._order));
     }
 
 private:
     friend class HeapMergeIterator;
+    friend class LoserTreeMergeIterator;
+
+    int compare_row(size_t lhs_row, const ComparableChunk& rhs, size_t rhs_row) const {
+        // The rows of different prefixes are ordered by them, only the ones of the same prefix are compared
+        // column by column.
+        if (_key_prefixes != nullptr && rhs._key_prefixes != nullptr) {
+            uint64_t lhs_prefix = _key_prefixes[lhs_row];
+            uint64_t rhs_prefix = rhs._key_prefixes[rhs_row];
+            if (lhs_prefix != rhs_prefix) {
+                return lhs_prefix < rhs_prefix ? -1 : 1;
+            }
+        }
+        return compare_chunk(_key_columns, _sort_key_idxes, *_chunk, lhs_row, *rhs._chunk, rhs_row, _merge_condition);
+    }
 
     // used to determinate the order of two rows when their key columns are all equals.
     uint16_t _order;
@@ -131,6 +167,7 @@ private:
     std::vector<uint32_t> _sort_key_idxes;
     std::string _merge_condition;
     std::shared_ptr<std::vector<uint64_t>> _rssid_rowids;
+    const uint64_t* _key_prefixes = nullptr;
 };
 
 class MergeIterator : public ChunkIterator {
@@ -138,7 +175,8 @@ public:
     explicit MergeIterator(std::vector<ChunkIteratorPtr> children)
             : ChunkIterator(children[0]->schema(), children[0]->chunk_size()),
               _children(std::move(children)),
-              _chunk_pool(_children.size()) {
+              _chunk_pool(_children.size()),
+              _key_prefixes(_children.size()) {
 #ifndef NDEBUG
         // ensure that the children's schemas are all the same.
         for (size_t i = 1; i < _children.size(); i++) {
@@ -178,8 +216,12 @@ protected:
 
     virtual Status fill(size_t child) = 0;
 
+    // Encodes the key prefixes of the chunk of |child|, returns nullptr if the first sort key has no encoding.
+    const uint64_t* encode_key_prefixes(size_t child);
+
     std::vector<ChunkIteratorPtr> _children;
     std::vector<ChunkPtr> _chunk_pool;
+    std::vector<std::vector<uint64_t>> _key_prefixes;
     size_t _merged_rows = 0;
     bool _inited = false;
 };
@@ -197,6 +239,19 @@ inline Status MergeIterator::init() {
     return Status::OK();
 }
 
+inline const uint64_t* MergeIterator::encode_key_prefixes(size_t child) {
+    const auto& sort_key_idxes = _schema.sort_key_idxes();
+    if (sort_key_idxes.empty()) {
+        return nullptr;
+    }
+    // The keys of the storage are ascending and the nulls are first.
+    const ColumnPtr& column = _chunk_pool[child]->get_column_by_index(sort_key_idxes[0]);
+    if (!ColumnHelper::encode_sort_key_prefixes(*column, true, true, &_key_prefixes[child])) {
+        return nullptr;
+    }
+    return _key_prefixes[child].data();
+}
+
 inline void MergeIterator::close_child(size_t child) {
     if (_chunk_pool[child] == nullptr) {
         return;
@@ -214,6 +269,7 @@ inline void MergeIterator::close() {
     }
     _children.clear();
     _chunk_pool.clear();
+    _key_prefixes.clear();
 }
 
 class HeapMergeIterator final : public MergeIterator {
@@ -354,13 +410,177 @@ inline Status HeapMergeIterator::fill(size_t child) {
             return Status::InternalError(strings::Substitute(
                     "Merge iterator only supports merging chunks with rows less than $0", max_merge_chunk_size));
         }
+        ComparableChunk comparable_chunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(),
+                                         merge_condition};
         if (need_rssid_rowids) {
-            _heap.push(ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(),
-                                       merge_condition, std::move(rssid_rowids)});
+            comparable_chunk._rssid_rowids = std::move(rssid_rowids);
+        }
+        comparable_chunk.set_key_prefixes(encode_key_prefixes(child));
+        _heap.push(std::move(comparable_chunk));
+    } else if (st.is_end_of_file()) {
+        // ignore Status::EndOfFile.
+        close_child(child);
+    } else {
+        close_child(child);
+        return st;
+    }
+    return Status::OK();
+}
+
+// Merges the children by a loser tree. The rows of the winner are output in runs up to the current row of the
+// runner-up, and the tree is replayed once per run instead of once per row.
+class LoserTreeMergeIterator final : public MergeIterator {
+public:
+    explicit LoserTreeMergeIterator(std::vector<ChunkIteratorPtr> children)
+            : MergeIterator(std::move(children)), _chunks(_children.size()) {}
+
+    std::string merge_condition;
+
+    // In PK table compaction, we need to get chunk and each row's rssid & rowid
+    bool need_rssid_rowids = false;
+
+protected:
+    Status do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks,
+                       std::vector<uint64_t>* rssid_rowids) override;
+    Status do_get_next(Chunk* chunk) override { return do_get_next(chunk, nullptr, nullptr); }
+    Status do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks) override {
+        return do_get_next(chunk, source_masks, nullptr);
+    }
+    Status do_get_next(Chunk* chunk, std::vector<uint64_t>* rssid_rowids) override {
+        return do_get_next(chunk, nullptr, rssid_rowids);
+    }
+    Status fill(size_t child) override;
+
+private:
+    struct ChunkLess {
+        const std::vector<std::optional<ComparableChunk>>* chunks;
+
+        bool operator()(size_t lhs, size_t rhs) const {
+            const ComparableChunk& lhs_chunk = *(*chunks)[lhs];
+            return lhs_chunk.less_than(lhs_chunk.compared_row(), *(*chunks)[rhs]);
+        }
+    };
+    using ChunkTree = LoserTree<ChunkLess>;
+
+    // Fills |child| after its chunk is consumed, and replays the tree.
+    Status refill(size_t child);
+
+    // The current chunk of each child, nullopt if the child is exhausted.
+    std::vector<std::optional<ComparableChunk>> _chunks;
+    std::unique_ptr<ChunkTree> _tree;
+};
+
+inline Status LoserTreeMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks,
+                                                  std::vector<uint64_t>* rssid_rowids) {
+    if (!_inited) {
+        RETURN_IF_ERROR(init());
+        _tree = std::make_unique<ChunkTree>(_chunks.size(), ChunkLess{&_chunks});
+        for (size_t i = 0; i < _chunks.size(); i++) {
+            if (!_chunks[i].has_value()) {
+                _tree->mark_exhausted(i);
+            }
+        }
+        _tree->build();
+    }
+    size_t rows = 0;
+    Status st;
+
+    while (!_tree->empty() && rows < _chunk_size) {
+        size_t child = _tree->winner();
+        ComparableChunk& min_chunk = *_chunks[child];
+        DCHECK_GT(min_chunk.remaining_rows(), 0);
+
+        size_t offset = min_chunk.compared_row();
+        size_t append_row_num = 0;
+        size_t runner_up = _tree->runner_up();
+        bool less_than_all = runner_up == ChunkTree::kNone || min_chunk.less_than_all(*_chunks[runner_up]);
+
+        if (less_than_all) {
+            if (offset == 0) {
+                // all keys in |min_chunk| are less than the runner-up and |min_chunk|'s current offset is 0,
+                // so here we swap the whole min_chunk out.
+                if (rows == 0) {
+                    chunk->swap_chunk(*min_chunk._chunk);
+                    if (rssid_rowids != nullptr && need_rssid_rowids) {
+                        DCHECK(min_chunk._rssid_rowids != nullptr);
+                        rssid_rowids->insert(rssid_rowids->end(), min_chunk._rssid_rowids->begin(),
+                                             min_chunk._rssid_rowids->end());
+                    }
+                    if (source_masks) {
+                        source_masks->insert(source_masks->end(), chunk->num_rows(),
+                                             RowSourceMask{min_chunk._order, false});
+                    }
+                    return refill(child);
+                } else {
+                    // retrieve |min_chunk| next time to avoid memory copy, it stays the winner.
+                    break;
+                }
+            } else {
+                append_row_num = std::min(min_chunk.remaining_rows(), _chunk_size - rows);
+            }
         } else {
-            _heap.push(
-                    ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(), merge_condition});
+            append_row_num = min_chunk.last_row_less_than(*_chunks[runner_up], _chunk_size - rows) - offset;
         }
+
+        DCHECK_GT(append_row_num, 0);
+
+        chunk->append(*min_chunk._chunk, offset, append_row_num);
+        if (rssid_rowids != nullptr && need_rssid_rowids) {
+            DCHECK(min_chunk._rssid_rowids != nullptr);
+            rssid_rowids->insert(rssid_rowids->end(), min_chunk._rssid_rowids->begin() + offset,
+                                 min_chunk._rssid_rowids->begin() + offset + append_row_num);
+        }
+        min_chunk.advance(append_row_num);
+        rows += append_row_num;
+
+        DCHECK_LE(rows, _chunk_size);
+
+        if (source_masks) {
+            source_masks->insert(source_masks->end(), append_row_num, RowSourceMask{min_chunk._order, false});
+        }
+        if (min_chunk.remaining_rows() > 0) {
+            _tree->replay();
+        } else {
+            st = refill(child);
+            if (!st.ok()) {
+                break;
+            }
+        }
+    }
+    if (!st.ok()) {
+        return st;
+    } else if (rows > 0) {
+        return Status::OK();
+    } else {
+        return Status::EndOfFile("End of loser tree merge iterator");
+    }
+}
+
+inline Status LoserTreeMergeIterator::fill(size_t child) {
+    Chunk* chunk = _chunk_pool[child].get();
+
+    chunk->reset();
+    _chunks[child].reset();
+    std::shared_ptr<vector<uint64_t>> rssid_rowids;
+
+    Status st = Status::OK();
+    if (need_rssid_rowids) {
+        rssid_rowids = std::make_shared<vector<uint64_t>>();
+        st = _children[child]->get_next(chunk, rssid_rowids.get());
+    } else {
+        st = _children[child]->get_next(chunk);
+    }
+    if (st.ok()) {
+        size_t num_rows = chunk->num_rows();
+        DCHECK_GT(num_rows, 0u);
+        if (num_rows > max_merge_chunk_size) {
+            return Status::InternalError(strings::Substitute(
+                    "Merge iterator only supports merging chunks with rows less than $0", max_merge_chunk_size));
+        }
+        auto& comparable_chunk = _chunks[child].emplace(chunk, child, _schema.num_key_fields(),
+                                                        _schema.sort_key_idxes(), merge_condition);
+        comparable_chunk._rssid_rowids = std::move(rssid_rowids);
+        comparable_chunk.set_key_prefixes(encode_key_prefixes(child));
     } else if (st.is_end_of_file()) {
         // ignore Status::EndOfFile.
         close_child(child);
@@ -371,6 +591,30 @@ inline Status HeapMergeIterator::fill(size_t child) {
     return Status::OK();
 }
 
+inline Status LoserTreeMergeIterator::refill(size_t child) {
+    RETURN_IF_ERROR(fill(child));
+    if (_chunks[child].has_value()) {
+        _tree->replay();
+    } else {
+        _tree->pop();
+    }
+    return Status::OK();
+}
+
+static ChunkIteratorPtr create_merge_iterator(const std::vector<ChunkIteratorPtr>& children,
+                                              const std::string& merge_condition, bool need_rssid_rowids) {
+    if (config::enable_loser_tree_merge) {
+        auto iter = std::make_shared<LoserTreeMergeIterator>(children);
+        iter->merge_condition = merge_condition;
+        iter->need_rssid_rowids = need_rssid_rowids;
+        return iter;
+    }
+    auto iter = std::make_shared<HeapMergeIterator>(children);
+    iter->merge_condition = merge_condition;
+    iter->need_rssid_rowids = need_rssid_rowids;
+    return iter;
+}
+
 ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& children) {
     DCHECK(!children.empty());
     if (children.size() == 1) {
@@ -382,7 +626,7 @@ ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& ch
     const static size_t kMaxChildrenSize = std::numeric_limits<uint16_t>::max();
 
     if (children.size() <= kMaxChildrenSize) {
-        return std::make_shared<HeapMergeIterator>(children);
+        return create_merge_iterator(children, "", false);
     }
     std::vector<ChunkIteratorPtr> sub_merge_iterators;
     sub_merge_iterators.reserve((children.size() + kMaxChildrenSize - 1) / kMaxChildrenSize);
@@ -406,9 +650,7 @@ ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& ch
     const static size_t kMaxChildrenSize = std::numeric_limits<uint16_t>::max();
 
     if (children.size() <= kMaxChildrenSize) {
-        auto heapMergeIterator = std::make_shared<HeapMergeIterator>(children);
-        heapMergeIterator->merge_condition = merge_condition;
-        return heapMergeIterator;
+        return create_merge_iterator(children, merge_condition, false);
     }
     std::vector<ChunkIteratorPtr> sub_merge_iterators;
     sub_merge_iterators.reserve((children.size() + kMaxChildrenSize - 1) / kMaxChildrenSize);
@@ -431,9 +673,7 @@ ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& ch
     const static size_t kMaxChildrenSize = std::numeric_limits<uint16_t>::max();
 
     if (children.size() <= kMaxChildrenSize) {
-        auto heapMergeIterator = std::make_shared<HeapMergeIterator>(children);
-        heapMergeIterator->need_rssid_rowids = need_rssid_rowids;
-        return heapMergeIterator;
+        return create_merge_iterator(children, "", need_rssid_rowids);
     }
     std::vector<ChunkIteratorPtr> sub_merge_iterators;
     sub_merge_iterators.reserve((children.size() + kMaxChildrenSize - 1) / kMaxChildrenSize);
@@ -23,8 +23,10 @@
 #include "column/column_helper.h"
 #include "column/datum.h"
 #include "column/datum_convert.h"
+#include "column/nullable_column.h"
 #include "common/status.h"
 #include "runtime/global_dict/config.h"
+#include "storage/chunk_helper.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
@@ -35,7 +37,7 @@
 namespace starrocks {
 
 std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"flat_json_meta", "dict_merge", "max", "min",
-                                                                         "count"};
+                                                                         "count", "nonnull_count"};
 
 Status SegmentMetaCollecter::parse_field_and_colname(const std::string& item, std::string* field,
                                                      std::string* col_name) {
@@ -99,7 +101,7 @@ void MetaReader::_fill_empty_result(Chunk* chunk) {
         auto slot = _params.desc_tbl->get_slot_descriptor(s_id);
         const auto& field = _collect_context.seg_collecter_params.fields[i];
         ColumnPtr column = chunk->get_column_by_slot_id(slot->id());
-        if (field == "count") {
+        if (field == "count" || field == "nonnull_count") {
             column->append_datum(int64_t(0));
         } else {
             column->append_nulls(1);
@@ -124,7 +126,7 @@ Status MetaReader::_fill_result_chunk(Chunk* chunk) {
             desc.children.emplace_back(item_desc);
             ColumnPtr column = ColumnHelper::create_column(desc, _has_count_agg);
             chunk->append_column(std::move(column), slot->id());
-        } else if (field == "count") {
+        } else if (field == "count" || field == "nonnull_count") {
             TypeDescriptor item_desc;
             item_desc.type = TYPE_BIGINT;
             TypeDescriptor desc;
@@ -232,6 +234,8 @@ Status SegmentMetaCollecter::_collect(const std::string& name, ColumnId cid, Col
         return _collect_min(cid, column, type);
     } else if (name == "count") {
         return _collect_count(column, type);
+    } else if (name == "nonnull_count") {
+        return _collect_nonnull_count(cid, column, type);
     } else if (name == "flat_json_meta") {
         return _collect_flat_json(cid, column);
     }
@@ -389,4 +393,29 @@ Status SegmentMetaCollecter::_collect_count(Column* column, LogicalType type) {
     return Status::OK();
 }
 
+// count(col) of a nullable column: the pages which are all null or have no null are answered by the page-level
+// zone maps, only the null flags of the remaining pages are decoded.
+Status SegmentMetaCollecter::_collect_nonnull_count(ColumnId cid, Column* column, LogicalType type) {
+    if (!_column_iterators[cid]) {
+        return Status::InvalidArgument("Invalid Collect Params.");
+    }
+
+    uint64_t num_not_null = 0;
+    SparseRange<> mixed_ranges;
+    RETURN_IF_ERROR(_column_iterators[cid]->count_not_null_by_zone_map(&num_not_null, &mixed_ranges));
+    if (!mixed_ranges.empty()) {
+        auto dst = ChunkHelper::column_from_field_type(type, true);
+        SparseRangeIterator<> range_iter = mixed_ranges.new_iterator();
+        while (range_iter.has_more()) {
+            SparseRange<> batch;
+            range_iter.next_range(config::vector_chunk_size, &batch);
+            dst->reset_column();
+            RETURN_IF_ERROR(_column_iterators[cid]->next_batch(batch, dst.get()));
+            num_not_null += dst->size() - down_cast<NullableColumn*>(dst.get())->null_count();
+        }
+    }
+    column->append_datum(int64_t(num_not_null));
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -255,6 +255,8 @@ struct OlapReaderStatistics {
     int64_t rows_key_range_num = 0;
     int64_t rows_stats_filtered = 0;
     int64_t rows_vector_index_filtered = 0;
+    // The rows whose vector distances are computed exactly instead of searching the vector index.
+    int64_t rows_vector_exact_searched = 0;
     int64_t rows_bf_filtered = 0;
     int64_t rows_del_filtered = 0;
     int64_t del_filter_ns = 0;
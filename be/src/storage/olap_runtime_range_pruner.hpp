@@ -18,6 +18,7 @@
 #include <memory>
 #include <utility>
 
+#include "common/config.h"
 #include "exec/olap_common.h"
 #include "exprs/runtime_filter_bank.h"
 #include "runtime/global_dict/config.h"
@@ -175,12 +176,13 @@ inline Status OlapRuntimeScanRangePruner::_update(const ColumnIdToGlobalDictMap*
     }
     for (size_t i = 0; i < _arrived_runtime_filters_masks.size(); ++i) {
         // 1. runtime filter arrived
-        // 2. runtime filter updated and read rows greater than rf_update_threhold
+        // 2. runtime filter updated and read rows greater than config::runtime_filter_range_update_rows
         // we will filter by index
         if (auto rf = _unarrived_runtime_filters[i]->runtime_filter(_driver_sequence)) {
             size_t rf_version = rf->rf_version();
             if (_arrived_runtime_filters_masks[i] == 0 ||
-                (rf_version > _rf_versions[i] && raw_read_rows - _raw_read_rows > rf_update_threhold)) {
+                (rf_version > _rf_versions[i] &&
+                 raw_read_rows - _raw_read_rows > static_cast<size_t>(config::runtime_filter_range_update_rows))) {
                 ASSIGN_OR_RETURN(auto predicates, _get_predicates(global_dictmaps, i));
                 auto raw_predicates = _as_raw_predicates(predicates);
                 if (!raw_predicates.empty()) {
@@ -47,6 +47,8 @@
 #include "fs/fs_util.h"
 #include "storage/compaction.h"
 #include "storage/compaction_manager.h"
+#include "storage/index/sorted/rowset_sorted_index.h"
+#include "storage/index/vector/vector_index_deferred_builder.h"
 #include "storage/lake/local_pk_index_manager.h"
 #include "storage/lake/update_manager.h"
 #include "storage/olap_common.h"
@@ -249,6 +251,12 @@ Status StorageEngine::start_bg_threads() {
             std::thread([this]() { _clear_expired_replication_snapshots_callback(nullptr); });
     Thread::set_thread_name(_clear_expired_replcation_snapshots_thread, "clear_expired_replication_snapshots");
 
+    _vector_index_build_thread = std::thread([this] { _vector_index_build_thread_callback(nullptr); });
+    Thread::set_thread_name(_vector_index_build_thread, "vector_index_build");
+
+    _sorted_index_build_thread = std::thread([this] { _sorted_index_build_thread_callback(nullptr); });
+    Thread::set_thread_name(_sorted_index_build_thread, "sorted_index_build");
+
     if (!config::disable_storage_page_cache) {
         _adjust_cache_thread = std::thread([this] { _adjust_pagecache_callback(nullptr); });
         Thread::set_thread_name(_adjust_cache_thread, "adjust_cache");
@@ -411,6 +419,10 @@ void* StorageEngine::_pk_index_major_compaction_thread_callback(void* arg) {
 #ifdef GOOGLE_PROFILER
     ProfilerRegisterThread();
 #endif
+    if (config::pindex_preload_on_startup) {
+        WARN_IF_ERROR(_update_manager->get_pindex_compaction_mgr()->preload(_tablet_manager->get_all_pk_tablets()),
+                      "Failed to preload primary indexes");
+    }
     while (!_bg_worker_stopped.load(std::memory_order_consume)) {
         SLEEP_IN_BG_WORKER(1);
         // schedule persistent index compaction
@@ -900,6 +912,117 @@ void* StorageEngine::_clear_expired_replication_snapshots_callback(void* arg) {
     return nullptr;
 }
 
+void* StorageEngine::_vector_index_build_thread_callback(void* arg) {
+#ifdef GOOGLE_PROFILER
+    ProfilerRegisterThread();
+#endif
+    // The rowsets are immutable once their deferred indexes are built, so they are not checked again until removed.
+    std::unordered_set<std::string> built_rowsets;
+    while (!_bg_worker_stopped.load(std::memory_order_consume)) {
+        int32_t interval = config::vector_index_deferred_build_interval_sec;
+        if (interval <= 0) {
+            LOG(WARNING) << "vector index deferred build interval config is illegal: " << interval
+                         << ", will be forced set to 10 seconds";
+            interval = 10;
+        }
+        SLEEP_IN_BG_WORKER(interval);
+
+        std::unordered_set<std::string> live_rowsets;
+        for (const auto& tablet : _tablet_manager->get_all_vector_index_tablets()) {
+            std::vector<RowsetSharedPtr> rowsets;
+            if (tablet->keys_type() == PRIMARY_KEYS) {
+                if (tablet->updates() == nullptr) {
+                    continue;
+                }
+                for (const auto& [rssid, rowset] : *tablet->updates()->get_rowset_map()) {
+                    rowsets.emplace_back(rowset);
+                }
+            } else {
+                tablet->pick_all_candicate_rowsets(&rowsets);
+            }
+            for (const auto& rowset : rowsets) {
+                if (_bg_worker_stopped.load(std::memory_order_consume)) {
+                    return nullptr;
+                }
+                std::string rowset_key = rowset->unique_id();
+                live_rowsets.insert(rowset_key);
+                if (built_rowsets.count(rowset_key) > 0) {
+                    continue;
+                }
+                auto num_built = VectorIndexDeferredBuilder::build_rowset(rowset);
+                if (!num_built.ok()) {
+                    LOG(WARNING) << "failed to build the deferred vector indexes of tablet " << tablet->tablet_id()
+                                 << " rowset " << rowset->rowset_id() << ": " << num_built.status();
+                    continue;
+                }
+                if (num_built.value() > 0) {
+                    LOG(INFO) << "built " << num_built.value() << " deferred vector indexes of tablet "
+                              << tablet->tablet_id() << " rowset " << rowset->rowset_id();
+                }
+                built_rowsets.insert(std::move(rowset_key));
+            }
+        }
+        for (auto it = built_rowsets.begin(); it != built_rowsets.end();) {
+            it = live_rowsets.count(*it) > 0 ? std::next(it) : built_rowsets.erase(it);
+        }
+    }
+
+    return nullptr;
+}
+
+void* StorageEngine::_sorted_index_build_thread_callback(void* arg) {
+#ifdef GOOGLE_PROFILER
+    ProfilerRegisterThread();
+#endif
+    // The rowsets are immutable once their sorted indexes are built, so they are not checked again until removed.
+    std::unordered_set<std::string> built_rowsets;
+    while (!_bg_worker_stopped.load(std::memory_order_consume)) {
+        int32_t interval = config::rowset_sorted_index_build_interval_sec;
+        if (interval <= 0) {
+            LOG(WARNING) << "rowset sorted index build interval config is illegal: " << interval
+                         << ", will be forced set to 10 seconds";
+            interval = 10;
+        }
+        SLEEP_IN_BG_WORKER(interval);
+        if (!config::enable_rowset_sorted_index) {
+            built_rowsets.clear();
+            continue;
+        }
+
+        std::unordered_set<std::string> live_rowsets;
+        for (const auto& tablet : _tablet_manager->get_all_sorted_index_tablets()) {
+            std::vector<RowsetSharedPtr> rowsets;
+            tablet->pick_all_candicate_rowsets(&rowsets);
+            for (const auto& rowset : rowsets) {
+                if (_bg_worker_stopped.load(std::memory_order_consume)) {
+                    return nullptr;
+                }
+                std::string rowset_key = rowset->unique_id();
+                live_rowsets.insert(rowset_key);
+                if (built_rowsets.count(rowset_key) > 0) {
+                    continue;
+                }
+                auto num_built = RowsetSortedIndex::build_rowset(rowset);
+                if (!num_built.ok()) {
+                    LOG(WARNING) << "failed to build the sorted indexes of tablet " << tablet->tablet_id()
+                                 << " rowset " << rowset->rowset_id() << ": " << num_built.status();
+                    continue;
+                }
+                if (num_built.value() > 0) {
+                    VLOG(1) << "built " << num_built.value() << " sorted indexes of tablet " << tablet->tablet_id()
+                            << " rowset " << rowset->rowset_id();
+                }
+                built_rowsets.insert(std::move(rowset_key));
+            }
+        }
+        for (auto it = built_rowsets.begin(); it != built_rowsets.end();) {
+            it = live_rowsets.count(*it) > 0 ? std::next(it) : built_rowsets.erase(it);
+        }
+    }
+
+    return nullptr;
+}
+
 void* StorageEngine::_tablet_checkpoint_callback(void* arg) {
 #ifdef GOOGLE_PROFILER
     ProfilerRegisterThread();
@@ -809,9 +809,12 @@ public:
                const std::vector<size_t>& idxes) const override {
         TRY_CATCH_BAD_ALLOC({
             size_t nfound = 0;
-            for (const auto idx : idxes) {
+            const auto hashes = _hash_keys(keys, idxes);
+            for (size_t i = 0; i < idxes.size(); i++) {
+                _prefetch(hashes, i);
+                const auto idx = idxes[i];
                 const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
-                uint64_t hash = FixedKeyHash<KeySize>()(key);
+                uint64_t hash = hashes[i];
                 auto iter = _map.find(key, hash);
                 if (iter == _map.end()) {
                     values[idx] = NullIndexValue;
@@ -830,10 +833,13 @@ public:
                   size_t* num_found, const std::vector<size_t>& idxes) override {
         TRY_CATCH_BAD_ALLOC({
             size_t nfound = 0;
-            for (const auto idx : idxes) {
+            const auto hashes = _hash_keys(keys, idxes);
+            for (size_t i = 0; i < idxes.size(); i++) {
+                _prefetch(hashes, i);
+                const auto idx = idxes[i];
                 const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
                 const auto value = values[idx];
-                uint64_t hash = FixedKeyHash<KeySize>()(key);
+                uint64_t hash = hashes[i];
                 if (auto [it, inserted] = _map.emplace_with_hash(hash, key, value); inserted) {
                     not_found->key_infos.emplace_back((uint32_t)idx, hash);
                 } else {
@@ -852,10 +858,13 @@ public:
                   const std::vector<size_t>& idxes) override {
         TRY_CATCH_BAD_ALLOC({
             size_t nfound = 0;
-            for (const auto idx : idxes) {
+            const auto hashes = _hash_keys(keys, idxes);
+            for (size_t i = 0; i < idxes.size(); i++) {
+                _prefetch(hashes, i);
+                const auto idx = idxes[i];
                 const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
                 const auto value = values[idx];
-                uint64_t hash = FixedKeyHash<KeySize>()(key);
+                uint64_t hash = hashes[i];
                 if (auto [it, inserted] = _map.emplace_with_hash(hash, key, value); inserted) {
                     not_found->key_infos.emplace_back((uint32_t)idx, hash);
                 } else {
@@ -871,10 +880,13 @@ public:
 
     Status insert(const Slice* keys, const IndexValue* values, const std::vector<size_t>& idxes) override {
         TRY_CATCH_BAD_ALLOC({
-            for (const auto idx : idxes) {
+            const auto hashes = _hash_keys(keys, idxes);
+            for (size_t i = 0; i < idxes.size(); i++) {
+                _prefetch(hashes, i);
+                const auto idx = idxes[i];
                 const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
                 const auto value = values[idx];
-                uint64_t hash = FixedKeyHash<KeySize>()(key);
+                uint64_t hash = hashes[i];
                 if (auto [it, inserted] = _map.emplace_with_hash(hash, key, value); !inserted) {
                     auto old = reinterpret_cast<uint64_t*>(&(it->second));
                     auto old_rssid = (uint32_t)((*old) >> 32);
@@ -897,9 +909,12 @@ public:
                  const std::vector<size_t>& idxes) override {
         TRY_CATCH_BAD_ALLOC({
             size_t nfound = 0;
-            for (const auto idx : idxes) {
+            const auto hashes = _hash_keys(keys, idxes);
+            for (size_t i = 0; i < idxes.size(); i++) {
+                _prefetch(hashes, i);
+                const auto idx = idxes[i];
                 const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
-                uint64_t hash = FixedKeyHash<KeySize>()(key);
+                uint64_t hash = hashes[i];
                 if (auto [it, inserted] = _map.emplace_with_hash(hash, key, IndexValue(NullIndexValue)); inserted) {
                     old_values[idx] = NullIndexValue;
                     not_found->key_infos.emplace_back((uint32_t)idx, hash);
@@ -1055,6 +1070,26 @@ public:
     size_t memory_usage() override { return _map.capacity() * (1 + (KeySize + 3) / 4 * 4 + kIndexValueSize); }
 
 private:
+    // The keys are probed some iterations after they are hashed, which gives the prefetch of their slots
+    // time to finish before the probe touches them.
+    static constexpr size_t kPrefetchDistance = 8;
+
+    // Hash all the keys in one pass, the loop has no dependency between the keys, so it keeps the
+    // pipeline busy instead of stalling on the probe of each key.
+    std::vector<uint64_t> _hash_keys(const Slice* keys, const std::vector<size_t>& idxes) const {
+        std::vector<uint64_t> hashes(idxes.size());
+        for (size_t i = 0; i < idxes.size(); i++) {
+            hashes[i] = FixedKeyHash<KeySize>()(*reinterpret_cast<const KeyType*>(keys[idxes[i]].data));
+        }
+        return hashes;
+    }
+
+    void _prefetch(const std::vector<uint64_t>& hashes, size_t i) const {
+        if (i + kPrefetchDistance < hashes.size()) {
+            _map.prefetch_hash(hashes[i + kPrefetchDistance]);
+        }
+    }
+
     phmap::flat_hash_map<KeyType, IndexValue, FixedKeyHash<KeySize>> _map;
 };
 
@@ -17,6 +17,7 @@
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
 #include "storage/tablet_updates.h"
+#include "storage/update_manager.h"
 #include "util/starrocks_metrics.h"
 #include "util/threadpool.h"
 
@@ -26,6 +27,9 @@ PersistentIndexCompactionManager::~PersistentIndexCompactionManager() {
     if (_worker_thread_pool != nullptr) {
         _worker_thread_pool->shutdown();
     }
+    if (_preload_thread_pool != nullptr) {
+        _preload_thread_pool->shutdown();
+    }
 }
 
 Status PersistentIndexCompactionManager::init() {
@@ -126,6 +130,64 @@ bool PersistentIndexCompactionManager::disk_limit(DataDir* data_dir) {
     return _data_dir_to_task_num_map[data_dir] >= std::max(1, config::pindex_major_compaction_limit_per_disk);
 }
 
+Status PersistentIndexCompactionManager::preload(std::vector<TabletSharedPtr> tablets) {
+    std::unordered_map<DataDir*, std::vector<TabletSharedPtr>> tablets_by_disk;
+    for (auto& tablet : tablets) {
+        if (tablet->keys_type() == PRIMARY_KEYS && tablet->get_enable_persistent_index() &&
+            tablet->tablet_state() != TABLET_NOTREADY) {
+            tablets_by_disk[tablet->data_dir()].push_back(std::move(tablet));
+        }
+    }
+    if (tablets_by_disk.empty()) {
+        return Status::OK();
+    }
+    const int limit_per_disk = std::max(1, config::pindex_preload_limit_per_disk);
+    if (_preload_thread_pool == nullptr) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("pk_index_preload")
+                                .set_min_threads(0)
+                                .set_max_threads(tablets_by_disk.size() * limit_per_disk)
+                                .build(&_preload_thread_pool));
+    }
+    auto* update_manager = StorageEngine::instance()->update_manager();
+    for (auto& [data_dir, disk_tablets] : tablets_by_disk) {
+        // The tablets of a disk are shared by its workers, each worker loads the next one until they run out.
+        auto queue = std::make_shared<std::vector<TabletSharedPtr>>(std::move(disk_tablets));
+        auto next = std::make_shared<std::atomic<size_t>>(0);
+        for (int i = 0; i < limit_per_disk; i++) {
+            RETURN_IF_ERROR(_preload_thread_pool->submit_func([this, queue, next, update_manager]() {
+                for (size_t idx = next->fetch_add(1); idx < queue->size(); idx = next->fetch_add(1)) {
+                    if (StorageEngine::instance()->bg_worker_stopped()) {
+                        return;
+                    }
+                    // Leave the index cache to the indexes loaded on demand once it is filled up.
+                    auto& index_cache = update_manager->index_cache();
+                    if (index_cache.size() >= index_cache.capacity() / 100 * config::pindex_preload_mem_limit_percent) {
+                        return;
+                    }
+                    auto& tablet = (*queue)[idx];
+                    std::shared_lock migration_rlock(tablet->get_migration_lock(), std::try_to_lock);
+                    if (!migration_rlock.owns_lock() || Tablet::check_migrate(tablet)) {
+                        continue;
+                    }
+                    auto st = tablet->updates()->preload_primary_index();
+                    if (st.ok()) {
+                        _preloaded_num++;
+                    } else {
+                        LOG(WARNING) << "preload primary index failed, tablet: " << tablet->tablet_id() << ", " << st;
+                    }
+                }
+            }));
+        }
+    }
+    return Status::OK();
+}
+
+void PersistentIndexCompactionManager::wait_preload() {
+    if (_preload_thread_pool != nullptr) {
+        _preload_thread_pool->wait();
+    }
+}
+
 Status PersistentIndexCompactionManager::update_max_threads(int max_threads) {
     if (_worker_thread_pool != nullptr) {
         RETURN_IF_ERROR(_worker_thread_pool->update_max_threads(max_threads));
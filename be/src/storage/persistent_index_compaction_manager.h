@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <set>
 #include <utility>
@@ -50,6 +51,14 @@ public:
     // Is tablet's disk out of concurrency limit
     bool disk_limit(DataDir* data_dir);
 
+    // Load the persistent primary indexes of `tablets` into the index cache in the background, so the first
+    // apply of every tablet after restart doesn't wait for its index. The tablets of each disk are loaded by
+    // at most `pindex_preload_limit_per_disk` workers to bound the IO.
+    Status preload(std::vector<TabletSharedPtr> tablets);
+    // Wait for the preload tasks to finish.
+    void wait_preload();
+    size_t preloaded_num() const { return _preloaded_num.load(); }
+
 protected:
     std::mutex _mutex;
     // Sorted by prority
@@ -58,6 +67,9 @@ protected:
     std::unique_ptr<ThreadPool> _worker_thread_pool;
     std::unordered_map<DataDir*, uint64_t> _data_dir_to_task_num_map;
     size_t _last_schedule_time = 0;
+
+    std::unique_ptr<ThreadPool> _preload_thread_pool;
+    std::atomic<size_t> _preloaded_num{0};
 };
 
 } // namespace starrocks
@@ -14,8 +14,12 @@
 
 #include "storage/predicate_tree/predicate_tree.hpp"
 
+#include <limits>
+#include <numeric>
+
 #include "gutil/strings/substitute.h"
 #include "simd/simd.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -130,6 +134,51 @@ Status PredicateCompoundNode<CompoundNodeType::OR>::evaluate_or(CompoundNodeCont
 // PredicateAndNode
 // ------------------------------------------------------------------------------------
 
+void CompoundNodeContext::CompoundAndContext::update_non_vec_child_stats(size_t child_idx, int64_t input_rows,
+                                                                         int64_t output_rows, int64_t cost_ns) {
+    auto& stats = non_vec_children_stats[child_idx];
+    stats.input_rows += input_rows;
+    stats.output_rows += output_rows;
+    stats.cost_ns += cost_ns;
+}
+
+void CompoundNodeContext::CompoundAndContext::reorder_non_vec_children() {
+    const size_t num_children = non_vec_children.size();
+    if (num_children <= 1) {
+        return;
+    }
+
+    // The expected cost of evaluating a child is proportional to the rows it receives, so order the children
+    // by `cost_per_row / (1 - pass_ratio)` ascending, which minimizes the total expected cost of the chain.
+    // A child that has not been evaluated yet has a rank of 0 to get its statistics collected.
+    std::vector<double> ranks(num_children, 0);
+    for (size_t i = 0; i < num_children; i++) {
+        const auto& stats = non_vec_children_stats[i];
+        if (stats.input_rows == 0) {
+            continue;
+        }
+        const double cost_per_row = static_cast<double>(stats.cost_ns) / stats.input_rows;
+        const double filter_ratio = 1.0 - static_cast<double>(stats.output_rows) / stats.input_rows;
+        ranks[i] = filter_ratio <= 0 ? std::numeric_limits<double>::max() : cost_per_row / filter_ratio;
+    }
+
+    std::vector<size_t> order(num_children);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return ranks[lhs] < ranks[rhs]; });
+
+    std::vector<const PredicateColumnNode*> new_children(num_children);
+    std::vector<ChildStats> new_stats(num_children);
+    for (size_t i = 0; i < num_children; i++) {
+        new_children[i] = non_vec_children[order[i]];
+        // Decay the statistics to adapt to the change of data distribution.
+        new_stats[i].input_rows = non_vec_children_stats[order[i]].input_rows / 2;
+        new_stats[i].output_rows = non_vec_children_stats[order[i]].output_rows / 2;
+        new_stats[i].cost_ns = non_vec_children_stats[order[i]].cost_ns / 2;
+    }
+    non_vec_children = std::move(new_children);
+    non_vec_children_stats = std::move(new_stats);
+}
+
 template <>
 Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContexts& contexts, const Chunk* chunk,
                                                               uint8_t* selection, uint16_t from, uint16_t to) const {
@@ -159,6 +208,7 @@ Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContex
         for (const auto& child : _compound_children) {
             ctx.vec_children.emplace_back(&child);
         }
+        ctx.non_vec_children_stats.resize(ctx.non_vec_children.size());
     }
     auto& ctx = node_ctx.and_context.value();
 
@@ -203,12 +253,22 @@ Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNodeContex
             }
         }
 
-        for (const auto& col_pred : ctx.non_vec_children) {
+        const bool need_stats = ctx.non_vec_children.size() > 1;
+        for (size_t i = 0; i < ctx.non_vec_children.size(); i++) {
+            const auto* col_pred = ctx.non_vec_children[i];
+            const uint16_t input_size = selected_size;
+            const int64_t start_ns = need_stats ? MonotonicNanos() : 0;
             ASSIGN_OR_RETURN(selected_size, col_pred->evaluate_branchless(chunk, selected_idx, selected_size));
+            if (need_stats) {
+                ctx.update_non_vec_child_stats(i, input_size, selected_size, MonotonicNanos() - start_ns);
+            }
             if (selected_size == 0) {
                 break;
             }
         }
+        if (need_stats && ++ctx.num_evaluations % CompoundNodeContext::CompoundAndContext::REORDER_INTERVAL == 0) {
+            ctx.reorder_non_vec_children();
+        }
 
         memset(&selection[from], 0, to - from);
         for (uint16_t i = 0; i < selected_size; ++i) {
@@ -289,6 +289,22 @@ struct CompoundNodeContext {
     struct CompoundAndContext {
         std::vector<const PredicateColumnNode*> non_vec_children;
         std::vector<ConstPredicateNodePtr> vec_children;
+
+        // Runtime statistics of each non-vectorized child, aligned with `non_vec_children`.
+        // The non-vectorized children are evaluated one by one on the rows selected by the previous ones,
+        // so they are reordered periodically to evaluate the cheapest and most selective one first.
+        struct ChildStats {
+            int64_t input_rows = 0;
+            int64_t output_rows = 0;
+            int64_t cost_ns = 0;
+        };
+        std::vector<ChildStats> non_vec_children_stats;
+        size_t num_evaluations = 0;
+
+        static constexpr size_t REORDER_INTERVAL = 16;
+
+        void update_non_vec_child_stats(size_t child_idx, int64_t input_rows, int64_t output_rows, int64_t cost_ns);
+        void reorder_non_vec_children();
     };
     std::optional<CompoundAndContext> and_context;
 
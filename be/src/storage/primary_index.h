@@ -145,6 +145,8 @@ public:
 
     bool enable_persistent_index() { return _persistent_index != nullptr; }
 
+    bool is_loaded() const { return _loaded; }
+
     size_t key_size() { return _key_size; }
 
     Status reset(Tablet* tablet, EditVersion version, PersistentIndexMetaPB* index_meta);
@@ -35,6 +35,7 @@
 
 #include "storage/primary_key_encoder.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <numeric>
@@ -46,6 +47,7 @@
 #include "column/schema.h"
 #include "gutil/endian.h"
 #include "gutil/stringprintf.h"
+#include "gutil/strings/fastmem.h"
 #include "storage/dictionary_cache_manager.h"
 #include "storage/tablet_schema.h"
 #include "types/date_value.hpp"
@@ -93,6 +95,20 @@ void encode_integral(const T& v, std::string* dest) {
     }
 }
 
+template <class T>
+inline void encode_integral(const T& v, uint8_t* dest) {
+    if constexpr (std::is_signed<T>::value) {
+        typedef typename std::make_unsigned<T>::type UT;
+        UT uv = v;
+        uv ^= static_cast<UT>(1) << (sizeof(UT) * 8 - 1);
+        uv = to_bigendian(uv);
+        memcpy(dest, &uv, sizeof(uv));
+    } else {
+        T nv = to_bigendian(v);
+        memcpy(dest, &nv, sizeof(nv));
+    }
+}
+
 template <class T>
 void decode_integral(Slice* src, T* v) {
     if constexpr (std::is_signed<T>::value) {
@@ -448,6 +464,128 @@ static void prepare_ops_datas(const Schema& schema, const std::vector<ColumnId>&
     }
 }
 
+// Encodes the key column of the fixed width type T of |rows| into the keys at |positions| and advances them.
+template <class T, class Offset>
+static void encode_integral_column(const Column& column, const uint32_t* rows, size_t len, uint8_t* bytes,
+                                   Offset* positions) {
+    const auto* data = reinterpret_cast<const T*>(column.raw_data());
+    for (size_t i = 0; i < len; i++) {
+        encode_integral(data[rows[i]], bytes + positions[i]);
+        positions[i] += sizeof(T);
+    }
+}
+
+template <class Offset>
+static void encode_slice_column(const Column& column, const uint32_t* rows, size_t len, bool is_last, uint8_t* bytes,
+                                Offset* positions) {
+    const auto* data = reinterpret_cast<const Slice*>(column.raw_data());
+    for (size_t i = 0; i < len; i++) {
+        const Slice& s = data[rows[i]];
+        uint8_t* dst = bytes + positions[i];
+        if (is_last || memchr(s.data, '\0', s.size) == nullptr) {
+            strings::memcpy_inlined(dst, s.data, s.size);
+            dst += s.size;
+        } else {
+            const auto* src = reinterpret_cast<const uint8_t*>(s.data);
+            EncodeChunkLoop(&src, &dst, s.size);
+        }
+        if (!is_last) {
+            *dst++ = 0;
+            *dst++ = 0;
+        }
+        positions[i] = dst - bytes;
+    }
+}
+
+// Encodes the composite keys of |rows| column by column instead of row by row. The sizes of the keys are computed
+// first, so the binary column is allocated at once and every key column is encoded into the keys in place, with the
+// type dispatched once per column.
+template <class BinaryColumnType>
+static void encode_composite_keys(const Schema& schema, const Chunk& chunk, const uint32_t* rows, size_t len,
+                                  BinaryColumnType* dest) {
+    using Offset = typename BinaryColumnType::Offset;
+    const int ncol = schema.num_key_fields();
+    std::vector<Offset> positions(len, 0);
+    Offset fixed_size = 0;
+    for (int j = 0; j < ncol; j++) {
+        LogicalType type = schema.field(j)->type()->type();
+        if (type != TYPE_VARCHAR) {
+            fixed_size += TabletColumn::get_field_length_by_type(type, 0);
+            continue;
+        }
+        const auto* slices = reinterpret_cast<const Slice*>(chunk.get_column_by_index(j)->raw_data());
+        if (j + 1 == ncol) {
+            for (size_t i = 0; i < len; i++) {
+                positions[i] += slices[rows[i]].size;
+            }
+        } else {
+            // each 0x00 is encoded as 0x00 0x01, with a tailing 0x00 0x00
+            for (size_t i = 0; i < len; i++) {
+                const Slice& s = slices[rows[i]];
+                positions[i] += s.size + std::count(s.data, s.data + s.size, '\0') + 2;
+            }
+        }
+    }
+
+    auto& offsets = dest->get_offset();
+    auto& bytes = dest->get_bytes();
+    size_t num_offsets = offsets.size();
+    offsets.resize(num_offsets + len);
+    Offset end = offsets[num_offsets - 1];
+    for (size_t i = 0; i < len; i++) {
+        Offset begin = end;
+        end += fixed_size + positions[i];
+        positions[i] = begin;
+        offsets[num_offsets + i] = end;
+    }
+    bytes.resize(end);
+
+    uint8_t* data = bytes.data();
+    for (int j = 0; j < ncol; j++) {
+        const Column& column = *chunk.get_column_by_index(j);
+        switch (schema.field(j)->type()->type()) {
+        case TYPE_BOOLEAN:
+            encode_integral_column<uint8_t>(column, rows, len, data, positions.data());
+            break;
+        case TYPE_TINYINT:
+            encode_integral_column<int8_t>(column, rows, len, data, positions.data());
+            break;
+        case TYPE_SMALLINT:
+            encode_integral_column<int16_t>(column, rows, len, data, positions.data());
+            break;
+        case TYPE_INT:
+        case TYPE_DATE:
+            encode_integral_column<int32_t>(column, rows, len, data, positions.data());
+            break;
+        case TYPE_BIGINT:
+        case TYPE_DATETIME:
+            encode_integral_column<int64_t>(column, rows, len, data, positions.data());
+            break;
+        case TYPE_LARGEINT:
+            encode_integral_column<int128_t>(column, rows, len, data, positions.data());
+            break;
+        case TYPE_VARCHAR:
+            encode_slice_column(column, rows, len, j + 1 == ncol, data, positions.data());
+            break;
+        default:
+            DCHECK(false) << "type not supported for primary key encoding "
+                          << logical_type_to_string(schema.field(j)->type()->type());
+        }
+    }
+    DCHECK(len == 0 || positions[len - 1] == end);
+    dest->invalidate_slice_cache();
+}
+
+static void encode_composite_keys(const Schema& schema, const Chunk& chunk, const uint32_t* rows, size_t len,
+                                  Column* dest) {
+    DCHECK(dest->is_binary() || dest->is_large_binary()) << "dest column should be binary";
+    if (dest->is_binary()) {
+        encode_composite_keys(schema, chunk, rows, len, down_cast<BinaryColumn*>(dest));
+    } else {
+        encode_composite_keys(schema, chunk, rows, len, down_cast<LargeBinaryColumn*>(dest));
+    }
+}
+
 void PrimaryKeyEncoder::encode(const Schema& schema, const Chunk& chunk, size_t offset, size_t len, Column* dest) {
     if (schema.num_key_fields() == 1) {
         // simple encoding, src & dest should have same type
@@ -468,36 +606,9 @@ void PrimaryKeyEncoder::encode(const Schema& schema, const Chunk& chunk, size_t
             dest->append(*src, offset, len);
         }
     } else {
-        DCHECK(dest->is_binary() || dest->is_large_binary()) << "dest column should be binary";
-        int ncol = schema.num_key_fields();
-        std::vector<EncodeOp> ops(ncol);
-        std::vector<const void*> datas(ncol);
-        std::vector<ColumnId> primary_key_iota_idxes(ncol);
-        std::iota(primary_key_iota_idxes.begin(), primary_key_iota_idxes.end(), 0);
-        prepare_ops_datas(schema, primary_key_iota_idxes, chunk, &ops, &datas);
-        if (dest->is_binary()) {
-            auto& bdest = down_cast<BinaryColumn&>(*dest);
-            bdest.reserve(bdest.size() + len);
-            std::string buff;
-            for (size_t i = 0; i < len; i++) {
-                buff.clear();
-                for (int j = 0; j < ncol; j++) {
-                    ops[j](datas[j], offset + i, &buff);
-                }
-                bdest.append(buff);
-            }
-        } else {
-            auto& bdest = down_cast<LargeBinaryColumn&>(*dest);
-            bdest.reserve(bdest.size() + len);
-            std::string buff;
-            for (size_t i = 0; i < len; i++) {
-                buff.clear();
-                for (int j = 0; j < ncol; j++) {
-                    ops[j](datas[j], offset + i, &buff);
-                }
-                bdest.append(buff);
-            }
-        }
+        std::vector<uint32_t> rows(len);
+        std::iota(rows.begin(), rows.end(), offset);
+        encode_composite_keys(schema, chunk, rows.data(), len, dest);
     }
 }
 
@@ -583,38 +694,7 @@ void PrimaryKeyEncoder::encode_selective(const Schema& schema, const Chunk& chun
         auto& src = chunk.get_column_by_index(0);
         dest->append_selective(*src, indexes, 0, len);
     } else {
-        DCHECK(dest->is_binary() || dest->is_large_binary()) << "dest column should be binary";
-        int ncol = schema.num_key_fields();
-        std::vector<EncodeOp> ops(ncol);
-        std::vector<const void*> datas(ncol);
-        std::vector<ColumnId> primary_key_iota_idxes(ncol);
-        std::iota(primary_key_iota_idxes.begin(), primary_key_iota_idxes.end(), 0);
-        prepare_ops_datas(schema, primary_key_iota_idxes, chunk, &ops, &datas);
-        if (dest->is_binary()) {
-            auto& bdest = down_cast<BinaryColumn&>(*dest);
-            bdest.reserve(bdest.size() + len);
-            std::string buff;
-            for (int i = 0; i < len; i++) {
-                uint32_t idx = indexes[i];
-                buff.clear();
-                for (int j = 0; j < ncol; j++) {
-                    ops[j](datas[j], idx, &buff);
-                }
-                bdest.append(buff);
-            }
-        } else {
-            auto& bdest = down_cast<LargeBinaryColumn&>(*dest);
-            bdest.reserve(bdest.size() + len);
-            std::string buff;
-            for (int i = 0; i < len; i++) {
-                uint32_t idx = indexes[i];
-                buff.clear();
-                for (int j = 0; j < ncol; j++) {
-                    ops[j](datas[j], idx, &buff);
-                }
-                bdest.append(buff);
-            }
-        }
+        encode_composite_keys(schema, chunk, indexes, len, dest);
     }
 }
 
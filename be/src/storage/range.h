@@ -215,6 +215,9 @@ public:
 
     SparseRange& operator|=(const SparseRange& rhs);
 
+    // Removes the rows of |rhs| from |this|, by one pass over the sorted ranges of both.
+    SparseRange& operator-=(const SparseRange& rhs);
+
 private:
     friend class SparseRangeIterator<T>;
 
@@ -367,6 +370,38 @@ inline SparseRange<T>& SparseRange<T>::operator|=(const SparseRange<T>& rhs) {
     return *this;
 }
 
+template <typename T>
+inline SparseRange<T>& SparseRange<T>::operator-=(const SparseRange<T>& rhs) {
+    DCHECK(_is_sorted && rhs._is_sorted);
+    if (_ranges.empty() || rhs._ranges.empty()) {
+        return *this;
+    }
+    std::vector<Range<T>> new_ranges;
+    new_ranges.reserve(_ranges.size());
+    size_t j = 0;
+    for (const auto& r : _ranges) {
+        while (j < rhs._ranges.size() && rhs._ranges[j].end() <= r.begin()) {
+            j++;
+        }
+        T begin = r.begin();
+        // The ranges of |rhs| overlapping |r|, the last one may also overlap the next range of |this|.
+        for (; j < rhs._ranges.size() && rhs._ranges[j].begin() < r.end(); j++) {
+            if (begin < rhs._ranges[j].begin()) {
+                new_ranges.emplace_back(begin, rhs._ranges[j].begin());
+            }
+            begin = std::max(begin, rhs._ranges[j].end());
+            if (begin >= r.end()) {
+                break;
+            }
+        }
+        if (begin < r.end()) {
+            new_ranges.emplace_back(begin, r.end());
+        }
+    }
+    _ranges.swap(new_ranges);
+    return *this;
+}
+
 template <typename T>
 inline SparseRangeIterator<T>::SparseRangeIterator(const SparseRange<T>* r) : _range(r) {
     if (!_range->_ranges.empty()) {
@@ -14,6 +14,8 @@
 
 #include "storage/row_source_mask.h"
 
+#include <unistd.h>
+
 #include <utility>
 
 #include "common/config.h"
@@ -25,9 +27,13 @@
 namespace starrocks {
 
 RowSourceMaskBuffer::RowSourceMaskBuffer(int64_t tablet_id, std::string storage_root_path)
+        : RowSourceMaskBuffer(tablet_id, std::move(storage_root_path), 0) {}
+
+RowSourceMaskBuffer::RowSourceMaskBuffer(int64_t tablet_id, std::string storage_root_path, int64_t max_memory_bytes)
         : _mask_column(UInt16Column::create_mutable()),
           _tablet_id(tablet_id),
-          _storage_root_path(std::move(storage_root_path)) {}
+          _storage_root_path(std::move(storage_root_path)),
+          _max_memory_bytes(max_memory_bytes) {}
 
 RowSourceMaskBuffer::~RowSourceMaskBuffer() {
     _reset_mask_column();
@@ -38,7 +44,8 @@ RowSourceMaskBuffer::~RowSourceMaskBuffer() {
 
 Status RowSourceMaskBuffer::write(const std::vector<RowSourceMask>& source_masks) {
     size_t source_masks_size = source_masks.size() * sizeof(RowSourceMask);
-    if (_mask_column->byte_size() + source_masks_size >= config::max_row_source_mask_memory_bytes &&
+    int64_t max_memory_bytes = _max_memory_bytes > 0 ? _max_memory_bytes : config::max_row_source_mask_memory_bytes;
+    if (_mask_column->byte_size() + source_masks_size >= max_memory_bytes &&
         !_mask_column->empty()) {
         if (_tmp_file_fd == -1) {
             RETURN_IF_ERROR(_create_tmp_file());
@@ -103,16 +110,37 @@ size_t RowSourceMaskBuffer::max_same_source_count(uint16_t source, size_t limit_
 Status RowSourceMaskBuffer::flip_to_read() {
     _current_index = 0;
     if (_tmp_file_fd > 0) {
-        off_t offset = lseek(_tmp_file_fd, 0, SEEK_SET);
-        if (offset != 0) {
-            PLOG(WARNING) << "fail to seek to offset 0. offset=" << offset;
-            return Status::InternalError("fail to seek to offset 0");
-        }
+        _read_offset = 0;
         _reset_mask_column();
     }
     return Status::OK();
 }
 
+Status RowSourceMaskBuffer::persist() {
+    if (_mask_column->empty()) {
+        return Status::OK();
+    }
+    if (_tmp_file_fd == -1) {
+        RETURN_IF_ERROR(_create_tmp_file());
+    }
+    RETURN_IF_ERROR(_serialize_masks());
+    _reset_mask_column();
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<RowSourceMaskBuffer>> RowSourceMaskBuffer::new_reader() const {
+    DCHECK(_mask_column->empty());
+    auto reader = std::make_unique<RowSourceMaskBuffer>(_tablet_id, _storage_root_path, _max_memory_bytes);
+    if (_tmp_file_fd > 0) {
+        reader->_tmp_file_fd = ::dup(_tmp_file_fd);
+        if (reader->_tmp_file_fd < 0) {
+            PLOG(WARNING) << "fail to dup mask tmp file";
+            return Status::InternalError("fail to dup mask tmp file");
+        }
+    }
+    return reader;
+}
+
 Status RowSourceMaskBuffer::flush() {
     if (_tmp_file_fd > 0 && !_mask_column->empty()) {
         RETURN_IF_ERROR(_serialize_masks());
@@ -154,7 +182,7 @@ Status RowSourceMaskBuffer::_serialize_masks() {
 
 Status RowSourceMaskBuffer::_deserialize_masks() {
     uint64_t num_rows = 0;
-    ssize_t r_size = ::read(_tmp_file_fd, &num_rows, sizeof(num_rows));
+    ssize_t r_size = ::pread(_tmp_file_fd, &num_rows, sizeof(num_rows), _read_offset);
     if (r_size == 0) {
         return Status::EndOfFile("end of file");
     } else if (r_size != sizeof(uint64_t)) {
@@ -164,11 +192,13 @@ Status RowSourceMaskBuffer::_deserialize_masks() {
 
     Buffer<uint16_t> content;
     raw::stl_vector_resize_uninitialized(&content, num_rows);
-    r_size = ::read(_tmp_file_fd, content.data(), content.size() * sizeof(content[0]));
+    r_size = ::pread(_tmp_file_fd, content.data(), content.size() * sizeof(content[0]),
+                     _read_offset + sizeof(num_rows));
     if (r_size != content.size() * sizeof(content[0])) {
         PLOG(WARNING) << "fail to read masks from mask file. read size=" << r_size;
         return Status::InternalError("fail to read masks from mask file");
     }
+    _read_offset += sizeof(num_rows) + r_size;
     _mask_column->get_data().swap(content);
     return Status::OK();
 }
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "column/fixed_length_column.h"
 #include "common/statusor.h"
 
@@ -74,6 +76,8 @@ struct RowSourceMask {
 class RowSourceMaskBuffer {
 public:
     explicit RowSourceMaskBuffer(int64_t tablet_id, std::string storage_root_path);
+    // The masks are persisted in blocks of at most |max_memory_bytes|, or max_row_source_mask_memory_bytes if 0.
+    RowSourceMaskBuffer(int64_t tablet_id, std::string storage_root_path, int64_t max_memory_bytes);
     ~RowSourceMaskBuffer();
 
     Status write(const std::vector<RowSourceMask>& source_masks);
@@ -87,6 +91,11 @@ public:
     Status flip_to_read();
     Status flush();
 
+    // Persists all the masks to the temporary file, after which new_reader() could be called concurrently.
+    Status persist();
+    // Returns a buffer that reads the persisted masks from the beginning, independent of this buffer.
+    StatusOr<std::unique_ptr<RowSourceMaskBuffer>> new_reader() const;
+
 private:
     void _reset_mask_column() { _mask_column->reset_column(); }
     Status _create_tmp_file();
@@ -95,8 +104,12 @@ private:
 
     UInt16Column::MutablePtr _mask_column;
 
+    int64_t _max_memory_bytes;
+
     // for read
     uint64_t _current_index = 0;
+    // The masks are read by offset, so that the readers sharing the temporary file do not interfere.
+    off_t _read_offset = 0;
 
     // temporary file for persistence
     int _tmp_file_fd = -1;
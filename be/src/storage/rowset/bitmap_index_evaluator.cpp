@@ -14,6 +14,8 @@
 
 #include "storage/rowset/bitmap_index_evaluator.h"
 
+#include <algorithm>
+
 #include "storage/chunk_helper.h"
 #include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/roaring2range.h"
@@ -110,10 +112,9 @@ struct BitmapIndexSeeker {
         size_t num_always_true_child = 0;
         size_t num_not_used_children = 0;
 
-        size_t mul_selected = 1;
-        size_t mul_cardinality = 1;
+        // The columns are assumed to be independent, so the selectivity of AND is the product of its children's.
+        double selectivity = 1;
         std::vector<ColumnId> cid_to_erase;
-        bool need_estimate_selectivity = false;
 
         for (const auto& [cid, col_ctx] : node_ctx.col_contexts) {
             for (const auto* col_node : col_ctx.nodes) {
@@ -137,9 +138,7 @@ struct BitmapIndexSeeker {
                 num_always_true_child += col_ctx.nodes.size();
             } else {
                 // OK
-                need_estimate_selectivity = true;
-                mul_selected *= col_ctx.bitmap_ranges.span_size();
-                mul_cardinality *= col_ctx.cardinality;
+                selectivity *= _column_selectivity(col_ctx);
             }
         }
 
@@ -157,7 +156,7 @@ struct BitmapIndexSeeker {
                 num_not_used_children++;
                 break;
             case ResultType::OK:
-                // Do nothing.
+                selectivity *= parent->_ctx.compound_node_to_context[&child].selectivity;
                 break;
             }
         }
@@ -179,13 +178,12 @@ struct BitmapIndexSeeker {
         // ---------------------------------------------------------
         // Estimate the selectivity of the bitmap index.
         // ---------------------------------------------------------
-        if (num_always_true_child + num_not_used_children >= num_children ||
-            (need_estimate_selectivity && mul_selected * 1000 > mul_cardinality * config::bitmap_max_filter_ratio)) {
+        if (num_always_true_child + num_not_used_children >= num_children || selectivity > _max_selectivity()) {
             return ResultType::NOT_USED;
         }
 
-        parent->_ctx.nodes_to_erase.insert(children_to_erase.begin(), children_to_erase.end());
-
+        node_ctx.children_to_erase = std::move(children_to_erase);
+        node_ctx.selectivity = selectivity;
         node_ctx.used = true;
         return ResultType::OK;
     }
@@ -202,10 +200,10 @@ struct BitmapIndexSeeker {
         size_t num_always_false_child = 0;
         bool has_not_used_child = false;
 
-        size_t mul_selected = 1;
-        size_t mul_cardinality = 1;
+        // The selectivity of OR is bounded by the sum of its children's, which does not underestimate the rows
+        // selected by the overlapped children.
+        double selectivity = 0;
         std::vector<ColumnId> cid_to_erase;
-        bool need_estimate_selectivity = false;
 
         for (const auto& [cid, col_ctx] : node_ctx.col_contexts) {
             for (const auto* col_node : col_ctx.nodes) {
@@ -230,9 +228,7 @@ struct BitmapIndexSeeker {
                 return ResultType::ALWAYS_TRUE;
             } else {
                 // OK
-                need_estimate_selectivity = true;
-                mul_selected *= col_ctx.bitmap_ranges.span_size();
-                mul_cardinality *= col_ctx.cardinality;
+                selectivity += _column_selectivity(col_ctx);
             }
         }
 
@@ -250,7 +246,7 @@ struct BitmapIndexSeeker {
                 has_not_used_child = true;
                 break;
             case ResultType::OK:
-                // Do nothing.
+                selectivity += parent->_ctx.compound_node_to_context[&child].selectivity;
                 break;
             }
         }
@@ -272,17 +268,27 @@ struct BitmapIndexSeeker {
         // ---------------------------------------------------------
         // Estimate the selectivity of the bitmap index.
         // ---------------------------------------------------------
-        if (num_always_false_child >= num_children ||
-            (need_estimate_selectivity && mul_selected * 1000 > mul_cardinality * config::bitmap_max_filter_ratio)) {
+        selectivity = std::min(selectivity, 1.0);
+        if (num_always_false_child >= num_children || selectivity > _max_selectivity()) {
             return ResultType::NOT_USED;
         }
 
-        parent->_ctx.nodes_to_erase.insert(children_to_erase.begin(), children_to_erase.end());
-
+        node_ctx.children_to_erase = std::move(children_to_erase);
+        node_ctx.selectivity = selectivity;
         node_ctx.used = true;
         return ResultType::OK;
     }
 
+    // The dictionary of the bitmap index has no row counts, so the rows are assumed to be distributed evenly
+    // over the values.
+    static double _column_selectivity(const BitmapContext::ColumnContext& col_ctx) {
+        return static_cast<double>(col_ctx.bitmap_ranges.span_size()) / col_ctx.cardinality;
+    }
+
+    // A node is evaluated by the bitmap index only if it filters out enough rows to pay for reading the bitmaps,
+    // otherwise its predicates are left to the scan.
+    static double _max_selectivity() { return config::bitmap_max_filter_ratio / 1000.0; }
+
     template <CompoundNodeType Type>
     StatusOr<bool> _seek_column_node(const PredicateColumnNode& node,
                                      BitmapContext::CompoundNodeContext& parent_node_ctx) const {
@@ -332,12 +338,29 @@ struct BitmapIndexRetriver {
         }
         const auto& node_ctx = it->second;
 
+        std::vector<std::pair<ColumnId, const BitmapContext::ColumnContext*>> col_contexts;
+        col_contexts.reserve(node_ctx.col_contexts.size());
         for (const auto& [cid, col_ctx] : node_ctx.col_contexts) {
+            col_contexts.emplace_back(cid, &col_ctx);
+        }
+        if constexpr (Type == CompoundNodeType::AND) {
+            // Read the bitmaps of the most selective column first, so that the others are skipped once the
+            // intersection is empty.
+            std::sort(col_contexts.begin(), col_contexts.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.second->bitmap_ranges.span_size() * rhs.second->cardinality <
+                       rhs.second->bitmap_ranges.span_size() * lhs.second->cardinality;
+            });
+        }
+
+        for (const auto& [cid, col_ctx] : col_contexts) {
+            if (_is_empty_intersection<Type>(result_roaring)) {
+                break;
+            }
             auto* bitmap_iter = parent->_bitmap_index_iterators[cid];
 
             Roaring roaring;
-            RETURN_IF_ERROR(bitmap_iter->read_union_bitmap(col_ctx.bitmap_ranges, &roaring));
-            if (bitmap_iter->has_null_bitmap() && !col_ctx.has_is_null_pred) {
+            RETURN_IF_ERROR(bitmap_iter->read_union_bitmap(col_ctx->bitmap_ranges, &roaring));
+            if (bitmap_iter->has_null_bitmap() && !col_ctx->has_is_null_pred) {
                 Roaring null_bitmap;
                 RETURN_IF_ERROR(bitmap_iter->read_null_bitmap(&null_bitmap));
                 roaring -= null_bitmap;
@@ -347,6 +370,9 @@ struct BitmapIndexRetriver {
         }
 
         for (const auto& child : node.compound_children()) {
+            if (_is_empty_intersection<Type>(result_roaring)) {
+                break;
+            }
             ASSIGN_OR_RETURN(auto roaring, child.visit(*this));
             if (!roaring.has_value()) {
                 continue;
@@ -354,9 +380,17 @@ struct BitmapIndexRetriver {
             _merge_roaring<Type>(result_roaring, roaring.value());
         }
 
+        // Only the predicates whose bitmaps are applied can be erased, the used nodes under an unused node are
+        // never retrieved and their predicates are kept.
+        parent->_ctx.nodes_to_erase.insert(node_ctx.children_to_erase.begin(), node_ctx.children_to_erase.end());
         return result_roaring;
     }
 
+    template <CompoundNodeType Type>
+    static bool _is_empty_intersection(const std::optional<Roaring>& result_roaring) {
+        return Type == CompoundNodeType::AND && result_roaring.has_value() && result_roaring->isEmpty();
+    }
+
     template <CompoundNodeType Type>
     void _merge_roaring(std::optional<Roaring>& result_roaring, Roaring& roaring) const {
         if (!result_roaring.has_value()) {
@@ -31,6 +31,10 @@ struct BitmapContext {
 
     struct CompoundNodeContext {
         std::unordered_map<ColumnId, ColumnContext> col_contexts;
+        // The estimated fraction of the rows selected by the node, valid when the node is used.
+        double selectivity = 1;
+        // The children evaluated by the bitmap index, which are erased only if the bitmap of the node is applied.
+        std::vector<const PredicateBaseNode*> children_to_erase;
         bool used = false;
     };
 
@@ -167,6 +167,14 @@ public:
         return Status::OK();
     }
 
+    /// Count the not-null rows with the page-level zone maps into |num_not_null|. The rows that can not be
+    /// answered without reading the data pages are stored into |mixed_row_ranges| instead.
+    virtual Status count_not_null_by_zone_map(uint64_t* num_not_null, SparseRange<>* mixed_row_ranges) {
+        *num_not_null = 0;
+        mixed_row_ranges->add({0, static_cast<rowid_t>(num_rows())});
+        return Status::OK();
+    }
+
     virtual bool has_original_bloom_filter_index() const { return false; }
     virtual bool has_ngram_bloom_filter_index() const { return false; }
     /// Treat the relationship between |predicates| as `(s_pred_1 OR s_pred_2 OR ... OR s_pred_n) AND (ns_pred_1 AND ns_pred_2 AND ... AND ns_pred_n)`,
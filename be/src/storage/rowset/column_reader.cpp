@@ -579,6 +579,44 @@ Status ColumnReader::zone_map_filter(const std::vector<const ColumnPredicate*>&
     return Status::OK();
 }
 
+Status ColumnReader::zone_map_count_not_null(const IndexReadOptions& opts, uint64_t* num_not_null,
+                                             SparseRange<>* mixed_row_ranges) {
+    *num_not_null = 0;
+    if (!is_nullable()) {
+        *num_not_null = num_rows();
+        return Status::OK();
+    }
+    if (_segment_zone_map != nullptr && _segment_zone_map->has_has_not_null()) {
+        if (!_segment_zone_map->has_not_null()) {
+            return Status::OK();
+        }
+        if (!_segment_zone_map->has_null()) {
+            *num_not_null = num_rows();
+            return Status::OK();
+        }
+    }
+    if (_zonemap_index == nullptr || _ordinal_index == nullptr) {
+        mixed_row_ranges->add({0, static_cast<rowid_t>(num_rows())});
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(load_ordinal_index(opts));
+    RETURN_IF_ERROR(_load_zonemap_index(opts));
+
+    const std::vector<ZoneMapPB>& zone_maps = _zonemap_index->page_zone_maps();
+    DCHECK_EQ(zone_maps.size(), _ordinal_index->num_data_pages());
+    for (int32_t i = 0; i < static_cast<int32_t>(zone_maps.size()); ++i) {
+        auto first = static_cast<rowid_t>(_ordinal_index->get_first_ordinal(i));
+        auto last = static_cast<rowid_t>(_ordinal_index->get_last_ordinal(i) + 1);
+        const ZoneMapPB& zm = zone_maps[i];
+        if (!zm.has_has_not_null() || (zm.has_null() && zm.has_not_null())) {
+            mixed_row_ranges->add({first, last});
+        } else if (zm.has_not_null()) {
+            *num_not_null += last - first;
+        }
+    }
+    return Status::OK();
+}
+
 template <CompoundNodeType PredRelation>
 Status ColumnReader::_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
                                       const ColumnPredicate* del_predicate,
@@ -636,6 +674,17 @@ bool ColumnReader::segment_zone_map_filter(const std::vector<const ColumnPredica
     return std::all_of(predicates.begin(), predicates.end(), filter);
 }
 
+bool ColumnReader::segment_zone_map_always_true(const ColumnPredicate* predicate) const {
+    if (_segment_zone_map == nullptr || predicate->type_info()->type() != _column_type) {
+        return false;
+    }
+    ZoneMapDetail detail;
+    if (!_parse_zone_map(_column_type, *_segment_zone_map, &detail).ok()) {
+        return false;
+    }
+    return predicate->zone_map_always_true(detail);
+}
+
 void ColumnReader::_update_sub_reader_pos(const TabletColumn* column, int pos) {
     if (column == nullptr) {
         return;
@@ -161,11 +161,20 @@ public:
                            std::unordered_set<uint32_t>* del_partial_filtered_pages, SparseRange<>* row_ranges,
                            const IndexReadOptions& opts, CompoundNodeType pred_relation);
 
+    // Count the not-null rows of this column with the page-level zone maps, without reading any data page.
+    // The pages having both null and not-null rows can not be answered by the zone maps, their rows are
+    // added to |mixed_row_ranges| and not counted in |num_not_null|.
+    Status zone_map_count_not_null(const IndexReadOptions& opts, uint64_t* num_not_null,
+                                   SparseRange<>* mixed_row_ranges);
+
     // segment-level zone map filter.
     // Return false to filter out this segment.
     // same as `match_condition`, used by vector engine.
     bool segment_zone_map_filter(const std::vector<const ::starrocks::ColumnPredicate*>& predicates) const;
 
+    // Return true if all the rows of this segment satisfy |predicate| according to the segment-level zone map.
+    bool segment_zone_map_always_true(const ::starrocks::ColumnPredicate* predicate) const;
+
     /// Treat the relationship between |predicates| as `(s_pred_1 OR s_pred_2 OR ... OR s_pred_n) AND (ns_pred_1 AND ns_pred_2 AND ... AND ns_pred_n)`,
     /// where s_pred_i denotes a predicate which supports bloom filter, and ns_pred_i denotes a predicate which does not support bloom filter.
     /// That is,
@@ -0,0 +1,208 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/column_statistics.h"
+
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "gutil/casts.h"
+#include "simd/simd.h"
+#include "storage/rowset/rowset.h"
+#include "util/hash_util.hpp"
+
+namespace starrocks {
+
+namespace {
+
+template <typename BinaryColumnType>
+void update_binary_hll(const Column& data, const uint8_t* nulls, HyperLogLog* hll) {
+    const auto& column = down_cast<const BinaryColumnType&>(data);
+    for (size_t i = 0; i < column.size(); i++) {
+        if (nulls == nullptr || !nulls[i]) {
+            Slice value = column.get_slice(i);
+            hll->update(HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED));
+        }
+    }
+}
+
+void update_fixed_length_hll(const Column& data, const uint8_t* nulls, HyperLogLog* hll) {
+    const uint8_t* values = data.raw_data();
+    const size_t type_size = data.type_size();
+    for (size_t i = 0; i < data.size(); i++) {
+        if (nulls == nullptr || !nulls[i]) {
+            hll->update(HashUtil::murmur_hash64A(values + i * type_size, type_size, HashUtil::MURMUR_SEED));
+        }
+    }
+}
+
+} // namespace
+
+ColumnStatistics::ColumnStatistics(LogicalType type) {
+    if (support_ndv(type)) {
+        _hll = std::make_unique<HyperLogLog>();
+    }
+}
+
+bool ColumnStatistics::support_ndv(LogicalType type) {
+    switch (type) {
+    case TYPE_BOOLEAN:
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_FLOAT:
+    case TYPE_DOUBLE:
+    case TYPE_DECIMALV2:
+    case TYPE_DECIMAL32:
+    case TYPE_DECIMAL64:
+    case TYPE_DECIMAL128:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+    case TYPE_CHAR:
+    case TYPE_VARCHAR:
+    case TYPE_VARBINARY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void ColumnStatistics::update(const Column& column) {
+    DCHECK(!column.is_constant());
+    _num_rows += static_cast<int64_t>(column.size());
+    const uint8_t* nulls = nullptr;
+    if (column.is_nullable() && column.has_null()) {
+        const auto& null_data = down_cast<const NullableColumn&>(column).immutable_null_column_data();
+        nulls = null_data.data();
+        _num_nulls += static_cast<int64_t>(SIMD::count_nonzero(null_data));
+    }
+    if (_hll == nullptr) {
+        return;
+    }
+
+    const Column* data = ColumnHelper::get_data_column(&column);
+    if (data->is_binary()) {
+        update_binary_hll<BinaryColumn>(*data, nulls, _hll.get());
+    } else if (data->is_large_binary()) {
+        update_binary_hll<LargeBinaryColumn>(*data, nulls, _hll.get());
+    } else {
+        update_fixed_length_hll(*data, nulls, _hll.get());
+    }
+}
+
+void ColumnStatistics::merge(const ColumnStatistics& other) {
+    _num_rows += other._num_rows;
+    _num_nulls += other._num_nulls;
+    if (_hll != nullptr && other._hll != nullptr) {
+        _hll->merge(*other._hll);
+    } else {
+        _hll.reset();
+    }
+}
+
+int64_t ColumnStatistics::ndv() const {
+    DCHECK(_hll != nullptr);
+    return _hll->estimate_cardinality();
+}
+
+void ColumnStatistics::to_pb(ColumnStatisticsPB* pb) const {
+    pb->set_num_rows(_num_rows);
+    pb->set_num_nulls(_num_nulls);
+    if (_hll != nullptr) {
+        std::string* buf = pb->mutable_ndv_hll();
+        buf->resize(_hll->max_serialized_size());
+        buf->resize(_hll->serialize(reinterpret_cast<uint8_t*>(buf->data())));
+    }
+}
+
+Status ColumnStatistics::from_pb(const ColumnStatisticsPB& pb) {
+    _num_rows = pb.num_rows();
+    _num_nulls = pb.num_nulls();
+    _hll.reset();
+    if (pb.has_ndv_hll()) {
+        _hll = std::make_unique<HyperLogLog>();
+        if (!_hll->deserialize(Slice(pb.ndv_hll()))) {
+            _hll.reset();
+            return Status::Corruption("invalid ndv sketch of the column statistics");
+        }
+    }
+    return Status::OK();
+}
+
+RowsetColumnStatistics::RowsetColumnStatistics(const TabletSchemaCSPtr& schema) {
+    _unique_ids.reserve(schema->num_columns());
+    _columns.reserve(schema->num_columns());
+    for (const auto& column : schema->columns()) {
+        _unique_ids.emplace_back(column.unique_id());
+        _columns.emplace_back(column.type());
+    }
+}
+
+void RowsetColumnStatistics::update(const Chunk& chunk) {
+    if (chunk.num_columns() != _columns.size()) {
+        // Not counted at all, so the statistics of the rowset are not added to the meta.
+        return;
+    }
+    for (size_t i = 0; i < _columns.size(); i++) {
+        _columns[i].update(*chunk.get_column_by_index(i));
+    }
+}
+
+void RowsetColumnStatistics::update(const Chunk& chunk, const std::vector<uint32_t>& column_indexes) {
+    DCHECK_EQ(chunk.num_columns(), column_indexes.size());
+    for (size_t i = 0; i < column_indexes.size(); i++) {
+        if (column_indexes[i] < _columns.size()) {
+            _columns[column_indexes[i]].update(*chunk.get_column_by_index(i));
+        }
+    }
+}
+
+void RowsetColumnStatistics::to_pb(int64_t num_rows, RowsetMetaPB* rowset_meta_pb) const {
+    rowset_meta_pb->clear_column_statistics();
+    for (size_t i = 0; i < _columns.size(); i++) {
+        if (_columns[i].num_rows() == num_rows) {
+            auto* pb = rowset_meta_pb->add_column_statistics();
+            pb->set_column_unique_id(_unique_ids[i]);
+            _columns[i].to_pb(pb);
+        }
+    }
+}
+
+StatusOr<bool> merge_rowset_column_statistics(const std::vector<RowsetSharedPtr>& rowsets,
+                                              TabletColumn::ColumnUID unique_id, ColumnStatistics* stats) {
+    for (const auto& rowset : rowsets) {
+        if (rowset->num_rows() == 0) {
+            continue;
+        }
+        const ColumnStatisticsPB* found = nullptr;
+        for (const auto& pb : rowset->rowset_meta()->get_meta_pb_without_schema().column_statistics()) {
+            if (pb.column_unique_id() == static_cast<uint32_t>(unique_id)) {
+                found = &pb;
+                break;
+            }
+        }
+        if (found == nullptr) {
+            return false;
+        }
+        ColumnStatistics rowset_stats;
+        RETURN_IF_ERROR(rowset_stats.from_pb(*found));
+        stats->merge(rowset_stats);
+    }
+    return true;
+}
+
+} // namespace starrocks
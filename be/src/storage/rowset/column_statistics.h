@@ -0,0 +1,88 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+#include "gen_cpp/olap_file.pb.h"
+#include "storage/tablet_schema.h"
+#include "types/hll.h"
+
+namespace starrocks {
+
+class Rowset;
+using RowsetSharedPtr = std::shared_ptr<Rowset>;
+
+// The number of rows and nulls of a column, and a HyperLogLog sketch of its distinct non-null values, which are
+// mergeable, so the statistics of a column of a tablet are merged from the statistics of its rowsets.
+class ColumnStatistics {
+public:
+    // Without the sketch of the distinct values.
+    ColumnStatistics() = default;
+    explicit ColumnStatistics(LogicalType type);
+
+    // Whether the distinct values of the columns of the type are counted, only for the scalar types.
+    static bool support_ndv(LogicalType type);
+
+    void update(const Column& column);
+
+    // The sketch of the distinct values is dropped if any side doesn't have it.
+    void merge(const ColumnStatistics& other);
+
+    int64_t num_rows() const { return _num_rows; }
+    int64_t num_nulls() const { return _num_nulls; }
+
+    bool has_ndv() const { return _hll != nullptr; }
+    // The estimated number of the distinct non-null values, only if has_ndv().
+    int64_t ndv() const;
+
+    void to_pb(ColumnStatisticsPB* pb) const;
+    Status from_pb(const ColumnStatisticsPB& pb);
+
+private:
+    int64_t _num_rows = 0;
+    int64_t _num_nulls = 0;
+    std::unique_ptr<HyperLogLog> _hll;
+};
+
+// The statistics of the columns of a rowset, updated by the chunks written to the rowset.
+class RowsetColumnStatistics {
+public:
+    explicit RowsetColumnStatistics(const TabletSchemaCSPtr& schema);
+
+    // The chunk contains all the columns of the schema.
+    void update(const Chunk& chunk);
+    // The column i of the chunk is the column column_indexes[i] of the schema.
+    void update(const Chunk& chunk, const std::vector<uint32_t>& column_indexes);
+
+    // Only the columns of which all the |num_rows| rows of the rowset are counted are added to the meta, e.g. none of
+    // them if some segments of the rowset are linked instead of written.
+    void to_pb(int64_t num_rows, RowsetMetaPB* rowset_meta_pb) const;
+
+private:
+    std::vector<TabletColumn::ColumnUID> _unique_ids;
+    std::vector<ColumnStatistics> _columns;
+};
+
+// Merges the statistics of the column |unique_id| of the rowsets into |stats|, returns false if a non-empty rowset
+// doesn't have them, e.g. a rowset written by a load rather than a compaction. |stats| should be constructed with the
+// type of the column to merge the sketches of the distinct values.
+StatusOr<bool> merge_rowset_column_statistics(const std::vector<RowsetSharedPtr>& rowsets,
+                                              TabletColumn::ColumnUID unique_id, ColumnStatistics* stats);
+
+} // namespace starrocks
@@ -229,8 +229,9 @@ public:
     // Speculate char/varchar encoding and reset encoding
     void speculate_column_and_set_encoding(const Column& column);
 
-    // Speculate char/varchar encoding
-    EncodingTypePB speculate_string_encoding(const BinaryColumn& bin_col);
+    // Speculate char/varchar encoding, `cardinality` returns the number of distinct values seen in `bin_col`,
+    // which is only accurate when dict encoding is chosen.
+    EncodingTypePB speculate_string_encoding(const BinaryColumn& bin_col, size_t* cardinality);
 
     Status finish_current_page() override { return _scalar_column_writer->finish_current_page(); };
 
@@ -530,6 +531,7 @@ inline Status ScalarColumnWriter::set_encoding(const EncodingTypePB& encoding) {
     _opts.meta->set_encoding(_encoding_info->encoding());
     PageBuilderOptions opts;
     opts.data_page_size = _opts.data_page_size;
+    opts.dict_page_size = _opts.dict_page_size;
     RETURN_IF_ERROR(_encoding_info->create_page_builder(opts, &page_builder));
     if (page_builder == nullptr) {
         return Status::NotSupported(strings::Substitute("Failed to create page builder for type $0 and encoding $1",
@@ -851,25 +853,35 @@ Status StringColumnWriter::append(const Column& column) {
 }
 
 inline void StringColumnWriter::speculate_column_and_set_encoding(const Column& column) {
-    Status st;
+    const BinaryColumn* bin_col = nullptr;
     if (column.is_nullable()) {
         const auto& data_col = down_cast<const NullableColumn&>(column).data_column();
-        const auto& bin_col = down_cast<BinaryColumn&>(*data_col);
-        const auto detect_encoding = speculate_string_encoding(bin_col);
-        st = _scalar_column_writer->set_encoding(detect_encoding);
+        bin_col = down_cast<const BinaryColumn*>(data_col.get());
     } else if (column.is_binary()) {
-        const auto& bin_col = down_cast<const BinaryColumn&>(column);
-        auto detect_encoding = speculate_string_encoding(bin_col);
-        st = _scalar_column_writer->set_encoding(detect_encoding);
+        bin_col = down_cast<const BinaryColumn*>(&column);
+    }
+    if (bin_col == nullptr) {
+        return;
+    }
+    size_t cardinality = 0;
+    const auto detect_encoding = speculate_string_encoding(*bin_col, &cardinality);
+    if (detect_encoding == DICT_ENCODING && cardinality <= config::low_cardinality_dictionary_max_values) {
+        // Long values of a low cardinality column may fill the default dictionary page, after that all the
+        // following pages fall back to plain encoding and the dict based optimizations are lost for the segment.
+        auto dict_page_size = std::max(config::dictionary_page_size, config::low_cardinality_dictionary_page_size);
+        _scalar_column_writer->set_dict_page_size(dict_page_size);
     }
+    Status st = _scalar_column_writer->set_encoding(detect_encoding);
     CHECK(st.ok()) << st;
 }
 
-inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const BinaryColumn& bin_col) {
+inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const BinaryColumn& bin_col,
+                                                                    size_t* cardinality) {
     auto row_count = bin_col.size();
     auto ratio = config::dictionary_encoding_ratio;
     auto max_card = static_cast<size_t>(static_cast<double>(row_count) * ratio);
 
+    *cardinality = row_count;
     if (row_count > dictionary_min_rowcount) {
         phmap::flat_hash_set<size_t> hash_set;
         for (size_t i = 0; i < row_count; i++) {
@@ -879,6 +891,7 @@ inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const Binary
                 return PLAIN_ENCODING;
             }
         }
+        *cardinality = hash_set.size();
     }
 
     return DICT_ENCODING;
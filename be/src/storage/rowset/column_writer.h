@@ -56,6 +56,7 @@ class BlockCompressionCodec;
 class WritableFile;
 
 class Column;
+class JsonPathStats;
 
 static const size_t dictionary_min_rowcount = 256;
 
@@ -65,6 +66,7 @@ struct ColumnWriterOptions {
     // - output: encoding/indexes/dict_page members
     ColumnMetaPB* meta;
     uint32_t data_page_size = config::data_page_size;
+    uint32_t dict_page_size = config::dictionary_page_size;
     uint32_t page_format = 2;
     // store compressed page only when space saving is above the threshold.
     // space saving = 1 - compressed_size / uncompressed_size
@@ -87,6 +89,8 @@ struct ColumnWriterOptions {
 
     bool need_flat = false;
     bool is_compaction = false;
+    // the path statistics of the json column of the tablet, nullptr if not kept
+    std::shared_ptr<JsonPathStats> json_path_stats;
 
     std::string field_name;
 };
@@ -177,6 +181,9 @@ public:
     // rebuild char/varchar encoding when _page_builder is empty
     Status set_encoding(const EncodingTypePB& encoding);
 
+    // Limit of the dictionary page size, it takes effect on the page builder created by the next `set_encoding`.
+    void set_dict_page_size(uint32_t dict_page_size) { _opts.dict_page_size = dict_page_size; }
+
     Status finish_current_page() override;
 
     uint64_t estimate_buffer_size() override;
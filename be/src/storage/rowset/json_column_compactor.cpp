@@ -48,6 +48,7 @@ Status FlatJsonColumnCompactor::_compact_columns(std::vector<ColumnPtr>& json_da
         vc.emplace_back(js.get());
     }
     deriver.set_generate_filter(true);
+    deriver.set_path_stats(_path_stats);
     deriver.derived(vc);
 
     _flat_paths = deriver.flat_paths();
@@ -51,7 +51,8 @@ FlatJsonColumnWriter::FlatJsonColumnWriter(const ColumnWriterOptions& opts, Type
         : ColumnWriter(std::move(type_info), opts.meta->length(), opts.meta->is_nullable()),
           _json_meta(opts.meta),
           _wfile(wfile),
-          _json_writer(std::move(json_writer)) {}
+          _json_writer(std::move(json_writer)),
+          _path_stats(opts.json_path_stats) {}
 
 Status FlatJsonColumnWriter::init() {
     _json_meta->mutable_json_meta()->set_format_version(kJsonMetaDefaultFormatVersion);
@@ -86,6 +87,7 @@ Status FlatJsonColumnWriter::_flat_column(std::vector<ColumnPtr>& json_datas) {
     for (const auto& js : json_datas) {
         vc.emplace_back(js.get());
     }
+    deriver.set_path_stats(_path_stats);
     deriver.derived(vc);
 
     _flat_paths = deriver.flat_paths();
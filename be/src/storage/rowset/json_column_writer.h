@@ -72,5 +72,7 @@ protected:
     bool _has_remain;
     std::shared_ptr<BloomFilter> _remain_filter;
     bool _is_flat = false;
+
+    std::shared_ptr<JsonPathStats> _path_stats;
 };
 } // namespace starrocks
@@ -42,6 +42,7 @@
 #include "common/logging.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
+#include "io/io_latency_metrics.h"
 #include "storage/page_cache.h"
 #include "storage/rowset/storage_page_decoder.h"
 #include "util/coding.h"
@@ -171,6 +172,7 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     Slice page_slice(page.get(), page_size);
     {
         SCOPED_RAW_TIMER(&opts.stats->io_ns);
+        ScopedIOLatencyTimer io_latency_timer(IOSource::PAGE_CACHE_MISS);
         // todo override is_cache_hit
         if (opts.read_file->is_cache_hit()) {
             RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
@@ -49,6 +49,7 @@
 #include "storage/delete_predicates.h"
 #include "storage/empty_iterator.h"
 #include "storage/index/index_descriptor.h"
+#include "storage/index/sorted/rowset_sorted_index.h"
 #include "storage/merge_iterator.h"
 #include "storage/projection_iterator.h"
 #include "storage/rowset/metadata_cache.h"
@@ -345,6 +346,20 @@ Status Rowset::remove() {
             }
         }
     }
+    for (const auto& column : _schema->columns()) {
+        if (!RowsetSortedIndex::is_supported_column(column)) {
+            continue;
+        }
+        std::string sorted_index_path =
+                IndexDescriptor::sorted_index_file_path(_rowset_path, rowset_id().to_string(), column.unique_id());
+        if (!fs->path_exists(sorted_index_path).ok()) {
+            // The sorted index is built in the background, and may be not built yet.
+            continue;
+        }
+        auto st = fs->delete_file(sorted_index_path);
+        LOG_IF(WARNING, !st.ok()) << "Fail to delete sorted_index_path " << sorted_index_path << ": " << st;
+        merge_status(st);
+    }
     for (int i = 0, sz = num_delete_files(); i < sz; ++i) {
         std::string path = segment_del_file_path(_rowset_path, rowset_id(), i);
         auto st = fs->delete_file(path);
@@ -415,9 +430,10 @@ Status Rowset::_remove_delta_column_group_files(const std::shared_ptr<FileSystem
     return Status::OK();
 }
 
-Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version) {
+Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version,
+                             int32_t segment_id_offset) {
     for (int i = 0; i < num_segments(); ++i) {
-        std::string dst_link_path = segment_file_path(dir, new_rowset_id, i);
+        std::string dst_link_path = segment_file_path(dir, new_rowset_id, i + segment_id_offset);
         std::string src_file_path = segment_file_path(_rowset_path, rowset_id(), i);
         if (link(src_file_path.c_str(), dst_link_path.c_str()) != 0) {
             PLOG(WARNING) << "Fail to link " << src_file_path << " to " << dst_link_path;
@@ -432,7 +448,7 @@ Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId
             for (const auto& index : indexes) {
                 if (index.index_type() == GIN) {
                     std::string dst_inverted_link_path = IndexDescriptor::inverted_index_file_path(
-                            dir, new_rowset_id.to_string(), segment_n, index.index_id());
+                            dir, new_rowset_id.to_string(), segment_n + segment_id_offset, index.index_id());
                     std::string src_inverted_file_path = IndexDescriptor::inverted_index_file_path(
                             _rowset_path, rowset_id().to_string(), segment_n, index.index_id());
 
@@ -451,7 +467,7 @@ Status Rowset::link_files_to(KVStore* kvstore, const std::string& dir, RowsetId
                     }
                 } else if (index.index_type() == VECTOR) {
                     std::string dst_index_link_path = IndexDescriptor::vector_index_file_path(
-                            dir, new_rowset_id.to_string(), segment_n, index.index_id());
+                            dir, new_rowset_id.to_string(), segment_n + segment_id_offset, index.index_id());
                     std::string src_index_file_path = IndexDescriptor::vector_index_file_path(
                             _rowset_path, rowset_id().to_string(), segment_n, index.index_id());
                     if (link(src_index_file_path.c_str(), dst_index_link_path.c_str()) != 0) {
@@ -758,6 +774,17 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
         }
     }
 
+    // The candidate rows of each segment found by the sorted index of the rowset, empty if the index is not used.
+    std::vector<SparseRangePtr> sorted_index_ranges;
+    if (config::enable_rowset_sorted_index && options.reader_type == READER_QUERY && !options.is_primary_keys &&
+        options.tablet_schema != nullptr && !options.pred_tree.empty()) {
+        auto st = RowsetSortedIndex::lookup(*this, *options.tablet_schema, options.pred_tree, &sorted_index_ranges);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to look up the sorted index of rowset " << rowset_id() << ": " << st;
+            sorted_index_ranges.clear();
+        }
+    }
+
     std::vector<ChunkIteratorPtr> tmp_seg_iters;
     tmp_seg_iters.reserve(num_segments());
     if (options.stats) {
@@ -768,6 +795,16 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
             continue;
         }
 
+        SparseRangePtr sorted_index_range = nullptr;
+        if (!sorted_index_ranges.empty()) {
+            DCHECK_LT(seg_ptr->id(), sorted_index_ranges.size());
+            sorted_index_range = sorted_index_ranges[seg_ptr->id()];
+            if (sorted_index_range->empty()) {
+                continue;
+            }
+        }
+
+        seg_options.rowid_range_option = nullptr;
         if (options.rowid_range_option != nullptr) { // physical split.
             auto [rowid_range, is_first_split_of_segment] =
                     options.rowid_range_option->get_segment_rowid_range(this, seg_ptr.get());
@@ -781,6 +818,14 @@ Status Rowset::get_segment_iterators(const Schema& schema, const RowsetReadOptio
         } else {
             seg_options.is_first_split_of_segment = true;
         }
+        if (sorted_index_range != nullptr) {
+            if (seg_options.rowid_range_option != nullptr) {
+                seg_options.rowid_range_option =
+                        std::make_shared<SparseRange<>>(*seg_options.rowid_range_option & *sorted_index_range);
+            } else {
+                seg_options.rowid_range_option = std::move(sorted_index_range);
+            }
+        }
 
         auto res = seg_ptr->new_iterator(segment_schema, seg_options);
         if (res.status().is_end_of_file()) {
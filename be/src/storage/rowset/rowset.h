@@ -288,7 +288,9 @@ public:
 
     // hard link all files in this rowset to `dir` to form a new rowset with id `new_rowset_id`.
     // `version` is used for link col files, default using INT64_MAX means link all col files
-    Status link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version = INT64_MAX);
+    // `segment_id_offset` is added to the segment ids of the links, to link several rowsets to one new rowset.
+    Status link_files_to(KVStore* kvstore, const std::string& dir, RowsetId new_rowset_id, int64_t version = INT64_MAX,
+                         int32_t segment_id_offset = 0);
 
     // copy all files to `dir`
     Status copy_files_to(KVStore* kvstore, const std::string& dir);
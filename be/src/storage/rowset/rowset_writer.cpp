@@ -123,6 +123,7 @@ Status RowsetWriter::init() {
     _writer_options.global_dicts = _context.global_dicts != nullptr ? _context.global_dicts : nullptr;
     _writer_options.referenced_column_ids = _context.referenced_column_ids;
     _writer_options.is_compaction = _context.is_compaction;
+    _writer_options.tablet_id = _context.tablet_id;
 
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS &&
         (_context.is_partial_update || !_context.merge_condition.empty() || _context.miss_auto_increment_column)) {
@@ -131,6 +132,10 @@ Status RowsetWriter::init() {
 
     ASSIGN_OR_RETURN(_fs, FileSystem::CreateSharedFromString(_context.rowset_path_prefix));
 
+    if (_context.is_compaction && config::enable_compaction_column_statistics) {
+        _column_statistics = std::make_unique<RowsetColumnStatistics>(_context.tablet_schema);
+    }
+
     if (_context.is_pk_compaction) {
         TabletSharedPtr tablet = StorageEngine::instance()->tablet_manager()->get_tablet(_context.tablet_id);
         if (tablet != nullptr) {
@@ -157,6 +162,9 @@ StatusOr<RowsetSharedPtr> RowsetWriter::build() {
     // newly created rowset do not have rowset_id yet, use 0 instead
     _rowset_meta_pb->set_rowset_seg_id(0);
     _rowset_meta_pb->set_gtid(_context.gtid);
+    if (_column_statistics != nullptr) {
+        _column_statistics->to_pb(_num_rows_written, _rowset_meta_pb.get());
+    }
     // updatable tablet require extra processing
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS) {
         DCHECK(_delfile_idxes.size() == _num_delfile);
@@ -571,6 +579,9 @@ Status HorizontalRowsetWriter::add_chunk(const Chunk& chunk, const std::vector<u
     if (_rows_mapper_builder != nullptr) {
         RETURN_IF_ERROR(_rows_mapper_builder->append(rssid_rowids));
     }
+    if (_column_statistics != nullptr) {
+        _column_statistics->update(chunk);
+    }
     _num_rows_written += static_cast<int64_t>(chunk.num_rows());
     _total_row_size += static_cast<int64_t>(chunk.bytes_usage());
     return Status::OK();
@@ -710,7 +721,7 @@ Status HorizontalRowsetWriter::flush_chunk_with_deletes(const Chunk& upserts, co
 Status HorizontalRowsetWriter::add_rowset(RowsetSharedPtr rowset) {
     TabletSharedPtr tablet = StorageEngine::instance()->tablet_manager()->get_tablet(_context.tablet_id);
     RETURN_IF_ERROR(rowset->link_files_to(tablet == nullptr ? nullptr : tablet->data_dir()->get_meta(),
-                                          _context.rowset_path_prefix, _context.rowset_id));
+                                          _context.rowset_path_prefix, _context.rowset_id, INT64_MAX, _num_segment));
     _num_rows_written += rowset->num_rows();
     _total_row_size += static_cast<int64_t>(rowset->total_row_size());
     _total_data_size += static_cast<int64_t>(rowset->rowset_meta()->data_disk_size());
@@ -1254,6 +1265,9 @@ Status VerticalRowsetWriter::add_columns(const Chunk& chunk, const std::vector<u
         }
     }
 
+    if (_column_statistics != nullptr) {
+        _column_statistics->update(chunk, column_indexes);
+    }
     if (is_key) {
         _num_rows_written += static_cast<int64_t>(chunk_num_rows);
     }
@@ -47,6 +47,7 @@
 #include "storage/column_mapping.h"
 #include "storage/compaction_utils.h"
 #include "storage/rows_mapper.h"
+#include "storage/rowset/column_statistics.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
@@ -214,6 +215,9 @@ protected:
     DictColumnsValidMap _global_dict_columns_valid_info;
 
     std::unique_ptr<RowsMapperBuilder> _rows_mapper_builder;
+
+    // The statistics of the columns written by compaction, nullptr if not collected.
+    std::unique_ptr<RowsetColumnStatistics> _column_statistics;
 };
 
 class VerticalRowsetWriter;
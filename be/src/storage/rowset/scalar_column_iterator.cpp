@@ -208,7 +208,7 @@ Status ScalarColumnIterator::next_batch(size_t* n, Column* dst) {
             RETURN_IF_ERROR(_load_next_page(&eos));
             if (eos) {
                 // release shareBufferStream
-                if (config::io_coalesce_lake_read_enable && _opts.is_io_coalesce) {
+                if (_opts.is_io_coalesce) {
                     auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
                     if (shared_buffer_stream != nullptr) {
                         shared_buffer_stream->release();
@@ -252,7 +252,7 @@ Status ScalarColumnIterator::next_batch(const SparseRange<>& range, Column* dst)
             RETURN_IF_ERROR(_load_next_page(&eos));
             if (eos) {
                 // release shareBufferStream
-                if (config::io_coalesce_lake_read_enable && _opts.is_io_coalesce) {
+                if (_opts.is_io_coalesce) {
                     auto shared_buffer_stream = dynamic_cast<io::SharedBufferedInputStream*>(_opts.read_file);
                     if (shared_buffer_stream != nullptr) {
                         shared_buffer_stream->release();
@@ -396,6 +396,17 @@ Status ScalarColumnIterator::get_row_ranges_by_zone_map(const std::vector<const
     return Status::OK();
 }
 
+Status ScalarColumnIterator::count_not_null_by_zone_map(uint64_t* num_not_null, SparseRange<>* mixed_row_ranges) {
+    IndexReadOptions opts;
+    opts.use_page_cache = !_opts.temporary_data && _opts.use_page_cache &&
+                          (config::enable_zonemap_index_memory_page_cache || !config::disable_storage_page_cache);
+    opts.kept_in_memory = !_opts.temporary_data && config::enable_zonemap_index_memory_page_cache;
+    opts.lake_io_opts = _opts.lake_io_opts;
+    opts.read_file = _opts.read_file;
+    opts.stats = _opts.stats;
+    return _reader->zone_map_count_not_null(opts, num_not_null, mixed_row_ranges);
+}
+
 bool ScalarColumnIterator::has_original_bloom_filter_index() const {
     return _reader->has_original_bloom_filter_index();
 }
@@ -69,6 +69,8 @@ public:
                                       const ColumnPredicate* del_predicate, SparseRange<>* range,
                                       CompoundNodeType pred_relationn) override;
 
+    Status count_not_null_by_zone_map(uint64_t* num_not_null, SparseRange<>* mixed_row_ranges) override;
+
     bool has_original_bloom_filter_index() const override;
     bool has_ngram_bloom_filter_index() const override;
     Status get_row_ranges_by_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
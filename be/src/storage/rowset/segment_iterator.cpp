@@ -19,6 +19,7 @@
 #include <stack>
 #include <unordered_map>
 
+#include "column/array_column.h"
 #include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column_helper.h"
@@ -40,8 +41,10 @@
 #include "storage/column_predicate_rewriter.h"
 #include "storage/del_vector.h"
 #include "storage/index/index_descriptor.h"
+#include "storage/index/vector/empty_index_reader.h"
 #include "storage/index/vector/tenann/del_id_filter.h"
 #include "storage/index/vector/tenann/tenann_index_utils.h"
+#include "storage/index/vector/vector_exact_search.h"
 #include "storage/index/vector/vector_index_reader.h"
 #include "storage/index/vector/vector_index_reader_factory.h"
 #include "storage/index/vector/vector_search_option.h"
@@ -209,6 +212,8 @@ private:
 
     Status _init();
     Status _try_to_update_ranges_by_runtime_filter();
+    Status _get_row_ranges_by_runtime_filter_predicates(ColumnId cid, const PredicateList& predicates,
+                                                        SparseRange<>* r);
     Status _do_get_next(Chunk* result, vector<rowid_t>* rowid);
 
     template <bool check_global_dict>
@@ -217,6 +222,7 @@ private:
     StatusOr<SparseRange<>> _get_row_ranges_by_key_ranges();
     StatusOr<SparseRange<>> _get_row_ranges_by_short_key_ranges();
     Status _get_row_ranges_by_zone_map();
+    Status _get_row_ranges_by_runtime_filter();
     Status _get_row_ranges_by_vector_index();
     Status _get_row_ranges_by_bloom_filter();
     Status _get_row_ranges_by_rowid_range();
@@ -299,6 +305,10 @@ private:
 
     Status _init_ann_reader();
 
+    // Returns false if the exact search is not applicable and the vector index should be searched. The segment
+    // whose index is deferred is always searched exactly, skipping the null and mismatched vectors as the index.
+    StatusOr<bool> _exact_vector_search(std::vector<int64_t>* result_ids, std::vector<float>* result_distances);
+
 private:
     using RawColumnIterators = std::vector<std::unique_ptr<ColumnIterator>>;
     using ColumnDecoders = std::vector<ColumnDecoder>;
@@ -380,6 +390,11 @@ private:
     double _vector_range;
     int _result_order;
     bool _use_ivfpq;
+    int32_t _vector_column_uid = -1;
+    std::string _vector_metric_type;
+    bool _is_vector_normed = false;
+    // The vector index of the segment is not built yet, see config::enable_vector_index_deferred_build.
+    bool _vector_index_deferred = false;
     Buffer<uint8_t> _filter_selection;
     Buffer<uint8_t> _filter_by_expr_selection;
 
@@ -506,6 +521,7 @@ Status SegmentIterator::_init() {
     // Support prefilter for now
     RETURN_IF_ERROR(_apply_bitmap_index());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
+    RETURN_IF_ERROR(_get_row_ranges_by_runtime_filter());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
     RETURN_IF_ERROR(_apply_inverted_index());
     if (apply_del_vec_after_all_index_filter) {
@@ -542,6 +558,11 @@ inline Status SegmentIterator::_init_reader_from_file(const std::string& index_p
     auto status = _ann_reader->init_searcher(*_index_meta.get(), index_path);
     // means empty ann reader
     if (status.is_not_supported()) {
+        auto* empty_reader = dynamic_cast<EmptyIndexReader*>(_ann_reader.get());
+        if (empty_reader != nullptr && empty_reader->is_deferred()) {
+            _vector_index_deferred = true;
+            return Status::OK();
+        }
         _use_vector_index = false;
         return Status::OK();
     }
@@ -576,6 +597,14 @@ Status SegmentIterator::_init_ann_reader() {
     }
 
     auto tablet_index_meta = std::make_shared<TabletIndex>(hit_indexes[0]);
+    _vector_column_uid = tablet_index_meta->col_unique_ids()[0];
+    const auto& common_properties = tablet_index_meta->common_properties();
+    if (auto it = common_properties.find(index::vector::METRIC_TYPE); it != common_properties.end()) {
+        _vector_metric_type = it->second;
+    }
+    if (auto it = common_properties.find(index::vector::IS_VECTOR_NORMED); it != common_properties.end()) {
+        _is_vector_normed = boost::algorithm::to_lower_copy(it->second) == "true";
+    }
 
     std::string index_path = IndexDescriptor::vector_index_file_path(_opts.rowset_path, _opts.rowsetid.to_string(),
                                                                      segment_id(), tablet_index_meta->index_id());
@@ -602,7 +631,22 @@ Status SegmentIterator::_get_row_ranges_by_vector_index() {
 
     {
         SCOPED_RAW_TIMER(&_opts.stats->vector_search_timer);
-        if (_vector_range > 0) {
+        // Few rows are left by the other filters, compute their distances rather than searching the index
+        // with them as the allowed ids, which may find less than k of them.
+        ASSIGN_OR_RETURN(bool exact_searched, _exact_vector_search(&result_ids, &result_distances));
+        if (exact_searched) {
+            _opts.stats->rows_vector_exact_searched += _scan_range.span_size();
+        } else if (_vector_index_deferred) {
+            // The distances of the ivfpq index are computed again above the storage, return all the rows as
+            // the empty index of a small segment.
+            if (_use_ivfpq) {
+                _use_vector_index = false;
+                return Status::OK();
+            }
+            return Status::NotSupported(fmt::format(
+                    "The vector index of segment {} is not built yet and its metric {} can not be searched exactly",
+                    _segment->file_name(), _vector_metric_type));
+        } else if (_vector_range > 0) {
             st = _ann_reader->range_search(_query_view, _k, &result_ids, &result_distances, &del_id_filter,
                                            static_cast<float>(_vector_range), _result_order);
         } else {
@@ -649,6 +693,96 @@ Status SegmentIterator::_get_row_ranges_by_vector_index() {
 #endif
 }
 
+#ifdef WITH_TENANN
+StatusOr<bool> SegmentIterator::_exact_vector_search(std::vector<int64_t>* result_ids,
+                                                     std::vector<float>* result_distances) {
+    if (!_vector_index_deferred) {
+        const int64_t max_rows = config::vector_search_exact_max_rows;
+        RETURN_IF(max_rows <= 0 || _scan_range.span_size() > max_rows, false);
+    }
+    auto metric = VectorExactSearch::parse_metric(_vector_metric_type);
+    RETURN_IF(!metric.ok(), false);
+    FieldPtr vector_field;
+    for (const auto& field : _schema.fields()) {
+        if (field->uid() == _vector_column_uid) {
+            vector_field = field;
+            break;
+        }
+    }
+    RETURN_IF(vector_field == nullptr || _column_iterators[vector_field->id()] == nullptr, false);
+
+    const float* query = _opts.vector_search_option->query_vector.data();
+    const size_t dim = _opts.vector_search_option->query_vector.size();
+    const int64_t k = _opts.vector_search_option->k;
+    const size_t batch_size = config::vector_chunk_size;
+    std::vector<int64_t> ids;
+    std::vector<float> distances;
+    std::vector<int64_t> closest_ids;
+    std::vector<float> closest_distances;
+    std::vector<rowid_t> rowids;
+    auto column = ChunkHelper::column_from_field(*vector_field);
+    // Read and search the rows by batches, keeping only the closest ones of the searched rows, to bound the memory
+    // for the whole segment without the index.
+    SparseRangeIterator<> range_iter = _scan_range.new_iterator();
+    while (range_iter.has_more()) {
+        rowids.clear();
+        while (range_iter.has_more() && rowids.size() < batch_size) {
+            Range<> r = range_iter.next(batch_size - rowids.size());
+            for (rowid_t i = r.begin(); i < r.end(); i++) {
+                rowids.push_back(i);
+            }
+        }
+        column->reset_column();
+        RETURN_IF_ERROR(_column_iterators[vector_field->id()]->fetch_values_by_rowid(rowids.data(), rowids.size(),
+                                                                                     column.get()));
+
+        const auto* array = down_cast<const ArrayColumn*>(ColumnHelper::get_data_column(column.get()));
+        const auto& offsets = array->offsets().get_data();
+        const uint8_t* element_nulls = nullptr;
+        if (array->elements().has_null()) {
+            element_nulls = down_cast<const NullableColumn&>(array->elements()).immutable_null_column_data().data();
+        }
+        const auto* elements = down_cast<const FloatColumn*>(ColumnHelper::get_data_column(&array->elements()));
+        const float* values = elements->get_data().data();
+
+        // The valid vectors of adjacent rows are contiguous, compute their distances together.
+        size_t run_begin = 0;
+        auto search_run = [&](size_t run_end) {
+            if (run_end <= run_begin) {
+                return;
+            }
+            size_t num_rows = run_end - run_begin;
+            ids.insert(ids.end(), rowids.begin() + run_begin, rowids.begin() + run_end);
+            distances.resize(distances.size() + num_rows);
+            VectorExactSearch::compute_distances(metric.value(), _is_vector_normed, query, values + offsets[run_begin],
+                                                 dim, num_rows, distances.data() + distances.size() - num_rows);
+        };
+        for (size_t i = 0; i < rowids.size(); i++) {
+            bool valid = !column->is_null(i) && offsets[i + 1] - offsets[i] == dim &&
+                         (element_nulls == nullptr || SIMD::count_nonzero(element_nulls + offsets[i], dim) == 0);
+            if (valid) {
+                continue;
+            }
+            // The null vectors or elements never match, leave them to the index if it is built.
+            RETURN_IF(!_vector_index_deferred, false);
+            search_run(i);
+            run_begin = i + 1;
+        }
+        search_run(rowids.size());
+
+        if (ids.size() > static_cast<size_t>(std::max<int64_t>(k, 0)) + batch_size) {
+            VectorExactSearch::select_closest(metric.value(), ids, distances, k, _vector_range, &closest_ids,
+                                              &closest_distances);
+            ids.swap(closest_ids);
+            distances.swap(closest_distances);
+        }
+    }
+    // The exact distances need no refinement, so the k of the query is enough.
+    VectorExactSearch::select_closest(metric.value(), ids, distances, k, _vector_range, result_ids, result_distances);
+    return true;
+}
+#endif
+
 Status SegmentIterator::_get_row_ranges_by_row_ids(std::vector<int64_t>* result_ids, SparseRange<>* r) {
     if (result_ids->empty()) {
         return Status::OK();
@@ -681,17 +815,38 @@ Status SegmentIterator::_get_row_ranges_by_row_ids(std::vector<int64_t>* result_
     return Status::OK();
 }
 
-Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
+Status SegmentIterator::_get_row_ranges_by_runtime_filter_predicates(ColumnId cid, const PredicateList& predicates,
+                                                                     SparseRange<>* r) {
+    const ColumnPredicate* del_pred;
+    auto iter = _del_predicates.find(cid);
+    del_pred = iter != _del_predicates.end() ? &(iter->second) : nullptr;
+    return _column_iterators[cid]->get_row_ranges_by_zone_map(predicates, del_pred, r, CompoundNodeType::AND);
+}
+
+// Runtime filters arrived before the segment is opened are applied in the index filter stage,
+// so that the pages they exclude are neither read nor taken into io coalescing, and a segment
+// excluded entirely skips the rest of the index stage.
+Status SegmentIterator::_get_row_ranges_by_runtime_filter() {
+    RETURN_IF(_scan_range.empty(), Status::OK());
     return _opts.runtime_range_pruner.update_range_if_arrived(
             _opts.global_dictmaps,
             [this](auto cid, const PredicateList& predicates) {
-                const ColumnPredicate* del_pred;
-                auto iter = _del_predicates.find(cid);
-                del_pred = iter != _del_predicates.end() ? &(iter->second) : nullptr;
                 SparseRange<> r;
+                RETURN_IF_ERROR(_get_row_ranges_by_runtime_filter_predicates(cid, predicates, &r));
+                size_t prev_size = _scan_range.span_size();
+                _scan_range &= r;
+                _opts.stats->runtime_stats_filtered += (prev_size - _scan_range.span_size());
+                return Status::OK();
+            },
+            _opts.stats->raw_rows_read);
+}
 
-                RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(predicates, del_pred, &r,
-                                                                                   CompoundNodeType::AND));
+Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
+    return _opts.runtime_range_pruner.update_range_if_arrived(
+            _opts.global_dictmaps,
+            [this](auto cid, const PredicateList& predicates) {
+                SparseRange<> r;
+                RETURN_IF_ERROR(_get_row_ranges_by_runtime_filter_predicates(cid, predicates, &r));
                 size_t prev_size = _scan_range.span_size();
                 SparseRange<> res;
                 res.set_sorted(_scan_range.is_sorted());
@@ -791,8 +946,10 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
             opts.encryption_info = *encryption_info;
         }
         ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
-        if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
-            _segment->lake_tablet_manager() != nullptr) {
+        bool is_lake = _segment->lake_tablet_manager() != nullptr;
+        bool enable_io_coalesce =
+                is_lake ? config::io_coalesce_lake_read_enable : config::io_coalesce_local_read_enable;
+        if (enable_io_coalesce && !_segment->is_default_column(col)) {
             ASSIGN_OR_RETURN(auto file_size, rfile->get_size());
             auto shared_buffered_input_stream =
                     std::make_unique<io::SharedBufferedInputStream>(rfile->stream(), _segment->file_name(), file_size);
@@ -906,6 +1063,28 @@ struct ExprPredicateChecker {
     }
 };
 
+// If all the rows of this segment satisfy the predicate according to the segment-level zone map,
+// there is no need to evaluate it row by row.
+struct SegmentZoneMapAlwaysTrueChecker {
+    bool operator()(const PredicateColumnNode& node) const {
+        const auto* col_pred = node.col_pred();
+        const ColumnId cid = col_pred->column_id();
+        if (is_string_type(col_pred->type_info()->type()) || cid >= column_iterators.size() ||
+            column_iterators[cid] == nullptr) {
+            return false;
+        }
+        const auto* reader = column_iterators[cid]->get_column_reader();
+        return reader != nullptr && reader->segment_zone_map_always_true(col_pred);
+    }
+
+    template <CompoundNodeType Type>
+    bool operator()(const PredicateCompoundNode<Type>& node) const {
+        return false;
+    }
+
+    const std::vector<std::unique_ptr<ColumnIterator>>& column_iterators;
+};
+
 void SegmentIterator::_init_column_predicates() {
     PredicateAndNode useless_pred_root;
     PredicateAndNode used_pred_root;
@@ -917,7 +1096,18 @@ void SegmentIterator::_init_column_predicates() {
     used_pred_root.partition_move([](auto& node) { return node.visit(ExprPredicateChecker()); }, &expr_pred_root,
                                   &non_expr_pred_root);
     _expr_pred_tree = PredicateTree::create(std::move(expr_pred_root));
-    _non_expr_pred_tree = PredicateTree::create(std::move(non_expr_pred_root));
+
+    // The segment-level zone map may be stale if the segment has delta column groups.
+    if (config::enable_index_segment_level_zonemap_filter && _dcgs.empty()) {
+        PredicateAndNode always_true_pred_root;
+        PredicateAndNode remaining_pred_root;
+        non_expr_pred_root.partition_move(
+                [&](auto& node) { return node.visit(SegmentZoneMapAlwaysTrueChecker{_column_iterators}); },
+                &always_true_pred_root, &remaining_pred_root);
+        _non_expr_pred_tree = PredicateTree::create(std::move(remaining_pred_root));
+    } else {
+        _non_expr_pred_tree = PredicateTree::create(std::move(non_expr_pred_root));
+    }
 }
 
 Status SegmentIterator::_get_row_ranges_by_keys() {
@@ -2113,12 +2303,9 @@ Status SegmentIterator::_apply_bitmap_index() {
 Status SegmentIterator::_apply_del_vector() {
     RETURN_IF(_scan_range.empty(), Status::OK());
     if (_opts.is_primary_keys && _opts.version > 0 && _del_vec && !_del_vec->empty()) {
-        Roaring row_bitmap = range2roaring(_scan_range);
-        size_t input_rows = row_bitmap.cardinality();
-        row_bitmap -= *(_del_vec->roaring());
-        _scan_range = roaring2range(row_bitmap);
-        size_t filtered_rows = row_bitmap.cardinality();
-        _opts.stats->rows_del_vec_filtered += input_rows - filtered_rows;
+        size_t input_rows = _scan_range.span_size();
+        _scan_range -= _del_vec->deleted_ranges();
+        _opts.stats->rows_del_vec_filtered += input_rows - _scan_range.span_size();
     }
     return Status::OK();
 }
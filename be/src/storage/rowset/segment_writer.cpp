@@ -55,6 +55,7 @@
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/json.h"
+#include "util/json_flattener.h"
 
 namespace starrocks {
 
@@ -209,6 +210,10 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
 
         opts.need_flat = config::enable_json_flat;
         opts.is_compaction = _opts.is_compaction;
+        if (column.type() == LogicalType::TYPE_JSON && opts.need_flat && config::enable_json_flat_path_stats &&
+            _opts.tablet_id > 0) {
+            opts.json_path_stats = JsonPathStatsManager::instance()->get_or_create(_opts.tablet_id, column.unique_id());
+        }
         ASSIGN_OR_RETURN(auto writer, ColumnWriter::create(opts, &column, _wfile.get()));
         RETURN_IF_ERROR(writer->init());
         _column_writers.push_back(std::move(writer));
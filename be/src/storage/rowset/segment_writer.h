@@ -78,6 +78,8 @@ struct SegmentWriterOptions {
     SegmentFileMark segment_file_mark;
     std::string encryption_meta;
     bool is_compaction = false;
+    // the tablet of the segment, to keep the path statistics of its json columns, not kept if unknown
+    int64_t tablet_id = -1;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
@@ -38,6 +38,7 @@
 
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
+#include "common/config.h"
 #include "storage/chunk_helper.h"
 #include "storage/decimal_type_info.h"
 #include "storage/olap_define.h"
@@ -235,6 +236,11 @@ Status ZoneMapIndexWriterImpl<type>::flush() {
     ZoneMapPB zone_map_pb;
     _page_zone_map.to_proto(&zone_map_pb, _type_info);
     _reset_zone_map(&_page_zone_map);
+    if constexpr (type == TYPE_CHAR || type == TYPE_VARCHAR) {
+        if (config::string_page_zone_map_max_prefix_length > 0) {
+            truncate_string_zone_map(&zone_map_pb, config::string_page_zone_map_max_prefix_length);
+        }
+    }
 
     std::string serialized_zone_map;
     bool ret = zone_map_pb.SerializeToString(&serialized_zone_map);
@@ -246,6 +252,24 @@ Status ZoneMapIndexWriterImpl<type>::flush() {
     return Status::OK();
 }
 
+void truncate_string_zone_map(ZoneMapPB* zone_map, size_t max_prefix_length) {
+    if (zone_map->min().size() > max_prefix_length) {
+        zone_map->mutable_min()->resize(max_prefix_length);
+    }
+    if (zone_map->max().size() > max_prefix_length) {
+        std::string max = zone_map->max().substr(0, max_prefix_length);
+        // Increase the last byte which can be increased, and drop the bytes after it.
+        while (!max.empty() && static_cast<uint8_t>(max.back()) == 0xFF) {
+            max.pop_back();
+        }
+        // If all bytes of the prefix are 0xFF, there is no shorter upper bound, so keep the original max.
+        if (!max.empty()) {
+            max.back() = static_cast<char>(static_cast<uint8_t>(max.back()) + 1);
+            zone_map->set_max(std::move(max));
+        }
+    }
+}
+
 struct ZoneMapIndexWriterBuilder {
     template <LogicalType ftype>
     std::unique_ptr<ZoneMapIndexWriter> operator()(TypeInfo* type_info) {
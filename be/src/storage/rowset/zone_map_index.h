@@ -74,6 +74,11 @@ public:
     virtual uint64_t size() const = 0;
 };
 
+// Truncate the min/max of a string zone map to at most |max_prefix_length| bytes.
+// The truncated min is a prefix of the original min, and the truncated max is the shortest string greater than
+// the prefix of the original max, so that the zone map is still a valid bound of the values.
+void truncate_string_zone_map(ZoneMapPB* zone_map, size_t max_prefix_length);
+
 class ZoneMapIndexReader {
 public:
     ZoneMapIndexReader();
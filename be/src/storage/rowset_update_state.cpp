@@ -29,6 +29,7 @@
 #include "util/defer_op.h"
 #include "util/phmap/phmap.h"
 #include "util/stack_util.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -90,7 +91,6 @@ Status RowsetUpdateState::_load_deletes(Rowset* rowset, uint32_t idx, Column* pk
 
 Status RowsetUpdateState::_load_upserts(Rowset* rowset, uint32_t idx, Column* pk_column) {
     CHECK_MEM_LIMIT("RowsetUpdateState::_load_upserts");
-    RowsetReleaseGuard guard(rowset->shared_from_this());
     DCHECK(_upserts.size() >= idx);
     if (_upserts.size() == 0) {
         _upserts.resize(rowset->num_segments());
@@ -98,7 +98,14 @@ Status RowsetUpdateState::_load_upserts(Rowset* rowset, uint32_t idx, Column* pk
     if (_upserts.size() == 0 || _upserts[idx] != nullptr) {
         return Status::OK();
     }
+    auto& dest = _upserts[idx];
+    RETURN_IF_ERROR(_read_upserts(rowset, idx, pk_column, &dest));
+    _memory_usage += dest != nullptr ? dest->memory_usage() : 0;
+    return Status::OK();
+}
 
+Status RowsetUpdateState::_read_upserts(Rowset* rowset, uint32_t idx, const Column* pk_column, ColumnUniquePtr* dest) {
+    RowsetReleaseGuard guard(rowset->shared_from_this());
     OlapReaderStatistics stats;
     const auto& schema = rowset->schema();
     vector<uint32_t> pk_columns;
@@ -117,7 +124,6 @@ Status RowsetUpdateState::_load_upserts(Rowset* rowset, uint32_t idx, Column* pk
     ChunkUniquePtr chunk_shared_ptr;
     TRY_CATCH_BAD_ALLOC(chunk_shared_ptr = ChunkHelper::new_chunk(pkey_schema, 4096));
     auto chunk = chunk_shared_ptr.get();
-    auto& dest = _upserts[idx];
     auto col = pk_column->clone();
     auto itr = itrs[idx].get();
     if (itr != nullptr) {
@@ -139,13 +145,11 @@ Status RowsetUpdateState::_load_upserts(Rowset* rowset, uint32_t idx, Column* pk
     for (const auto& itr : itrs) {
         itr->close();
     }
-    dest = std::move(col);
     // This is a little bit trick. If pk column is a binary column, we will call function `raw_data()` in the following
     // And the function `raw_data()` will build slice of pk column which will increase the memory usage of pk column
     // So we try build slice in advance in here to make sure the correctness of memory statistics
-    TRY_CATCH_BAD_ALLOC(dest->raw_data());
-    _memory_usage += dest != nullptr ? dest->memory_usage() : 0;
-
+    TRY_CATCH_BAD_ALLOC(col->raw_data());
+    *dest = std::move(col);
     return Status::OK();
 }
 
@@ -211,6 +215,59 @@ Status RowsetUpdateState::load_upserts(Rowset* rowset, uint32_t upsert_id) {
     return _load_upserts(rowset, upsert_id, pk_column.get());
 }
 
+Status RowsetUpdateState::load_upserts(Rowset* rowset, uint32_t begin, uint32_t end, ThreadPool* pool) {
+    if (pool == nullptr || end <= begin + 1) {
+        for (uint32_t i = begin; i < end; i++) {
+            RETURN_IF_ERROR(load_upserts(rowset, i));
+        }
+        return Status::OK();
+    }
+    CHECK_MEM_LIMIT("RowsetUpdateState::load_upserts");
+    const auto& schema = rowset->schema();
+    vector<uint32_t> pk_columns;
+    for (size_t i = 0; i < schema->num_key_columns(); i++) {
+        pk_columns.push_back((uint32_t)i);
+    }
+    Schema pkey_schema = ChunkHelper::convert_schema(schema, pk_columns);
+    std::unique_ptr<Column> pk_column;
+    RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(pkey_schema, &pk_column, true));
+    if (_upserts.size() == 0) {
+        _upserts.resize(rowset->num_segments());
+    }
+    RETURN_ERROR_IF_FALSE(end <= _upserts.size(), "load upserts: segment index out of range");
+
+    std::vector<ColumnUniquePtr> cols(end - begin);
+    std::vector<Status> sts(end - begin);
+    // A token per call, the caller only waits for its own segments while the pool is shared by all the tablets
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    for (uint32_t i = begin; i < end; i++) {
+        if (_upserts[i] != nullptr) {
+            continue;
+        }
+        auto* col = &cols[i - begin];
+        auto* st = &sts[i - begin];
+        auto task = [rowset, i, &pk_column, col, st, mem_tracker]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            *st = _read_upserts(rowset, i, pk_column.get(), col);
+        };
+        if (!token->submit_func(task).ok()) {
+            // the pool is full or shutting down, read it in the current thread
+            task();
+        }
+    }
+    token->wait();
+
+    for (uint32_t i = begin; i < end; i++) {
+        RETURN_IF_ERROR(sts[i - begin]);
+        if (cols[i - begin] != nullptr) {
+            _upserts[i] = std::move(cols[i - begin]);
+            _memory_usage += _upserts[i]->memory_usage();
+        }
+    }
+    return Status::OK();
+}
+
 void RowsetUpdateState::release_upserts(uint32_t idx) {
     if (idx >= _upserts.size()) {
         return;
@@ -24,6 +24,7 @@
 namespace starrocks {
 
 class Tablet;
+class ThreadPool;
 
 struct PartialUpdateState {
     std::vector<uint64_t> src_rss_rowids;
@@ -132,12 +133,17 @@ public:
 
     Status load_deletes(Rowset* rowset, uint32_t delete_id);
     Status load_upserts(Rowset* rowset, uint32_t upsert_id);
+    // Load the primary keys of segments [begin, end) concurrently on `pool`, every segment is read by one task.
+    // The segments already loaded are skipped, and it falls back to load them one by one if `pool` is null.
+    Status load_upserts(Rowset* rowset, uint32_t begin, uint32_t end, ThreadPool* pool);
     void release_upserts(uint32_t idx);
     void release_deletes(uint32_t idx);
 
 private:
     Status _load_deletes(Rowset* rowset, uint32_t delete_id, Column* pk_column);
     Status _load_upserts(Rowset* rowset, uint32_t upsert_id, Column* pk_column);
+    // Read the primary keys of segment `idx` into `dest` without touching any member, so it can run concurrently.
+    static Status _read_upserts(Rowset* rowset, uint32_t idx, const Column* pk_column, ColumnUniquePtr* dest);
 
     Status _do_load(Tablet* tablet, Rowset* rowset);
 
@@ -57,6 +57,7 @@
 #include "storage/tablet_manager.h"
 #include "storage/tablet_meta_manager.h"
 #include "storage/tablet_updates.h"
+#include "util/threadpool.h"
 #include "util/unaligned_access.h"
 
 namespace starrocks {
@@ -1019,7 +1020,8 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
     std::vector<std::vector<DeltaColumnGroupList>> all_historical_dcgs;
     std::vector<RowsetId> new_rowset_ids;
 
-    for (int i = 0; i < sc_params.rowset_readers.size(); ++i) {
+    // Converts the i-th rowset into `new_rowset`, a failure of building the new rowset is returned by `new_rowset`.
+    auto convert_rowset = [&](size_t i, StatusOr<RowsetSharedPtr>* new_rowset) -> Status {
         VLOG(3) << "begin to convert a history rowset. version=" << sc_params.rowsets_to_change[i]->version();
 
         TabletSharedPtr new_tablet = sc_params.new_tablet;
@@ -1041,8 +1043,7 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
         }
 
         std::unique_ptr<RowsetWriter> rowset_writer;
-        status = RowsetFactory::create_rowset_writer(writer_context, &rowset_writer);
-        if (!status.ok()) {
+        if (!RowsetFactory::create_rowset_writer(writer_context, &rowset_writer).ok()) {
             return Status::InternalError(_alter_msg_header + "build rowset writer failed");
         }
 
@@ -1056,7 +1057,61 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
             return st;
         }
         sc_params.rowset_readers[i]->close();
-        auto new_rowset = rowset_writer->build();
+        *new_rowset = rowset_writer->build();
+        return Status::OK();
+    };
+
+    // The direct schema change of a table, e.g. adding a column or widening the type of a column, converts each
+    // rowset independently, so the rowsets are converted in parallel and then registered in the order of versions.
+    // The sorting schema change, the rollups and the generated columns share the states of `chunk_changer` across
+    // rowsets, so they are converted one by one.
+    size_t num_rowsets = sc_params.rowset_readers.size();
+    std::vector<StatusOr<RowsetSharedPtr>> converted_rowsets;
+    // The converted rowsets left behind by a failure are not registered, so release their files.
+    DeferOp release_unregistered_rowsets([&converted_rowsets] {
+        for (auto& rowset : converted_rowsets) {
+            if (rowset.ok() && *rowset != nullptr) {
+                StorageEngine::instance()->add_unused_rowset(*rowset);
+            }
+        }
+    });
+    int parallelism = std::min<int>(config::schema_change_convert_rowset_parallelism, num_rowsets);
+    if (parallelism > 1 && sc_params.sc_directly && sc_params.alter_job_type == TAlterJobType::SCHEMA_CHANGE &&
+        chunk_changer->get_gc_exprs()->empty()) {
+        std::unique_ptr<ThreadPool> convert_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("sc_convert_rowset")
+                                .set_min_threads(0)
+                                .set_max_threads(parallelism)
+                                .build(&convert_pool));
+        LOG(INFO) << _alter_msg_header << "convert " << num_rowsets << " rowsets with " << parallelism << " threads";
+
+        converted_rowsets.resize(num_rowsets, Status::Uninitialized(""));
+        std::vector<Status> convert_status(num_rowsets);
+        auto mem_tracker = CurrentThread::mem_tracker();
+        Status submit_st;
+        for (size_t i = 0; i < num_rowsets && submit_st.ok(); ++i) {
+            submit_st = convert_pool->submit_func([&, i]() {
+                SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+                convert_status[i] = convert_rowset(i, &converted_rowsets[i]);
+            });
+        }
+        convert_pool->wait();
+        RETURN_IF_ERROR(submit_st);
+        for (auto& st : convert_status) {
+            RETURN_IF_ERROR(st);
+        }
+    }
+
+    for (int i = 0; i < num_rowsets; ++i) {
+        TabletSharedPtr new_tablet = sc_params.new_tablet;
+        TabletSharedPtr base_tablet = sc_params.base_tablet;
+
+        StatusOr<RowsetSharedPtr> new_rowset = Status::Uninitialized("");
+        if (converted_rowsets.empty()) {
+            RETURN_IF_ERROR(convert_rowset(i, &new_rowset));
+        } else {
+            new_rowset = std::move(converted_rowsets[i]);
+        }
         if (!new_rowset.ok()) {
             LOG(WARNING) << _alter_msg_header << "failed to build rowset: " << new_rowset.status()
                          << ". exit alter process";
@@ -17,6 +17,8 @@
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
 #include "column/datum_convert.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "simd/simd.h"
@@ -64,24 +66,73 @@ ColumnMapping* ChunkChanger::get_mutable_column_mapping(size_t column_index) {
     return &_schema_mapping[column_index];
 }
 
-#define TYPE_REINTERPRET_CAST(FromType, ToType)      \
-    {                                                \
-        size_t row_num = base_chunk->num_rows();     \
-        for (size_t row = 0; row < row_num; ++row) { \
-            Datum base_datum = base_col->get(row);   \
-            Datum new_datum;                         \
-            if (base_datum.is_null()) {              \
-                new_datum.set_null();                \
-                new_col->append_datum(new_datum);    \
-                continue;                            \
-            }                                        \
-            FromType src;                            \
-            src = base_datum.get<FromType>();        \
-            ToType dst = static_cast<ToType>(src);   \
-            new_datum.set(dst);                      \
-            new_col->append_datum(new_datum);        \
-        }                                            \
-        break;                                       \
+// Casts the whole fixed length `base_col` into `new_col` at once instead of row by row through datums.
+// Returns false if either column isn't a (nullable) FixedLengthColumn of the expected type, or if `base_col`
+// contains nulls but `new_col` isn't nullable, the caller falls back to the row by row path then.
+template <typename FromType, typename ToType>
+static bool cast_fixed_length_column(const Column& base_col, Column* new_col) {
+    const Column* base_data = &base_col;
+    const NullColumn* base_nulls = nullptr;
+    if (base_col.is_nullable()) {
+        const auto& nullable = down_cast<const NullableColumn&>(base_col);
+        base_data = nullable.data_column().get();
+        base_nulls = nullable.has_null() ? nullable.null_column().get() : nullptr;
+    }
+    Column* new_data = new_col;
+    NullableColumn* new_nullable = nullptr;
+    if (new_col->is_nullable()) {
+        new_nullable = down_cast<NullableColumn*>(new_col);
+        new_data = new_nullable->mutable_data_column();
+    } else if (base_nulls != nullptr) {
+        return false;
+    }
+    const auto* src_column = dynamic_cast<const FixedLengthColumn<FromType>*>(base_data);
+    auto* dst_column = dynamic_cast<FixedLengthColumn<ToType>*>(new_data);
+    if (src_column == nullptr || dst_column == nullptr) {
+        return false;
+    }
+
+    const auto& src = src_column->get_data();
+    auto& dst = dst_column->get_data();
+    size_t offset = dst.size();
+    dst.resize(offset + src.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        dst[offset + i] = static_cast<ToType>(src[i]);
+    }
+    if (new_nullable != nullptr) {
+        auto& null_data = new_nullable->null_column_data();
+        if (base_nulls != nullptr) {
+            const auto& src_nulls = base_nulls->get_data();
+            null_data.insert(null_data.end(), src_nulls.begin(), src_nulls.end());
+            new_nullable->set_has_null(true);
+        } else {
+            null_data.resize(null_data.size() + src.size(), 0);
+        }
+    }
+    return true;
+}
+
+#define TYPE_REINTERPRET_CAST(FromType, ToType)                                       \
+    {                                                                                 \
+        if (cast_fixed_length_column<FromType, ToType>(*base_col, new_col.get())) {   \
+            break;                                                                    \
+        }                                                                             \
+        size_t row_num = base_chunk->num_rows();                                      \
+        for (size_t row = 0; row < row_num; ++row) {                                  \
+            Datum base_datum = base_col->get(row);                                    \
+            Datum new_datum;                                                          \
+            if (base_datum.is_null()) {                                               \
+                new_datum.set_null();                                                 \
+                new_col->append_datum(new_datum);                                     \
+                continue;                                                             \
+            }                                                                         \
+            FromType src;                                                             \
+            src = base_datum.get<FromType>();                                         \
+            ToType dst = static_cast<ToType>(src);                                    \
+            new_datum.set(dst);                                                       \
+            new_col->append_datum(new_datum);                                         \
+        }                                                                             \
+        break;                                                                        \
     }
 
 #define CONVERT_FROM_TYPE(from_type)                                                \
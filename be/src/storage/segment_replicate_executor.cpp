@@ -72,7 +72,7 @@ Status ReplicateChannel::_init() {
     }
     _inited = true;
 
-    _stub = ExecEnv::GetInstance()->brpc_stub_cache()->get_stub(_host, _port);
+    _stub = ExecEnv::GetInstance()->brpc_stub_cache()->get_stub(_host, _port, BrpcTrafficClass::LOAD);
     if (_stub == nullptr) {
         auto msg = fmt::format("Failed to Connect {} failed.", debug_string().c_str());
         LOG(WARNING) << msg;
@@ -101,23 +101,18 @@ Status ReplicateChannel::async_segment(SegmentPB* segment, butil::IOBuf& data, b
     RETURN_IF_ERROR(_st);
 
     // 2. wait pre request's result
-    RETURN_IF_ERROR(_wait_response(replicate_tablet_infos, failed_tablet_infos));
+    RETURN_IF_ERROR(wait_response(replicate_tablet_infos, failed_tablet_infos));
 
-    // 3. send segment sync request
+    // 3. send segment sync request, the caller waits for the response if eos=true
     _send_request(segment, data, eos);
 
-    // 4. wait if eos=true
-    if (eos || _mem_tracker->any_limit_exceeded()) {
-        RETURN_IF_ERROR(_wait_response(replicate_tablet_infos, failed_tablet_infos));
-    }
-
-    VLOG(1) << "Asynced tablet " << _opt->tablet_id << " segment id "
-            << (segment == nullptr ? -1 : segment->segment_id()) << " eos " << eos << " to [" << _host << ":" << _port
-            << "] res " << _closure->result.DebugString();
-
     return _st;
 }
 
+bool ReplicateChannel::mem_limit_exceeded() {
+    return _mem_tracker != nullptr && _mem_tracker->any_limit_exceeded();
+}
+
 void ReplicateChannel::_send_request(SegmentPB* segment, butil::IOBuf& data, bool eos) {
     PTabletWriterAddSegmentRequest request;
     request.set_allocated_id(const_cast<starrocks::PUniqueId*>(&_opt->load_id));
@@ -153,8 +148,9 @@ void ReplicateChannel::_send_request(SegmentPB* segment, butil::IOBuf& data, boo
     }
 }
 
-Status ReplicateChannel::_wait_response(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
-                                        std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos) {
+Status ReplicateChannel::wait_response(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
+                                       std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos) {
+    RETURN_IF_ERROR(_st);
     if (_closure->join()) {
         _mem_tracker->release_without_root(_closure->request_size);
         if (_closure->cntl.Failed()) {
@@ -177,6 +173,8 @@ Status ReplicateChannel::_wait_response(std::vector<std::unique_ptr<PTabletInfo>
             failed_tablet_infos->emplace_back(std::make_unique<PTabletInfo>());
             failed_tablet_infos->back()->Swap(_closure->result.mutable_failed_tablet_vec(i));
         }
+        VLOG(1) << "Asynced tablet " << _opt->tablet_id << " to [" << _host << ":" << _port << "] res "
+                << _closure->result.DebugString();
     }
 
     return Status::OK();
@@ -334,29 +332,48 @@ void ReplicateToken::_sync_segment(std::unique_ptr<SegmentPB> segment, bool eos)
         }
     }
 
-    // 2. send segment to secondary replica
+    // 2. send segment to secondary replicas, every channel sends it without waiting for the others
     for (auto& channel : _replicate_channels) {
-        auto st = Status::OK();
         if (_failed_node_id.count(channel->node_id()) == 0) {
-            st = channel->async_segment(segment.get(), data, eos, &_replicated_tablet_infos, &_failed_tablet_infos);
-            if (!st.ok()) {
-                LOG(WARNING) << "Failed to sync segment " << channel->debug_string() << " err " << st;
-                channel->cancel();
-                _failed_node_id.insert(channel->node_id());
+            auto st =
+                    channel->async_segment(segment.get(), data, eos, &_replicated_tablet_infos, &_failed_tablet_infos);
+            if (!_check_channel_status(channel.get(), st)) {
+                return;
+            }
+        }
+    }
+
+    // 3. wait for the secondary replicas to finish if eos=true, or the requests in flight take too much memory,
+    // the transfers to all the replicas overlap with each other
+    for (auto& channel : _replicate_channels) {
+        if (_failed_node_id.count(channel->node_id()) == 0 && (eos || channel->mem_limit_exceeded())) {
+            auto st = channel->wait_response(&_replicated_tablet_infos, &_failed_tablet_infos);
+            if (!_check_channel_status(channel.get(), st)) {
+                return;
             }
         }
+    }
+}
 
-        if (_failed_node_id.size() > _max_fail_replica_num) {
-            LOG(WARNING) << "Failed to sync segment err " << st << " by " << debug_string() << " fail_num "
-                         << _failed_node_id.size() << " max_fail_num " << _max_fail_replica_num;
-            for (auto& channel : _replicate_channels) {
-                if (_failed_node_id.count(channel->node_id()) == 0) {
-                    channel->cancel();
-                }
+bool ReplicateToken::_check_channel_status(ReplicateChannel* channel, const Status& st) {
+    if (!st.ok()) {
+        LOG(WARNING) << "Failed to sync segment " << channel->debug_string() << " err " << st;
+        channel->cancel();
+        _failed_node_id.insert(channel->node_id());
+    }
+
+    if (_failed_node_id.size() > _max_fail_replica_num) {
+        LOG(WARNING) << "Failed to sync segment err " << st << " by " << debug_string() << " fail_num "
+                     << _failed_node_id.size() << " max_fail_num " << _max_fail_replica_num;
+        for (auto& other : _replicate_channels) {
+            if (_failed_node_id.count(other->node_id()) == 0) {
+                other->cancel();
             }
-            return set_status(st);
         }
+        set_status(st);
+        return false;
     }
+    return true;
 }
 
 Status SegmentReplicateExecutor::init(const std::vector<DataDir*>& data_dirs) {
@@ -42,10 +42,18 @@ public:
     ReplicateChannel(const DeltaWriterOptions* opt, std::string host, int32_t port, int64_t node_id);
     ~ReplicateChannel();
 
+    // Send the segment after the previous request finishes, without waiting for the response of this one.
     Status async_segment(SegmentPB* segment, butil::IOBuf& data, bool eos,
                          std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
                          std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos);
 
+    // Wait for the response of the request in flight, if any.
+    Status wait_response(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
+                         std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos);
+
+    // Whether the memory of the requests in flight exceeds the load memory limit.
+    bool mem_limit_exceeded();
+
     void cancel();
 
     int64_t node_id() { return _node_id; }
@@ -55,8 +63,6 @@ public:
 private:
     Status _init();
     void _send_request(SegmentPB* segment, butil::IOBuf& data, bool eos);
-    Status _wait_response(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
-                          std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos);
 
     std::unique_ptr<MemTracker> _mem_tracker;
 
@@ -114,6 +120,10 @@ private:
 
     void _sync_segment(std::unique_ptr<SegmentPB> segment, bool eos);
 
+    // Mark the replica of `channel` failed if `st` is not ok, and cancel all the channels and return false
+    // if too many replicas have failed.
+    bool _check_channel_status(ReplicateChannel* channel, const Status& st);
+
     std::unique_ptr<ThreadPoolToken> _replicate_token;
 
     mutable SpinLock _status_lock;
@@ -259,8 +259,13 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
     int64_t multiget_t3_us = 0;
     size_t i = 0;
     bool founded = false;
+    const Slice* prev_k = nullptr;
     for (auto it = begin; it != end; ++it, ++i) {
         auto& k = keys[*it];
+        // When the keys are probed in ascending order, the previous key is after all the keys of the blocks
+        // before current block, so is `k`.
+        const bool ascending = prev_k == nullptr || rep_->options.comparator->Compare(*prev_k, k) <= 0;
+        prev_k = &k;
         int64_t t0 = butil::gettimeofday_us();
         if (current_block_itr_ptr != nullptr && current_block_itr_ptr->Valid()) {
             // keep searching current block
@@ -268,6 +273,10 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
             if (founded) {
                 continue_block_read_cnt++;
                 continue;
+            } else if (ascending && current_block_itr_ptr->Valid()) {
+                // `k` is in the key range of current block, but not found.
+                continue_block_read_cnt++;
+                continue;
             } else {
                 current_block_itr_ptr.reset(nullptr);
             }
@@ -316,5 +325,9 @@ template Status Table::MultiGet<std::set<size_t>::iterator>(const ReadOptions& o
                                                             std::set<size_t>::iterator begin,
                                                             std::set<size_t>::iterator end,
                                                             std::vector<std::string>* values);
+template Status Table::MultiGet<std::vector<size_t>::iterator>(const ReadOptions& options, const Slice* keys,
+                                                               std::vector<size_t>::iterator begin,
+                                                               std::vector<size_t>::iterator end,
+                                                               std::vector<std::string>* values);
 
 } // namespace starrocks::sstable
@@ -659,6 +659,8 @@ void StorageEngine::stop() {
     }
 
     JOIN_THREAD(_clear_expired_replcation_snapshots_thread)
+    JOIN_THREAD(_vector_index_build_thread)
+    JOIN_THREAD(_sorted_index_build_thread)
 #undef JOIN_THREADS
 #undef JOIN_THREAD
 
@@ -400,6 +400,12 @@ private:
 
     void* _clear_expired_replication_snapshots_callback(void* arg);
 
+    // build the vector indexes deferred by config::enable_vector_index_deferred_build
+    void* _vector_index_build_thread_callback(void* arg);
+
+    // build the sorted indexes of the rowsets enabled by config::enable_rowset_sorted_index
+    void* _sorted_index_build_thread_callback(void* arg);
+
     void* _tablet_checkpoint_callback(void* arg);
 
     void* _adjust_pagecache_callback(void* arg);
@@ -467,6 +473,10 @@ private:
 
     std::thread _clear_expired_replcation_snapshots_thread;
 
+    std::thread _vector_index_build_thread;
+
+    std::thread _sorted_index_build_thread;
+
     std::thread _compaction_checker_thread;
     std::mutex _checker_mutex;
     std::condition_variable _checker_cv;
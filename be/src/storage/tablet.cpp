@@ -39,6 +39,7 @@
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 
+#include <cmath>
 #include <map>
 #include <memory>
 #include <utility>
@@ -1689,6 +1690,30 @@ double Tablet::compaction_score() {
     return _compaction_context ? _compaction_context->score : 0;
 }
 
+void Tablet::add_read_heat(int64_t segments_read) {
+    if (segments_read <= 0) {
+        return;
+    }
+    int64_t now = UnixMillis();
+    std::lock_guard lock(_read_heat_lock);
+    _read_heat = decay_read_heat(_read_heat, now - _read_heat_update_millis) + segments_read;
+    _read_heat_update_millis = now;
+}
+
+double Tablet::read_heat() {
+    int64_t now = UnixMillis();
+    std::lock_guard lock(_read_heat_lock);
+    return decay_read_heat(_read_heat, now - _read_heat_update_millis);
+}
+
+double Tablet::decay_read_heat(double heat, int64_t elapsed_ms) {
+    if (heat <= 0 || elapsed_ms <= 0) {
+        return heat;
+    }
+    int64_t half_life_ms = std::max<int64_t>(config::tablet_read_heat_half_life_sec, 1) * 1000;
+    return heat * std::exp2(-static_cast<double>(elapsed_ms) / half_life_ms);
+}
+
 void Tablet::stop_compaction() {
     std::lock_guard lock(_compaction_task_lock);
     StorageEngine::instance()->compaction_manager()->stop_compaction(
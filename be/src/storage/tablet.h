@@ -228,6 +228,12 @@ public:
     int64_t last_base_compaction_success_time() { return _last_base_compaction_success_millis; }
     void set_last_base_compaction_success_time(int64_t millis) { _last_base_compaction_success_millis = millis; }
 
+    // The read heat is the number of segments read by the scans of the tablet, decayed by half every
+    // tablet_read_heat_half_life_sec, i.e. the read amplification weighted by how often the tablet is queried.
+    void add_read_heat(int64_t segments_read);
+    double read_heat();
+    static double decay_read_heat(double heat, int64_t elapsed_ms);
+
     void delete_all_files();
 
     bool check_rowset_id(const RowsetId& rowset_id);
@@ -427,6 +433,10 @@ private:
 
     std::mutex _compaction_task_lock;
 
+    std::mutex _read_heat_lock;
+    double _read_heat = 0;
+    int64_t _read_heat_update_millis = 0;
+
     // used for default base cumulative compaction strategy to control the
     bool _has_running_compaction = false;
 
@@ -38,6 +38,7 @@
 #include <fmt/format.h>
 #include <re2/re2.h>
 
+#include <algorithm>
 #include <ctime>
 #include <memory>
 
@@ -49,6 +50,7 @@
 #include "runtime/current_thread.h"
 #include "storage/compaction_manager.h"
 #include "storage/data_dir.h"
+#include "storage/index/sorted/rowset_sorted_index.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_writer.h"
@@ -763,6 +765,51 @@ Status TabletManager::generate_pk_dump() {
     return Status::OK();
 }
 
+std::vector<TabletSharedPtr> TabletManager::get_all_pk_tablets() {
+    std::vector<TabletSharedPtr> tablets;
+    for (const auto& tablets_shard : _tablets_shards) {
+        std::shared_lock rlock(tablets_shard.lock);
+        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+            if (tablet_ptr->keys_type() == PRIMARY_KEYS) {
+                tablets.push_back(tablet_ptr);
+            }
+        }
+    }
+    return tablets;
+}
+
+std::vector<TabletSharedPtr> TabletManager::get_all_vector_index_tablets() {
+    std::vector<TabletSharedPtr> tablets;
+    for (const auto& tablets_shard : _tablets_shards) {
+        std::shared_lock rlock(tablets_shard.lock);
+        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+            const auto* indexes = tablet_ptr->tablet_schema()->indexes();
+            if (std::any_of(indexes->begin(), indexes->end(),
+                            [](const TabletIndex& index) { return index.index_type() == VECTOR; })) {
+                tablets.push_back(tablet_ptr);
+            }
+        }
+    }
+    return tablets;
+}
+
+std::vector<TabletSharedPtr> TabletManager::get_all_sorted_index_tablets() {
+    std::vector<TabletSharedPtr> tablets;
+    for (const auto& tablets_shard : _tablets_shards) {
+        std::shared_lock rlock(tablets_shard.lock);
+        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+            if (tablet_ptr->keys_type() == PRIMARY_KEYS) {
+                continue;
+            }
+            const auto& columns = tablet_ptr->tablet_schema()->columns();
+            if (std::any_of(columns.begin(), columns.end(), RowsetSortedIndex::is_supported_column)) {
+                tablets.push_back(tablet_ptr);
+            }
+        }
+    }
+    return tablets;
+}
+
 // pick tablets to do primary index compaction
 std::vector<TabletAndScore> TabletManager::pick_tablets_to_do_pk_index_major_compaction() {
     std::vector<TabletAndScore> pick_tablets;
@@ -197,6 +197,13 @@ public:
 
     std::vector<TabletAndScore> pick_tablets_to_do_pk_index_major_compaction();
 
+    std::vector<TabletSharedPtr> get_all_pk_tablets();
+
+    std::vector<TabletSharedPtr> get_all_vector_index_tablets();
+
+    // The non primary key tablets with the columns supported by RowsetSortedIndex.
+    std::vector<TabletSharedPtr> get_all_sorted_index_tablets();
+
     Status generate_pk_dump();
 
 private:
@@ -246,13 +246,13 @@ Status TabletReader::_init_collector_for_pk_index_read() {
     RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(*tablet_schema->schema(), &pk_column));
     PrimaryKeyEncoder::encode(*tablet_schema->schema(), *keys, 0, keys->num_rows(), pk_column.get());
 
-    // get rowid using pk index
+    // get rowid using pk index, loading the index of a cold tablet costs more than scanning its segments
     std::vector<uint64_t> rowids(1);
     {
         SCOPED_RAW_TIMER(&_stats.read_pk_index_ns);
         EditVersion read_version;
-        RETURN_IF_ERROR(
-                _tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &read_version, &rowids, 3000));
+        RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &read_version, &rowids,
+                                                                 3000, false));
         if (rowids.size() != 1) {
             return Status::InternalError(strings::Substitute("get rowid size not match tablet:$0 $1 != $2",
                                                              _tablet->tablet_id(), rowids.size(), 1));
@@ -320,7 +320,11 @@ Status TabletReader::do_get_next(Chunk* chunk) {
     DCHECK(!_is_vertical_merge);
     if (UNLIKELY(_collect_iter == nullptr)) {
         auto st = _init_collector_for_pk_index_read();
-        if (!st.ok()) {
+        if (st.is_uninitialized() || st.is_not_supported()) {
+            VLOG(2) << "pk index not usable for pointer read, fallback to normal read " << st
+                    << " tablet:" << _tablet->tablet_id();
+            RETURN_IF_ERROR(_init_collector(*_reader_params));
+        } else if (!st.ok()) {
             LOG(WARNING) << "using pk index for pointer read failed, fallback to normal read " << st
                          << " tablet:" << _tablet->tablet_id();
             RETURN_IF_ERROR(_init_collector(*_reader_params));
@@ -431,10 +435,13 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
         } else {
             _collect_iter = new_heap_merge_iterator(seg_iters);
         }
-    } else if (params.sorted_by_keys_per_tablet && (keys_type == DUP_KEYS || keys_type == PRIMARY_KEYS) &&
+    } else if (params.sorted_by_keys_per_tablet &&
+               (keys_type == DUP_KEYS || keys_type == PRIMARY_KEYS || (keys_type == UNIQUE_KEYS && skip_aggr) ||
+                (keys_type == AGG_KEYS && skip_aggr)) &&
                seg_iters.size() > 1) {
-        // when enable sorted by keys. we need call heap merge for DUP KEYS and PKS
-        // but for UNIQ KEYS or AGG KEYS we need build new_aggregate_iterator for them.
+        // when enable sorted by keys. we need call heap merge for DUP KEYS and PKS, and for UNIQ KEYS or AGG KEYS
+        // skipping aggregation, otherwise the union iterator breaks the order across segments.
+        // but for UNIQ KEYS or AGG KEYS not skipping aggregation we need build new_aggregate_iterator for them.
         if (params.profile != nullptr && (params.is_pipeline || params.profile->parent() != nullptr)) {
             RuntimeProfile* p;
             if (params.is_pipeline) {
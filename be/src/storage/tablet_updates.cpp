@@ -1112,6 +1112,7 @@ Status TabletUpdates::_apply_column_partial_update_commit(const EditVersionInfo&
                 return apply_st;
             }
         }
+        _update_rowset_dcg_stats(state.delta_column_groups(), version.major_number());
         size_t num_dels = 0;
         // put delvec in cache
         TabletSegmentId tsid;
@@ -1341,11 +1342,22 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
     EditVersion latest_applied_version;
     st = get_latest_applied_version(&latest_applied_version);
 
+    // Load the primary keys of the following segments in parallel when reaching the first of them. The index is
+    // still updated segment by segment in order, so the delvecs and rssids are the same as a serial apply.
+    auto load_upserts = [&](uint32_t idx) -> Status {
+        const uint32_t parallelism = std::max(config::transaction_apply_segment_parallelism, 1);
+        if (parallelism > 1 && idx % parallelism == 0) {
+            const uint32_t end = std::min<uint32_t>(idx + parallelism, rowset->num_segments());
+            RETURN_IF_ERROR(state.load_upserts(rowset.get(), idx, end, manager->apply_segment_thread_pool()));
+        }
+        return state.load_upserts(rowset.get(), idx);
+    };
+
     int64_t full_row_size = 0;
     int64_t full_rowset_size = 0;
     if (rowset->rowset_meta()->get_meta_pb_without_schema().delfile_idxes_size() == 0) {
         for (uint32_t i = 0; i < rowset->num_segments(); i++) {
-            st = state.load_upserts(rowset.get(), i);
+            st = load_upserts(i);
             if (!st.ok()) {
                 std::string msg = strings::Substitute("_apply_rowset_commit error: load upserts failed: $0 $1",
                                                       st.to_string(), debug_string());
@@ -1425,7 +1437,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                 del_idx = rowset->rowset_meta()->get_meta_pb_without_schema().delfile_idxes(loaded_delfile);
             }
             while (i < del_idx) {
-                st = state.load_upserts(rowset.get(), loaded_upsert);
+                st = load_upserts(loaded_upsert);
                 FAIL_POINT_TRIGGER_EXECUTE(tablet_apply_load_upserts_failed,
                                            { st = Status::InternalError("inject tablet_apply_load_upserts_failed"); });
                 if (!st.ok()) {
@@ -1475,9 +1487,9 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                         }
                     }
                 }
+                state.release_upserts(loaded_upsert);
                 i++;
                 loaded_upsert++;
-                state.release_upserts(i);
             }
             if (loaded_delfile < delfile_num) {
                 DCHECK(i == del_idx);
@@ -2749,6 +2761,7 @@ struct CompactionEntry {
     size_t num_dels = 0;
     size_t bytes = 0;
     size_t num_segments = 0;
+    bool too_many_dcgs = false;
 
     bool operator<(const CompactionEntry& rhs) const { return score_per_row > rhs.score_per_row; }
 };
@@ -2833,6 +2846,7 @@ Status TabletUpdates::compaction(MemTracker* mem_tracker) {
                 e.num_dels = stat.num_dels;
                 e.bytes = stat.byte_size;
                 e.num_segments = stat.num_segments;
+                e.too_many_dcgs = _has_too_many_dcgs(stat);
             }
         }
     }
@@ -2845,8 +2859,9 @@ Status TabletUpdates::compaction(MemTracker* mem_tracker) {
         }
         // When we enable lazy delta column compaction, which means that we don't want to merge
         // delta column back to main segment file too soon, for save compaction IO cost.
-        // Separate delta column won't affect query performance.
-        if (info->inputs.size() > 1 && has_partial_update_by_column && config::enable_lazy_delta_column_compaction) {
+        // Separate delta column won't affect query performance, until a segment has too many of them.
+        if (info->inputs.size() > 1 && has_partial_update_by_column && config::enable_lazy_delta_column_compaction &&
+            !e.too_many_dcgs) {
             break;
         }
         info->inputs.push_back(e.rowsetid);
@@ -3381,6 +3396,47 @@ void TabletUpdates::_calc_compaction_score(RowsetStats* stats) {
     stats->compaction_score =
             config::update_compaction_size_threshold * (stats->num_segments > 1 ? stats->num_segments - 1 : 1) +
             (cost_record_read + cost_record_write) * delete_bytes - cost_record_write * stats->byte_size;
+    if (_has_too_many_dcgs(*stats)) {
+        // every delta column group costs an extra file to read, fold them back into the segments
+        stats->compaction_score += config::update_compaction_size_threshold * stats->num_dcgs;
+    }
+}
+
+void TabletUpdates::_update_rowset_dcg_stats(const std::map<uint32_t, DeltaColumnGroupPtr>& dcgs, int64_t version) {
+    auto manager = StorageEngine::instance()->update_manager();
+    std::map<uint32_t, size_t> dcg_counts;
+    for (const auto& [rssid, _] : dcgs) {
+        DeltaColumnGroupList dcg_list;
+        auto st = manager->get_delta_column_group(_tablet.data_dir()->get_meta(),
+                                                  TabletSegmentId(_tablet.tablet_id(), rssid), version, &dcg_list);
+        if (!st.ok()) {
+            // only used to schedule compaction, don't fail the apply
+            LOG(WARNING) << "get delta column group failed, tablet:" << _tablet.tablet_id() << " rssid:" << rssid
+                         << " " << st;
+            continue;
+        }
+        dcg_counts[rssid] = dcg_list.size();
+    }
+    std::lock_guard lg(_rowset_stats_lock);
+    for (const auto& [rssid, count] : dcg_counts) {
+        auto iter = _rowset_stats.upper_bound(rssid);
+        if (iter == _rowset_stats.begin()) {
+            continue;
+        }
+        iter--;
+        if (rssid >= iter->first + iter->second->num_segments) {
+            continue;
+        }
+        if (count > iter->second->num_dcgs) {
+            iter->second->num_dcgs = count;
+            _calc_compaction_score(iter->second.get());
+        }
+    }
+}
+
+bool TabletUpdates::_has_too_many_dcgs(const RowsetStats& stats) {
+    return config::update_compaction_delta_column_group_threshold > 0 &&
+           stats.num_dcgs >= static_cast<size_t>(config::update_compaction_delta_column_group_threshold);
 }
 
 size_t TabletUpdates::_get_rowset_num_deletes(uint32_t rowsetid) {
@@ -3536,9 +3592,9 @@ int64_t TabletUpdates::get_average_row_size() {
 std::string TabletUpdates::RowsetStats::to_string() const {
     return strings::Substitute(
             "[seg:$0 row:$1 del:$2 bytes:$3 row_size:$4 compaction_score:$5 compaction_level:$6 "
-            "partial_update_by_column:$7]",
+            "partial_update_by_column:$7 dcgs:$8]",
             num_segments, num_rows, num_dels, byte_size, row_size, compaction_score, compaction_level,
-            partial_update_by_column);
+            partial_update_by_column, num_dcgs);
 }
 
 std::string TabletUpdates::debug_string() const {
@@ -4674,6 +4730,31 @@ void TabletUpdates::get_basic_info_extra(TabletBasicInfo& info) {
     }
 }
 
+Status TabletUpdates::preload_primary_index() {
+    auto manager = StorageEngine::instance()->update_manager();
+    auto index_entry = manager->index_cache().get(_tablet.tablet_id());
+    if (index_entry != nullptr) {
+        manager->index_cache().release(index_entry);
+        return Status::OK();
+    }
+    index_entry = manager->index_cache().get_or_create(_tablet.tablet_id());
+    index_entry->update_expire_time(MonotonicMillis() + manager->get_index_cache_expire_ms(_tablet));
+    auto& index = index_entry->value();
+    auto st = Status::OK();
+    {
+        std::lock_guard lg(_index_lock);
+        st = index.load(&_tablet);
+    }
+    manager->index_cache().update_object_size(index_entry, index.memory_usage());
+    if (!st.ok()) {
+        // remove index entry when loading fail
+        manager->index_cache().remove(index_entry);
+        return st;
+    }
+    manager->index_cache().release(index_entry);
+    return Status::OK();
+}
+
 Status TabletUpdates::pk_index_major_compaction() {
     auto manager = StorageEngine::instance()->update_manager();
     auto index_entry = manager->index_cache().get_or_create(_tablet.tablet_id());
@@ -5309,7 +5390,7 @@ Status TabletUpdates::get_column_values(const std::vector<uint32_t>& column_ids,
 }
 
 Status TabletUpdates::get_rss_rowids_by_pk(Tablet* tablet, const Column& keys, EditVersion* read_version,
-                                           std::vector<uint64_t>* rss_rowids, int64_t timeout_ms) {
+                                           std::vector<uint64_t>* rss_rowids, int64_t timeout_ms, bool load_index) {
     if (timeout_ms <= 0) {
         _index_lock.lock();
     } else {
@@ -5317,13 +5398,13 @@ Status TabletUpdates::get_rss_rowids_by_pk(Tablet* tablet, const Column& keys, E
             return Status::TimedOut("get_rss_rowids_by_pk try lock timeout");
         }
     }
-    auto st = get_rss_rowids_by_pk_unlock(tablet, keys, read_version, rss_rowids);
+    auto st = get_rss_rowids_by_pk_unlock(tablet, keys, read_version, rss_rowids, load_index);
     _index_lock.unlock_shared();
     return st;
 }
 
 Status TabletUpdates::get_rss_rowids_by_pk_unlock(Tablet* tablet, const Column& keys, EditVersion* read_version,
-                                                  std::vector<uint64_t>* rss_rowids) {
+                                                  std::vector<uint64_t>* rss_rowids, bool load_index) {
     if (read_version != nullptr) {
         // get next_rowset_id and read_version to identify conflict
         std::lock_guard wl(_lock);
@@ -5335,7 +5416,17 @@ Status TabletUpdates::get_rss_rowids_by_pk_unlock(Tablet* tablet, const Column&
         *read_version = _edit_version_infos[_apply_version_idx]->version;
     }
     auto manager = StorageEngine::instance()->update_manager();
-    auto index_entry = manager->index_cache().get_or_create(tablet->tablet_id());
+    auto index_entry = load_index ? manager->index_cache().get_or_create(tablet->tablet_id())
+                                  : manager->index_cache().get(tablet->tablet_id());
+    if (index_entry == nullptr) {
+        return Status::Uninitialized(
+                strings::Substitute("primary index of tablet $0 is not loaded", tablet->tablet_id()));
+    }
+    if (!load_index && !index_entry->value().is_loaded()) {
+        manager->index_cache().release(index_entry);
+        return Status::Uninitialized(
+                strings::Substitute("primary index of tablet $0 is not loaded", tablet->tablet_id()));
+    }
     index_entry->update_expire_time(MonotonicMillis() + manager->get_index_cache_expire_ms(*tablet));
     bool enable_persistent_index = tablet->get_enable_persistent_index();
     auto& index = index_entry->value();
@@ -309,11 +309,12 @@ public:
                              const TabletSchemaCSPtr& tablet_schema,
                              const std::map<string, string>* column_to_expr_value = nullptr);
 
+    // If |load_index| is false, returns Uninitialized rather than loading the primary index if it is not loaded.
     Status get_rss_rowids_by_pk(Tablet* tablet, const Column& keys, EditVersion* read_version,
-                                std::vector<uint64_t>* rss_rowids, int64_t timeout_ms = 0);
+                                std::vector<uint64_t>* rss_rowids, int64_t timeout_ms = 0, bool load_index = true);
 
     Status get_rss_rowids_by_pk_unlock(Tablet* tablet, const Column& keys, EditVersion* read_version,
-                                       std::vector<uint64_t>* rss_rowids);
+                                       std::vector<uint64_t>* rss_rowids, bool load_index = true);
 
     Status get_missing_version_ranges(std::vector<int64_t>& missing_version_ranges);
 
@@ -347,6 +348,10 @@ public:
 
     Status pk_index_major_compaction();
 
+    // Load the primary index into the index cache ahead of the first apply, it does nothing if the
+    // index is already in the cache.
+    Status preload_primary_index();
+
     // get the max rowset creation time for largest major version
     int64_t max_rowset_creation_time();
 
@@ -403,6 +408,9 @@ private:
         int64_t compaction_score = 0;
         int32_t compaction_level = -1;
         bool partial_update_by_column = false;
+        // max number of delta column groups of one segment, only maintained when applying column mode
+        // partial updates
+        size_t num_dcgs = 0;
         std::string to_string() const;
     };
 
@@ -442,6 +450,9 @@ private:
 
     int32_t _calc_compaction_level(RowsetStats* stats);
     void _calc_compaction_score(RowsetStats* stats);
+    static bool _has_too_many_dcgs(const RowsetStats& stats);
+    // Refresh `RowsetStats::num_dcgs` of the rowsets whose segments got new delta column groups.
+    void _update_rowset_dcg_stats(const std::map<uint32_t, DeltaColumnGroupPtr>& dcgs, int64_t version);
 
     Status _do_update(uint32_t rowset_id, int32_t upsert_idx, int32_t condition_column, int64_t read_version,
                       const std::vector<ColumnUniquePtr>& upserts, PrimaryIndex& index, int64_t tablet_id,
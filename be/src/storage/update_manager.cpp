@@ -110,6 +110,15 @@ Status UpdateManager::init() {
     RETURN_IF_ERROR(
             ThreadPoolBuilder("get_pindex").set_max_threads(max_get_thread_cnt).build(&_get_pindex_thread_pool));
 
+    int max_segment_thread_cnt = CpuInfo::num_cores();
+    if (config::transaction_apply_segment_worker_count > 0) {
+        max_segment_thread_cnt = config::transaction_apply_segment_worker_count;
+    }
+    RETURN_IF_ERROR(ThreadPoolBuilder("update_apply_seg")
+                            .set_max_threads(max_segment_thread_cnt)
+                            .build(&_apply_segment_thread_pool));
+    REGISTER_THREAD_POOL_METRICS(update_apply_segment, _apply_segment_thread_pool);
+
     _persistent_index_compaction_mgr = std::make_unique<PersistentIndexCompactionManager>();
     RETURN_IF_ERROR(_persistent_index_compaction_mgr->init());
     return Status::OK();
@@ -122,6 +131,9 @@ void UpdateManager::stop() {
     if (_apply_thread_pool) {
         _apply_thread_pool->shutdown();
     }
+    if (_apply_segment_thread_pool) {
+        _apply_segment_thread_pool->shutdown();
+    }
 }
 
 int64_t UpdateManager::get_index_cache_expire_ms(const Tablet& tablet) const {
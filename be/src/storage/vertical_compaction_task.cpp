@@ -14,6 +14,9 @@
 
 #include "storage/vertical_compaction_task.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <vector>
 
 #include "column/schema.h"
@@ -27,11 +30,82 @@
 #include "storage/rowset/rowset_writer.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_reader_params.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "util/trace.h"
 
 namespace starrocks {
 
+static constexpr int64_t kParallelMaskBlockBytes = 4 * 1024 * 1024;
+
+// The chunks read by the reader of one value column group, bounded in bytes, for the writer to consume in order.
+class ColumnGroupChunkQueue {
+public:
+    explicit ColumnGroupChunkQueue(size_t max_bytes) : _max_bytes(max_bytes) {}
+
+    // Returns false if the queue is cancelled.
+    bool push(ChunkPtr chunk) {
+        size_t bytes = chunk->memory_usage();
+        std::unique_lock l(_mutex);
+        _not_full.wait(l, [this] { return _cancelled || _bytes < _max_bytes; });
+        if (_cancelled) {
+            return false;
+        }
+        _bytes += bytes;
+        _chunks.emplace_back(std::move(chunk), bytes);
+        _not_empty.notify_one();
+        return true;
+    }
+
+    // Returns nullptr after the last chunk, or the error of the reader.
+    StatusOr<ChunkPtr> pop() {
+        std::unique_lock l(_mutex);
+        _not_empty.wait(l, [this] { return !_chunks.empty() || _finished; });
+        if (_chunks.empty()) {
+            RETURN_IF_ERROR(_status);
+            return nullptr;
+        }
+        auto [chunk, bytes] = std::move(_chunks.front());
+        _chunks.pop_front();
+        _bytes -= bytes;
+        _not_full.notify_one();
+        return std::move(chunk);
+    }
+
+    void finish(const Status& status, size_t merged_rows, size_t del_filtered_rows) {
+        std::lock_guard l(_mutex);
+        _status = status;
+        _merged_rows = merged_rows;
+        _del_filtered_rows = del_filtered_rows;
+        _finished = true;
+        _not_empty.notify_one();
+    }
+
+    void cancel() {
+        std::lock_guard l(_mutex);
+        _cancelled = true;
+        _not_full.notify_one();
+    }
+
+    // Valid after pop() returns nullptr.
+    size_t merged_rows() const { return _merged_rows; }
+    size_t del_filtered_rows() const { return _del_filtered_rows; }
+
+private:
+    const size_t _max_bytes;
+    std::mutex _mutex;
+    std::condition_variable _not_full;
+    std::condition_variable _not_empty;
+    std::deque<std::pair<ChunkPtr, size_t>> _chunks;
+    size_t _bytes = 0;
+    bool _finished = false;
+    bool _cancelled = false;
+    Status _status;
+    size_t _merged_rows = 0;
+    size_t _del_filtered_rows = 0;
+};
+
 Status VerticalCompactionTask::run_impl() {
     Statistics statistics;
     RETURN_IF_ERROR(_shortcut_compact(&statistics));
@@ -67,11 +141,18 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
                                               config::vertical_compaction_max_columns_per_group, &column_groups);
     _task_info.column_group_size = column_groups.size();
 
-    auto mask_buffer = std::make_unique<RowSourceMaskBuffer>(_tablet->tablet_id(), _tablet->data_dir()->path());
+    int parallelism = static_cast<int>(std::min<int64_t>(config::vertical_compaction_column_group_parallelism,
+                                                         static_cast<int64_t>(column_groups.size()) - 1));
+    // The readers of the value column groups in parallel read the masks from the temporary file, in small blocks.
+    auto mask_buffer = parallelism > 1 ? std::make_unique<RowSourceMaskBuffer>(_tablet->tablet_id(),
+                                                                               _tablet->data_dir()->path(),
+                                                                               kParallelMaskBlockBytes)
+                                       : std::make_unique<RowSourceMaskBuffer>(_tablet->tablet_id(),
+                                                                               _tablet->data_dir()->path());
     auto source_masks = std::make_unique<std::vector<RowSourceMask>>();
     TRACE("[Compaction] compaction prepare finished, max_rows_per_segment:$0, column groups "
-          "size:$1",
-          max_rows_per_segment, column_groups.size());
+          "size:$1, parallelism:$2",
+          max_rows_per_segment, column_groups.size(), parallelism);
 
     for (size_t i = 0; i < column_groups.size(); ++i) {
         if (should_stop()) {
@@ -79,6 +160,12 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
             return Status::Cancelled("vertical compaction task is stopped.");
         }
         bool is_key = (i == 0);
+        if (!is_key && parallelism > 1) {
+            RETURN_IF_ERROR(mask_buffer->persist());
+            RETURN_IF_ERROR(_compact_value_column_groups_in_parallel(column_groups, parallelism,
+                                                                     output_rs_writer.get(), mask_buffer.get()));
+            break;
+        }
         if (!is_key) {
             // read mask buffer from the beginning
             RETURN_IF_ERROR(mask_buffer->flip_to_read());
@@ -248,4 +335,105 @@ StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chun
     return output_rows;
 }
 
+Status VerticalCompactionTask::_compact_value_column_groups_in_parallel(
+        const std::vector<std::vector<uint32_t>>& column_groups, int parallelism, RowsetWriter* output_rs_writer,
+        RowSourceMaskBuffer* mask_buffer) {
+    // A pool of the task itself, so that the readers ahead blocked by their full queues never hold up the reader
+    // of the column group being written by another task.
+    std::unique_ptr<ThreadPool> pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("vertical_compact")
+                            .set_min_threads(0)
+                            .set_max_threads(parallelism)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(500))
+                            .build(&pool));
+    std::vector<std::shared_ptr<ColumnGroupChunkQueue>> queues;
+    DeferOp cancel_readers([&] {
+        for (auto& queue : queues) {
+            queue->cancel();
+        }
+        pool->shutdown();
+    });
+    // The readers are run in the order of the column groups, so the one being written is always running.
+    for (size_t i = 1; i < column_groups.size(); ++i) {
+        auto queue = std::make_shared<ColumnGroupChunkQueue>(config::vertical_compaction_column_group_buffer_bytes);
+        queues.emplace_back(queue);
+        RuntimeProfile* profile = _runtime_profile.create_child("merge_rowsets");
+        RETURN_IF_ERROR(pool->submit_func([this, &column_groups, i, mask_buffer, profile, queue] {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+            auto group_mask_buffer = mask_buffer->new_reader();
+            Status st = group_mask_buffer.ok()
+                                ? _read_value_column_group(column_groups[i], group_mask_buffer.value().get(), profile,
+                                                           queue.get())
+                                : group_mask_buffer.status();
+            if (!st.ok()) {
+                queue->finish(st, 0, 0);
+            }
+        }));
+    }
+
+    for (size_t i = 1; i < column_groups.size(); ++i) {
+        auto& queue = queues[i - 1];
+        while (true) {
+            if (should_stop()) {
+                LOG(INFO) << "vertical compaction task_id:" << _task_info.task_id << " is stopped.";
+                return Status::Cancelled("vertical compaction task is stopped.");
+            }
+            ASSIGN_OR_RETURN(auto chunk, queue->pop());
+            if (chunk == nullptr) {
+                break;
+            }
+            RETURN_IF_ERROR(output_rs_writer->add_columns(*chunk, column_groups[i], false));
+            _task_info.total_output_num_rows += chunk->num_rows();
+        }
+        _task_info.total_del_filtered_rows += queue->del_filtered_rows();
+        _task_info.total_merged_rows += queue->merged_rows();
+        RETURN_IF_ERROR(output_rs_writer->flush_columns());
+        VLOG(1) << "compaction task_id:" << _task_info.task_id << ", tablet=" << _tablet->tablet_id()
+                << ", column group=" << i << " compacted in parallel";
+    }
+    return Status::OK();
+}
+
+Status VerticalCompactionTask::_read_value_column_group(const std::vector<uint32_t>& column_group,
+                                                        RowSourceMaskBuffer* mask_buffer, RuntimeProfile* profile,
+                                                        ColumnGroupChunkQueue* queue) {
+    Schema schema = ChunkHelper::convert_schema(_tablet_schema, column_group);
+    TabletReader reader(std::static_pointer_cast<Tablet>(_tablet->shared_from_this()), _task_info.output_version,
+                        schema, false, mask_buffer, _tablet_schema);
+    RETURN_IF_ERROR(reader.prepare());
+    TabletReaderParams reader_params;
+    reader_params.reader_type =
+            compaction_type() == BASE_COMPACTION ? READER_BASE_COMPACTION : READER_CUMULATIVE_COMPACTION;
+    reader_params.profile = profile;
+    reader_params.column_access_paths = &_column_access_paths;
+    ASSIGN_OR_RETURN(reader_params.chunk_size, _calculate_chunk_size_for_column_group(column_group));
+    RETURN_IF_ERROR(reader.open(reader_params));
+
+    auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
+    std::vector<RowSourceMask> source_masks;
+    while (true) {
+        if (should_stop()) {
+            return Status::Cancelled("vertical compaction task is stopped.");
+        }
+#ifndef BE_TEST
+        RETURN_IF_ERROR(tls_thread_status.mem_tracker()->check_mem_limit("Compaction"));
+#endif
+        ChunkPtr chunk = ChunkHelper::new_chunk(schema, reader_params.chunk_size);
+        Status status = reader.get_next(chunk.get(), &source_masks);
+        if (status.is_end_of_file()) {
+            break;
+        } else if (!status.ok()) {
+            LOG(WARNING) << "reader get next error. tablet=" << _tablet->tablet_id() << ", err=" << status.to_string();
+            return Status::InternalError(fmt::format("reader get_next error: {}", status.to_string()));
+        }
+        source_masks.clear();
+        ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet_schema, chunk.get());
+        if (!queue->push(std::move(chunk))) {
+            return Status::Cancelled("vertical compaction task is stopped.");
+        }
+    }
+    queue->finish(Status::OK(), reader.merged_rows(), reader.stats().rows_del_filtered);
+    return Status::OK();
+}
+
 } // namespace starrocks
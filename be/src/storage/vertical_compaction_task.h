@@ -28,6 +28,8 @@ class RowsetWriter;
 class TabletReader;
 class RowSourceMaskBuffer;
 struct RowSourceMask;
+class RuntimeProfile;
+class ColumnGroupChunkQueue;
 
 // need a factory of compaction task
 class VerticalCompactionTask : public CompactionTask {
@@ -49,6 +51,15 @@ private:
                                    RowSourceMaskBuffer* mask_buffer, std::vector<RowSourceMask>* source_masks);
 
     StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
+
+    // Reads and merges the value column groups on up to |parallelism| threads, and writes them in order.
+    Status _compact_value_column_groups_in_parallel(const std::vector<std::vector<uint32_t>>& column_groups,
+                                                    int parallelism, RowsetWriter* output_rs_writer,
+                                                    RowSourceMaskBuffer* mask_buffer);
+
+    // Reads a value column group into |queue|, run by the threads of _compact_value_column_groups_in_parallel.
+    Status _read_value_column_group(const std::vector<uint32_t>& column_group, RowSourceMaskBuffer* mask_buffer,
+                                    RuntimeProfile* profile, ColumnGroupChunkQueue* queue);
 };
 
 } // namespace starrocks
@@ -222,6 +222,64 @@ BitmapValue& BitmapValue::operator|=(const BitmapValue& rhs) {
 // SINGLE -> EMPTY
 // BITMAP -> EMPTY
 // BITMAP -> SINGLE
+void BitmapValue::fast_union(const std::vector<const BitmapValue*>& values) {
+    std::vector<const detail::Roaring64Map*> bitmaps;
+    for (const auto* value : values) {
+        if (value->_type == BITMAP) {
+            bitmaps.emplace_back(value->_bitmap.get());
+        }
+    }
+    if (bitmaps.size() < 2) {
+        for (const auto* value : values) {
+            *this |= *value;
+        }
+        return;
+    }
+
+    if (_type == BITMAP) {
+        bitmaps.emplace_back(_bitmap.get());
+    }
+    // _bitmap may be shared with others, so the union is always built into a new one.
+    auto bitmap = std::make_shared<detail::Roaring64Map>(
+            detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+    if (_type == SINGLE) {
+        bitmap->add(_sv);
+    } else if (_type == SET) {
+        for (auto x : *_set) {
+            bitmap->add(x);
+        }
+        _set.reset();
+    }
+    for (const auto* value : values) {
+        if (value->_type == SINGLE) {
+            bitmap->add(value->_sv);
+        } else if (value->_type == SET) {
+            for (auto x : *value->_set) {
+                bitmap->add(x);
+            }
+        }
+    }
+    _bitmap = std::move(bitmap);
+    _type = BITMAP;
+    _mem_usage = 0;
+}
+
+void BitmapValue::fast_intersect(const std::vector<const BitmapValue*>& values) {
+    std::vector<std::pair<int64_t, const BitmapValue*>> sorted_values;
+    sorted_values.reserve(values.size());
+    for (const auto* value : values) {
+        sorted_values.emplace_back(value->cardinality(), value);
+    }
+    std::sort(sorted_values.begin(), sorted_values.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    for (const auto& [_, value] : sorted_values) {
+        if (_type == EMPTY) {
+            break;
+        }
+        *this &= *value;
+    }
+}
+
 BitmapValue& BitmapValue::operator&=(const BitmapValue& rhs) {
     _mem_usage = 0;
     switch (rhs._type) {
@@ -46,6 +46,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "column/vectorized_fwd.h"
 #include "common/config.h"
@@ -143,6 +144,14 @@ public:
     // BITMAP -> SINGLE
     BitmapValue& operator&=(const BitmapValue& rhs);
 
+    // Same as |= all the `values` one by one, but the bitmaps of them are unioned at once by
+    // Roaring64Map::fastunion, which repairs the container cardinalities only once.
+    void fast_union(const std::vector<const BitmapValue*>& values);
+
+    // Same as &= all the `values` one by one, but from the smallest one, so the result shrinks as early
+    // as possible, and stops once the result is empty.
+    void fast_intersect(const std::vector<const BitmapValue*>& values);
+
     void remove(uint64_t rhs);
 
     BitmapValue& operator-=(const BitmapValue& rhs);
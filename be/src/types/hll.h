@@ -115,6 +115,10 @@ public:
 
     void merge(const HyperLogLog& other);
 
+    // Same as merge(HyperLogLog(slice)), but merges the registers right from the serialized binary
+    // without materializing another HLL. Return false and do nothing if `slice` isn't valid.
+    bool merge_serialized(const Slice& slice);
+
     // Return max size of serialized binary
     size_t max_serialized_size() const;
 
@@ -34,8 +34,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include "common/config.h"
@@ -51,6 +53,10 @@
 
 namespace starrocks {
 
+// The rpcs of the different traffic classes to the same endpoint go through the different connections, so the small
+// control rpcs, e.g. the runtime filters, never queue behind the large chunks of the exchanges and the loads.
+enum class BrpcTrafficClass : int { CONTROL = 0, EXCHANGE = 1, LOAD = 2 };
+
 // map used
 class BrpcStubCache {
 public:
@@ -67,22 +73,25 @@ public:
         }
     }
 
-    std::shared_ptr<PInternalService_RecoverableStub> get_stub(const butil::EndPoint& endpoint) {
+    std::shared_ptr<PInternalService_RecoverableStub> get_stub(
+            const butil::EndPoint& endpoint, BrpcTrafficClass traffic_class = BrpcTrafficClass::CONTROL) {
         std::lock_guard<SpinLock> l(_lock);
-        auto stub_pool = _stub_map.seek(endpoint);
-        if (stub_pool == nullptr) {
-            StubPool* pool = new StubPool();
-            _stub_map.insert(endpoint, pool);
-            return pool->get_or_create(endpoint);
+        auto stub_pools = _stub_map.seek(endpoint);
+        if (stub_pools == nullptr) {
+            StubPools* pools = new StubPools();
+            _stub_map.insert(endpoint, pools);
+            return pools->get_or_create(endpoint, traffic_class);
         }
-        return (*stub_pool)->get_or_create(endpoint);
+        return (*stub_pools)->get_or_create(endpoint, traffic_class);
     }
 
-    std::shared_ptr<PInternalService_RecoverableStub> get_stub(const TNetworkAddress& taddr) {
-        return get_stub(taddr.hostname, taddr.port);
+    std::shared_ptr<PInternalService_RecoverableStub> get_stub(
+            const TNetworkAddress& taddr, BrpcTrafficClass traffic_class = BrpcTrafficClass::CONTROL) {
+        return get_stub(taddr.hostname, taddr.port, traffic_class);
     }
 
-    std::shared_ptr<PInternalService_RecoverableStub> get_stub(const std::string& host, int port) {
+    std::shared_ptr<PInternalService_RecoverableStub> get_stub(
+            const std::string& host, int port, BrpcTrafficClass traffic_class = BrpcTrafficClass::CONTROL) {
         butil::EndPoint endpoint;
         std::string realhost;
         std::string brpc_url;
@@ -99,26 +108,30 @@ public:
             LOG(WARNING) << "unknown endpoint, host=" << host;
             return nullptr;
         }
-        return get_stub(endpoint);
+        return get_stub(endpoint, traffic_class);
     }
 
 private:
-    // StubPool is used to store all stubs with a single endpoint, and the client in the same BE process maintains up to
-    // brpc_max_connections_per_server single connections with each server.
+    static constexpr int kNumTrafficClasses = 3;
+
+    // StubPool is used to store all stubs of a traffic class with a single endpoint, and the client in the same BE
+    // process maintains up to max_connections(traffic_class) single connections of the traffic class with each server.
     // These connections will be created during the first few accesses and will be reused later.
     struct StubPool {
-        StubPool() { _stubs.reserve(config::brpc_max_connections_per_server); }
-
-        std::shared_ptr<PInternalService_RecoverableStub> get_or_create(const butil::EndPoint& endpoint) {
-            if (UNLIKELY(_stubs.size() < config::brpc_max_connections_per_server)) {
-                auto stub = std::make_shared<PInternalService_RecoverableStub>(endpoint);
+        std::shared_ptr<PInternalService_RecoverableStub> get_or_create(const butil::EndPoint& endpoint,
+                                                                        BrpcTrafficClass traffic_class) {
+            const int64_t max_connections = max_connections_of(traffic_class);
+            if (UNLIKELY(static_cast<int64_t>(_stubs.size()) < max_connections)) {
+                // every stub has its own connection group, otherwise the stubs share the same single connection
+                auto stub = std::make_shared<PInternalService_RecoverableStub>(
+                        endpoint, connection_group_of(traffic_class, _stubs.size()));
                 if (!stub->reset_channel().ok()) {
                     return nullptr;
                 }
                 _stubs.push_back(stub);
                 return stub;
             }
-            if (++_idx >= config::brpc_max_connections_per_server) {
+            if (++_idx >= max_connections) {
                 _idx = 0;
             }
             return _stubs[_idx];
@@ -128,8 +141,39 @@ private:
         int64_t _idx = -1;
     };
 
+    struct StubPools {
+        std::shared_ptr<PInternalService_RecoverableStub> get_or_create(const butil::EndPoint& endpoint,
+                                                                        BrpcTrafficClass traffic_class) {
+            return pools[static_cast<int>(traffic_class)].get_or_create(endpoint, traffic_class);
+        }
+
+        StubPool pools[kNumTrafficClasses];
+    };
+
+    static int64_t max_connections_of(BrpcTrafficClass traffic_class) {
+        switch (traffic_class) {
+        case BrpcTrafficClass::EXCHANGE:
+            return std::max(1, config::brpc_exchange_max_connections_per_server);
+        case BrpcTrafficClass::LOAD:
+            return std::max(1, config::brpc_load_max_connections_per_server);
+        default:
+            return std::max(1, config::brpc_max_connections_per_server);
+        }
+    }
+
+    static std::string connection_group_of(BrpcTrafficClass traffic_class, size_t index) {
+        switch (traffic_class) {
+        case BrpcTrafficClass::EXCHANGE:
+            return "exchange-" + std::to_string(index) + "-";
+        case BrpcTrafficClass::LOAD:
+            return "load-" + std::to_string(index) + "-";
+        default:
+            return "control-" + std::to_string(index) + "-";
+        }
+    }
+
     SpinLock _lock;
-    butil::FlatMap<butil::EndPoint, StubPool*> _stub_map;
+    butil::FlatMap<butil::EndPoint, StubPools*> _stub_map;
 };
 
 class HttpBrpcStubCache {
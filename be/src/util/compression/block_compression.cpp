@@ -42,6 +42,7 @@
 #include <snappy/snappy-sinksource.h>
 #include <snappy/snappy.h>
 #include <zlib.h>
+#include <zstd/zdict.h>
 #include <zstd/zstd.h>
 #include <zstd/zstd_errors.h>
 
@@ -720,6 +721,9 @@ class ZstdBlockCompression final : public BlockCompressionCodec {
 public:
     ZstdBlockCompression() : BlockCompressionCodec(CompressionTypePB::ZSTD), _level(-1) {}
     ZstdBlockCompression(int level) : BlockCompressionCodec(CompressionTypePB::ZSTD), _level(level) {}
+    // The digested dictionaries are owned by this codec.
+    ZstdBlockCompression(ZSTD_CDict* cdict, ZSTD_DDict* ddict)
+            : BlockCompressionCodec(CompressionTypePB::ZSTD), _level(-1), _cdict(cdict), _ddict(ddict) {}
 
     static const ZstdBlockCompression* instance() {
         static ZstdBlockCompression s_instance;
@@ -741,7 +745,10 @@ public:
         return &s_instances[level - 1];
     }
 
-    ~ZstdBlockCompression() override = default;
+    ~ZstdBlockCompression() override {
+        ZSTD_freeCDict(_cdict);
+        ZSTD_freeDDict(_ddict);
+    }
 
     Status compress(const Slice& input, Slice* output, bool use_compression_buffer, size_t uncompressed_size,
                     faststring* compressed_body1, raw::RawString* compressed_body2) const override {
@@ -786,6 +793,15 @@ private:
                         strings::Substitute("ZSTD set level failed: $0", ZSTD_getErrorString(ZSTD_getErrorCode(ret))));
             }
         }
+        // The dictionary is dropped when the context is reset and returned to the pool.
+        if (_cdict != nullptr) {
+            ret = ZSTD_CCtx_refCDict(ctx, _cdict);
+            if (ZSTD_isError(ret)) {
+                context->compression_fail = true;
+                return Status::InternalError(strings::Substitute("ZSTD set dictionary failed: $0",
+                                                                 ZSTD_getErrorString(ZSTD_getErrorCode(ret))));
+            }
+        }
 
         [[maybe_unused]] faststring* compression_buffer = nullptr;
         [[maybe_unused]] size_t max_len = 0;
@@ -889,7 +905,10 @@ private:
             output->size = 0;
         }
 
-        size_t ret = ZSTD_decompressDCtx(ctx, output->data, output->size, input.data, input.size);
+        size_t ret = _ddict == nullptr
+                             ? ZSTD_decompressDCtx(ctx, output->data, output->size, input.data, input.size)
+                             : ZSTD_decompress_usingDDict(ctx, output->data, output->size, input.data, input.size,
+                                                          _ddict);
         if (ZSTD_isError(ret)) {
             context->decompression_fail = true;
             return Status::InvalidArgument(
@@ -900,6 +919,8 @@ private:
     }
 
     int _level;
+    ZSTD_CDict* _cdict = nullptr;
+    ZSTD_DDict* _ddict = nullptr;
 };
 
 class GzipBlockCompression : public ZlibBlockCompression {
@@ -1110,6 +1131,42 @@ public:
     size_t max_compressed_len(size_t len) const override { return size_t(-1); }
 };
 
+StatusOr<std::string> train_zstd_dictionary(const std::vector<Slice>& samples, size_t max_dict_size) {
+    std::string samples_buffer;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto& sample : samples) {
+        samples_buffer.append(sample.data, sample.size);
+        sample_sizes.push_back(sample.size);
+    }
+    std::string dict;
+    raw::stl_string_resize_uninitialized(&dict, max_dict_size);
+    size_t ret = ZDICT_trainFromBuffer(dict.data(), dict.size(), samples_buffer.data(), sample_sizes.data(),
+                                       static_cast<unsigned>(sample_sizes.size()));
+    if (ZDICT_isError(ret)) {
+        return Status::InvalidArgument(
+                strings::Substitute("ZSTD train dictionary failed: $0", ZDICT_getErrorName(ret)));
+    }
+    dict.resize(ret);
+    return dict;
+}
+
+StatusOr<std::unique_ptr<BlockCompressionCodec>> new_zstd_dict_compression_codec(const Slice& dict,
+                                                                                  int compression_level) {
+    int level = compression_level == -1 ? ZSTD_CLEVEL_DEFAULT : compression_level;
+    if (level < 1 || level > 22) {
+        return Status::InvalidArgument(strings::Substitute("ZSTD with invalid compression level: $0", level));
+    }
+    ZSTD_CDict* cdict = ZSTD_createCDict(dict.data, dict.size, level);
+    ZSTD_DDict* ddict = ZSTD_createDDict(dict.data, dict.size);
+    if (cdict == nullptr || ddict == nullptr) {
+        ZSTD_freeCDict(cdict);
+        ZSTD_freeDDict(ddict);
+        return Status::InvalidArgument("Fail to create ZSTD dictionary");
+    }
+    return std::make_unique<ZstdBlockCompression>(cdict, ddict);
+}
+
 Status get_block_compression_codec(CompressionTypePB type, const BlockCompressionCodec** codec, int compression_level) {
     switch (type) {
     case CompressionTypePB::NO_COMPRESSION:
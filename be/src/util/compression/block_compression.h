@@ -35,9 +35,11 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 #include "common/status.h"
+#include "common/statusor.h"
 #include "gen_cpp/segment.pb.h"
 #include "util/raw_container.h"
 #include "util/slice.h"
@@ -111,4 +113,14 @@ Status get_block_compression_codec(CompressionTypePB type, const BlockCompressio
 
 bool use_compression_pool(CompressionTypePB type);
 
+// Train a ZSTD dictionary of at most |max_dict_size| bytes from |samples|, such as the
+// uncompressed bodies of the first pages of a column.
+StatusOr<std::string> train_zstd_dictionary(const std::vector<Slice>& samples, size_t max_dict_size);
+
+// Create a ZSTD codec which compresses and decompresses with the dictionary |dict|.
+// The dictionary is digested once when the codec is created, so the codec should be kept
+// and shared by all the users of the same dictionary instead of being created per page.
+StatusOr<std::unique_ptr<BlockCompressionCodec>> new_zstd_dict_compression_codec(const Slice& dict,
+                                                                                  int compression_level = -1);
+
 } // namespace starrocks
@@ -96,6 +96,14 @@ public:
 
     static std::vector<size_t> get_core_ids();
 
+    /// Returns the NUMA node that `core` belongs to, or 0 if it is out of range.
+    static int get_numa_node_for_core(int core) {
+        if (core < 0 || core >= max_num_cores_ || core_to_numa_node_ == nullptr) {
+            return 0;
+        }
+        return core_to_numa_node_[core];
+    }
+
     static bool is_cgroup_with_cpuset() { return is_cgroup_with_cpuset_; }
     static bool is_cgroup_with_cpu_quota() { return is_cgroup_with_cpu_quota_; }
 
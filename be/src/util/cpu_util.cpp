@@ -16,6 +16,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <map>
+
 #include "common/config.h"
 #include "util/thread.h"
 
@@ -50,6 +53,48 @@ void CpuUtil::bind_cpus(Thread* thread, const std::vector<size_t>& cpuids) {
     thread->set_first_bound_cpuid(cpuids[0]);
 }
 
+CpuUtil::CpuIds CpuUtil::pick_numa_local_cpuids(CpuIds* cpuids, size_t num,
+                                                 const std::function<int(CpuId)>& get_numa_node) {
+    num = std::min(num, cpuids->size());
+    if (num == 0) {
+        return {};
+    }
+
+    std::map<int, CpuIds> node_to_cpuids;
+    for (const auto cpuid : *cpuids) {
+        node_to_cpuids[get_numa_node(cpuid)].emplace_back(cpuid);
+    }
+
+    // Prefer the smallest node which can hold all the cpuids, to keep the larger nodes for the others.
+    // Otherwise, fill the largest nodes first.
+    std::vector<const CpuIds*> nodes;
+    nodes.reserve(node_to_cpuids.size());
+    for (const auto& [_, node_cpuids] : node_to_cpuids) {
+        nodes.emplace_back(&node_cpuids);
+    }
+    std::stable_sort(nodes.begin(), nodes.end(),
+                     [](const auto* lhs, const auto* rhs) { return lhs->size() > rhs->size(); });
+    auto fit_it = std::find_if(nodes.rbegin(), nodes.rend(), [num](const auto* node) { return node->size() >= num; });
+    if (fit_it != nodes.rend()) {
+        std::rotate(nodes.begin(), std::prev(fit_it.base()), fit_it.base());
+    }
+
+    CpuIds picked;
+    picked.reserve(num);
+    for (const auto* node_cpuids : nodes) {
+        const size_t n = std::min(num - picked.size(), node_cpuids->size());
+        picked.insert(picked.end(), node_cpuids->begin(), node_cpuids->begin() + n);
+        if (picked.size() == num) {
+            break;
+        }
+    }
+
+    std::erase_if(*cpuids, [&picked](CpuId cpuid) {
+        return std::find(picked.begin(), picked.end(), cpuid) != picked.end();
+    });
+    return picked;
+}
+
 std::string CpuUtil::to_string(const CpuIds& cpuids) {
     std::string result = "(";
     for (size_t i = 0; i < cpuids.size(); i++) {
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include "common/status.h"
@@ -29,6 +30,11 @@ public:
 
     static void bind_cpus(Thread* thread, const std::vector<size_t>& cpuids);
 
+    // Pick `num` cpuids out of `cpuids` and remove them from `cpuids`.
+    // The picked cpuids are placed in as few NUMA nodes as possible, so that threads bound to them
+    // don't touch memory of the remote node. `get_numa_node` returns the NUMA node of a cpuid.
+    static CpuIds pick_numa_local_cpuids(CpuIds* cpuids, size_t num, const std::function<int(CpuId)>& get_numa_node);
+
     static std::string to_string(const CpuIds& cpuids);
 };
 
@@ -0,0 +1,217 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/ddsketch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "util/coding.h"
+
+namespace starrocks {
+
+static const double kGamma = (1 + DDSketch::kRelativeAccuracy) / (1 - DDSketch::kRelativeAccuracy);
+static const double kLogGamma = std::log(kGamma);
+
+int32_t DDSketch::_key(double abs_value) {
+    return static_cast<int32_t>(std::ceil(std::log(abs_value) / kLogGamma));
+}
+
+// The middle of the bucket (gamma^(key-1), gamma^key] in terms of the relative error.
+double DDSketch::_value(int32_t key) {
+    return 2 * std::exp(key * kLogGamma) / (1 + kGamma);
+}
+
+void DDSketch::Store::extend_range(int32_t key) {
+    if (counts.empty()) {
+        min_key = key;
+        counts.assign(1, 0);
+        return;
+    }
+    int64_t new_min_key = std::min(key, min_key);
+    const int64_t new_max_key = std::max(key, max_key());
+    if (new_max_key - new_min_key + 1 > static_cast<int64_t>(kMaxNumBuckets)) {
+        new_min_key = new_max_key - static_cast<int64_t>(kMaxNumBuckets) + 1;
+    }
+    std::vector<uint64_t> new_counts(new_max_key - new_min_key + 1, 0);
+    for (size_t i = 0; i < counts.size(); ++i) {
+        const int64_t k = std::max<int64_t>(min_key + static_cast<int64_t>(i), new_min_key);
+        new_counts[k - new_min_key] += counts[i];
+    }
+    counts.swap(new_counts);
+    min_key = static_cast<int32_t>(new_min_key);
+}
+
+void DDSketch::Store::add(int32_t key, uint64_t count) {
+    if (counts.empty() || key < min_key || key > max_key()) {
+        extend_range(key);
+    }
+    counts[std::max(key, min_key) - min_key] += count;
+    total += count;
+}
+
+void DDSketch::Store::merge(const Store& other) {
+    if (other.counts.empty()) {
+        return;
+    }
+    // Extend to the higher end first, so the lower end is clamped to the collapsed range.
+    if (counts.empty() || other.max_key() > max_key()) {
+        extend_range(other.max_key());
+    }
+    if (other.min_key < min_key) {
+        extend_range(other.min_key);
+    }
+    for (size_t i = 0; i < other.counts.size(); ++i) {
+        const int32_t key = std::max(other.min_key + static_cast<int32_t>(i), min_key);
+        counts[key - min_key] += other.counts[i];
+    }
+    total += other.total;
+}
+
+void DDSketch::add(double value) {
+    if (!std::isfinite(value)) {
+        return;
+    }
+    if (value > kMinIndexableValue) {
+        _positive.add(_key(value), 1);
+    } else if (value < -kMinIndexableValue) {
+        _negative.add(_key(-value), 1);
+    } else {
+        _zero_count++;
+    }
+}
+
+void DDSketch::add(const double* values, size_t num_values) {
+    for (size_t i = 0; i < num_values; ++i) {
+        add(values[i]);
+    }
+}
+
+void DDSketch::merge(const DDSketch& other) {
+    _positive.merge(other._positive);
+    _negative.merge(other._negative);
+    _zero_count += other._zero_count;
+}
+
+double DDSketch::quantile(double q) const {
+    const uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+    const double rank = std::clamp(q, 0.0, 1.0) * static_cast<double>(total - 1);
+    uint64_t cumulative = 0;
+    for (size_t i = _negative.counts.size(); i-- > 0;) {
+        cumulative += _negative.counts[i];
+        if (cumulative > rank) {
+            return -_value(_negative.min_key + static_cast<int32_t>(i));
+        }
+    }
+    cumulative += _zero_count;
+    if (cumulative > rank || _positive.counts.empty()) {
+        return 0;
+    }
+    for (size_t i = 0; i < _positive.counts.size(); ++i) {
+        cumulative += _positive.counts[i];
+        if (cumulative > rank) {
+            return _value(_positive.min_key + static_cast<int32_t>(i));
+        }
+    }
+    return _value(_positive.max_key());
+}
+
+// Format of a store: varint32 number of the buckets, and if it's not 0, fixed32 min_key followed by
+// the varint64 counts of all the buckets.
+size_t DDSketch::Store::serialize_size() const {
+    size_t size = varint_length(counts.size());
+    if (!counts.empty()) {
+        size += sizeof(uint32_t);
+        for (uint64_t count : counts) {
+            size += varint_length(count);
+        }
+    }
+    return size;
+}
+
+uint8_t* DDSketch::Store::serialize(uint8_t* dst) const {
+    dst = encode_varint32(dst, static_cast<uint32_t>(counts.size()));
+    if (!counts.empty()) {
+        encode_fixed32_le(dst, static_cast<uint32_t>(min_key));
+        dst += sizeof(uint32_t);
+        for (uint64_t count : counts) {
+            dst = encode_varint64(dst, count);
+        }
+    }
+    return dst;
+}
+
+const uint8_t* DDSketch::Store::deserialize(const uint8_t* src, const uint8_t* end) {
+    uint32_t num_buckets = 0;
+    src = decode_varint32_ptr(src, end, &num_buckets);
+    if (src == nullptr || num_buckets > kMaxNumBuckets) {
+        return nullptr;
+    }
+    counts.assign(num_buckets, 0);
+    total = 0;
+    min_key = 0;
+    if (num_buckets == 0) {
+        return src;
+    }
+    if (src + sizeof(uint32_t) > end) {
+        return nullptr;
+    }
+    min_key = static_cast<int32_t>(decode_fixed32_le(src));
+    src += sizeof(uint32_t);
+    for (uint32_t i = 0; i < num_buckets; ++i) {
+        src = decode_varint64_ptr(src, end, &counts[i]);
+        if (src == nullptr) {
+            return nullptr;
+        }
+        total += counts[i];
+    }
+    return src;
+}
+
+// Format: 1 byte version, varint64 count of 0, the positive store and the negative store.
+size_t DDSketch::serialize_size() const {
+    return 1 + varint_length(_zero_count) + _positive.serialize_size() + _negative.serialize_size();
+}
+
+size_t DDSketch::serialize(uint8_t* dst) const {
+    uint8_t* ptr = dst;
+    *ptr++ = kVersion;
+    ptr = encode_varint64(ptr, _zero_count);
+    ptr = _positive.serialize(ptr);
+    ptr = _negative.serialize(ptr);
+    return ptr - dst;
+}
+
+bool DDSketch::deserialize(const Slice& src) {
+    const auto* ptr = reinterpret_cast<const uint8_t*>(src.data);
+    const uint8_t* end = ptr + src.size;
+    if (src.size < 1 || *ptr++ != kVersion) {
+        return false;
+    }
+    ptr = decode_varint64_ptr(ptr, end, &_zero_count);
+    if (ptr == nullptr) {
+        return false;
+    }
+    ptr = _positive.deserialize(ptr, end);
+    if (ptr == nullptr) {
+        return false;
+    }
+    ptr = _negative.deserialize(ptr, end);
+    return ptr == end;
+}
+
+} // namespace starrocks
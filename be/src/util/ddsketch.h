@@ -0,0 +1,90 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/slice.h"
+
+namespace starrocks {
+
+// DDSketch is a fully mergeable quantile sketch with a relative error guarantee, see
+// "DDSketch: A Fast and Fully-Mergeable Quantile Sketch with Relative-Error Guarantees" (VLDB 2019).
+//
+// A value v is counted in the bucket ceil(log_gamma(|v|)), gamma = (1 + alpha) / (1 - alpha), so a quantile is
+// returned with a relative error of at most alpha = kRelativeAccuracy. The positive and the negative values are
+// counted in two dense stores of at most kMaxNumBuckets buckets each. Once a store is full, its lowest buckets,
+// i.e. those of the smallest magnitudes, are collapsed into one, so the memory is bounded whatever the input is.
+// Merging two sketches just adds up the counts of the same buckets.
+class DDSketch {
+public:
+    static constexpr double kRelativeAccuracy = 0.01;
+    static constexpr size_t kMaxNumBuckets = 2048;
+    // The values whose magnitude is less than this are counted as 0.
+    static constexpr double kMinIndexableValue = 1e-9;
+
+    // NaN and infinite values are ignored.
+    void add(double value);
+    void add(const double* values, size_t num_values);
+
+    void merge(const DDSketch& other);
+
+    // Return 0 if the sketch is empty.
+    double quantile(double q) const;
+
+    uint64_t count() const { return _zero_count + _positive.total + _negative.total; }
+
+    // Exact size of the serialized sketch.
+    size_t serialize_size() const;
+    // Return the number of the bytes written.
+    size_t serialize(uint8_t* dst) const;
+    // Return false if `src` isn't a serialized sketch, the content of this sketch is undefined then.
+    bool deserialize(const Slice& src);
+
+    size_t mem_usage() const {
+        return sizeof(*this) + (_positive.counts.capacity() + _negative.counts.capacity()) * sizeof(uint64_t);
+    }
+
+private:
+    static constexpr uint8_t kVersion = 1;
+
+    // Counts of the keys [min_key, min_key + counts.size()).
+    struct Store {
+        int32_t min_key = 0;
+        std::vector<uint64_t> counts;
+        uint64_t total = 0;
+
+        int32_t max_key() const { return min_key + static_cast<int32_t>(counts.size()) - 1; }
+        void add(int32_t key, uint64_t count);
+        void merge(const Store& other);
+        // Make [min_key, max_key] cover `key`, or collapse the lowest buckets if it would be too wide.
+        void extend_range(int32_t key);
+
+        size_t serialize_size() const;
+        uint8_t* serialize(uint8_t* dst) const;
+        const uint8_t* deserialize(const uint8_t* src, const uint8_t* end);
+    };
+
+    static int32_t _key(double abs_value);
+    static double _value(int32_t key);
+
+    Store _positive;
+    Store _negative;
+    uint64_t _zero_count = 0;
+};
+
+} // namespace starrocks
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -23,8 +24,10 @@
 #include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "column/column_hash.h"
+#include "common/compiler_util.h"
 #include "glog/logging.h"
 namespace starrocks {
 
@@ -202,4 +205,208 @@ private:
     uint8_t _hash_table[hash_table_size + 1];
 };
 
+// DenseRangeHashMap
+// Key: integer in [0, max_range), e.g. the codes of a low cardinality global dict
+// A direct-addressed table indexed by the key, it grows to cover the largest key seen so far.
+// The caller must make sure the key, as unsigned, is less than max_range.
+// value shouldn't be nullptr
+template <typename KeyType, typename ValueType, PhmapSeed seed>
+class DenseRangeHashMap {
+public:
+    static_assert(std::is_integral_v<KeyType>);
+    static_assert(std::is_pointer_v<ValueType>);
+    static constexpr size_t max_range = 1 << 16;
+    static constexpr size_t min_range = 256;
+
+    using key_type = KeyType;
+    using search_key_type = typename std::make_unsigned<KeyType>::type;
+
+    DenseRangeHashMap() { _resize(min_range); }
+
+    struct PPair {
+        using Cell = std::pair<KeyType, ValueType>;
+        PPair(KeyType key, ValueType value) : _data(key, value) {}
+        Cell _data;
+        Cell* operator->() { return &_data; }
+    };
+
+    class iterator {
+    public:
+        iterator(const ValueType* hash_table_begin, uint32_t hash_table_key)
+                : _hash_table_key(hash_table_key), _hash_table_begin(hash_table_begin) {}
+
+        PPair operator->() const { return {static_cast<KeyType>(_hash_table_key), _hash_table_begin[_hash_table_key]}; }
+
+        iterator& operator++() {
+            _hash_table_key++;
+            skip_empty_value();
+            return *this;
+        }
+
+        void skip_empty_value() {
+            while (_hash_table_begin[_hash_table_key] == nullptr) {
+                ++_hash_table_key;
+            }
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b) { return a._hash_table_key == b._hash_table_key; }
+        friend bool operator!=(const iterator& a, const iterator& b) { return !(a == b); }
+
+    private:
+        uint32_t _hash_table_key;
+        const ValueType* _hash_table_begin;
+    };
+
+    template <class F>
+    iterator lazy_emplace(KeyType key, F&& f) {
+        auto search_key = static_cast<search_key_type>(key);
+        DCHECK_LT(search_key, max_range);
+        if (UNLIKELY(search_key >= _range)) {
+            _resize(std::min<size_t>(std::max<size_t>(_range * 2, search_key + 1), max_range));
+        }
+        if (_hash_table[search_key] == nullptr) {
+            _size++;
+            f([&](KeyType key, ValueType value) {
+                DCHECK(value != nullptr);
+                _hash_table[search_key] = value;
+            });
+        }
+        return iterator(_hash_table.data(), search_key);
+    }
+
+    iterator find(KeyType key) {
+        auto search_key = static_cast<search_key_type>(key);
+        if (search_key >= _range || _hash_table[search_key] == nullptr) {
+            return end();
+        }
+        return iterator(_hash_table.data(), search_key);
+    }
+
+    iterator begin() {
+        auto iter = iterator(_hash_table.data(), 0);
+        iter.skip_empty_value();
+        return iter;
+    }
+
+    iterator end() { return iterator(_hash_table.data(), _range); }
+
+    void prefetch_hash(size_t hashval) const {
+        __builtin_prefetch(static_cast<const void*>(_hash_table.data() + std::min(hashval, _range)));
+    }
+
+    template <class F>
+    iterator lazy_emplace_with_hash(KeyType key, size_t& hashval, F&& f) {
+        return lazy_emplace(key, f);
+    }
+
+    struct HashFunction {
+        size_t operator()(KeyType key) { return static_cast<search_key_type>(key); }
+    };
+
+    HashFunction hash_function() { return HashFunction(); }
+
+    size_t bucket_count() { return _range; }
+
+    size_t size() { return _size; }
+
+    size_t capacity() { return bucket_count(); }
+
+    size_t dump_bound() { return _range * sizeof(ValueType); }
+
+private:
+    void _resize(size_t range) {
+        // the slot past the range is a non-null sentinel which stops the iterator
+        _hash_table.resize(range + 1, nullptr);
+        _hash_table[_range] = nullptr;
+        _hash_table[range] = reinterpret_cast<ValueType>(0xFFFF);
+        _range = range;
+    }
+
+    size_t _size = 0;
+    size_t _range = 0;
+    std::vector<ValueType> _hash_table;
+};
+
+template <typename KeyType, PhmapSeed seed>
+class DenseRangeHashSet {
+public:
+    static_assert(std::is_integral_v<KeyType>);
+    static constexpr size_t max_range = 1 << 16;
+    static constexpr size_t min_range = 256;
+
+    using key_type = KeyType;
+    using search_key_type = typename std::make_unsigned<KeyType>::type;
+
+    class iterator {
+    public:
+        iterator(const uint8_t* hash_table_begin, uint32_t cursor)
+                : _hash_table_begin(hash_table_begin), _cursor(cursor) {}
+
+        KeyType operator*() const { return static_cast<KeyType>(_cursor); }
+
+        iterator& operator++() {
+            _cursor++;
+            skip_empty_value();
+            return *this;
+        }
+
+        void skip_empty_value() {
+            while (_hash_table_begin[_cursor] == 0) {
+                ++_cursor;
+            }
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b) { return a._cursor == b._cursor; }
+        friend bool operator!=(const iterator& a, const iterator& b) { return !(a == b); }
+
+    private:
+        const uint8_t* _hash_table_begin;
+        uint32_t _cursor;
+    };
+
+    DenseRangeHashSet() { _resize(min_range); }
+
+    iterator begin() {
+        auto iter = iterator(_hash_table.data(), 0);
+        iter.skip_empty_value();
+        return iter;
+    }
+
+    iterator end() { return iterator(_hash_table.data(), _range); }
+
+    void emplace(KeyType key) {
+        auto search_key = static_cast<search_key_type>(key);
+        DCHECK_LT(search_key, max_range);
+        if (UNLIKELY(search_key >= _range)) {
+            _resize(std::min<size_t>(std::max<size_t>(_range * 2, search_key + 1), max_range));
+        }
+        _size += _hash_table[search_key] == 0;
+        _hash_table[search_key] = 1;
+    }
+
+    bool contains(KeyType key) {
+        auto search_key = static_cast<search_key_type>(key);
+        return search_key < _range && _hash_table[search_key];
+    }
+
+    size_t dump_bound() { return _range; }
+
+    size_t size() { return _size; }
+
+    size_t capacity() { return _range; }
+
+private:
+    void _resize(size_t range) {
+        // the slot past the range is a non-zero sentinel which stops the iterator
+        _hash_table.resize(range + 1, 0);
+        _hash_table[_range] = 0;
+        _hash_table[range] = 0xFF;
+        _range = range;
+    }
+
+    size_t _size = 0;
+    size_t _range = 0;
+    std::vector<uint8_t> _hash_table;
+};
+
 } // namespace starrocks
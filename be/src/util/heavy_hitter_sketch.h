@@ -0,0 +1,87 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+// HeavyHitterSketch finds the most frequent items of a stream in bounded memory with the Space-Saving algorithm
+// (Metwally et al., Efficient Computation of Frequent and Top-k Elements in Data Streams).
+// It keeps `capacity` counters. When a new item comes and all the counters are used, the item takes over the
+// counter with the minimum count and inherits the count as its error. So every item whose frequency is greater than
+// total / capacity is guaranteed to be kept, and `count - error` is a lower bound of its frequency.
+template <typename T>
+class HeavyHitterSketch {
+public:
+    struct Counter {
+        T item;
+        uint64_t count;
+        uint64_t error;
+    };
+
+    explicit HeavyHitterSketch(size_t capacity) : _capacity(capacity) { _counters.reserve(capacity); }
+
+    void add(const T& item, uint64_t count = 1) {
+        _total += count;
+        if (auto iter = _index.find(item); iter != _index.end()) {
+            _counters[iter->second].count += count;
+            return;
+        }
+        if (_counters.size() < _capacity) {
+            _index.emplace(item, _counters.size());
+            _counters.push_back({item, count, 0});
+            return;
+        }
+        size_t min_idx = 0;
+        for (size_t i = 1; i < _counters.size(); i++) {
+            if (_counters[i].count < _counters[min_idx].count) {
+                min_idx = i;
+            }
+        }
+        auto& counter = _counters[min_idx];
+        _index.erase(counter.item);
+        _index.emplace(item, min_idx);
+        counter.item = item;
+        counter.error = counter.count;
+        counter.count += count;
+    }
+
+    // The counter with the largest count, it must not be called on an empty sketch.
+    const Counter& top() const {
+        size_t max_idx = 0;
+        for (size_t i = 1; i < _counters.size(); i++) {
+            if (_counters[i].count > _counters[max_idx].count) {
+                max_idx = i;
+            }
+        }
+        return _counters[max_idx];
+    }
+
+    bool empty() const { return _counters.empty(); }
+
+    uint64_t total() const { return _total; }
+
+private:
+    const size_t _capacity;
+    uint64_t _total = 0;
+    std::vector<Counter> _counters;
+    phmap::flat_hash_map<T, size_t> _index;
+};
+
+} // namespace starrocks
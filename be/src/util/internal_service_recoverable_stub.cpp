@@ -44,8 +44,9 @@ private:
     ::google::protobuf::Closure* _done;
 };
 
-PInternalService_RecoverableStub::PInternalService_RecoverableStub(const butil::EndPoint& endpoint)
-        : _endpoint(endpoint) {}
+PInternalService_RecoverableStub::PInternalService_RecoverableStub(const butil::EndPoint& endpoint,
+                                                                   std::string connection_group)
+        : _endpoint(endpoint), _connection_group_prefix(std::move(connection_group)) {}
 
 PInternalService_RecoverableStub::~PInternalService_RecoverableStub() = default;
 
@@ -58,7 +59,8 @@ Status PInternalService_RecoverableStub::reset_channel(const std::string& protoc
     } else {
         // http does not support these.
         options.connection_type = config::brpc_connection_type;
-        options.connection_group = std::to_string(_connection_group++);
+        options.connection_group = _connection_group_prefix + std::to_string(_connection_group++);
+        options.enable_circuit_breaker = config::brpc_enable_circuit_breaker;
     }
     options.max_retry = 3;
     std::unique_ptr<brpc::Channel> channel(new brpc::Channel());
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 
 #include "common/status.h"
 #include "gen_cpp/internal_service.pb.h"
@@ -26,7 +27,8 @@ namespace starrocks {
 class PInternalService_RecoverableStub : public PInternalService,
                                          public std::enable_shared_from_this<PInternalService_RecoverableStub> {
 public:
-    PInternalService_RecoverableStub(const butil::EndPoint& endpoint);
+    // The channels of the stubs with different |connection_group| to the same endpoint use different connections.
+    explicit PInternalService_RecoverableStub(const butil::EndPoint& endpoint, std::string connection_group = "");
     ~PInternalService_RecoverableStub();
 
     Status reset_channel(const std::string& protocol = "");
@@ -86,6 +88,7 @@ public:
 private:
     std::shared_ptr<starrocks::PInternalService_Stub> _stub;
     const butil::EndPoint _endpoint;
+    const std::string _connection_group_prefix;
     int64_t _connection_group = 0;
     std::mutex _mutex;
     GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(PInternalService_RecoverableStub);
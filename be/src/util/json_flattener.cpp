@@ -22,8 +22,10 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -50,6 +52,7 @@
 #include "types/logical_type.h"
 #include "util/json.h"
 #include "util/json_converter.h"
+#include "util/lru_cache.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -341,7 +344,13 @@ void JsonPathDeriver::derived(const std::vector<const Column*>& json_datas) {
         mark_row += json_datas[k]->size();
     }
 
+    if (_path_stats != nullptr) {
+        _hot_paths = _path_stats->hot_paths();
+    }
     _finalize();
+    if (_path_stats != nullptr) {
+        _path_stats->update(_total_rows, _leaf_stats);
+    }
 }
 
 JsonFlatPath* JsonPathDeriver::_normalize_exists_path(const std::string_view& path, JsonFlatPath* root, uint64_t hits) {
@@ -528,7 +537,17 @@ uint32_t JsonPathDeriver::_dfs_finalize(JsonFlatPath* node, const std::string& a
         // leaf node or all children is remain
         // check sparsity, same key may appear many times in json, so we need avoid duplicate compute hits
         auto desc = _derived_maps[node];
-        if (desc.multi_times <= 0 && desc.hits >= _total_rows * _min_json_sparsity_factory) {
+        double sparsity_factor = _min_json_sparsity_factory;
+        if (_path_stats != nullptr) {
+            auto path = absolute_path.substr(1);
+            if (_hot_paths.count(path) > 0) {
+                sparsity_factor = std::min(sparsity_factor, config::json_flat_hot_path_sparsity_factor);
+            }
+            if (desc.multi_times <= 0) {
+                _leaf_stats.push_back({std::move(path), desc.hits, flat_json::JSON_BITS_TO_LOGICAL_TYPE.at(desc.type)});
+            }
+        }
+        if (desc.multi_times <= 0 && desc.hits >= _total_rows * sparsity_factor) {
             hit_leaf->emplace_back(node, absolute_path);
             node->type = flat_json::JSON_BITS_TO_LOGICAL_TYPE.at(desc.type);
             node->remain = false;
@@ -613,6 +632,82 @@ void JsonPathDeriver::_finalize() {
     }
 }
 
+void JsonPathStats::update(uint64_t num_rows, const std::vector<LeafStat>& leaves) {
+    std::lock_guard l(_mutex);
+    _rows += num_rows;
+    for (const auto& leaf : leaves) {
+        auto& stat = _paths[leaf.path];
+        stat.hits += leaf.hits;
+        if (stat.type == leaf.type) {
+            stat.stable_segments++;
+        } else {
+            stat.type = leaf.type;
+            stat.stable_segments = 1;
+        }
+    }
+    if (_rows > kDecayRows) {
+        _rows /= 2;
+        for (auto iter = _paths.begin(); iter != _paths.end();) {
+            iter->second.hits /= 2;
+            iter = iter->second.hits == 0 ? _paths.erase(iter) : std::next(iter);
+        }
+    }
+    // keep the most frequent paths, the others can't be hot.
+    size_t max_paths = 2 * std::max(config::json_flat_column_max, 1);
+    if (_paths.size() > max_paths) {
+        std::vector<uint64_t> hits;
+        hits.reserve(_paths.size());
+        for (const auto& [path, stat] : _paths) {
+            hits.push_back(stat.hits);
+        }
+        std::nth_element(hits.begin(), hits.begin() + max_paths - 1, hits.end(), std::greater<>());
+        uint64_t min_hits = hits[max_paths - 1];
+        for (auto iter = _paths.begin(); iter != _paths.end();) {
+            iter = iter->second.hits < min_hits ? _paths.erase(iter) : std::next(iter);
+        }
+    }
+}
+
+std::unordered_map<std::string, LogicalType> JsonPathStats::hot_paths() const {
+    std::unordered_map<std::string, LogicalType> hot_paths;
+    std::lock_guard l(_mutex);
+    for (const auto& [path, stat] : _paths) {
+        if (stat.stable_segments >= kMinStableSegments && stat.hits >= _rows * config::json_flat_sparsity_factor) {
+            hot_paths.emplace(path, stat.type);
+        }
+    }
+    return hot_paths;
+}
+
+static void delete_json_path_stats(const CacheKey& key, void* value) {
+    delete static_cast<std::shared_ptr<JsonPathStats>*>(value);
+}
+
+JsonPathStatsManager::JsonPathStatsManager()
+        : _cache(new_lru_cache(std::max<int64_t>(config::json_flat_path_stats_capacity, 1))) {}
+
+JsonPathStatsManager* JsonPathStatsManager::instance() {
+    static JsonPathStatsManager manager;
+    return &manager;
+}
+
+std::shared_ptr<JsonPathStats> JsonPathStatsManager::get_or_create(int64_t tablet_id, int32_t column_unique_id) {
+    char buf[sizeof(tablet_id) + sizeof(column_unique_id)];
+    memcpy(buf, &tablet_id, sizeof(tablet_id));
+    memcpy(buf + sizeof(tablet_id), &column_unique_id, sizeof(column_unique_id));
+    CacheKey key(buf, sizeof(buf));
+
+    std::lock_guard l(_mutex);
+    auto* handle = _cache->lookup(key);
+    if (handle == nullptr) {
+        auto* stats = new std::shared_ptr<JsonPathStats>(std::make_shared<JsonPathStats>());
+        handle = _cache->insert(key, stats, 1, &delete_json_path_stats);
+    }
+    auto stats = *static_cast<std::shared_ptr<JsonPathStats>*>(_cache->value(handle));
+    _cache->release(handle);
+    return stats;
+}
+
 JsonFlattener::JsonFlattener(JsonPathDeriver& deriver) {
     DCHECK(deriver.flat_path_root() != nullptr);
     _dst_paths = deriver.flat_paths();
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -44,6 +45,7 @@ namespace starrocks {
 namespace vpack = arangodb::velocypack;
 class ColumnReader;
 class BloomFilter;
+class Cache;
 
 #ifndef NDEBUG
 template <typename K, typename V>
@@ -101,6 +103,56 @@ public:
     static std::pair<std::string_view, std::string_view> split_path(const std::string_view& path);
 };
 
+// The statistics of the JSON paths of the segments written for a JSON column of a tablet by the loads and the
+// compactions. A path that appears in at least json_flat_sparsity_factor of the recent rows of the tablet, with the
+// same type in the last kMinStableSegments segments, is hot, and is extracted from a new segment once it appears in
+// json_flat_hot_path_sparsity_factor of its rows. So the paths extracted from a small or skewed segment don't only
+// depend on its rows, and the flat schemas of the segments are consistent, the reads and compactions don't extract
+// the hot paths from the remain JSON. The counts are halved once the rows exceed kDecayRows, to follow the changes.
+class JsonPathStats {
+public:
+    static constexpr uint64_t kDecayRows = 1UL << 24;
+    static constexpr uint32_t kMinStableSegments = 2;
+
+    struct LeafStat {
+        std::string path;
+        uint64_t hits;
+        LogicalType type;
+    };
+
+    // Records the leaf paths of a segment of `num_rows` non-null rows.
+    void update(uint64_t num_rows, const std::vector<LeafStat>& leaves);
+
+    std::unordered_map<std::string, LogicalType> hot_paths() const;
+
+private:
+    struct PathStat {
+        uint64_t hits = 0;
+        LogicalType type = LogicalType::TYPE_UNKNOWN;
+        // the number of the last segments of the path with `type`.
+        uint32_t stable_segments = 0;
+    };
+
+    mutable std::mutex _mutex;
+    uint64_t _rows = 0;
+    std::unordered_map<std::string, PathStat> _paths;
+};
+
+// The JsonPathStats of the JSON columns of the tablets, in a LRU cache of config::json_flat_path_stats_capacity
+// columns, they are lost by the restarts and rebuilt by the following loads.
+class JsonPathStatsManager {
+public:
+    static JsonPathStatsManager* instance();
+
+    std::shared_ptr<JsonPathStats> get_or_create(int64_t tablet_id, int32_t column_unique_id);
+
+private:
+    JsonPathStatsManager();
+
+    std::mutex _mutex;
+    std::unique_ptr<Cache> _cache;
+};
+
 // to deriver json flanttern path
 class JsonPathDeriver {
 public:
@@ -118,6 +170,9 @@ public:
 
     void set_generate_filter(bool generate_filter) { _generate_filter = generate_filter; }
 
+    // Extract the hot paths of `path_stats` at a lower sparsity, and record the paths of the derived json into it.
+    void set_path_stats(std::shared_ptr<JsonPathStats> path_stats) { _path_stats = std::move(path_stats); }
+
     std::shared_ptr<BloomFilter>& remain_fitler() { return _remain_filter; }
 
     std::shared_ptr<JsonFlatPath>& flat_path_root() { return _path_root; }
@@ -166,6 +221,10 @@ private:
 
     bool _generate_filter = false;
     std::shared_ptr<BloomFilter> _remain_filter = nullptr;
+
+    std::shared_ptr<JsonPathStats> _path_stats;
+    std::unordered_map<std::string, LogicalType> _hot_paths;
+    std::vector<JsonPathStats::LeafStat> _leaf_stats;
 };
 
 // flattern JsonColumn to flat json A,B,C
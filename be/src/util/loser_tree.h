@@ -0,0 +1,132 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+// The tree of losers of the k-way merge of sorted sources. Each internal node keeps the source that lost the match
+// at the node, and the overall winner is kept aside, so that replacing the head of the winner replays only the
+// matches on the path of the winner to the root: log(k) comparisons, vs about 2 * log(k) of sifting down a binary
+// heap, and no comparison between the two children of a node.
+//
+// The sources are the indexes [0, num_sources). |less(a, b)| compares the current heads of the sources |a| and |b|,
+// and must be a strict total order, e.g. the ties are broken by the indexes, so that the merge is stable. The
+// exhausted sources lose to all the others and are never compared.
+template <typename Less>
+class LoserTree {
+public:
+    static constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+    LoserTree(size_t num_sources, Less less)
+            : _num_sources(num_sources),
+              _less(std::move(less)),
+              _losers(num_sources, kNone),
+              _exhausted(num_sources, 0),
+              _num_active(num_sources) {}
+
+    // Marks |source| exhausted before build().
+    void mark_exhausted(size_t source) {
+        DCHECK(!_exhausted[source]);
+        _exhausted[source] = 1;
+        _num_active--;
+    }
+
+    // Plays all the matches, after the heads of the sources are set.
+    void build() {
+        if (_num_sources == 0) {
+            return;
+        }
+        // The winners of the subtrees, the leaf of the source i is the node i + num_sources.
+        std::vector<size_t> winners(2 * _num_sources);
+        for (size_t i = 0; i < _num_sources; i++) {
+            winners[i + _num_sources] = i;
+        }
+        for (size_t node = _num_sources - 1; node >= 1; node--) {
+            size_t lhs = winners[2 * node];
+            size_t rhs = winners[2 * node + 1];
+            if (_beats(lhs, rhs)) {
+                winners[node] = lhs;
+                _losers[node] = rhs;
+            } else {
+                winners[node] = rhs;
+                _losers[node] = lhs;
+            }
+        }
+        _winner = winners[1];
+    }
+
+    bool empty() const { return _num_active == 0; }
+
+    // The source with the smallest head, undefined if empty().
+    size_t winner() const { return _winner; }
+
+    // The source that would win if the winner were exhausted, or kNone. The heads of the winner not greater than the
+    // head of the runner-up can be output without replay(). It's one of the losers to the winner on its path.
+    size_t runner_up() const {
+        size_t best = kNone;
+        for (size_t node = (_winner + _num_sources) / 2; node >= 1; node /= 2) {
+            size_t source = _losers[node];
+            if (!_exhausted[source] && (best == kNone || _less(source, best))) {
+                best = source;
+            }
+        }
+        return best;
+    }
+
+    // Replays the matches of the winner after its head advanced.
+    void replay() {
+        size_t winner = _winner;
+        for (size_t node = (winner + _num_sources) / 2; node >= 1; node /= 2) {
+            if (_beats(_losers[node], winner)) {
+                std::swap(_losers[node], winner);
+            }
+        }
+        _winner = winner;
+    }
+
+    // Exhausts the winner, the next winner is the runner-up.
+    void pop() {
+        DCHECK(!empty());
+        _exhausted[_winner] = 1;
+        _num_active--;
+        replay();
+    }
+
+private:
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (_exhausted[lhs] || _exhausted[rhs]) {
+            return !_exhausted[lhs];
+        }
+        return _less(lhs, rhs);
+    }
+
+    const size_t _num_sources;
+    Less _less;
+    // The loser of the match at each internal node [1, num_sources).
+    std::vector<size_t> _losers;
+    std::vector<uint8_t> _exhausted;
+    size_t _num_active;
+    size_t _winner = 0;
+};
+
+} // namespace starrocks
@@ -6,6 +6,7 @@
 
 #include <rapidjson/document.h>
 
+#include <boost/algorithm/string/predicate.hpp>
 #include <cstdio>
 #include <cstdlib>
 #include <sstream>
@@ -154,6 +155,8 @@ LRUCache::LRUCache() {
     // Make empty circular linked list
     _lru.next = &_lru;
     _lru.prev = &_lru;
+    _protected_lru.next = &_protected_lru;
+    _protected_lru.prev = &_protected_lru;
 }
 
 LRUCache::~LRUCache() noexcept {
@@ -226,6 +229,12 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
         }
         e->refs++;
         ++_hit_count;
+        if (_policy == CacheEvictionPolicy::SLRU && !e->in_protected) {
+            // hit in probation segment, promote it to protected segment
+            e->in_protected = true;
+            _protected_usage += e->charge;
+            _demote_protected();
+        }
     }
     return reinterpret_cast<Cache::Handle*>(e);
 }
@@ -247,12 +256,13 @@ void LRUCache::release(Cache::Handle* handle) {
                 // take this opportunity and remove the item
                 _table.remove(e->key(), e->hash);
                 e->in_cache = false;
+                _remove_from_segment(e);
                 _unref(e);
                 _usage -= e->charge;
                 last_ref = true;
             } else {
                 // put it to LRU free list
-                _lru_append(&_lru, e);
+                _lru_append_unused(e);
             }
         }
     }
@@ -264,24 +274,26 @@ void LRUCache::release(Cache::Handle* handle) {
 }
 
 void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted) {
-    LRUHandle* cur = &_lru;
-    // 1. evict normal cache entries
-    while (_usage + charge > _capacity && cur->next != &_lru) {
+    // 1. evict normal cache entries, probation segment first
+    _evict_from_list(&_lru, charge, CachePriority::NORMAL, deleted);
+    _evict_from_list(&_protected_lru, charge, CachePriority::NORMAL, deleted);
+    // 2. evict durable cache entries if need
+    _evict_from_list(&_lru, charge, CachePriority::DURABLE, deleted);
+    _evict_from_list(&_protected_lru, charge, CachePriority::DURABLE, deleted);
+}
+
+void LRUCache::_evict_from_list(LRUHandle* list, size_t charge, CachePriority priority,
+                                std::vector<LRUHandle*>* deleted) {
+    LRUHandle* cur = list;
+    while (_usage + charge > _capacity && cur->next != list) {
         LRUHandle* old = cur->next;
-        if (old->priority == CachePriority::DURABLE) {
+        if (old->priority > priority) {
             cur = cur->next;
             continue;
         }
         _evict_one_entry(old);
         deleted->push_back(old);
     }
-    // 2. evict durable cache entries if need
-    while (_usage + charge > _capacity && _lru.next != &_lru) {
-        LRUHandle* old = _lru.next;
-        DCHECK(old->priority == CachePriority::DURABLE);
-        _evict_one_entry(old);
-        deleted->push_back(old);
-    }
 }
 
 void LRUCache::_evict_one_entry(LRUHandle* e) {
@@ -290,10 +302,35 @@ void LRUCache::_evict_one_entry(LRUHandle* e) {
     _lru_remove(e);
     _table.remove(e->key(), e->hash);
     e->in_cache = false;
+    _remove_from_segment(e);
     _unref(e);
     _usage -= e->charge;
 }
 
+void LRUCache::_lru_append_unused(LRUHandle* e) {
+    _lru_append(e->in_protected ? &_protected_lru : &_lru, e);
+}
+
+void LRUCache::_demote_protected() {
+    // protected segment takes at most 80% of the capacity, the rest is left for the new entries.
+    const size_t limit = _capacity / 10 * 8;
+    while (_protected_usage > limit && _protected_lru.next != &_protected_lru) {
+        LRUHandle* old = _protected_lru.next;
+        _lru_remove(old);
+        old->in_protected = false;
+        _protected_usage -= old->charge;
+        // the demoted entry is the newest one of probation segment
+        _lru_append(&_lru, old);
+    }
+}
+
+void LRUCache::_remove_from_segment(LRUHandle* e) {
+    if (e->in_protected) {
+        e->in_protected = false;
+        _protected_usage -= e->charge;
+    }
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 void (*deleter)(const CacheKey& key, void* value), CachePriority priority,
                                 size_t value_size) {
@@ -306,6 +343,7 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->refs = 2; // one for the returned handle, one for LRUCache.
     e->next = e->prev = nullptr;
     e->in_cache = true;
+    e->in_protected = false;
     e->priority = priority;
     e->value_size = value_size;
     memcpy(e->key_data, key.data(), key.size());
@@ -324,6 +362,7 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         _usage += charge;
         if (old != nullptr) {
             old->in_cache = false;
+            _remove_from_segment(old);
             if (_unref(old)) {
                 _usage -= old->charge;
                 // old is on LRU because it's in cache and its reference count
@@ -350,6 +389,7 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
         std::lock_guard l(_mutex);
         e = _table.remove(key, hash);
         if (e != nullptr) {
+            _remove_from_segment(e);
             last_ref = _unref(e);
             if (last_ref) {
                 _usage -= e->charge;
@@ -371,16 +411,19 @@ int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
         std::lock_guard l(_mutex);
-        while (_lru.next != &_lru) {
-            LRUHandle* old = _lru.next;
-            DCHECK(old->in_cache);
-            DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
-            _lru_remove(old);
-            _table.remove(old->key(), old->hash);
-            old->in_cache = false;
-            _unref(old);
-            _usage -= old->charge;
-            last_ref_list.push_back(old);
+        for (LRUHandle* list : {&_lru, &_protected_lru}) {
+            while (list->next != list) {
+                LRUHandle* old = list->next;
+                DCHECK(old->in_cache);
+                DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
+                _lru_remove(old);
+                _table.remove(old->key(), old->hash);
+                old->in_cache = false;
+                _remove_from_segment(old);
+                _unref(old);
+                _usage -= old->charge;
+                last_ref_list.push_back(old);
+            }
         }
     }
     for (auto entry : last_ref_list) {
@@ -397,11 +440,12 @@ uint32_t ShardedLRUCache::_shard(uint32_t hash) {
     return hash >> (32 - kNumShardBits);
 }
 
-ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode)
+ShardedLRUCache::ShardedLRUCache(size_t capacity, ChargeMode charge_mode, CacheEvictionPolicy policy)
         : _last_id(0), _capacity(capacity), _charge_mode(charge_mode) {
     const size_t per_shard = (_capacity + (kNumShards - 1)) / kNumShards;
     for (auto& _shard : _shards) {
         _shard.set_capacity(per_shard);
+        _shard.set_eviction_policy(policy);
     }
 }
 
@@ -531,8 +575,15 @@ void ShardedLRUCache::get_cache_status(rapidjson::Document* document) {
     }
 }
 
-Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode) {
-    return new ShardedLRUCache(capacity, charge_mode);
+CacheEvictionPolicy cache_eviction_policy_from_string(std::string_view name) {
+    if (boost::iequals(name, "slru")) {
+        return CacheEvictionPolicy::SLRU;
+    }
+    return CacheEvictionPolicy::LRU;
+}
+
+Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode, CacheEvictionPolicy policy) {
+    return new ShardedLRUCache(capacity, charge_mode, policy);
 }
 
 } // namespace starrocks
@@ -29,7 +29,20 @@ enum class ChargeMode {
 
 // Create a new cache with a fixed size capacity.  This implementation
 // of Cache uses a least-recently-used eviction policy.
-extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+enum class CacheEvictionPolicy {
+    // least recently used entries are evicted first
+    LRU = 0,
+    // segmented LRU, new entries are in a probation segment and move to a protected segment when they are hit.
+    // The entries in probation segment are evicted first, so that the entries visited only once (e.g. by a large
+    // scan) do not evict the frequently visited ones.
+    SLRU = 1
+};
+
+// Returns LRU for the unknown names. Names are "lru" and "slru", case insensitive.
+CacheEvictionPolicy cache_eviction_policy_from_string(std::string_view name);
+
+extern Cache* new_lru_cache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE,
+                            CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
 
 class CacheKey {
 public:
@@ -209,7 +222,8 @@ typedef struct LRUHandle {
     LRUHandle* prev;
     size_t charge;
     size_t key_length;
-    bool in_cache; // Whether entry is in the cache.
+    bool in_cache;     // Whether entry is in the cache.
+    bool in_protected; // Whether entry is in the protected segment of SLRU.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -273,6 +287,7 @@ public:
 
     // Separate from constructor so caller can easily make an array of LRUCache
     void set_capacity(size_t capacity);
+    void set_eviction_policy(CacheEvictionPolicy policy) { _policy = policy; }
 
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
@@ -293,10 +308,18 @@ private:
     void _lru_append(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
+    void _evict_from_list(LRUHandle* list, size_t charge, CachePriority priority, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
+    // Put an unused entry to the LRU list of its segment.
+    void _lru_append_unused(LRUHandle* e);
+    // Move the oldest entries of protected segment to probation segment until its usage is under the limit.
+    void _demote_protected();
+    // Called when the entry is removed from the table.
+    void _remove_from_segment(LRUHandle* e);
 
     // Initialized before use.
     size_t _capacity{0};
+    CacheEvictionPolicy _policy{CacheEvictionPolicy::LRU};
 
     // _mutex protects the following state.
     mutable std::mutex _mutex;
@@ -305,8 +328,14 @@ private:
     // Dummy head of LRU list.
     // lru.prev is newest entry, lru.next is oldest entry.
     // Entries have refs==1 and in_cache==true.
+    // For SLRU, it's the list of probation segment.
     LRUHandle _lru;
 
+    // Dummy head of LRU list of the protected segment of SLRU, entries have in_protected==true.
+    LRUHandle _protected_lru;
+    // Total charge of in_protected entries, including the ones in use.
+    size_t _protected_usage{0};
+
     HandleTable _table;
 
     uint64_t _lookup_count{0};
@@ -318,7 +347,8 @@ static const int kNumShards = 1 << kNumShardBits;
 
 class ShardedLRUCache : public Cache {
 public:
-    explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE);
+    explicit ShardedLRUCache(size_t capacity, ChargeMode charge_mode = ChargeMode::VALUESIZE,
+                             CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
     ~ShardedLRUCache() override = default;
     Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
                    CachePriority priority = CachePriority::NORMAL, size_t value_size = 0) override;
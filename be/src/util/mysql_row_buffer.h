@@ -42,6 +42,14 @@
 
 namespace starrocks {
 
+// The number of bytes of `length` as a length-encoded integer of the MySQL protocol.
+inline size_t mysql_vlen_size(uint64_t length) {
+    return length < 251ULL ? 1 : (length < 65536ULL ? 3 : (length < 16777216ULL ? 4 : 9));
+}
+
+// Writes `length` as a length-encoded integer of the MySQL protocol, returns the end of it.
+uint8_t* mysql_pack_vlen(uint8_t* packet, uint64_t length);
+
 // Reference:
 //   https://dev.mysql.com/doc/internals/en/com-query-response.html#text-resultset-row
 class MysqlRowBuffer final {
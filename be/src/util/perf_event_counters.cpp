@@ -0,0 +1,102 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_counters.h"
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+static constexpr uint64_t kEventConfigs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                             PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+static int perf_event_open(perf_event_attr* attr, int group_fd) {
+    // Count the calling thread on any cpu.
+    return static_cast<int>(syscall(__NR_perf_event_open, attr, 0, -1, group_fd, 0));
+}
+
+PerfEventCounters::PerfEventCounters() {
+    static_assert(std::size(kEventConfigs) == kNumEvents);
+    for (int i = 0; i < kNumEvents; i++) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = kEventConfigs[i];
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        _fds[i] = perf_event_open(&attr, i == 0 ? -1 : _fds[0]);
+        if (_fds[i] < 0) {
+            static std::atomic<bool> logged = false;
+            if (!logged.exchange(true)) {
+                LOG(WARNING) << "Failed to open the hardware counters by perf_event_open: " << std::strerror(errno);
+            }
+            for (int j = 0; j < i; j++) {
+                close(_fds[j]);
+                _fds[j] = -1;
+            }
+            return;
+        }
+    }
+    _group_fd = _fds[0];
+}
+
+PerfEventCounters::~PerfEventCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+PerfEventCounters* PerfEventCounters::thread_local_instance() {
+    static thread_local PerfEventCounters counters;
+    return &counters;
+}
+
+bool PerfEventCounters::read(PerfEventValues* values) const {
+    if (_group_fd < 0) {
+        return false;
+    }
+    // The layout of PERF_FORMAT_GROUP: nr, time_enabled, time_running, values[nr].
+    uint64_t buf[3 + kNumEvents];
+    if (::read(_group_fd, buf, sizeof(buf)) != sizeof(buf) || buf[0] != kNumEvents) {
+        return false;
+    }
+    uint64_t time_enabled = buf[1];
+    uint64_t time_running = buf[2];
+    auto scale = [&](uint64_t v) -> int64_t {
+        if (time_running == 0 || time_running >= time_enabled) {
+            return static_cast<int64_t>(v);
+        }
+        return static_cast<int64_t>(static_cast<double>(v) * time_enabled / time_running);
+    };
+    values->cycles = scale(buf[3]);
+    values->instructions = scale(buf[4]);
+    values->llc_misses = scale(buf[5]);
+    values->branch_misses = scale(buf[6]);
+    return true;
+}
+
+} // namespace starrocks
@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace starrocks {
+
+// The values of the hardware counters of a thread.
+struct PerfEventValues {
+    int64_t cycles = 0;
+    int64_t instructions = 0;
+    int64_t llc_misses = 0;
+    int64_t branch_misses = 0;
+
+    PerfEventValues& operator+=(const PerfEventValues& other) {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        llc_misses += other.llc_misses;
+        branch_misses += other.branch_misses;
+        return *this;
+    }
+
+    PerfEventValues operator-(const PerfEventValues& other) const {
+        return {cycles - other.cycles, instructions - other.instructions, llc_misses - other.llc_misses,
+                branch_misses - other.branch_misses};
+    }
+};
+
+// The hardware counters of the calling thread, counted by perf_event_open(2) in the user space only. The counters
+// are opened as a group, so that all of them are scheduled onto the PMU together and their values are comparable.
+//
+// The counters are unavailable if the kernel doesn't allow the process to open them, e.g. by
+// kernel.perf_event_paranoid or in a container without CAP_PERFMON, in which case read() always returns false.
+class PerfEventCounters {
+public:
+    PerfEventCounters();
+    ~PerfEventCounters();
+
+    PerfEventCounters(const PerfEventCounters&) = delete;
+    PerfEventCounters& operator=(const PerfEventCounters&) = delete;
+
+    // The counters of the calling thread, opened at the first call in the thread.
+    static PerfEventCounters* thread_local_instance();
+
+    bool available() const { return _group_fd >= 0; }
+
+    // Reads the current values of the counters. The values are scaled by the fraction of the time the group was
+    // scheduled onto the PMU if it was multiplexed with the other events.
+    bool read(PerfEventValues* values) const;
+
+private:
+    static constexpr int kNumEvents = 4;
+
+    int _group_fd = -1;
+    int _fds[kNumEvents] = {-1, -1, -1, -1};
+};
+
+} // namespace starrocks
@@ -53,6 +53,10 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     REGISTER_STARROCKS_METRIC(http_request_send_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_rows);
+    REGISTER_STARROCKS_METRIC(spill_arbiter_requested_queries_total);
+    REGISTER_STARROCKS_METRIC(spill_arbiter_requested_bytes_total);
+    REGISTER_STARROCKS_METRIC(spill_write_bytes_total);
+    REGISTER_STARROCKS_METRIC(spill_read_bytes_total);
 
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_total);
     REGISTER_STARROCKS_METRIC(load_channel_add_chunks_duration_us);
@@ -105,6 +105,12 @@ public:
     METRIC_DEFINE_INT_COUNTER(query_scan_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_COUNTER(query_scan_rows, MetricUnit::ROWS);
     METRIC_DEFINE_INT_GAUGE(pipe_drivers, MetricUnit::NOUNIT);
+    // queries asked to spill by the GlobalSpillArbiter, and their revocable bytes then
+    METRIC_DEFINE_INT_COUNTER(spill_arbiter_requested_queries_total, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_COUNTER(spill_arbiter_requested_bytes_total, MetricUnit::BYTES);
+    // the io bandwidth of the spilled blocks
+    METRIC_DEFINE_INT_COUNTER(spill_write_bytes_total, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(spill_read_bytes_total, MetricUnit::BYTES);
 
     // counters
     METRIC_DEFINE_INT_COUNTER(fragment_requests_total, MetricUnit::REQUESTS);
@@ -346,6 +352,7 @@ public:
     METRICS_DEFINE_THREAD_POOL(segment_replicate);
     METRICS_DEFINE_THREAD_POOL(segment_flush);
     METRICS_DEFINE_THREAD_POOL(update_apply);
+    METRICS_DEFINE_THREAD_POOL(update_apply_segment);
     METRICS_DEFINE_THREAD_POOL(pk_index_compaction);
 
     METRIC_DEFINE_UINT_GAUGE(load_rpc_threadpool_size, MetricUnit::NOUNIT);
@@ -0,0 +1,118 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/block_cache_warmer.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+class BlockCacheWarmerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _old_capacity = config::datacache_warmup_history_capacity;
+        config::datacache_warmup_history_capacity = 100;
+    }
+    void TearDown() override { config::datacache_warmup_history_capacity = _old_capacity; }
+
+    int64_t _old_capacity = 0;
+};
+
+TEST_F(BlockCacheWarmerTest, record_and_top_blocks) {
+    BlockCacheWarmer warmer(nullptr);
+    warmer.record_access("s3://bucket/a.parquet", 1024, 100, {0, 256, 512});
+    warmer.record_access("s3://bucket/a.parquet", 1024, 100, {256, 512});
+    warmer.record_access("s3://bucket/a.parquet", 1024, 100, {512});
+    warmer.record_access("s3://bucket/b.parquet", 256, 0, {0});
+    ASSERT_EQ(4, warmer.history_size());
+
+    auto blocks = warmer.top_blocks(2);
+    ASSERT_EQ(2, blocks.size());
+    EXPECT_EQ("s3://bucket/a.parquet", blocks[0].filename);
+    EXPECT_EQ(512, blocks[0].offset);
+    EXPECT_EQ(3, blocks[0].hits);
+    EXPECT_EQ(256, blocks[1].offset);
+    EXPECT_EQ(2, blocks[1].hits);
+
+    // A new version of the file drops the history of the old one.
+    warmer.record_access("s3://bucket/a.parquet", 1024, 200, {0});
+    ASSERT_EQ(2, warmer.history_size());
+    EXPECT_EQ(2, warmer.top_blocks(10).size());
+
+    config::datacache_warmup_history_capacity = 0;
+    warmer.record_access("s3://bucket/c.parquet", 256, 0, {0});
+    ASSERT_EQ(2, warmer.history_size());
+}
+
+TEST_F(BlockCacheWarmerTest, decay) {
+    config::datacache_warmup_history_capacity = 4;
+    BlockCacheWarmer warmer(nullptr);
+    for (int i = 0; i < 4; i++) {
+        warmer.record_access("hdfs://nn/hot", 4096, 1, {0, 1024});
+    }
+    warmer.record_access("hdfs://nn/cold", 4096, 1, {0, 1024});
+    ASSERT_EQ(4, warmer.history_size());
+
+    // Exceeding the capacity halves all the hits and drops the blocks accessed only once.
+    warmer.record_access("hdfs://nn/cold", 4096, 1, {2048});
+    ASSERT_EQ(2, warmer.history_size());
+    auto blocks = warmer.top_blocks(10);
+    ASSERT_EQ(2, blocks.size());
+    for (const auto& block : blocks) {
+        EXPECT_EQ("hdfs://nn/hot", block.filename);
+        EXPECT_EQ(2, block.hits);
+    }
+}
+
+TEST_F(BlockCacheWarmerTest, save_and_load) {
+    const std::string path = "./block_cache_warmer_history";
+    BlockCacheWarmer warmer(nullptr);
+    warmer.record_access("s3://bucket/dir with space/a.orc", 1024, 100, {0, 256});
+    warmer.record_access("s3://bucket/dir with space/a.orc", 1024, 100, {256});
+    ASSERT_TRUE(warmer.save_history(path).ok());
+
+    BlockCacheWarmer loaded(nullptr);
+    ASSERT_TRUE(loaded.load_history(path).ok());
+    auto blocks = loaded.top_blocks(10);
+    ASSERT_EQ(2, blocks.size());
+    EXPECT_EQ("s3://bucket/dir with space/a.orc", blocks[0].filename);
+    EXPECT_EQ(1024, blocks[0].file_size);
+    EXPECT_EQ(100, blocks[0].modification_time);
+    EXPECT_EQ(256, blocks[0].offset);
+    EXPECT_EQ(2, blocks[0].hits);
+
+    ASSERT_TRUE(loaded.load_history("./not_exist_history").is_not_found());
+
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "bad line\n";
+    }
+    ASSERT_TRUE(loaded.load_history(path).is_corruption());
+    std::filesystem::remove(path);
+}
+
+TEST_F(BlockCacheWarmerTest, progress) {
+    BlockCacheWarmer warmer(nullptr);
+    auto progress = warmer.progress();
+    EXPECT_EQ(BlockCacheWarmer::State::IDLE, progress.state);
+    EXPECT_EQ(0, progress.total_blocks);
+    EXPECT_STREQ("IDLE", BlockCacheWarmer::state_name(progress.state));
+}
+
+} // namespace starrocks
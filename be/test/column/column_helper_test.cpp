@@ -97,4 +97,72 @@ TEST_F(ColumnHelperTest, get_null_column) {
     ASSERT_EQ(null_column->get_name(), "integral-1");
 }
 
+TEST_F(ColumnHelperTest, num_rows_within_capacity_limit) {
+    auto large = LargeBinaryColumn::create();
+    for (int i = 0; i < 5; i++) {
+        large->append("a");
+    }
+    // Only the offsets are checked, fake 2GB long strings without allocating them.
+    auto& offsets = large->get_offset();
+    for (size_t i = 0; i < offsets.size(); i++) {
+        offsets[i] = i * (Column::MAX_CAPACITY_LIMIT / 2);
+    }
+    auto ints = Int32Column::create();
+    ints->append_default(5);
+    Columns columns{ints, NullableColumn::create(large, NullColumn::create(5, 0))};
+
+    ASSERT_EQ(1, ColumnHelper::num_rows_within_capacity_limit(columns, 0, 5));
+    ASSERT_EQ(1, ColumnHelper::num_rows_within_capacity_limit(columns, 3, 2));
+    ASSERT_EQ(0, ColumnHelper::num_rows_within_capacity_limit(columns, 5, 0));
+
+    for (size_t i = 0; i < offsets.size(); i++) {
+        offsets[i] = i * (Column::MAX_CAPACITY_LIMIT / 3);
+    }
+    ASSERT_EQ(2, ColumnHelper::num_rows_within_capacity_limit(columns, 0, 5));
+    ASSERT_EQ(2, ColumnHelper::num_rows_within_capacity_limit(columns, 1, 4));
+
+    ASSERT_EQ(5, ColumnHelper::num_rows_within_capacity_limit({ints}, 0, 5));
+}
+
+TEST_F(ColumnHelperTest, encode_sort_key_prefixes) {
+    // Checks that the rows of smaller prefixes are before the others in the order of the sort.
+    auto check_order = [](const ColumnPtr& column, bool is_asc, bool null_first) {
+        std::vector<uint64_t> prefixes;
+        ASSERT_TRUE(ColumnHelper::encode_sort_key_prefixes(*column, is_asc, null_first, &prefixes));
+        ASSERT_EQ(column->size(), prefixes.size());
+        int null_hint = is_asc == null_first ? -1 : 1;
+        for (size_t i = 0; i < column->size(); i++) {
+            for (size_t j = 0; j < column->size(); j++) {
+                if (prefixes[i] < prefixes[j]) {
+                    int r = column->compare_at(i, j, *column, null_hint);
+                    ASSERT_LT(is_asc ? r : -r, 0) << i << " " << j;
+                }
+            }
+        }
+    };
+
+    ColumnBuilder<TYPE_INT> ints(8);
+    for (int32_t v : {0, -1, 1, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), 7}) {
+        ints.append(v);
+    }
+    ints.append_null();
+    ColumnPtr int_column = ints.build(false);
+
+    ColumnBuilder<TYPE_VARCHAR> strings(8);
+    for (const char* v : {"", "a", "ab", "abcdefgh", "abcdefghi", "abcdefgz", "\xff", "b"}) {
+        strings.append(Slice(v));
+    }
+    strings.append_null();
+    ColumnPtr string_column = strings.build(false);
+
+    for (bool is_asc : {true, false}) {
+        for (bool null_first : {true, false}) {
+            check_order(int_column, is_asc, null_first);
+            check_order(string_column, is_asc, null_first);
+        }
+    }
+    std::vector<uint64_t> prefixes;
+    ASSERT_FALSE(ColumnHelper::encode_sort_key_prefixes(*create_const_column(), true, true, &prefixes));
+}
+
 } // namespace starrocks
@@ -0,0 +1,88 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "column/german_string.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "testutil/parallel_test.h"
+
+namespace starrocks {
+
+static int sign(int v) {
+    return (v > 0) - (v < 0);
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(GermanStringTest, test_compare) {
+    std::vector<std::string> values = {"",
+                                       "a",
+                                       "ab",
+                                       std::string("ab\0", 3),
+                                       "abc",
+                                       "abcd",
+                                       "abcde",
+                                       "abce",
+                                       "abcdefghijkl",
+                                       "abcdefghijklm",
+                                       "abcdefghijkm",
+                                       "abcdefghijklmnopq",
+                                       "abcdefghijklmnopr",
+                                       "b"};
+    for (const auto& l : values) {
+        for (const auto& r : values) {
+            GermanString gl{Slice(l)};
+            GermanString gr{Slice(r)};
+            ASSERT_EQ(l == r, gl == gr) << l << " vs " << r;
+            ASSERT_EQ(sign(Slice(l).compare(Slice(r))), sign(gl.compare(gr))) << l << " vs " << r;
+        }
+        GermanString g{Slice(l)};
+        ASSERT_EQ(l.size() <= GermanString::kInlineSize, g.is_inlined());
+        ASSERT_EQ(l, g.to_slice().to_string());
+    }
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(GermanStringTest, test_convert_binary_column) {
+    auto column = BinaryColumn::create();
+    column->append(Slice("short"));
+    column->append(Slice(""));
+    column->append(Slice("a string longer than twelve bytes"));
+    column->append(Slice("exactly12byt"));
+
+    GermanStrings strings = GermanStrings::from_binary_column(*column);
+    ASSERT_EQ(column->size(), strings.size());
+    // the long strings must not refer to the source column
+    column.reset();
+
+    strings.append(Slice("another string longer than twelve bytes"));
+    ASSERT_EQ(5, strings.size());
+    ASSERT_TRUE(strings[0].is_inlined());
+    ASSERT_FALSE(strings[2].is_inlined());
+    ASSERT_TRUE(strings[3].is_inlined());
+
+    auto dst = BinaryColumn::create();
+    strings.append_to_binary_column(dst.get());
+    ASSERT_EQ(5, dst->size());
+    ASSERT_EQ("short", dst->get_slice(0).to_string());
+    ASSERT_EQ("", dst->get_slice(1).to_string());
+    ASSERT_EQ("a string longer than twelve bytes", dst->get_slice(2).to_string());
+    ASSERT_EQ("exactly12byt", dst->get_slice(3).to_string());
+    ASSERT_EQ("another string longer than twelve bytes", dst->get_slice(4).to_string());
+}
+
+} // namespace starrocks
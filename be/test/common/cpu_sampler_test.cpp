@@ -0,0 +1,80 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/prof/cpu_sampler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "runtime/current_thread.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+static void burn_cpu(std::chrono::milliseconds duration) {
+    auto end = std::chrono::steady_clock::now() + duration;
+    volatile int64_t sum = 0;
+    while (std::chrono::steady_clock::now() < end) {
+        for (int i = 0; i < 10000; i++) {
+            sum = sum + i;
+        }
+    }
+}
+
+TEST(CpuSamplerTest, test_samples_tagged_by_query) {
+    auto& sampler = CpuSampler::getInstance();
+    ASSERT_ERROR(sampler.set_frequency(-1));
+    ASSERT_OK(sampler.set_frequency(100));
+    DeferOp defer([&]() { ASSERT_OK(sampler.set_frequency(0)); });
+
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(2);
+    TUniqueId fragment_instance_id;
+    fragment_instance_id.__set_hi(1);
+    fragment_instance_id.__set_lo(3);
+    {
+        SCOPED_SET_TRACE_INFO(1, query_id, fragment_instance_id);
+        SCOPED_SET_WORKGROUP_ID(7);
+        burn_cpu(std::chrono::milliseconds(1000));
+    }
+
+    CpuSampler::Filter filter;
+    filter.query_id = UniqueId(query_id);
+    auto folded = sampler.dump_folded(filter);
+    ASSERT_FALSE(folded.empty());
+    ASSERT_TRUE(folded.starts_with("workgroup=7;query=" + print_id(query_id) +
+                                   ";fragment=" + print_id(fragment_instance_id) + ";"));
+
+    filter.workgroup_id = 8;
+    ASSERT_TRUE(sampler.dump_folded(filter).empty());
+
+    // Paused sampler doesn't record new samples.
+    sampler.pause();
+    TUniqueId other_query_id;
+    other_query_id.__set_hi(1);
+    other_query_id.__set_lo(4);
+    {
+        SCOPED_SET_TRACE_INFO(1, other_query_id, fragment_instance_id);
+        burn_cpu(std::chrono::milliseconds(200));
+    }
+    sampler.resume();
+    filter = {};
+    filter.query_id = UniqueId(other_query_id);
+    ASSERT_TRUE(sampler.dump_folded(filter).empty());
+}
+
+} // namespace starrocks
@@ -175,6 +175,50 @@ TEST(HashMapTest, TwoLevelConvert) {
     }
 }
 
+TEST(HashMapTest, NumberKeyTwoLevelConvert) {
+    RuntimeState dummy;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+
+    std::vector<int64_t> sums(1000);
+    AggHashMapVariant map_variant;
+    map_variant.init(&dummy, AggHashMapVariant::Type::phase1_int64, &statis);
+    map_variant.visit([&](auto& hash_map_with_key) {
+        if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type, int64_t>) {
+            for (int64_t i = 0; i < 1000; i++) {
+                hash_map_with_key->hash_map.emplace(i, (AggDataPtr)(&sums[i]));
+            }
+        }
+    });
+    map_variant.convert_to_two_level(&dummy);
+    ASSERT_TRUE(std::holds_alternative<std::unique_ptr<Int64TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>>>(
+            map_variant.hash_map_with_key));
+    ASSERT_EQ(1000, map_variant.size());
+    map_variant.visit([&](auto& hash_map_with_key) {
+        if constexpr (std::is_same_v<typename decltype(hash_map_with_key->hash_map)::key_type, int64_t>) {
+            for (int64_t i = 0; i < 1000; i++) {
+                auto iter = hash_map_with_key->hash_map.find(i);
+                ASSERT_TRUE(iter != hash_map_with_key->hash_map.end());
+                ASSERT_EQ((AggDataPtr)(&sums[i]), iter->second);
+            }
+        }
+    });
+
+    AggHashSetVariant set_variant;
+    set_variant.init(&dummy, AggHashSetVariant::Type::phase2_int32, &statis);
+    set_variant.visit([&](auto& hash_set_with_key) {
+        if constexpr (std::is_same_v<typename decltype(hash_set_with_key->hash_set)::key_type, int32_t>) {
+            for (int32_t i = 0; i < 1000; i++) {
+                hash_set_with_key->hash_set.emplace(i);
+            }
+        }
+    });
+    set_variant.convert_to_two_level(&dummy);
+    ASSERT_TRUE(std::holds_alternative<std::unique_ptr<Int32TwoLevelAggHashSetOfOneNumberKey<PhmapSeed2>>>(
+            set_variant.hash_set_with_key));
+    ASSERT_EQ(1000, set_variant.size());
+}
+
 class AggHashMapKeyNotFoundsTest : public ::testing::Test {
 public:
     template <typename HashMapWithKey>
@@ -326,4 +370,91 @@ TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_FixedSize16Sl
     TestAggHashMapKeyWithIntType<TestAggHashMapKey>(true);
 }
 
+TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_OneShortStringAggHashMap) {
+    using TestAggHashMapKey = OneShortStringAggHashMap<PhmapSeed1>;
+    TestAggHashMapKeyWithStringType<TestAggHashMapKey>(false);
+}
+
+TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_NullOneShortStringAggHashMap) {
+    using TestAggHashMapKey = NullOneShortStringAggHashMap<PhmapSeed2>;
+    TestAggHashMapKeyWithStringType<TestAggHashMapKey>(true);
+}
+
+TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_DenseInt32AggHashMapWithOneNumberKey) {
+    using TestAggHashMapKey = DenseInt32AggHashMapWithOneNumberKey<PhmapSeed1>;
+    TestAggHashMapKeyWithIntType<TestAggHashMapKey>(false);
+}
+
+TEST_F(AggHashMapKeyNotFoundsTest, TestAllocateAndComputeNonFounds_NullDenseInt32AggHashMapWithOneNumberKey) {
+    using TestAggHashMapKey = NullDenseInt32AggHashMapWithOneNumberKey<PhmapSeed2>;
+    TestAggHashMapKeyWithIntType<TestAggHashMapKey>(true);
+}
+
+TEST(HashMapTest, ShortStringKeyConvert) {
+    RuntimeState dummy;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    MemPool pool;
+
+    AggHashSetVariant set_variant;
+    set_variant.init(&dummy, AggHashSetVariant::Type::phase1_null_short_string, &statis);
+
+    auto short_keys = ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), true);
+    for (int i = 0; i < 100; i++) {
+        short_keys->append_datum(Slice(std::to_string(i)));
+    }
+    short_keys->append_nulls(1);
+    Columns key_columns{short_keys};
+    set_variant.try_convert_short_string_keys(&dummy, key_columns, &pool);
+    set_variant.visit([&](auto& hash_set) { hash_set->build_hash_set(short_keys->size(), key_columns, &pool); });
+    ASSERT_TRUE(std::holds_alternative<std::unique_ptr<NullOneShortStringAggHashSet<PhmapSeed1>>>(
+            set_variant.hash_set_with_key));
+    ASSERT_EQ(101, set_variant.size());
+
+    auto long_keys = ColumnHelper::create_column(TypeDescriptor(TYPE_VARCHAR), true);
+    long_keys->append_datum(Slice("0"));
+    long_keys->append_datum(Slice("a string longer than sixteen bytes"));
+    key_columns = {long_keys};
+    set_variant.try_convert_short_string_keys(&dummy, key_columns, &pool);
+    ASSERT_TRUE(std::holds_alternative<std::unique_ptr<NullOneStringAggHashSet<PhmapSeed1>>>(
+            set_variant.hash_set_with_key));
+    ASSERT_EQ(101, set_variant.size());
+    set_variant.visit([&](auto& hash_set) { hash_set->build_hash_set(long_keys->size(), key_columns, &pool); });
+    ASSERT_EQ(102, set_variant.size());
+}
+
+TEST(HashMapTest, DenseKeyConvert) {
+    RuntimeState dummy;
+    RuntimeProfile profile("dummy");
+    AggStatistics statis(&profile);
+    MemPool pool;
+
+    AggHashSetVariant set_variant;
+    set_variant.init(&dummy, AggHashSetVariant::Type::phase1_null_dense_int32, &statis);
+
+    auto dense_keys = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    for (int i = 0; i < 1000; i++) {
+        dense_keys->append_datum(i % 300);
+    }
+    dense_keys->append_nulls(1);
+    Columns key_columns{dense_keys};
+    set_variant.try_convert_dense_keys(&dummy, key_columns);
+    set_variant.visit([&](auto& hash_set) { hash_set->build_hash_set(dense_keys->size(), key_columns, &pool); });
+    ASSERT_TRUE(std::holds_alternative<std::unique_ptr<NullDenseInt32AggHashSetOfOneNumberKey<PhmapSeed1>>>(
+            set_variant.hash_set_with_key));
+    ASSERT_EQ(301, set_variant.size());
+
+    auto sparse_keys = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    sparse_keys->append_datum(0);
+    sparse_keys->append_datum(-1);
+    sparse_keys->append_datum(1 << 20);
+    key_columns = {sparse_keys};
+    set_variant.try_convert_dense_keys(&dummy, key_columns);
+    ASSERT_TRUE(std::holds_alternative<std::unique_ptr<NullInt32AggHashSetOfOneNumberKey<PhmapSeed1>>>(
+            set_variant.hash_set_with_key));
+    ASSERT_EQ(301, set_variant.size());
+    set_variant.visit([&](auto& hash_set) { hash_set->build_hash_set(sparse_keys->size(), key_columns, &pool); });
+    ASSERT_EQ(303, set_variant.size());
+}
+
 } // namespace starrocks
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 
 namespace starrocks {
 class AnalytorTest : public ::testing::Test {
@@ -126,4 +127,46 @@ TEST_F(AnalytorTest, find_partition_end) {
     ASSERT_EQ(analytor3._partition.end, 0);
 }
 
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, sliding_extremum) {
+    // Global positions start from 100, the 5th row is null.
+    std::vector<int32_t> values = {3, 1, 4, 1, 0, 9, 2, 6, 5, 3};
+    auto data = Int32Column::create();
+    auto nulls = NullColumn::create();
+    for (size_t i = 0; i < values.size(); i++) {
+        data->append(values[i]);
+        nulls->append(i == 4);
+    }
+    auto column = NullableColumn::create(std::move(data), std::move(nulls));
+    const int64_t base = 100;
+
+    // ROWS BETWEEN 2 PRECEDING AND CURRENT ROW
+    for (bool is_max : {true, false}) {
+        SlidingExtremum extremum(is_max);
+        extremum.reset(base);
+        for (int64_t row = 0; row < static_cast<int64_t>(values.size()); row++) {
+            int64_t start = std::max<int64_t>(0, row - 2);
+            int64_t expected = -1;
+            for (int64_t i = start; i <= row; i++) {
+                if (i == 4) {
+                    continue;
+                }
+                if (expected < 0 || (is_max ? values[i] > values[expected] : values[i] < values[expected])) {
+                    expected = i;
+                }
+            }
+            int64_t pos = extremum.slide(column.get(), base, base + start, base + row + 1);
+            ASSERT_GE(pos, base);
+            ASSERT_EQ(values[expected], values[pos - base]) << "row " << row << " is_max " << is_max;
+        }
+    }
+
+    // ROWS BETWEEN CURRENT ROW AND CURRENT ROW on the null row
+    SlidingExtremum extremum(true);
+    extremum.reset(base);
+    ASSERT_EQ(base + 3, extremum.slide(column.get(), base, base + 3, base + 4));
+    ASSERT_EQ(-1, extremum.slide(column.get(), base, base + 4, base + 5));
+    ASSERT_EQ(base + 5, extremum.slide(column.get(), base, base + 5, base + 6));
+}
+
 } // namespace starrocks
@@ -27,6 +27,7 @@
 #include "column/datum_tuple.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exec/chunks_sorter_full_sort.h"
 #include "exec/chunks_sorter_topn.h"
@@ -38,6 +39,7 @@
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 #include "util/json.h"
 
 namespace starrocks {
@@ -378,6 +380,32 @@ TEST_F(ChunksSorterTest, full_sort_incremental) {
 //     ASSERT_EQ(total_bytes, output_bytes);
 // }
 
+TEST_F(ChunksSorterTest, use_heap_sorter) {
+    std::vector<ExprContext*> int_exprs{new ExprContext(_expr_cust_key.get())};
+    std::vector<ExprContext*> varchar_exprs{new ExprContext(_expr_cust_key.get()),
+                                            new ExprContext(_expr_region.get())};
+    DeferOp defer([&]() {
+        clear_sort_exprs(int_exprs);
+        clear_sort_exprs(varchar_exprs);
+    });
+    auto old_limit = config::sort_heap_sorter_limit;
+    auto old_fixed_key_limit = config::sort_heap_sorter_fixed_key_limit;
+    DeferOp restore([&]() {
+        config::sort_heap_sorter_limit = old_limit;
+        config::sort_heap_sorter_fixed_key_limit = old_fixed_key_limit;
+    });
+
+    config::sort_heap_sorter_limit = 100;
+    config::sort_heap_sorter_fixed_key_limit = 1000;
+    EXPECT_TRUE(ChunksSorter::use_heap_sorter(int_exprs, 1000));
+    EXPECT_FALSE(ChunksSorter::use_heap_sorter(int_exprs, 1001));
+    EXPECT_TRUE(ChunksSorter::use_heap_sorter(varchar_exprs, 100));
+    EXPECT_FALSE(ChunksSorter::use_heap_sorter(varchar_exprs, 101));
+
+    config::sort_heap_sorter_fixed_key_limit = 0;
+    EXPECT_FALSE(ChunksSorter::use_heap_sorter(int_exprs, 1));
+}
+
 TEST_F(ChunksSorterTest, topn_sort_limit_prune) {
     {
         // notnull
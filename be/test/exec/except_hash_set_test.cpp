@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/except_hash_set.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "column/nullable_column.h"
+#include "runtime/mem_pool.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "testutil/column_test_helper.h"
+
+namespace starrocks {
+
+static std::vector<int32_t> remained_keys(ExceptHashSerializeSet* hash_set, bool nullable) {
+    ExceptHashSerializeSet::KeyVector keys;
+    for (auto iter = hash_set->begin(); iter != hash_set->end(); ++iter) {
+        if (!iter->deleted) {
+            keys.emplace_back(iter->slice);
+        }
+    }
+
+    ColumnPtr column = Int32Column::create();
+    if (nullable) {
+        column = NullableColumn::wrap_if_necessary(column);
+    }
+    hash_set->deserialize_to_columns(keys, {column}, keys.size());
+    std::vector<int32_t> values;
+    for (size_t i = 0; i < column->size(); i++) {
+        values.emplace_back(column->is_null(i) ? -1 : column->get(i).get_int32());
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+// The spilled keys are always nullable, which must be the same keys as the non-nullable ones in the hash set.
+TEST(ExceptHashSetTest, test_key_columns) {
+    RuntimeState state;
+    MemPool pool;
+    ExceptBufferState buffer_state;
+    ASSERT_OK(buffer_state.init(&state));
+
+    ExceptHashSerializeSet hash_set;
+    ASSERT_OK(hash_set.init(&state));
+    Columns build_keys{ColumnTestHelper::build_column<int32_t>({1, 2, 2, 3, 4})};
+    hash_set.build_set(&state, build_keys, 5, &pool, &buffer_state);
+    ASSERT_EQ(4, hash_set.size());
+
+    Columns probe_keys{ColumnTestHelper::build_nullable_column<int32_t>({2, 0, 5}, {0, 1, 0})};
+    ASSERT_OK(hash_set.erase_duplicate_row(&state, probe_keys, 3, &buffer_state));
+    ASSERT_EQ(std::vector<int32_t>({1, 3, 4}), remained_keys(&hash_set, false));
+}
+
+TEST(ExceptHashSetTest, test_nullable_key_columns) {
+    RuntimeState state;
+    MemPool pool;
+    ExceptBufferState buffer_state;
+    ASSERT_OK(buffer_state.init(&state));
+
+    ExceptHashSerializeSet hash_set;
+    ASSERT_OK(hash_set.init(&state));
+    Columns build_keys{ColumnTestHelper::build_nullable_column<int32_t>({1, 0, 3, 0}, {0, 1, 0, 1})};
+    hash_set.build_set(&state, build_keys, 4, &pool, &buffer_state);
+    ASSERT_EQ(3, hash_set.size());
+    ASSERT_EQ(std::vector<int32_t>({-1, 1, 3}), remained_keys(&hash_set, true));
+
+    Columns probe_keys{ColumnTestHelper::build_nullable_column<int32_t>({3, 0}, {0, 1})};
+    ASSERT_OK(hash_set.erase_duplicate_row(&state, probe_keys, 2, &buffer_state));
+    ASSERT_EQ(std::vector<int32_t>({1}), remained_keys(&hash_set, true));
+}
+
+} // namespace starrocks
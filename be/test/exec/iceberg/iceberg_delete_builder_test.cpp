@@ -42,4 +42,36 @@ TEST_F(IcebergDeleteBuilderTest, TestParquetBuilder) {
     ASSERT_EQ(1, _need_skip_rowids.size());
 }
 
+TEST_F(IcebergDeleteBuilderTest, TestParquetBuilderWithCache) {
+    TIcebergDeleteFile delete_file;
+    delete_file.__set_full_path(_parquet_delete_path);
+    delete_file.__set_length(845);
+    delete_file.__set_file_content(TIcebergFileContent::POSITION_DELETES);
+
+    IcebergDeleteFileCache cache(1024 * 1024);
+    for (int i = 0; i < 2; i++) {
+        std::set<int64_t> need_skip_rowids;
+        IcebergDeleteBuilder builder(FileSystem::Default(), _parquet_data_path, &need_skip_rowids, DataCacheOptions(),
+                                     &cache);
+        ASSERT_OK(builder.build_parquet(TQueryGlobals().time_zone, delete_file, {}, nullptr, nullptr, nullptr,
+                                        nullptr));
+        ASSERT_EQ(1, need_skip_rowids.size());
+    }
+    ASSERT_EQ(1, cache.num_hits());
+    ASSERT_GT(cache.memory_usage(), 0);
+
+    // The deletes are not cached beyond the capacity, but still applied.
+    IcebergDeleteFileCache small_cache(1);
+    for (int i = 0; i < 2; i++) {
+        std::set<int64_t> need_skip_rowids;
+        IcebergDeleteBuilder builder(FileSystem::Default(), _parquet_data_path, &need_skip_rowids, DataCacheOptions(),
+                                     &small_cache);
+        ASSERT_OK(builder.build_parquet(TQueryGlobals().time_zone, delete_file, {}, nullptr, nullptr, nullptr,
+                                        nullptr));
+        ASSERT_EQ(1, need_skip_rowids.size());
+    }
+    ASSERT_EQ(0, small_cache.num_hits());
+    ASSERT_EQ(0, small_cache.memory_usage());
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -966,13 +966,44 @@ TEST_F(JoinHashMapTest, CompileFixedSizeKeyColumn) {
     auto c2 = JoinHashMapTest::create_int32_column(2, 2);
     Columns columns{c1, c2};
 
-    JoinHashMapHelper::serialize_fixed_size_key_column<LogicalType::TYPE_BIGINT>(columns, data_column.get(), 0, 2);
+    JoinHashMapHelper::serialize_fixed_size_key_column<LogicalType::TYPE_BIGINT>(columns, data_column.get(), 0, 2,
+                                                                                 {});
 
     auto* c3 = ColumnHelper::as_raw_column<Int64Column>(data_column);
     ASSERT_EQ(c3->get_data()[0], 8589934592l);
     ASSERT_EQ(c3->get_data()[1], 12884901889l);
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, CompileFixedSizeKeyColumnWithShortString) {
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_LARGEINT);
+    auto data_column = ColumnHelper::create_column(type, false);
+    data_column->resize(3);
+
+    auto c1 = JoinHashMapTest::create_int32_column(3, 0);
+    auto c2 = BinaryColumn::create();
+    c2->append("ab");
+    c2->append("");
+    c2->append("abcdefghijk");
+    Columns columns{c1, c2};
+
+    // The string key takes 1 + 3 bytes after the int32 key.
+    JoinHashMapHelper::serialize_fixed_size_key_column<LogicalType::TYPE_LARGEINT>(columns, data_column.get(), 0, 3,
+                                                                                   {0, 3});
+
+    const auto& data = ColumnHelper::as_raw_column<Int128Column>(data_column)->get_data();
+    const auto* row0 = reinterpret_cast<const uint8_t*>(&data[0]);
+    const uint8_t expected[] = {2, 'a', 'b', 0};
+    ASSERT_EQ(0, memcmp(row0 + 4, expected, 4));
+    const auto* row1 = reinterpret_cast<const uint8_t*>(&data[1]);
+    ASSERT_EQ(1, *reinterpret_cast<const int32_t*>(row1));
+    ASSERT_EQ(0, row1[4]);
+    // Longer than the max size, never matches any packed key.
+    const auto* row2 = reinterpret_cast<const uint8_t*>(&data[2]);
+    ASSERT_EQ(JoinHashMapHelper::OVERFLOW_SHORT_STRING_SIZE, row2[4]);
+    ASSERT_NE(data[0], data[2]);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, ProbeNullOutput) {
     JoinHashTableItems table_items;
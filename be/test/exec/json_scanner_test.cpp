@@ -16,6 +16,9 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <set>
 #include <utility>
 
 #include "column/chunk.h"
@@ -1489,4 +1492,55 @@ TEST_F(JsonScannerTest, test_duplicate_key) {
     EXPECT_EQ("[2, 2]", chunk->debug_row(1));
 }
 
+TEST_F(JsonScannerTest, test_ndjson_split) {
+    std::string path = std::filesystem::temp_directory_path() / "json_scanner_test_ndjson_split.json";
+    DeferOp remove_file([&]() { std::filesystem::remove(path); });
+    {
+        std::ofstream out(path);
+        for (int i = 0; i < 1000; i++) {
+            out << "{\"k1\": " << i << ", \"k2\": \"" << std::string(i % 17, 'x') << "\"}\n";
+        }
+    }
+    int64_t file_size = std::filesystem::file_size(path);
+
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+
+    // Each record is read by exactly one of the splits, whatever the split size is.
+    for (int64_t split_size : {1, 37, 1000, 4096}) {
+        std::set<int32_t> values;
+        for (int64_t offset = 0; offset < file_size; offset += split_size) {
+            std::vector<TBrokerRangeDesc> ranges;
+            TBrokerRangeDesc range;
+            range.format_type = TFileFormatType::FORMAT_JSON;
+            range.file_type = TFileType::FILE_LOCAL;
+            range.strip_outer_array = false;
+            range.__isset.strip_outer_array = true;
+            range.__isset.jsonpaths = false;
+            range.__isset.json_root = false;
+            range.__set_path(path);
+            range.__set_start_offset(offset);
+            range.__set_size(std::min(split_size, file_size - offset));
+            range.__set_file_size(file_size);
+            ranges.emplace_back(range);
+
+            auto scanner = create_json_scanner(types, ranges, {"k1", "k2"});
+            ASSERT_OK(scanner->open());
+            while (true) {
+                auto res = scanner->get_next();
+                if (res.status().is_end_of_file()) {
+                    break;
+                }
+                ASSERT_OK(res.status());
+                ColumnPtr column = res.value()->get_column_by_index(0);
+                for (size_t i = 0; i < column->size(); i++) {
+                    ASSERT_TRUE(values.insert(column->get(i).get_int32()).second);
+                }
+            }
+        }
+        ASSERT_EQ(1000, values.size()) << "split size: " << split_size;
+    }
+}
+
 } // namespace starrocks
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include "formats/deletion_vector.h"
 #include "fs/fs.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "testutil/assert.h"
@@ -32,12 +33,12 @@ protected:
     int64_t _offset = 1;
     int64_t _length = 22;
 
-    std::set<int64_t> _need_skip_rowids;
+    roaring::Roaring _deletion_vector;
 };
 
 TEST_F(PaimonDeleteFileBuilderTest, TestParquetBuilder) {
     std::unique_ptr<PaimonDeleteFileBuilder> builder(
-            new PaimonDeleteFileBuilder(FileSystem::Default(), &_need_skip_rowids));
+            new PaimonDeleteFileBuilder(FileSystem::Default(), &_deletion_vector));
     TPaimonDeletionFile paimonDeletionFile;
     paimonDeletionFile.__set_path(_path);
     paimonDeletionFile.__set_offset(_offset);
@@ -45,7 +46,31 @@ TEST_F(PaimonDeleteFileBuilderTest, TestParquetBuilder) {
     std::shared_ptr<TPaimonDeletionFile> paimon_deletion_file =
             std::make_shared<TPaimonDeletionFile>(paimonDeletionFile);
     ASSERT_OK(builder->build(paimon_deletion_file.get()));
-    ASSERT_EQ(1, _need_skip_rowids.size());
+    ASSERT_EQ(1, _deletion_vector.cardinality());
+}
+
+TEST_F(PaimonDeleteFileBuilderTest, TestInvalidLength) {
+    PaimonDeleteFileBuilder builder(FileSystem::Default(), &_deletion_vector);
+    TPaimonDeletionFile paimon_deletion_file;
+    paimon_deletion_file.__set_path(_path);
+    paimon_deletion_file.__set_offset(_offset);
+    paimon_deletion_file.__set_length(_length - 1);
+    ASSERT_TRUE(builder.build(&paimon_deletion_file).is_corruption());
+}
+
+TEST(DeletionVectorTest, TestApply) {
+    roaring::Roaring deletion_vector;
+    deletion_vector.addMany(4, std::vector<uint32_t>{1, 5, 6, 20}.data());
+
+    ASSERT_EQ(4, count_deleted_rows(deletion_vector, 0, 100));
+    ASSERT_EQ(2, count_deleted_rows(deletion_vector, 5, 20));
+    ASSERT_EQ(1, count_deleted_rows(deletion_vector, 20, 21));
+    ASSERT_EQ(0, count_deleted_rows(deletion_vector, 7, 20));
+
+    std::vector<uint8_t> filter(10, 1);
+    ASSERT_TRUE(apply_deletion_vector(deletion_vector, 2, 12, filter.data()));
+    ASSERT_EQ((std::vector<uint8_t>{1, 1, 1, 0, 0, 1, 1, 1, 1, 1}), filter);
+    ASSERT_FALSE(apply_deletion_vector(deletion_vector, 7, 17, filter.data()));
 }
 
 } // namespace starrocks
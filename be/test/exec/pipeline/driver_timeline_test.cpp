@@ -0,0 +1,88 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/driver_timeline.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include <thread>
+
+#include "exec/pipeline/pipeline_driver.h"
+
+namespace starrocks::pipeline {
+
+static TUniqueId make_id(int64_t hi, int64_t lo) {
+    TUniqueId id;
+    id.hi = hi;
+    id.lo = lo;
+    return id;
+}
+
+TEST(DriverTimelineTest, test_chrome_trace) {
+    auto* timeline = DriverTimeline::instance();
+    TUniqueId query_id = make_id(1001, 1);
+    TUniqueId other_query_id = make_id(1001, 2);
+    TUniqueId fragment_id = make_id(1001, 3);
+
+    timeline->record(query_id, fragment_id, 0, DriverState::READY);
+    timeline->record(other_query_id, fragment_id, 0, DriverState::READY);
+    std::thread([&] {
+        timeline->record(query_id, fragment_id, 0, DriverState::RUNNING);
+        timeline->record(query_id, fragment_id, 0, DriverTimeline::kPreempted);
+        timeline->record(query_id, fragment_id, 0, DriverState::READY);
+    }).join();
+    timeline->record(query_id, fragment_id, 0, DriverState::RUNNING);
+    timeline->record(query_id, fragment_id, 0, DriverState::FINISH);
+
+    rapidjson::Document doc;
+    doc.Parse(timeline->to_chrome_trace(query_id).c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    const auto& events = doc["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+
+    std::vector<std::string> driver_spans;
+    int num_thread_spans = 0;
+    int num_preempted = 0;
+    std::string last_state;
+    for (const auto& event : events.GetArray()) {
+        std::string phase = event["ph"].GetString();
+        std::string name = event["name"].GetString();
+        if (phase == "X" && event["pid"].GetInt64() == 1) {
+            ASSERT_GE(event["dur"].GetDouble(), 0);
+            driver_spans.push_back(name);
+        } else if (phase == "X" && event["pid"].GetInt64() == 0) {
+            num_thread_spans++;
+        } else if (phase == "i" && name == "PREEMPTED") {
+            num_preempted++;
+        } else if (phase == "i") {
+            last_state = name;
+        }
+    }
+    std::vector<std::string> expected_spans{"READY", "RUNNING", "READY", "RUNNING"};
+    ASSERT_EQ(expected_spans, driver_spans);
+    ASSERT_EQ(2, num_thread_spans);
+    ASSERT_EQ(1, num_preempted);
+    ASSERT_EQ("FINISH", last_state);
+}
+
+TEST(DriverTimelineTest, test_empty) {
+    rapidjson::Document doc;
+    doc.Parse(DriverTimeline::instance()->to_chrome_trace(make_id(1002, 1)).c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    // Only the name of the process of the threads.
+    ASSERT_EQ(1, doc["traceEvents"].Size());
+}
+
+} // namespace starrocks::pipeline
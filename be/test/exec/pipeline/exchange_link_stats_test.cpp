@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exchange/exchange_link_stats.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::pipeline {
+
+TEST(ExchangeLinkStatsTest, rtt_bucket) {
+    EXPECT_EQ(0, ExchangeLinkStats::rtt_bucket(0));
+    EXPECT_EQ(0, ExchangeLinkStats::rtt_bucket(999999));
+    EXPECT_EQ(1, ExchangeLinkStats::rtt_bucket(1000000));
+    EXPECT_EQ(2, ExchangeLinkStats::rtt_bucket(2000000));
+    EXPECT_EQ(2, ExchangeLinkStats::rtt_bucket(3999999));
+    EXPECT_EQ(3, ExchangeLinkStats::rtt_bucket(4000000));
+    EXPECT_EQ(ExchangeLinkStats::kNumRttBuckets - 1, ExchangeLinkStats::rtt_bucket(int64_t(1) << 62));
+}
+
+TEST(ExchangeLinkStatsTest, record_and_reset) {
+    ExchangeLinkStats stats;
+    auto* link = stats.get_or_create_link("host2", 8060);
+    ASSERT_EQ(link, stats.get_or_create_link("host2", 8060));
+    auto* other = stats.get_or_create_link("host1", 8060);
+    ASSERT_NE(link, other);
+
+    ExchangeLinkStats::record_rpc(link, 500000, 100, 300);
+    ExchangeLinkStats::record_rpc(link, 5000000, 200, 400);
+    ExchangeLinkStats::record_queue_wait(link, 1000);
+    ExchangeLinkStats::record_failure(other);
+
+    auto snapshots = stats.snapshot();
+    ASSERT_EQ(2, snapshots.size());
+    EXPECT_EQ("host1:8060", snapshots[0].address);
+    EXPECT_EQ(1, snapshots[0].failed_rpc_count);
+    EXPECT_EQ(0, snapshots[0].rpc_count);
+
+    const auto& snapshot = snapshots[1];
+    EXPECT_EQ("host2:8060", snapshot.address);
+    EXPECT_EQ(2, snapshot.rpc_count);
+    EXPECT_EQ(300, snapshot.bytes_sent);
+    EXPECT_EQ(700, snapshot.raw_bytes_sent);
+    EXPECT_EQ(5500000, snapshot.rtt_ns);
+    EXPECT_EQ(5000000, snapshot.max_rtt_ns);
+    EXPECT_EQ(1000, snapshot.queue_wait_ns);
+    EXPECT_EQ(1, snapshot.rtt_histogram[0]);
+    EXPECT_EQ(1, snapshot.rtt_histogram[3]);
+
+    stats.reset();
+    snapshots = stats.snapshot();
+    ASSERT_EQ(2, snapshots.size());
+    EXPECT_EQ(0, snapshots[1].rpc_count);
+    EXPECT_EQ(0, snapshots[1].max_rtt_ns);
+    EXPECT_EQ(0, snapshots[1].rtt_histogram[3]);
+}
+
+} // namespace starrocks::pipeline
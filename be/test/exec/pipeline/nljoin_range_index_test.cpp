@@ -0,0 +1,132 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/nljoin/nljoin_range_index.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "column/chunk.h"
+#include "testutil/assert.h"
+#include "testutil/column_test_helper.h"
+
+namespace starrocks::pipeline {
+
+static constexpr SlotId kLowerSlot = 1;
+static constexpr SlotId kUpperSlot = 2;
+static constexpr SlotId kPayloadSlot = 3;
+
+struct BuildRow {
+    int32_t lower;
+    int32_t upper;
+    bool upper_is_null;
+};
+
+static std::vector<ChunkPtr> make_build_chunks(const std::vector<BuildRow>& rows, size_t rows_per_chunk) {
+    std::vector<ChunkPtr> chunks;
+    for (size_t begin = 0; begin < rows.size(); begin += rows_per_chunk) {
+        std::vector<int32_t> lowers, uppers, payloads;
+        std::vector<uint8_t> upper_nulls;
+        for (size_t i = begin; i < std::min(rows.size(), begin + rows_per_chunk); i++) {
+            lowers.push_back(rows[i].lower);
+            uppers.push_back(rows[i].upper);
+            upper_nulls.push_back(rows[i].upper_is_null);
+            payloads.push_back(static_cast<int32_t>(i));
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(ColumnTestHelper::build_column<int32_t>(lowers), kLowerSlot);
+        chunk->append_column(ColumnTestHelper::build_nullable_column<int32_t>(uppers, upper_nulls), kUpperSlot);
+        chunk->append_column(ColumnTestHelper::build_column<int32_t>(payloads), kPayloadSlot);
+        chunks.emplace_back(std::move(chunk));
+    }
+    return chunks;
+}
+
+// The payloads of the sorted build rows [begin, end).
+static std::vector<int32_t> payloads_of(const std::vector<ChunkPtr>& chunks, size_t chunk_size, size_t begin,
+                                        size_t end) {
+    std::vector<int32_t> payloads;
+    for (size_t pos = begin; pos < end; pos++) {
+        const auto& chunk = chunks[pos / chunk_size];
+        payloads.push_back(chunk->get_column_by_slot_id(kPayloadSlot)->get(pos % chunk_size).get_int32());
+    }
+    return payloads;
+}
+
+static void check_candidates(const NLJoinRangeKey& key, const std::vector<BuildRow>& rows, bool disjoint) {
+    const size_t chunk_size = 4;
+    auto chunks = make_build_chunks(rows, 3);
+    ASSIGN_OR_ABORT(auto index, NLJoinRangeIndex::build(key, &chunks, chunk_size));
+    for (size_t i = 0; i < chunks.size(); i++) {
+        ASSERT_EQ(i + 1 < chunks.size() ? chunk_size : (rows.size() - 1) % chunk_size + 1, chunks[i]->num_rows());
+    }
+
+    std::vector<int32_t> probes;
+    for (int32_t v = -5; v <= 105; v++) {
+        probes.push_back(v);
+    }
+    std::vector<uint8_t> probe_nulls(probes.size(), 0);
+    probe_nulls[10] = 1;
+    auto probe_key = ColumnTestHelper::build_nullable_column<int32_t>(probes, probe_nulls);
+
+    for (size_t row = 0; row < probes.size(); row++) {
+        size_t begin, end;
+        index->candidates(*probe_key, row, &begin, &end);
+        std::vector<int32_t> candidates = payloads_of(chunks, chunk_size, begin, end);
+        std::sort(candidates.begin(), candidates.end());
+
+        std::vector<int32_t> matched;
+        for (size_t i = 0; i < rows.size() && !probe_nulls[row]; i++) {
+            bool lower_matched = key.build_lower_slot < 0 || rows[i].lower <= probes[row];
+            bool upper_matched = key.build_upper_slot < 0 || (!rows[i].upper_is_null && probes[row] <= rows[i].upper);
+            if (lower_matched && upper_matched) {
+                matched.push_back(static_cast<int32_t>(i));
+            }
+        }
+        if (disjoint) {
+            ASSERT_EQ(matched, candidates) << "probe " << probes[row];
+        } else {
+            ASSERT_TRUE(std::includes(candidates.begin(), candidates.end(), matched.begin(), matched.end()))
+                    << "probe " << probes[row];
+        }
+    }
+}
+
+TEST(NLJoinRangeIndexTest, test_disjoint_ranges) {
+    // [0, 9], [10, 19], ..., [90, 99] in a shuffled order.
+    std::vector<BuildRow> rows;
+    for (int32_t i = 0; i < 10; i++) {
+        int32_t lower = (i * 7 % 10) * 10;
+        rows.push_back({lower, lower + 9, false});
+    }
+    check_candidates(NLJoinRangeKey{0, kLowerSlot, kUpperSlot}, rows, true);
+}
+
+TEST(NLJoinRangeIndexTest, test_overlapping_ranges) {
+    std::mt19937 rng(0);
+    std::vector<BuildRow> rows;
+    for (int32_t i = 0; i < 50; i++) {
+        int32_t lower = static_cast<int32_t>(rng() % 100);
+        rows.push_back({lower, lower + static_cast<int32_t>(rng() % 20), rng() % 5 == 0});
+    }
+    check_candidates(NLJoinRangeKey{0, kLowerSlot, kUpperSlot}, rows, false);
+    // A single bound selects exactly the matched rows.
+    check_candidates(NLJoinRangeKey{0, kLowerSlot, -1}, rows, true);
+    check_candidates(NLJoinRangeKey{0, -1, kUpperSlot}, rows, true);
+}
+
+} // namespace starrocks::pipeline
@@ -18,9 +18,11 @@
 
 #include <thread>
 
+#include "common/config.h"
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/work_group.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -165,6 +167,46 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(QuerySharedDriverQueueTest, test_latency_target) {
+    QuerySharedDriverQueue queue;
+
+    QueryContext query_context;
+    auto driver = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    _set_driver_level(driver.get(), 7);
+    queue.put_back(driver.get());
+    ASSERT_EQ(7, driver->get_driver_queue_level());
+    ASSERT_TRUE(queue.take(true).ok());
+
+    // A query with plenty of slack and no finished drivers is not boosted.
+    QueryContext relaxed_query_context;
+    relaxed_query_context.init_latency_target(3600'000'000'000L);
+    auto relaxed_driver =
+            std::make_shared<PipelineDriver>(_gen_operators(), &relaxed_query_context, nullptr, nullptr, -1);
+    _set_driver_level(relaxed_driver.get(), 7);
+    queue.put_back(relaxed_driver.get());
+    ASSERT_EQ(7, relaxed_driver->get_driver_queue_level());
+    ASSERT_TRUE(queue.take(true).ok());
+
+    // Half of the drivers are finished.
+    relaxed_query_context.incr_num_drivers();
+    relaxed_query_context.incr_num_drivers();
+    relaxed_query_context.incr_num_finished_drivers();
+    queue.put_back(relaxed_driver.get());
+    ASSERT_EQ(4, relaxed_driver->get_driver_queue_level());
+    ASSERT_TRUE(queue.take(true).ok());
+
+    // The deadline has passed.
+    QueryContext urgent_query_context;
+    urgent_query_context.init_latency_target(1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    auto urgent_driver =
+            std::make_shared<PipelineDriver>(_gen_operators(), &urgent_query_context, nullptr, nullptr, -1);
+    _set_driver_level(urgent_driver.get(), 7);
+    queue.put_back(urgent_driver.get());
+    ASSERT_EQ(0, urgent_driver->get_driver_queue_level());
+    ASSERT_TRUE(queue.take(true).ok());
+}
+
 class WorkGroupDriverQueueTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -269,6 +311,27 @@ TEST_F(WorkGroupDriverQueueTest, test_basic) {
     }
 }
 
+TEST_F(WorkGroupDriverQueueTest, test_burst_credit) {
+    auto* wg_entity = _wg1->driver_sched_entity();
+    const int64_t ideal_runtime_ns = 100'000'000L;
+    const int64_t max_burst_credit_ms = config::workgroup_max_burst_credit_ms;
+    DeferOp defer([max_burst_credit_ms] { config::workgroup_max_burst_credit_ms = max_burst_credit_ms; });
+    config::workgroup_max_burst_credit_ms = 200;
+
+    // Never idle.
+    ASSERT_EQ(ideal_runtime_ns / 2, wg_entity->burst_credit_ns(ideal_runtime_ns, 1'000'000'000L));
+
+    // The credit grows with the idle time, and is bounded by half of the ideal runtime and the max burst credit.
+    wg_entity->mark_idle(1'000'000'000L);
+    ASSERT_EQ(ideal_runtime_ns / 2, wg_entity->burst_credit_ns(ideal_runtime_ns, 1'010'000'000L));
+    ASSERT_EQ(150'000'000L, wg_entity->burst_credit_ns(ideal_runtime_ns, 1'300'000'000L));
+    ASSERT_EQ(200'000'000L, wg_entity->burst_credit_ns(ideal_runtime_ns, 11'000'000'000L));
+
+    // Disabled.
+    config::workgroup_max_burst_credit_ms = 0;
+    ASSERT_EQ(ideal_runtime_ns / 2, wg_entity->burst_credit_ns(ideal_runtime_ns, 11'000'000'000L));
+}
+
 TEST_F(WorkGroupDriverQueueTest, test_take_block) {
     QueryContext query_ctx;
     WorkGroupDriverQueue queue;
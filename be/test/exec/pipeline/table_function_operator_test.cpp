@@ -1,7 +1,11 @@
 #include "exec/pipeline/table_function_operator.h"
 
+#include "column/array_column.h"
+#include "column/nullable_column.h"
 #include "exec/pipeline/query_context.h"
 #include "gtest/gtest.h"
+#include "testutil/assert.h"
+#include "testutil/column_test_helper.h"
 
 namespace starrocks::pipeline {
 class TableFunctionOperatorTest : public testing::Test {
@@ -164,4 +168,61 @@ TEST_F(TableFunctionOperatorTest, check_mem_leak) {
     op.close(&_runtime_state);
 }
 
+static ColumnPtr build_arrays(const std::vector<uint32_t>& offsets, const std::vector<int32_t>& elements,
+                              const std::vector<uint8_t>& nulls) {
+    auto offsets_column = UInt32Column::create();
+    offsets_column->get_data().assign(offsets.begin(), offsets.end());
+    auto elements_column =
+            ColumnTestHelper::build_nullable_column<int32_t>(elements, std::vector<uint8_t>(elements.size(), 0));
+    ColumnPtr arrays = ArrayColumn::create(elements_column, offsets_column);
+    if (nulls.empty()) {
+        return arrays;
+    }
+    auto null_column = NullColumn::create();
+    null_column->get_data().assign(nulls.begin(), nulls.end());
+    return NullableColumn::create(arrays, null_column);
+}
+
+// Unnests the arrays of the slot 1 with the outer column of the slot 2, returns the output rows as "outer:element".
+static std::vector<std::string> unnest(TableFunctionOperator* op, RuntimeState* state, const ColumnPtr& arrays,
+                                       const ColumnPtr& outer) {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(arrays, 1);
+    chunk->append_column(outer, 2);
+    EXPECT_OK(op->push_chunk(state, chunk));
+    std::vector<std::string> rows;
+    while (op->has_output()) {
+        auto output = op->pull_chunk(state);
+        EXPECT_OK(output.status());
+        EXPECT_LE((*output)->num_rows(), state->chunk_size());
+        for (size_t i = 0; i < (*output)->num_rows(); i++) {
+            rows.emplace_back((*output)->get_column_by_slot_id(2)->debug_item(i) + ":" +
+                              (*output)->get_column_by_slot_id(3)->debug_item(i));
+        }
+    }
+    return rows;
+}
+
+TEST_F(TableFunctionOperatorTest, test_unnest) {
+    CounterPtr counter_ptr = std::make_shared<Counter>();
+    TestNormalOperatorFactory factory(1, 1, counter_ptr, &_tnode);
+    TableFunctionOperator op(&factory, 1, 1, 0, _tnode);
+    ASSERT_OK(op.prepare(&_runtime_state));
+
+    auto outer = ColumnTestHelper::build_nullable_column<int32_t>({10, 0, 30, 40, 50}, {0, 1, 0, 0, 0});
+    for (int chunk_size : {2, 4096}) {
+        _runtime_state.set_chunk_size(chunk_size);
+        // [[1, 2, 3], [], [4], [5, 6], [7]]
+        auto arrays = build_arrays({0, 3, 3, 4, 6, 7}, {1, 2, 3, 4, 5, 6, 7}, {});
+        ASSERT_EQ(std::vector<std::string>({"10:1", "10:2", "10:3", "30:4", "40:5", "40:6", "50:7"}),
+                  unnest(&op, &_runtime_state, arrays, outer));
+
+        // [[1, 2, 3], NULL, [], [4], [5, 6]]
+        arrays = build_arrays({0, 3, 3, 3, 4, 6}, {1, 2, 3, 4, 5, 6}, {0, 1, 0, 0, 0});
+        ASSERT_EQ(std::vector<std::string>({"10:1", "10:2", "10:3", "40:4", "50:5", "50:6"}),
+                  unnest(&op, &_runtime_state, arrays, outer));
+    }
+    op.close(&_runtime_state);
+}
+
 } // namespace starrocks::pipeline
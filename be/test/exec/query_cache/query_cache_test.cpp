@@ -32,6 +32,7 @@
 #include "exec/query_cache/conjugate_operator.h"
 #include "exec/query_cache/lane_arbiter.h"
 #include "exec/query_cache/multilane_operator.h"
+#include "exec/query_cache/result_cache.h"
 #include "exec/query_cache/ticket_checker.h"
 #include "exec/query_cache/transform_operator.h"
 #include "gutil/strings/substitute.h"
@@ -1214,4 +1215,91 @@ TEST_F(QueryCacheTest, testTicketChecker) {
     test_func2(1L, 100);
 }
 
+TEST_F(QueryCacheTest, testResultCacheKey) {
+    TExecPlanFragmentParams common_request;
+    TExecPlanFragmentParams unique_request;
+    TPlanNode scan_node;
+    scan_node.__set_node_id(0);
+    scan_node.__set_node_type(TPlanNodeType::OLAP_SCAN_NODE);
+    scan_node.__set_num_children(0);
+    TPlanNode agg_node;
+    agg_node.__set_node_id(1);
+    agg_node.__set_node_type(TPlanNodeType::AGGREGATION_NODE);
+    agg_node.__set_num_children(1);
+    common_request.fragment.plan.__set_nodes({agg_node, scan_node});
+    common_request.fragment.__isset.plan = true;
+    TDataSink sink;
+    sink.__set_type(TDataSinkType::RESULT_SINK);
+    sink.__set_result_sink(TResultSink());
+    common_request.fragment.__set_output_sink(sink);
+
+    auto set_version = [&unique_request](const std::string& version) {
+        TScanRangeParams scan_range;
+        scan_range.scan_range.internal_scan_range.__set_tablet_id(10001);
+        scan_range.scan_range.internal_scan_range.__set_version(version);
+        scan_range.scan_range.__isset.internal_scan_range = true;
+        unique_request.params.per_node_scan_ranges[0] = {scan_range};
+    };
+    set_version("2");
+    auto key = query_cache::ResultCache::cache_key(common_request, unique_request);
+    ASSERT_FALSE(key.empty());
+    // The ids of the query and the instance are not a part of the key.
+    unique_request.params.__set_fragment_instance_id(TUniqueId());
+    unique_request.params.fragment_instance_id.__set_lo(100);
+    ASSERT_EQ(key, query_cache::ResultCache::cache_key(common_request, unique_request));
+    // A new version of the tablet.
+    set_version("3");
+    ASSERT_NE(key, query_cache::ResultCache::cache_key(common_request, unique_request));
+
+    // The result depends on the time.
+    TExprNode expr_node;
+    expr_node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+    expr_node.fn.name.__set_function_name("now");
+    expr_node.__isset.fn = true;
+    TExpr expr;
+    expr.__set_nodes({expr_node});
+    common_request.fragment.__set_output_exprs({expr});
+    ASSERT_TRUE(query_cache::ResultCache::cache_key(common_request, unique_request).empty());
+    common_request.fragment.__set_output_exprs({});
+
+    // The input comes from the other fragments.
+    scan_node.__set_node_type(TPlanNodeType::EXCHANGE_NODE);
+    common_request.fragment.plan.__set_nodes({agg_node, scan_node});
+    ASSERT_TRUE(query_cache::ResultCache::cache_key(common_request, unique_request).empty());
+}
+
+TEST_F(QueryCacheTest, testResultCachePopulator) {
+    auto cache_mgr = std::make_shared<query_cache::CacheManager>(1024 * 1024);
+    auto create_chunk = [](size_t num_rows) {
+        auto chunk = std::make_shared<Chunk>();
+        auto col = Int32Column::create();
+        col->resize(num_rows);
+        chunk->append_column(col, 0);
+        return chunk;
+    };
+
+    query_cache::ResultCachePopulator populator("result:1", 64 * 1024);
+    populator.add_chunk(create_chunk(100));
+    populator.add_chunk(create_chunk(200));
+    populator.populate(cache_mgr.get());
+    auto status_or_value = cache_mgr->probe("result:1");
+    ASSERT_TRUE(status_or_value.ok());
+    ASSERT_EQ(2, status_or_value.value().result.size());
+    ASSERT_EQ(200, status_or_value.value().result[1]->num_rows());
+
+    // The result set is too large.
+    query_cache::ResultCachePopulator large_populator("result:2", 64 * 1024);
+    large_populator.add_chunk(create_chunk(100000));
+    ASSERT_TRUE(large_populator.is_abandoned());
+    large_populator.populate(cache_mgr.get());
+    ASSERT_FALSE(cache_mgr->probe("result:2").ok());
+
+    // A result sink is cancelled.
+    query_cache::ResultCachePopulator cancelled_populator("result:3", 64 * 1024);
+    cancelled_populator.add_chunk(create_chunk(100));
+    cancelled_populator.abandon();
+    cancelled_populator.populate(cache_mgr.get());
+    ASSERT_FALSE(cache_mgr->probe("result:3").ok());
+}
+
 } // namespace starrocks
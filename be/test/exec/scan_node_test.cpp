@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/scan_node.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+static TScanRangeParams make_scan_range(int64_t tablet_id, int32_t bucket_sequence, int64_t row_count) {
+    TScanRangeParams scan_range;
+    TInternalScanRange internal_scan_range;
+    internal_scan_range.__set_tablet_id(tablet_id);
+    internal_scan_range.__set_bucket_sequence(bucket_sequence);
+    internal_scan_range.__set_row_count(row_count);
+    scan_range.scan_range.__set_internal_scan_range(internal_scan_range);
+    return scan_range;
+}
+
+static std::map<int32_t, int64_t> rows_per_driver(const std::map<int32_t, std::vector<TScanRangeParams>>& ranges) {
+    std::map<int32_t, int64_t> rows;
+    for (const auto& [driver_seq, scan_ranges] : ranges) {
+        for (const auto& scan_range : scan_ranges) {
+            rows[driver_seq] += scan_range.scan_range.internal_scan_range.row_count;
+        }
+    }
+    return rows;
+}
+
+TEST(ScanNodeTest, balance_colocate_buckets) {
+    // Bucket 0 is as large as the others together, and both partitions of bucket 2 are on driver 0.
+    std::map<int32_t, std::vector<TScanRangeParams>> ranges;
+    ranges[0] = {make_scan_range(1, 0, 600), make_scan_range(3, 2, 100), make_scan_range(13, 2, 100)};
+    ranges[1] = {make_scan_range(2, 1, 200), make_scan_range(4, 3, 200)};
+    ASSERT_TRUE(ScanNode::balance_colocate_buckets(&ranges));
+
+    auto rows = rows_per_driver(ranges);
+    ASSERT_EQ(2, rows.size());
+    EXPECT_EQ(600, rows[0]);
+    EXPECT_EQ(600, rows[1]);
+    // The scan ranges of a bucket stay on the same driver.
+    for (const auto& [_, scan_ranges] : ranges) {
+        size_t num_bucket2 = 0;
+        for (const auto& scan_range : scan_ranges) {
+            num_bucket2 += scan_range.scan_range.internal_scan_range.bucket_sequence == 2;
+        }
+        EXPECT_TRUE(num_bucket2 == 0 || num_bucket2 == 2);
+    }
+
+    // Already balanced.
+    ASSERT_FALSE(ScanNode::balance_colocate_buckets(&ranges));
+}
+
+TEST(ScanNodeTest, balance_colocate_buckets_keep_driver_count) {
+    // Driver 1 has no scan range, the rebalanced map must not use more drivers than the original one.
+    std::map<int32_t, std::vector<TScanRangeParams>> ranges;
+    ranges[0] = {make_scan_range(1, 0, 100), make_scan_range(2, 1, 100)};
+    ranges[2] = {make_scan_range(3, 2, 100)};
+    ASSERT_TRUE(ScanNode::balance_colocate_buckets(&ranges));
+    auto rows = rows_per_driver(ranges);
+    ASSERT_EQ(3, rows.size());
+    for (const auto& [driver_seq, num_rows] : rows) {
+        EXPECT_LT(driver_seq, 3);
+        EXPECT_EQ(100, num_rows);
+    }
+}
+
+TEST(ScanNodeTest, balance_colocate_buckets_without_row_count) {
+    std::map<int32_t, std::vector<TScanRangeParams>> ranges;
+    ranges[0] = {make_scan_range(1, 0, 100), make_scan_range(2, 1, 100)};
+    ranges[1] = {make_scan_range(3, 2, 100)};
+    ranges[1][0].scan_range.internal_scan_range.__isset.row_count = false;
+    ASSERT_FALSE(ScanNode::balance_colocate_buckets(&ranges));
+    ASSERT_EQ(2, ranges[0].size());
+    ASSERT_EQ(1, ranges[1].size());
+
+    std::map<int32_t, std::vector<TScanRangeParams>> empty;
+    ASSERT_FALSE(ScanNode::balance_colocate_buckets(&empty));
+}
+
+} // namespace starrocks
@@ -17,14 +17,18 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <optional>
 #include <random>
 #include <utility>
 
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/sorting/merge.h"
+#include "exec/sorting/merge_join.h"
 #include "exec/sorting/merge_path.h"
+#include "exec/sorting/range_merge.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exprs/column_ref.h"
@@ -32,6 +36,7 @@
 #include "runtime/chunk_cursor.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "simd/simd.h"
 #include "testutil/assert.h"
 #include "util/defer_op.h"
 
@@ -581,4 +586,255 @@ TEST(MergePathTest, test1) {
     }
 }
 
+TEST(SortingTest, sort_by_normalized_keys) {
+    std::mt19937 rng(42);
+    const size_t num_rows = 4096;
+    auto int_column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    auto string_column = ColumnHelper::create_column(TypeDescriptor::create_varchar_type(32), true);
+    auto date_column = ColumnHelper::create_column(TypeDescriptor(TYPE_DATE), false);
+    auto bigint_column = ColumnHelper::create_column(TypeDescriptor(TYPE_BIGINT), false);
+    for (size_t i = 0; i < num_rows; i++) {
+        if (rng() % 10 == 0) {
+            int_column->append_nulls(1);
+            string_column->append_nulls(1);
+        } else {
+            int_column->append_datum(Datum(static_cast<int32_t>(rng() % 16) - 8));
+            // Strings share long prefixes, so the ties of the encoded prefix must be broken by the column sort.
+            std::string str(rng() % 12, 'a');
+            for (auto& c : str) {
+                c += rng() % 2;
+            }
+            string_column->append_datum(Datum(Slice(str)));
+        }
+        date_column->append_datum(Datum(DateValue::create(2000 + rng() % 3, 1, 1 + rng() % 3)));
+        bigint_column->append_datum(Datum(static_cast<int64_t>(rng()) - (int64_t(1) << 31)));
+    }
+
+    const std::vector<Columns> columns_list = {
+            {int_column, date_column, bigint_column},
+            {date_column, int_column, string_column, bigint_column},
+            {string_column, int_column},
+            {int_column, ColumnHelper::create_const_column<TYPE_INT>(1, num_rows), bigint_column, string_column},
+    };
+    const bool old_enable = config::enable_sort_normalized_key;
+    DEFER_OP([&]() { config::enable_sort_normalized_key = old_enable; });
+    for (const auto& columns : columns_list) {
+        for (int order = 0; order < (1 << columns.size()); order++) {
+            std::vector<bool> asc_orders, null_firsts;
+            for (size_t i = 0; i < columns.size(); i++) {
+                asc_orders.push_back(order & (1 << i));
+                null_firsts.push_back(i % 2 == 0);
+            }
+            SortDescs sort_desc(asc_orders, null_firsts);
+
+            config::enable_sort_normalized_key = false;
+            SmallPermutation expected = create_small_permutation(num_rows);
+            ASSERT_OK(stable_sort_and_tie_columns(false, columns, sort_desc, &expected));
+
+            config::enable_sort_normalized_key = true;
+            SmallPermutation actual = create_small_permutation(num_rows);
+            ASSERT_OK(stable_sort_and_tie_columns(false, columns, sort_desc, &actual));
+            for (size_t i = 0; i < num_rows; i++) {
+                ASSERT_EQ(expected[i].index_in_chunk, actual[i].index_in_chunk) << "row " << i;
+            }
+
+            Permutation perm;
+            ASSERT_OK(sort_and_tie_columns(false, columns, sort_desc, &perm));
+            ASSERT_EQ(num_rows, perm.size());
+            for (size_t i = 1; i < num_rows; i++) {
+                ASSERT_LE(compare_chunk_row(sort_desc, columns, columns, perm[i - 1].index_in_chunk,
+                                            perm[i].index_in_chunk),
+                          0);
+            }
+        }
+    }
+}
+
+TEST(SortingTest, sort_by_string_prefix) {
+    std::mt19937 rng(42);
+    const size_t num_rows = 4096;
+    auto url_column = ColumnHelper::create_column(TypeDescriptor::create_varchar_type(64), true);
+    auto short_column = ColumnHelper::create_column(TypeDescriptor::create_varchar_type(8), false);
+    for (size_t i = 0; i < num_rows; i++) {
+        if (rng() % 10 == 0) {
+            url_column->append_nulls(1);
+        } else {
+            // Most of the strings share the first 8 bytes, and some are the prefixes of the others.
+            std::string str = "https://" + std::string(rng() % 4, 'a');
+            str.push_back('a' + rng() % 3);
+            url_column->append_datum(Datum(Slice(str)));
+        }
+        // Zero bytes are ordered before any other bytes, the same as the padding of the prefix.
+        std::string str(rng() % 10, '\0');
+        for (auto& c : str) {
+            c = static_cast<char>(rng() % 3);
+        }
+        short_column->append_datum(Datum(Slice(str)));
+    }
+
+    const std::vector<Columns> columns_list = {{url_column}, {short_column}, {short_column, url_column}};
+    const bool old_normalized_key = config::enable_sort_normalized_key;
+    const bool old_string_prefix = config::enable_sort_string_prefix;
+    DEFER_OP([&]() {
+        config::enable_sort_normalized_key = old_normalized_key;
+        config::enable_sort_string_prefix = old_string_prefix;
+    });
+    config::enable_sort_normalized_key = false;
+    for (const auto& columns : columns_list) {
+        for (bool asc : {true, false}) {
+            SortDescs sort_desc(std::vector<bool>(columns.size(), asc), std::vector<bool>(columns.size(), true));
+
+            config::enable_sort_string_prefix = false;
+            SmallPermutation expected = create_small_permutation(num_rows);
+            ASSERT_OK(stable_sort_and_tie_columns(false, columns, sort_desc, &expected));
+
+            config::enable_sort_string_prefix = true;
+            SmallPermutation actual = create_small_permutation(num_rows);
+            ASSERT_OK(stable_sort_and_tie_columns(false, columns, sort_desc, &actual));
+            for (size_t i = 0; i < num_rows; i++) {
+                ASSERT_EQ(expected[i].index_in_chunk, actual[i].index_in_chunk) << "row " << i;
+            }
+        }
+    }
+}
+
+TEST(RangePartitionedMergerTest, merge) {
+    auto runtime_state = create_runtime_state();
+    TypeDescriptor type_desc(TYPE_INT);
+    auto expr = std::make_unique<ColumnRef>(type_desc, 0);
+    std::vector<ExprContext*> sort_exprs{new ExprContext(expr.get())};
+    ASSERT_OK(Expr::prepare(sort_exprs, runtime_state.get()));
+    ASSERT_OK(Expr::open(sort_exprs, runtime_state.get()));
+    DeferOp defer([&]() { clear_exprs(sort_exprs); });
+    SortDescs sort_descs = SortDescs::asc_null_first(1);
+    Chunk::SlotHashMap map{{0, 0}};
+
+    // The streams are skewed and full of duplicated keys.
+    const int32_t dop = 4;
+    const std::vector<int32_t> num_rows_per_stream = {10000, 100, 0, 3000};
+    const std::vector<int32_t> max_step = {2, 256, 1, 0};
+    std::vector<std::vector<ChunkPtr>> streams(dop);
+    size_t total_rows = 0;
+    for (int32_t s = 0; s < dop; s++) {
+        std::default_random_engine e(s);
+        std::uniform_int_distribution<int32_t> u32(0, max_step[s]);
+        int32_t value = s * 100;
+        for (int32_t row = 0; row < num_rows_per_stream[s]; row += 1000) {
+            ColumnPtr column = ColumnHelper::create_column(type_desc, false);
+            for (int32_t i = row; i < std::min(row + 1000, num_rows_per_stream[s]); i++) {
+                column->append_datum(Datum(value));
+                value += u32(e);
+            }
+            streams[s].push_back(std::make_shared<Chunk>(Columns{column}, map));
+            total_rows += column->size();
+        }
+    }
+
+    std::vector<RangePartitionedMerger::SinkChunkProvider> providers;
+    for (int32_t s = 0; s < dop; s++) {
+        providers.emplace_back([&streams, s, next = size_t(0)](bool only_check_if_has_data, ChunkPtr* chunk,
+                                                               bool* eos) mutable {
+            if (only_check_if_has_data) {
+                return true;
+            }
+            // Return the chunks one by one and eos without chunk at the end, like ChunksSorter::get_next.
+            if (next < streams[s].size()) {
+                *chunk = streams[s][next++];
+            } else {
+                *eos = true;
+            }
+            return true;
+        });
+    }
+    RangePartitionedMerger merger(1024, dop, sort_exprs, sort_descs, std::move(providers));
+
+    Columns outputs;
+    for (size_t round = 0; !merger.is_finished(0); round++) {
+        ASSERT_LT(round, 100000);
+        for (int32_t i = 0; i < dop; i++) {
+            if (merger.is_finished(i) || !merger.has_output(i)) {
+                continue;
+            }
+            ASSIGN_OR_ABORT(auto chunk, merger.try_get_next(i));
+            if (i != 0) {
+                ASSERT_EQ(nullptr, chunk);
+            } else if (chunk != nullptr) {
+                ASSERT_LE(chunk->num_rows(), 1024);
+                outputs.push_back(chunk->get_column_by_index(0));
+            }
+        }
+    }
+    for (int32_t i = 1; i < dop; i++) {
+        ASSERT_TRUE(merger.is_finished(i));
+    }
+
+    ColumnPtr merged = ColumnHelper::create_column(type_desc, false);
+    for (const auto& column : outputs) {
+        merged->append(*column);
+    }
+    ASSERT_EQ(total_rows, merged->size());
+    for (size_t row = 1; row < merged->size(); row++) {
+        ASSERT_LE(merged->compare_at(row - 1, row, *merged, 1), 0) << "row " << row;
+    }
+    for (const auto& boundaries : merger.range_boundaries()) {
+        ASSERT_TRUE(std::is_sorted(boundaries.begin(), boundaries.end()));
+    }
+}
+
+static ColumnPtr build_nullable_int_column(const std::vector<std::optional<int32_t>>& values) {
+    auto column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    for (const auto& value : values) {
+        if (value.has_value()) {
+            column->append_datum(Datum(value.value()));
+        } else {
+            column->append_nulls(1);
+        }
+    }
+    return column;
+}
+
+TEST(MergeJoinTest, inner_join) {
+    Columns left{build_nullable_int_column({std::nullopt, 1, 2, 2, 4, 5})};
+    Columns right{build_nullable_int_column({std::nullopt, 2, 2, 3, 5, 5, 6})};
+
+    MergeJoinResult result;
+    ASSERT_OK(merge_join_sorted_columns(TJoinOp::INNER_JOIN, left, right, &result));
+    // 2 x 2 for key 2 and 1 x 2 for key 5
+    ASSERT_EQ(6, result.size());
+    std::vector<std::pair<uint32_t, uint32_t>> expected{{2, 1}, {2, 2}, {3, 1}, {3, 2}, {5, 4}, {5, 5}};
+    for (size_t i = 0; i < result.size(); i++) {
+        ASSERT_EQ(expected[i].first, result.left_index[i]);
+        ASSERT_EQ(expected[i].second, result.right_index[i]);
+        ASSERT_EQ(0, result.right_is_null[i]);
+    }
+}
+
+TEST(MergeJoinTest, left_outer_semi_anti_join) {
+    Columns left{build_nullable_int_column({std::nullopt, 1, 2, 2, 4, 5})};
+    Columns right{build_nullable_int_column({std::nullopt, 2, 2, 3, 5, 5, 6})};
+
+    MergeJoinResult result;
+    ASSERT_OK(merge_join_sorted_columns(TJoinOp::LEFT_OUTER_JOIN, left, right, &result));
+    // null, 1 and 4 are not matched
+    ASSERT_EQ(9, result.size());
+    ASSERT_EQ(3, SIMD::count_nonzero(result.right_is_null));
+
+    result.clear();
+    ASSERT_OK(merge_join_sorted_columns(TJoinOp::LEFT_SEMI_JOIN, left, right, &result));
+    ASSERT_EQ(3, result.size());
+    ASSERT_EQ(2, result.left_index[0]);
+    ASSERT_EQ(3, result.left_index[1]);
+    ASSERT_EQ(5, result.left_index[2]);
+
+    result.clear();
+    ASSERT_OK(merge_join_sorted_columns(TJoinOp::LEFT_ANTI_JOIN, left, right, &result));
+    ASSERT_EQ(3, result.size());
+    ASSERT_EQ(0, result.left_index[0]);
+    ASSERT_EQ(1, result.left_index[1]);
+    ASSERT_EQ(4, result.left_index[2]);
+
+    result.clear();
+    ASSERT_FALSE(merge_join_sorted_columns(TJoinOp::FULL_OUTER_JOIN, left, right, &result).ok());
+}
+
 } // namespace starrocks
@@ -0,0 +1,223 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/stream/state/local_state_table.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "common/config.h"
+#include "exec/stream/stream_test.h"
+#include "fs/fs.h"
+#include "testutil/assert.h"
+#include "testutil/desc_tbl_helper.h"
+
+namespace starrocks::stream {
+
+static const std::string kStateTableDir = "./be_test_local_state_table";
+
+class LocalStateTableTest : public StreamTestBase {
+public:
+    void SetUp() override {
+        _runtime_state = _obj_pool.add(new RuntimeState(TUniqueId(), TQueryOptions(), TQueryGlobals(), nullptr));
+        std::vector<SlotTypeInfo> src_slots = std::vector<SlotTypeInfo>{
+                {"col1", TYPE_INT, false},
+                {"col2", TYPE_INT, false},
+                {"col3", TYPE_INT, false},
+                {"agg1", TYPE_INT, false},
+        };
+        auto slot_type_info_arrays = DescTblHelper::create_slot_type_desc_info_arrays({src_slots});
+        _tbl = DescTblHelper::generate_desc_tbl(_runtime_state, _obj_pool, slot_type_info_arrays);
+        _runtime_state->set_desc_tbl(_tbl);
+        _old_write_buffer_bytes = config::stream_state_table_write_buffer_bytes;
+        _old_max_runs = config::stream_state_table_max_runs;
+    }
+
+    void TearDown() override {
+        config::stream_state_table_write_buffer_bytes = _old_write_buffer_bytes;
+        config::stream_state_table_max_runs = _old_max_runs;
+    }
+
+protected:
+    std::unique_ptr<LocalStateTable> new_state_table(size_t k_num) {
+        auto state_table = std::make_unique<LocalStateTable>(_tbl->get_tuple_descriptor(0)->slots(), k_num,
+                                                             FileSystem::Default(), kStateTableDir);
+        CHECK(state_table->prepare(_runtime_state).ok());
+        CHECK(state_table->open(_runtime_state).ok());
+        return state_table;
+    }
+
+    void check_seek(StateTable* state_table, const std::vector<int32_t>& keys, const std::vector<int32_t>& ans) {
+        StateTableResult result;
+        ASSERT_OK(state_table->seek(make_key_columns(keys), result));
+        ASSERT_EQ(1, result.found.size());
+        ASSERT_TRUE(result.found[0]);
+        ASSERT_EQ(1, result.result_chunk->num_rows());
+        check_result(result.result_chunk, ans, 0);
+    }
+
+    void check_seek_not_found(StateTable* state_table, const std::vector<int32_t>& keys) {
+        StateTableResult result;
+        ASSERT_OK(state_table->seek(make_key_columns(keys), result));
+        ASSERT_EQ(1, result.found.size());
+        ASSERT_FALSE(result.found[0]);
+        ASSERT_EQ(0, result.result_chunk->num_rows());
+    }
+
+    void check_prefix_scan(StateTable* state_table, const std::vector<int32_t>& keys,
+                           const std::vector<std::vector<int32_t>>& expect_rows) {
+        ASSIGN_OR_ABORT(auto chunk_iter, state_table->prefix_scan(make_key_columns(keys), 0));
+        ChunkPtr chunk = ChunkHelper::new_chunk(chunk_iter->schema(), 1);
+        ASSERT_OK(chunk_iter->get_next(chunk.get()));
+        ASSERT_EQ(expect_rows.size(), chunk->num_rows());
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            check_result(chunk, expect_rows[i], i);
+        }
+        ASSERT_TRUE(chunk_iter->get_next(chunk.get()).is_end_of_file());
+        chunk_iter->close();
+    }
+
+    static void check_result(const ChunkPtr& chunk, const std::vector<int32_t>& ans, size_t row_idx) {
+        ASSERT_EQ(ans.size(), chunk->num_columns());
+        for (size_t i = 0; i < ans.size(); i++) {
+            ASSERT_EQ(ans[i], chunk->get_column_by_index(i)->get(row_idx).get_int32());
+        }
+    }
+
+    static Columns make_key_columns(const std::vector<int32_t>& keys) {
+        Columns cols;
+        for (auto& key : keys) {
+            cols.push_back(ColumnTestHelper::build_column<int32_t>({key}));
+        }
+        return cols;
+    }
+
+    RuntimeState* _runtime_state;
+    ObjectPool _obj_pool;
+    DescriptorTbl* _tbl;
+    int64_t _old_write_buffer_bytes;
+    int32_t _old_max_runs;
+};
+
+TEST_F(LocalStateTableTest, test_seek_in_write_buffer) {
+    auto state_table = new_state_table(1);
+    check_seek_not_found(state_table.get(), {1});
+
+    auto chunk_ptr = MakeStreamChunk<int32_t>({{1, 2, 3}, {1, 2, 3}, {1, 2, 3}, {11, 12, 13}}, {0, 0, 0});
+    ASSERT_OK(state_table->write(_runtime_state, chunk_ptr));
+    ASSERT_OK(state_table->commit(_runtime_state));
+    ASSERT_EQ(0, state_table->num_runs());
+    check_seek(state_table.get(), {1}, {1, 1, 11});
+    check_seek(state_table.get(), {2}, {2, 2, 12});
+    check_seek(state_table.get(), {3}, {3, 3, 13});
+
+    // update 1, delete 2
+    auto chunk_ptr2 = MakeStreamChunk<int32_t>({{1, 2}, {1, 2}, {1, 2}, {21, 12}}, {3, 1});
+    ASSERT_OK(state_table->write(_runtime_state, chunk_ptr2));
+    check_seek(state_table.get(), {1}, {1, 1, 21});
+    check_seek_not_found(state_table.get(), {2});
+    check_seek(state_table.get(), {3}, {3, 3, 13});
+}
+
+TEST_F(LocalStateTableTest, test_seek_in_runs) {
+    config::stream_state_table_write_buffer_bytes = 0;
+    config::stream_state_table_max_runs = 100;
+    auto state_table = new_state_table(1);
+
+    auto chunk_ptr = MakeStreamChunk<int32_t>({{1, 2, 3}, {1, 2, 3}, {1, 2, 3}, {11, 12, 13}}, {0, 0, 0});
+    ASSERT_OK(state_table->write(_runtime_state, chunk_ptr));
+    ASSERT_OK(state_table->commit(_runtime_state));
+    ASSERT_EQ(1, state_table->num_runs());
+    ASSERT_EQ(0, state_table->write_buffer_bytes());
+
+    // the tombstone of 2 hides it in the older run.
+    auto chunk_ptr2 = MakeStreamChunk<int32_t>({{1, 2}, {1, 2}, {1, 2}, {21, 12}}, {0, 1});
+    ASSERT_OK(state_table->write(_runtime_state, chunk_ptr2));
+    ASSERT_OK(state_table->commit(_runtime_state));
+    ASSERT_EQ(2, state_table->num_runs());
+
+    // a batch of keys, found in the write buffer, in the runs or not found.
+    auto chunk_ptr3 = MakeStreamChunk<int32_t>({{4}, {4}, {4}, {14}}, {0});
+    ASSERT_OK(state_table->write(_runtime_state, chunk_ptr3));
+    auto keys = Columns{ColumnTestHelper::build_column<int32_t>({5, 4, 3, 2, 1})};
+    StateTableResult result;
+    ASSERT_OK(state_table->seek(keys, result));
+    ASSERT_EQ((std::vector<bool>{false, true, true, false, true}), result.found);
+    ASSERT_EQ(3, result.result_chunk->num_rows());
+    check_result(result.result_chunk, {4, 4, 14}, 0);
+    check_result(result.result_chunk, {3, 3, 13}, 1);
+    check_result(result.result_chunk, {1, 1, 21}, 2);
+
+    // with selection
+    Filter selection{1, 0, 0, 1, 1};
+    ASSERT_OK(state_table->seek(keys, selection, result));
+    ASSERT_EQ((std::vector<bool>{false, false, false, false, true}), result.found);
+    ASSERT_EQ(1, result.result_chunk->num_rows());
+    check_result(result.result_chunk, {1, 1, 21}, 0);
+}
+
+TEST_F(LocalStateTableTest, test_compact_runs) {
+    config::stream_state_table_write_buffer_bytes = 0;
+    config::stream_state_table_max_runs = 2;
+    auto state_table = new_state_table(1);
+
+    for (int32_t epoch = 0; epoch < 5; epoch++) {
+        // keys [epoch, epoch + 10) are updated and the key epoch - 1 is deleted in each epoch.
+        std::vector<int32_t> keys;
+        std::vector<int32_t> values;
+        std::vector<int8_t> ops;
+        for (int32_t k = epoch; k < epoch + 10; k++) {
+            keys.push_back(k);
+            values.push_back(k * 100 + epoch);
+            ops.push_back(0);
+        }
+        if (epoch > 0) {
+            keys.push_back(epoch - 1);
+            values.push_back(0);
+            ops.push_back(1);
+        }
+        ASSERT_OK(state_table->write(_runtime_state, MakeStreamChunk<int32_t>({keys, keys, keys, values}, ops)));
+        ASSERT_OK(state_table->commit(_runtime_state));
+        ASSERT_LE(state_table->num_runs(), 2);
+    }
+
+    for (int32_t k = 0; k < 4; k++) {
+        check_seek_not_found(state_table.get(), {k});
+    }
+    for (int32_t k = 4; k < 14; k++) {
+        check_seek(state_table.get(), {k}, {k, k, k * 100 + std::min(k, 4)});
+    }
+}
+
+TEST_F(LocalStateTableTest, test_prefix_scan) {
+    config::stream_state_table_write_buffer_bytes = 0;
+    auto state_table = new_state_table(3);
+    auto iter_or = state_table->prefix_scan(make_key_columns({1, 1}), 0);
+    ASSERT_TRUE(iter_or.status().is_end_of_file());
+
+    auto chunk_ptr = MakeStreamChunk<int32_t>({{1, 1, 1, 2}, {1, 1, 1, 1}, {1, 2, 3, 1}, {11, 12, 13, 14}},
+                                              {0, 0, 0, 0});
+    ASSERT_OK(state_table->write(_runtime_state, chunk_ptr));
+    ASSERT_OK(state_table->commit(_runtime_state));
+    check_prefix_scan(state_table.get(), {1, 1}, {{1, 11}, {2, 12}, {3, 13}});
+    check_prefix_scan(state_table.get(), {2}, {{1, 1, 14}});
+
+    // the write buffer overrides the run.
+    auto chunk_ptr2 = MakeStreamChunk<int32_t>({{1, 1, 1}, {1, 1, 1}, {1, 2, 4}, {21, 22, 24}}, {0, 1, 0});
+    ASSERT_OK(state_table->write(_runtime_state, chunk_ptr2));
+    check_prefix_scan(state_table.get(), {1, 1}, {{1, 21}, {3, 13}, {4, 24}});
+}
+
+} // namespace starrocks::stream
@@ -77,4 +77,46 @@ PARALLEL_TEST(PipelineExecutorSetConfigTest, test_constructor) {
     }
 }
 
+PARALLEL_TEST(PipelineExecutorSetConfigTest, test_pick_numa_local_cpuids) {
+    // cpuids [0, 4) are in node 0, and [4, 8) are in node 1.
+    auto get_numa_node = [](CpuUtil::CpuId cpuid) { return cpuid < 4 ? 0 : 1; };
+
+    /// fit in one node
+    {
+        CpuUtil::CpuIds cpuids{0, 1, 4, 5, 6, 7};
+        auto picked = CpuUtil::pick_numa_local_cpuids(&cpuids, 2, get_numa_node);
+        ASSERT_EQ(CpuUtil::CpuIds({0, 1}), picked);
+        ASSERT_EQ(CpuUtil::CpuIds({4, 5, 6, 7}), cpuids);
+    }
+
+    {
+        CpuUtil::CpuIds cpuids{0, 1, 4, 5, 6, 7};
+        auto picked = CpuUtil::pick_numa_local_cpuids(&cpuids, 3, get_numa_node);
+        ASSERT_EQ(CpuUtil::CpuIds({4, 5, 6}), picked);
+        ASSERT_EQ(CpuUtil::CpuIds({0, 1, 7}), cpuids);
+    }
+
+    /// span over nodes
+    {
+        CpuUtil::CpuIds cpuids{0, 1, 4, 5, 6, 7};
+        auto picked = CpuUtil::pick_numa_local_cpuids(&cpuids, 5, get_numa_node);
+        ASSERT_EQ(CpuUtil::CpuIds({4, 5, 6, 7, 0}), picked);
+        ASSERT_EQ(CpuUtil::CpuIds({1}), cpuids);
+    }
+
+    {
+        CpuUtil::CpuIds cpuids{0, 4};
+        auto picked = CpuUtil::pick_numa_local_cpuids(&cpuids, 10, get_numa_node);
+        ASSERT_EQ(2, picked.size());
+        ASSERT_TRUE(cpuids.empty());
+    }
+
+    {
+        CpuUtil::CpuIds cpuids{0, 4};
+        auto picked = CpuUtil::pick_numa_local_cpuids(&cpuids, 0, get_numa_node);
+        ASSERT_TRUE(picked.empty());
+        ASSERT_EQ(2, cpuids.size());
+    }
+}
+
 } // namespace starrocks::workgroup
\ No newline at end of file
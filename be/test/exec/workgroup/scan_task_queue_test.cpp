@@ -23,6 +23,7 @@
 #include <mutex>
 #include <thread>
 
+#include "common/config.h"
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/scan_executor.h"
 #include "exec/workgroup/work_group.h"
@@ -95,4 +96,34 @@ PARALLEL_TEST(ScanExecutorTest, test_yield) {
     ASSERT_EQ(submit_tasks, finished_tasks.load());
 }
 
+TEST(WorkGroupIOBudgetTest, test_charge_io) {
+    const int64_t bytes_per_second_per_core = config::workgroup_io_bytes_per_second_per_core;
+    DeferOp defer([&] { config::workgroup_io_bytes_per_second_per_core = bytes_per_second_per_core; });
+
+    WorkGroup wg("wg_io", 10, WorkGroup::DEFAULT_VERSION, 2, 0.5, 10, 1.0, WorkGroupType::WG_NORMAL);
+    const int64_t now_ns = 100'000'000'000L;
+
+    // Unlimited.
+    config::workgroup_io_bytes_per_second_per_core = 0;
+    wg.charge_io(100L << 20, 100, now_ns);
+    ASSERT_FALSE(wg.is_io_throttled(now_ns));
+    ASSERT_EQ(100L << 20, wg.io_bytes());
+
+    // 2MB per second, and a burst of one second is allowed.
+    config::workgroup_io_bytes_per_second_per_core = 1L << 20;
+    ASSERT_EQ(2L << 20, wg.io_bytes_per_second_limit());
+    wg.charge_io(2L << 20, 1, now_ns);
+    ASSERT_FALSE(wg.is_io_throttled(now_ns));
+    wg.charge_io(1L << 20, 1, now_ns);
+    ASSERT_TRUE(wg.is_io_throttled(now_ns));
+    ASSERT_TRUE(wg.is_io_throttled(now_ns + 400'000'000L));
+    ASSERT_FALSE(wg.is_io_throttled(now_ns + 500'000'000L));
+
+    // The small ops are charged by pages.
+    const int64_t later_ns = now_ns + 10'000'000'000L;
+    wg.charge_io(512 * 1024, 1024, later_ns);
+    ASSERT_TRUE(wg.is_io_throttled(later_ns + 900'000'000L));
+    ASSERT_FALSE(wg.is_io_throttled(later_ns + 1'000'000'000L));
+}
+
 } // namespace starrocks::workgroup
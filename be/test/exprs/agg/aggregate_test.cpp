@@ -23,10 +23,13 @@
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/agg/aggregate_factory.h"
 #include "exprs/agg/aggregate_state_allocator.h"
 #include "exprs/agg/any_value.h"
+#include "exprs/agg/approx_top_k.h"
 #include "exprs/agg/array_agg.h"
+#include "exprs/agg/distinct.h"
 #include "exprs/agg/group_concat.h"
 #include "exprs/agg/maxmin.h"
 #include "exprs/agg/nullable_aggregate.h"
@@ -41,6 +44,7 @@
 #include "runtime/time_types.h"
 #include "testutil/function_utils.h"
 #include "types/bitmap_value.h"
+#include "util/defer_op.h"
 #include "util/slice.h"
 #include "util/thrift_util.h"
 #include "util/unaligned_access.h"
@@ -1087,6 +1091,65 @@ TEST_F(AggregateTest, test_sum_distinct) {
                                                       DecimalV2Value(21));
 }
 
+TEST_F(AggregateTest, test_distinct_bitmap_state) {
+    auto old_min_size = config::distinct_agg_bitmap_min_size;
+    config::distinct_agg_bitmap_min_size = 1024;
+    DeferOp defer([&]() { config::distinct_agg_bitmap_min_size = old_min_size; });
+    using State = DistinctAggregateState<TYPE_BIGINT, TYPE_BIGINT>;
+
+    auto gen_column = [](int64_t begin, int64_t end, int64_t step) {
+        auto column = Int64Column::create();
+        for (int64_t i = begin; i < end; i += step) {
+            column->append(i);
+            column->append(i);
+        }
+        return column;
+    };
+    const auto* count_func = get_aggregate_function("multi_distinct_count", TYPE_BIGINT, TYPE_BIGINT, false);
+    const auto* sum_func = get_aggregate_function("multi_distinct_sum", TYPE_BIGINT, TYPE_BIGINT, false);
+    auto result_column = Int64Column::create();
+
+    // Dense values around 0 go into the bitmap.
+    auto state1 = ManagedAggrState::create(ctx, count_func);
+    ColumnPtr column1 = gen_column(-5000, 5000, 1);
+    const Column* row_column = column1.get();
+    count_func->update_batch_single_state(ctx, row_column->size(), &row_column, state1->state());
+    ASSERT_NE(nullptr, reinterpret_cast<State*>(state1->state())->bitmap);
+    count_func->finalize_to_column(ctx, state1->state(), result_column.get());
+    ASSERT_EQ(10000, result_column->get_data()[0]);
+
+    // Sparse values stay in the hash set.
+    auto state2 = ManagedAggrState::create(ctx, count_func);
+    ColumnPtr column2 = gen_column(0, 10000 * 1000, 1000);
+    row_column = column2.get();
+    count_func->update_batch_single_state(ctx, row_column->size(), &row_column, state2->state());
+    ASSERT_EQ(nullptr, reinterpret_cast<State*>(state2->state())->bitmap);
+    count_func->finalize_to_column(ctx, state2->state(), result_column.get());
+    ASSERT_EQ(10000, result_column->get_data()[1]);
+
+    // The bitmap is serialized as a hash set, and merges into both kinds of states.
+    ColumnPtr serde_column = BinaryColumn::create();
+    count_func->serialize_to_column(ctx, state1->state(), serde_column.get());
+    count_func->merge(ctx, serde_column.get(), state2->state(), 0);
+    count_func->finalize_to_column(ctx, state2->state(), result_column.get());
+    ASSERT_EQ(19995, result_column->get_data()[2]);
+
+    auto state3 = ManagedAggrState::create(ctx, count_func);
+    count_func->merge(ctx, serde_column.get(), state3->state(), 0);
+    ASSERT_NE(nullptr, reinterpret_cast<State*>(state3->state())->bitmap);
+    count_func->merge(ctx, serde_column.get(), state3->state(), 0);
+    count_func->finalize_to_column(ctx, state3->state(), result_column.get());
+    ASSERT_EQ(10000, result_column->get_data()[3]);
+
+    auto sum_state = ManagedAggrState::create(ctx, sum_func);
+    ColumnPtr column3 = gen_column(1, 10001, 1);
+    row_column = column3.get();
+    sum_func->update_batch_single_state(ctx, row_column->size(), &row_column, sum_state->state());
+    ASSERT_NE(nullptr, reinterpret_cast<State*>(sum_state->state())->bitmap);
+    sum_func->finalize_to_column(ctx, sum_state->state(), result_column.get());
+    ASSERT_EQ(50005000, result_column->get_data()[4]);
+}
+
 TEST_F(AggregateTest, test_decimal_multi_distinct_sum) {
     int64_t mem_usage;
     {
@@ -1312,6 +1375,53 @@ TEST_F(AggregateTest, test_count_nullable) {
     ASSERT_EQ(512, result);
 }
 
+TEST_F(AggregateTest, test_single_state_reduce_nullable) {
+    // 1027 rows so the tail isn't a multiple of the reduce lanes, every third row is null
+    auto data_column = DoubleColumn::create();
+    auto null_column = NullColumn::create();
+    double sum = 0;
+    int64_t count = 0;
+    for (int i = 0; i < 1027; i++) {
+        bool is_null = i % 3 == 0;
+        // make the null rows larger/smaller than any not null rows, they must not affect max/min
+        data_column->append(is_null ? (i % 2 ? 1e9 : -1e9) : i - 500);
+        null_column->append(is_null);
+        if (!is_null) {
+            sum += i - 500;
+            count++;
+        }
+    }
+    auto column = NullableColumn::create(std::move(data_column), std::move(null_column));
+    const Column* row_column = column.get();
+
+    auto finalize = [&](const std::string& name) {
+        const AggregateFunction* func = get_aggregate_function(name, TYPE_DOUBLE, TYPE_DOUBLE, true);
+        auto state = ManagedAggrState::create(ctx, func);
+        func->update_batch_single_state(ctx, column->size(), &row_column, state->state());
+        auto result_column = NullableColumn::create(DoubleColumn::create(), NullColumn::create());
+        func->finalize_to_column(ctx, state->state(), result_column.get());
+        EXPECT_FALSE(result_column->is_null(0));
+        return down_cast<const DoubleColumn&>(result_column->data_column_ref()).get_data()[0];
+    };
+    ASSERT_DOUBLE_EQ(sum, finalize("sum"));
+    ASSERT_DOUBLE_EQ(sum / count, finalize("avg"));
+    ASSERT_EQ(1025 - 500, finalize("max"));
+    ASSERT_EQ(1 - 500, finalize("min"));
+
+    // all rows are null
+    auto all_null_column = NullableColumn::create(DoubleColumn::create(), NullColumn::create());
+    all_null_column->append_nulls(100);
+    const Column* all_null_row_column = all_null_column.get();
+    for (const auto* name : {"sum", "avg", "max", "min"}) {
+        const AggregateFunction* func = get_aggregate_function(name, TYPE_DOUBLE, TYPE_DOUBLE, true);
+        auto state = ManagedAggrState::create(ctx, func);
+        func->update_batch_single_state(ctx, all_null_column->size(), &all_null_row_column, state->state());
+        auto result_column = NullableColumn::create(DoubleColumn::create(), NullColumn::create());
+        func->finalize_to_column(ctx, state->state(), result_column.get());
+        ASSERT_TRUE(result_column->is_null(0));
+    }
+}
+
 TEST_F(AggregateTest, test_bitmap_nullable) {
     const AggregateFunction* bitmap_null = get_aggregate_function("bitmap_union_int", TYPE_INT, TYPE_BIGINT, true);
     auto state = ManagedAggrState::create(ctx, bitmap_null);
@@ -1464,6 +1574,113 @@ TEST_F(AggregateTest, test_percentile_cont) {
     ASSERT_EQ(3, result_column->get_data()[0]);
 }
 
+TEST_F(AggregateTest, test_percentile_approx_ddsketch) {
+    std::vector<TypeDescriptor> arg_types = {
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_DOUBLE)),
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_DOUBLE))};
+    auto return_type = AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_DOUBLE));
+    std::unique_ptr<FunctionContext> local_ctx(FunctionContext::create_test_context(std::move(arg_types), return_type));
+
+    const AggregateFunction* func =
+            get_aggregate_function("percentile_approx_ddsketch", TYPE_DOUBLE, TYPE_DOUBLE, false);
+    ASSERT_NE(nullptr, func);
+
+    auto data_column = DoubleColumn::create();
+    for (int i = 1; i <= 1000; ++i) {
+        data_column->append(i);
+    }
+    auto quantile_column = ColumnHelper::create_const_column<TYPE_DOUBLE>(0.9, 1);
+    const Column* raw_columns[2] = {data_column.get(), quantile_column.get()};
+    auto state1 = ManagedAggrState::create(ctx, func);
+    func->update_batch_single_state(local_ctx.get(), data_column->size(), raw_columns, state1->state());
+
+    // The streaming pre-aggregation converts every row to a state.
+    Columns src_columns = {data_column, quantile_column};
+    ColumnPtr converted = BinaryColumn::create();
+    func->convert_to_serialize_format(local_ctx.get(), src_columns, data_column->size(), &converted);
+    ASSERT_EQ(data_column->size(), converted->size());
+    auto state2 = ManagedAggrState::create(ctx, func);
+    for (size_t i = 0; i < converted->size(); ++i) {
+        func->merge(local_ctx.get(), converted.get(), state2->state(), i);
+    }
+
+    ColumnPtr serde_column = BinaryColumn::create();
+    func->serialize_to_column(local_ctx.get(), state1->state(), serde_column.get());
+    func->merge(local_ctx.get(), serde_column.get(), state2->state(), 0);
+
+    auto result_column = DoubleColumn::create();
+    func->finalize_to_column(local_ctx.get(), state1->state(), result_column.get());
+    func->finalize_to_column(local_ctx.get(), state2->state(), result_column.get());
+    ASSERT_NEAR(900, result_column->get_data()[0], 900 * 0.01);
+    ASSERT_NEAR(900, result_column->get_data()[1], 900 * 0.01);
+
+    auto nullable_result = ColumnHelper::create_column(TypeDescriptor(TYPE_DOUBLE), true);
+    auto empty_state = ManagedAggrState::create(ctx, func);
+    func->finalize_to_column(local_ctx.get(), empty_state->state(), nullable_result.get());
+    ASSERT_TRUE(nullable_result->is_null(0));
+}
+
+TEST_F(AggregateTest, test_approx_top_k_batch_and_agg_state) {
+    using State = ApproxTopKState<TYPE_INT>;
+    std::vector<TypeDescriptor> arg_types = {
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_INT)),
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_INT))};
+    auto return_type = AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_ARRAY));
+    std::unique_ptr<FunctionContext> local_ctx(FunctionContext::create_test_context(std::move(arg_types), return_type));
+    local_ctx->set_constant_columns({nullptr, ColumnHelper::create_const_column<TYPE_INT>(2, 1)});
+    const AggregateFunction* func = get_aggregate_function("approx_top_k", TYPE_INT, TYPE_ARRAY, false);
+    ASSERT_NE(nullptr, func);
+
+    auto data_column = Int32Column::create();
+    for (int32_t v : {1, 1, 1, 2, 2, 3, 1, 2}) {
+        data_column->append(v);
+    }
+    const Column* raw_columns[1] = {data_column.get()};
+    auto state1 = ManagedAggrState::create(local_ctx.get(), func);
+    func->update_batch_single_state(local_ctx.get(), data_column->size(), raw_columns, state1->state());
+    auto* st1 = reinterpret_cast<State*>(state1->state());
+    ASSERT_EQ(2, st1->k);
+    ASSERT_EQ(100, st1->counter_num);
+    // Only the used counters are allocated.
+    ASSERT_EQ(3, st1->counters.size());
+    ASSERT_EQ(1, st1->counters[2].value);
+    ASSERT_EQ(4, st1->counters[2].count);
+    ASSERT_EQ(3, st1->counters[1].count);
+
+    // The runs of every state are processed at once.
+    auto state2 = ManagedAggrState::create(local_ctx.get(), func);
+    auto state3 = ManagedAggrState::create(local_ctx.get(), func);
+    std::vector<AggDataPtr> states{state2->state(), state2->state(), state3->state(), state3->state(),
+                                   state2->state(), state2->state(), state3->state(), state2->state()};
+    func->update_batch(local_ctx.get(), data_column->size(), 0, raw_columns, states.data());
+    auto* st2 = reinterpret_cast<State*>(state2->state());
+    auto* st3 = reinterpret_cast<State*>(state3->state());
+    ASSERT_EQ(3, st2->counters.size());
+    ASSERT_EQ(3, st2->counters[0].value);
+    ASSERT_EQ(1, st2->counters[0].count);
+    ASSERT_EQ(2, st2->counters[1].count);
+    ASSERT_EQ(2, st2->counters[2].count);
+    ASSERT_EQ(2, st3->counters.size());
+    ASSERT_EQ(1, st3->counters[1].value);
+    ASSERT_EQ(2, st3->counters[1].count);
+
+    // The k and the counter number are kept in the serialized state, for the agg state combinators
+    // without the constant arguments.
+    ColumnPtr serde_column = BinaryColumn::create();
+    func->serialize_to_column(local_ctx.get(), state1->state(), serde_column.get());
+    std::vector<TypeDescriptor> union_arg_types = {
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_VARBINARY))};
+    std::unique_ptr<FunctionContext> union_ctx(
+            FunctionContext::create_test_context(std::move(union_arg_types), return_type));
+    auto state4 = ManagedAggrState::create(union_ctx.get(), func);
+    func->merge(union_ctx.get(), serde_column.get(), state4->state(), 0);
+    auto* st4 = reinterpret_cast<State*>(state4->state());
+    ASSERT_EQ(2, st4->k);
+    ASSERT_EQ(100, st4->counter_num);
+    ASSERT_EQ(3, st4->counters.size());
+    ASSERT_EQ(4, st4->counters[2].count);
+}
+
 TEST_F(AggregateTest, test_percentile_cont_1) {
     std::vector<TypeDescriptor> arg_types = {
             AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_DOUBLE)),
@@ -2303,6 +2520,67 @@ TEST_F(AggregateTest, test_array_aggV2) {
     }
 }
 
+TEST_F(AggregateTest, test_array_aggV2_update_batch) {
+    std::vector<TypeDescriptor> arg_types = {
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_VARCHAR)),
+            AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_INT))};
+    auto return_type = AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_ARRAY));
+    std::unique_ptr<RuntimeState> runtime_state = std::make_unique<RuntimeState>();
+    std::unique_ptr<FunctionContext> local_ctx(FunctionContext::create_test_context(std::move(arg_types), return_type));
+    std::vector<bool> is_asc_order{0};
+    std::vector<bool> nulls_first{1};
+    local_ctx->set_is_asc_order(is_asc_order);
+    local_ctx->set_nulls_first(nulls_first);
+    local_ctx->set_runtime_state(runtime_state.get());
+    const AggregateFunction* array_agg_func = get_aggregate_function("array_agg2", TYPE_BIGINT, TYPE_ARRAY, false);
+
+    auto char_column = ColumnHelper::create_column(TypeDescriptor::create_varchar_type(30), true);
+    const std::vector<int> groups{0, 0, 1, 2, 1, 0, 2, 2, 1, 0};
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (i % 4 == 3) {
+            char_column->append_datum(Datum());
+        } else {
+            char_column->append_datum(Slice(std::to_string(i)));
+        }
+    }
+    auto int_column = ColumnHelper::create_const_column<TYPE_INT>(7, groups.size());
+    std::vector<const Column*> raw_columns{char_column.get(), int_column.get()};
+
+    // The rows of the states are appended by groups, they must be the same as the rows appended one by one.
+    std::vector<std::unique_ptr<ManagedAggrState>> batch_states;
+    std::vector<std::unique_ptr<ManagedAggrState>> row_states;
+    for (int i = 0; i < 3; ++i) {
+        batch_states.emplace_back(ManagedAggrState::create(local_ctx.get(), array_agg_func));
+        row_states.emplace_back(ManagedAggrState::create(local_ctx.get(), array_agg_func));
+    }
+    std::vector<AggDataPtr> states;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        states.emplace_back(batch_states[groups[i]]->state());
+        array_agg_func->update(local_ctx.get(), raw_columns.data(), row_states[groups[i]]->state(), i);
+    }
+    array_agg_func->update_batch(local_ctx.get(), groups.size(), 0, raw_columns.data(), states.data());
+
+    Filter filter{0, 1, 0, 0, 1, 1, 0, 1, 0, 0};
+    array_agg_func->update_batch_selectively(local_ctx.get(), groups.size(), 0, raw_columns.data(), states.data(),
+                                             filter);
+    for (size_t i = 0; i < groups.size(); ++i) {
+        if (filter[i] == 0) {
+            array_agg_func->update(local_ctx.get(), raw_columns.data(), row_states[groups[i]]->state(), i);
+        }
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        auto* batch_state = (ArrayAggAggregateStateV2*)(batch_states[i]->state());
+        auto* row_state = (ArrayAggAggregateStateV2*)(row_states[i]->state());
+        for (size_t j = 0; j < 2; ++j) {
+            ASSERT_EQ(row_state->data_columns[j]->debug_string(), batch_state->data_columns[j]->debug_string());
+        }
+    }
+    auto* state0 = (ArrayAggAggregateStateV2*)(batch_states[0]->state());
+    ASSERT_EQ("['0', '1', '5', '9', '0', '9']", state0->data_columns[0]->debug_string());
+    ASSERT_EQ("[7, 7, 7, 7, 7, 7]", state0->data_columns[1]->debug_string());
+}
+
 TEST_F(AggregateTest, test_group_concatV2) {
     std::vector<TypeDescriptor> arg_types = {
             AnyValUtil::column_type_to_type_desc(TypeDescriptor::from_logical_type(TYPE_VARCHAR)),
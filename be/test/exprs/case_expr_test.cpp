@@ -17,19 +17,26 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "column/chunk.h"
+#include "column/column_builder.h"
 #include "column/column_helper.h"
 #include "column/column_viewer.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "common/object_pool.h"
+#include "exprs/column_ref.h"
 #include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
+#include "testutil/assert.h"
 #include "types/logical_type.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -100,6 +107,33 @@ private:
     MemPool _mem_pool;
 };
 
+// Applies `fn` to every row of the INT column of its child, and counts the evaluated rows.
+template <LogicalType Type>
+class MockIntFunctionExpr final : public Expr {
+public:
+    MockIntFunctionExpr(Expr* child, std::function<RunTimeCppType<Type>(int32_t)> fn, size_t* num_rows)
+            : Expr(TypeDescriptor(Type), false), _fn(std::move(fn)), _num_rows(num_rows) {
+        add_child(child);
+    }
+
+    Expr* clone(ObjectPool* pool) const override { return pool->add(new MockIntFunctionExpr(*this)); }
+
+    StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* chunk) override {
+        ASSIGN_OR_RETURN(ColumnPtr input, _children[0]->evaluate_checked(context, chunk));
+        ColumnViewer<TYPE_INT> viewer(input);
+        ColumnBuilder<Type> builder(input->size());
+        for (size_t i = 0; i < input->size(); i++) {
+            builder.append(_fn(viewer.value(i)));
+        }
+        *_num_rows += input->size();
+        return builder.build(false);
+    }
+
+private:
+    std::function<RunTimeCppType<Type>(int32_t)> _fn;
+    size_t* _num_rows;
+};
+
 class VectorizedCaseExprTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -904,4 +938,102 @@ TEST_F(VectorizedCaseExprTest, NoCaseWhenNullReturnIntElse) {
     }
 }
 
+// CASE WHEN c < 10 THEN c + 1 WHEN c < 50 THEN c * 2 WHEN c < 60 THEN c * 3 ELSE -c END
+TEST_F(VectorizedCaseExprTest, noCaseSelectiveEval) {
+    expr_node.child_type = TPrimitiveType::BOOLEAN;
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    expr_node.case_expr.has_case_expr = false;
+    expr_node.case_expr.has_else_expr = true;
+    std::unique_ptr<Expr> expr(VectorizedCaseExprFactory::from_thrift(expr_node));
+
+    ObjectPool pool;
+    std::vector<size_t> num_rows(7, 0);
+    auto* ref = pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 1));
+    auto add_child = [&](auto fn, size_t idx, auto type) {
+        constexpr LogicalType Type = decltype(type)::value;
+        expr->add_child(pool.add(new MockIntFunctionExpr<Type>(ref, fn, &num_rows[idx])));
+    };
+    using Bool = std::integral_constant<LogicalType, TYPE_BOOLEAN>;
+    using Int = std::integral_constant<LogicalType, TYPE_INT>;
+    add_child([](int32_t c) { return c < 10; }, 0, Bool());
+    add_child([](int32_t c) { return c + 1; }, 1, Int());
+    add_child([](int32_t c) { return c < 50; }, 2, Bool());
+    add_child([](int32_t c) { return c * 2; }, 3, Int());
+    add_child([](int32_t c) { return c < 60; }, 4, Bool());
+    add_child([](int32_t c) { return c * 3; }, 5, Int());
+    add_child([](int32_t c) { return -c; }, 6, Int());
+
+    Chunk chunk;
+    auto column = Int32Column::create();
+    for (int32_t i = 0; i < 100; i++) {
+        column->append(i);
+    }
+    chunk.append_column(std::move(column), 1);
+
+    auto verify = [&](const ColumnPtr& result) {
+        ColumnViewer<TYPE_INT> viewer(result);
+        ASSERT_EQ(100, result->size());
+        for (int32_t c = 0; c < 100; c++) {
+            int32_t expected = c < 10 ? c + 1 : c < 50 ? c * 2 : c < 60 ? c * 3 : -c;
+            ASSERT_FALSE(viewer.is_null(c));
+            ASSERT_EQ(expected, viewer.value(c));
+        }
+    };
+
+    auto old_ratio = config::case_when_selective_eval_max_ratio;
+    DeferOp defer([&] { config::case_when_selective_eval_max_ratio = old_ratio; });
+    config::case_when_selective_eval_max_ratio = 0.5;
+    ASSIGN_OR_ABORT(auto result, expr->evaluate_checked(nullptr, &chunk));
+    verify(result);
+    // The second WHEN is evaluated on all the rows as 90% rows are not matched,
+    // the others are only evaluated on the rows not matched or selected.
+    EXPECT_EQ(std::vector<size_t>({100, 10, 100, 40, 50, 10, 40}), num_rows);
+
+    config::case_when_selective_eval_max_ratio = 0;
+    std::fill(num_rows.begin(), num_rows.end(), 0);
+    ASSIGN_OR_ABORT(result, expr->evaluate_checked(nullptr, &chunk));
+    verify(result);
+    EXPECT_EQ(std::vector<size_t>(7, 100), num_rows);
+}
+
+// CASE WHEN c < 10 THEN 1 WHEN c < 50 THEN NULL ELSE 3 END
+TEST_F(VectorizedCaseExprTest, noCaseSelectiveEvalConstThen) {
+    expr_node.child_type = TPrimitiveType::BOOLEAN;
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    expr_node.case_expr.has_case_expr = false;
+    expr_node.case_expr.has_else_expr = true;
+    std::unique_ptr<Expr> expr(VectorizedCaseExprFactory::from_thrift(expr_node));
+
+    ObjectPool pool;
+    size_t num_rows = 0;
+    auto* ref = pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 1));
+    TExprNode int_node = expr_node;
+    int_node.node_type = TExprNodeType::INT_LITERAL;
+    expr->add_child(pool.add(new MockIntFunctionExpr<TYPE_BOOLEAN>(ref, [](int32_t c) { return c < 10; }, &num_rows)));
+    expr->add_child(pool.add(new MockConstVectorizedExpr<TYPE_INT>(int_node, 1)));
+    expr->add_child(pool.add(new MockIntFunctionExpr<TYPE_BOOLEAN>(ref, [](int32_t c) { return c < 50; }, &num_rows)));
+    auto* null_then = pool.add(new FakeConstExpr(int_node));
+    null_then->_column = ColumnHelper::create_const_null_column(1);
+    expr->add_child(null_then);
+    expr->add_child(pool.add(new MockConstVectorizedExpr<TYPE_INT>(int_node, 3)));
+
+    Chunk chunk;
+    auto column = Int32Column::create();
+    for (int32_t i = 0; i < 100; i++) {
+        column->append(i);
+    }
+    chunk.append_column(std::move(column), 1);
+
+    ASSIGN_OR_ABORT(auto result, expr->evaluate_checked(nullptr, &chunk));
+    ASSERT_EQ(100, result->size());
+    ASSERT_TRUE(result->is_nullable());
+    for (int32_t c = 0; c < 100; c++) {
+        if (c >= 10 && c < 50) {
+            ASSERT_TRUE(result->is_null(c));
+        } else {
+            ASSERT_EQ(c < 10 ? 1 : 3, result->get(c).get_int32());
+        }
+    }
+}
+
 } // namespace starrocks
@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 
 #include "butil/time.h"
+#include "column/nullable_column.h"
 #include "exprs/geo_functions.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "geo/geo_types.h"
@@ -460,4 +461,76 @@ TEST_F(geographyFunctionsTest, st_containsConstTest) {
     GeoFunctions::st_contains_close(ctx.get(), FunctionContext::FRAGMENT_LOCAL);
 }
 
+TEST_F(geographyFunctionsTest, st_distance_sphereColumnsTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    std::vector<double> coords[4] = {
+            {0, 116.35620117, 10, 200}, {0, 39.939093, -20, 0}, {0, 116.4274406433, 10, 0}, {0, 39.9020987219, 30, 0}};
+    Columns columns;
+    for (const auto& values : coords) {
+        auto column = DoubleColumn::create();
+        column->append_numbers(values.data(), values.size() * sizeof(double));
+        columns.emplace_back(column);
+    }
+
+    // The invalid longitude 200 is null.
+    ColumnPtr result = GeoFunctions::st_distance_sphere(ctx.get(), columns).value();
+    ASSERT_EQ(4, result->size());
+    for (size_t row = 0; row < 3; row++) {
+        double dist;
+        ASSERT_TRUE(GeoPoint::st_distance_sphere(coords[0][row], coords[1][row], coords[2][row], coords[3][row], &dist));
+        ASSERT_FALSE(result->is_null(row));
+        ASSERT_EQ(dist, result->get(row).get_double());
+    }
+    ASSERT_TRUE(result->is_null(3));
+
+    // The valid coordinates give a non-nullable column.
+    for (auto& column : columns) {
+        column->resize(3);
+    }
+    result = GeoFunctions::st_distance_sphere(ctx.get(), columns).value();
+    ASSERT_FALSE(result->is_nullable());
+    ASSERT_EQ(3, result->size());
+}
+
+TEST_F(geographyFunctionsTest, st_containsRepeatedShapesTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    auto encode = [](const std::string& wkt) {
+        GeoParseStatus status;
+        std::unique_ptr<GeoShape> shape(GeoShape::from_wkt(wkt.data(), wkt.size(), &status));
+        std::string buf;
+        shape->encode_to(&buf);
+        return buf;
+    };
+    std::string small = encode("POLYGON ((10 10, 50 10, 50 50, 10 50, 10 10))");
+    std::string large = encode("POLYGON ((0 0, 80 0, 80 80, 0 80, 0 0))");
+    std::string inside = encode("POINT (25 25)");
+    std::string outside = encode("POINT (60 60)");
+
+    // The polygons are repeated in runs, with a null and an undecodable one in between.
+    auto polygons = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    auto points = BinaryColumn::create();
+    std::vector<std::pair<std::string, std::string>> rows = {{small, inside}, {small, outside}, {small, inside},
+                                                             {"", inside},    {large, outside}, {large, inside},
+                                                             {"A", inside},   {small, outside}};
+    for (const auto& [polygon, point] : rows) {
+        if (polygon.empty()) {
+            polygons->append_nulls(1);
+        } else {
+            polygons->append_datum(Slice(polygon));
+        }
+        points->append(Slice(point));
+    }
+
+    Columns columns{polygons, points};
+    ctx->set_constant_columns(columns);
+    ASSERT_TRUE(GeoFunctions::st_contains_prepare(ctx.get(), FunctionContext::FRAGMENT_LOCAL).ok());
+    auto res = GeoFunctions::st_contains(ctx.get(), columns).value();
+    ASSERT_EQ(rows.size(), res->size());
+    std::vector<int> expected = {1, 0, 1, -1, 1, 1, -1, 0};
+    for (size_t row = 0; row < rows.size(); row++) {
+        ASSERT_EQ(expected[row], res->is_null(row) ? -1 : res->get(row).get_uint8()) << row;
+    }
+    ASSERT_TRUE(GeoFunctions::st_contains_close(ctx.get(), FunctionContext::FRAGMENT_LOCAL).ok());
+}
+
 } // namespace starrocks
@@ -17,10 +17,13 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include "butil/time.h"
 #include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "exprs/in_const_predicate.hpp"
 #include "exprs/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -479,4 +482,48 @@ TEST_F(VectorizedInPredicateTest, inArrayConstAllNULL) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, intInDenseArray) {
+    expr_node.child_type = TPrimitiveType::BIGINT;
+    expr_node.opcode = TExprOpcode::FILTER_IN;
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    for (bool not_in : is_not_in) {
+        for (int64_t step : {3, 1000}) {
+            expr_node.in_predicate.is_not_in = not_in;
+            auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+
+            auto data = Int64Column::create();
+            for (int64_t v = -100; v < 3000; v++) {
+                data->append(v);
+            }
+            data->append(std::numeric_limits<int64_t>::min());
+            data->append(std::numeric_limits<int64_t>::max());
+            MockColumnExpr col(expr_node, data);
+            expr->_children.push_back(&col);
+            // values 0, step, 2 * step ... 19 * step
+            std::vector<std::unique_ptr<MockConstVectorizedExpr<TYPE_BIGINT>>> values;
+            for (int64_t i = 0; i < 20; i++) {
+                values.emplace_back(std::make_unique<MockConstVectorizedExpr<TYPE_BIGINT>>(expr_node, i * step));
+                expr->_children.push_back(values.back().get());
+            }
+
+            ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+            ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+            auto* in_pred = dynamic_cast<VectorizedInConstPredicate<TYPE_BIGINT>*>(expr.get());
+            ASSERT_NE(nullptr, in_pred);
+            // 20 values in a range of 19001 is too sparse for the array.
+            ASSERT_EQ(step == 3, in_pred->is_use_dense_array());
+
+            ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+            ASSERT_EQ(data->size(), ptr->size());
+            auto v = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(ptr);
+            for (size_t j = 0; j < data->size(); ++j) {
+                int64_t value = data->get_data()[j];
+                bool found = value >= 0 && value < 20 * step && value % step == 0;
+                ASSERT_EQ(found != not_in, v->get_data()[j]) << value;
+            }
+            expr->_children.clear();
+        }
+    }
+}
+
 } // namespace starrocks
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "butil/time.h"
+#include "column/column_viewer.h"
 #include "column/const_column.h"
 #include "column/map_column.h"
 #include "column/nullable_column.h"
@@ -145,6 +146,61 @@ TEST_F(JsonFunctionsTest, get_json_string_casting) {
                         .ok());
 }
 
+TEST_F(JsonFunctionsTest, get_json_value_simd_extract) {
+    std::string values[] = {R"({"k1": {"k2": "v2"}})",
+                            R"({"k1": {"k2": "a\"b"}})",
+                            R"({"k1": {"k2": 12}})",
+                            R"({"k1": {"k2": 3.5}})",
+                            R"({"k1": {"k2": true}})",
+                            R"({"k1": {"k2": null}})",
+                            R"({"k1": {"k2": [1, 2]}})",
+                            R"({"k1": {"k2": {"a": 1}}})",
+                            R"({"k1": {"k3": 1}})",
+                            R"({"k1": 1})",
+                            R"([1, 2])",
+                            R"({"k\u0031": {"k2": "v2"}})",
+                            R"({"k1": {"k2": "42"}})",
+                            R"({"k1": {"k2": 9999999999}})",
+                            "not a json",
+                            R"({"k0": 1, "k1": {"k2": -7}})"};
+    auto strings = BinaryColumn::create();
+    for (const auto& value : values) {
+        strings->append(value);
+    }
+    auto path = ColumnHelper::create_const_column<TYPE_VARCHAR>("$.k1.k2", strings->size());
+    Columns columns{strings, path};
+
+    auto evaluate = [&](auto fn) {
+        std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+        ctx->set_constant_columns(columns);
+        CHECK(JsonFunctions::native_json_path_prepare(ctx.get(), FunctionContext::FRAGMENT_LOCAL).ok());
+        DeferOp defer([&] { (void)JsonFunctions::native_json_path_close(ctx.get(), FunctionContext::FRAGMENT_LOCAL); });
+        return fn(ctx.get(), columns).value();
+    };
+    auto expect_same = [&](auto fn) {
+        auto old = config::enable_json_simd_extract;
+        DeferOp defer([&] { config::enable_json_simd_extract = old; });
+        config::enable_json_simd_extract = false;
+        auto expected = evaluate(fn);
+        config::enable_json_simd_extract = true;
+        auto actual = evaluate(fn);
+        ASSERT_EQ(expected->size(), actual->size());
+        for (size_t i = 0; i < expected->size(); i++) {
+            EXPECT_EQ(expected->debug_item(i), actual->debug_item(i)) << values[i];
+        }
+    };
+    expect_same(JsonFunctions::get_json_string);
+    expect_same(JsonFunctions::get_json_int);
+    expect_same(JsonFunctions::get_json_bigint);
+    expect_same(JsonFunctions::get_json_double);
+
+    ColumnViewer<TYPE_VARCHAR> viewer(evaluate(JsonFunctions::get_json_string));
+    EXPECT_EQ("v2", viewer.value(0).to_string());
+    EXPECT_EQ("a\"b", viewer.value(1).to_string());
+    EXPECT_EQ("v2", viewer.value(11).to_string());
+    EXPECT_TRUE(viewer.is_null(8));
+}
+
 TEST_F(JsonFunctionsTest, get_json_string_array) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     Columns columns;
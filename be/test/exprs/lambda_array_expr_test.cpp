@@ -21,6 +21,7 @@
 #include "butil/time.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "exprs/arithmetic_expr.h"
 #include "exprs/array_expr.h"
 #include "exprs/array_map_expr.h"
@@ -33,6 +34,7 @@
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -312,6 +314,65 @@ TEST_F(VectorizedLambdaFunctionExprTest, array_map_lambda_test_normal_array) {
     }
 }
 
+// The arrays have more elements than a chunk.
+TEST_F(VectorizedLambdaFunctionExprTest, array_map_lambda_test_large_array) {
+    auto cur_chunk = std::make_shared<Chunk>();
+    std::vector<int> vec_a = {1, 2, 3, 4};
+    cur_chunk->append_column(build_int_column(vec_a), 1);
+
+    const int num_elements = 3000;
+    auto array = ColumnHelper::create_column(array_type(TYPE_INT), true);
+    for (int row = 0; row < 4; row++) {
+        if (row == 1) {
+            array->append_datum(Datum{});
+            continue;
+        }
+        DatumArray elements;
+        for (int i = 0; i < num_elements; i++) {
+            elements.emplace_back(i % 7 == 0 ? Datum() : Datum(row * num_elements + i));
+        }
+        array->append_datum(elements);
+    }
+    auto* array_expr = new_fake_const_expr(array, array_type(TYPE_INT));
+
+    bool old_config = config::enable_array_map_one_pass_eval;
+    DeferOp defer([&]() { config::enable_array_map_one_pass_eval = old_config; });
+    for (bool one_pass : {true, false}) {
+        config::enable_array_map_one_pass_eval = one_pass;
+        auto lambda_funcs = create_lambda_expr(&_objpool);
+        // x -> x and x -> x + a
+        for (int j : {0, 2}) {
+            ArrayMapExpr array_map_expr(array_type(TYPE_INT));
+            array_map_expr.clear_children();
+            array_map_expr.add_child(lambda_funcs[j]);
+            array_map_expr.add_child(array_expr);
+            ExprContext exprContext(&array_map_expr);
+            std::vector<ExprContext*> expr_ctxs = {&exprContext};
+            ASSERT_OK(Expr::prepare(expr_ctxs, &_runtime_state));
+            ASSERT_OK(Expr::open(expr_ctxs, &_runtime_state));
+            ASSERT_EQ(one_pass, array_map_expr.is_one_pass_lambda_expr());
+
+            ColumnPtr result = array_map_expr.evaluate(&exprContext, cur_chunk.get());
+            ASSERT_EQ(4, result->size());
+            ASSERT_TRUE(result->get(1).is_null());
+            for (int row : {0, 2, 3}) {
+                auto elements = result->get(row).get_array();
+                ASSERT_EQ(num_elements, elements.size());
+                for (int i = 0; i < num_elements; i++) {
+                    if (i % 7 == 0) {
+                        ASSERT_TRUE(elements[i].is_null());
+                    } else {
+                        ASSERT_EQ(row * num_elements + i + (j == 2 ? vec_a[row] : 0), elements[i].get_int32());
+                    }
+                }
+            }
+            // The input is not changed.
+            ASSERT_EQ(1, array->get(0).get_array()[1].get_int32());
+            Expr::close(expr_ctxs, &_runtime_state);
+        }
+    }
+}
+
 TEST_F(VectorizedLambdaFunctionExprTest, array_map_lambda_test_special_array) {
     auto cur_chunk = std::make_shared<Chunk>();
     std::vector<int> vec_a = {1, 1, 1};
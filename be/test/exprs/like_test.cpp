@@ -694,4 +694,35 @@ TEST_F(LikeTest, splitLikePatternIntoNgramSet) {
     VectorizedFunctionCallExpr::split_like_string_to_ngram(pattern, options, ngram_set);
     ASSERT_EQ(0, ngram_set.size());
 }
+
+TEST_F(LikeTest, multiPatternMatcher) {
+    LikePredicate::MultiPatternMatcher matcher;
+    matcher.add_pattern("abc%", true);
+    matcher.add_pattern("%x_z", true);
+    matcher.add_pattern("50\\%", true);
+    matcher.add_pattern("^[0-9]+$", false);
+    ASSERT_EQ(4, matcher.num_patterns());
+    ASSERT_TRUE(matcher.compile());
+
+    auto haystack = BinaryColumn::create();
+    auto null = NullColumn::create();
+    std::vector<std::string> values{"abcdef", "ab", "wxyz", "xyz\n", "50%", "500", "12345", "", "abc"};
+    for (const auto& value : values) {
+        haystack->append(value);
+        null->append(0);
+    }
+    haystack->append("abc");
+    null->append(1);
+
+    auto result = matcher.match_any(NullableColumn::create(haystack, null)).value();
+    ASSERT_EQ(values.size() + 1, result->size());
+    std::vector<bool> expected{true, false, true, false, true, true, true, false, true};
+    auto v = ColumnHelper::cast_to<TYPE_BOOLEAN>(ColumnHelper::as_raw_column<NullableColumn>(result)->data_column());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_FALSE(result->is_null(i));
+        ASSERT_EQ(expected[i], v->get_data()[i]) << values[i];
+    }
+    ASSERT_TRUE(result->is_null(values.size()));
+}
+
 } // namespace starrocks
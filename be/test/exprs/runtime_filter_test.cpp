@@ -20,8 +20,12 @@
 #include <random>
 #include <utility>
 
+#include "column/chunk.h"
 #include "column/column_helper.h"
+#include "exprs/binary_predicate.h"
 #include "exprs/runtime_filter_bank.h"
+#include "runtime/runtime_state.h"
+#include "testutil/column_test_helper.h"
 #include "simd/simd.h"
 
 namespace starrocks {
@@ -1111,4 +1115,64 @@ TEST_F(RuntimeFilterTest, TestPipelineLevelBucketJoinWithoutLocalExchange4) {
                                {2, BUCKET_ABSENT, 1, BUCKET_ABSENT, 0, BUCKET_ABSENT});
 }
 
+static ExprContext* create_int_comparison(ObjectPool* pool, RuntimeState* state, TExprOpcode::type op) {
+    TExprNode node;
+    node.opcode = op;
+    node.child_type = TPrimitiveType::INT;
+    node.node_type = TExprNodeType::BINARY_PRED;
+    node.num_children = 2;
+    node.__isset.opcode = true;
+    node.__isset.child_type = true;
+    node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+    Expr* expr = pool->add(VectorizedBinaryPredicateFactory::from_thrift(node));
+    // probe slot 1 OP build slot 2
+    expr->add_child(pool->add(new ColumnRef(TypeDescriptor(TYPE_INT), 1)));
+    expr->add_child(pool->add(new ColumnRef(TypeDescriptor(TYPE_INT), 2)));
+    auto* ctx = pool->add(new ExprContext(expr));
+    CHECK(ctx->prepare(state).ok());
+    CHECK(ctx->open(state).ok());
+    return ctx;
+}
+
+TEST_F(RuntimeFilterTest, TestRewriteRangeRuntimeFilterInCrossJoin) {
+    RuntimeState state;
+    ObjectPool pool;
+
+    std::vector<ChunkPtr> build_chunks;
+    for (auto& [values, nulls] : std::vector<std::pair<std::vector<int32_t>, std::vector<uint8_t>>>{
+                 {{5, 0, 3}, {0, 1, 0}}, {{9, 4}, {0, 0}}}) {
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(ColumnTestHelper::build_nullable_column<int32_t>(values, nulls), 2);
+        build_chunks.emplace_back(std::move(chunk));
+    }
+    auto probe_chunk = std::make_shared<Chunk>();
+    probe_chunk->append_column(ColumnTestHelper::build_column<int32_t>({2, 3, 9, 10}), 1);
+
+    auto check = [&](TExprOpcode::type op, const std::vector<uint8_t>& expected) {
+        ExprContext* conjunct = create_int_comparison(&pool, &state, op);
+        auto rf = RuntimeFilterHelper::rewrite_range_runtime_filter_in_cross_join_node(&pool, conjunct, build_chunks);
+        ASSERT_TRUE(rf.ok()) << rf.status();
+        if (expected.empty()) {
+            ASSERT_EQ(nullptr, rf.value());
+            return;
+        }
+        ASSERT_TRUE(rf.value()->build_from_only_in_filter());
+        ASSERT_TRUE(rf.value()->prepare(&state).ok());
+        ASSERT_TRUE(rf.value()->open(&state).ok());
+        auto res = rf.value()->evaluate(probe_chunk.get());
+        ASSERT_TRUE(res.ok()) << res.status();
+        ASSERT_EQ(expected.size(), res.value()->size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(expected[i], res.value()->get(i).get_uint8()) << "row " << i;
+        }
+    };
+
+    // slot1 >= min(slot2) = 3, the NULL is skipped
+    check(TExprOpcode::GE, {0, 1, 1, 1});
+    // slot1 < max(slot2) = 9
+    check(TExprOpcode::LT, {1, 1, 0, 0});
+    // not a range comparison
+    check(TExprOpcode::EQ, {});
+}
+
 } // namespace starrocks
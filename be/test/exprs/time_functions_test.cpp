@@ -34,6 +34,7 @@
 #include "runtime/datetime_value.h"
 #include "runtime/runtime_state.h"
 #include "runtime/time_types.h"
+#include "testutil/assert.h"
 #include "testutil/function_utils.h"
 #include "types/logical_type.h"
 
@@ -1897,6 +1898,72 @@ TEST_F(TimeFunctionsTest, date_format) {
     }
 }
 
+TEST_F(TimeFunctionsTest, date_format_compiled_program) {
+    FunctionContext* ctx = FunctionContext::create_test_context();
+    auto ptr = std::unique_ptr<FunctionContext>(ctx);
+
+    std::vector<TimestampValue> values = {TimestampValue::create(2020, 6, 25, 15, 58, 21, 1234),
+                                          TimestampValue::create(1, 1, 1, 0, 0, 0, 0),
+                                          TimestampValue::create(9999, 12, 31, 23, 59, 59, 999999),
+                                          TimestampValue::create(2008, 2, 9, 12, 5, 7, 120000)};
+    auto dt_col = TimestampColumn::create();
+    for (const auto& value : values) {
+        dt_col->append(value);
+    }
+
+    std::vector<std::string> formats = {"%d/%m/%Y %H:%i:%s.%f", "%Y%m%d%H%i%S", "%y-%c-%e %k:%i", "%h %I %l:%s",
+                                        "[%T] %Y%%", "%Y-%m-%dT%H:%i:%s", "%Y-%m-%d %", "%Y %M %D"};
+    for (const auto& format : formats) {
+        auto fmt_col = ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(format), 1);
+        Columns columns;
+        columns.emplace_back(dt_col);
+        columns.emplace_back(fmt_col);
+        ctx->set_constant_columns(columns);
+        ASSERT_OK(TimeFunctions::format_prepare(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL));
+        auto* fc = reinterpret_cast<TimeFunctions::FormatCtx*>(
+                ctx->get_function_state(FunctionContext::FunctionStateScope::FRAGMENT_LOCAL));
+        // The names are not compiled.
+        ASSERT_EQ(format != "%Y %M %D", !fc->program.empty()) << format;
+        ColumnPtr result = TimeFunctions::datetime_format(ctx, columns).value();
+        ASSERT_OK(TimeFunctions::format_close(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL));
+
+        ASSERT_EQ(values.size(), result->size());
+        auto v = ColumnHelper::cast_to<TYPE_VARCHAR>(result);
+        for (size_t i = 0; i < values.size(); ++i) {
+            int year, month, day, hour, minute, second, usec;
+            values[i].to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
+            DateTimeValue dt(TIME_DATETIME, year, month, day, hour, minute, second, usec);
+            char buf[128];
+            ASSERT_TRUE(dt.to_format_string(format.c_str(), format.size(), buf));
+            ASSERT_EQ(std::string(buf), v->get_data()[i].to_string()) << format;
+        }
+    }
+}
+
+TEST_F(TimeFunctionsTest, from_string_to_datetime_with_fraction) {
+    auto parse = [](const std::string& str) {
+        TimestampValue ts;
+        return ts.from_string(str.data(), str.size()) ? ts.to_string() : std::string("invalid");
+    };
+    ASSERT_EQ("2020-06-25 15:58:21.100000", parse("2020-06-25 15:58:21.1"));
+    ASSERT_EQ("2020-06-25 15:58:21.123000", parse("2020-06-25T15:58:21.123"));
+    ASSERT_EQ("2020-06-25 15:58:21.123456", parse("  2020-06-25 15:58:21.123456 "));
+    ASSERT_EQ("2020-06-25 15:58:21.000012", parse("2020-06-25 15:58:21.000012"));
+    // Fall back to the generic parsing.
+    ASSERT_EQ("2020-06-25 15:58:21.123456", parse("2020-06-25 15:58:21.1234567"));
+    ASSERT_EQ("invalid", parse("2020-02-30 15:58:21.123"));
+    ASSERT_EQ("invalid", parse("2020-06-25 25:58:21.123"));
+
+    date::ToDatetimeResult res;
+    ASSERT_TRUE(date::from_string_to_datetime_with_fraction("2024-02-29 01:02:03.45", 22, &res));
+    ASSERT_EQ(2024, res.year);
+    ASSERT_EQ(29, res.day);
+    ASSERT_EQ(3, res.second);
+    ASSERT_EQ(450000, res.microsecond);
+    ASSERT_FALSE(date::from_string_to_datetime_with_fraction("2024-02-29 01:02:03.4a", 22, &res));
+    ASSERT_FALSE(date::from_string_to_datetime_with_fraction("2024-02-29_01:02:03.45", 22, &res));
+}
+
 TEST_F(TimeFunctionsTest, jodatime_format) {
     FunctionContext* ctx = FunctionContext::create_test_context();
     auto ptr = std::unique_ptr<FunctionContext>(ctx);
@@ -0,0 +1,60 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/file_footer_cache.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(FileFooterCacheTest, TestLookupAndInsert) {
+    FileFooterCache cache(1024);
+    ASSERT_TRUE(cache.enabled());
+
+    std::string key = FileFooterCache::make_key("orc", "hdfs://a/b.orc", 100, 1000);
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(key));
+
+    cache.insert(key, std::make_shared<std::string>("tail"), 4);
+    auto value = cache.lookup<std::string>(key);
+    ASSERT_NE(nullptr, value);
+    ASSERT_EQ("tail", *value);
+
+    // The file is rewritten.
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FileFooterCache::make_key("orc", "hdfs://a/b.orc", 101, 1000)));
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FileFooterCache::make_key("orc", "hdfs://a/b.orc", 100, 1001)));
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(FileFooterCache::make_key("parquet", "hdfs://a/b.orc", 100, 1000)));
+}
+
+TEST(FileFooterCacheTest, TestReplace) {
+    FileFooterCache cache(1024);
+    std::string key = FileFooterCache::make_key("orc", "a.orc", 1, 1);
+    cache.insert(key, std::make_shared<std::string>("a"), 1);
+    auto value = cache.lookup<std::string>(key);
+    cache.insert(key, std::make_shared<std::string>("b"), 1);
+
+    ASSERT_EQ("b", *cache.lookup<std::string>(key));
+    // The replaced value is still valid for its users.
+    ASSERT_EQ("a", *value);
+}
+
+TEST(FileFooterCacheTest, TestDisabled) {
+    FileFooterCache cache(0);
+    ASSERT_FALSE(cache.enabled());
+    std::string key = FileFooterCache::make_key("orc", "a.orc", 1, 1);
+    cache.insert(key, std::make_shared<std::string>("a"), 1);
+    ASSERT_EQ(nullptr, cache.lookup<std::string>(key));
+    ASSERT_EQ(0, cache.memory_usage());
+}
+
+} // namespace starrocks
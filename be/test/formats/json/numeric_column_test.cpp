@@ -66,6 +66,23 @@ TEST_F(AddNumericColumnTest, test_add_invalid) {
     ASSERT_TRUE(st.is_invalid_argument());
 }
 
+TEST_F(AddNumericColumnTest, test_add_int_fallback) {
+    auto column = FixedLengthColumn<int32_t>::create();
+    TypeDescriptor t(TYPE_INT);
+
+    simdjson::ondemand::parser parser;
+    auto json = R"(  { "a": 1.5, "b": -2, "c": 3e2, "d": 7} )"_padded;
+    auto doc = parser.iterate(json);
+    simdjson::ondemand::object obj = doc.get_object();
+    // the values not parsed as int64 by the fast path must not be consumed
+    for (auto field : obj) {
+        simdjson::ondemand::value val = field.value();
+        ASSERT_TRUE(add_numeric_column<int32_t>(column.get(), t, "f_int", &val).ok());
+    }
+
+    ASSERT_EQ("[1, -2, 300, 7]", column->debug_string());
+}
+
 TEST_F(AddNumericColumnTest, test_add_int_overflow) {
     auto column = FixedLengthColumn<int32_t>::create();
     TypeDescriptor t(TYPE_INT);
@@ -37,6 +37,7 @@
 #include "runtime/runtime_state.h"
 #include "testutil/assert.h"
 #include "util/priority_thread_pool.hpp"
+#include "util/threadpool.h"
 
 namespace starrocks::formats {
 
@@ -1077,4 +1078,63 @@ TEST_F(OrcFileWriterTest, TestOrcPatchedBaseWrongBaseWidth) {
     assert_equal_chunk(chunk.get(), read_chunk.get());
 }
 
+TEST_F(OrcFileWriterTest, TestWriteColumnsInParallel) {
+    ASSERT_OK(ignore_not_found(_fs->delete_file(_file_path)));
+    std::vector<TypeDescriptor> type_descs{
+            TypeDescriptor::from_logical_type(TYPE_INT),
+            TypeDescriptor::from_logical_type(TYPE_VARCHAR),
+            TypeDescriptor::from_logical_type(TYPE_BIGINT),
+    };
+
+    std::unique_ptr<ThreadPool> encode_pool;
+    ASSERT_OK(ThreadPoolBuilder("orc_encode").set_max_threads(2).build(&encode_pool));
+
+    auto column_names = _make_type_names(type_descs);
+    auto output_file = _fs->new_writable_file(_file_path).value();
+    auto output_stream = std::make_unique<OrcOutputStream>(std::move(output_file));
+    auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+    auto writer_options = std::make_shared<formats::ORCWriterOptions>();
+    writer_options->encode_pool = encode_pool.get();
+    auto writer = std::make_unique<formats::ORCFileWriter>(_file_path, std::move(output_stream), column_names,
+                                                           type_descs, std::move(column_evaluators),
+                                                           TCompressionType::SNAPPY, writer_options, []() {});
+    ASSERT_OK(writer->init());
+
+    auto make_chunk = [&](int start, int num_rows) {
+        auto chunk = std::make_shared<Chunk>();
+        auto col0 = ColumnHelper::create_column(type_descs[0], true);
+        auto col1 = ColumnHelper::create_column(type_descs[1], true);
+        auto col2 = ColumnHelper::create_column(type_descs[2], true);
+        for (int i = start; i < start + num_rows; i++) {
+            if (i % 3 == 0) {
+                col0->append_nulls(1);
+                col1->append_nulls(1);
+                col2->append_nulls(1);
+                continue;
+            }
+            std::string value = "value_" + std::to_string(i);
+            col0->append_datum(Datum(static_cast<int32_t>(i)));
+            col1->append_datum(Datum(Slice(value)));
+            col2->append_datum(Datum(static_cast<int64_t>(i) * 1000));
+        }
+        chunk->append_column(col0, 0);
+        chunk->append_column(col1, 1);
+        chunk->append_column(col2, 2);
+        return chunk;
+    };
+
+    // The row batch of the first chunk grows for the second one.
+    auto chunk1 = make_chunk(0, 3);
+    auto chunk2 = make_chunk(3, 5);
+    ASSERT_OK(writer->write(chunk1.get()));
+    ASSERT_OK(writer->write(chunk2.get()));
+    auto result = writer->commit();
+    ASSERT_OK(result.io_status);
+    ASSERT_EQ(result.file_statistics.record_count, 8);
+
+    ChunkPtr read_chunk;
+    ASSERT_OK(_read_chunk(read_chunk, column_names, type_descs, true));
+    assert_equal_chunk(make_chunk(0, 8).get(), read_chunk.get());
+}
+
 } // namespace starrocks::formats
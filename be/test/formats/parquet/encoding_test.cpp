@@ -16,8 +16,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <limits>
+
 #include "column/binary_column.h"
 #include "column/fixed_length_column.h"
+#include "formats/parquet/encoding_delta.h"
 #include "formats/parquet/encoding_dict.h"
 #include "formats/parquet/encoding_plain.h"
 
@@ -522,4 +526,171 @@ TEST_F(ParquetEncodingTest, Boolean) {
     }
 }
 
+// Test-only encoders, following https://github.com/apache/parquet-format/blob/master/Encodings.md
+static void put_uleb128(std::string* buf, uint64_t v) {
+    while (v >= 0x80) {
+        buf->push_back(static_cast<char>((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    buf->push_back(static_cast<char>(v));
+}
+
+template <typename T>
+static std::string encode_delta_binary_packed(const std::vector<T>& values) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr size_t kBlockSize = 128;
+    constexpr size_t kNumMiniblocks = 4;
+    constexpr size_t kMiniblockSize = kBlockSize / kNumMiniblocks;
+    auto zigzag = [](int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); };
+
+    std::string buf;
+    put_uleb128(&buf, kBlockSize);
+    put_uleb128(&buf, kNumMiniblocks);
+    put_uleb128(&buf, values.size());
+    put_uleb128(&buf, values.empty() ? 0 : zigzag(values[0]));
+    for (size_t start = 1; start < values.size(); start += kBlockSize) {
+        size_t end = std::min(values.size(), start + kBlockSize);
+        std::vector<T> deltas;
+        for (size_t i = start; i < end; ++i) {
+            deltas.push_back(static_cast<T>(static_cast<UnsignedT>(values[i]) - static_cast<UnsignedT>(values[i - 1])));
+        }
+        T min_delta = *std::min_element(deltas.begin(), deltas.end());
+        put_uleb128(&buf, zigzag(min_delta));
+        std::vector<UnsignedT> relative(kBlockSize, 0);
+        for (size_t i = 0; i < deltas.size(); ++i) {
+            relative[i] = static_cast<UnsignedT>(deltas[i]) - static_cast<UnsignedT>(min_delta);
+        }
+        std::vector<int> bit_widths(kNumMiniblocks, 0);
+        for (size_t i = 0; i < deltas.size(); ++i) {
+            int bits = 0;
+            while (bits < static_cast<int>(sizeof(T) * 8) && (relative[i] >> bits) != 0) {
+                ++bits;
+            }
+            bit_widths[i / kMiniblockSize] = std::max(bit_widths[i / kMiniblockSize], bits);
+        }
+        for (int bit_width : bit_widths) {
+            buf.push_back(static_cast<char>(bit_width));
+        }
+        for (size_t m = 0; m * kMiniblockSize < deltas.size(); ++m) {
+            std::string packed(kMiniblockSize * bit_widths[m] / 8, '\0');
+            for (size_t i = 0; i < kMiniblockSize; ++i) {
+                for (int bit = 0; bit < bit_widths[m]; ++bit) {
+                    if ((relative[m * kMiniblockSize + i] >> bit) & 1) {
+                        size_t pos = i * bit_widths[m] + bit;
+                        packed[pos / 8] |= static_cast<char>(1 << (pos % 8));
+                    }
+                }
+            }
+            buf.append(packed);
+        }
+    }
+    return buf;
+}
+
+static std::string encode_delta_length_byte_array(const std::vector<Slice>& values) {
+    std::vector<int32_t> lengths;
+    std::string data;
+    for (const auto& v : values) {
+        lengths.push_back(v.size);
+        data.append(v.data, v.size);
+    }
+    return encode_delta_binary_packed(lengths) + data;
+}
+
+static std::string encode_delta_byte_array(const std::vector<Slice>& values) {
+    std::vector<int32_t> prefix_lengths;
+    std::vector<Slice> suffixes;
+    Slice prev;
+    for (const auto& v : values) {
+        size_t prefix = 0;
+        while (prefix < prev.size && prefix < v.size && prev.data[prefix] == v.data[prefix]) {
+            ++prefix;
+        }
+        prefix_lengths.push_back(prefix);
+        suffixes.emplace_back(v.data + prefix, v.size - prefix);
+        prev = v;
+    }
+    return encode_delta_binary_packed(prefix_lengths) + encode_delta_length_byte_array(suffixes);
+}
+
+template <typename T>
+static std::string encode_byte_stream_split(const std::vector<T>& values) {
+    std::string buf(values.size() * sizeof(T), '\0');
+    const auto* src = reinterpret_cast<const char*>(values.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+        for (size_t b = 0; b < sizeof(T); ++b) {
+            buf[b * values.size() + i] = src[i * sizeof(T) + b];
+        }
+    }
+    return buf;
+}
+
+template <typename T>
+static void check_encoding(tparquet::Type::type type, tparquet::Encoding::type encoding, const std::vector<T>& values,
+                           const std::string& encoded) {
+    const EncodingInfo* enc_info = nullptr;
+    ASSERT_TRUE(EncodingInfo::get(type, encoding, &enc_info).ok());
+    std::unique_ptr<Decoder> decoder;
+    ASSERT_TRUE(enc_info->create_decoder(&decoder).ok());
+    DecoderChecker<T, false>::check(values, Slice(encoded), decoder.get());
+}
+
+TEST_F(ParquetEncodingTest, DeltaBinaryPackedSpecExample) {
+    // example 2 of the spec: 7, 5, 3, 1, 2, 3, 4, 5
+    const uint8_t encoded[] = {0x80, 0x01, 0x04, 0x08, 0x0E, 0x03, 0x02, 0x00, 0x00, 0x00, 0xC0, 0x3F,
+                               0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    std::vector<int32_t> values;
+    size_t num_bytes = 0;
+    auto st = DeltaBinaryPackedDecoder<int32_t>::decode(Slice(encoded, sizeof(encoded)), &values, &num_bytes);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(std::vector<int32_t>({7, 5, 3, 1, 2, 3, 4, 5}), values);
+    ASSERT_EQ(sizeof(encoded), num_bytes);
+
+    // truncated miniblock
+    st = DeltaBinaryPackedDecoder<int32_t>::decode(Slice(encoded, 10), &values, &num_bytes);
+    ASSERT_FALSE(st.ok());
+}
+
+TEST_F(ParquetEncodingTest, DeltaBinaryPacked) {
+    std::vector<int32_t> int32_values;
+    std::vector<int64_t> int64_values;
+    for (int i = 0; i < 1000; i++) {
+        int32_values.push_back(i % 7 == 0 ? std::numeric_limits<int32_t>::min() : i * 3 - 100);
+        int64_values.push_back(i % 11 == 0 ? std::numeric_limits<int64_t>::max() : int64_t(i) * 1000000007L);
+    }
+    check_encoding(tparquet::Type::INT32, tparquet::Encoding::DELTA_BINARY_PACKED, int32_values,
+                   encode_delta_binary_packed(int32_values));
+    check_encoding(tparquet::Type::INT64, tparquet::Encoding::DELTA_BINARY_PACKED, int64_values,
+                   encode_delta_binary_packed(int64_values));
+}
+
+TEST_F(ParquetEncodingTest, DeltaByteArray) {
+    std::vector<std::string> values;
+    for (int i = 0; i < 300; i++) {
+        values.push_back("https://www.starrocks.io/item/" + std::to_string(i / 3) + (i % 3 == 0 ? "" : "/detail"));
+    }
+    std::vector<Slice> slices(values.begin(), values.end());
+    check_encoding(tparquet::Type::BYTE_ARRAY, tparquet::Encoding::DELTA_LENGTH_BYTE_ARRAY, slices,
+                   encode_delta_length_byte_array(slices));
+    check_encoding(tparquet::Type::BYTE_ARRAY, tparquet::Encoding::DELTA_BYTE_ARRAY, slices,
+                   encode_delta_byte_array(slices));
+}
+
+TEST_F(ParquetEncodingTest, ByteStreamSplit) {
+    std::vector<float> float_values;
+    std::vector<double> double_values;
+    std::vector<int64_t> int64_values;
+    for (int i = 0; i < 100; i++) {
+        float_values.push_back(i * 1.5f);
+        double_values.push_back(i * -0.25);
+        int64_values.push_back(int64_t(i) << 40);
+    }
+    check_encoding(tparquet::Type::FLOAT, tparquet::Encoding::BYTE_STREAM_SPLIT, float_values,
+                   encode_byte_stream_split(float_values));
+    check_encoding(tparquet::Type::DOUBLE, tparquet::Encoding::BYTE_STREAM_SPLIT, double_values,
+                   encode_byte_stream_split(double_values));
+    check_encoding(tparquet::Type::INT64, tparquet::Encoding::BYTE_STREAM_SPLIT, int64_values,
+                   encode_byte_stream_split(int64_values));
+}
+
 } // namespace starrocks::parquet
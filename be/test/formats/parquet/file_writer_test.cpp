@@ -26,8 +26,10 @@
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
 #include "common/statusor.h"
+#include "exprs/expr.h"
 #include "formats/parquet/file_reader.h"
 #include "formats/parquet/parquet_test_util/util.h"
+#include "formats/parquet/parquet_ut_base.h"
 #include "fs/fs.h"
 #include "fs/fs_memory.h"
 #include "gutil/casts.h"
@@ -633,6 +635,78 @@ TEST_F(FileWriterTest, TestWriteNestedArray) {
     Utils::assert_equal_chunk(chunk.get(), read_chunk.get());
 }
 
+TEST_F(FileWriterTest, TestReadNestedColumnsLazily) {
+    // type_descs
+    std::vector<TypeDescriptor> type_descs;
+    auto type_int = TypeDescriptor::from_logical_type(TYPE_INT);
+    auto type_varchar = TypeDescriptor::create_varchar_type(64);
+    auto type_varchar_array = TypeDescriptor::from_logical_type(TYPE_ARRAY);
+    type_varchar_array.children.push_back(type_varchar);
+    auto type_varchar_map = TypeDescriptor::from_logical_type(TYPE_MAP);
+    type_varchar_map.children.push_back(type_varchar);
+    type_varchar_map.children.push_back(type_varchar);
+    type_descs.push_back(type_int);
+    type_descs.push_back(type_varchar_array);
+    type_descs.push_back(type_varchar_map);
+
+    // c0: i, c1: ['a{i % 4}', 'b{i % 7}'], c2: {'k{i % 3}': 'v{i % 5}'}, c1 and c2 are NULL if i % 10 == 9
+    auto chunk = std::make_shared<Chunk>();
+    {
+        auto c0 = ColumnHelper::create_column(type_int, true);
+        auto c1 = ColumnHelper::create_column(type_varchar_array, true);
+        auto c2 = ColumnHelper::create_column(type_varchar_map, true);
+        for (int i = 0; i < 1000; i++) {
+            c0->append_datum(Datum(i));
+            if (i % 10 == 9) {
+                c1->append_nulls(1);
+                c2->append_nulls(1);
+                continue;
+            }
+            std::string a = "a" + std::to_string(i % 4);
+            std::string b = "b" + std::to_string(i % 7);
+            std::string k = "k" + std::to_string(i % 3);
+            std::string v = "v" + std::to_string(i % 5);
+            c1->append_datum(Datum(DatumArray{Datum(Slice(a)), Datum(Slice(b))}));
+            c2->append_datum(Datum(DatumMap{{Slice(k), Datum(Slice(v))}}));
+        }
+        chunk->append_column(c0, chunk->num_columns());
+        chunk->append_column(c1, chunk->num_columns());
+        chunk->append_column(c2, chunk->num_columns());
+    }
+
+    // write chunk
+    auto schema = _make_schema(type_descs);
+    ASSERT_TRUE(schema != nullptr);
+    ASSERT_OK(_write_chunk(chunk, type_descs, schema));
+
+    // read chunk with the predicate c0 = 42, c1 and c2 are read as lazy columns
+    auto ctx = _create_scan_context(type_descs);
+    std::vector<TExpr> t_conjuncts;
+    ParquetUTBase::append_int_conjunct(TExprOpcode::EQ, 0, 42, &t_conjuncts);
+    auto& conjunct_ctxs = ctx->conjunct_ctxs_by_slot[0];
+    ASSERT_OK(Expr::create_expr_trees(&_pool, t_conjuncts, &conjunct_ctxs, nullptr));
+    ASSERT_OK(Expr::prepare(conjunct_ctxs, _runtime_state));
+    ASSERT_OK(Expr::open(conjunct_ctxs, _runtime_state));
+
+    ASSIGN_OR_ABORT(auto file, _fs.new_random_access_file(_file_path));
+    ASSIGN_OR_ABORT(auto file_size, _fs.get_file_size(_file_path));
+    auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), file_size);
+    ASSERT_OK(file_reader->init(ctx));
+
+    auto read_chunk = chunk->clone_empty();
+    Status status;
+    while (status.ok()) {
+        ChunkPtr tmp_chunk = chunk->clone_empty();
+        status = file_reader->get_next(&tmp_chunk);
+        ASSERT_TRUE(status.ok() || status.is_end_of_file()) << status;
+        read_chunk->append(*tmp_chunk);
+    }
+
+    auto expected_chunk = chunk->clone_empty();
+    expected_chunk->append(*chunk, 42, 1);
+    Utils::assert_equal_chunk(expected_chunk.get(), read_chunk.get());
+}
+
 TEST_F(FileWriterTest, TestWriteVarbinary) {
     auto type_varbinary = TypeDescriptor::from_logical_type(TYPE_VARBINARY);
     std::vector<TypeDescriptor> type_descs{type_varbinary};
@@ -31,6 +31,7 @@
 #include "fs/fs.h"
 #include "fs/fs_memory.h"
 #include "testutil/assert.h"
+#include "util/threadpool.h"
 
 namespace starrocks::formats {
 
@@ -980,6 +981,104 @@ TEST_F(ParquetFileWriterTest, TestWriteVarbinary) {
     parquet::Utils::assert_equal_chunk(chunk.get(), read_chunk.get());
 }
 
+TEST_F(ParquetFileWriterTest, TestWriteInParallel) {
+    std::vector<TypeDescriptor> type_descs;
+    auto type_int_struct = TypeDescriptor::from_logical_type(TYPE_STRUCT);
+    type_int_struct.children = {TypeDescriptor::from_logical_type(TYPE_INT),
+                                TypeDescriptor::from_logical_type(TYPE_BIGINT)};
+    type_int_struct.field_names = {"a", "b"};
+    type_descs.push_back(type_int_struct);
+    type_descs.push_back(TypeDescriptor::from_logical_type(TYPE_VARCHAR));
+    type_descs.push_back(TypeDescriptor::from_logical_type(TYPE_INT));
+
+    std::unique_ptr<ThreadPool> encode_pool;
+    ASSERT_OK(ThreadPoolBuilder("parquet_encode").set_max_threads(2).build(&encode_pool));
+
+    auto column_names = _make_type_names(type_descs);
+    auto output_file = _fs.new_writable_file(_file_path).value();
+    auto output_stream = std::make_unique<parquet::ParquetOutputStream>(std::move(output_file));
+    auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+    auto writer_options = std::make_shared<formats::ParquetWriterOptions>();
+    writer_options->encode_pool = encode_pool.get();
+    auto writer = std::make_unique<formats::ParquetFileWriter>(
+            _file_path, std::move(output_stream), column_names, type_descs, std::move(column_evaluators),
+            TCompressionType::NO_COMPRESSION, writer_options, []() {});
+    ASSERT_OK(writer->init());
+
+    auto chunk = std::make_shared<Chunk>();
+    {
+        const int num_rows = 1000;
+        auto data_col_a = Int32Column::create();
+        auto data_col_b = Int64Column::create();
+        auto varchar_col = BinaryColumn::create();
+        auto int_col = Int32Column::create();
+        for (int i = 0; i < num_rows; i++) {
+            data_col_a->append(i);
+            data_col_b->append(-i);
+            varchar_col->append(std::to_string(i * 7));
+            int_col->append(i * 3);
+        }
+        Columns fields{NullableColumn::create(data_col_a, UInt8Column::create(num_rows, 0)),
+                       NullableColumn::create(data_col_b, UInt8Column::create(num_rows, 0))};
+        auto struct_column = StructColumn::create(fields, type_int_struct.field_names);
+        chunk->append_column(NullableColumn::create(struct_column, UInt8Column::create(num_rows, 0)), 0);
+        chunk->append_column(NullableColumn::create(varchar_col, UInt8Column::create(num_rows, 0)), 1);
+        chunk->append_column(NullableColumn::create(int_col, UInt8Column::create(num_rows, 0)), 2);
+    }
+
+    ASSERT_OK(writer->write(chunk.get()));
+    auto result = writer->commit();
+
+    ASSERT_TRUE(result.io_status.ok());
+    ASSERT_EQ(result.file_statistics.record_count, 1000);
+
+    auto read_chunk = _read_chunk(type_descs);
+    ASSERT_TRUE(read_chunk != nullptr);
+    ASSERT_EQ(read_chunk->num_rows(), 1000);
+    parquet::Utils::assert_equal_chunk(chunk.get(), read_chunk.get());
+}
+
+TEST_F(ParquetFileWriterTest, TestWriteSorted) {
+    auto type_int = TypeDescriptor::from_logical_type(TYPE_INT);
+    auto type_varchar = TypeDescriptor::from_logical_type(TYPE_VARCHAR);
+    std::vector<TypeDescriptor> type_descs{type_varchar, type_int};
+
+    auto column_names = _make_type_names(type_descs);
+    auto output_file = _fs.new_writable_file(_file_path).value();
+    auto output_stream = std::make_unique<parquet::ParquetOutputStream>(std::move(output_file));
+    auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+    auto writer_options = std::make_shared<formats::ParquetWriterOptions>();
+    writer_options->sort_columns = {formats::ParquetSortColumn{.column_index = 1, .is_asc = false}};
+    auto writer = std::make_unique<formats::ParquetFileWriter>(
+            _file_path, std::move(output_stream), column_names, type_descs, std::move(column_evaluators),
+            TCompressionType::NO_COMPRESSION, writer_options, []() {});
+    ASSERT_OK(writer->init());
+
+    auto make_chunk = [](const std::vector<int32_t>& values) {
+        auto chunk = std::make_shared<Chunk>();
+        auto varchar_col = BinaryColumn::create();
+        auto int_col = Int32Column::create();
+        for (auto v : values) {
+            varchar_col->append(std::to_string(v));
+            int_col->append(v);
+        }
+        chunk->append_column(NullableColumn::create(varchar_col, UInt8Column::create(values.size(), 0)), 0);
+        chunk->append_column(NullableColumn::create(int_col, UInt8Column::create(values.size(), 0)), 1);
+        return chunk;
+    };
+    ASSERT_OK(writer->write(make_chunk({3, 7, 1}).get()));
+    ASSERT_OK(writer->write(make_chunk({5, 2, 8}).get()));
+    auto result = writer->commit();
+
+    ASSERT_TRUE(result.io_status.ok());
+    ASSERT_EQ(result.file_statistics.record_count, 6);
+
+    auto read_chunk = _read_chunk(type_descs);
+    ASSERT_TRUE(read_chunk != nullptr);
+    ASSERT_EQ(read_chunk->num_rows(), 6);
+    parquet::Utils::assert_equal_chunk(make_chunk({8, 7, 5, 3, 2, 1}).get(), read_chunk.get());
+}
+
 TEST_F(ParquetFileWriterTest, TestAllocatedBytes) {
     auto type_varbinary = TypeDescriptor::from_logical_type(TYPE_VARBINARY);
     std::vector<TypeDescriptor> type_descs{type_varbinary};
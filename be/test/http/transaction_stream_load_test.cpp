@@ -28,6 +28,7 @@
 #include "runtime/stream_load/load_stream_mgr.h"
 #include "runtime/stream_load/stream_load_executor.h"
 #include "runtime/stream_load/transaction_mgr.h"
+#include "testutil/assert.h"
 #include "testutil/sync_point.h"
 #include "util/brpc_stub_cache.h"
 #include "util/cpu_info.h"
@@ -832,4 +833,51 @@ TEST_F(TransactionStreamLoadActionTest, huge_malloc) {
     evbuffer_free(evb);
 }
 
+
+TEST_F(TransactionStreamLoadActionTest, txn_batch_put) {
+    TransactionStreamLoadAction action(&_env);
+    auto ctx = new StreamLoadContext(&_env);
+    ctx->ref();
+    auto pipe = std::make_shared<StreamLoadPipe>();
+    ctx->body_sink = pipe;
+    ctx->format = TFileFormatType::FORMAT_CSV_PLAIN;
+    (_env._stream_context_mgr)->put("123", ctx);
+
+    struct evhttp_request ev_req;
+    ev_req.remote_host = nullptr;
+    auto evb = evbuffer_new();
+    ev_req.input_buffer = evb;
+    std::string content = "1|a\n";
+
+    auto put = [&]() {
+        HttpRequest request(_evhttp_req);
+        request._ev_req = &ev_req;
+        request._headers.emplace(HTTP_LABEL_KEY, "123");
+        evbuffer_add(evb, content.data(), content.size());
+        action.on_chunk_data(&request);
+        ctx->lock.lock();
+        action.handle(&request);
+        ASSERT_TRUE(ctx->status.ok());
+    };
+
+    // The small requests are batched in the buffer of the context.
+    put();
+    put();
+    ASSERT_TRUE(pipe->exhausted());
+    ASSERT_EQ(2 * content.size(), ctx->buffer->pos);
+
+    config::enable_transaction_stream_load_batch_put = false;
+    put();
+    config::enable_transaction_stream_load_batch_put = true;
+    ASSERT_FALSE(pipe->exhausted());
+    ASSERT_EQ(nullptr, ctx->buffer);
+    ASSIGN_OR_ABORT(auto buf, pipe->read());
+    ASSERT_EQ(3 * content.size(), buf->remaining());
+
+    if (ctx->unref()) {
+        delete ctx;
+    }
+    evbuffer_free(evb);
+}
+
 } // namespace starrocks
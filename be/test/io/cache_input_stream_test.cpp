@@ -17,8 +17,11 @@
 #include <gtest/gtest.h>
 
 #include "block_cache/block_cache.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
+#include "util/priority_thread_pool.hpp"
 
 namespace starrocks::io {
 
@@ -476,4 +479,99 @@ TEST_F(CacheInputStreamTest, test_peek) {
     }
 }
 
+TEST_F(CacheInputStreamTest, test_peek_block_buffer) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+
+    const int64_t block_count = 2;
+    int64_t data_size = block_size * block_count;
+    char data[data_size + 1];
+    gen_test_data(data, data_size, block_size);
+
+    const std::string file_name = "test_file7";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data, data_size));
+
+    // populate the cache
+    {
+        std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+                new io::SharedBufferedInputStream(stream, file_name, data_size));
+        io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+        cache_stream.set_enable_populate_cache(true);
+        char buffer[data_size];
+        read_stream_data(&cache_stream, 0, data_size, buffer);
+        ASSERT_EQ(cache_stream.stats().write_cache_count, block_count);
+    }
+
+    // peek from the cached block without copying it
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+    cache_stream.set_enable_block_buffer(true);
+    auto& stats = cache_stream.stats();
+
+    ASSERT_OK(cache_stream.seek(1024));
+    ASSIGN_OR_ABORT(auto view, cache_stream.peek(1024));
+    ASSERT_EQ(1024, view.size());
+    ASSERT_TRUE(check_data_content((char*)view.data(), view.size(), 'a'));
+    ASSERT_EQ(stats.read_cache_count, 1);
+    ASSERT_EQ(stats.read_block_buffer_count, 1);
+
+    ASSERT_OK(cache_stream.seek(block_size + 1024));
+    ASSIGN_OR_ABORT(view, cache_stream.peek(1024));
+    ASSERT_TRUE(check_data_content((char*)view.data(), view.size(), 'b'));
+    ASSERT_EQ(stats.read_cache_count, 2);
+
+    // the range across two blocks can not be served without copying
+    ASSERT_OK(cache_stream.seek(block_size - 10));
+    ASSERT_FALSE(cache_stream.peek(1024).ok());
+}
+
+TEST_F(CacheInputStreamTest, test_sequential_readahead) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+
+    const int64_t block_count = 8;
+    int64_t data_size = block_size * block_count;
+    char data[data_size + 1];
+    gen_test_data(data, data_size, block_size);
+
+    const int64_t old_window = config::datacache_readahead_window_bytes;
+    config::datacache_readahead_window_bytes = 4 * block_size;
+    DeferOp defer([&]() { config::datacache_readahead_window_bytes = old_window; });
+
+    const std::string file_name = "test_file8";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data, data_size));
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+    cache_stream.set_enable_populate_cache(true);
+    PriorityThreadPool executor("readahead", 1, 10);
+    std::atomic<int64_t> inflight_bytes = 0;
+    cache_stream.set_readahead(&executor, &inflight_bytes, 64 * block_size);
+    auto& stats = cache_stream.stats();
+
+    // the third sequential read triggers reading ahead blocks [3, 7)
+    char buffer[block_size];
+    for (int i = 0; i < 3; ++i) {
+        read_stream_data(&cache_stream, i * block_size, block_size, buffer);
+        ASSERT_TRUE(check_data_content(buffer, block_size, 'a' + i));
+    }
+    ASSERT_EQ(stats.read_cache_count, 0);
+
+    // the block read ahead is served by the cache
+    read_stream_data(&cache_stream, 3 * block_size, block_size, buffer);
+    ASSERT_TRUE(check_data_content(buffer, block_size, 'd'));
+    ASSERT_EQ(stats.readahead_count, 1);
+    ASSERT_EQ(stats.readahead_bytes, 4 * block_size);
+    ASSERT_EQ(stats.read_cache_count, 1);
+    ASSERT_EQ(inflight_bytes.load(), 0);
+
+    // a random read resets the sequential pattern and doesn't read ahead
+    read_stream_data(&cache_stream, 0, 1024, buffer);
+    ASSERT_TRUE(check_data_content(buffer, 1024, 'a'));
+    read_stream_data(&cache_stream, 7 * block_size, block_size, buffer);
+    ASSERT_TRUE(check_data_content(buffer, block_size, 'h'));
+    ASSERT_EQ(stats.readahead_count, 1);
+}
+
 } // namespace starrocks::io
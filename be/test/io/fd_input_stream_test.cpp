@@ -20,6 +20,7 @@
 #include <sys/types.h>
 
 #include <cstdlib>
+#include <vector>
 
 #include "common/logging.h"
 #include "testutil/assert.h"
@@ -117,6 +118,31 @@ PARALLEL_TEST(FdInputStreamTest, test_read_at) {
     ASSERT_EQ(0, in.get_errno());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(FdInputStreamTest, test_read_at_fully_batch) {
+    int fd = open_temp_file();
+    pwrite_or_die(fd, "0123456789", 10, 0);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+
+    char a[3];
+    char b[2];
+    char c[4];
+    char d[1];
+    // contiguous ranges [5, 7) and [7, 9) given out of order, plus separate ranges
+    std::vector<SeekableInputStream::ReadRequest> requests{
+            {7, c, 2}, {0, a, 3}, {5, b, 2}, {9, d, 1}, {3, c + 2, 2}};
+    ASSERT_OK(in.read_at_fully_batch(requests));
+    ASSERT_EQ("012", std::string_view(a, 3));
+    ASSERT_EQ("56", std::string_view(b, 2));
+    ASSERT_EQ("7834", std::string_view(c, 4));
+    ASSERT_EQ("9", std::string_view(d, 1));
+
+    std::vector<SeekableInputStream::ReadRequest> eof_requests{{8, c, 4}};
+    ASSERT_ERROR(in.read_at_fully_batch(eof_requests));
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(FdInputStreamTest, test_seek) {
     int fd = open_temp_file();
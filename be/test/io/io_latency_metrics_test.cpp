@@ -0,0 +1,103 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/io_latency_metrics.h"
+
+#include <gtest/gtest.h>
+
+#include "util/metrics.h"
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+TEST(IOLatencyMetricsTest, test_buckets) {
+    for (int64_t v = 0; v < 16; v++) {
+        ASSERT_EQ(v, LatencyHistogram::bucket_of(v));
+        ASSERT_EQ(v, LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_of(v)));
+    }
+    ASSERT_EQ(0, LatencyHistogram::bucket_of(-1));
+    for (int64_t v : {100L, 1000L, 123456L, 987654321L, 1L << 40}) {
+        int64_t upper = LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_of(v));
+        ASSERT_GE(upper, v);
+        // The relative error is at most 1/8.
+        ASSERT_LE(upper - v, v / 8);
+        ASSERT_EQ(LatencyHistogram::bucket_of(v), LatencyHistogram::bucket_of(upper));
+        ASSERT_EQ(LatencyHistogram::bucket_of(v) + 1, LatencyHistogram::bucket_of(upper + 1));
+    }
+    ASSERT_EQ(LatencyHistogram::kNumBuckets - 1, LatencyHistogram::bucket_of(std::numeric_limits<int64_t>::max()));
+}
+
+TEST(IOLatencyMetricsTest, test_percentile) {
+    LatencyHistogram histogram;
+    LatencyHistogram::Snapshot snapshot;
+    histogram.snapshot(&snapshot);
+    ASSERT_EQ(0, LatencyHistogram::count(snapshot));
+    ASSERT_EQ(0, LatencyHistogram::percentile(snapshot, 99));
+
+    // 990 reads of 1us and 10 reads of 1ms.
+    for (int i = 0; i < 990; i++) {
+        histogram.record(1000);
+    }
+    for (int i = 0; i < 10; i++) {
+        histogram.record(1000000);
+    }
+    histogram.snapshot(&snapshot);
+    ASSERT_EQ(1000, LatencyHistogram::count(snapshot));
+    ASSERT_EQ(990 * 1000 + 10 * 1000000, histogram.sum_ns());
+
+    int64_t p50 = LatencyHistogram::percentile(snapshot, 50);
+    ASSERT_GE(p50, 1000);
+    ASSERT_LE(p50, 1000 + 1000 / 8);
+    int64_t p99 = LatencyHistogram::percentile(snapshot, 99);
+    ASSERT_EQ(p50, p99);
+    int64_t p999 = LatencyHistogram::percentile(snapshot, 99.9);
+    ASSERT_GE(p999, 1000000);
+    ASSERT_LE(p999, 1000000 + 1000000 / 8);
+    ASSERT_EQ(p999, LatencyHistogram::percentile(snapshot, 100));
+}
+
+TEST(IOLatencyMetricsTest, test_context) {
+    IOLatencyHistograms query_histograms;
+    LatencyHistogram::Snapshot snapshot;
+    IOLatencyMetrics::record(IOSource::LOCAL_DISK, 1000);
+    query_histograms.get(IOSource::LOCAL_DISK).snapshot(&snapshot);
+    ASSERT_EQ(0, LatencyHistogram::count(snapshot));
+
+    auto* workgroup_histograms = IOLatencyMetrics::instance()->workgroup_histograms(12345);
+    ASSERT_EQ(workgroup_histograms, IOLatencyMetrics::instance()->workgroup_histograms(12345));
+    {
+        ScopedIOLatencyContext context(&query_histograms, 12345);
+        IOLatencyMetrics::record(IOSource::REMOTE_STORAGE, 2000);
+        {
+            ScopedIOLatencyContext inner_context(nullptr, -1);
+            IOLatencyMetrics::record(IOSource::REMOTE_STORAGE, 3000);
+        }
+        IOLatencyMetrics::record(IOSource::REMOTE_STORAGE, 4000);
+    }
+    IOLatencyMetrics::record(IOSource::REMOTE_STORAGE, 5000);
+
+    query_histograms.get(IOSource::REMOTE_STORAGE).snapshot(&snapshot);
+    ASSERT_EQ(2, LatencyHistogram::count(snapshot));
+    ASSERT_EQ(6000, query_histograms.get(IOSource::REMOTE_STORAGE).sum_ns());
+    ASSERT_EQ(6000, workgroup_histograms->get(IOSource::REMOTE_STORAGE).sum_ns());
+    ASSERT_GE(IOLatencyMetrics::instance()->process_histograms().get(IOSource::REMOTE_STORAGE).sum_ns(), 14000);
+
+    StarRocksMetrics::instance()->metrics()->trigger_hook();
+    auto* p50 = StarRocksMetrics::instance()->metrics()->get_metric(
+            "io_latency_p50_us", MetricLabels().add("source", "remote_storage").add("workgroup_id", "12345"));
+    ASSERT_NE(nullptr, p50);
+    ASSERT_EQ("2", p50->to_string());
+}
+
+} // namespace starrocks
@@ -154,6 +154,31 @@ TEST_F(S3OutputStreamTest, test_multipart_upload) {
     delete_object(kObjectName);
 }
 
+TEST_F(S3OutputStreamTest, test_async_multipart_upload) {
+    const char* kObjectName = "test_async_multipart_upload";
+    delete_object(kObjectName);
+    const int64_t part_size = 5 * 1024 * 1024;
+    S3OutputStream os(g_s3client, kBucketName, kObjectName, 12, part_size, /*max_inflight_parts=*/2);
+    S3InputStream is(g_s3client, kBucketName, kObjectName, part_size);
+
+    std::string data;
+    for (int i = 0; i < 4; i++) {
+        std::string part(part_size, 'a' + i);
+        ASSERT_OK(os.write(part.data(), part.size()));
+        data.append(part);
+    }
+    std::string tail("tail of async multipart upload\n");
+    ASSERT_OK(os.write(tail.data(), tail.size()));
+    data.append(tail);
+    ASSERT_OK(os.close());
+
+    std::string buff(data.size(), 0);
+    ASSERT_OK(is.read_fully(buff.data(), buff.size()));
+    ASSERT_EQ(data, buff);
+
+    delete_object(kObjectName);
+}
+
 TEST_F(S3OutputStreamTest, test_skip) {
     char buff[32];
     const char* kObjectName = "test_multipart_upload";
@@ -19,6 +19,7 @@
 #include "io_test_base.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "util/priority_thread_pool.hpp"
 
 namespace starrocks::io {
 
@@ -179,4 +180,96 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_cost_model) {
+    IOCostModel model;
+    ASSERT_EQ(1024, model.break_even_distance(1024));
+    // 2ms first-byte latency and 100MB/s bandwidth, the break-even distance is 200KB.
+    for (int i = 0; i < 100; i++) {
+        int64_t bytes = (i % 10 + 1) * 64 * 1024;
+        int64_t time_ns = 2000000 + bytes * 10;
+        model.update(bytes, time_ns);
+    }
+    int64_t dist = model.break_even_distance(1024);
+    ASSERT_GT(dist, 190 * 1000);
+    ASSERT_LT(dist, 210 * 1000);
+
+    // samples of the same size can not tell latency from bandwidth.
+    IOCostModel same_size;
+    for (int i = 0; i < 100; i++) {
+        same_size.update(64 * 1024, 3000000);
+    }
+    ASSERT_EQ(1024, same_size.break_even_distance(1024));
+}
+
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_adaptive_distance) {
+    size_t len = 1 * 1024 * 1024;
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    IOCostModel model;
+    // break-even distance is 10KB.
+    for (int i = 0; i < 100; i++) {
+        int64_t bytes = (i % 10 + 1) * 4096;
+        model.update(bytes, 10240 + bytes);
+    }
+
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    ranges.emplace_back(0, 1024);
+    ranges.emplace_back(1024 + 8 * 1024, 1024);
+    ranges.emplace_back(2 * 1024 + 8 * 1024 + 100 * 1024, 1024);
+    {
+        // the default max distance(1MB) merges all the ranges.
+        auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+        ASSERT_OK(sb_stream->set_io_ranges(ranges));
+        ASSIGN_OR_ABORT(auto sb, sb_stream->find_shared_buffer(0, 1024));
+        ASSERT_EQ(3, sb->ref_count);
+    }
+    {
+        auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+        sb_stream->set_cost_model(&model);
+        ASSERT_OK(sb_stream->set_io_ranges(ranges));
+        ASSIGN_OR_ABORT(auto sb, sb_stream->find_shared_buffer(0, 1024));
+        ASSERT_EQ(2, sb->ref_count);
+        ASSIGN_OR_ABORT(auto sb2, sb_stream->find_shared_buffer(ranges[2].offset, 1024));
+        ASSERT_EQ(1, sb2->ref_count);
+
+        std::string buf(1024, 0);
+        ASSERT_OK(sb_stream->read_at_fully(ranges[2].offset, buf.data(), 1024));
+        ASSERT_EQ(rand_string.substr(ranges[2].offset, 1024), buf);
+    }
+}
+
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_prefetch) {
+    size_t len = 1 * 1024 * 1024;
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    PriorityThreadPool executor("prefetch", 2, 16);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    sb_stream->set_prefetch_executor(&executor);
+    io::SharedBufferedInputStream::CoalesceOptions options = {.max_dist_size = 1024, .max_buffer_size = 64 * 1024};
+    sb_stream->set_coalesce_options(options);
+
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    for (int i = 0; i < 8; i++) {
+        ranges.emplace_back(i * 100 * 1024, 10 * 1024);
+    }
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+    // prefetch the last 4 ranges.
+    sb_stream->prefetch(400 * 1024, 400 * 1024);
+    ASSERT_EQ(4, sb_stream->prefetch_io_count());
+
+    std::string buf(10 * 1024, 0);
+    for (const auto& r : ranges) {
+        ASSERT_OK(sb_stream->read_at_fully(r.offset, buf.data(), r.size));
+        ASSERT_EQ(rand_string.substr(r.offset, r.size), buf);
+    }
+    ASSERT_EQ(8, sb_stream->shared_io_count());
+    ASSERT_EQ(0, sb_stream->direct_io_count());
+
+    // release waits for the prefetch tasks in flight.
+    sb_stream->release();
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+    sb_stream->prefetch(0, len);
+    sb_stream->release();
+}
+
 } // namespace starrocks::io
\ No newline at end of file
@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "exec/spill/global_spill_arbiter.h"
+
+#include <gtest/gtest.h>
+
+#include "exec/spill/query_spill_manager.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks::spill {
+
+TEST(GlobalSpillArbiterTest, test_arbitrate) {
+    TUniqueId uid;
+    QuerySpillManager q1(uid);
+    QuerySpillManager q2(uid);
+    QuerySpillManager q3(uid);
+    QuerySpillManager q4(uid);
+    q1.set_spill_priority(10);
+    q1.update_revocable_bytes(100);
+    q2.set_spill_priority(1);
+    q2.update_revocable_bytes(30);
+    q3.set_spill_priority(1);
+    q3.update_revocable_bytes(40);
+    // Nothing to spill.
+    q4.update_revocable_bytes(0);
+
+    auto* arbiter = GlobalSpillArbiter::instance();
+    MemTracker process_mem_tracker(1000, "process");
+    process_mem_tracker.consume(800);
+    ASSERT_EQ(0, arbiter->arbitrate(&process_mem_tracker));
+
+    // 50 bytes above the threshold, the queries of the lower priority spill first, the larger one first.
+    process_mem_tracker.consume(150);
+    ASSERT_EQ(2, arbiter->arbitrate(&process_mem_tracker));
+    ASSERT_FALSE(q1.spill_requested());
+    ASSERT_TRUE(q2.spill_requested());
+    ASSERT_TRUE(q3.spill_requested());
+    ASSERT_FALSE(q4.spill_requested());
+
+    // Still under pressure, ask the next one.
+    ASSERT_EQ(1, arbiter->arbitrate(&process_mem_tracker));
+    ASSERT_TRUE(q1.spill_requested());
+    ASSERT_FALSE(q4.spill_requested());
+    ASSERT_EQ(0, arbiter->arbitrate(&process_mem_tracker));
+
+    process_mem_tracker.release(950);
+}
+
+} // namespace starrocks::spill
@@ -20,6 +20,7 @@
 #include <future>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -273,7 +274,7 @@ struct SpillerCaller {
     template <class TaskExecutor, class MemGuard>
     Status flush(RuntimeState* state, MemGuard&& guard) {
         auto writer = _spiller->_writer->as<Writer>();
-        return writer->template flush<TaskExecutor>(state, std::forward<MemGuard>(guard));
+        return writer->template flush<TaskExecutor>(state, true, std::forward<MemGuard>(guard));
     }
 
     template <class TaskExecutor, class MemGuard>
@@ -515,6 +516,73 @@ TEST_F(SpillTest, order_by_process) {
     }
 }
 
+TEST_F(SpillTest, order_by_process_with_retained_mem_table) {
+    ObjectPool pool;
+    TExprBuilder order_by_slots_builder;
+    order_by_slots_builder << TYPE_INT;
+    auto order_by_slots = order_by_slots_builder.get_res();
+    std::vector<bool> nullables = {false, false};
+    TExprBuilder tuple_slots_builder;
+    tuple_slots_builder << TYPE_INT << TYPE_SMALLINT;
+    auto tuple_slots = tuple_slots_builder.get_res();
+
+    auto ctx_st = no_partition_context(&pool, &dummy_rt_st, order_by_slots, tuple_slots);
+    ASSERT_OK(ctx_st.status());
+    auto ctx = ctx_st.value();
+    auto& tuple = ctx->sort_exprs.sort_tuple_slot_expr_ctxs();
+
+    RandomChunkBuilder chunk_builder;
+    auto factory = spill::make_spilled_factory();
+
+    SpilledOptions spill_options(&ctx->sort_exprs, &ctx->sort_descs);
+    spill_options.mem_table_pool_size = 2;
+    spill_options.spill_mem_table_bytes_size = 1 * 1024 * 1024;
+    spill_options.spill_type = spill::SpillFormaterType::SPILL_BY_COLUMN;
+    spill_options.block_manager = dummy_block_mgr.get();
+    spill_options.retain_final_mem_table = true;
+
+    auto spiller = factory->create(spill_options);
+    spiller->set_metrics(metrics);
+    SpillerCaller<spill::RawSpillerWriter*, spill::SpillerReader*> caller(spiller.get());
+    ASSERT_OK(spiller->prepare(&dummy_rt_st));
+
+    size_t contain_rows = 0;
+    for (size_t i = 0; i < 100; ++i) {
+        auto chunk = chunk_builder.gen(tuple, nullables);
+        ASSERT_OK(caller.spill<SyncExecutor>(&dummy_rt_st, chunk, EmptyMemGuard{}));
+        ASSERT_OK(spiller->_spilled_task_status);
+        contain_rows += chunk->num_rows();
+    }
+    ASSERT_OK(caller.flush<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+    // the last mem table is not spilled
+    auto* writer = spiller->writer()->as<spill::RawSpillerWriter*>();
+    ASSERT_TRUE(writer->mem_table() != nullptr && writer->mem_table()->is_done());
+    ASSERT_GT(writer->mem_table()->num_rows(), 0);
+    ASSERT_LT(writer->block_group_num_rows(), contain_rows);
+
+    size_t restored_rows = 0;
+    std::optional<int32_t> last;
+    ASSERT_OK(caller.trigger_restore<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{}));
+    while (true) {
+        auto chunk_st = caller.restore<SyncExecutor>(&dummy_rt_st, EmptyMemGuard{});
+        if (chunk_st.status().is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(chunk_st.status());
+        auto& chunk = chunk_st.value();
+        if (chunk == nullptr) {
+            continue;
+        }
+        for (size_t i = 0; i < chunk->num_rows(); ++i) {
+            int32_t value = chunk->get_column_by_index(0)->get(i).get_int32();
+            ASSERT_TRUE(!last.has_value() || last.value() <= value);
+            last = value;
+        }
+        restored_rows += chunk->num_rows();
+    }
+    ASSERT_EQ(contain_rows, restored_rows);
+}
+
 TEST_F(SpillTest, partition_process) {
     ObjectPool pool;
 
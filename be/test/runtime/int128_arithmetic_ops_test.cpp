@@ -39,6 +39,7 @@
 #include <string>
 
 #include "runtime/int128_arithmetics_x86_64.h"
+#include "runtime/integer_overflow_arithmetics.h"
 #include "util/logging.h"
 
 typedef __int128 int128_t;
@@ -198,4 +199,58 @@ TEST_F(Int128ArithmeticOpsTest, test_i64xi64_produce_i128) {
 }
 
 #endif // defined(__X86_64__) && defined(__GNUC__)
+
+TEST_F(Int128ArithmeticOpsTest, testAddSubOverflowBatch) {
+    constexpr int128_t int128_max = get_max<int128_t>();
+    constexpr int128_t int128_min = get_min<int128_t>();
+    std::vector<int128_t> values = {0, 1, -1, int128_max, int128_min, int128_max - 1, int128_min + 1,
+                                    static_cast<int128_t>(1) << 126, -(static_cast<int128_t>(1) << 126)};
+    std::vector<int128_t> lhs;
+    std::vector<int128_t> rhs;
+    for (auto x : values) {
+        for (auto y : values) {
+            lhs.emplace_back(x);
+            rhs.emplace_back(y);
+        }
+    }
+    const size_t n = lhs.size();
+    std::vector<int128_t> result(n);
+    std::vector<uint8_t> overflows(n, 0);
+    bool any_overflow = int128_add_sub_overflow_batch<false, false, false>(lhs.data(), rhs.data(), result.data(),
+                                                                           overflows.data(), n);
+    ASSERT_TRUE(any_overflow);
+    for (size_t i = 0; i < n; i++) {
+        int128_t expected;
+        ASSERT_EQ(int128_add_overflow(lhs[i], rhs[i], &expected), overflows[i]);
+        ASSERT_EQ(expected, result[i]);
+    }
+
+    std::fill(overflows.begin(), overflows.end(), 0);
+    any_overflow = int128_add_sub_overflow_batch<true, false, true>(lhs.data(), rhs.data() + 3, result.data(),
+                                                                    overflows.data(), n);
+    ASSERT_TRUE(any_overflow);
+    for (size_t i = 0; i < n; i++) {
+        int128_t expected;
+        ASSERT_EQ(int128_sub_overflow(lhs[i], rhs[3], &expected), overflows[i]);
+        ASSERT_EQ(expected, result[i]);
+    }
+
+    std::fill(overflows.begin(), overflows.end(), 0);
+    ASSERT_FALSE((int128_add_sub_overflow_batch<false, false, true>(values.data(), values.data(), result.data(),
+                                                                    overflows.data(), 3)));
+    ASSERT_EQ(std::vector<uint8_t>(n, 0), overflows);
+}
+
+TEST_F(Int128ArithmeticOpsTest, testMulNeverOverflow) {
+    std::vector<int128_t> values = {3, -7, 5};
+    ASSERT_TRUE(int128_max_abs(values.data(), values.size()) == 7);
+    values.emplace_back(get_min<int128_t>());
+    ASSERT_TRUE(int128_max_abs(values.data(), values.size()) == static_cast<uint128_t>(1) << 127);
+
+    ASSERT_TRUE(int128_mul_never_overflow(0, static_cast<uint128_t>(1) << 127));
+    ASSERT_TRUE(int128_mul_never_overflow(static_cast<uint128_t>(1) << 63, static_cast<uint128_t>(1) << 63));
+    ASSERT_TRUE(int128_mul_never_overflow(1, get_max<int128_t>()));
+    ASSERT_FALSE(int128_mul_never_overflow(2, static_cast<uint128_t>(1) << 126));
+    ASSERT_FALSE(int128_mul_never_overflow(1, static_cast<uint128_t>(1) << 127));
+}
 } // namespace starrocks
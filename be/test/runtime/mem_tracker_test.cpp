@@ -16,6 +16,11 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+
 namespace starrocks {
 
 class MemTrackerTest : public testing::Test {
@@ -137,4 +142,41 @@ TEST_F(MemTrackerTest, release_without_root) {
     ASSERT_EQ(_process_mem_tracker->consumption(), 10);
 }
 
+TEST_F(MemTrackerTest, core_local_consumption) {
+    const int64_t prev_batch_bytes = config::mem_tracker_core_local_batch_bytes;
+    config::mem_tracker_core_local_batch_bytes = 1024;
+    auto process = std::make_unique<MemTracker>(MemTracker::PROCESS, 1000000, "process");
+    auto query = std::make_unique<MemTracker>(-1, "query", process.get());
+    config::mem_tracker_core_local_batch_bytes = prev_batch_bytes;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < 1000; j++) {
+                query->consume(100);
+                query->release(30);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(280000, query->consumption());
+    ASSERT_EQ(280000, process->consumption());
+    ASSERT_FALSE(process->limit_exceeded());
+    ASSERT_TRUE(process->limit_exceeded_precheck(720001));
+
+    // The limit is checked precisely when the consumption is close to it.
+    ASSERT_EQ(process.get(), query->try_consume(720001));
+    ASSERT_EQ(280000, process->consumption());
+    ASSERT_EQ(nullptr, query->try_consume(720000));
+    ASSERT_EQ(1000000, process->consumption());
+    ASSERT_FALSE(process->limit_exceeded());
+    query->consume(1);
+    ASSERT_TRUE(process->limit_exceeded());
+
+    query->release(query->consumption());
+    ASSERT_EQ(0, process->consumption());
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -0,0 +1,82 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/allocation_samples.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
+#include "util/defer_op.h"
+
+namespace starrocks {
+
+static void __attribute__((noinline)) allocation_site_a(AllocationSamples* samples) {
+    samples->record(100, 1000);
+}
+
+static void __attribute__((noinline)) allocation_site_b(AllocationSamples* samples) {
+    samples->record(10, 100);
+}
+
+TEST(AllocationSamplesTest, test_top_sites) {
+    AllocationSamples samples;
+    ASSERT_EQ("", samples.top_sites(10));
+    for (int i = 0; i < 3; i++) {
+        allocation_site_a(&samples);
+    }
+    allocation_site_b(&samples);
+    ASSERT_EQ(4, samples.num_samples());
+    ASSERT_EQ(3100, samples.sampled_bytes());
+
+    std::string sites = samples.top_sites(10);
+    ASSERT_EQ(2, std::count(sites.begin(), sites.end(), '\n')) << sites;
+    // allocation_site_a allocates the most.
+    ASSERT_TRUE(sites.find("3 samples") < sites.find("1 samples")) << sites;
+    std::string top_site = samples.top_sites(1);
+    ASSERT_EQ(1, std::count(top_site.begin(), top_site.end(), '\n'));
+    ASSERT_TRUE(top_site.find("3 samples") != std::string::npos) << top_site;
+}
+
+TEST(AllocationSamplesTest, test_sample_allocations_of_thread) {
+    int64_t old_interval = config::mem_alloc_sample_interval_bytes;
+    config::mem_alloc_sample_interval_bytes = 1024;
+    DeferOp defer([&] { config::mem_alloc_sample_interval_bytes = old_interval; });
+
+    MemTracker tracker;
+    tracker.set_allocation_samples(std::make_shared<AllocationSamples>());
+    {
+        CurrentThreadOperatorMemTrackerSetter setter(&tracker);
+        // Reset the countdown of the thread, which may have been set while the sampling was disabled.
+        tls_thread_status.mem_consume(64L * 1024 * 1024 + 1);
+        int64_t num_samples = tracker.allocation_samples()->num_samples();
+        for (int i = 0; i < 100; i++) {
+            tls_thread_status.mem_consume(512);
+        }
+        tls_thread_status.mem_release(512 * 100 + 64L * 1024 * 1024 + 1);
+        // One sample per 1024 bytes, depending on where the countdown of the thread starts.
+        ASSERT_NEAR(50, tracker.allocation_samples()->num_samples() - num_samples, 1);
+    }
+
+    // Not sampled without an operator.
+    int64_t num_samples = tracker.allocation_samples()->num_samples();
+    tls_thread_status.mem_consume(1024 * 10);
+    tls_thread_status.mem_release(1024 * 10);
+    ASSERT_EQ(num_samples, tracker.allocation_samples()->num_samples());
+}
+
+} // namespace starrocks
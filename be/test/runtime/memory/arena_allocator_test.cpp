@@ -0,0 +1,106 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/arena_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include "exprs/agg/aggregate_state_allocator.h"
+#include "runtime/memory/mem_hook_allocator.h"
+
+namespace starrocks {
+
+TEST(ArenaAllocatorTest, normal) {
+    MemHookAllocator upstream;
+    ArenaAllocator allocator(&upstream);
+    auto* ptr = static_cast<char*>(allocator.alloc(8));
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % 16);
+    memcpy(ptr, "abcdefgh", 8);
+    // The last allocation grows in place.
+    ASSERT_EQ(ptr, allocator.realloc(ptr, 100));
+    ASSERT_EQ(0, memcmp(ptr, "abcdefgh", 8));
+    auto* other = static_cast<char*>(allocator.alloc(16));
+    auto* moved = static_cast<char*>(allocator.realloc(ptr, 200));
+    ASSERT_NE(ptr, moved);
+    ASSERT_EQ(0, memcmp(moved, "abcdefgh", 8));
+    allocator.free(other);
+    allocator.free(moved);
+
+    auto* zeros = static_cast<uint8_t*>(allocator.calloc(10, 4));
+    for (int i = 0; i < 40; ++i) {
+        ASSERT_EQ(0, zeros[i]);
+    }
+    allocator.cfree(zeros);
+    for (size_t align : {16, 64, 4096}) {
+        void* aligned = allocator.aligned_alloc(align, 100);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(aligned) % align);
+        allocator.free(aligned);
+    }
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(allocator.valloc(4)) % 4096);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(allocator.pvalloc(16)) % 4096);
+    void* memaligned = nullptr;
+    ASSERT_EQ(0, allocator.posix_memalign(&memaligned, 32, 64));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(memaligned) % 32);
+    ASSERT_EQ(EINVAL, allocator.posix_memalign(&memaligned, 3, 64));
+}
+
+TEST(ArenaAllocatorTest, large_and_release_all) {
+    MemHookAllocator upstream;
+    ArenaAllocator allocator(&upstream);
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 1000; ++i) {
+        ptrs.push_back(allocator.alloc(100));
+    }
+    const int64_t small_bytes = allocator.allocated_bytes();
+    ASSERT_GE(small_bytes, 100 * 1000);
+
+    // The large allocations are freed one by one.
+    void* large = allocator.alloc(ArenaAllocator::kMaxSmallSize + 1);
+    ASSERT_GT(allocator.allocated_bytes(), small_bytes + ArenaAllocator::kMaxSmallSize);
+    large = allocator.realloc(large, 1024 * 1024);
+    memset(large, 1, 1024 * 1024);
+    allocator.free(large);
+    ASSERT_EQ(small_bytes, allocator.allocated_bytes());
+
+    allocator.alloc(ArenaAllocator::kMaxSmallSize * 2);
+    allocator.release_all();
+    ASSERT_EQ(0, allocator.allocated_bytes());
+    ASSERT_NE(nullptr, allocator.alloc(100));
+}
+
+TEST(ArenaAllocatorTest, agg_state_containers) {
+    MemHookAllocator upstream;
+    ArenaAllocator allocator(&upstream);
+    SCOPED_THREAD_LOCAL_AGG_STATE_ALLOCATOR_SETTER(&allocator);
+    {
+        HashSetWithAggStateAllocator<int64_t> set;
+        VectorWithAggStateAllocator<int64_t> vec;
+        for (int64_t i = 0; i < 100000; ++i) {
+            set.insert(i % 50000);
+            vec.push_back(i);
+        }
+        ASSERT_EQ(50000, set.size());
+        ASSERT_EQ(100000, vec.size());
+        ASSERT_EQ(99999, vec.back());
+    }
+    allocator.release_all();
+    ASSERT_EQ(0, allocator.allocated_bytes());
+}
+
+} // namespace starrocks
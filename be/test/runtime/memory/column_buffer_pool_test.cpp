@@ -0,0 +1,90 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/column_buffer_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "column/vectorized_fwd.h"
+#include "runtime/memory/column_allocator.h"
+
+namespace starrocks {
+
+TEST(ColumnBufferPoolTest, test_reuse) {
+    ColumnBufferPool pool(128 * 1024);
+    ASSERT_FALSE(ColumnBufferPool::is_pooled(100));
+    ASSERT_TRUE(ColumnBufferPool::is_pooled(4096));
+    ASSERT_FALSE(ColumnBufferPool::is_pooled(2 * 1024 * 1024));
+
+    // 16384 and 10000 bytes are in the same class.
+    void* ptr = pool.allocate(16384);
+    memset(ptr, 1, 16384);
+    pool.deallocate(ptr, 16384);
+    ASSERT_EQ(16384, pool.cached_bytes());
+    void* reused = pool.allocate(10000);
+    ASSERT_EQ(ptr, reused);
+    ASSERT_EQ(1, pool.num_hits());
+    ASSERT_EQ(0, pool.cached_bytes());
+    memset(reused, 1, 16384);
+
+    // A different class is not reused.
+    void* other = pool.allocate(40000);
+    ASSERT_NE(ptr, other);
+    pool.deallocate(other, 40000);
+    pool.deallocate(reused, 10000);
+    ASSERT_EQ(16384 + 65536, pool.cached_bytes());
+}
+
+TEST(ColumnBufferPoolTest, test_capacity) {
+    ColumnBufferPool pool(32 * 1024);
+    void* p1 = pool.allocate(16384);
+    void* p2 = pool.allocate(16384);
+    void* p3 = pool.allocate(16384);
+    pool.deallocate(p1, 16384);
+    pool.deallocate(p2, 16384);
+    // Exceeds the capacity, freed directly.
+    pool.deallocate(p3, 16384);
+    ASSERT_EQ(32 * 1024, pool.cached_bytes());
+    pool.clear();
+    ASSERT_EQ(0, pool.cached_bytes());
+}
+
+TEST(ColumnBufferPoolTest, test_column_allocator) {
+    ColumnBufferPool pool(1024 * 1024);
+    // Allocated outside of the pool, and freed to the pool.
+    auto* outside = new Buffer<int32_t>(3000);
+    {
+        ThreadLocalColumnBufferPoolSetter setter(&pool);
+        delete outside;
+        for (int i = 0; i < 10; i++) {
+            Buffer<int32_t> ints(4096, i);
+            Buffer<int64_t> longs(2048, i);
+            ASSERT_EQ(i, ints[4095]);
+            ASSERT_EQ(i, longs[2047]);
+        }
+        ASSERT_GT(pool.num_hits(), 0);
+    }
+    ASSERT_EQ(nullptr, tls_column_buffer_pool);
+    // Allocated from the pool, and freed outside of it.
+    Buffer<int32_t>* inside = nullptr;
+    {
+        ThreadLocalColumnBufferPoolSetter setter(&pool);
+        inside = new Buffer<int32_t>(4096, 1);
+    }
+    delete inside;
+}
+
+} // namespace starrocks
@@ -0,0 +1,78 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/huge_page_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "common/config.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+
+class HugePageAllocatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _threshold = config::huge_page_alloc_threshold_bytes;
+        config::huge_page_alloc_threshold_bytes = 1024 * 1024;
+    }
+    void TearDown() override { config::huge_page_alloc_threshold_bytes = _threshold; }
+
+private:
+    int64_t _threshold = 0;
+};
+
+TEST_F(HugePageAllocatorTest, test_allocate) {
+    ASSERT_FALSE(HugePageAllocatorBase::is_huge(1024));
+    ASSERT_TRUE(HugePageAllocatorBase::is_huge(1024 * 1024));
+
+    void* small = HugePageAllocatorBase::allocate(1024);
+    ASSERT_NE(nullptr, small);
+    memset(small, 1, 1024);
+    HugePageAllocatorBase::free(small, 1024);
+
+    const size_t size = 3 * 1024 * 1024 + 1;
+    void* huge = HugePageAllocatorBase::allocate(size);
+    ASSERT_NE(nullptr, huge);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(huge) % HugePageAllocatorBase::kHugePageSize);
+    // The anonymous pages are zero filled.
+    ASSERT_EQ(0, static_cast<char*>(huge)[size - 1]);
+    memset(huge, 1, size);
+    HugePageAllocatorBase::free(huge, size);
+}
+
+TEST_F(HugePageAllocatorTest, test_containers) {
+    HugePageBuffer<uint32_t> buffer;
+    for (uint32_t i = 0; i < 1024 * 1024; i++) {
+        buffer.push_back(i);
+    }
+    for (uint32_t i = 0; i < 1024 * 1024; i++) {
+        ASSERT_EQ(i, buffer[i]);
+    }
+
+    phmap::flat_hash_map<int64_t, int64_t, phmap::priv::hash_default_hash<int64_t>,
+                         phmap::priv::hash_default_eq<int64_t>, HugePageAllocator<std::pair<const int64_t, int64_t>>>
+            map;
+    for (int64_t i = 0; i < 200000; i++) {
+        map.emplace(i, i * 2);
+    }
+    ASSERT_EQ(200000, map.size());
+    for (int64_t i = 0; i < 200000; i++) {
+        ASSERT_EQ(i * 2, map[i]);
+    }
+}
+
+} // namespace starrocks
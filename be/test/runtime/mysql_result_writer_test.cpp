@@ -0,0 +1,108 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/mysql_result_writer.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "column/array_column.h"
+#include "column/binary_column.h"
+#include "column/const_column.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "util/mysql_row_buffer.h"
+
+namespace starrocks {
+
+// The rows serialized by the per-cell put_mysql_row_buffer.
+static std::vector<std::string> serialize_rows_by_cells(const Columns& columns, size_t num_rows) {
+    std::vector<std::string> rows(num_rows);
+    MysqlRowBuffer buffer;
+    for (size_t i = 0; i < num_rows; i++) {
+        for (const auto& column : columns) {
+            column->put_mysql_row_buffer(&buffer, i);
+        }
+        buffer.move_content(&rows[i]);
+    }
+    return rows;
+}
+
+static void check_text_rows(const Columns& columns, size_t num_rows) {
+    std::vector<std::string> rows;
+    MysqlResultWriter::serialize_text_rows(columns, num_rows, &rows);
+    ASSERT_EQ(serialize_rows_by_cells(columns, num_rows), rows);
+}
+
+TEST(MysqlResultWriterTest, test_serialize_text_rows) {
+    const size_t num_rows = 300;
+    auto tinyint = Int8Column::create();
+    auto boolean = BooleanColumn::create();
+    auto smallint = Int16Column::create();
+    auto bigint = Int64Column::create();
+    auto largeint = Int128Column::create();
+    auto nullable_int = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto varchar = BinaryColumn::create();
+    auto nullable_varchar = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    auto dbl = DoubleColumn::create();
+    auto date = DateColumn::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        int64_t v = static_cast<int64_t>(i * 7919) * (i % 2 == 0 ? 1 : -1);
+        tinyint->append(static_cast<int8_t>(v));
+        boolean->append(i % 3 == 0);
+        smallint->append(static_cast<int16_t>(v));
+        bigint->append(v * 1000000007L);
+        largeint->append(static_cast<int128_t>(v) * std::numeric_limits<int64_t>::max());
+        if (i % 5 == 0) {
+            nullable_int->append_nulls(1);
+            nullable_varchar->append_nulls(1);
+        } else {
+            nullable_int->append_datum(Datum(static_cast<int32_t>(v)));
+            // a string longer than 250 bytes has a 3 bytes length prefix.
+            std::string s(i, 'a' + i % 26);
+            nullable_varchar->append_datum(Datum(Slice(s)));
+        }
+        varchar->append(std::to_string(v));
+        dbl->append(v / 3.0);
+        date->append(DateValue::create(2000 + i % 30, 1 + i % 12, 1 + i % 28));
+    }
+    auto const_data = Int32Column::create();
+    const_data->append(42);
+    auto const_int = ConstColumn::create(const_data, num_rows);
+
+    check_text_rows({tinyint, boolean, smallint, bigint, largeint}, num_rows);
+    check_text_rows({nullable_int, varchar, nullable_varchar}, num_rows);
+    check_text_rows({dbl, date, const_int}, num_rows);
+    check_text_rows({varchar}, 0);
+}
+
+TEST(MysqlResultWriterTest, test_serialize_text_rows_of_array) {
+    auto elements = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    auto offsets = UInt32Column::create();
+    auto array = ArrayColumn::create(elements, offsets);
+    array->append_datum(DatumArray{Slice("a\"b"), Datum()});
+    array->append_datum(DatumArray{});
+    array->append_datum(DatumArray{Slice("c\\d")});
+    auto ints = Int32Column::create();
+    ints->append(1);
+    ints->append(-2);
+    ints->append(3);
+
+    check_text_rows({array, ints}, 3);
+}
+
+} // namespace starrocks
@@ -131,6 +131,28 @@ TEST_F(ResultQueueMgrTest, fetch_result_end) {
     ASSERT_TRUE(result == nullptr);
 }
 
+TEST_F(ResultQueueMgrTest, fetch_schema) {
+    ResultQueueMgr queue_mgr;
+    TUniqueId query_id;
+    query_id.lo = 10;
+    query_id.hi = 100;
+
+    std::shared_ptr<arrow::Schema> schema;
+    ASSERT_FALSE(queue_mgr.fetch_schema(query_id, &schema).ok());
+
+    BlockQueueSharedPtr block_queue_t;
+    queue_mgr.create_queue(query_id, &block_queue_t);
+    ASSERT_TRUE(queue_mgr.fetch_schema(query_id, &schema).ok());
+    ASSERT_TRUE(schema == nullptr);
+
+    auto field = arrow::field("k1", arrow::int32(), true);
+    block_queue_t->set_schema(arrow::schema({field}));
+    ASSERT_TRUE(queue_mgr.fetch_schema(query_id, &schema).ok());
+    ASSERT_TRUE(schema != nullptr);
+    ASSERT_EQ(1, schema->num_fields());
+    ASSERT_EQ("k1", schema->field(0)->name());
+}
+
 TEST_F(ResultQueueMgrTest, normal_cancel) {
     TUniqueId query_id;
     query_id.lo = 10;
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include "column/array_column.h"
 #include "column/binary_column.h"
 #include "column/column_visitor.h"
@@ -152,6 +154,90 @@ PARALLEL_TEST(ColumnArraySerdeTest, int_column) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, int_column_frame_of_reference) {
+    auto c1 = Int64Column::create();
+    auto c2 = Int64Column::create();
+    for (int64_t i = 0; i < 4096; i++) {
+        c1->append(1700000000000L + (i * 7919) % 1000);
+    }
+    const int raw_level = 2;
+    const int for_level = 2 | 8;
+    std::vector<uint8_t> buffer;
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c1, raw_level));
+    auto raw_size = ColumnArraySerde::serialize(*c1, buffer.data(), false, raw_level) - buffer.data();
+
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c1, for_level));
+    auto* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, for_level);
+    // the deltas to the minimum value take at most 2 bytes
+    ASSERT_LT(end - buffer.data(), c1->size() * 3);
+    ASSERT_LT(end - buffer.data(), raw_size);
+    ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, for_level));
+    ASSERT_EQ(c1->size(), c2->size());
+    for (size_t i = 0; i < c1->size(); i++) {
+        ASSERT_EQ(c1->get_data()[i], c2->get_data()[i]);
+    }
+
+    // the range exceeds 32 bits.
+    c1->append(std::numeric_limits<int64_t>::min());
+    c1->append(std::numeric_limits<int64_t>::max());
+    c2 = Int64Column::create();
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c1, for_level));
+    end = ColumnArraySerde::serialize(*c1, buffer.data(), false, for_level);
+    ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, for_level));
+    ASSERT_EQ(c1->size(), c2->size());
+    for (size_t i = 0; i < c1->size(); i++) {
+        ASSERT_EQ(c1->get_data()[i], c2->get_data()[i]);
+    }
+
+    auto c3 = Int32Column::create();
+    auto c4 = Int32Column::create();
+    for (int32_t i = 0; i < 1024; i++) {
+        c3->append(-100 - i % 100);
+    }
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c3, for_level));
+    end = ColumnArraySerde::serialize(*c3, buffer.data(), false, for_level);
+    ASSERT_LT(end - buffer.data(), c3->size() * 2);
+    ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c4.get(), false, for_level));
+    for (size_t i = 0; i < c3->size(); i++) {
+        ASSERT_EQ(c3->get_data()[i], c4->get_data()[i]);
+    }
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, int_column_run_length) {
+    auto c1 = Int64Column::create();
+    auto c2 = Int64Column::create();
+    // 4 runs of the same value, e.g. the sort key prefix of a scan
+    for (int64_t i = 0; i < 4096; i++) {
+        c1->append(i < 1024 ? std::numeric_limits<int64_t>::min() : 1700000000000L + i / 1024);
+    }
+    const int for_level = 2 | 8;
+    std::vector<uint8_t> buffer;
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c1, for_level));
+    auto* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, for_level);
+    ASSERT_LT(end - buffer.data(), 128);
+    ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, for_level));
+    ASSERT_EQ(c1->size(), c2->size());
+    for (size_t i = 0; i < c1->size(); i++) {
+        ASSERT_EQ(c1->get_data()[i], c2->get_data()[i]);
+    }
+
+    auto c3 = Int32Column::create();
+    auto c4 = Int32Column::create();
+    for (int32_t i = 0; i < 1000; i++) {
+        c3->append(i / 10);
+    }
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c3, for_level));
+    end = ColumnArraySerde::serialize(*c3, buffer.data(), false, for_level);
+    ASSERT_LT(end - buffer.data(), c3->size());
+    ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c4.get(), false, for_level));
+    ASSERT_EQ(c3->size(), c4->size());
+    for (size_t i = 0; i < c3->size(); i++) {
+        ASSERT_EQ(c3->get_data()[i], c4->get_data()[i]);
+    }
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ColumnArraySerdeTest, double_column) {
     std::vector<double> numbers{1.0, 2, 3.3, 4, 5.9, 6, 7};
@@ -215,6 +301,35 @@ PARALLEL_TEST(ColumnArraySerdeTest, nullable_int32_column) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, nullable_column_null_mask) {
+    auto c1 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto c2 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    for (int32_t i = 0; i < 1001; i++) {
+        if (i % 7 == 0) {
+            c1->append_nulls(1);
+        } else {
+            c1->append_datum(Datum(i));
+        }
+    }
+    const int null_mask_level = 16;
+    std::vector<uint8_t> buffer;
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c1, null_mask_level));
+    ASSERT_EQ(ColumnArraySerde::max_serialized_size(*c1->data_column(), null_mask_level) + sizeof(uint32_t) + 126,
+              buffer.size());
+    auto* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, null_mask_level);
+    ASSERT_EQ(buffer.data() + buffer.size(), end);
+    ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, null_mask_level));
+    ASSERT_EQ(c1->size(), c2->size());
+    ASSERT_TRUE(c2->has_null());
+    for (size_t i = 0; i < c1->size(); i++) {
+        ASSERT_EQ(c1->is_null(i), c2->is_null(i));
+        if (!c1->is_null(i)) {
+            ASSERT_EQ(c1->get(i).get_int32(), c2->get(i).get_int32());
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ColumnArraySerdeTest, binary_column) {
     std::vector<Slice> strings{{"bbb"}, {"bbc"}, {"ccc"}};
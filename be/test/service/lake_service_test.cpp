@@ -488,6 +488,104 @@ TEST_F(LakeServiceTest, test_publish_version_for_write_batch) {
     }
 }
 
+TEST_F(LakeServiceTest, test_publish_version_aggregate) {
+    auto tablet_id_2 = next_id();
+    {
+        auto metadata = std::make_shared<TabletMetadata>(*_tablet_mgr->get_tablet_metadata(_tablet_id, 1).value());
+        metadata->set_id(tablet_id_2);
+        ASSERT_OK(_tablet_mgr->put_tablet_metadata(metadata));
+    }
+    auto txn_id = next_id();
+    for (auto tablet_id : {_tablet_id, tablet_id_2}) {
+        TxnLog txnlog;
+        txnlog.set_tablet_id(tablet_id);
+        txnlog.set_txn_id(txn_id);
+        txnlog.mutable_op_write()->mutable_rowset()->set_num_rows(101);
+        txnlog.mutable_op_write()->mutable_rowset()->set_data_size(4096);
+        txnlog.mutable_op_write()->mutable_rowset()->add_segments("1.dat");
+        ASSERT_OK(_tablet_mgr->put_txn_log(txnlog));
+    }
+
+    PublishVersionRequest request;
+    request.set_base_version(1);
+    request.set_new_version(2);
+    request.add_tablet_ids(_tablet_id);
+    request.add_tablet_ids(tablet_id_2);
+    request.add_txn_ids(txn_id);
+    request.set_enable_aggregate_publish(true);
+
+    // Publish failed: put bundle tablet metadata failed
+    {
+        TEST_ENABLE_ERROR_POINT("TabletManager::put_bundle_tablet_metadata",
+                                Status::IOError("injected put bundle tablet metadata error"));
+        SyncPoint::GetInstance()->EnableProcessing();
+        DeferOp defer([]() {
+            TEST_DISABLE_ERROR_POINT("TabletManager::put_bundle_tablet_metadata");
+            SyncPoint::GetInstance()->DisableProcessing();
+        });
+
+        PublishVersionResponse response;
+        _lake_service.publish_version(nullptr, &request, &response, nullptr);
+        ASSERT_EQ(2, response.failed_tablets_size());
+        ASSERT_EQ(0, response.compaction_scores_size());
+        EXPECT_TRUE(MatchPattern(response.status().error_msgs(0), "injected put bundle tablet metadata error"))
+                << response.status().error_msgs(0);
+        ASSERT_TRUE(_tablet_mgr->get_tablet_metadata(_tablet_id, 2).status().is_not_found());
+    }
+    // Publish success
+    {
+        PublishVersionResponse response;
+        _lake_service.publish_version(nullptr, &request, &response, nullptr);
+        ASSERT_EQ(0, response.failed_tablets_size());
+        ASSERT_EQ(2, response.compaction_scores_size());
+    }
+
+    // The new metadata is written into one bundle instead of one file per tablet.
+    auto fs = FileSystem::Default();
+    ASSERT_OK(fs->path_exists(_tablet_mgr->bundle_tablet_metadata_location(_tablet_id, 2)));
+    for (auto tablet_id : {_tablet_id, tablet_id_2}) {
+        ASSERT_TRUE(fs->path_exists(_tablet_mgr->tablet_metadata_location(tablet_id, 2)).is_not_found());
+        // The txn logs are left to vacuum
+        ExecEnv::GetInstance()->delete_file_thread_pool()->wait();
+        ASSERT_OK(_tablet_mgr->get_txn_log(tablet_id, txn_id).status());
+    }
+
+    _tablet_mgr->prune_metacache();
+    for (auto tablet_id : {_tablet_id, tablet_id_2}) {
+        ASSERT_OK(_tablet_mgr->tablet_metadata_exists(tablet_id, 2));
+        ASSIGN_OR_ABORT(auto metadata, _tablet_mgr->get_tablet_metadata(tablet_id, 2));
+        ASSERT_EQ(tablet_id, metadata->id());
+        ASSERT_EQ(2, metadata->version());
+        ASSERT_EQ(1, metadata->rowsets_size());
+        ASSERT_EQ("1.dat", metadata->rowsets(0).segments(0));
+    }
+    ASSERT_TRUE(_tablet_mgr->get_tablet_metadata(_tablet_id, 3).status().is_not_found());
+
+    // Publish the next version from the bundled base version
+    {
+        auto txn_id_2 = next_id();
+        TxnLog txnlog;
+        txnlog.set_tablet_id(_tablet_id);
+        txnlog.set_txn_id(txn_id_2);
+        txnlog.mutable_op_write()->mutable_rowset()->set_num_rows(10);
+        txnlog.mutable_op_write()->mutable_rowset()->set_data_size(1024);
+        txnlog.mutable_op_write()->mutable_rowset()->add_segments("2.dat");
+        ASSERT_OK(_tablet_mgr->put_txn_log(txnlog));
+
+        _tablet_mgr->prune_metacache();
+        PublishVersionRequest request_2;
+        PublishVersionResponse response;
+        request_2.set_base_version(2);
+        request_2.set_new_version(3);
+        request_2.add_tablet_ids(_tablet_id);
+        request_2.add_txn_ids(txn_id_2);
+        _lake_service.publish_version(nullptr, &request_2, &response, nullptr);
+        ASSERT_EQ(0, response.failed_tablets_size());
+        ASSIGN_OR_ABORT(auto metadata, _tablet_mgr->get_tablet_metadata(_tablet_id, 3));
+        ASSERT_EQ(2, metadata->rowsets_size());
+    }
+}
+
 TEST_F(LakeServiceTest, test_publish_version_transform_single_to_batch) {
     std::vector<TxnLog> logs;
     // Empty TxnLog
@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "simd/null_mask.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace starrocks {
+
+TEST(NullMaskTest, pack_and_unpack) {
+    std::mt19937 rng(42);
+    for (size_t num_rows : {0, 1, 7, 8, 9, 31, 32, 33, 64, 100, 4097}) {
+        std::vector<uint8_t> nulls(num_rows);
+        size_t num_nulls = 0;
+        for (auto& null : nulls) {
+            null = rng() % 3 == 0 ? 1 : 0;
+            num_nulls += null;
+        }
+        std::vector<uint8_t> mask(SIMD::NullMask::num_bytes(num_rows));
+        SIMD::NullMask::pack(nulls.data(), num_rows, mask.data());
+        ASSERT_EQ(num_nulls, SIMD::NullMask::count_null(mask.data(), num_rows));
+        ASSERT_EQ(num_nulls > 0, SIMD::NullMask::has_null(mask.data(), num_rows));
+
+        std::vector<uint8_t> unpacked(num_rows);
+        SIMD::NullMask::unpack(mask.data(), num_rows, unpacked.data());
+        ASSERT_EQ(nulls, unpacked);
+    }
+}
+
+TEST(NullMaskTest, merge) {
+    const size_t num_rows = 70;
+    std::vector<uint8_t> nulls1(num_rows);
+    std::vector<uint8_t> nulls2(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        nulls1[i] = i % 2 == 0;
+        nulls2[i] = i % 3 == 0;
+    }
+    std::vector<uint8_t> mask1(SIMD::NullMask::num_bytes(num_rows));
+    std::vector<uint8_t> mask2(SIMD::NullMask::num_bytes(num_rows));
+    SIMD::NullMask::pack(nulls1.data(), num_rows, mask1.data());
+    SIMD::NullMask::pack(nulls2.data(), num_rows, mask2.data());
+
+    auto or_mask = mask1;
+    SIMD::NullMask::merge_or(or_mask.data(), mask2.data(), num_rows);
+    auto and_mask = mask1;
+    SIMD::NullMask::merge_and(and_mask.data(), mask2.data(), num_rows);
+    std::vector<uint8_t> or_nulls(num_rows);
+    std::vector<uint8_t> and_nulls(num_rows);
+    SIMD::NullMask::unpack(or_mask.data(), num_rows, or_nulls.data());
+    SIMD::NullMask::unpack(and_mask.data(), num_rows, and_nulls.data());
+    for (size_t i = 0; i < num_rows; i++) {
+        ASSERT_EQ(nulls1[i] | nulls2[i], or_nulls[i]);
+        ASSERT_EQ(nulls1[i] & nulls2[i], and_nulls[i]);
+    }
+}
+
+} // namespace starrocks
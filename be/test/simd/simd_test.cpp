@@ -134,4 +134,30 @@ TEST_F(SIMDTest, count_nonzero_int32) {
     EXPECT_EQ(30u, SIMD::count_nonzero(numbers));
 }
 
+TEST_F(SIMDTest, for_each_equal_byte) {
+    for (size_t size : {0, 1, 15, 16, 63, 64, 65, 200}) {
+        std::string data(size, 'a');
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < size; i += (i % 7) + 1) {
+            data[i] = ',';
+            expected.push_back(i);
+        }
+        if (size > 0) {
+            data[size - 1] = ',';
+            if (expected.empty() || expected.back() != size - 1) {
+                expected.push_back(size - 1);
+            }
+        }
+        std::vector<size_t> found;
+        SIMD::for_each_equal_byte(data.data(), data.size(), ',', [&](size_t i) { found.push_back(i); });
+        EXPECT_EQ(expected, found) << "size=" << size;
+    }
+
+    // all the bytes match
+    std::string data(130, '\t');
+    size_t count = 0;
+    SIMD::for_each_equal_byte(data.data(), data.size(), '\t', [&](size_t i) { EXPECT_EQ(count++, i); });
+    EXPECT_EQ(130, count);
+}
+
 } // namespace starrocks
@@ -272,6 +272,54 @@ TEST_F(ChunkPipelineAccumulatorTest, test_push) {
     ASSERT_FALSE(accumulator.has_output());
 }
 
+TEST_F(ChunkPipelineAccumulatorTest, test_max_bytes) {
+    // 16 bytes per row, so 256 rows within 4KB.
+    ChunkPipelineAccumulator accumulator;
+    accumulator.set_max_size(4096);
+    accumulator.set_max_bytes(16 * 256);
+
+    accumulator.push(_generate_chunk(100, 16));
+    ASSERT_FALSE(accumulator.has_output());
+    ASSERT_EQ(16, accumulator.avg_row_bytes());
+    accumulator.push(_generate_chunk(100, 16));
+    ASSERT_TRUE(accumulator.has_output());
+    auto result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 200);
+
+    // A chunk over the budget is not merged.
+    accumulator.push(_generate_chunk(100, 16));
+    ASSERT_FALSE(accumulator.has_output());
+    accumulator.push(_generate_chunk(200, 16));
+    ASSERT_TRUE(accumulator.has_output());
+    result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 100);
+    accumulator.finalize();
+    ASSERT_TRUE(accumulator.has_output());
+    result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 200);
+}
+
+TEST(ChunkRowWidthEstimatorTest, test_rows_within) {
+    ChunkRowWidthEstimator estimator;
+    ASSERT_EQ(4096, estimator.rows_within(4096, 1024 * 1024));
+    estimator.update(0, 100);
+    ASSERT_EQ(0, estimator.avg_row_bytes());
+
+    estimator.update(1000, 1000 * 1024);
+    ASSERT_EQ(1024, estimator.avg_row_bytes());
+    ASSERT_EQ(1024, estimator.rows_within(4096, 1024 * 1024));
+    ASSERT_EQ(4096, estimator.rows_within(4096, 0));
+    // Never more than the max rows, and never less than kMinRows.
+    ASSERT_EQ(4096, estimator.rows_within(4096, 1024L * 1024 * 1024));
+    ASSERT_EQ(ChunkRowWidthEstimator::kMinRows, estimator.rows_within(4096, 1024));
+    ASSERT_EQ(10, estimator.rows_within(10, 1024));
+
+    // Moves towards the width of the new rows.
+    estimator.update(1000, 1000 * 2048);
+    ASSERT_GT(estimator.avg_row_bytes(), 1024);
+    ASSERT_LT(estimator.avg_row_bytes(), 2048);
+}
+
 TEST_F(ChunkPipelineAccumulatorTest, test_owner_info) {
     constexpr size_t kDesiredSize = 4096;
 
@@ -14,6 +14,7 @@
 
 #include "storage/column_predicate.h"
 
+#include <limits>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -2028,6 +2029,53 @@ TEST(ColumnPredicateTest, test_or) {
 
 #define ZMF(min, max) zone_map_filter(ZoneMapDetail(min, max))
 
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, test_in_long_list) {
+    // 0, 2, 4 ... 198 are dense, 0, 1000, 2000 ... 99000 are not.
+    for (int step : {2, 1000}) {
+        std::vector<std::string> strs;
+        for (int i = 99; i >= 0; i--) {
+            strs.emplace_back(std::to_string(i * step));
+        }
+        std::unique_ptr<ColumnPredicate> p(new_column_in_predicate(get_type_info(TYPE_INT), 0, strs));
+        ASSERT_EQ(100, p->values().size());
+
+        auto c = ChunkHelper::column_from_field_type(TYPE_INT, true);
+        std::vector<int> values = {-2, 0, 1, 2, 198, 200, 1000, 99000, 99001, std::numeric_limits<int>::min()};
+        for (int v : values) {
+            c->append_datum(Datum(v));
+        }
+        (void)c->append_nulls(1);
+        std::vector<uint8_t> buff(c->size());
+        ASSERT_OK(p->evaluate(c.get(), buff.data(), 0, c->size()));
+        for (size_t i = 0; i < values.size(); i++) {
+            bool found = values[i] >= 0 && values[i] <= 99 * step && values[i] % step == 0;
+            ASSERT_EQ(found, buff[i]) << values[i];
+        }
+        ASSERT_EQ(0, buff.back());
+
+        EXPECT_TRUE(p->ZMF(Datum(-10), Datum(0)));
+        EXPECT_TRUE(p->ZMF(Datum(99 * step), Datum(100000)));
+        EXPECT_FALSE(p->ZMF(Datum(99 * step + 1), Datum(100000)));
+        EXPECT_FALSE(p->ZMF(Datum(-10), Datum(-1)));
+        EXPECT_FALSE(p->ZMF(Datum(step + 1), Datum(2 * step - 1)));
+        EXPECT_TRUE(p->ZMF(Datum(step + 1), Datum(2 * step)));
+        EXPECT_TRUE(p->ZMF(Datum(), Datum(0)));
+        EXPECT_FALSE(p->ZMF(Datum(), Datum()));
+    }
+
+    std::vector<std::string> strs;
+    for (int i = 0; i < 100; i++) {
+        strs.emplace_back("s" + std::to_string(i * 2));
+    }
+    std::unique_ptr<ColumnPredicate> p(new_column_in_predicate(get_type_info(TYPE_VARCHAR), 0, strs));
+    EXPECT_TRUE(p->ZMF(Datum(Slice("s0")), Datum(Slice("s0"))));
+    EXPECT_TRUE(p->ZMF(Datum(Slice("s97")), Datum(Slice("s99"))));
+    EXPECT_FALSE(p->ZMF(Datum(Slice("s99")), Datum(Slice("t"))));
+    EXPECT_FALSE(p->ZMF(Datum(Slice("a")), Datum(Slice("s"))));
+}
+
+
 // NOLINTNEXTLINE
 TEST(ColumnPredicateTest, zone_map_filter) {
     std::unique_ptr<ColumnPredicate> eq_100(new_column_eq_predicate(get_type_info(TYPE_INT), 0, "100"));
@@ -2096,6 +2144,41 @@ TEST(ColumnPredicateTest, zone_map_filter) {
     EXPECT_TRUE(not_in_90_100->ZMF(Datum(101), Datum(110)));
 }
 
+#define ZMAT(min, max) zone_map_always_true(ZoneMapDetail(min, max))
+
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, zone_map_always_true) {
+    std::unique_ptr<ColumnPredicate> eq_100(new_column_eq_predicate(get_type_info(TYPE_INT), 0, "100"));
+    std::unique_ptr<ColumnPredicate> ne_100(new_column_ne_predicate(get_type_info(TYPE_INT), 0, "100"));
+    std::unique_ptr<ColumnPredicate> gt_100(new_column_gt_predicate(get_type_info(TYPE_INT), 0, "100"));
+    std::unique_ptr<ColumnPredicate> ge_100(new_column_ge_predicate(get_type_info(TYPE_INT), 0, "100"));
+    std::unique_ptr<ColumnPredicate> lt_100(new_column_lt_predicate(get_type_info(TYPE_INT), 0, "100"));
+    std::unique_ptr<ColumnPredicate> le_100(new_column_le_predicate(get_type_info(TYPE_INT), 0, "100"));
+
+    EXPECT_TRUE(eq_100->ZMAT(Datum(100), Datum(100)));
+    EXPECT_FALSE(eq_100->ZMAT(Datum(90), Datum(100)));
+    EXPECT_FALSE(eq_100->ZMAT(Datum(), Datum(100)));
+
+    EXPECT_FALSE(ne_100->ZMAT(Datum(101), Datum(200)));
+
+    EXPECT_TRUE(gt_100->ZMAT(Datum(101), Datum(200)));
+    EXPECT_FALSE(gt_100->ZMAT(Datum(100), Datum(200)));
+    EXPECT_FALSE(gt_100->ZMAT(Datum(), Datum(200)));
+    EXPECT_FALSE(gt_100->ZMAT(Datum(), Datum()));
+
+    EXPECT_TRUE(ge_100->ZMAT(Datum(100), Datum(200)));
+    EXPECT_FALSE(ge_100->ZMAT(Datum(99), Datum(200)));
+    EXPECT_FALSE(ge_100->ZMAT(Datum(), Datum(200)));
+
+    EXPECT_TRUE(lt_100->ZMAT(Datum(10), Datum(99)));
+    EXPECT_FALSE(lt_100->ZMAT(Datum(10), Datum(100)));
+    EXPECT_FALSE(lt_100->ZMAT(Datum(), Datum(99)));
+
+    EXPECT_TRUE(le_100->ZMAT(Datum(10), Datum(100)));
+    EXPECT_FALSE(le_100->ZMAT(Datum(10), Datum(101)));
+    EXPECT_FALSE(le_100->ZMAT(Datum(), Datum()));
+}
+
 // NOLINTNEXTLINE
 TEST(ColumnPredicateTest, zone_map_filter_char) {
     std::unique_ptr<ColumnPredicate> eq_xx(new_column_eq_predicate(get_type_info(TYPE_CHAR), 0, "xx\0\0\0"));
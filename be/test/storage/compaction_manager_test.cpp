@@ -251,6 +251,28 @@ TEST_F(CompactionManagerTest, test_next_compaction_task_id) {
     ASSERT_LT(0, start_task_id);
 }
 
+TEST_F(CompactionManagerTest, test_read_heat) {
+    TabletSharedPtr tablet = std::make_shared<Tablet>();
+    ASSERT_EQ(0, tablet->read_heat());
+    tablet->add_read_heat(100);
+    tablet->add_read_heat(0);
+    ASSERT_NEAR(100, tablet->read_heat(), 1);
+
+    int64_t half_life_ms = config::tablet_read_heat_half_life_sec * 1000;
+    ASSERT_DOUBLE_EQ(100, Tablet::decay_read_heat(100, 0));
+    ASSERT_DOUBLE_EQ(50, Tablet::decay_read_heat(100, half_life_ms));
+    ASSERT_DOUBLE_EQ(25, Tablet::decay_read_heat(100, 2 * half_life_ms));
+
+    // The hotter tablet goes first for the same compaction score, and a cold tablet keeps its score.
+    ASSERT_DOUBLE_EQ(10, CompactionManager::candidate_score(10, 0));
+    ASSERT_GT(CompactionManager::candidate_score(10, 1000), CompactionManager::candidate_score(10, 10));
+    ASSERT_GT(CompactionManager::candidate_score(10, 10), 10);
+    double weight = config::compaction_read_heat_weight;
+    config::compaction_read_heat_weight = 0;
+    ASSERT_DOUBLE_EQ(10, CompactionManager::candidate_score(10, 1000));
+    config::compaction_read_heat_weight = weight;
+}
+
 TEST_F(CompactionManagerTest, test_compaction_parallel) {
     std::vector<TabletSharedPtr> tablets;
     std::vector<std::shared_ptr<MockCompactionTask>> tasks;
@@ -409,4 +409,35 @@ INSTANTIATE_TEST_SUITE_P(ConjunctiveTest, ConjunctiveTestFixture,
                                                           LogicalType::TYPE_LARGEINT, LogicalType::TYPE_VARCHAR,
                                                           LogicalType::TYPE_CHAR, LogicalType::TYPE_BOOLEAN)));
 
+// NOLINTNEXTLINE
+TEST(ConjunctivePredicatesTest, reorder_non_vec_children) {
+    std::unique_ptr<ColumnPredicate> p0(new_column_in_predicate(get_type_info(TYPE_INT), 0, {"1", "2"}));
+    std::unique_ptr<ColumnPredicate> p1(new_column_in_predicate(get_type_info(TYPE_INT), 1, {"1", "2"}));
+    std::unique_ptr<ColumnPredicate> p2(new_column_in_predicate(get_type_info(TYPE_INT), 2, {"1", "2"}));
+    PredicateColumnNode n0(p0.get());
+    PredicateColumnNode n1(p1.get());
+    PredicateColumnNode n2(p2.get());
+
+    CompoundNodeContext::CompoundAndContext ctx;
+    ctx.non_vec_children = {&n0, &n1, &n2};
+    ctx.non_vec_children_stats.resize(3);
+
+    // n0 filters nothing, n1 filters half of rows, n2 filters most rows with the same cost.
+    ctx.update_non_vec_child_stats(0, 1000, 1000, 1000);
+    ctx.update_non_vec_child_stats(1, 1000, 500, 1000);
+    ctx.update_non_vec_child_stats(2, 500, 50, 500);
+    ctx.reorder_non_vec_children();
+    ASSERT_EQ(&n2, ctx.non_vec_children[0]);
+    ASSERT_EQ(&n1, ctx.non_vec_children[1]);
+    ASSERT_EQ(&n0, ctx.non_vec_children[2]);
+    // statistics are moved along with the children and decayed.
+    ASSERT_EQ(250, ctx.non_vec_children_stats[0].input_rows);
+    ASSERT_EQ(500, ctx.non_vec_children_stats[2].output_rows);
+
+    // A child without statistics is moved to the front.
+    ctx.non_vec_children_stats[2] = {};
+    ctx.reorder_non_vec_children();
+    ASSERT_EQ(&n0, ctx.non_vec_children[0]);
+}
+
 } // namespace starrocks
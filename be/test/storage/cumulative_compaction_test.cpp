@@ -1090,4 +1090,32 @@ TEST_F(CumulativeCompactionTest, test_issue_20084) {
     reader->close();
 }
 
+TEST_F(CumulativeCompactionTest, test_rowsets_sorted_and_disjoint) {
+    create_tablet_schema(DUP_KEYS);
+    auto schema = ChunkHelper::convert_schema(_tablet_schema);
+    auto write_rowset = [&](int32_t begin, int32_t end) {
+        RowsetWriterContext rowset_writer_context;
+        create_rowset_writer_context(&rowset_writer_context, _version++);
+        std::unique_ptr<RowsetWriter> rowset_writer;
+        CHECK_OK(RowsetFactory::create_rowset_writer(rowset_writer_context, &rowset_writer));
+        auto chunk = ChunkHelper::new_chunk(schema, end - begin);
+        auto& cols = chunk->columns();
+        for (int32_t i = begin; i < end; i++) {
+            cols[0]->append_datum(Datum(i));
+            cols[1]->append_datum(Datum(Slice("well")));
+            cols[2]->append_datum(Datum(i));
+        }
+        CHECK_OK(rowset_writer->add_chunk(*chunk));
+        CHECK_OK(rowset_writer->flush());
+        return *rowset_writer->build();
+    };
+    auto rowset_1 = write_rowset(0, 100);
+    auto rowset_2 = write_rowset(100, 200);
+    auto rowset_3 = write_rowset(150, 300);
+
+    ASSERT_TRUE(*CompactionUtils::is_rowsets_sorted_and_disjoint({rowset_1, rowset_2}, _tablet_schema));
+    ASSERT_FALSE(*CompactionUtils::is_rowsets_sorted_and_disjoint({rowset_2, rowset_1}, _tablet_schema));
+    ASSERT_FALSE(*CompactionUtils::is_rowsets_sorted_and_disjoint({rowset_1, rowset_2, rowset_3}, _tablet_schema));
+}
+
 } // namespace starrocks
@@ -54,4 +54,19 @@ TEST(DelVector, testLoadSave) {
     ASSERT_EQ(dv2.cardinality(), dels.size());
 };
 
+// NOLINTNEXTLINE
+TEST(DelVector, testDeletedRanges) {
+    DelVector dv;
+    dv.set_empty();
+    ASSERT_TRUE(dv.deleted_ranges().empty());
+    std::shared_ptr<DelVector> ndv;
+    dv.add_dels_as_new_version({1, 2, 3, 7, 90000}, 2, &ndv);
+    ASSERT_EQ(SparseRange<>({{1, 4}, {7, 8}, {90000, 90001}}), ndv->deleted_ranges());
+    // The ranges of a new version include the new deletes.
+    std::shared_ptr<DelVector> ndv2;
+    ndv->add_dels_as_new_version({4, 5}, 3, &ndv2);
+    ASSERT_EQ(SparseRange<>({{1, 6}, {7, 8}, {90000, 90001}}), ndv2->deleted_ranges());
+    ASSERT_EQ(SparseRange<>({{1, 4}, {7, 8}, {90000, 90001}}), ndv->deleted_ranges());
+};
+
 } // namespace starrocks
@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include "common/config.h"
+
 namespace starrocks {
 
 TEST(DeltaWriterTest, test_partial_update_sort_key_conflict_check) {
@@ -127,4 +129,26 @@ TEST(DeltaWriterTest, test_partial_update_sort_key_conflict_check) {
     }
 }
 
-} // namespace starrocks
\ No newline at end of file
+TEST(DeltaWriterTest, test_resolve_auto_partial_update_mode) {
+    auto old_min_columns = config::auto_column_mode_partial_update_min_columns;
+    auto old_max_ratio = config::auto_column_mode_partial_update_max_ratio;
+    config::auto_column_mode_partial_update_min_columns = 50;
+    config::auto_column_mode_partial_update_max_ratio = 0.2;
+
+    // narrow table
+    ASSERT_EQ(PartialUpdateMode::ROW_MODE, DeltaWriter::resolve_auto_partial_update_mode(2, 10, 1));
+    // wide table with a few columns updated
+    ASSERT_EQ(PartialUpdateMode::COLUMN_UPSERT_MODE, DeltaWriter::resolve_auto_partial_update_mode(2, 300, 1));
+    ASSERT_EQ(PartialUpdateMode::COLUMN_UPSERT_MODE, DeltaWriter::resolve_auto_partial_update_mode(21, 101, 1));
+    // wide table with most columns updated
+    ASSERT_EQ(PartialUpdateMode::ROW_MODE, DeltaWriter::resolve_auto_partial_update_mode(22, 101, 1));
+    ASSERT_EQ(PartialUpdateMode::ROW_MODE, DeltaWriter::resolve_auto_partial_update_mode(200, 300, 1));
+
+    config::auto_column_mode_partial_update_min_columns = 0;
+    ASSERT_EQ(PartialUpdateMode::ROW_MODE, DeltaWriter::resolve_auto_partial_update_mode(2, 300, 1));
+
+    config::auto_column_mode_partial_update_min_columns = old_min_columns;
+    config::auto_column_mode_partial_update_max_ratio = old_max_ratio;
+}
+
+} // namespace starrocks
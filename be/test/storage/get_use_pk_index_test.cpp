@@ -326,6 +326,19 @@ TEST_F(GetUsePkIndexTest, single_segment) {
     test_single_rowset_read(seed, true, true);
 }
 
+TEST_F(GetUsePkIndexTest, fallback_if_index_not_loaded) {
+    _num_row = 10000;
+    _num_segment = 3;
+    test_single_rowset_read(0, false, false);
+
+    // the pointer reads fall back to scan the segments rather than load the index
+    auto& index_cache = StorageEngine::instance()->update_manager()->index_cache();
+    (void)index_cache.remove_by_key(_tablet->tablet_id());
+    read_using_pk_index(100, 2, false, true);
+    read_using_pk_index(_num_row, 2, false, false);
+    ASSERT_EQ(nullptr, index_cache.get(_tablet->tablet_id()));
+}
+
 TEST_F(GetUsePkIndexTest, multi_segment) {
     const int32_t seed = 0;
     _num_row = 10000;
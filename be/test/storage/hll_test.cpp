@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "util/hash_util.hpp"
 #include "util/phmap/phmap.h"
 #include "util/slice.h"
@@ -193,6 +195,34 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, MergeSerialized) {
+    // empty, explicit, sparse and full
+    std::vector<HyperLogLog> hlls(4);
+    const int sizes[] = {0, 100, 1000, 64 * 1024};
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < sizes[i]; ++j) {
+            hlls[i].update(hash(i * 1000000 + j));
+        }
+    }
+    std::vector<uint8_t> buf(HLL_REGISTERS_COUNT + 1);
+    for (const auto& dst : hlls) {
+        for (const auto& src : hlls) {
+            size_t len = src.serialize(buf.data());
+            HyperLogLog expected(dst);
+            expected.merge(HyperLogLog(Slice(buf.data(), len)));
+            HyperLogLog actual(dst);
+            ASSERT_TRUE(actual.merge_serialized(Slice(buf.data(), len)));
+            ASSERT_EQ(expected.estimate_cardinality(), actual.estimate_cardinality());
+        }
+    }
+
+    HyperLogLog hll(hlls[1]);
+    buf[0] = 60;
+    ASSERT_FALSE(hll.merge_serialized(Slice(buf.data(), 1)));
+    ASSERT_FALSE(hll.merge_serialized(Slice((char*)nullptr, 0)));
+    ASSERT_EQ(hlls[1].estimate_cardinality(), hll.estimate_cardinality());
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
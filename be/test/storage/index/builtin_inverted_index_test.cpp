@@ -0,0 +1,141 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "fs/fs_util.h"
+#include "storage/index/inverted/builtin/builtin_plugin.h"
+#include "storage/index/inverted/inverted_index_option.h"
+#include "storage/index/inverted/inverted_plugin_factory.h"
+#include "storage/types.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class BuiltinInvertedIndexTest : public testing::Test {
+protected:
+    void SetUp() override {
+        CHECK_OK(fs::remove_all(_test_dir));
+        CHECK_OK(fs::create_directories(_test_dir));
+    }
+
+    void TearDown() override { (void)fs::remove_all(_test_dir); }
+
+    std::shared_ptr<TabletIndex> prepare_tablet_index(const std::string& parser) {
+        auto tablet_index = std::make_shared<TabletIndex>();
+        tablet_index->add_common_properties(INVERTED_IMP_KEY, TYPE_BUILTIN);
+        tablet_index->add_index_properties(INVERTED_INDEX_PARSER_KEY, parser);
+        return tablet_index;
+    }
+
+    std::unique_ptr<InvertedReader> write_index(const std::shared_ptr<TabletIndex>& tablet_index,
+                                                const std::vector<std::string>& values, const std::string& path) {
+        ASSIGN_OR_ABORT(auto imp_type, get_inverted_imp_type(*tablet_index));
+        EXPECT_EQ(InvertedImplementType::BUILTIN, imp_type);
+        ASSIGN_OR_ABORT(auto plugin, InvertedPluginFactory::get_plugin(imp_type));
+
+        std::unique_ptr<InvertedWriter> writer;
+        CHECK_OK(plugin->create_inverted_index_writer(get_type_info(TYPE_VARCHAR), "c1", path, tablet_index.get(),
+                                                      &writer));
+        CHECK_OK(writer->init());
+        for (const auto& value : values) {
+            if (value == "NULL") {
+                writer->add_nulls(1);
+            } else {
+                Slice slice(value);
+                writer->add_values(&slice, 1);
+            }
+        }
+        CHECK_OK(writer->finish());
+
+        std::unique_ptr<InvertedReader> reader;
+        CHECK_OK(plugin->create_inverted_index_reader(path, tablet_index, TYPE_VARCHAR, &reader));
+        return reader;
+    }
+
+    static std::vector<uint32_t> query(InvertedReader* reader, const std::string& value,
+                                       InvertedIndexQueryType query_type) {
+        Slice slice(value);
+        roaring::Roaring result;
+        CHECK_OK(reader->query(nullptr, "c1", &slice, query_type, &result));
+        std::vector<uint32_t> rows(result.cardinality());
+        result.toUint32Array(rows.data());
+        return rows;
+    }
+
+    const std::string _test_dir = "builtin_inverted_index_test";
+};
+
+TEST_F(BuiltinInvertedIndexTest, test_untokenized) {
+    auto tablet_index = prepare_tablet_index(INVERTED_INDEX_PARSER_NONE);
+    // More values than a term block, to look up the terms across the blocks.
+    std::vector<std::string> values;
+    for (int i = 0; i < 1000; i++) {
+        values.emplace_back(i == 500 ? "NULL" : fmt::format("value_{:04d}", i % 300));
+    }
+    auto reader = write_index(tablet_index, values, _test_dir + "/untokenized.ivt");
+    ASSERT_TRUE(BuiltinInvertedPlugin::is_index_files(kBuiltinIndexFileName));
+
+    using Rows = std::vector<uint32_t>;
+    ASSERT_EQ(Rows({7, 307, 607, 907}), query(reader.get(), "value_0007", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({299, 599, 899}), query(reader.get(), "value_0299", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({}), query(reader.get(), "value_0300", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({}), query(reader.get(), "a", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({0, 300, 600, 900}), query(reader.get(), "value_0001", InvertedIndexQueryType::LESS_THAN_QUERY));
+    ASSERT_EQ(Rows({0, 1, 300, 301, 600, 601, 900, 901}),
+              query(reader.get(), "value_0001", InvertedIndexQueryType::LESS_EQUAL_QUERY));
+    ASSERT_EQ(Rows({299, 599, 899}), query(reader.get(), "value_0298", InvertedIndexQueryType::GREATER_THAN_QUERY));
+    ASSERT_EQ(999, query(reader.get(), "value", InvertedIndexQueryType::GREATER_EQUAL_QUERY).size());
+    ASSERT_EQ(Rows({10, 110, 210, 310, 410, 510, 610, 710, 810, 910}),
+              query(reader.get(), "%10", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(40, query(reader.get(), "value_002?", InvertedIndexQueryType::MATCH_WILDCARD_QUERY).size());
+    // The row 500 is null.
+    ASSERT_EQ(299, query(reader.get(), "value_02%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY).size());
+
+    roaring::Roaring nulls;
+    ASSERT_OK(reader->query_null(nullptr, "c1", &nulls));
+    ASSERT_EQ(roaring::Roaring::bitmapOf(1, 500), nulls);
+}
+
+TEST_F(BuiltinInvertedIndexTest, test_tokenized) {
+    auto tablet_index = prepare_tablet_index(INVERTED_INDEX_PARSER_ENGLISH);
+    std::vector<std::string> values = {"Connection refused by host-1", "connection reset", "NULL",
+                                       "host-2 refused the Connection", "", "timeout on host-1"};
+    auto reader = write_index(tablet_index, values, _test_dir + "/tokenized.ivt");
+
+    using Rows = std::vector<uint32_t>;
+    ASSERT_EQ(Rows({0, 1, 3}), query(reader.get(), "connection", InvertedIndexQueryType::EQUAL_QUERY));
+    // The terms of the query are lower cased and intersected.
+    ASSERT_EQ(Rows({0, 3}), query(reader.get(), "REFUSED connection", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({0}), query(reader.get(), "host 1 refused", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({}), query(reader.get(), "connection timeout", InvertedIndexQueryType::EQUAL_QUERY));
+    ASSERT_EQ(Rows({0, 1, 3}), query(reader.get(), "conn*", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+    ASSERT_EQ(Rows({0, 1, 3}), query(reader.get(), "%SE%", InvertedIndexQueryType::MATCH_WILDCARD_QUERY));
+
+    Slice phrase("refused by");
+    roaring::Roaring result;
+    ASSERT_TRUE(reader->query(nullptr, "c1", &phrase, InvertedIndexQueryType::MATCH_PHRASE_QUERY, &result)
+                        .is_not_supported());
+}
+
+TEST_F(BuiltinInvertedIndexTest, test_chinese_parser) {
+    auto tablet_index = prepare_tablet_index(INVERTED_INDEX_PARSER_CHINESE);
+    std::unique_ptr<InvertedWriter> writer;
+    auto st = BuiltinInvertedPlugin::get_instance().create_inverted_index_writer(
+            get_type_info(TYPE_VARCHAR), "c1", _test_dir + "/chinese.ivt", tablet_index.get(), &writer);
+    ASSERT_TRUE(st.is_not_supported());
+}
+
+} // namespace starrocks
@@ -0,0 +1,90 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/index/vector/vector_exact_search.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+TEST(VectorExactSearchTest, test_parse_metric) {
+    ASSIGN_OR_ABORT(auto metric, VectorExactSearch::parse_metric("L2_DISTANCE"));
+    ASSERT_EQ(VectorMetric::L2_DISTANCE, metric);
+    ASSERT_TRUE(VectorExactSearch::is_ascending(metric));
+    ASSIGN_OR_ABORT(metric, VectorExactSearch::parse_metric("cosine_similarity"));
+    ASSERT_FALSE(VectorExactSearch::is_ascending(metric));
+    ASSERT_TRUE(VectorExactSearch::parse_metric("cosine_distance").status().is_not_supported());
+}
+
+TEST(VectorExactSearchTest, test_compute_distances) {
+    // The dimension covers both the vectorized loop and the tail.
+    const size_t dim = 11;
+    std::vector<float> query(dim);
+    std::vector<float> vectors(3 * dim);
+    for (size_t i = 0; i < dim; i++) {
+        query[i] = static_cast<float>(i);
+        vectors[i] = static_cast<float>(i);
+        vectors[dim + i] = static_cast<float>(i) + 1;
+        vectors[2 * dim + i] = static_cast<float>(i) * 2;
+    }
+    std::vector<float> distances(3);
+    VectorExactSearch::compute_distances(VectorMetric::L2_DISTANCE, false, query.data(), vectors.data(), dim, 3,
+                                         distances.data());
+    ASSERT_FLOAT_EQ(0, distances[0]);
+    ASSERT_FLOAT_EQ(dim, distances[1]);
+    // sum of i^2 for i in [0, 10]
+    ASSERT_FLOAT_EQ(385, distances[2]);
+
+    VectorExactSearch::compute_distances(VectorMetric::INNER_PRODUCT, false, query.data(), vectors.data(), dim, 3,
+                                         distances.data());
+    ASSERT_FLOAT_EQ(385, distances[0]);
+    ASSERT_FLOAT_EQ(385 + 55, distances[1]);
+    ASSERT_FLOAT_EQ(770, distances[2]);
+
+    VectorExactSearch::compute_distances(VectorMetric::COSINE_SIMILARITY, false, query.data(), vectors.data(), dim, 3,
+                                         distances.data());
+    ASSERT_NEAR(1, distances[0], 1e-6);
+    ASSERT_NEAR(1, distances[2], 1e-6);
+    ASSERT_LT(distances[1], 1);
+}
+
+TEST(VectorExactSearchTest, test_select_closest) {
+    std::vector<int64_t> ids = {10, 11, 12, 13, 14};
+    std::vector<float> distances = {5, 1, 4, 2, 3};
+    std::vector<int64_t> result_ids;
+    std::vector<float> result_distances;
+
+    VectorExactSearch::select_closest(VectorMetric::L2_DISTANCE, ids, distances, 3, 0, &result_ids,
+                                      &result_distances);
+    ASSERT_EQ(std::vector<int64_t>({11, 13, 14}), result_ids);
+    ASSERT_EQ(std::vector<float>({1, 2, 3}), result_distances);
+
+    VectorExactSearch::select_closest(VectorMetric::COSINE_SIMILARITY, ids, distances, 2, 0, &result_ids,
+                                      &result_distances);
+    ASSERT_EQ(std::vector<int64_t>({10, 12}), result_ids);
+
+    // Within the range.
+    VectorExactSearch::select_closest(VectorMetric::L2_DISTANCE, ids, distances, 10, 2.5, &result_ids,
+                                      &result_distances);
+    ASSERT_EQ(std::vector<int64_t>({11, 13}), result_ids);
+    VectorExactSearch::select_closest(VectorMetric::INNER_PRODUCT, ids, distances, 10, 4, &result_ids,
+                                      &result_distances);
+    ASSERT_EQ(std::vector<int64_t>({10, 12}), result_ids);
+}
+
+} // namespace starrocks
@@ -23,6 +23,7 @@
 #include "runtime/mem_pool.h"
 #include "storage/index/index_descriptor.h"
 #include "storage/index/vector/tenann/tenann_index_utils.h"
+#include "storage/index/vector/vector_index_deferred_builder.h"
 #include "storage/index/vector/vector_index_writer.h"
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bitmap_index_writer.h"
@@ -60,11 +61,15 @@ protected:
         return tablet_index;
     }
 
-    void write_vector_index(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index) {
+    void write_vector_index(const std::string& path, const std::shared_ptr<TabletIndex>& tablet_index,
+                            bool allow_deferred_build = true) {
         DeferOp op([&] { ASSERT_TRUE(fs::path_exist(path)); });
 
         std::unique_ptr<VectorIndexWriter> vector_index_writer;
         VectorIndexWriter::create(tablet_index, path, false, &vector_index_writer);
+        if (!allow_deferred_build) {
+            vector_index_writer->disable_deferred_build();
+        }
         CHECK_OK(vector_index_writer->init());
 
         // construct columns
@@ -157,4 +162,27 @@ TEST_F(VectorIndexWriterTest, testwrite_with_empty_mark) {
     check_empty(index_path);
 }
 
+TEST_F(VectorIndexWriterTest, test_write_with_deferred_mark) {
+    config::enable_vector_index_deferred_build = true;
+    DeferOp reset_config([] { config::enable_vector_index_deferred_build = false; });
+    auto tablet_index = prepare_tablet_index();
+    tablet_index->add_common_properties("index_type", "hnsw");
+    tablet_index->add_common_properties("dim", "3");
+    tablet_index->add_common_properties("is_vector_normed", "false");
+    tablet_index->add_common_properties("metric_type", "l2_distance");
+    tablet_index->add_index_properties("efconstruction", "40");
+    tablet_index->add_index_properties("M", "16");
+    tablet_index->add_search_properties("efsearch", "40");
+
+    auto index_path = test_vector_index_dir + "/" + vector_index_name;
+    write_vector_index(index_path, tablet_index);
+    ASSIGN_OR_ABORT(auto deferred, VectorIndexDeferredBuilder::is_deferred(index_path));
+    ASSERT_TRUE(deferred);
+
+    // The background building writes the index even if the deferred build is enabled.
+    write_vector_index(index_path, tablet_index, false);
+    ASSIGN_OR_ABORT(deferred, VectorIndexDeferredBuilder::is_deferred(index_path));
+    ASSERT_FALSE(deferred);
+}
+
 } // namespace starrocks
\ No newline at end of file
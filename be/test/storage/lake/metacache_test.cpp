@@ -32,6 +32,7 @@
 #include "test_util.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
+#include "util/defer_op.h"
 
 namespace starrocks::lake {
 
@@ -361,4 +362,35 @@ TEST_F(LakeMetacacheTest, test_combined_txn_log_cache) {
     ASSERT_TRUE(log4 == nullptr);
 }
 
+TEST_F(LakeMetacacheTest, test_admission) {
+    auto old_ghost_list_size = config::lake_metacache_admission_ghost_list_size;
+    config::lake_metacache_admission_ghost_list_size = 100;
+    DeferOp defer([&]() { config::lake_metacache_admission_ghost_list_size = old_ghost_list_size; });
+
+    // 32 shards, 1000 bytes for each shard.
+    Metacache metacache(32 * 1000);
+    auto dv = std::make_shared<DelVector>();
+    std::vector<uint32_t> dels{1, 2, 3};
+    dv->init(1, dels.data(), dels.size());
+    ASSERT_GT(dv->memory_usage(), 0);
+    ASSERT_LE(dv->memory_usage(), 1000);
+
+    // not full, cache it directly.
+    metacache.cache_delvec("dv0", dv);
+    ASSERT_TRUE(metacache.lookup_delvec("dv0") != nullptr);
+
+    // fill the cache with schemas.
+    auto schema = std::make_shared<TabletSchema>();
+    for (int i = 0; i < 10000; i++) {
+        metacache.cache_tablet_schema(fmt::format("schema_{}", i), schema, 1000);
+    }
+    ASSERT_EQ(metacache.capacity(), metacache.memory_usage());
+
+    // the first access is rejected, the second one is admitted.
+    metacache.cache_delvec("dv1", dv);
+    ASSERT_TRUE(metacache.lookup_delvec("dv1") == nullptr);
+    metacache.cache_delvec("dv1", dv);
+    ASSERT_TRUE(metacache.lookup_delvec("dv1") != nullptr);
+}
+
 } // namespace starrocks::lake
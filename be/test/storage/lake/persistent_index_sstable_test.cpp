@@ -422,6 +422,58 @@ TEST_F(PersistentIndexSstableTest, test_persistent_index_sstable) {
     }
 }
 
+TEST_F(PersistentIndexSstableTest, test_multi_get_unordered_keys) {
+    const int N = 10000;
+    const std::string filename = "test_multi_get_unordered_keys.sst";
+    ASSIGN_OR_ABORT(auto file, fs::new_writable_file(lake::join_path(kTestDir, filename)));
+    phmap::btree_map<std::string, std::list<IndexValueWithVer>, std::less<>> map;
+    // only even keys exist, so that the odd keys are absent in the key range of the data blocks.
+    for (int i = 0; i < N; i += 2) {
+        std::list<IndexValueWithVer> index_value_vers;
+        index_value_vers.emplace_front(100, i);
+        map.insert({fmt::format("test_key_{:016X}", i), index_value_vers});
+    }
+    uint64_t filesize = 0;
+    ASSERT_OK(PersistentIndexSstable::build_sstable(map, file.get(), &filesize));
+    ASSERT_OK(file->close());
+    std::unique_ptr<PersistentIndexSstable> sst = std::make_unique<PersistentIndexSstable>();
+    ASSIGN_OR_ABORT(auto read_file, fs::new_random_access_file(lake::join_path(kTestDir, filename)));
+    std::unique_ptr<Cache> cache_ptr;
+    cache_ptr.reset(new_lru_cache(1024 * 1024));
+    PersistentIndexSstablePB sstable_pb;
+    sstable_pb.set_filename(filename);
+    sstable_pb.set_filesize(filesize);
+    ASSERT_OK(sst->init(std::move(read_file), sstable_pb, cache_ptr.get()));
+
+    const int M = 2000;
+    std::vector<std::string> keys_str(M);
+    std::vector<Slice> keys(M);
+    std::vector<IndexValue> values(M, IndexValue(NullIndexValue));
+    KeyIndexSet key_indexes;
+    KeyIndexSet expected_found;
+    for (int i = 0; i < M; i++) {
+        // out of order keys
+        int r = (i * 7919) % (N + 2);
+        keys_str[i] = fmt::format("test_key_{:016X}", r);
+        keys[i] = Slice(keys_str[i]);
+        key_indexes.insert(i);
+        if (r % 2 == 0 && r < N) {
+            expected_found.insert(i);
+        }
+    }
+    KeyIndexSet found;
+    ASSERT_OK(sst->multi_get(keys.data(), key_indexes, -1, values.data(), &found));
+    ASSERT_EQ(expected_found, found);
+    for (int i = 0; i < M; i++) {
+        int r = (i * 7919) % (N + 2);
+        if (expected_found.count(i) > 0) {
+            ASSERT_EQ(IndexValue(r), values[i]);
+        } else {
+            ASSERT_EQ(IndexValue(NullIndexValue), values[i]);
+        }
+    }
+}
+
 TEST_F(PersistentIndexSstableTest, test_index_value_protobuf) {
     IndexValuesWithVerPB index_value_pb;
     for (int i = 0; i < 10; i++) {
@@ -285,6 +285,97 @@ TEST_P(LakeTabletWriterTest, test_close_without_finish) {
     ASSERT_TRUE(fs->path_exists(seg_path).is_not_found());
 }
 
+TEST_P(LakeTabletWriterTest, test_write_with_flush_async) {
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(kTestDirectory));
+    std::vector<int> k0{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::vector<int> k1{11, 12, 13, 14, 15};
+
+    auto c0 = Int32Column::create();
+    auto c1 = Int32Column::create();
+    auto c2 = Int32Column::create();
+    auto c3 = Int32Column::create();
+    c0->append_numbers(k0.data(), k0.size() * sizeof(int));
+    c1->append_numbers(k0.data(), k0.size() * sizeof(int));
+    c2->append_numbers(k1.data(), k1.size() * sizeof(int));
+    c3->append_numbers(k1.data(), k1.size() * sizeof(int));
+
+    Chunk chunk0({c0, c1}, _schema);
+    Chunk chunk1({c2, c3}, _schema);
+
+    VersionedTablet tablet(_tablet_mgr.get(), _tablet_metadata);
+    ASSIGN_OR_ABORT(auto writer, tablet.new_writer(kHorizontal, next_id()));
+    ASSERT_OK(writer->open());
+
+    // the segments may be finalized in the background, but they are kept in order.
+    ASSERT_OK(writer->write(chunk0));
+    ASSERT_OK(writer->flush_async());
+    ASSERT_OK(writer->write(chunk1));
+    ASSERT_OK(writer->flush_async());
+    ASSERT_OK(writer->write(chunk0));
+    ASSERT_OK(writer->finish());
+
+    auto files = writer->files();
+    ASSERT_EQ(3, files.size());
+    ASSERT_EQ(files[0].size.value() + files[1].size.value() + files[2].size.value(), writer->data_size());
+    ASSERT_EQ(2 * k0.size() + k1.size(), writer->num_rows());
+    writer->close();
+
+    OlapReaderStatistics statistics;
+    SegmentReadOptions opts;
+    opts.fs = fs;
+    opts.tablet_id = _tablet_metadata->id();
+    opts.stats = &statistics;
+    opts.chunk_size = 1024;
+
+    auto check_segment = [&](const FileInfo& file, uint32_t id, const std::vector<int>& keys) {
+        ASSIGN_OR_ABORT(auto segment,
+                        Segment::open(fs, FileInfo{_tablet_mgr->segment_location(_tablet_metadata->id(), file.path)},
+                                      id, _tablet_schema));
+        ASSIGN_OR_ABORT(auto seg_iter, segment->new_iterator(*_schema, opts));
+        auto read_chunk_ptr = ChunkHelper::new_chunk(*_schema, 1024);
+        ASSERT_OK(seg_iter->get_next(read_chunk_ptr.get()));
+        ASSERT_EQ(keys.size(), read_chunk_ptr->num_rows());
+        for (int i = 0, sz = keys.size(); i < sz; i++) {
+            EXPECT_EQ(keys[i], read_chunk_ptr->get(i)[0].get_int32());
+        }
+        seg_iter->close();
+    };
+    check_segment(files[0], 0, k0);
+    check_segment(files[1], 1, k1);
+    check_segment(files[2], 2, k0);
+}
+
+TEST_P(LakeTabletWriterTest, test_close_after_flush_async) {
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(kTestDirectory));
+    std::vector<int> k0{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    auto c0 = Int32Column::create();
+    auto c1 = Int32Column::create();
+    c0->append_numbers(k0.data(), k0.size() * sizeof(int));
+    c1->append_numbers(k0.data(), k0.size() * sizeof(int));
+
+    Chunk chunk0({c0, c1}, _schema);
+
+    VersionedTablet tablet(_tablet_mgr.get(), _tablet_metadata);
+    ASSIGN_OR_ABORT(auto writer, tablet.new_writer(kHorizontal, next_id()));
+    ASSERT_OK(writer->open());
+
+    ASSERT_OK(writer->write(chunk0));
+    ASSERT_OK(writer->flush_async());
+    ASSERT_OK(writer->write(chunk0));
+    ASSERT_OK(writer->flush_async());
+
+    // `close()` without `finish()` waits for the segments being finalized, and deletes them.
+    writer->close();
+    ExecEnv::GetInstance()->delete_file_thread_pool()->wait();
+
+    ASSERT_EQ(2, writer->files().size());
+    for (const auto& file : writer->files()) {
+        auto seg_path = _tablet_mgr->segment_location(_tablet_metadata->id(), file.path);
+        ASSERT_TRUE(fs->path_exists(seg_path).is_not_found());
+    }
+}
+
 TEST_P(LakeTabletWriterTest, test_vertical_write_close_without_finish) {
     ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(kTestDirectory));
 
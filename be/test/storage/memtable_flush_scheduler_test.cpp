@@ -0,0 +1,72 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/memtable_flush_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+using Candidate = MemTableFlushScheduler::Candidate;
+
+static Candidate make_candidate(int64_t size, int64_t last_write_ts, int64_t flushed_segments = 0,
+                                int64_t queueing_memtables = 0) {
+    Candidate candidate;
+    candidate.write_buffer_size = size;
+    candidate.last_write_ts = last_write_ts;
+    candidate.flushed_segments = flushed_segments;
+    candidate.queueing_memtables = queueing_memtables;
+    return candidate;
+}
+
+TEST(MemTableFlushSchedulerTest, test_bytes_to_release) {
+    MemTracker unlimited(-1, "unlimited");
+    unlimited.consume(1000);
+    ASSERT_EQ(0, MemTableFlushScheduler::bytes_to_release(&unlimited, 80));
+    unlimited.release(1000);
+
+    MemTracker tracker(1000, "limited");
+    tracker.consume(700);
+    ASSERT_EQ(0, MemTableFlushScheduler::bytes_to_release(&tracker, 80));
+    tracker.consume(200);
+    ASSERT_EQ(100, MemTableFlushScheduler::bytes_to_release(&tracker, 80));
+    ASSERT_EQ(0, MemTableFlushScheduler::bytes_to_release(&tracker, 0));
+    ASSERT_EQ(0, MemTableFlushScheduler::bytes_to_release(nullptr, 80));
+    tracker.release(900);
+}
+
+TEST(MemTableFlushSchedulerTest, test_pick) {
+    const int64_t now = 1000;
+    std::vector<Candidate> candidates;
+    candidates.push_back(make_candidate(100, now));           // 0: active
+    candidates.push_back(make_candidate(300, now, 2));        // 1: active, more segments
+    candidates.push_back(make_candidate(300, now));           // 2: active
+    candidates.push_back(make_candidate(50, now - 10));       // 3: idle
+    candidates.push_back(make_candidate(500, now, 0, 1));     // 4: flushing
+    candidates.push_back(make_candidate(0, now));             // 5: empty
+    candidates.push_back(make_candidate(400, 0));             // 6: never written
+    candidates.push_back(make_candidate(5, now - 10));        // 7: too small
+
+    ASSERT_TRUE(MemTableFlushScheduler::pick(candidates, 0, 10, now).empty());
+    ASSERT_EQ(std::vector<size_t>({3}), MemTableFlushScheduler::pick(candidates, 10, 10, now));
+    ASSERT_EQ(std::vector<size_t>({3, 2}), MemTableFlushScheduler::pick(candidates, 300, 10, now));
+    ASSERT_EQ(std::vector<size_t>({3, 2, 1}), MemTableFlushScheduler::pick(candidates, 400, 10, now));
+    ASSERT_EQ(std::vector<size_t>({3, 2, 1, 0}), MemTableFlushScheduler::pick(candidates, 10000, 10, now));
+    ASSERT_EQ(std::vector<size_t>({3, 2, 1, 0, 7}), MemTableFlushScheduler::pick(candidates, 10000, 0, now));
+    ASSERT_EQ(std::vector<size_t>({2, 1}), MemTableFlushScheduler::pick(candidates, 10000, 200, now));
+}
+
+} // namespace starrocks
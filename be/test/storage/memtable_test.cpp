@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <random>
 
 #include "column/datum_tuple.h"
@@ -291,6 +292,146 @@ TEST_F(MemTableTest, testDupKeysInsertFlushRead) {
     ASSERT_EQ(n, pkey_read);
 }
 
+TEST_F(MemTableTest, testDupKeysInsertSortedRuns) {
+    const int32_t old_max_sorted_runs = config::memtable_max_sorted_runs;
+    // 8: merge the runs, 2: too many runs to merge, 0: always sort
+    for (int32_t max_sorted_runs : {8, 2, 0}) {
+        config::memtable_max_sorted_runs = max_sorted_runs;
+        const string path = "./MemTableTest_testDupKeysInsertSortedRuns";
+        MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::DUP_KEYS),
+                "pk int,name varchar,pv int", path);
+        const size_t n = 3000;
+        auto pchunk = gen_chunk(*_slots, n);
+        // three overlapping runs in key order, the second one is split into two inserts
+        vector<uint32_t> runs[3];
+        for (uint32_t i = 0; i < 1000; i++) {
+            runs[0].emplace_back(i);
+        }
+        for (uint32_t i = 500; i < 2500; i++) {
+            runs[1].emplace_back(i);
+        }
+        for (uint32_t i = 0; i < n; i += 3) {
+            runs[2].emplace_back(i);
+        }
+        size_t total = 0;
+        ASSERT_OK(_mem_table->insert(*pchunk, runs[0].data(), 0, runs[0].size()).status());
+        ASSERT_OK(_mem_table->insert(*pchunk, runs[1].data(), 0, 700).status());
+        ASSERT_OK(_mem_table->insert(*pchunk, runs[1].data(), 700, runs[1].size() - 700).status());
+        ASSERT_OK(_mem_table->insert(*pchunk, runs[2].data(), 0, runs[2].size()).status());
+        for (const auto& run : runs) {
+            total += run.size();
+        }
+        ASSERT_OK(_mem_table->finalize());
+        ASSERT_OK(_mem_table->flush());
+        RowsetSharedPtr rowset = *_writer->build();
+        unique_ptr<Schema> read_schema = create_schema("pk int", 1);
+        OlapReaderStatistics stats;
+        RowsetReadOptions rs_opts;
+        rs_opts.sorted = false;
+        rs_opts.use_page_cache = false;
+        rs_opts.stats = &stats;
+        auto itr = rowset->new_iterator(*read_schema, rs_opts);
+        ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+        std::shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*read_schema, 4096);
+        size_t pkey_read = 0;
+        int last_value = 0;
+        while (true) {
+            Status st = (*itr)->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            auto column = chunk->get_column_by_name("pk");
+            for (size_t i = 0; i < column->size(); i++) {
+                int new_value = column->get(i).get_int32();
+                ASSERT_LE(last_value, new_value);
+                last_value = new_value;
+            }
+            pkey_read += chunk->num_rows();
+            chunk->reset();
+        }
+        ASSERT_EQ(total, pkey_read);
+        TearDown();
+    }
+    config::memtable_max_sorted_runs = old_max_sorted_runs;
+}
+
+TEST_F(MemTableTest, testDupKeysInsertInOrder) {
+    const string path = "./MemTableTest_testDupKeysInsertInOrder";
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::DUP_KEYS), "pk int,name varchar,pv int",
+            path);
+    const size_t n = 3000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes(n);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    ASSERT_OK(_mem_table->insert(*pchunk, indexes.data(), 0, 1000).status());
+    ASSERT_OK(_mem_table->insert(*pchunk, indexes.data(), 1000, n - 1000).status());
+    ASSERT_OK(_mem_table->finalize());
+    auto result = _mem_table->get_result_chunk();
+    ASSERT_EQ(n, result->num_rows());
+    auto column = result->get_column_by_index(0);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(pchunk->get_column_by_index(0)->get(i).get_int32(), column->get(i).get_int32());
+    }
+    ASSERT_OK(_mem_table->flush());
+}
+
+TEST_F(MemTableTest, testDupKeysRecycleChunk) {
+    const string path = "./MemTableTest_testDupKeysRecycleChunk";
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::DUP_KEYS), "pk int,name varchar,pv int",
+            path);
+    const int64_t old_max_bytes = config::memtable_recycle_chunk_max_bytes;
+    auto recycler = std::make_shared<MemTableChunkRecycler>(_mem_tracker.get());
+    const size_t n = 3000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes;
+    for (uint32_t i = 0; i < n; i++) {
+        indexes.emplace_back(n - 1 - i);
+    }
+    auto flush_memtable = [&]() {
+        _mem_table = std::make_unique<MemTable>(1, &_vectorized_schema, _slots, _mem_table_sink.get(),
+                                                _mem_tracker.get());
+        _mem_table->set_chunk_recycler(recycler);
+        ASSERT_OK(_mem_table->insert(*pchunk, indexes.data(), 0, indexes.size()).status());
+        ASSERT_OK(_mem_table->finalize());
+        ASSERT_OK(_mem_table->flush());
+        _mem_table.reset();
+    };
+    flush_memtable();
+    ASSERT_GT(recycler->recycled_bytes(), 0);
+    // the next memtable takes the recycled chunk
+    flush_memtable();
+    ASSERT_GT(recycler->recycled_bytes(), 0);
+
+    // the chunk is too large to be kept
+    config::memtable_recycle_chunk_max_bytes = 1;
+    recycler->acquire();
+    flush_memtable();
+    ASSERT_EQ(0, recycler->recycled_bytes());
+    ASSERT_EQ(nullptr, recycler->acquire());
+    config::memtable_recycle_chunk_max_bytes = old_max_bytes;
+
+    RowsetSharedPtr rowset = *_writer->build();
+    unique_ptr<Schema> read_schema = create_schema("pk int", 1);
+    OlapReaderStatistics stats;
+    RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    std::shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*read_schema, 4096);
+    size_t pkey_read = 0;
+    while (true) {
+        Status st = (*itr)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        pkey_read += chunk->num_rows();
+        chunk->reset();
+    }
+    ASSERT_EQ(3 * n, pkey_read);
+}
+
 TEST_F(MemTableTest, testUniqKeysInsertFlushRead) {
     const string path = "./MemTableTest_testUniqKeysInsertFlushRead";
     MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::UNIQUE_KEYS), "pk int,name varchar,pv int",
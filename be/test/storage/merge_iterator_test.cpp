@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <random>
 #include <vector>
 
 #include "column/fixed_length_column.h"
@@ -225,6 +226,57 @@ TEST_F(MergeIteratorTest, test_issue_6167) {
     ASSERT_TRUE(st.is_end_of_file());
 }
 
+// NOLINTNEXTLINE
+TEST_F(MergeIteratorTest, merge_many_overlapping) {
+    // The rows of the same key are ordered by their sources, and the sources are output in runs.
+    const size_t num_children = 100;
+    std::mt19937 rng(0);
+    std::vector<std::pair<int32_t, uint16_t>> expected;
+    std::vector<std::vector<int32_t>> values(num_children);
+    for (size_t i = 0; i < num_children; i++) {
+        size_t num_rows = rng() % 300;
+        int32_t value = static_cast<int32_t>(rng() % 1000) - 500;
+        for (size_t j = 0; j < num_rows; j++) {
+            values[i].push_back(value);
+            expected.emplace_back(value, i);
+            value += rng() % 3 == 0 ? static_cast<int32_t>(rng() % 20) : 0;
+        }
+    }
+    std::stable_sort(expected.begin(), expected.end());
+
+    for (bool loser_tree : {true, false}) {
+        config::enable_loser_tree_merge = loser_tree;
+        std::vector<ChunkIteratorPtr> subs;
+        for (size_t i = 0; i < num_children; i++) {
+            if (values[i].empty()) {
+                // An empty child, which is exhausted at the first fill.
+                subs.push_back(std::make_shared<VectorChunkIterator>(_schema, COL_INT(std::vector<int32_t>{})));
+                continue;
+            }
+            auto sub = std::make_shared<VectorChunkIterator>(_schema, COL_INT(values[i]));
+            sub->chunk_size(1 + i % 64);
+            subs.push_back(sub);
+        }
+        auto iter = new_heap_merge_iterator(subs);
+        ASSERT_TRUE(iter->init_encoded_schema(EMPTY_GLOBAL_DICTMAPS).ok());
+
+        std::vector<std::pair<int32_t, uint16_t>> real;
+        std::vector<RowSourceMask> source_masks;
+        ChunkPtr chunk = ChunkHelper::new_chunk(iter->schema(), config::vector_chunk_size);
+        Status st;
+        while ((st = iter->get_next(chunk.get(), &source_masks)).ok()) {
+            ColumnPtr& c = chunk->get_column_by_index(0);
+            for (size_t i = 0; i < c->size(); i++) {
+                real.emplace_back(c->get(i).get_int32(), source_masks[real.size()].get_source_num());
+            }
+            chunk->reset();
+        }
+        ASSERT_TRUE(st.is_end_of_file()) << st;
+        ASSERT_EQ(expected, real) << "loser_tree: " << loser_tree;
+    }
+    config::enable_loser_tree_merge = true;
+}
+
 // NOLINTNEXTLINE
 TEST_F(MergeIteratorTest, mask_merge) {
     std::vector<int32_t> v1{1, 1, 2, 3, 4, 5};
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "column/fixed_length_column.h"
+#include "storage/chunk_helper.h"
 #include "fs/fs_util.h"
 #include "fs/key_cache.h"
 #include "storage/rowset/segment_writer.h"
@@ -110,4 +111,71 @@ TEST_F(SegmentMetaCollecterTest, test_open_and_collect) {
     EXPECT_EQ(0, col->get(0).get_int64());
 }
 
+TEST_F(SegmentMetaCollecterTest, test_collect_nonnull_count) {
+    TabletSchemaPB schema_pb;
+    auto key = schema_pb.add_column();
+    key->set_name("c0");
+    key->set_type("INT");
+    key->set_is_key(true);
+    key->set_is_nullable(false);
+    // c1: some nulls, c2: no null, c3: all nulls
+    for (const char* name : {"c1", "c2", "c3"}) {
+        auto col = schema_pb.add_column();
+        col->set_name(name);
+        col->set_type("INT");
+        col->set_is_key(false);
+        col->set_is_nullable(true);
+        col->set_aggregation("NONE");
+    }
+    auto tablet_schema = TabletSchema::create(schema_pb);
+
+    std::string segment_name = "segment_meta_collector_nonnull_count_test.dat";
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(segment_name));
+    ASSIGN_OR_ABORT(auto wf, fs->new_writable_file(segment_name));
+    SegmentWriter writer(std::move(wf), 0, tablet_schema, SegmentWriterOptions());
+    ASSERT_OK(writer.init());
+
+    const int num_rows = 100;
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, num_rows);
+    for (int i = 0; i < num_rows; ++i) {
+        auto& cols = chunk->columns();
+        cols[0]->append_datum(Datum(i));
+        cols[1]->append_datum(i % 3 == 0 ? Datum() : Datum(i));
+        cols[2]->append_datum(Datum(i));
+        cols[3]->append_datum(Datum());
+    }
+    ASSERT_OK(writer.append_chunk(*chunk));
+    uint64_t file_size, index_size, footer_pos;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_pos));
+    ASSIGN_OR_ABORT(auto segment, Segment::open(fs, FileInfo{segment_name}, 0, tablet_schema));
+
+    SegmentMetaCollecterParams params;
+    for (ColumnId cid = 0; cid < 4; ++cid) {
+        params.fields.emplace_back("nonnull_count");
+        params.field_type.emplace_back(LogicalType::TYPE_INT);
+        params.cids.emplace_back(cid);
+        params.read_page.emplace_back(true);
+    }
+    params.tablet_schema = tablet_schema;
+
+    SegmentMetaCollecter collecter(segment);
+    ASSERT_OK(collecter.init(&params));
+    ASSERT_OK(collecter.open());
+
+    std::vector<Int64Column::Ptr> results;
+    std::vector<Column*> columns;
+    for (int i = 0; i < 4; ++i) {
+        results.emplace_back(Int64Column::create());
+        columns.emplace_back(results.back().get());
+    }
+    ASSERT_OK(collecter.collect(&columns));
+    EXPECT_EQ(num_rows, results[0]->get(0).get_int64());
+    EXPECT_EQ(66, results[1]->get(0).get_int64());
+    EXPECT_EQ(num_rows, results[2]->get(0).get_int64());
+    EXPECT_EQ(0, results[3]->get(0).get_int64());
+
+    fs::delete_file(segment_name);
+}
+
 } // namespace starrocks
@@ -3127,6 +3127,31 @@ TEST_P(PersistentIndexTest, pindex_compaction_schedule_with_migration) {
     ASSERT_FALSE(mgr.is_running(tablet->tablet_id()));
 }
 
+TEST_P(PersistentIndexTest, pindex_preload) {
+    TabletSharedPtr tablet = create_tablet(rand(), rand());
+    ASSERT_OK(tablet->init());
+    tablet->set_enable_persistent_index(true);
+    TabletSharedPtr tablet2 = create_tablet(rand(), rand());
+    ASSERT_OK(tablet2->init());
+    tablet2->set_enable_persistent_index(false);
+    auto& index_cache = StorageEngine::instance()->update_manager()->index_cache();
+    index_cache.clear();
+
+    PersistentIndexCompactionManager mgr;
+    ASSERT_OK(mgr.preload({tablet, tablet2}));
+    mgr.wait_preload();
+    // only the tablet with persistent index is preloaded
+    ASSERT_EQ(1, mgr.preloaded_num());
+    auto index_entry = index_cache.get(tablet->tablet_id());
+    ASSERT_TRUE(index_entry != nullptr);
+    ASSERT_TRUE(index_entry->value().enable_persistent_index());
+    index_cache.release(index_entry);
+    ASSERT_TRUE(index_cache.get(tablet2->tablet_id()) == nullptr);
+
+    // the index in the cache is not loaded again
+    ASSERT_OK(tablet->updates()->preload_primary_index());
+}
+
 TEST_P(PersistentIndexTest, test_multi_l2_not_tmp_l1_update) {
     int64_t old_config = config::max_allow_pindex_l2_num;
     config::max_allow_pindex_l2_num = 100;
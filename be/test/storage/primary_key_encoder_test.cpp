@@ -23,6 +23,7 @@
 #include "column/schema.h"
 #include "gutil/stringprintf.h"
 #include "storage/chunk_helper.h"
+#include "testutil/assert.h"
 
 using namespace std;
 
@@ -199,4 +200,69 @@ TEST(PrimaryKeyEncoderTest, testEncodeVarcharLimit) {
     }
 }
 
+// The composite keys encoded column by column must be the same as the ones encoded row by row as the sort keys.
+TEST(PrimaryKeyEncoderTest, testEncodeCompositeColumnWise) {
+    auto sc = create_key_schema({TYPE_VARCHAR, TYPE_BIGINT, TYPE_VARCHAR, TYPE_TINYINT, TYPE_VARCHAR});
+    const int n = 100;
+    auto pchunk = ChunkHelper::new_chunk(*sc, n);
+    vector<string> strs;
+    for (int i = 0; i < n; i++) {
+        string str(i % 37, 'a' + i % 26);
+        if (i % 3 == 0 && !str.empty()) {
+            str[i % str.size()] = '\0';
+        }
+        strs.emplace_back(std::move(str));
+    }
+    for (int i = 0; i < n; i++) {
+        Datum tmp;
+        tmp.set_slice(strs[i]);
+        pchunk->columns()[0]->append_datum(tmp);
+        tmp.set_int64(i % 2 == 0 ? -i * 100003L : i * 100003L);
+        pchunk->columns()[1]->append_datum(tmp);
+        tmp.set_slice(strs[n - 1 - i]);
+        pchunk->columns()[2]->append_datum(tmp);
+        tmp.set_int8(static_cast<int8_t>(i - 50));
+        pchunk->columns()[3]->append_datum(tmp);
+        tmp.set_slice(strs[(i * 7) % n]);
+        pchunk->columns()[4]->append_datum(tmp);
+    }
+
+    unique_ptr<Column> expected;
+    ASSERT_OK(PrimaryKeyEncoder::create_column(*sc, &expected));
+    ASSERT_OK(PrimaryKeyEncoder::encode_sort_key(*sc, *pchunk, 0, n, expected.get()));
+
+    for (bool large_column : {false, true}) {
+        unique_ptr<Column> dest;
+        ASSERT_OK(PrimaryKeyEncoder::create_column(*sc, &dest, large_column));
+        PrimaryKeyEncoder::encode(*sc, *pchunk, 0, 10, dest.get());
+        PrimaryKeyEncoder::encode(*sc, *pchunk, 10, n - 10, dest.get());
+        ASSERT_EQ(n, dest->size());
+        for (int i = 0; i < n; i++) {
+            ASSERT_EQ(expected->get(i).get_slice(), dest->get(i).get_slice());
+        }
+
+        vector<uint32_t> indexes;
+        for (int i = n - 1; i >= 0; i -= 2) {
+            indexes.emplace_back(i);
+        }
+        dest->reset_column();
+        PrimaryKeyEncoder::encode_selective(*sc, *pchunk, indexes.data(), indexes.size(), dest.get());
+        ASSERT_EQ(indexes.size(), dest->size());
+        for (size_t i = 0; i < indexes.size(); i++) {
+            ASSERT_EQ(expected->get(indexes[i]).get_slice(), dest->get(i).get_slice());
+        }
+    }
+
+    unique_ptr<Column> dest;
+    ASSERT_OK(PrimaryKeyEncoder::create_column(*sc, &dest));
+    PrimaryKeyEncoder::encode(*sc, *pchunk, 0, n, dest.get());
+    auto dchunk = pchunk->clone_empty_with_schema();
+    ASSERT_OK(PrimaryKeyEncoder::decode(*sc, *dest, 0, n, dchunk.get()));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < sc->num_key_fields(); j++) {
+            ASSERT_EQ(pchunk->get_column_by_index(j)->debug_item(i), dchunk->get_column_by_index(j)->debug_item(i));
+        }
+    }
+}
+
 } // namespace starrocks
@@ -101,6 +101,27 @@ TEST(SparseRangeTest, range_intersection) {
     EXPECT_EQ(SparseRange({{1, 10}, {25, 26}, {30, 40}, {50, 65}}), r);
 }
 
+TEST(SparseRangeTest, range_subtraction) {
+    SparseRange<> r1({{1, 10}, {20, 40}, {50, 70}});
+
+    auto r = r1;
+    r -= SparseRange<>();
+    EXPECT_EQ(r1, r);
+
+    r = r1;
+    r -= SparseRange<>{{0, 100}};
+    EXPECT_EQ(SparseRange(), r);
+
+    r = r1;
+    r -= SparseRange<>{{2, 30}};
+    EXPECT_EQ(SparseRange({{1, 2}, {30, 40}, {50, 70}}), r);
+
+    // A range of the rhs overlapping two ranges, and several ranges of the rhs in one range.
+    r = r1;
+    r -= SparseRange<>({{0, 1}, {5, 25}, {26, 27}, {30, 31}, {39, 55}, {60, 61}, {70, 80}});
+    EXPECT_EQ(SparseRange({{1, 5}, {25, 26}, {27, 30}, {31, 39}, {55, 60}, {61, 70}}), r);
+}
+
 TEST(SparseRangeIteratorTest, covered_ranges) {
     SparseRange<> r1({{0, 10}, {20, 40}, {50, 70}});
     SparseRangeIterator<> iter = r1.new_iterator();
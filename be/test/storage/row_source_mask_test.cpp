@@ -229,4 +229,41 @@ TEST_F(RowSourceMaskTest, memory_masks_with_persistence) {
     ASSERT_FALSE(buffer.has_same_source(mask.get_source_num(), 4));
 }
 
+// NOLINTNEXTLINE
+TEST_F(RowSourceMaskTest, concurrent_readers) {
+    RowSourceMaskBuffer buffer(1, config::storage_root_path, 8);
+    std::vector<RowSourceMask> source_masks;
+    for (uint16_t i = 0; i < 100; i++) {
+        source_masks.emplace_back(RowSourceMask(i % 7, i % 2 == 0));
+        if (source_masks.size() == 3) {
+            ASSERT_TRUE(buffer.write(source_masks).ok());
+            source_masks.clear();
+        }
+    }
+    ASSERT_TRUE(buffer.write(source_masks).ok());
+    ASSERT_TRUE(buffer.persist().ok());
+
+    auto reader_1 = buffer.new_reader();
+    auto reader_2 = buffer.new_reader();
+    ASSERT_TRUE(reader_1.ok());
+    ASSERT_TRUE(reader_2.ok());
+    ASSERT_TRUE(reader_1.value()->flip_to_read().ok());
+    ASSERT_TRUE(reader_2.value()->flip_to_read().ok());
+    // The readers advance independently.
+    for (uint16_t i = 0; i < 100; i++) {
+        ASSERT_TRUE(reader_1.value()->has_remaining().value());
+        RowSourceMask mask = reader_1.value()->current();
+        ASSERT_EQ(i % 7, mask.get_source_num());
+        ASSERT_EQ(i % 2 == 0, mask.get_agg_flag());
+        reader_1.value()->advance();
+        if (i % 2 == 0) {
+            uint16_t j = i / 2;
+            ASSERT_TRUE(reader_2.value()->has_remaining().value());
+            ASSERT_EQ(j % 7, reader_2.value()->current().get_source_num());
+            reader_2.value()->advance();
+        }
+    }
+    ASSERT_FALSE(reader_1.value()->has_remaining().value());
+}
+
 } // namespace starrocks
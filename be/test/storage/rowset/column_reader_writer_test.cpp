@@ -800,4 +800,65 @@ TEST_F(ColumnReaderWriterTest, test_large_varchar_column_writer) {
     }
 }
 
+
+TEST_F(ColumnReaderWriterTest, test_low_cardinality_varchar_keep_dict_encoded) {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+    const std::string fname = strings::Substitute("$0/test_low_cardinality_varchar.data", TEST_DIR);
+    auto old_dict_page_size = config::dictionary_page_size;
+    auto old_max_values = config::low_cardinality_dictionary_max_values;
+    // 8 distinct values of 1KB can not be held by a 4KB dict page.
+    config::dictionary_page_size = 4096;
+
+    std::vector<std::string> values;
+    for (int i = 0; i < 8; i++) {
+        values.emplace_back(1024, 'a' + i);
+    }
+    auto col = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+    for (int i = 0; i < 1024; i++) {
+        col->append_datum(Datum(Slice(values[i % values.size()])));
+    }
+
+    auto write_column = [&](ColumnMetaPB* meta) {
+        fs->delete_file(fname);
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+        ColumnWriterOptions writer_opts;
+        writer_opts.meta = meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(TYPE_VARCHAR);
+        writer_opts.meta->set_length(2048);
+        writer_opts.meta->set_encoding(DEFAULT_ENCODING);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(false);
+
+        TabletColumn column = create_varchar_key(1, false, 2048);
+        ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &column, wfile.get()));
+        ASSERT_OK(writer->init());
+        ASSERT_OK(writer->append(*col));
+        ASSERT_OK(writer->finish());
+        ASSERT_OK(writer->write_data());
+        ASSERT_OK(writer->write_ordinal_index());
+        ASSERT_OK(wfile->close());
+    };
+
+    {
+        config::low_cardinality_dictionary_max_values = 0;
+        ColumnMetaPB meta;
+        write_column(&meta);
+        ASSERT_EQ(DICT_ENCODING, meta.encoding());
+        ASSERT_FALSE(meta.all_dict_encoded());
+    }
+    {
+        config::low_cardinality_dictionary_max_values = 256;
+        ColumnMetaPB meta;
+        write_column(&meta);
+        ASSERT_EQ(DICT_ENCODING, meta.encoding());
+        ASSERT_TRUE(meta.all_dict_encoded());
+    }
+
+    config::dictionary_page_size = old_dict_page_size;
+    config::low_cardinality_dictionary_max_values = old_max_values;
+}
+
 } // namespace starrocks
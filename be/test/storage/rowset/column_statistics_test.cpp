@@ -0,0 +1,135 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/column_statistics.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/chunk.h"
+#include "storage/tablet_schema_helper.h"
+#include "testutil/assert.h"
+#include "testutil/column_test_helper.h"
+
+namespace starrocks {
+
+// |num_rows| rows of the values i % ndv, every fourth row is null.
+static ColumnPtr build_int_column(int32_t begin, size_t num_rows, int32_t ndv) {
+    std::vector<int32_t> values;
+    std::vector<uint8_t> nulls;
+    for (size_t i = 0; i < num_rows; i++) {
+        values.push_back(begin + static_cast<int32_t>(i) % ndv);
+        nulls.push_back(i % 4 == 3);
+    }
+    return ColumnTestHelper::build_nullable_column<int32_t>(values, nulls);
+}
+
+static void expect_ndv(int64_t expected, const ColumnStatistics& stats) {
+    ASSERT_TRUE(stats.has_ndv());
+    EXPECT_NEAR(expected, stats.ndv(), expected * 0.05);
+}
+
+TEST(ColumnStatisticsTest, test_update_and_merge) {
+    ColumnStatistics ints(TYPE_INT);
+    ints.update(*build_int_column(0, 4000, 1000));
+    EXPECT_EQ(4000, ints.num_rows());
+    EXPECT_EQ(1000, ints.num_nulls());
+    expect_ndv(1000, ints);
+
+    // The values [500, 1500) overlap the half of the ones above.
+    ColumnStatistics other(TYPE_INT);
+    other.update(*build_int_column(500, 1000, 1000));
+    ints.merge(other);
+    EXPECT_EQ(5000, ints.num_rows());
+    EXPECT_EQ(1250, ints.num_nulls());
+    expect_ndv(1500, ints);
+
+    ColumnStatistics strings(TYPE_VARCHAR);
+    auto binary = BinaryColumn::create();
+    for (int i = 0; i < 3000; i++) {
+        binary->append("value_" + std::to_string(i % 2000));
+    }
+    strings.update(*binary);
+    EXPECT_EQ(3000, strings.num_rows());
+    EXPECT_EQ(0, strings.num_nulls());
+    expect_ndv(2000, strings);
+
+    // The distinct values of the complex types are not counted, nor after merged into the others.
+    ColumnStatistics arrays(TYPE_ARRAY);
+    ASSERT_FALSE(arrays.has_ndv());
+    strings.merge(arrays);
+    ASSERT_FALSE(strings.has_ndv());
+    EXPECT_EQ(3000, strings.num_rows());
+}
+
+TEST(ColumnStatisticsTest, test_pb) {
+    ColumnStatistics stats(TYPE_INT);
+    stats.update(*build_int_column(0, 4000, 1000));
+    ColumnStatisticsPB pb;
+    stats.to_pb(&pb);
+
+    ColumnStatistics restored;
+    ASSERT_OK(restored.from_pb(pb));
+    EXPECT_EQ(stats.num_rows(), restored.num_rows());
+    EXPECT_EQ(stats.num_nulls(), restored.num_nulls());
+    ASSERT_TRUE(restored.has_ndv());
+    EXPECT_EQ(stats.ndv(), restored.ndv());
+
+    pb.set_ndv_hll("invalid");
+    ASSERT_FALSE(restored.from_pb(pb).ok());
+}
+
+TEST(ColumnStatisticsTest, test_rowset_column_statistics) {
+    // (k1 int, k2 int, v1 int) with the unique ids 1, 2 and 3.
+    auto schema = TabletSchemaHelper::create_tablet_schema();
+
+    // All the columns at once.
+    RowsetColumnStatistics horizontal(schema);
+    for (int i = 0; i < 2; i++) {
+        auto chunk = std::make_shared<Chunk>();
+        for (SlotId slot = 0; slot < 3; slot++) {
+            chunk->append_column(build_int_column(0, 1000, 100 * (slot + 1)), slot);
+        }
+        horizontal.update(*chunk);
+    }
+    RowsetMetaPB meta;
+    horizontal.to_pb(2000, &meta);
+    ASSERT_EQ(3, meta.column_statistics_size());
+    for (int i = 0; i < 3; i++) {
+        const auto& pb = meta.column_statistics(i);
+        EXPECT_EQ(i + 1, pb.column_unique_id());
+        EXPECT_EQ(2000, pb.num_rows());
+        EXPECT_EQ(500, pb.num_nulls());
+        ColumnStatistics stats;
+        ASSERT_OK(stats.from_pb(pb));
+        expect_ndv(100 * (i + 1), stats);
+    }
+
+    // The key columns and then the value column by column groups, the value column of which some rows are missing
+    // is not added to the meta.
+    RowsetColumnStatistics vertical(schema);
+    auto keys = std::make_shared<Chunk>();
+    keys->append_column(build_int_column(0, 1000, 10), 0);
+    keys->append_column(build_int_column(0, 1000, 20), 1);
+    vertical.update(*keys, {0, 1});
+    auto values = std::make_shared<Chunk>();
+    values->append_column(build_int_column(0, 600, 30), 0);
+    vertical.update(*values, {2});
+    vertical.to_pb(1000, &meta);
+    ASSERT_EQ(2, meta.column_statistics_size());
+    EXPECT_EQ(1, meta.column_statistics(0).column_unique_id());
+    EXPECT_EQ(2, meta.column_statistics(1).column_unique_id());
+}
+
+} // namespace starrocks
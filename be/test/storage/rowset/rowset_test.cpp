@@ -50,6 +50,9 @@
 #include "storage/chunk_helper.h"
 #include "storage/chunk_iterator.h"
 #include "storage/empty_iterator.h"
+#include "storage/index/index_descriptor.h"
+#include "storage/index/sorted/rowset_sorted_index.h"
+#include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_options.h"
 #include "storage/rowset/rowset_writer.h"
@@ -1037,4 +1040,86 @@ TEST_F(RowsetTest, SegmentDeleteWriteTest) {
     LOG(INFO) << st;
     ASSERT_TRUE(st.ok());
 }
+
+TEST_F(RowsetTest, SortedIndexTest) {
+    std::vector<ColumnPB> columns = {create_int_key_pb(1),
+                                     create_int_value_pb(2, "NONE", true, "", /*is_bf_column=*/true)};
+    std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(columns, 1);
+    ASSERT_TRUE(RowsetSortedIndex::is_supported_column(tablet_schema->column(1)));
+    ASSERT_FALSE(RowsetSortedIndex::is_supported_column(tablet_schema->column(0)));
+
+    RowsetWriterContext writer_context;
+    create_rowset_writer_context(12345, tablet_schema, &writer_context);
+    writer_context.writer_type = kHorizontal;
+    std::unique_ptr<RowsetWriter> rowset_writer;
+    ASSERT_OK(RowsetFactory::create_rowset_writer(writer_context, &rowset_writer));
+
+    // 4 segments of 1000 rows, each value of v1 is in 2 adjacent rows.
+    const int32_t chunk_size = 1000;
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+    for (int32_t i = 0; i < 4; i++) {
+        chunk->reset();
+        auto& cols = chunk->columns();
+        for (int32_t j = 0; j < chunk_size; j++) {
+            int32_t row = i * chunk_size + j;
+            cols[0]->append_datum(Datum(row));
+            cols[1]->append_datum(Datum(row / 2));
+        }
+        SegmentPB seg_info;
+        ASSERT_OK(rowset_writer->flush_chunk(*chunk, &seg_info));
+    }
+    RowsetSharedPtr rowset = rowset_writer->build().value();
+    ASSERT_EQ(4, rowset->num_segments());
+
+    std::string index_path = IndexDescriptor::sorted_index_file_path(rowset->rowset_path(), rowset->rowset_id_str(),
+                                                                     tablet_schema->column(1).unique_id());
+    (void)fs::delete_file(index_path);
+    ASSERT_EQ(1, RowsetSortedIndex::build_rowset(rowset).value());
+    ASSERT_TRUE(fs::path_exist(index_path));
+    // The built index is not built again.
+    ASSERT_EQ(0, RowsetSortedIndex::build_rowset(rowset).value());
+
+    auto lookup = [&](std::vector<ColumnPredicate*> preds) {
+        std::vector<std::unique_ptr<ColumnPredicate>> holders;
+        PredicateAndNode pred_root;
+        for (auto* pred : preds) {
+            holders.emplace_back(pred);
+            pred_root.add_child(PredicateColumnNode{pred});
+        }
+        auto pred_tree = PredicateTree::create(std::move(pred_root));
+        std::vector<SparseRangePtr> segment_ranges;
+        CHECK_OK(RowsetSortedIndex::lookup(*rowset, *tablet_schema, pred_tree, &segment_ranges));
+        return segment_ranges;
+    };
+    auto type_info = get_type_info(TYPE_INT);
+
+    auto ranges = lookup({new_column_eq_predicate(type_info, 1, "1500")});
+    ASSERT_EQ(4, ranges.size());
+    ASSERT_TRUE(ranges[0]->empty());
+    ASSERT_TRUE(ranges[1]->empty());
+    ASSERT_TRUE(ranges[2]->empty());
+    ASSERT_EQ(SparseRange<>(0, 2), *ranges[3]);
+
+    ranges = lookup({new_column_ge_predicate(type_info, 1, "499"), new_column_lt_predicate(type_info, 1, "501")});
+    ASSERT_EQ(4, ranges.size());
+    ASSERT_EQ(SparseRange<>(998, 1000), *ranges[0]);
+    ASSERT_EQ(SparseRange<>(0, 2), *ranges[1]);
+    ASSERT_TRUE(ranges[2]->empty());
+    ASSERT_TRUE(ranges[3]->empty());
+
+    ranges = lookup({new_column_eq_predicate(type_info, 1, "100000")});
+    ASSERT_EQ(4, ranges.size());
+    for (const auto& range : ranges) {
+        ASSERT_TRUE(range->empty());
+    }
+
+    // The predicates selecting too many rows and the predicates on the columns without the index are not used.
+    ASSERT_TRUE(lookup({new_column_ge_predicate(type_info, 1, "0")}).empty());
+    ASSERT_TRUE(lookup({new_column_eq_predicate(type_info, 0, "1500")}).empty());
+
+    ASSERT_OK(rowset->remove());
+    ASSERT_FALSE(fs::path_exist(index_path));
+}
+
 } // namespace starrocks
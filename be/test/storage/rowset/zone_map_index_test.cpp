@@ -361,4 +361,25 @@ TEST_F(ColumnZoneMapTest, NormalTestCharPage) {
     test_string("NormalTestCharPage", type_info);
 }
 
+TEST_F(ColumnZoneMapTest, TruncateStringZoneMap) {
+    auto truncate = [](const std::string& min, const std::string& max, size_t len) {
+        ZoneMapPB zone_map;
+        zone_map.set_min(min);
+        zone_map.set_max(max);
+        zone_map.set_has_not_null(true);
+        truncate_string_zone_map(&zone_map, len);
+        return std::make_pair(zone_map.min(), zone_map.max());
+    };
+    // short values are kept as is
+    ASSERT_EQ(std::make_pair(std::string("abc"), std::string("abd")), truncate("abc", "abd", 4));
+    // min is truncated to its prefix, max is truncated and increased
+    ASSERT_EQ(std::make_pair(std::string("http"), std::string("httq")),
+              truncate("http://a.com/x", "http://z.com/y", 4));
+    // trailing 0xFF bytes of the max prefix are dropped before increasing
+    ASSERT_EQ(std::make_pair(std::string("abc"), std::string("b")), truncate("abcdef", "a\xff\xffz", 3));
+    // no shorter upper bound exists, keep the original max
+    ASSERT_EQ(std::make_pair(std::string("ab"), std::string("\xff\xff\xff\x01")),
+              truncate("abcdef", "\xff\xff\xff\x01", 2));
+}
+
 } // namespace starrocks
@@ -157,6 +157,36 @@ public:
         return partial_rowset;
     }
 
+    RowsetSharedPtr create_multi_segment_rowset(const TabletSharedPtr& tablet, int64_t num_segments,
+                                                int64_t rows_per_segment) {
+        RowsetWriterContext writer_context;
+        RowsetId rowset_id = StorageEngine::instance()->next_rowset_id();
+        writer_context.rowset_id = rowset_id;
+        writer_context.tablet_id = tablet->tablet_id();
+        writer_context.tablet_schema_hash = tablet->schema_hash();
+        writer_context.partition_id = 0;
+        writer_context.rowset_path_prefix = tablet->schema_hash_path();
+        writer_context.rowset_state = COMMITTED;
+        writer_context.tablet_schema = tablet->tablet_schema();
+        writer_context.version.first = 0;
+        writer_context.version.second = 0;
+        writer_context.segments_overlap = OVERLAP_UNKNOWN;
+        std::unique_ptr<RowsetWriter> writer;
+        EXPECT_TRUE(RowsetFactory::create_rowset_writer(writer_context, &writer).ok());
+        auto schema = ChunkHelper::convert_schema(tablet->tablet_schema());
+        for (int64_t i = 0; i < num_segments; i++) {
+            auto chunk = ChunkHelper::new_chunk(schema, rows_per_segment);
+            auto& cols = chunk->columns();
+            for (int64_t key = i * rows_per_segment; key < (i + 1) * rows_per_segment; key++) {
+                cols[0]->append_datum(Datum(key));
+                cols[1]->append_datum(Datum((int16_t)(key % 100 + 1)));
+                cols[2]->append_datum(Datum((int32_t)(key % 1000 + 2)));
+            }
+            CHECK_OK(writer->flush_chunk(*chunk));
+        }
+        return *writer->build();
+    }
+
 protected:
     TabletSharedPtr _tablet;
     std::unique_ptr<MemTracker> _compaction_mem_tracker;
@@ -338,4 +368,40 @@ TEST_F(RowsetUpdateStateTest, check_conflict) {
     manager->index_cache().release(index_entry);
 }
 
+TEST_F(RowsetUpdateStateTest, load_upserts_parallel) {
+    const int64_t num_segments = 5;
+    const int64_t rows_per_segment = 100;
+    _tablet = create_tablet(rand(), rand());
+    auto rowset = create_multi_segment_rowset(_tablet, num_segments, rows_per_segment);
+    ASSERT_EQ(num_segments, rowset->num_segments());
+    ASSERT_OK(rowset->load());
+
+    RowsetUpdateState serial_state;
+    for (uint32_t i = 0; i < num_segments; i++) {
+        ASSERT_OK(serial_state.load_upserts(rowset.get(), i));
+    }
+
+    auto pool = StorageEngine::instance()->update_manager()->apply_segment_thread_pool();
+    RowsetUpdateState state;
+    // segment 0 is already loaded and must be skipped
+    ASSERT_OK(state.load_upserts(rowset.get(), 0));
+    ASSERT_OK(state.load_upserts(rowset.get(), 0, 4, pool));
+    ASSERT_OK(state.load_upserts(rowset.get(), 4, 5, pool));
+    ASSERT_EQ(serial_state.memory_usage(), state.memory_usage());
+    for (uint32_t i = 0; i < num_segments; i++) {
+        const auto& expected = serial_state.upserts()[i];
+        const auto& actual = state.upserts()[i];
+        ASSERT_TRUE(actual != nullptr);
+        ASSERT_EQ(rows_per_segment, actual->size());
+        for (size_t j = 0; j < actual->size(); j++) {
+            ASSERT_EQ(0, expected->compare_at(j, j, *actual, -1));
+        }
+    }
+
+    state.release_upserts(2);
+    ASSERT_TRUE(state.upserts()[2] == nullptr);
+    ASSERT_OK(state.load_upserts(rowset.get(), 0, num_segments, nullptr));
+    ASSERT_EQ(serial_state.memory_usage(), state.memory_usage());
+}
+
 } // namespace starrocks
@@ -32,6 +32,7 @@
 #include "testutil/column_test_helper.h"
 #include "testutil/schema_test_helper.h"
 #include "testutil/tablet_test_helper.h"
+#include "util/defer_op.h"
 #include "util/logging.h"
 
 namespace starrocks {
@@ -886,4 +887,50 @@ TEST_F(SchemaChangeTest, overlapping_direct_schema_change) {
     (void)_tablet_mgr->drop_tablet(new_tablet_id);
 }
 
+TEST_F(SchemaChangeTest, parallel_direct_schema_change) {
+    TTabletId base_tablet_id = 1405;
+    TTabletId new_tablet_id = 1406;
+    int32_t old_parallelism = config::schema_change_convert_rowset_parallelism;
+    config::schema_change_convert_rowset_parallelism = 2;
+    DeferOp restore_parallelism([&] { config::schema_change_convert_rowset_parallelism = old_parallelism; });
+
+    create_base_tablet(base_tablet_id, TKeysType::DUP_KEYS, TStorageType::COLUMN);
+    for (int64_t v = 2; v <= 4; v++) {
+        write_data_to_base_tablet(base_tablet_id, Version(v, v));
+    }
+
+    {
+        auto create_tablet_req =
+                TabletTestHelper::gen_create_tablet_req(new_tablet_id, TKeysType::DUP_KEYS, TStorageType::COLUMN);
+        create_tablet_req.__set_base_tablet_id(base_tablet_id);
+        add_key_column(&create_tablet_req, "k1", TPrimitiveType::INT);
+        add_key_column(&create_tablet_req, "k2", TPrimitiveType::INT);
+        add_value_column(&create_tablet_req, "v1", TPrimitiveType::BIGINT);
+        add_value_column(&create_tablet_req, "v2", TPrimitiveType::INT);
+        ASSERT_OK(_storage_engine->create_tablet(create_tablet_req));
+    }
+
+    TAlterTabletReqV2 req = gen_alter_tablet_req(base_tablet_id, new_tablet_id, Version(4, 4));
+    SchemaChangeHandler handler;
+    ASSERT_OK(handler.process_alter_tablet(req));
+
+    // The rowsets converted in parallel are registered with their own versions.
+    auto new_tablet = _tablet_mgr->get_tablet(new_tablet_id);
+    for (int64_t v = 2; v <= 4; v++) {
+        auto seg_iters = TabletTestHelper::create_segment_iterators(*new_tablet, Version(v, v), &_stats);
+        ASSERT_EQ(seg_iters.size(), 1);
+
+        Chunk result_chunk;
+        ASSERT_OK(seg_iters[0]->get_next(&result_chunk));
+        ASSERT_EQ(result_chunk.num_rows(), 4);
+        ASSERT_EQ(TYPE_BIGINT, result_chunk.schema()->field(2)->type()->type());
+        for (size_t i = 0; i < 4; i++) {
+            ASSERT_EQ(fmt::format("[{0}, {0}, {0}, {0}]", i), result_chunk.debug_row(i));
+        }
+    }
+
+    (void)_tablet_mgr->drop_tablet(base_tablet_id);
+    (void)_tablet_mgr->drop_tablet(new_tablet_id);
+}
+
 } // namespace starrocks
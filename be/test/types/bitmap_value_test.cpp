@@ -1216,4 +1216,49 @@ TEST(BitmapValueTest1, Roaring64Map) {
     ASSERT_EQ(r1_sum, sum);
 }
 
+
+TEST_F(BitmapValueTest, fast_union) {
+    BitmapValue high_bitmap = gen_bitmap((1ULL << 32) + 10, (1ULL << 32) + 100);
+    BitmapValue set_bitmap = gen_bitmap(5000, 5010);
+    std::vector<const BitmapValue*> values{&_large_bitmap, &_empty_bitmap, &high_bitmap, &set_bitmap,
+                                           &_single_bitmap, &_large_bitmap};
+    ASSERT_EQ(BitmapDataType::SET, set_bitmap.type());
+
+    for (auto* origin : {&_empty_bitmap, &_single_bitmap, &_medium_bitmap, &_large_bitmap}) {
+        BitmapValue expected = *origin;
+        for (const auto* value : values) {
+            expected |= *value;
+        }
+        BitmapValue result = *origin;
+        result.fast_union(values);
+        ASSERT_EQ(BitmapDataType::BITMAP, result.type());
+        ASSERT_EQ(expected.to_string(), result.to_string());
+        ASSERT_EQ(64 + 90 + 10, result.cardinality());
+    }
+    // The shared bitmap of the origin is not modified.
+    BitmapValue origin = _large_bitmap;
+    origin.fast_union(values);
+    ASSERT_EQ(64, _large_bitmap.cardinality());
+
+    // Less than two bitmaps fall back to |=.
+    BitmapValue result = _single_bitmap;
+    result.fast_union({&set_bitmap, &_medium_bitmap});
+    check_bitmap(BitmapDataType::SET, result, 0, 14, 5000, 5010);
+}
+
+TEST_F(BitmapValueTest, fast_intersect) {
+    BitmapValue bitmap_1 = gen_bitmap(0, 100000);
+    BitmapValue bitmap_2 = gen_bitmap(50000, 200000);
+    BitmapValue bitmap_3 = gen_bitmap(90000, 95000);
+
+    BitmapValue result = bitmap_1;
+    result.fast_intersect({&bitmap_2, &bitmap_3});
+    check_bitmap(BitmapDataType::BITMAP, result, 90000, 95000);
+    ASSERT_EQ(100000, bitmap_1.cardinality());
+
+    result = bitmap_2;
+    result.fast_intersect({&bitmap_3, &_large_bitmap, &bitmap_1});
+    ASSERT_EQ(BitmapDataType::EMPTY, result.type());
+}
+
 } // namespace starrocks
@@ -40,6 +40,7 @@
 #include <thread>
 
 #include "gen_cpp/segment.pb.h"
+#include "gutil/strings/substitute.h"
 #include "util/faststring.h"
 #include "util/random.h"
 #include "util/raw_container.h"
@@ -239,6 +240,42 @@ TEST_F(BlockCompressionTest, test_issue_10721) {
     ASSERT_TRUE(st.ok());
 }
 
+TEST_F(BlockCompressionTest, zstd_dictionary) {
+    // small and repetitive json documents
+    std::vector<std::string> docs;
+    for (int i = 0; i < 1000; ++i) {
+        docs.emplace_back(strings::Substitute(R"({"user_id": $0, "event": "click", "page": "/item/$1", "ok": true})", i,
+                                              i % 37));
+    }
+    std::vector<Slice> samples(docs.begin(), docs.end());
+    auto dict = train_zstd_dictionary(samples, 4096);
+    ASSERT_TRUE(dict.ok()) << dict.status();
+    ASSERT_FALSE(dict->empty());
+    auto codec = new_zstd_dict_compression_codec(*dict);
+    ASSERT_TRUE(codec.ok()) << codec.status();
+
+    const BlockCompressionCodec* plain_codec = nullptr;
+    ASSERT_TRUE(get_block_compression_codec(starrocks::CompressionTypePB::ZSTD, &plain_codec).ok());
+
+    std::string page = docs[1] + docs[500];
+    std::string buf((*codec)->max_compressed_len(page.size()), '\0');
+    Slice compressed(buf);
+    ASSERT_TRUE((*codec)->compress(Slice(page), &compressed).ok());
+
+    std::string plain_buf(plain_codec->max_compressed_len(page.size()), '\0');
+    Slice plain_compressed(plain_buf);
+    ASSERT_TRUE(plain_codec->compress(Slice(page), &plain_compressed).ok());
+    ASSERT_LT(compressed.size, plain_compressed.size);
+
+    std::string uncompressed(page.size(), '\0');
+    Slice uncompressed_slice(uncompressed);
+    ASSERT_TRUE((*codec)->decompress(compressed, &uncompressed_slice).ok());
+    ASSERT_EQ(page, uncompressed_slice.to_string());
+    // the pooled contexts must not keep the dictionary
+    uncompressed_slice = Slice(uncompressed);
+    ASSERT_FALSE(plain_codec->decompress(compressed, &uncompressed_slice).ok());
+}
+
 static const size_t kBenchmarkCompressionTimes = 1000;
 static const size_t kBenchmarkCompressionConcurrentThreads = 32;
 static const size_t kBenchmarkCompressionMultiSliceNum = 2;
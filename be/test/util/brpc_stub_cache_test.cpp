@@ -67,4 +67,24 @@ TEST_F(BrpcStubCacheTest, reset) {
     ASSERT_NE(istub1, istub2);
 }
 
+TEST_F(BrpcStubCacheTest, traffic_class) {
+    BrpcStubCache cache;
+    TNetworkAddress address;
+    address.hostname = "127.0.0.1";
+    address.port = 123;
+    auto control_stub = cache.get_stub(address);
+    auto exchange_stub = cache.get_stub(address, BrpcTrafficClass::EXCHANGE);
+    auto load_stub = cache.get_stub(address, BrpcTrafficClass::LOAD);
+    ASSERT_NE(nullptr, control_stub);
+    ASSERT_NE(nullptr, exchange_stub);
+    ASSERT_NE(nullptr, load_stub);
+    ASSERT_NE(control_stub, exchange_stub);
+    ASSERT_NE(control_stub, load_stub);
+    ASSERT_NE(exchange_stub, load_stub);
+
+    ASSERT_EQ(control_stub, cache.get_stub(address, BrpcTrafficClass::CONTROL));
+    ASSERT_EQ(exchange_stub, cache.get_stub(address, BrpcTrafficClass::EXCHANGE));
+    ASSERT_EQ(load_stub, cache.get_stub(address, BrpcTrafficClass::LOAD));
+}
+
 } // namespace starrocks
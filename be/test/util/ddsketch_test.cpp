@@ -0,0 +1,103 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/ddsketch.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace starrocks {
+
+static void expect_relative_error(double expected, double actual) {
+    EXPECT_LE(std::abs(actual - expected), std::abs(expected) * DDSketch::kRelativeAccuracy + 1e-12)
+            << "expected: " << expected << ", actual: " << actual;
+}
+
+TEST(DDSketchTest, quantile) {
+    DDSketch sketch;
+    ASSERT_EQ(0, sketch.count());
+    ASSERT_EQ(0, sketch.quantile(0.5));
+
+    const int n = 100000;
+    std::vector<double> values;
+    for (int i = 1; i <= n; ++i) {
+        values.push_back(i);
+    }
+    sketch.add(values.data(), values.size());
+    ASSERT_EQ(n, sketch.count());
+    for (double q : {0.0, 0.01, 0.25, 0.5, 0.9, 0.99, 0.999, 1.0}) {
+        expect_relative_error(1 + std::floor(q * (n - 1)), sketch.quantile(q));
+    }
+}
+
+TEST(DDSketchTest, negative_and_zero) {
+    DDSketch sketch;
+    for (int i = -1000; i <= 1000; ++i) {
+        sketch.add(i);
+    }
+    sketch.add(NAN);
+    sketch.add(INFINITY);
+    ASSERT_EQ(2001, sketch.count());
+    expect_relative_error(-1000, sketch.quantile(0));
+    expect_relative_error(-500, sketch.quantile(0.25));
+    ASSERT_EQ(0, sketch.quantile(0.5));
+    expect_relative_error(500, sketch.quantile(0.75));
+    expect_relative_error(1000, sketch.quantile(1));
+}
+
+TEST(DDSketchTest, merge_and_serialize) {
+    DDSketch all;
+    DDSketch lhs;
+    DDSketch rhs;
+    for (int i = 0; i < 10000; ++i) {
+        double value = std::exp((i % 997) / 50.0) - 100;
+        all.add(value);
+        (i % 3 == 0 ? lhs : rhs).add(value);
+    }
+    lhs.merge(rhs);
+    ASSERT_EQ(all.count(), lhs.count());
+
+    std::vector<uint8_t> buf(lhs.serialize_size());
+    ASSERT_EQ(buf.size(), lhs.serialize(buf.data()));
+    DDSketch deserialized;
+    ASSERT_TRUE(deserialized.deserialize(Slice(buf.data(), buf.size())));
+    for (double q : {0.0, 0.1, 0.5, 0.9, 1.0}) {
+        ASSERT_EQ(all.quantile(q), lhs.quantile(q));
+        ASSERT_EQ(all.quantile(q), deserialized.quantile(q));
+    }
+
+    DDSketch invalid;
+    ASSERT_FALSE(invalid.deserialize(Slice(buf.data(), buf.size() - 1)));
+    buf[0] = 0;
+    ASSERT_FALSE(invalid.deserialize(Slice(buf.data(), buf.size())));
+}
+
+TEST(DDSketchTest, bounded_buckets) {
+    DDSketch sketch;
+    // Far more magnitudes than kMaxNumBuckets buckets can hold.
+    for (int e = -300; e <= 300; ++e) {
+        for (int i = 1; i < 10; ++i) {
+            sketch.add(i * std::pow(10.0, e));
+        }
+    }
+    ASSERT_LE(sketch.mem_usage(), sizeof(DDSketch) + 2 * DDSketch::kMaxNumBuckets * sizeof(uint64_t));
+    // The high quantiles are still accurate, only the lowest buckets are collapsed.
+    expect_relative_error(9e300, sketch.quantile(1));
+    const double rank = (295 + 300) * 9 + 4;
+    expect_relative_error(5e295, sketch.quantile((rank + 0.5) / (sketch.count() - 1)));
+}
+
+} // namespace starrocks
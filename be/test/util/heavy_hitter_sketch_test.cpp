@@ -0,0 +1,53 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/heavy_hitter_sketch.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(HeavyHitterSketchTest, find_hot_item) {
+    HeavyHitterSketch<uint32_t> sketch(8);
+    ASSERT_TRUE(sketch.empty());
+    // 1/4 of the items are 42, the others are distinct.
+    for (uint32_t i = 0; i < 10000; i++) {
+        sketch.add(i % 4 == 0 ? 42 : 1000 + i);
+    }
+    ASSERT_EQ(10000, sketch.total());
+    const auto& top = sketch.top();
+    ASSERT_EQ(42, top.item);
+    ASSERT_GE(top.count, 2500);
+    ASSERT_LE(top.count - top.error, 2500);
+    ASSERT_LE(top.error, 10000 / 8);
+}
+
+TEST(HeavyHitterSketchTest, add_with_count) {
+    HeavyHitterSketch<uint32_t> sketch(2);
+    sketch.add(1, 10);
+    sketch.add(2, 5);
+    sketch.add(3);
+    ASSERT_EQ(16, sketch.total());
+    // 3 takes over the counter of 2.
+    const auto& top = sketch.top();
+    ASSERT_EQ(1, top.item);
+    ASSERT_EQ(10, top.count);
+    ASSERT_EQ(0, top.error);
+    sketch.add(3, 10);
+    ASSERT_EQ(3, sketch.top().item);
+    ASSERT_EQ(16, sketch.top().count);
+    ASSERT_EQ(5, sketch.top().error);
+}
+
+} // namespace starrocks
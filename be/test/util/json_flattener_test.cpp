@@ -438,4 +438,89 @@ TEST_F(JsonFlattenerTest, testPointJson) {
     EXPECT_EQ("4", result_col[0]->debug_item(1));
 }
 
+TEST_F(JsonFlattenerTest, testJsonPathStats) {
+    double old_sparsity_factor = config::json_flat_sparsity_factor;
+    config::json_flat_sparsity_factor = 0.9;
+
+    JsonPathStats stats;
+    stats.update(100, {{"k1", 100, TYPE_BIGINT}, {"k2", 95, TYPE_VARCHAR}, {"k3", 10, TYPE_BIGINT}});
+    // a path isn't hot until it's seen in enough segments
+    EXPECT_TRUE(stats.hot_paths().empty());
+
+    stats.update(100, {{"k1", 100, TYPE_BIGINT}, {"k2", 90, TYPE_VARCHAR}, {"k3", 10, TYPE_BIGINT}});
+    auto hot_paths = stats.hot_paths();
+    EXPECT_EQ(2, hot_paths.size());
+    EXPECT_EQ(TYPE_BIGINT, hot_paths["k1"]);
+    EXPECT_EQ(TYPE_VARCHAR, hot_paths["k2"]);
+
+    // the type of k1 changes
+    stats.update(100, {{"k1", 100, TYPE_DOUBLE}, {"k2", 90, TYPE_VARCHAR}});
+    hot_paths = stats.hot_paths();
+    EXPECT_EQ(1, hot_paths.size());
+    EXPECT_EQ(TYPE_VARCHAR, hot_paths["k2"]);
+
+    // k2 disappears after the counts decay
+    stats.update(JsonPathStats::kDecayRows, {{"k1", JsonPathStats::kDecayRows, TYPE_DOUBLE}});
+    hot_paths = stats.hot_paths();
+    EXPECT_EQ(1, hot_paths.size());
+    EXPECT_EQ(TYPE_DOUBLE, hot_paths["k1"]);
+
+    config::json_flat_sparsity_factor = old_sparsity_factor;
+}
+
+TEST_F(JsonFlattenerTest, testDeriveHotPaths) {
+    // clang-format off
+    std::vector<std::string> jsons = {
+    R"({"k1": 1, "k2": "a"})",
+    R"({"k1": 2, "k2": "b"})",
+    R"({"k1": 3, "k2": "c"})",
+    R"({"k1": 4})",
+    R"({"k1": 5})"
+    };
+    // clang-format on
+
+    ColumnPtr input = JsonColumn::create();
+    JsonColumn* json_input = down_cast<JsonColumn*>(input.get());
+    for (const auto& json : jsons) {
+        ASSIGN_OR_ABORT(auto json_value, JsonValue::parse(json));
+        json_input->append(&json_value);
+    }
+
+    double old_sparsity_factor = config::json_flat_sparsity_factor;
+    double old_hot_path_sparsity_factor = config::json_flat_hot_path_sparsity_factor;
+    config::json_flat_sparsity_factor = 0.9;
+    config::json_flat_hot_path_sparsity_factor = 0.5;
+
+    {
+        JsonPathDeriver jf;
+        jf.derived({json_input});
+        EXPECT_EQ(std::vector<std::string>{"k1"}, jf.flat_paths());
+        EXPECT_TRUE(jf.has_remain_json());
+    }
+
+    auto stats = std::make_shared<JsonPathStats>();
+    {
+        // k2 isn't hot yet, the stats are only recorded
+        JsonPathDeriver jf;
+        jf.set_path_stats(stats);
+        jf.derived({json_input});
+        EXPECT_EQ(std::vector<std::string>{"k1"}, jf.flat_paths());
+    }
+
+    // k2 is in most rows of the previous segments of the tablet
+    stats->update(100, {{"k1", 100, TYPE_TINYINT}, {"k2", 100, TYPE_VARCHAR}});
+    stats->update(100, {{"k1", 100, TYPE_TINYINT}, {"k2", 100, TYPE_VARCHAR}});
+    {
+        JsonPathDeriver jf;
+        jf.set_path_stats(stats);
+        jf.derived({json_input});
+        std::vector<std::string> paths = {"k1", "k2"};
+        EXPECT_EQ(paths, jf.flat_paths());
+        EXPECT_FALSE(jf.has_remain_json());
+    }
+
+    config::json_flat_sparsity_factor = old_sparsity_factor;
+    config::json_flat_hot_path_sparsity_factor = old_hot_path_sparsity_factor;
+}
+
 } // namespace starrocks
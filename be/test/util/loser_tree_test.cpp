@@ -0,0 +1,109 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/loser_tree.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace starrocks {
+
+struct Sources {
+    std::vector<std::vector<int>> values;
+    std::vector<size_t> positions;
+
+    int head(size_t source) const { return values[source][positions[source]]; }
+};
+
+struct SourceLess {
+    const Sources* sources;
+
+    bool operator()(size_t lhs, size_t rhs) const {
+        int lhs_head = sources->head(lhs);
+        int rhs_head = sources->head(rhs);
+        return lhs_head < rhs_head || (lhs_head == rhs_head && lhs < rhs);
+    }
+};
+
+static void merge_and_check(Sources sources) {
+    std::vector<std::pair<int, size_t>> expected;
+    for (size_t i = 0; i < sources.values.size(); i++) {
+        for (int v : sources.values[i]) {
+            expected.emplace_back(v, i);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    sources.positions.assign(sources.values.size(), 0);
+    LoserTree<SourceLess> tree(sources.values.size(), SourceLess{&sources});
+    for (size_t i = 0; i < sources.values.size(); i++) {
+        if (sources.values[i].empty()) {
+            tree.mark_exhausted(i);
+        }
+    }
+    tree.build();
+
+    std::vector<std::pair<int, size_t>> real;
+    while (!tree.empty()) {
+        size_t winner = tree.winner();
+        size_t runner_up = tree.runner_up();
+        // The runner-up is the smallest of the other sources.
+        size_t expected_runner_up = LoserTree<SourceLess>::kNone;
+        for (size_t i = 0; i < sources.values.size(); i++) {
+            if (i == winner || sources.positions[i] >= sources.values[i].size()) {
+                continue;
+            }
+            if (expected_runner_up == LoserTree<SourceLess>::kNone || SourceLess{&sources}(i, expected_runner_up)) {
+                expected_runner_up = i;
+            }
+        }
+        ASSERT_EQ(expected_runner_up, runner_up);
+
+        real.emplace_back(sources.head(winner), winner);
+        if (++sources.positions[winner] < sources.values[winner].size()) {
+            tree.replay();
+        } else {
+            tree.pop();
+        }
+    }
+    ASSERT_EQ(expected, real);
+}
+
+TEST(LoserTreeTest, test_merge) {
+    merge_and_check(Sources{{}});
+    merge_and_check(Sources{{{1, 2, 3}}});
+    merge_and_check(Sources{{{}, {1, 1, 2}, {}}});
+    merge_and_check(Sources{{{1, 3, 5}, {2, 4, 6}, {1, 2, 3}}});
+}
+
+TEST(LoserTreeTest, test_random_merge) {
+    std::mt19937 rng(0);
+    for (size_t num_sources : {2, 3, 5, 8, 13, 64, 100}) {
+        Sources sources;
+        sources.values.resize(num_sources);
+        for (auto& values : sources.values) {
+            values.resize(rng() % 50);
+            for (int& v : values) {
+                v = static_cast<int>(rng() % 100);
+            }
+            std::sort(values.begin(), values.end());
+        }
+        merge_and_check(std::move(sources));
+    }
+}
+
+} // namespace starrocks
@@ -34,6 +34,7 @@
 
 #include "util/lru_cache.h"
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include <vector>
@@ -272,6 +273,77 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(950, cache.get_usage());
 }
 
+static bool lookup_LRUCache(LRUCache& cache, const CacheKey& key) {
+    uint32_t hash = key.hash(key.data(), key.size(), 0);
+    Cache::Handle* handle = cache.lookup(key, hash);
+    if (handle == nullptr) {
+        return false;
+    }
+    cache.release(handle);
+    return true;
+}
+
+TEST_F(CacheTest, SegmentedLRU) {
+    for (auto policy : {CacheEvictionPolicy::LRU, CacheEvictionPolicy::SLRU}) {
+        LRUCache cache;
+        cache.set_capacity(1000);
+        cache.set_eviction_policy(policy);
+
+        CacheKey hot1("hot1");
+        CacheKey hot2("hot2");
+        insert_LRUCache(cache, hot1, 100, CachePriority::NORMAL);
+        insert_LRUCache(cache, hot2, 100, CachePriority::NORMAL);
+        ASSERT_TRUE(lookup_LRUCache(cache, hot1));
+        ASSERT_TRUE(lookup_LRUCache(cache, hot2));
+
+        // a scan visits each entry once
+        std::vector<std::string> scan_keys;
+        for (int i = 0; i < 20; i++) {
+            scan_keys.emplace_back(fmt::format("scan{}", i));
+        }
+        for (const auto& k : scan_keys) {
+            insert_LRUCache(cache, CacheKey(k), 100, CachePriority::NORMAL);
+        }
+        ASSERT_EQ(1000, cache.get_usage());
+
+        bool kept = policy == CacheEvictionPolicy::SLRU;
+        ASSERT_EQ(kept, lookup_LRUCache(cache, hot1));
+        ASSERT_EQ(kept, lookup_LRUCache(cache, hot2));
+        // the latest entries of the scan are kept
+        ASSERT_TRUE(lookup_LRUCache(cache, CacheKey(scan_keys.back())));
+        ASSERT_EQ(1000, cache.get_usage());
+        cache.prune();
+        ASSERT_EQ(0, cache.get_usage());
+    }
+}
+
+TEST_F(CacheTest, SegmentedLRUDemote) {
+    LRUCache cache;
+    cache.set_capacity(1000);
+    cache.set_eviction_policy(CacheEvictionPolicy::SLRU);
+
+    // all entries are hit, only 80% of the capacity is protected.
+    std::vector<std::string> keys;
+    for (int i = 0; i < 10; i++) {
+        keys.emplace_back(fmt::format("key{}", i));
+        insert_LRUCache(cache, CacheKey(keys.back()), 100, CachePriority::NORMAL);
+        ASSERT_TRUE(lookup_LRUCache(cache, CacheKey(keys.back())));
+    }
+    // key0 and key1 are demoted to probation segment and evicted first.
+    insert_LRUCache(cache, CacheKey("new0"), 100, CachePriority::NORMAL);
+    insert_LRUCache(cache, CacheKey("new1"), 100, CachePriority::NORMAL);
+    ASSERT_FALSE(lookup_LRUCache(cache, CacheKey(keys[0])));
+    ASSERT_FALSE(lookup_LRUCache(cache, CacheKey(keys[1])));
+    for (int i = 2; i < 10; i++) {
+        ASSERT_TRUE(lookup_LRUCache(cache, CacheKey(keys[i])));
+    }
+    ASSERT_EQ(1000, cache.get_usage());
+
+    ASSERT_EQ(CacheEvictionPolicy::SLRU, cache_eviction_policy_from_string("SLRU"));
+    ASSERT_EQ(CacheEvictionPolicy::LRU, cache_eviction_policy_from_string("lru"));
+    ASSERT_EQ(CacheEvictionPolicy::LRU, cache_eviction_policy_from_string("unknown"));
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
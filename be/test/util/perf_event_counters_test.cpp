@@ -0,0 +1,51 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_counters.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/parallel_test.h"
+
+namespace starrocks {
+
+PARALLEL_TEST(PerfEventCountersTest, read) {
+    auto* counters = PerfEventCounters::thread_local_instance();
+    ASSERT_EQ(counters, PerfEventCounters::thread_local_instance());
+
+    PerfEventValues start;
+    if (!counters->read(&start)) {
+        // The hardware counters are not allowed in this environment.
+        ASSERT_FALSE(counters->available());
+        return;
+    }
+    volatile int64_t sum = 0;
+    for (int i = 0; i < 1000000; i++) {
+        sum = sum + i;
+    }
+    PerfEventValues end;
+    ASSERT_TRUE(counters->read(&end));
+    auto values = end - start;
+    ASSERT_GT(values.cycles, 0);
+    ASSERT_GT(values.instructions, 1000000);
+    ASSERT_GE(values.llc_misses, 0);
+    ASSERT_GE(values.branch_misses, 0);
+
+    PerfEventValues total;
+    total += values;
+    total += values;
+    ASSERT_EQ(values.instructions * 2, total.instructions);
+}
+
+} // namespace starrocks
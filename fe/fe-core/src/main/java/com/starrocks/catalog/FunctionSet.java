@@ -265,6 +265,7 @@ public class FunctionSet {
     public static final String MIN_BY_V2 = "min_by_v2";
     public static final String MIN = "min";
     public static final String PERCENTILE_APPROX = "percentile_approx";
+    public static final String PERCENTILE_APPROX_DDSKETCH = "percentile_approx_ddsketch";
     public static final String PERCENTILE_CONT = "percentile_cont";
     public static final String PERCENTILE_DISC = "percentile_disc";
     public static final String LC_PERCENTILE_DISC = "percentile_disc_lc";
@@ -783,7 +784,6 @@ public class FunctionSet {
                     .add(DICT_MERGE)
                     // Functions with constant contexts in be are not supported.
                     .add(WINDOW_FUNNEL)
-                    .add(APPROX_TOP_K)
                     .add(INTERSECT_COUNT)
                     .add(LC_PERCENTILE_DISC)
                     .build();
@@ -1509,6 +1509,9 @@ public class FunctionSet {
         addBuiltin(AggregateFunction.createBuiltin(PERCENTILE_APPROX,
                 Lists.newArrayList(Type.DOUBLE, Type.DOUBLE, Type.DOUBLE), Type.DOUBLE, Type.VARBINARY,
                 false, false, false));
+        addBuiltin(AggregateFunction.createBuiltin(PERCENTILE_APPROX_DDSKETCH,
+                Lists.newArrayList(Type.DOUBLE, Type.DOUBLE), Type.DOUBLE, Type.VARBINARY,
+                false, false, false));
 
         addBuiltin(AggregateFunction.createBuiltin(PERCENTILE_UNION,
                 Lists.newArrayList(Type.PERCENTILE), Type.PERCENTILE, Type.PERCENTILE,
@@ -30,7 +30,9 @@ public class InvertedIndexParams {
             .collect(Collectors.toSet());
 
     public enum InvertedIndexImpType {
-        CLUCENE
+        CLUCENE,
+        // posting lists natively implemented by BE, only for filtering
+        BUILTIN
     }
 
     public enum CommonIndexParamKey implements ParamsKey {
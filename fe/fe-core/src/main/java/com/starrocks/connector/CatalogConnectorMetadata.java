@@ -199,6 +199,11 @@ public class CatalogConnectorMetadata implements ConnectorMetadata {
         return normal.getPartitions(table, partitionNames);
     }
 
+    @Override
+    public List<String> getScanSplitFilters(Table table, int numSplits) {
+        return normal.getScanSplitFilters(table, numSplits);
+    }
+
     @Override
     public Statistics getTableStatistics(OptimizerContext session, Table table, Map<ColumnRefOperator, Column> columns,
                                          List<PartitionKey> partitionKeys, ScalarOperator predicate, long limit,
@@ -188,6 +188,17 @@ public interface ConnectorMetadata {
         return Lists.newArrayList();
     }
 
+    /**
+     * Get the filters of the splits of a scan on the table, each split reads the rows matching one of the filters.
+     *
+     * @param table     the table to scan
+     * @param numSplits the max number of the splits
+     * @return the filters of the splits, or an empty list if the scan is not split
+     */
+    default List<String> getScanSplitFilters(Table table, int numSplits) {
+        return Lists.newArrayList();
+    }
+
     /**
      * Get statistics for the table.
      *
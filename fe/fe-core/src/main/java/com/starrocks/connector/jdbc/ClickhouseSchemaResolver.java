@@ -88,6 +88,11 @@ public class ClickhouseSchemaResolver extends JDBCSchemaResolver {
         return connection.getMetaData().getColumns(connection.getCatalog(), dbName, tblName, "%");
     }
 
+    @Override
+    public ResultSet getPrimaryKeys(Connection connection, String dbName, String tblName) throws SQLException {
+        return connection.getMetaData().getPrimaryKeys(connection.getCatalog(), dbName, tblName);
+    }
+
 
     @Override
     public Type convertColumnType(int dataType, String typeName, int columnSize, int digits) {
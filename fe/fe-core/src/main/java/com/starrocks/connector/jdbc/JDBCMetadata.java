@@ -37,9 +37,12 @@ import com.zaxxer.hikari.HikariDataSource;
 import org.apache.logging.log4j.LogManager;
 import org.apache.logging.log4j.Logger;
 
+import java.math.BigInteger;
 import java.sql.Connection;
 import java.sql.ResultSet;
 import java.sql.SQLException;
+import java.sql.Statement;
+import java.util.ArrayList;
 import java.util.List;
 import java.util.Map;
 import java.util.Set;
@@ -289,6 +292,76 @@ public class JDBCMetadata implements ConnectorMetadata {
         return list.build();
     }
 
+    @Override
+    public List<String> getScanSplitFilters(Table table, int numSplits) {
+        if (numSplits <= 1 || !(table instanceof JDBCTable)) {
+            return Lists.newArrayList();
+        }
+        JDBCTable jdbcTable = (JDBCTable) table;
+        try (Connection connection = getConnection()) {
+            String splitColumn = getSplitColumn(connection, jdbcTable);
+            if (splitColumn == null) {
+                return Lists.newArrayList();
+            }
+            String quote = properties.get(JDBCResource.URI).startsWith("jdbc:mysql") ? "`" : "";
+            String tableName = quote.isEmpty() ? jdbcTable.getJdbcTable() :
+                    quote + jdbcTable.getDbName() + quote + "." + quote + jdbcTable.getName() + quote;
+            String column = quote + splitColumn + quote;
+            String sql = "SELECT MIN(" + column + "), MAX(" + column + ") FROM " + tableName;
+            try (Statement statement = connection.createStatement(); ResultSet resultSet = statement.executeQuery(sql)) {
+                if (!resultSet.next() || resultSet.getString(1) == null || resultSet.getString(2) == null) {
+                    return Lists.newArrayList();
+                }
+                return buildRangeSplitFilters(column, new BigInteger(resultSet.getString(1)),
+                        new BigInteger(resultSet.getString(2)), numSplits);
+            }
+        } catch (SQLException | NumberFormatException e) {
+            LOG.warn("get scan splits of JDBC table {}.{} fail, scan it without splits", jdbcTable.getDbName(),
+                    jdbcTable.getName(), e);
+            return Lists.newArrayList();
+        }
+    }
+
+    // Returns the single integer primary key column of the table, or null if the table doesn't have one.
+    private String getSplitColumn(Connection connection, JDBCTable table) throws SQLException {
+        List<String> keyColumns = new ArrayList<>();
+        try (ResultSet resultSet = schemaResolver.getPrimaryKeys(connection, table.getDbName(), table.getName())) {
+            while (resultSet.next()) {
+                keyColumns.add(resultSet.getString("COLUMN_NAME"));
+            }
+        }
+        if (keyColumns.size() != 1) {
+            return null;
+        }
+        Column column = table.getColumn(keyColumns.get(0));
+        if (column == null || !column.getType().isIntegerType()) {
+            return null;
+        }
+        return keyColumns.get(0);
+    }
+
+    /**
+     * Split the range [min, max] of an integer column into at most numSplits ranges of the same length, the first
+     * and the last range are open so that the rows out of the range, e.g. inserted after the split, are still read.
+     */
+    public static List<String> buildRangeSplitFilters(String column, BigInteger min, BigInteger max, int numSplits) {
+        List<String> filters = new ArrayList<>();
+        BigInteger length = max.subtract(min).add(BigInteger.ONE);
+        if (numSplits <= 1 || length.compareTo(BigInteger.valueOf(numSplits)) < 0) {
+            return filters;
+        }
+        List<BigInteger> bounds = new ArrayList<>();
+        for (int i = 1; i < numSplits; i++) {
+            bounds.add(min.add(length.multiply(BigInteger.valueOf(i)).divide(BigInteger.valueOf(numSplits))));
+        }
+        filters.add(column + " < " + bounds.get(0));
+        for (int i = 1; i < bounds.size(); i++) {
+            filters.add(column + " >= " + bounds.get(i - 1) + " AND " + column + " < " + bounds.get(i));
+        }
+        filters.add("(" + column + " >= " + bounds.get(bounds.size() - 1) + " OR " + column + " IS NULL)");
+        return filters;
+    }
+
     @Override
     public void refreshTable(String srDbName, Table table, List<String> partitionNames, boolean onlyCachedPartitions) {
         JDBCTable jdbcTable = (JDBCTable) table;
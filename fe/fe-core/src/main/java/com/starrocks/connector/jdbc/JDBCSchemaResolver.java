@@ -61,6 +61,10 @@ public abstract class JDBCSchemaResolver {
         return connection.getMetaData().getColumns(dbName, null, tblName, "%");
     }
 
+    public ResultSet getPrimaryKeys(Connection connection, String dbName, String tblName) throws SQLException {
+        return connection.getMetaData().getPrimaryKeys(dbName, null, tblName);
+    }
+
     public Table getTable(long id, String name, List<Column> schema, String dbName,
                           String catalogName, Map<String, String> properties) throws DdlException {
         return new JDBCTable(id, name, schema, dbName, catalogName, properties);
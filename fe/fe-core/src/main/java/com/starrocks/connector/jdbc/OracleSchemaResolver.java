@@ -47,6 +47,11 @@ public class OracleSchemaResolver extends JDBCSchemaResolver {
         return connection.getMetaData().getColumns(connection.getCatalog(), dbName, tblName, "%");
     }
 
+    @Override
+    public ResultSet getPrimaryKeys(Connection connection, String dbName, String tblName) throws SQLException {
+        return connection.getMetaData().getPrimaryKeys(connection.getCatalog(), dbName, tblName);
+    }
+
     @Override
     public List<Column> convertToSRTable(ResultSet columnSet) throws SQLException {
         List<Column> fullSchema = Lists.newArrayList();
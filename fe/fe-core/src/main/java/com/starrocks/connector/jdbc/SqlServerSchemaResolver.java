@@ -45,6 +45,11 @@ public class SqlServerSchemaResolver extends JDBCSchemaResolver {
         return connection.getMetaData().getColumns(connection.getCatalog(), dbName, tblName, "%");
     }
 
+    @Override
+    public ResultSet getPrimaryKeys(Connection connection, String dbName, String tblName) throws SQLException {
+        return connection.getMetaData().getPrimaryKeys(connection.getCatalog(), dbName, tblName);
+    }
+
     @Override
     public Table getTable(long id, String name, List<Column> schema, String dbName, String catalogName,
                           Map<String, String> properties) throws DdlException {
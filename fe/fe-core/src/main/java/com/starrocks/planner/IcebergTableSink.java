@@ -32,9 +32,14 @@ import com.starrocks.thrift.TDataSink;
 import com.starrocks.thrift.TDataSinkType;
 import com.starrocks.thrift.TExplainLevel;
 import com.starrocks.thrift.TIcebergTableSink;
+import org.apache.iceberg.NullOrder;
+import org.apache.iceberg.SortDirection;
+import org.apache.iceberg.SortField;
 import org.apache.iceberg.Table;
 import org.apache.iceberg.aws.AwsProperties;
 
+import java.util.ArrayList;
+import java.util.List;
 import java.util.Locale;
 
 import static com.starrocks.analysis.OutFileClause.PARQUET_COMPRESSION_TYPE_MAP;
@@ -57,6 +62,9 @@ public class IcebergTableSink extends DataSink {
     private final String tableIdentifier;
     private final CloudConfiguration cloudConfiguration;
     private String targetBranch;
+    private final List<String> sortColumnNames = new ArrayList<>();
+    private final List<Boolean> sortIsAsc = new ArrayList<>();
+    private final List<Boolean> sortNullsFirst = new ArrayList<>();
 
     public IcebergTableSink(IcebergTable icebergTable, TupleDescriptor desc, boolean isStaticPartitionSink,
                             SessionVariable sessionVariable, String targetBranch) {
@@ -72,6 +80,17 @@ public class IcebergTableSink extends DataSink {
         this.targetMaxFileSize = sessionVariable.getConnectorSinkTargetMaxFileSize();
         this.targetBranch = targetBranch;
 
+        // The rows written are sorted by the prefix of the sort order of the table made of the columns themselves.
+        for (SortField field : nativeTable.sortOrder().fields()) {
+            String columnName = nativeTable.schema().findColumnName(field.sourceId());
+            if (!field.transform().isIdentity() || columnName == null) {
+                break;
+            }
+            sortColumnNames.add(columnName);
+            sortIsAsc.add(field.direction() == SortDirection.ASC);
+            sortNullsFirst.add(field.nullOrder() == NullOrder.NULLS_FIRST);
+        }
+
         String catalogName = icebergTable.getCatalogName();
         CatalogConnector connector = GlobalStateMgr.getCurrentState().getConnectorMgr().getConnector(catalogName);
         Preconditions.checkState(connector != null,
@@ -118,6 +137,11 @@ public class IcebergTableSink extends DataSink {
         TCloudConfiguration tCloudConfiguration = new TCloudConfiguration();
         cloudConfiguration.toThrift(tCloudConfiguration);
         tIcebergTableSink.setCloud_configuration(tCloudConfiguration);
+        if (!sortColumnNames.isEmpty()) {
+            tIcebergTableSink.setSort_column_names(sortColumnNames);
+            tIcebergTableSink.setSort_is_asc(sortIsAsc);
+            tIcebergTableSink.setSort_nulls_first(sortNullsFirst);
+        }
 
         tDataSink.setIceberg_table_sink(tIcebergTableSink);
         return tDataSink;
@@ -28,6 +28,7 @@ import com.starrocks.catalog.Column;
 import com.starrocks.catalog.JDBCResource;
 import com.starrocks.catalog.JDBCTable;
 import com.starrocks.common.UserException;
+import com.starrocks.qe.ConnectContext;
 import com.starrocks.server.GlobalStateMgr;
 import com.starrocks.sql.analyzer.AstToStringBuilder;
 import com.starrocks.thrift.TExplainLevel;
@@ -46,6 +47,8 @@ public class JDBCScanNode extends ScanNode {
 
     private final List<String> columns = new ArrayList<>();
     private final List<String> filters = new ArrayList<>();
+    // Each split of the scan reads the rows matching one of the filters with its own connection.
+    private List<String> splitFilters = new ArrayList<>();
     private String tableName;
     private JDBCTable table;
 
@@ -66,12 +69,14 @@ public class JDBCScanNode extends ScanNode {
     public void finalizeStats(Analyzer analyzer) throws UserException {
         createJDBCTableColumns();
         createJDBCTableFilters();
+        createJDBCTableSplitFilters();
         computeStats(analyzer);
     }
 
     public void computeColumnsAndFilters() {
         createJDBCTableColumns();
         createJDBCTableFilters();
+        createJDBCTableSplitFilters();
     }
 
     @Override
@@ -79,6 +84,9 @@ public class JDBCScanNode extends ScanNode {
         StringBuilder output = new StringBuilder();
         output.append(prefix).append("TABLE: ").append(tableName).append("\n");
         output.append(prefix).append("QUERY: ").append(getJDBCQueryStr()).append("\n");
+        if (!splitFilters.isEmpty()) {
+            output.append(prefix).append("SPLITS: ").append(splitFilters.size()).append("\n");
+        }
         return output.toString();
     }
 
@@ -144,6 +152,20 @@ public class JDBCScanNode extends ScanNode {
         }
     }
 
+    private void createJDBCTableSplitFilters() {
+        ConnectContext context = ConnectContext.get();
+        // Only the tables of the jdbc catalogs can be split, and a scan with limit reads few rows anyway.
+        if (context == null || table.getCatalogName() == null || hasLimit()) {
+            return;
+        }
+        int numSplits = context.getSessionVariable().getJdbcScanSplits();
+        if (numSplits <= 1) {
+            return;
+        }
+        splitFilters = GlobalStateMgr.getCurrentState().getMetadataMgr()
+                .getScanSplitFilters(table.getCatalogName(), table, numSplits);
+    }
+
     @Override
     public boolean canUseRuntimeAdaptiveDop() {
         return true;
@@ -158,6 +180,9 @@ public class JDBCScanNode extends ScanNode {
         msg.jdbc_scan_node.setColumns(columns);
         msg.jdbc_scan_node.setFilters(filters);
         msg.jdbc_scan_node.setLimit(limit);
+        if (!splitFilters.isEmpty()) {
+            msg.jdbc_scan_node.setSplit_filters(splitFilters);
+        }
     }
 
     @Override
@@ -488,6 +488,8 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     public static final String ENABLE_DATACACHE_IO_ADAPTOR = "enable_datacache_io_adaptor";
     public static final String DATACACHE_EVICT_PROBABILITY = "datacache_evict_probability";
 
+    public static final String QUERY_LATENCY_TARGET_MS = "query_latency_target_ms";
+
     // The following configurations will be deprecated, and we use the `datacache` suffix instead.
     // But it is temporarily necessary to keep them for a period of time to be compatible with
     // the old session variable names.
@@ -497,6 +499,7 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     public static final String ENABLE_FILE_METACACHE = "enable_file_metacache";
     public static final String HUDI_MOR_FORCE_JNI_READER = "hudi_mor_force_jni_reader";
     public static final String PAIMON_FORCE_JNI_READER = "paimon_force_jni_reader";
+    public static final String JDBC_SCAN_SPLITS = "jdbc_scan_splits";
     public static final String ENABLE_DYNAMIC_PRUNE_SCAN_RANGE = "enable_dynamic_prune_scan_range";
     public static final String IO_TASKS_PER_SCAN_OPERATOR = "io_tasks_per_scan_operator";
     public static final String CONNECTOR_IO_TASKS_PER_SCAN_OPERATOR = "connector_io_tasks_per_scan_operator";
@@ -1184,9 +1187,10 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VarAttr(name = SPILL_REVOCABLE_MAX_BYTES)
     private long spillRevocableMaxBytes = 0;
     // the encoding level of spilled data, the meaning of values is similar to transmission_encode_level,
-    // see more details in the comment above transmissionEncodeLevel
+    // see more details in the comment above transmissionEncodeLevel.
+    // spilled data never leaves the backend, so the frame of reference and null mask encodings are enabled.
     @VarAttr(name = SPILL_ENCODE_LEVEL)
-    private int spillEncodeLevel = 7;
+    private int spillEncodeLevel = 31;
 
     @VarAttr(name = SPILL_ENABLE_DIRECT_IO)
     private boolean spillEnableDirectIO = false;
@@ -1348,6 +1352,9 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // encode integers/binary per column for exchange, controlled by transmission_encode_level
     // if transmission_encode_level & 2, intergers are encode by streamvbyte, in order or not;
     // if transmission_encode_level & 4, binary columns are compressed by lz4
+    // if transmission_encode_level & 8 and & 2, 32/64-bit integers are encoded as the deltas to their minimum value
+    // before streamvbyte, which works better for small range values with a large base;
+    // if transmission_encode_level & 16, the null data of nullable columns are bit-packed;
     // if transmission_encode_level & 1, enable adaptive encoding.
     // e.g.
     // if transmission_encode_level = 7, SR will adaptively encode numbers and string columns according to the proper encoding
@@ -1719,6 +1726,11 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VariableMgr.VarAttr(name = DATACACHE_EVICT_PROBABILITY, flag = VariableMgr.INVISIBLE)
     private int datacacheEvictProbability = 100;
 
+    // The latency target of the queries of this session, the BE schedules the pipeline drivers of the queries
+    // close to their targets or nearly finished first. 0 means no target.
+    @VariableMgr.VarAttr(name = QUERY_LATENCY_TARGET_MS)
+    private long queryLatencyTargetMs = 0;
+
     private int datacachePriority = 0;
 
     private long datacacheTTLSeconds = 0L;
@@ -1734,6 +1746,11 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     @VariableMgr.VarAttr(name = CONNECTOR_IO_TASKS_PER_SCAN_OPERATOR)
     private int connectorIoTasksPerScanOperator = 16;
 
+    // The number of the range splits of a jdbc scan on the integer primary key of the table, which are read on
+    // their own connections in parallel. 1 disables the split.
+    @VariableMgr.VarAttr(name = JDBC_SCAN_SPLITS)
+    private int jdbcScanSplits = 1;
+
     @VariableMgr.VarAttr(name = ENABLE_CONNECTOR_ADAPTIVE_IO_TASKS)
     private boolean enableConnectorAdaptiveIoTasks = true;
 
@@ -2447,6 +2464,14 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         this.datacacheEvictProbability = datacacheEvictProbability;
     }
 
+    public long getQueryLatencyTargetMs() {
+        return queryLatencyTargetMs;
+    }
+
+    public void setQueryLatencyTargetMs(long queryLatencyTargetMs) {
+        this.queryLatencyTargetMs = queryLatencyTargetMs;
+    }
+
     public void setDataCachePriority(int dataCachePriority) {
         this.datacachePriority = dataCachePriority;
     }
@@ -2463,6 +2488,14 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         this.connectorIoTasksPerScanOperator = connectorIoTasksPerScanOperator;
     }
 
+    public int getJdbcScanSplits() {
+        return jdbcScanSplits;
+    }
+
+    public void setJdbcScanSplits(int jdbcScanSplits) {
+        this.jdbcScanSplits = jdbcScanSplits;
+    }
+
     public boolean isCboUseDBLock() {
         return cboUseDBLock;
     }
@@ -4340,6 +4373,9 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         tResult.setEnable_datacache_async_populate_mode(enableDataCacheAsyncPopulateMode);
         tResult.setEnable_datacache_io_adaptor(enableDataCacheIOAdaptor);
         tResult.setDatacache_evict_probability(datacacheEvictProbability);
+        if (queryLatencyTargetMs > 0) {
+            tResult.setQuery_latency_target_ms(queryLatencyTargetMs);
+        }
         tResult.setDatacache_priority(datacachePriority);
         tResult.setDatacache_ttl_seconds(datacacheTTLSeconds);
         tResult.setEnable_cache_select(enableCacheSelect);
@@ -801,6 +801,14 @@ public class MetadataMgr {
         return RemoteFileInfoDefaultSource.EMPTY;
     }
 
+    public List<String> getScanSplitFilters(String catalogName, Table table, int numSplits) {
+        Optional<ConnectorMetadata> connectorMetadata = getOptionalMetadata(catalogName);
+        if (connectorMetadata.isPresent()) {
+            return connectorMetadata.get().getScanSplitFilters(table, numSplits);
+        }
+        return new ArrayList<>();
+    }
+
     public List<PartitionInfo> getPartitions(String catalogName, Table table, List<String> partitionNames) {
         Optional<ConnectorMetadata> connectorMetadata = getOptionalMetadata(catalogName);
         if (connectorMetadata.isPresent()) {
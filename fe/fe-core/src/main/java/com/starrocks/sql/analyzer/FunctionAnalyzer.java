@@ -445,6 +445,22 @@ public class FunctionAnalyzer {
             }
         }
 
+        if (fnName.getFunction().equals(FunctionSet.PERCENTILE_APPROX_DDSKETCH)) {
+            if (functionCallExpr.getChildren().size() != 2) {
+                throw new SemanticException("percentile_approx_ddsketch(expr, DOUBLE) requires two parameters",
+                        functionCallExpr.getPos());
+            }
+            if (!functionCallExpr.getChild(0).getType().isNumericType()) {
+                throw new SemanticException(
+                        "percentile_approx_ddsketch requires the first parameter's type is numeric type");
+            }
+            if (!functionCallExpr.getChild(1).getType().isNumericType()
+                    || !functionCallExpr.getChild(1).isConstant()) {
+                throw new SemanticException(
+                        "percentile_approx_ddsketch requires the second parameter is a numeric constant");
+            }
+        }
+
         if (fnName.getFunction().equals(FunctionSet.APPROX_TOP_K)) {
             Optional<Long> k = Optional.empty();
             Optional<Long> counterNum = Optional.empty();
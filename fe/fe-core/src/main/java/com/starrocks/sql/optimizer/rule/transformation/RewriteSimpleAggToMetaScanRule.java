@@ -45,14 +45,26 @@ import java.util.List;
 import java.util.Map;
 
 // for a simple min/max/count aggregation query like
-// 'select min(c1),max(c2),count(*),count(not-null column) from olap_table',
+// 'select min(c1),max(c2),count(*),count(column) from olap_table',
 // we can use MetaScan directly to avoid reading a large amount of data.
 public class RewriteSimpleAggToMetaScanRule extends TransformationRule {
+    private static final String NONNULL_COUNT = "nonnull_count";
+
     public RewriteSimpleAggToMetaScanRule() {
         super(RuleType.TF_REWRITE_SIMPLE_AGG, Pattern.create(OperatorType.LOGICAL_AGGR)
                 .addChildren(Pattern.create(OperatorType.LOGICAL_PROJECT, OperatorType.LOGICAL_OLAP_SCAN)));
     }
 
+    private static boolean isNullableColumnCount(CallOperator aggCall, LogicalOlapScanOperator scanOperator,
+                                                 ColumnRefFactory columnRefFactory) {
+        if (!aggCall.getFnName().equals(FunctionSet.COUNT) || aggCall.getUsedColumns().cardinality() != 1) {
+            return false;
+        }
+        ColumnRefOperator usedColumn = columnRefFactory.getColumnRef(aggCall.getUsedColumns().getFirstId());
+        Column column = scanOperator.getColRefToColumnMetaMap().get(usedColumn);
+        return column != null && column.isAllowNull();
+    }
+
     private OptExpression buildAggMetaScanOperator(LogicalAggregationOperator aggregationOperator,
                                                    LogicalOlapScanOperator scanOperator,
                                                    OptimizerContext context) {
@@ -70,7 +82,9 @@ public class RewriteSimpleAggToMetaScanRule extends TransformationRule {
         for (Map.Entry<ColumnRefOperator, CallOperator> kv : aggs.entrySet()) {
             CallOperator aggCall = kv.getValue();
             ColumnRefOperator usedColumn;
-            if (!aggCall.getFnName().equals(FunctionSet.COUNT)) {
+            // count(nullable_col) counts the not-null rows of the column by the page zone maps in BE.
+            boolean isNonNullCount = isNullableColumnCount(aggCall, scanOperator, columnRefFactory);
+            if (!aggCall.getFnName().equals(FunctionSet.COUNT) || isNonNullCount) {
                 ColumnRefSet usedColumns = aggCall.getUsedColumns();
                 Preconditions.checkArgument(usedColumns.cardinality() == 1);
                 usedColumn = columnRefFactory.getColumnRef(usedColumns.getFirstId());
@@ -79,11 +93,13 @@ public class RewriteSimpleAggToMetaScanRule extends TransformationRule {
                 usedColumn = scanOperator.getOutputColumns().get(0);
             }
 
-            String metaColumnName = aggCall.getFnName() + "_" + usedColumn.getName();
+            String metaColumnName = (isNonNullCount ? NONNULL_COUNT : aggCall.getFnName()) + "_" + usedColumn.getName();
             Type columnType = aggCall.getType();
 
             ColumnRefOperator metaColumn;
-            if (aggCall.getFnName().equals(FunctionSet.COUNT)) {
+            if (isNonNullCount) {
+                metaColumn = columnRefFactory.create(metaColumnName, columnType, aggCall.isNullable());
+            } else if (aggCall.getFnName().equals(FunctionSet.COUNT)) {
                 if (countPlaceHolderColumn != null) {
                     metaColumn = countPlaceHolderColumn;
                 } else {
@@ -199,11 +215,12 @@ public class RewriteSimpleAggToMetaScanRule extends TransformationRule {
                             ColumnRefOperator usedColumn =
                                     context.getColumnRefFactory().getColumnRef(usedColumns.getFirstId());
                             Column column = scanOperator.getColRefToColumnMetaMap().get(usedColumn);
-                            if (column == null || column.isAllowNull()) {
-                                // this is not a primitive column on table or it is nullable
+                            if (column == null) {
+                                // this is not a primitive column on table
                                 return false;
                             }
-                            return true;
+                            // the not-null rows of a nullable column are counted by BE with the page zone maps
+                            return !column.isAllowNull() || !column.getType().isComplexType();
                         } else if (usedColumns.isEmpty()) {
                             List<ScalarOperator> arguments = aggregator.getArguments();
                             if (arguments.isEmpty()) {
@@ -30,6 +30,7 @@ import org.junit.Assert;
 import org.junit.Before;
 import org.junit.Test;
 
+import java.math.BigInteger;
 import java.sql.Connection;
 import java.sql.PreparedStatement;
 import java.sql.SQLException;
@@ -266,4 +267,18 @@ public class JDBCMetadataTest {
         properties.put(JDBCResource.DRIVER_URL, "xxxx");
         new JDBCMetadata(properties, "catalog");
     }
+
+    @Test
+    public void testBuildRangeSplitFilters() {
+        List<String> filters = JDBCMetadata.buildRangeSplitFilters("`id`", BigInteger.ONE, BigInteger.valueOf(100), 4);
+        Assert.assertEquals(Arrays.asList("`id` < 26", "`id` >= 26 AND `id` < 51", "`id` >= 51 AND `id` < 76",
+                "(`id` >= 76 OR `id` IS NULL)"), filters);
+
+        filters = JDBCMetadata.buildRangeSplitFilters("id", BigInteger.valueOf(-10), BigInteger.valueOf(9), 2);
+        Assert.assertEquals(Arrays.asList("id < 0", "(id >= 0 OR id IS NULL)"), filters);
+
+        // less values than the splits
+        Assert.assertTrue(JDBCMetadata.buildRangeSplitFilters("id", BigInteger.ONE, BigInteger.valueOf(2), 4).isEmpty());
+        Assert.assertTrue(JDBCMetadata.buildRangeSplitFilters("id", BigInteger.ONE, BigInteger.TEN, 1).isEmpty());
+    }
 }
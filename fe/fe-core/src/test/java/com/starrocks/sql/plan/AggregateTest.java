@@ -1914,13 +1914,14 @@ public class AggregateTest extends PlanTestBase {
                 "  |  group by: \n" +
                 "  |  \n" +
                 "  0:OlapScanNode");
+        // count of nullable column is answered by the page zone maps
         sql = "select count(t1b) from test_all_type";
         plan = getFragmentPlan(sql);
-        assertContains(plan, "  1:AGGREGATE (update finalize)\n" +
-                "  |  output: count(2: t1b)\n" +
+        assertContains(plan, "  |  output: sum(nonnull_count_t1b)\n" +
                 "  |  group by: \n" +
                 "  |  \n" +
-                "  0:OlapScanNode");
+                "  0:MetaScan\n" +
+                "     Table: test_all_type\n");
         // with count distinct, shouldn't apply RewriteSimpleAggToMetaScanRule
         sql = "select count(distinct t1b) from test_all_type_not_null";
         plan = getFragmentPlan(sql);
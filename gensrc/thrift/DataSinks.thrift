@@ -248,6 +248,10 @@ struct TIcebergTableSink {
     5: optional bool is_static_partition_sink
     6: optional CloudConfiguration.TCloudConfiguration cloud_configuration
     7: optional i64 target_max_file_size
+    // The sort order of the table, the rows of each written row group are sorted by these columns
+    8: optional list<string> sort_column_names
+    9: optional list<bool> sort_is_asc
+    10: optional list<bool> sort_nulls_first
 }
 
 struct THiveTableSink {
@@ -771,6 +771,10 @@ struct TAuditStatistics {
     7: optional i64 mem_cost_bytes
     8: optional i64 spill_bytes
     9: optional list<TAuditStatisticsItem> stats_items
+    10: optional i64 hw_cycles
+    11: optional i64 hw_instructions
+    12: optional i64 hw_llc_misses
+    13: optional i64 hw_branch_misses
 }
 
 struct TReportAuditStatisticsParams {
@@ -114,6 +114,7 @@ enum TSpillableOperatorType {
   SORT = 3;
   NL_JOIN = 4;
   MULTI_CAST_LOCAL_EXCHANGE = 5;
+  SET_OPERATOR = 6;
 }
 
 enum TTabletInternalParallelMode {
@@ -324,6 +325,9 @@ struct TQueryOptions {
   150: optional map<string, string> ann_params;
   151: optional double pq_refine_factor;
   152: optional double k_factor;
+
+  // The latency target of the query, the BE schedules the drivers of the queries close to their targets first.
+  153: optional i64 query_latency_target_ms;
 }
 
 // A scan range plus the parameters needed to execute that scan.
@@ -402,6 +402,11 @@ struct TBinlogScanRange {
   11: optional Types.TBinlogOffset offset
 }
 
+struct TJDBCScanRange {
+  // The filter of the rows read by the split, e.g. a range of the primary key
+  1: optional string split_filter
+}
+
 // Specification of an individual data range which is held in its entirety
 // by a storage server
 struct TScanRange {
@@ -415,6 +420,8 @@ struct TScanRange {
   20: optional THdfsScanRange hdfs_scan_range
   
   30: optional TBinlogScanRange binlog_scan_range
+
+  31: optional TJDBCScanRange jdbc_scan_range
 }
 
 struct TMySQLScanNode {
@@ -578,6 +585,8 @@ struct TJDBCScanNode {
   3: optional list<string> columns
   4: optional list<string> filters
   5: optional i64 limit
+  // The filters of the splits of the scan, each split is read with its own connection
+  6: optional list<string> split_filters
 }
 
 // If you find yourself changing this struct, see also TOlapScanNode
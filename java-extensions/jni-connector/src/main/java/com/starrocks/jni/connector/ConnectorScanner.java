@@ -15,6 +15,10 @@
 package com.starrocks.jni.connector;
 
 import java.io.IOException;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 
 /**
  * The parent class of JNI scanner, developers need to inherit this class and implement the following methods:
@@ -40,9 +44,17 @@ import java.io.IOException;
  * }
  * } while (true);
  * close();
+ * <p>
+ * If {@link ConnectorScanner#enablePrefetch()} is called after open(), the next chunk is scanned by a background
+ * thread while BE converts the current one, and {@link ConnectorScanner#stopPrefetch()} is called before close().
  */
 public abstract class ConnectorScanner {
+    // The table returned to BE.
     private OffHeapTable offHeapTable;
+    // The table being filled by getNext(), which is the same as offHeapTable if the prefetch is disabled.
+    private OffHeapTable writingTable;
+    private ExecutorService prefetchExecutor;
+    private Future<OffHeapTable> prefetchedTable;
     private String[] fields;
     private ColumnType[] types;
     private int tableSize;
@@ -83,7 +95,7 @@ public abstract class ConnectorScanner {
     }
 
     protected void appendData(int index, ColumnValue value) {
-        offHeapTable.appendData(index, value);
+        writingTable.appendData(index, value);
     }
 
     protected int getTableSize() {
@@ -95,24 +107,90 @@ public abstract class ConnectorScanner {
     }
 
     public long getNextOffHeapChunk() throws IOException {
-        initOffHeapTable();
+        if (prefetchExecutor == null) {
+            offHeapTable = readOffHeapTable();
+            return offHeapTable.getMetaNativeAddress();
+        }
+
+        if (prefetchedTable == null) {
+            prefetchedTable = prefetchExecutor.submit(this::readOffHeapTable);
+        }
+        offHeapTable = waitForPrefetchedTable();
+        if (offHeapTable.getNumRows() > 0) {
+            // scan the next chunk while BE is converting this one.
+            prefetchedTable = prefetchExecutor.submit(this::readOffHeapTable);
+        }
+        return offHeapTable.getMetaNativeAddress();
+    }
+
+    /**
+     * Scan the next chunks by a background thread. The context class loader of the calling thread is used by the
+     * background thread.
+     */
+    public void enablePrefetch() {
+        if (prefetchExecutor != null) {
+            return;
+        }
+        ClassLoader classLoader = Thread.currentThread().getContextClassLoader();
+        prefetchExecutor = Executors.newSingleThreadExecutor(r -> {
+            Thread thread = new Thread(r, "jni-scanner-prefetch");
+            thread.setDaemon(true);
+            thread.setContextClassLoader(classLoader);
+            return thread;
+        });
+    }
+
+    /**
+     * Wait for the chunk being scanned by the background thread and release it. Must be called before close() if
+     * the prefetch is enabled.
+     */
+    public void stopPrefetch() {
+        if (prefetchExecutor == null) {
+            return;
+        }
+        if (prefetchedTable != null) {
+            try {
+                OffHeapTable table = waitForPrefetchedTable();
+                table.close();
+            } catch (IOException e) {
+                // the table is released by readOffHeapTable() on failure.
+            }
+        }
+        prefetchExecutor.shutdownNow();
+        prefetchExecutor = null;
+    }
+
+    private OffHeapTable readOffHeapTable() throws IOException {
+        OffHeapTable table = new OffHeapTable(types, fields, tableSize);
+        writingTable = table;
         int numRows = 0;
         try {
             numRows = getNext();
-        } catch (IOException e) {
-            releaseOffHeapTable();
+        } catch (IOException | RuntimeException e) {
+            table.close();
             throw e;
+        } finally {
+            writingTable = null;
         }
-        return finishOffHeapTable(numRows);
-    }
-
-    private void initOffHeapTable() {
-        offHeapTable = new OffHeapTable(types, fields, tableSize);
+        table.setNumRows(numRows);
+        return table;
     }
 
-    private long finishOffHeapTable(int numRows) {
-        offHeapTable.setNumRows(numRows);
-        return offHeapTable.getMetaNativeAddress();
+    private OffHeapTable waitForPrefetchedTable() throws IOException {
+        Future<OffHeapTable> future = prefetchedTable;
+        prefetchedTable = null;
+        try {
+            return future.get();
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new IOException("Interrupted while waiting for the prefetched chunk", e);
+        } catch (ExecutionException e) {
+            Throwable cause = e.getCause();
+            if (cause instanceof IOException) {
+                throw (IOException) cause;
+            }
+            throw new IOException("Failed to prefetch the next chunk", cause);
+        }
     }
 
     protected void releaseOffHeapColumnVector(int fieldId) {
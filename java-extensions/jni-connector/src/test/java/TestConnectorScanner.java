@@ -0,0 +1,203 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import com.starrocks.jni.connector.ColumnType;
+import com.starrocks.jni.connector.ColumnValue;
+import com.starrocks.jni.connector.ConnectorScanner;
+import com.starrocks.jni.connector.OffHeapTable;
+import org.junit.jupiter.api.Assertions;
+import org.junit.jupiter.api.Test;
+
+import java.io.IOException;
+import java.math.BigDecimal;
+import java.time.LocalDate;
+import java.time.LocalDateTime;
+import java.util.List;
+
+public class TestConnectorScanner {
+
+    private static class IntValue implements ColumnValue {
+        private final int value;
+
+        IntValue(int value) {
+            this.value = value;
+        }
+
+        @Override
+        public boolean getBoolean() {
+            return false;
+        }
+
+        @Override
+        public short getShort() {
+            return 0;
+        }
+
+        @Override
+        public int getInt() {
+            return value;
+        }
+
+        @Override
+        public float getFloat() {
+            return 0;
+        }
+
+        @Override
+        public long getLong() {
+            return 0;
+        }
+
+        @Override
+        public double getDouble() {
+            return 0;
+        }
+
+        @Override
+        public String getString(ColumnType.TypeValue type) {
+            return null;
+        }
+
+        @Override
+        public byte[] getBytes() {
+            return null;
+        }
+
+        @Override
+        public void unpackArray(List<ColumnValue> values) {
+        }
+
+        @Override
+        public void unpackMap(List<ColumnValue> keys, List<ColumnValue> values) {
+        }
+
+        @Override
+        public void unpackStruct(List<Integer> structFieldIndex, List<ColumnValue> values) {
+        }
+
+        @Override
+        public byte getByte() {
+            return 0;
+        }
+
+        @Override
+        public BigDecimal getDecimal() {
+            return null;
+        }
+
+        @Override
+        public LocalDate getDate() {
+            return null;
+        }
+
+        @Override
+        public LocalDateTime getDateTime(ColumnType.TypeValue type) {
+            return null;
+        }
+    }
+
+    // Returns the ints from 0 to totalRows - 1 in chunks of chunkSize rows.
+    private static class IntScanner extends ConnectorScanner {
+        private final int chunkSize;
+        private final int totalRows;
+        private final int failAtChunk;
+        private int nextValue = 0;
+        private int numChunks = 0;
+
+        IntScanner(int chunkSize, int totalRows, int failAtChunk) {
+            this.chunkSize = chunkSize;
+            this.totalRows = totalRows;
+            this.failAtChunk = failAtChunk;
+        }
+
+        @Override
+        public void open() {
+            initOffHeapTableWriter(new ColumnType[] {new ColumnType("c0", "int")}, new String[] {"c0"}, chunkSize);
+        }
+
+        @Override
+        public void close() {
+        }
+
+        @Override
+        public int getNext() throws IOException {
+            if (numChunks++ == failAtChunk) {
+                throw new IOException("injected error");
+            }
+            int numRows = 0;
+            while (numRows < chunkSize && nextValue < totalRows) {
+                appendData(0, new IntValue(nextValue++));
+                numRows++;
+            }
+            return numRows;
+        }
+    }
+
+    private static int readAll(ConnectorScanner scanner) throws IOException {
+        int expected = 0;
+        while (true) {
+            scanner.getNextOffHeapChunk();
+            OffHeapTable table = scanner.getOffHeapTable();
+            int numRows = table.getNumRows();
+            for (int i = 0; i < numRows; i++) {
+                Assertions.assertEquals(expected++, table.vectors[0].getInt(i));
+            }
+            table.close();
+            if (numRows == 0) {
+                return expected;
+            }
+        }
+    }
+
+    @Test
+    public void testScan() throws IOException {
+        IntScanner scanner = new IntScanner(10, 95, -1);
+        scanner.open();
+        Assertions.assertEquals(95, readAll(scanner));
+        scanner.close();
+    }
+
+    @Test
+    public void testPrefetch() throws IOException {
+        IntScanner scanner = new IntScanner(10, 95, -1);
+        scanner.open();
+        scanner.enablePrefetch();
+        Assertions.assertEquals(95, readAll(scanner));
+        scanner.stopPrefetch();
+        scanner.close();
+    }
+
+    @Test
+    public void testStopPrefetchInTheMiddle() throws IOException {
+        IntScanner scanner = new IntScanner(10, 95, -1);
+        scanner.open();
+        scanner.enablePrefetch();
+        scanner.getNextOffHeapChunk();
+        Assertions.assertEquals(10, scanner.getOffHeapTable().getNumRows());
+        scanner.getOffHeapTable().close();
+        scanner.stopPrefetch();
+        scanner.close();
+    }
+
+    @Test
+    public void testPrefetchError() throws IOException {
+        IntScanner scanner = new IntScanner(10, 95, 2);
+        scanner.open();
+        scanner.enablePrefetch();
+        IOException e = Assertions.assertThrows(IOException.class, () -> readAll(scanner));
+        Assertions.assertEquals("injected error", e.getMessage());
+        scanner.stopPrefetch();
+        scanner.close();
+    }
+}